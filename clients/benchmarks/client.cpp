@@ -26,20 +26,25 @@
 
 #include "program_options.hpp"
 
+#include "baseline_comparison.hpp"
 #include "hipblaslt_data.hpp"
 #include "hipblaslt_datatype2string.hpp"
 #include "hipblaslt_parse_data.hpp"
+#include "testing_matmul_concurrent.hpp"
+#include "testing_matmul_replay.hpp"
 #include "type_dispatch.hpp"
 #include "utility.hpp"
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <fcntl.h>
 #include <iostream>
 #include <map>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unistd.h>
 
 #include "frequency_monitor.hpp"
 
@@ -122,7 +127,12 @@ struct perf_matmul<
     }
 };
 
-int run_bench_test(Arguments& arg, const std::string& filter, bool any_stride, bool yaml = false)
+// With concurrent set, the adjusted arguments are collected there instead of run
+int run_bench_test(Arguments&              arg,
+                   const std::string&      filter,
+                   bool                    any_stride,
+                   bool                    yaml       = false,
+                   std::vector<Arguments>* concurrent = nullptr)
 {
     hipblaslt_cout << std::setiosflags(std::ios::fixed)
                    << std::setprecision(7); // Set precision to 7 digits
@@ -225,16 +235,73 @@ int run_bench_test(Arguments& arg, const std::string& filter, bool any_stride, b
         }
     }
 
-    hipblaslt_matmul_dispatch<perf_matmul>(arg);
+    if(concurrent)
+    {
+        concurrent->push_back(arg);
+        return 0;
+    }
+
+    for(int sample = 0; sample < BaselineComparison_samples(); sample++)
+    {
+        hipblaslt_matmul_dispatch<perf_matmul>(arg);
+        BaselineComparison_end_sample();
+    }
     return 0;
 }
 
-int hipblaslt_bench_datafile(const std::string& filter, bool any_stride)
+// Takes the next problem index from the counter in path. Every worker of a sweep, on this node
+// or on others mounting the same file system, runs the problems it took only.
+int64_t claim_problem(const std::string& path)
 {
-    int ret = 0;
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if(fd < 0 || lockf(fd, F_LOCK, 0))
+        throw std::runtime_error("Cannot lock the work file " + path);
+
+    char    text[32] = {};
+    int64_t next     = 0;
+    if(pread(fd, text, sizeof(text) - 1, 0) > 0)
+        next = strtoll(text, nullptr, 10);
+    std::string counter = std::to_string(next + 1) + "\n";
+    bool        written = pwrite(fd, counter.c_str(), counter.size(), 0) == ssize_t(counter.size())
+                   && ftruncate(fd, counter.size()) == 0;
+    lockf(fd, F_ULOCK, 0);
+    close(fd);
+    if(!written)
+        throw std::runtime_error("Cannot update the work file " + path);
+    return next;
+}
+
+int hipblaslt_bench_datafile(const std::string& filter,
+                             bool               any_stride,
+                             int32_t            concurrency,
+                             int32_t            streams,
+                             const std::string& work_file)
+{
+    if(concurrency > 0)
+    {
+        std::vector<Arguments> problems;
+        for(Arguments arg : HipBlasLt_TestData())
+            run_bench_test(arg, filter, any_stride, true, &problems);
+        testing_matmul_concurrent(problems, concurrency, streams);
+        test_cleanup::cleanup();
+        return 0;
+    }
+
+    int     ret     = 0;
+    int64_t index   = 0;
+    int64_t claimed = work_file.empty() ? -1 : claim_problem(work_file);
     for(Arguments arg : HipBlasLt_TestData())
+    {
+        if(!work_file.empty())
+        {
+            if(index++ != claimed)
+                continue;
+            claimed = claim_problem(work_file);
+        }
         ret |= run_bench_test(arg, filter, any_stride, true);
+    }
     test_cleanup::cleanup();
+    ret |= BaselineComparison_report();
     return ret;
 }
 
@@ -320,9 +387,12 @@ try
     std::string scale_type;
     std::string bias_type;
     std::string bias_source;
+    std::string d2_type;
+    std::string aux_type;
     std::string initialization;
     std::string filter;
     std::string activation_type;
+    std::string rotating;
     int         scaleAFormat;
     int         scaleBFormat;
     int         device_id;
@@ -335,7 +405,23 @@ try
     std::string api_method_str  = "";
     std::string algo_method_str = "";
 
-    bool verify = 0;
+    bool        verify = 0;
+    std::string reference;
+    std::string validation;
+
+    std::string baseline;
+    std::string save_results;
+    double      regression_threshold;
+    int32_t     samples;
+    int32_t     concurrency;
+    int32_t     concurrent_streams;
+    std::string work_file;
+    double      min_sclk;
+    std::string replay;
+    double      replay_speed;
+    bool        replay_heuristic;
+    int32_t     stream_id;
+    double      time_us;
 
     bool                  grouped_gemm;
     std::vector<int64_t>  m, n, k;
@@ -446,7 +532,7 @@ try
 
         ("compute_type",
          value<std::string>(&compute_type)->default_value("f32_r"), "Precision of computation. "
-         "Options: s,f32_r,x,xf32_r,f64_r,i32_r")
+         "Options: s,f32_r,x,xf32_r,f32_3xbf16_r,f64_r,i32_r")
 
         ("compute_input_typeA",
          value<std::string>(&compute_input_typeA), "Precision of computation input A. "
@@ -485,6 +571,22 @@ try
          value<bool>(&verify)->default_value(false),
          "Validate GPU results with CPU?")
 
+        ("reference",
+         value<std::string>(&reference)->default_value("cpu"),
+         "Reference for --verify. cpu: cblas on the host. gpu: a reference kernel on the device, compared on the device, "
+         "so large problems validate without copying D back. Gradient, E output and amaxD problems fall back to cpu.")
+
+        ("validation",
+         value<std::string>(&validation)->default_value("full"),
+         "Extent of the cpu reference. full: every element of D. sampled: --validation_samples random elements, "
+         "each an O(K) dot product. checksum: column sums of D against (e^T A) B, O(MK + KN + MN), "
+         "falls back to sampled with an activation. bounded: the gpu reference, accumulating in float for the 32-bit "
+         "compute types, with an error bound per element from K, the input, compute and output types and the scales.")
+
+        ("validation_samples",
+         value<int32_t>(&arg.validation_samples)->default_value(4096),
+         "Number of elements checked by --validation sampled")
+
         ("iters,i",
          value<int32_t>(&arg.iters)->default_value(tuningEnv? 1000 : 10),
          "Iterations to run inside timing loop")
@@ -507,7 +609,8 @@ try
 
         ("activation_type",
          value<std::string>(&activation_type)->default_value("none"),
-         "Options: None, gelu, relu")
+         "Options: None, gelu, relu, swiglu, geglu. swiglu and geglu gate rows 2i and 2i + 1 "
+         "of the GEMM result into row i of D, which has m / 2 rows")
 
         ("activation_arg1",
          value<float>(&arg.activation_arg1)->default_value(0),
@@ -531,16 +634,22 @@ try
 
         ("scaleA",
          value<int>(&scaleAFormat)->default_value(0),
-         "Apply scale for A buffer. 0 = None, 1 = scalar, 2 = vector.")
+         "Apply scale for A buffer. 0 = None, 1 = scalar, 2 = vector, "
+         "3 = E8M0 scales of blocks of 32 along k.")
 
         ("scaleB",
          value<int>(&scaleBFormat)->default_value(0),
-         "Apply scale for B buffer. 0 = None, 1 = scalar, 2 = vector.")
+         "Apply scale for B buffer. 0 = None, 1 = scalar, 2 = vector, "
+         "3 = E8M0 scales of blocks of 32 along k.")
 
         ("scaleAlpha_vector",
          bool_switch(&arg.scaleAlpha_vector)->default_value(false),
          "Apply scaleAlpha vector")
 
+        ("pointer_mode_device",
+         bool_switch(&arg.pointer_mode_device)->default_value(false),
+         "Pass alpha and beta in device memory with HIPBLASLT_POINTER_MODE_DEVICE")
+
         ("amaxScaleA",
          bool_switch(&arg.amaxScaleA)->default_value(false),
          "Apply scale for A buffer by abs max of A buffer")
@@ -561,6 +670,53 @@ try
          bool_switch(&arg.gradient)->default_value(false),
          "Enable gradient")
 
+        ("d2_type",
+         value<std::string>(&d2_type),
+         "Precision of a second output D2 = D * 0.5 written by hipblasLtMatmul. "
+         "Options: f32_r,f16_r,bf16_r,i8_r,f8_r,bf8_r. Off by default")
+
+        ("scaleD_vector",
+         value<int32_t>(&arg.scaleD_vector)->default_value(0),
+         "Scale D by a vector with HIPBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT. "
+         "0 = None, 1 = per row, 2 = per column.")
+
+        ("aux_type",
+         value<std::string>(&aux_type),
+         "Precision of the AUX output with use_e, written scaled by scaleE. "
+         "Options: f32_r,f16_r,bf16_r,f8_r,bf8_r. Default is the precision of D")
+
+        ("aux_amax",
+         bool_switch(&arg.aux_amax)->default_value(false),
+         "Output the amax of the AUX output with use_e")
+
+        ("bgrad_deterministic",
+         bool_switch(&arg.bgrad_deterministic)->default_value(false),
+         "Reduce the bias gradient in a fixed order with gradient and bias_vector")
+
+        ("residual_position",
+         value<int32_t>(&arg.residual_position)->default_value(0),
+         "Add a residual of the shape of D with HIPBLASLT_MATMUL_DESC_RESIDUAL_POINTER. "
+         "0 = None, 1 = after, 2 = before the activation.")
+
+        ("dropout",
+         value<float>(&arg.dropout)->default_value(0),
+         "Probability in [0, 1) that the dropout of the epilogue zeroes an element of D. "
+         "0 = None")
+
+        ("amax_history",
+         value<int32_t>(&arg.amax_history)->default_value(0),
+         "Slots of an amax history that derives the next D scale, with amaxD and an FP8 D. "
+         "0 = None")
+
+        ("b_quant_group",
+         value<int32_t>(&arg.b_quant_group)->default_value(0),
+         "Elements along k that share a scale and zero point of an i8_r B, which is "
+         "dequantized to the precision of an f16_r or bf16_r A. 0 = None")
+
+        ("b_quant_int4",
+         bool_switch(&arg.b_quant_int4)->default_value(false),
+         "Pack the quantized B as int4, two elements per byte, with b_quant_group")
+
         ("grouped_gemm",
          value<bool>(&grouped_gemm)->default_value(false),
          "Use grouped_gemm.")
@@ -598,9 +754,16 @@ try
          value<bool>(&arg.print_kernel_info)->default_value(false),
          "Print solution, kernel name and solution index.")
 
+        ("print_selection_trace",
+         value<bool>(&arg.print_selection_trace)->default_value(false),
+         "Print every solution the heuristic evaluated, with the predicate that rejected it, "
+         "the required and provided workspace and the logic table distance.")
+
         ("rotating",
-         value<int32_t>(&arg.rotating)->default_value(tuningEnv ? 512 : 0),
-         "Use rotating memory blocks for each iteration, size in MB.")
+         value<std::string>(&rotating)->default_value(tuningEnv ? "512" : "0"),
+         "Use rotating memory blocks for each iteration, size in MB. "
+         "auto: rotate enough blocks to overflow the L2 and MALL so every call reads cold operands. "
+         "warm: a single block, so the operands stay in the caches between calls.")
 
         ("use_gpu_timer",
          value<bool>(&arg.use_gpu_timer)->default_value(false),
@@ -612,6 +775,20 @@ try
           "Skip condition: (current solution's warm up time * ratio) > best solution's warm up time. "
           "Ratio range: 0 ~ 1. 0 means no skip.")
 
+        ("timing_statistics",
+         bool_switch(&arg.timing_statistics)->default_value(false),
+         "Time every hot call with events of its own. The us column is then the median after dropping the outliers, "
+         "followed by the p90, the p99, the 95% bootstrap confidence interval of the median, the timed calls and the outliers.")
+
+        ("ci_target",
+         value<float>(&arg.ci_target)->default_value(0.0),
+         "Keep running hot calls past --iters until the confidence interval of the median is narrower than this percent of the median. "
+         "Turns on --timing_statistics. 0 runs --iters hot calls.")
+
+        ("max_iters",
+         value<int32_t>(&arg.max_iters)->default_value(10000),
+         "Most hot calls with --ci_target.")
+
         ("splitk",
          valueVec<uint32_t>(&gsu_vector),
          "[Tuning parameter] Set split K for a solution, 0 is use solution's default value. (Only support GEMM + api_method mix or cpp)")
@@ -624,6 +801,61 @@ try
         value<bool>(&arg.flush)->default_value(tuningEnv ? true : false),
         "Flush icache, only works for gemm.")
 
+        ("baseline",
+         value<std::string>(&baseline),
+         "Compare the times against a --save_results file or the output of an earlier run with the same problems and options. "
+         "Exits with 1 when a problem is significantly slower than --regression_threshold allows.")
+
+        ("save_results",
+         value<std::string>(&save_results),
+         "Write the time of every problem and sample to a file for --baseline.")
+
+        ("regression_threshold",
+         value<double>(&regression_threshold)->default_value(5.0),
+         "Slowdown against --baseline in percent that fails the run.")
+
+        ("samples",
+         value<int32_t>(&samples)->default_value(1),
+         "Measure every problem this many times. --baseline tests the difference for significance with two or more samples on both sides.")
+
+        ("concurrency",
+         value<int32_t>(&concurrency)->default_value(0),
+         "Run the problems from this many host threads at once, each with a handle of its own. Thread t runs problem t modulo the number of problems. "
+         "Reports the latency percentiles of every stream, the host time per call and the aggregate throughput. 0 runs the problems one by one.")
+
+        ("streams",
+         value<int32_t>(&concurrent_streams)->default_value(0),
+         "Number of streams the --concurrency threads share, thread t launches on stream t modulo streams. 0 gives every thread a stream of its own.")
+
+        ("min_sclk",
+         value<double>(&min_sclk)->default_value(0),
+         "Reject the timed runs whose lowest average SYSCLK in MHz is below this value: they are reported but left out of the --baseline comparison. Turns on the clock monitoring of HIPBLASLT_BENCH_FREQ. 0 accepts every run.")
+
+        ("work_file",
+         value<std::string>(&work_file)->default_value(""),
+         "Share the problems of --yaml with the other hipblaslt-bench processes given the same file. Every process runs the next problem no other one took, the file holds the index of that problem.")
+
+        ("replay",
+         value<std::string>(&replay)->default_value(""),
+         "Replay the calls of a bench log (HIPBLASLT_LOG_MASK=32) in their logged order, on the logged streams and at the logged times. "
+         "Prints the time of every problem in the replay against its time alone, then the end-to-end totals. Only calls without epilogue or scaling are replayed.")
+
+        ("replay_speed",
+         value<double>(&replay_speed)->default_value(1.0),
+         "Scale the pacing of --replay, 2 issues the calls twice as fast as logged. 0 issues them back to back.")
+
+        ("replay_heuristic",
+         bool_switch(&replay_heuristic)->default_value(false),
+         "Query the heuristic before every call of --replay so that the host time includes the solution selection.")
+
+        ("stream_id",
+         value<int32_t>(&stream_id)->default_value(0),
+         "Stream of a logged call, used by --replay and ignored otherwise.")
+
+        ("time_us",
+         value<double>(&time_us)->default_value(0),
+         "Time of a logged call, used by --replay and ignored otherwise.")
+
         ("help,h", "produces this help message")
 
         ("version", "Prints the version number");
@@ -732,6 +964,7 @@ try
 
     // transfer local variable state
     ArgumentModel_set_log_function_name(log_function_name);
+    BaselineComparison_configure(baseline, save_results, regression_threshold, samples);
 
     // Fill in the sizes to arguments
     size_t length = 1;
@@ -803,9 +1036,11 @@ try
 
     FrequencyMonitor& freq_monitor = getFrequencyMonitor();
     freq_monitor.set_device_id(device_id);
+    freq_monitor.setMinSYSCLK(min_sclk);
 
     if(datafile)
-        return hipblaslt_bench_datafile(filter, any_stride);
+        return hipblaslt_bench_datafile(
+            filter, any_stride, concurrency, concurrent_streams, work_file);
 
     // single bench run
 
@@ -868,6 +1103,29 @@ try
     else
         arg.bias_type = string_to_hip_datatype(bias_type);
 
+    arg.d2_type = string_to_hip_datatype(d2_type);
+    if(arg.d2_type == HIPBLASLT_DATATYPE_INVALID && d2_type != "")
+        throw std::invalid_argument("Invalid value for --d2_type " + d2_type);
+
+    if(arg.scaleD_vector < 0 || arg.scaleD_vector > 2)
+        throw std::invalid_argument("Invalid value for --scaleD_vector");
+
+    if(arg.residual_position < 0 || arg.residual_position > 2)
+        throw std::invalid_argument("Invalid value for --residual_position");
+
+    if(arg.dropout < 0 || arg.dropout >= 1)
+        throw std::invalid_argument("Invalid value for --dropout");
+
+    if(arg.amax_history < 0)
+        throw std::invalid_argument("Invalid value for --amax_history");
+
+    if(arg.b_quant_group < 0)
+        throw std::invalid_argument("Invalid value for --b_quant_group");
+
+    arg.aux_type = string_to_hip_datatype(aux_type);
+    if(arg.aux_type == HIPBLASLT_DATATYPE_INVALID && aux_type != "")
+        throw std::invalid_argument("Invalid value for --aux_type " + aux_type);
+
     arg.initialization = string2hipblaslt_initialization(initialization);
     if(arg.initialization == static_cast<hipblaslt_initialization>(0))
         throw std::invalid_argument("Invalid value for --initialization " + initialization);
@@ -876,6 +1134,18 @@ try
     if(arg.activation_type == static_cast<hipblaslt_activation_type>(0))
         throw std::invalid_argument("Invalid value for --activation_type " + activation_type);
 
+    if(rotating == "auto")
+        arg.rotating = HIPBLASLT_ROTATING_AUTO;
+    else if(rotating == "warm")
+        arg.rotating = HIPBLASLT_ROTATING_WARM;
+    else
+    {
+        char* end    = nullptr;
+        arg.rotating = int32_t(strtol(rotating.c_str(), &end, 10));
+        if(rotating.empty() || *end || arg.rotating < 0)
+            throw std::invalid_argument("Invalid value for --rotating " + rotating);
+    }
+
     arg.bias_source = string_to_hipblaslt_bias_source(bias_source);
 
     auto scaleInt2Enum = [](int s) {
@@ -885,6 +1155,8 @@ try
             return hipblaslt_scaling_format::Scalar;
         if(s == 2)
             return hipblaslt_scaling_format::Vector;
+        if(s == 3)
+            return hipblaslt_scaling_format::Block;
 
         return hipblaslt_scaling_format::none;
     };
@@ -905,12 +1177,31 @@ try
     if(arg.skip_slow_solution_ratio < 0 || arg.skip_slow_solution_ratio > 1)
         throw std::invalid_argument(
             "Valid value for --skip_slow_solution_ratio is in range (0.0 ~ 1.0).");
+    if(arg.ci_target < 0)
+        throw std::invalid_argument("Invalid value for --ci_target");
+    if(arg.ci_target > 0)
+        arg.timing_statistics = true;
 
     if(verify)
     {
         arg.norm_check     = 1;
         arg.allclose_check = 1;
     }
+    if(reference != "cpu" && reference != "gpu")
+        throw std::invalid_argument("Invalid value for --reference " + reference);
+    arg.gpu_reference = reference == "gpu";
+    if(validation == "full")
+        arg.validation = 0;
+    else if(validation == "sampled")
+        arg.validation = 1;
+    else if(validation == "checksum")
+        arg.validation = 2;
+    else if(validation == "bounded")
+        arg.validation = 3;
+    else
+        throw std::invalid_argument("Invalid value for --validation " + validation);
+    if(arg.validation_samples <= 0)
+        throw std::invalid_argument("Invalid value for --validation_samples");
 
     switch(api_method)
     {
@@ -932,7 +1223,22 @@ try
     }
 
     arg.norm_check_assert = false;
-    int status            = run_bench_test(arg, filter, any_stride);
+    if(!replay.empty())
+    {
+        testing_matmul_replay(replay, arg, replay_speed, replay_heuristic);
+        freeFrequencyMonitor();
+        return 0;
+    }
+    if(concurrency > 0)
+    {
+        std::vector<Arguments> problems;
+        run_bench_test(arg, filter, any_stride, false, &problems);
+        testing_matmul_concurrent(problems, concurrency, concurrent_streams);
+        freeFrequencyMonitor();
+        return 0;
+    }
+    int status = run_bench_test(arg, filter, any_stride);
+    status |= BaselineComparison_report();
     freeFrequencyMonitor();
     return status;
 }
@@ -0,0 +1,401 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Measures the time from process start to the first GEMM. Every sample is a fresh process
+// started with this executable, which times its start, the HIP initialization, hipblasLtCreate,
+// the first hipblasLtMatmulAlgoGetHeuristic and the first and second hipblasLtMatmul, and
+// reports them to the parent through a pipe. The parent never touches HIP so the children
+// start from a clean runtime; it runs the samples of every loading mode in turn.
+
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#define CHECK_HIP_ERROR(expr)                                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        hipError_t error__ = (expr);                                                               \
+        if(error__ != hipSuccess)                                                                  \
+        {                                                                                          \
+            std::cerr << "hip error " << hipGetErrorString(error__) << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+#define CHECK_HIPBLASLT_ERROR(expr)                                                                \
+    do                                                                                             \
+    {                                                                                              \
+        hipblasStatus_t status__ = (expr);                                                         \
+        if(status__ != HIPBLAS_STATUS_SUCCESS)                                                     \
+        {                                                                                          \
+            std::cerr << "hipBLASLt error " << status__ << " at " << __FILE__ << ":"               \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // In the order a sample reports them; start is spawn to main, total is spawn to the end
+    // of the first matmul
+    const std::vector<std::string> phases
+        = {"start", "hip_init", "create", "heuristic", "first_matmul", "second_matmul", "total"};
+
+    // A loading mode is the environment its samples start with
+    struct Mode
+    {
+        std::string                                      name;
+        std::vector<std::pair<std::string, std::string>> env;
+    };
+
+    struct ColdStartOptions
+    {
+        int64_t                  size    = 256;
+        uint32_t                 samples = 10;
+        int                      device  = 0;
+        std::vector<std::string> modes   = {"lazy", "preload"};
+        std::string              manifest;
+    };
+
+    void printUsage(char* programName)
+    {
+        std::cout
+            << "Usage: " << programName << " <options>\n"
+            << "options:\n"
+            << "\t-h, --help\t\t\tShow this help message\n"
+            << "\t--size\t\t\t\tm, n and k of the fp16 gemm, default is 256\n"
+            << "\t--samples\t\t\tProcesses started per mode, default is 10\n"
+            << "\t--device\t\t\tDevice of the samples, default is 0\n"
+            << "\t--modes\t\t\t\tComma separated modes out of lazy, preload, manifest and\n"
+            << "\t\t\t\t\teager, default is lazy,preload\n"
+            << "\t--manifest\t\t\tHIPBLASLT_PRELOAD_MANIFEST of the manifest mode\n";
+    }
+
+    int parseArgs(int argc, char** argv, ColdStartOptions& options)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if((arg == "-h") || (arg == "--help"))
+            {
+                return EXIT_FAILURE;
+            }
+            else if(i + 1 >= argc)
+            {
+                std::cerr << "missing value for " << arg << std::endl;
+                return EXIT_FAILURE;
+            }
+            else if(arg == "--size")
+            {
+                options.size = std::stol(argv[++i]);
+            }
+            else if(arg == "--samples")
+            {
+                options.samples = std::stoul(argv[++i]);
+            }
+            else if(arg == "--device")
+            {
+                options.device = std::stoi(argv[++i]);
+            }
+            else if(arg == "--modes")
+            {
+                options.modes.clear();
+                std::stringstream list(argv[++i]);
+                for(std::string mode; std::getline(list, mode, ',');)
+                    options.modes.push_back(mode);
+            }
+            else if(arg == "--manifest")
+            {
+                options.manifest = argv[++i];
+            }
+            else
+            {
+                std::cerr << "error with " << arg << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+
+        return (options.size > 0 && options.samples && !options.modes.empty()) ? EXIT_SUCCESS
+                                                                                : EXIT_FAILURE;
+    }
+
+    // lazy loads the code objects of the kernels on their first launch, preload loads all
+    // kernels of the device when the library is initialized, manifest only those the manifest
+    // lists, and eager turns the deferred code object loading of the HIP runtime off as well
+    bool makeMode(const std::string& name, const ColdStartOptions& options, Mode& mode)
+    {
+        mode.name = name;
+        if(name == "lazy")
+            mode.env = {{"HIPBLASLT_PRELOAD_KERNELS", "0"}};
+        else if(name == "preload")
+            mode.env = {{"HIPBLASLT_PRELOAD_KERNELS", "1"}};
+        else if(name == "manifest" && !options.manifest.empty())
+            mode.env = {{"HIPBLASLT_PRELOAD_KERNELS", "0"},
+                        {"HIPBLASLT_PRELOAD_MANIFEST", options.manifest}};
+        else if(name == "eager")
+            mode.env = {{"HIPBLASLT_PRELOAD_KERNELS", "1"}, {"HIP_ENABLE_DEFERRED_LOADING", "0"}};
+        else
+        {
+            std::cerr << "unknown mode " << name
+                      << (name == "manifest" ? ", it needs --manifest" : "") << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    double usSince(Clock::time_point begin)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - begin).count();
+    }
+
+    // The body of a sample process. steady_clock is system wide on Linux, so the start is
+    // timed from the clock reading the parent passes before it forks.
+    int runSample(int64_t spawnNs, int64_t size, int device)
+    {
+        Clock::time_point spawn{std::chrono::nanoseconds(spawnNs)};
+        std::vector<double> us;
+        us.push_back(usSince(spawn));
+
+        auto begin = Clock::now();
+        CHECK_HIP_ERROR(hipSetDevice(device));
+        hipStream_t stream;
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+        us.push_back(usSince(begin));
+
+        // The buffers are not part of any phase
+        const size_t elements = size_t(size) * size;
+        void *       da, *db, *dd, *dWorkspace;
+        uint64_t     workspaceSize = 32 * 1024 * 1024;
+        CHECK_HIP_ERROR(hipMalloc(&da, elements * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMalloc(&db, elements * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMalloc(&dd, elements * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMalloc(&dWorkspace, workspaceSize));
+        CHECK_HIP_ERROR(hipMemset(da, 0, elements * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMemset(db, 0, elements * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        begin = Clock::now();
+        hipblasLtHandle_t handle;
+        CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+        us.push_back(usSince(begin));
+
+        begin = Clock::now();
+        hipblasLtMatmulDesc_t   matmul;
+        hipblasLtMatrixLayout_t layout;
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&layout, HIP_R_16F, size, size, size));
+        hipblasLtMatmulPreference_t pref;
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceCreate(&pref));
+        CHECK_HIPBLASLT_ERROR(
+            hipblasLtMatmulPreferenceSetAttribute(pref,
+                                                  HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                  &workspaceSize,
+                                                  sizeof(workspaceSize)));
+        hipblasLtMatmulHeuristicResult_t result;
+        int                              returned = 0;
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(
+            handle, matmul, layout, layout, layout, layout, pref, 1, &result, &returned));
+        us.push_back(usSince(begin));
+        if(returned == 0)
+        {
+            std::cerr << "no solution for a " << size << "^3 fp16 gemm" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        float  alpha   = 1.f;
+        float  beta    = 0.f;
+        double totalUs = 0;
+        for(int call = 0; call < 2; call++)
+        {
+            begin = Clock::now();
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(handle,
+                                                  matmul,
+                                                  &alpha,
+                                                  da,
+                                                  layout,
+                                                  db,
+                                                  layout,
+                                                  &beta,
+                                                  dd,
+                                                  layout,
+                                                  dd,
+                                                  layout,
+                                                  &result.algo,
+                                                  dWorkspace,
+                                                  workspaceSize,
+                                                  stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            us.push_back(usSince(begin));
+            if(call == 0)
+                totalUs = usSince(spawn);
+        }
+        us.push_back(totalUs);
+
+        for(size_t i = 0; i < us.size(); i++)
+            std::cout << (i ? "," : "") << std::fixed << std::setprecision(1) << us[i];
+        std::cout << std::endl;
+
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceDestroy(pref));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(layout));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+        CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+        CHECK_HIP_ERROR(hipFree(dWorkspace));
+        CHECK_HIP_ERROR(hipFree(da));
+        CHECK_HIP_ERROR(hipFree(db));
+        CHECK_HIP_ERROR(hipFree(dd));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        return EXIT_SUCCESS;
+    }
+
+    // Starts a sample process in mode and reads its phases, empty when it failed
+    std::vector<double> startSample(const ColdStartOptions& options, const Mode& mode)
+    {
+        int fds[2];
+        if(pipe(fds) != 0)
+            return {};
+
+        int64_t spawnNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              Clock::now().time_since_epoch())
+                              .count();
+        pid_t pid = fork();
+        if(pid < 0)
+        {
+            close(fds[0]);
+            close(fds[1]);
+            return {};
+        }
+        if(pid == 0)
+        {
+            std::vector<std::string> args = {"/proc/self/exe",
+                                             "--sample",
+                                             std::to_string(spawnNs),
+                                             "--size",
+                                             std::to_string(options.size),
+                                             "--device",
+                                             std::to_string(options.device)};
+            std::vector<char*>       argv;
+            for(auto& arg : args)
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            argv.push_back(nullptr);
+
+            close(fds[0]);
+            dup2(fds[1], STDOUT_FILENO);
+            close(fds[1]);
+            for(auto& var : mode.env)
+                setenv(var.first.c_str(), var.second.c_str(), 1);
+            execv(argv[0], argv.data());
+            _exit(EXIT_FAILURE);
+        }
+
+        close(fds[1]);
+        std::string output;
+        char        buffer[256];
+        for(ssize_t n; (n = read(fds[0], buffer, sizeof(buffer))) > 0;)
+            output.append(buffer, n);
+        close(fds[0]);
+
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+            return {};
+
+        std::vector<double> us;
+        std::stringstream   line(output);
+        for(std::string field; std::getline(line, field, ',');)
+            us.push_back(std::stod(field));
+        return us.size() == phases.size() ? us : std::vector<double>{};
+    }
+
+    // Nearest rank percentile of sorted values
+    double percentile(const std::vector<double>& sorted, double p)
+    {
+        size_t rank = size_t(p * sorted.size() + 0.999999);
+        return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // A sample process, started by the loop below
+    if(argc == 8 && std::string(argv[1]) == "--sample")
+        return runSample(std::stoll(argv[2]), std::stoll(argv[4]), std::stoi(argv[6]));
+
+    ColdStartOptions options;
+    if(parseArgs(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Mode> modes(options.modes.size());
+    for(size_t i = 0; i < modes.size(); i++)
+        if(!makeMode(options.modes[i], options, modes[i]))
+            return EXIT_FAILURE;
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "us from process start, " << options.samples << " processes per mode, "
+              << options.size << "^3 fp16 gemm" << std::endl;
+    std::cout << "mode,phase,median,p90,min,max" << std::endl;
+    for(auto& mode : modes)
+    {
+        std::vector<std::vector<double>> samples(phases.size());
+        for(uint32_t s = 0; s < options.samples; s++)
+        {
+            std::vector<double> us = startSample(options, mode);
+            if(us.empty())
+            {
+                std::cerr << "sample " << s << " of mode " << mode.name << " failed" << std::endl;
+                return EXIT_FAILURE;
+            }
+            for(size_t p = 0; p < phases.size(); p++)
+                samples[p].push_back(us[p]);
+        }
+        for(size_t p = 0; p < phases.size(); p++)
+        {
+            std::sort(samples[p].begin(), samples[p].end());
+            std::cout << mode.name << "," << phases[p] << "," << percentile(samples[p], 0.5)
+                      << "," << percentile(samples[p], 0.9) << "," << samples[p].front() << ","
+                      << samples[p].back() << std::endl;
+        }
+    }
+    return EXIT_SUCCESS;
+}
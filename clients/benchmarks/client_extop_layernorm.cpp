@@ -28,6 +28,7 @@
 #include <hipblaslt/hipblaslt-ext-op.h>
 #include <hipblaslt/hipblaslt.h>
 #include <hipblaslt_datatype2string.hpp>
+#include <hipblaslt_extop_tuning.hpp>
 #include <hipblaslt_init.hpp>
 #include <iostream>
 #include <numeric>
@@ -44,7 +45,9 @@ void printUsage(char* programName)
               << "\t-n, --n\t\t\t\tSize of dim 1, default is 16\n"
               << "\t-a, --affine\t\t\t\tEnable Gamma and Beta, default is false\n"
               << "\t--initialization \t\tInitialize matrix data. Options: rand_int, trig_float, "
-                 "hpl(floating), special, zero. (default is hpl)\n";
+                 "hpl(floating), special, zero. (default is hpl)\n"
+              << "\t--tune <file>\t\t\tTime every kernel on n buckets up to n and append the "
+                 "fastest to the ext op tuning file\n";
 }
 
 void cpuLayerNorm(float*        out,
@@ -88,8 +91,13 @@ void cpuLayerNorm(float*        out,
     }
 }
 
-int parseArgs(
-    int argc, char** argv, size_t* m, size_t* n, bool* affine, hipblaslt_initialization* init)
+int parseArgs(int                       argc,
+              char**                    argv,
+              size_t*                   m,
+              size_t*                   n,
+              bool*                     affine,
+              hipblaslt_initialization* init,
+              std::string*              tuneFile)
 {
     if(argc <= 1)
     {
@@ -131,6 +139,10 @@ int parseArgs(
 
                 *init = string2hipblaslt_initialization(initStr);
             }
+            else if(arg == "--tune")
+            {
+                *tuneFile = argv[++i];
+            }
         }
         else
         {
@@ -231,8 +243,9 @@ int main(int argc, char** argv)
     std::size_t              n{64};
     bool                     affine{false};
     hipblaslt_initialization init{hipblaslt_initialization::hpl};
+    std::string              tuneFile;
 
-    if(auto err = parseArgs(argc, argv, &m, &n, &affine, &init))
+    if(auto err = parseArgs(argc, argv, &m, &n, &affine, &init, &tuneFile))
     {
         printUsage(argv[0]);
         return err;
@@ -286,6 +299,62 @@ int main(int argc, char** argv)
 
     hipStream_t stream{};
     hipErr = hipStreamCreate(&stream);
+
+    if(!tuneFile.empty())
+    {
+        // Buffers are sized for the largest n, smaller buckets use the front of them
+        auto timeRun = [&](uint32_t cols) {
+            hipEvent_t beg, end;
+            hipErr      = hipEventCreate(&beg);
+            hipErr      = hipEventCreate(&end);
+            int numRuns = 200;
+            //warmup
+            auto hipblasltErr = hipblasltExtLayerNorm(HIP_R_32F,
+                                                      gpuOutput,
+                                                      gpuMean,
+                                                      gpuInvvar,
+                                                      gpuInput,
+                                                      m,
+                                                      cols,
+                                                      1e-05,
+                                                      gpuGamma,
+                                                      gpuBeta,
+                                                      stream);
+            hipErr            = hipEventRecord(beg, stream);
+
+            for(int i = 0; i < numRuns; ++i)
+            {
+                hipblasltErr = hipblasltExtLayerNorm(HIP_R_32F,
+                                                     gpuOutput,
+                                                     gpuMean,
+                                                     gpuInvvar,
+                                                     gpuInput,
+                                                     m,
+                                                     cols,
+                                                     1e-05,
+                                                     gpuGamma,
+                                                     gpuBeta,
+                                                     stream);
+            }
+
+            hipErr = hipEventRecord(end, stream);
+            hipErr = hipEventSynchronize(end);
+            float dur{};
+            hipErr = hipEventElapsedTime(&dur, beg, end);
+            hipErr = hipEventDestroy(beg);
+            hipErr = hipEventDestroy(end);
+            return dur / numRuns;
+        };
+
+        auto err = tuneExtOp(tuneFile, "LayerNorm", HIP_R_32F, "S", n, timeRun);
+        hipErr   = hipStreamDestroy(stream);
+        hipErr   = hipFree(gpuOutput);
+        hipErr   = hipFree(gpuMean);
+        hipErr   = hipFree(gpuInvvar);
+        hipErr   = hipFree(gpuInput);
+        return err;
+    }
+
     //warmup
     auto hipblasltErr = hipblasltExtLayerNorm(
         HIP_R_32F, gpuOutput, gpuMean, gpuInvvar, gpuInput, m, n, 1e-05, gpuGamma, gpuBeta, stream);
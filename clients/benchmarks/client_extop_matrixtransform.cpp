@@ -24,6 +24,8 @@
  *
  *******************************************************************************/
 #include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <hip/hip_runtime.h>
 #include <hipblaslt/hipblaslt.h>
 #include <hipblaslt_datatype2string.hpp>
@@ -31,6 +33,8 @@
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <sstream>
+#include <string>
 #include <vector>
 
 struct MatrixTransformIO
@@ -161,6 +165,56 @@ hipDataType str2Datatype(const std::string& typeStr)
     return HIPBLASLT_DATATYPE_INVALID;
 }
 
+std::string datatype2Str(hipDataType datatype)
+{
+    switch(datatype)
+    {
+    case HIP_R_32F:
+        return "fp32";
+    case HIP_R_16F:
+        return "fp16";
+    case HIP_R_16BF:
+        return "bf16";
+    case HIP_R_8I:
+        return "i8";
+    case HIP_R_32I:
+        return "i32";
+    default:
+        return "invalid";
+    }
+}
+
+std::vector<std::string> splitList(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::stringstream        ss(list);
+    std::string              item;
+
+    while(std::getline(ss, item, ','))
+    {
+        if(!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+// Options of the --sweep mode. Every combination of sizes x datatypes x memory orders x scalar
+// modes is benchmarked and reported as one CSV row.
+struct SweepOptions
+{
+    bool        enabled{};
+    std::string sizes{"1024x1024,2048x2048,4096x4096,8192x8192,4096x1024,1024x4096,1x8192,8192x1"};
+    std::string datatypes{"fp32,fp16,bf16,i8"};
+    std::string orders{"all"};
+    std::string scalarModes{"host_beta0,host,device_beta0,device"};
+    std::string csvPath;
+    double      peakBandwidth{}; // GB/s, 0 to query hipDeviceProp_t
+    int         numRuns{50};
+};
+
 static int parseArguments(int                       argc,
                           char*                     argv[],
                           hipDataType&              datatype,
@@ -180,7 +234,8 @@ static int parseArguments(int                       argc,
                           int32_t&                  batchSize,
                           int64_t&                  batchStride,
                           bool&                     runValidation,
-                          hipblaslt_initialization& init)
+                          hipblaslt_initialization& init,
+                          SweepOptions&             sweep)
 {
     if(argc >= 2)
     {
@@ -254,6 +309,38 @@ static int parseArguments(int                       argc,
                 {
                     rowMajC = (atoi(argv[++i]) > 0);
                 }
+                else if(arg == "--sweep")
+                {
+                    sweep.enabled = true;
+                }
+                else if(arg == "--sweep_sizes" && (i + 1 < argc))
+                {
+                    sweep.sizes = argv[++i];
+                }
+                else if(arg == "--sweep_datatypes" && (i + 1 < argc))
+                {
+                    sweep.datatypes = argv[++i];
+                }
+                else if(arg == "--sweep_orders" && (i + 1 < argc))
+                {
+                    sweep.orders = argv[++i];
+                }
+                else if(arg == "--sweep_scalar_modes" && (i + 1 < argc))
+                {
+                    sweep.scalarModes = argv[++i];
+                }
+                else if(arg == "--csv" && (i + 1 < argc))
+                {
+                    sweep.csvPath = argv[++i];
+                }
+                else if(arg == "--peak_bw" && (i + 1 < argc))
+                {
+                    sweep.peakBandwidth = atof(argv[++i]);
+                }
+                else if(arg == "--iters" && (i + 1 < argc))
+                {
+                    sweep.numRuns = std::max(1, atoi(argv[++i]));
+                }
                 else if(arg == "--validation" || arg == "-V")
                 {
                     runValidation = true;
@@ -523,293 +610,470 @@ void validation(void*    c,
     }
 }
 
-int main(int argc, char** argv)
+struct TransformConfig
 {
-    int64_t                  m         = 2048;
-    int64_t                  n         = 2048;
-    int32_t                  batchSize = 1;
-    float                    alpha     = 1;
-    float                    beta      = 1;
-    auto                     transA    = false;
-    auto                     transB    = false;
-    auto                     rowMajA   = false;
-    auto                     rowMajB   = false;
-    auto                     rowMajC   = false;
-    int64_t                  batchStride{};
-    uint32_t                 ldA{};
-    uint32_t                 ldB{};
-    uint32_t                 ldC{};
-    bool                     runValidation{};
-    hipblaslt_initialization init{hipblaslt_initialization::hpl};
-    hipDataType              datatype{HIP_R_32F};
-    hipDataType              scaleDatatype{HIP_R_32F};
-    parseArguments(argc,
-                   argv,
-                   datatype,
-                   scaleDatatype,
-                   m,
-                   n,
-                   alpha,
-                   beta,
-                   transA,
-                   transB,
-                   ldA,
-                   ldB,
-                   ldC,
-                   rowMajA,
-                   rowMajB,
-                   rowMajC,
-                   batchSize,
-                   batchStride,
-                   runValidation,
-                   init);
-
-    if(!ldA || !ldB || !ldC)
-    {
-        ldA = rowMajA ? getLeadingDimSize<true>(m, n) : getLeadingDimSize<false>(m, n);
-        ldB = rowMajB ? getLeadingDimSize<true>(m, n) : getLeadingDimSize<false>(m, n);
-        ldC = rowMajC ? getLeadingDimSize<true>(m, n) : getLeadingDimSize<false>(m, n);
-    }
-
-    if(!batchStride)
-    {
-        batchStride = m * n;
-    }
-
-    hipblasLtOrder_t orderA = rowMajA ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL;
-    hipblasLtOrder_t orderB = rowMajB ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL;
-    hipblasLtOrder_t orderC = rowMajC ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL;
-    auto             tA     = transA ? HIPBLAS_OP_T : HIPBLAS_OP_N;
-    auto             tB     = transB ? HIPBLAS_OP_T : HIPBLAS_OP_N;
-
-    auto  inputs = makeMatrixTransformIOPtr(datatype, m, n, batchSize, init);
+    hipDataType            datatype{HIP_R_32F};
+    hipDataType            scaleDatatype{HIP_R_32F};
+    int64_t                m{};
+    int64_t                n{};
+    float                  alpha{1};
+    float                  beta{1};
+    bool                   transA{};
+    bool                   transB{};
+    bool                   rowMajA{};
+    bool                   rowMajB{};
+    bool                   rowMajC{};
+    uint32_t               ldA{};
+    uint32_t               ldB{};
+    uint32_t               ldC{};
+    int32_t                batchSize{1};
+    int64_t                batchStride{};
+    hipblasLtPointerMode_t pointerMode{HIPBLASLT_POINTER_MODE_HOST};
+};
+
+// Fills in the leading dimensions and batch stride left at 0 for packed matrices.
+void setPackedLayout(TransformConfig& cfg)
+{
+    if(!cfg.ldA || !cfg.ldB || !cfg.ldC)
+    {
+        const int64_t rowsA = cfg.transA ? cfg.n : cfg.m;
+        const int64_t colsA = cfg.transA ? cfg.m : cfg.n;
+        const int64_t rowsB = cfg.transB ? cfg.n : cfg.m;
+        const int64_t colsB = cfg.transB ? cfg.m : cfg.n;
+        cfg.ldA = cfg.rowMajA ? getLeadingDimSize<true>(rowsA, colsA)
+                              : getLeadingDimSize<false>(rowsA, colsA);
+        cfg.ldB = cfg.rowMajB ? getLeadingDimSize<true>(rowsB, colsB)
+                              : getLeadingDimSize<false>(rowsB, colsB);
+        cfg.ldC = cfg.rowMajC ? getLeadingDimSize<true>(cfg.m, cfg.n)
+                              : getLeadingDimSize<false>(cfg.m, cfg.n);
+    }
+
+    if(!cfg.batchStride)
+    {
+        cfg.batchStride = cfg.m * cfg.n;
+    }
+}
+
+// Peak DRAM bandwidth in GB/s: memoryClockRate is in kHz and HBM transfers on both clock edges.
+double queryPeakBandwidth()
+{
+    int             deviceId{};
+    hipDeviceProp_t prop{};
+
+    if(hipGetDevice(&deviceId) != hipSuccess
+       || hipGetDeviceProperties(&prop, deviceId) != hipSuccess)
+    {
+        return 0;
+    }
+
+    return 2. * prop.memoryClockRate * 1e3 * (prop.memoryBusWidth / 8.) / 1e9;
+}
+
+// Stores v in the representation of scaleDatatype, which is what hipblasLtMatrixTransform reads
+// alpha and beta as in both pointer modes.
+void storeScalar(void* dst, hipDataType scaleDatatype, float v)
+{
+    if(scaleDatatype == HIP_R_16F)
+    {
+        *static_cast<hipblasLtHalf*>(dst) = static_cast<hipblasLtHalf>(v);
+    }
+    else
+    {
+        *static_cast<float*>(dst) = v;
+    }
+}
+
+void validateTransform(const TransformConfig& cfg, void* dC, void* dA, void* dB)
+{
+    auto run = [&](auto dummy) {
+        using DType = decltype(dummy);
+        validation<DType>(dC,
+                          dA,
+                          dB,
+                          cfg.alpha,
+                          cfg.beta,
+                          cfg.m,
+                          cfg.n,
+                          cfg.ldA,
+                          cfg.ldB,
+                          cfg.ldC,
+                          cfg.batchSize,
+                          cfg.batchStride,
+                          cfg.rowMajA,
+                          cfg.rowMajB,
+                          cfg.rowMajC,
+                          cfg.transA,
+                          cfg.transB);
+    };
+
+    if(cfg.datatype == HIP_R_32F)
+    {
+        run(float{});
+    }
+    else if(cfg.datatype == HIP_R_16F)
+    {
+        run(hipblasLtHalf{});
+    }
+    else if(cfg.datatype == HIP_R_16BF)
+    {
+        run(hipblasLtBfloat16{});
+    }
+    else if(cfg.datatype == HIP_R_8I)
+    {
+        run(int8_t{});
+    }
+    else if(cfg.datatype == HIP_R_32I)
+    {
+        run(int32_t{});
+    }
+}
+
+// Runs cfg once as warmup and then numRuns times, returning the average time of one call in ms.
+int benchmarkTransform(hipblasLtHandle_t        handle,
+                       const TransformConfig&   cfg,
+                       hipblaslt_initialization init,
+                       int                      numRuns,
+                       bool                     runValidation,
+                       float&                   avgDur,
+                       size_t&                  elemNumBytes)
+{
+    auto inputs = makeMatrixTransformIOPtr(cfg.datatype, cfg.m, cfg.n, cfg.batchSize, init);
+
+    if(!inputs)
+    {
+        std::cerr << "Unsupported datatype " << datatype2Str(cfg.datatype) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    elemNumBytes = inputs->elemNumBytes();
     void* dA     = inputs->getBuf(0);
     void* dB     = inputs->getBuf(1);
     void* dC     = inputs->getBuf(2);
 
-    hipblasLtMatrixTransformDesc_t desc;
-    auto                   hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, scaleDatatype);
-    hipblasLtPointerMode_t pMode        = HIPBLASLT_POINTER_MODE_HOST;
-    hipblasLtErr                        = hipblasLtMatrixTransformDescSetAttribute(
-        desc,
-        hipblasLtMatrixTransformDescAttributes_t::HIPBLASLT_MATRIX_TRANSFORM_DESC_POINTER_MODE,
-        &pMode,
-        sizeof(pMode));
+    hipblasLtOrder_t orderA = cfg.rowMajA ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL;
+    hipblasLtOrder_t orderB = cfg.rowMajB ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL;
+    hipblasLtOrder_t orderC = cfg.rowMajC ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL;
+    auto             tA     = cfg.transA ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    auto             tB     = cfg.transB ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    auto             pMode  = cfg.pointerMode;
 
-    if(hipblasLtErr)
+    // Large enough for any scale type, in host memory or on the device depending on pointerMode
+    alignas(8) char hAlpha[8]{};
+    alignas(8) char hBeta[8]{};
+    storeScalar(hAlpha, cfg.scaleDatatype, cfg.alpha);
+    storeScalar(hBeta, cfg.scaleDatatype, cfg.beta);
+    const void* alphaPtr = hAlpha;
+    const void* betaPtr  = hBeta;
+    void*       dScalars{};
+
+    if(pMode == HIPBLASLT_POINTER_MODE_DEVICE)
     {
-        return EXIT_FAILURE;
-    }
+        if(hipMalloc(&dScalars, 2 * sizeof(hAlpha)) != hipSuccess)
+        {
+            return EXIT_FAILURE;
+        }
 
-    std::pair<int64_t, int64_t> shapeA;
-    std::pair<int64_t, int64_t> shapeB;
-    shapeA.first  = transA ? n : m;
-    shapeA.second = transA ? m : n;
-    shapeB.first  = transB ? n : m;
-    shapeB.second = transB ? m : n;
+        hipMemcpy(dScalars, hAlpha, sizeof(hAlpha), hipMemcpyHostToDevice);
+        hipMemcpy(static_cast<char*>(dScalars) + sizeof(hAlpha),
+                  hBeta,
+                  sizeof(hBeta),
+                  hipMemcpyHostToDevice);
+        alphaPtr = dScalars;
+        betaPtr  = static_cast<char*>(dScalars) + sizeof(hAlpha);
+    }
 
+    hipblasLtMatrixTransformDesc_t desc{};
+    hipblasLtMatrixLayout_t        layoutA{}, layoutB{}, layoutC{};
+    auto hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, cfg.scaleDatatype);
+    hipblasLtErr      = hipblasLtMatrixTransformDescSetAttribute(
+        desc,
+        hipblasLtMatrixTransformDescAttributes_t::HIPBLASLT_MATRIX_TRANSFORM_DESC_POINTER_MODE,
+        &pMode,
+        sizeof(pMode));
     hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
         desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSA, &tA, sizeof(tA));
     hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
         desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSB, &tB, sizeof(tB));
-    hipblasLtMatrixLayout_t layoutA, layoutB, layoutC;
-    hipblasLtErr
-        = hipblasLtMatrixLayoutCreate(&layoutA, datatype, shapeA.first, shapeA.second, ldA);
-    hipblasLtErr
-        = hipblasLtMatrixLayoutCreate(&layoutB, datatype, shapeB.first, shapeB.second, ldB);
-    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, datatype, m, n, ldC);
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutA,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_ORDER,
-        &orderA,
-        sizeof(orderA));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutB,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_ORDER,
-        &orderB,
-        sizeof(orderB));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutC,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_ORDER,
-        &orderC,
-        sizeof(orderC));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutA,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-        &batchSize,
-        sizeof(batchSize));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutB,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-        &batchSize,
-        sizeof(batchSize));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutC,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
-        &batchSize,
-        sizeof(batchSize));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutA,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-        &batchStride,
-        sizeof(batchStride));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutB,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-        &batchStride,
-        sizeof(batchStride));
-    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
-        layoutC,
-        hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
-        &batchStride,
-        sizeof(batchStride));
-    hipblasLtHandle_t handle{};
-    hipblasLtErr = hipblasLtCreate(&handle);
+
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(
+        &layoutA, cfg.datatype, cfg.transA ? cfg.n : cfg.m, cfg.transA ? cfg.m : cfg.n, cfg.ldA);
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(
+        &layoutB, cfg.datatype, cfg.transB ? cfg.n : cfg.m, cfg.transB ? cfg.m : cfg.n, cfg.ldB);
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, cfg.datatype, cfg.m, cfg.n, cfg.ldC);
+
+    const std::pair<hipblasLtMatrixLayout_t, hipblasLtOrder_t*> layouts[]
+        = {{layoutA, &orderA}, {layoutB, &orderB}, {layoutC, &orderC}};
+
+    for(const auto& [layout, order] : layouts)
+    {
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layout,
+            hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_ORDER,
+            order,
+            sizeof(*order));
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layout,
+            hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
+            &cfg.batchSize,
+            sizeof(cfg.batchSize));
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layout,
+            hipblasLtMatrixLayoutAttribute_t::HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+            &cfg.batchStride,
+            sizeof(cfg.batchStride));
+    }
+
     //warmup
     hipblasLtErr = hipblasLtMatrixTransform(
-        handle, desc, &alpha, dA, layoutA, &beta, dB, layoutB, dC, layoutC, nullptr);
+        handle, desc, alphaPtr, dA, layoutA, betaPtr, dB, layoutB, dC, layoutC, nullptr);
+    int status = hipblasLtErr ? EXIT_FAILURE : EXIT_SUCCESS;
 
-    if(hipblasLtErr)
+    if(status == EXIT_SUCCESS)
     {
-        std::cerr << "Unable to launch hipblasLtMatrixTransform\n";
-        return EXIT_FAILURE;
-    }
+        auto err = hipStreamSynchronize(nullptr);
 
-    auto err = hipStreamSynchronize(nullptr);
+        hipEvent_t start, stop;
+        err = hipEventCreate(&start);
+        err = hipEventCreate(&stop);
+        err = hipEventRecord(start);
 
-    hipEvent_t start, stop;
-    err = hipEventCreate(&start);
-    err = hipEventCreate(&stop);
-    err = hipEventRecord(start);
+        for(int i = 0; i < numRuns; ++i)
+        {
+            hipblasLtErr = hipblasLtMatrixTransform(
+                handle, desc, alphaPtr, dA, layoutA, betaPtr, dB, layoutB, dC, layoutC, nullptr);
+        }
 
-    constexpr int numRuns{50};
+        err = hipEventRecord(stop);
+        err = hipStreamSynchronize(nullptr);
+        float dur{};
+        err    = hipEventElapsedTime(&dur, start, stop);
+        avgDur = dur / numRuns;
+        err    = hipEventDestroy(start);
+        err    = hipEventDestroy(stop);
 
-    for(int i = 0; i < numRuns; ++i)
-    {
-        hipblasLtErr = hipblasLtMatrixTransform(
-            handle, desc, &alpha, dA, layoutA, &beta, dB, layoutB, dC, layoutC, nullptr);
+        if(runValidation)
+        {
+            validateTransform(cfg, dC, dA, dB);
+        }
     }
 
-    err = hipEventRecord(stop);
-    err = hipStreamSynchronize(nullptr);
-    float dur{};
-    float refDur{};
-    err               = hipEventElapsedTime(&dur, start, stop);
-    const auto avgDur = dur / numRuns;
-    std::cout << "hipblasLtMatrixTransform elapsed time: " << std::to_string(avgDur) << " ms\n";
-    std::cout << "Throughput: "
-              << 3. * m * n * batchSize * inputs->elemNumBytes() / std::pow(1024, 4) / avgDur * 1e3
-              << " TB/s\n";
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutB);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
+    hipFree(dScalars);
+    return status;
+}
+
+void writeCsvHeader(std::ostream& os)
+{
+    os << "datatype,scale_datatype,m,n,batch_count,trans_a,trans_b,order_a,order_b,order_c,"
+          "pointer_mode,alpha,beta,time_us,gb_per_s,peak_gb_per_s,peak_pct\n";
+}
 
-    if(runValidation)
+// The kernels always read A and B and write C, so a transform moves three matrices regardless
+// of beta.
+void writeCsvRow(std::ostream&          os,
+                 const TransformConfig& cfg,
+                 float                  avgDur,
+                 size_t                 elemNumBytes,
+                 double                 peakBandwidth)
+{
+    const double numBytes = 3. * cfg.m * cfg.n * cfg.batchSize * elemNumBytes;
+    const double gbPerSec = numBytes / (avgDur * 1e-3) / 1e9;
+    const auto   order    = [](bool rowMaj) { return rowMaj ? "row" : "col"; };
+
+    os << datatype2Str(cfg.datatype) << ',' << datatype2Str(cfg.scaleDatatype) << ',' << cfg.m
+       << ',' << cfg.n << ',' << cfg.batchSize << ',' << (cfg.transA ? 'T' : 'N') << ','
+       << (cfg.transB ? 'T' : 'N') << ',' << order(cfg.rowMajA) << ',' << order(cfg.rowMajB)
+       << ',' << order(cfg.rowMajC) << ','
+       << (cfg.pointerMode == HIPBLASLT_POINTER_MODE_DEVICE ? "device" : "host") << ','
+       << cfg.alpha << ',' << cfg.beta << ',' << avgDur * 1e3 << ',' << gbPerSec << ','
+       << peakBandwidth << ',' << (peakBandwidth > 0 ? 100. * gbPerSec / peakBandwidth : 0.)
+       << '\n';
+}
+
+// Benchmarks every combination of the --sweep_* lists on top of base and writes one CSV row per
+// configuration. Configurations the library rejects are reported on stderr and skipped.
+int runSweep(hipblasLtHandle_t        handle,
+             const TransformConfig&   base,
+             const SweepOptions&      sweep,
+             hipblaslt_initialization init,
+             bool                     runValidation,
+             double                   peakBandwidth,
+             std::ostream&            os)
+{
+    std::vector<std::pair<int64_t, int64_t>> sizes;
+
+    for(const auto& size : splitList(sweep.sizes))
     {
-        if(datatype == HIP_R_32F)
+        const auto x = size.find('x');
+
+        if(x == std::string::npos)
         {
-            validation<float>(dC,
-                              dA,
-                              dB,
-                              alpha,
-                              beta,
-                              m,
-                              n,
-                              ldA,
-                              ldB,
-                              ldC,
-                              batchSize,
-                              batchStride,
-                              rowMajA,
-                              rowMajB,
-                              rowMajC,
-                              transA,
-                              transB);
+            sizes.emplace_back(std::stoll(size), std::stoll(size));
         }
-        else if(datatype == HIP_R_16F)
+        else
         {
-            validation<hipblasLtHalf>(dC,
-                                      dA,
-                                      dB,
-                                      alpha,
-                                      beta,
-                                      m,
-                                      n,
-                                      ldA,
-                                      ldB,
-                                      ldC,
-                                      batchSize,
-                                      batchStride,
-                                      rowMajA,
-                                      rowMajB,
-                                      rowMajC,
-                                      transA,
-                                      transB);
+            sizes.emplace_back(std::stoll(size.substr(0, x)), std::stoll(size.substr(x + 1)));
         }
-        else if(datatype == HIP_R_16BF)
+    }
+
+    // Orders are given as three letters for A, B and C, e.g. "ccr" for a column major A and B
+    // and a row major C.
+    std::vector<std::string> orders = splitList(sweep.orders);
+
+    if(orders.size() == 1 && orders[0] == "all")
+    {
+        orders = {"ccc", "ccr", "crc", "crr", "rcc", "rcr", "rrc", "rrr"};
+    }
+
+    writeCsvHeader(os);
+
+    for(const auto& [m, n] : sizes)
+    {
+        for(const auto& typeStr : splitList(sweep.datatypes))
         {
-            validation<hipblasLtBfloat16>(dC,
-                                          dA,
-                                          dB,
-                                          alpha,
-                                          beta,
-                                          m,
-                                          n,
-                                          ldA,
-                                          ldB,
-                                          ldC,
-                                          batchSize,
-                                          batchStride,
-                                          rowMajA,
-                                          rowMajB,
-                                          rowMajC,
-                                          transA,
-                                          transB);
+            for(const auto& orderStr : orders)
+            {
+                for(const auto& mode : splitList(sweep.scalarModes))
+                {
+                    TransformConfig cfg = base;
+                    cfg.m               = m;
+                    cfg.n               = n;
+                    cfg.datatype        = str2Datatype(typeStr);
+                    cfg.ldA = cfg.ldB = cfg.ldC = 0;
+                    cfg.batchStride             = 0;
+
+                    if(cfg.datatype == HIPBLASLT_DATATYPE_INVALID || orderStr.size() != 3
+                       || (mode.rfind("host", 0) != 0 && mode.rfind("device", 0) != 0))
+                    {
+                        std::cerr << "Invalid sweep entry " << typeStr << '/' << orderStr << '/'
+                                  << mode << '\n';
+                        return EXIT_FAILURE;
+                    }
+
+                    cfg.rowMajA     = orderStr[0] == 'r';
+                    cfg.rowMajB     = orderStr[1] == 'r';
+                    cfg.rowMajC     = orderStr[2] == 'r';
+                    cfg.pointerMode = mode.rfind("device", 0) == 0 ? HIPBLASLT_POINTER_MODE_DEVICE
+                                                                   : HIPBLASLT_POINTER_MODE_HOST;
+
+                    if(mode.size() > 6 && mode.compare(mode.size() - 6, 6, "_beta0") == 0)
+                    {
+                        cfg.beta = 0;
+                    }
+
+                    setPackedLayout(cfg);
+                    float  avgDur{};
+                    size_t elemNumBytes{};
+
+                    if(benchmarkTransform(
+                           handle, cfg, init, sweep.numRuns, runValidation, avgDur, elemNumBytes)
+                       != EXIT_SUCCESS)
+                    {
+                        std::cerr << "Skipping " << m << 'x' << n << ' ' << typeStr << ' '
+                                  << orderStr << ' ' << mode << '\n';
+                        continue;
+                    }
+
+                    writeCsvRow(os, cfg, avgDur, elemNumBytes, peakBandwidth);
+                }
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    TransformConfig          cfg;
+    SweepOptions             sweep;
+    bool                     runValidation{};
+    hipblaslt_initialization init{hipblaslt_initialization::hpl};
+    cfg.m = 2048;
+    cfg.n = 2048;
+
+    if(parseArguments(argc,
+                      argv,
+                      cfg.datatype,
+                      cfg.scaleDatatype,
+                      cfg.m,
+                      cfg.n,
+                      cfg.alpha,
+                      cfg.beta,
+                      cfg.transA,
+                      cfg.transB,
+                      cfg.ldA,
+                      cfg.ldB,
+                      cfg.ldC,
+                      cfg.rowMajA,
+                      cfg.rowMajB,
+                      cfg.rowMajC,
+                      cfg.batchSize,
+                      cfg.batchStride,
+                      runValidation,
+                      init,
+                      sweep)
+       != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+
+    setPackedLayout(cfg);
+
+    const double peakBandwidth
+        = sweep.peakBandwidth > 0 ? sweep.peakBandwidth : queryPeakBandwidth();
+    std::ofstream csvFile;
+
+    if(!sweep.csvPath.empty())
+    {
+        csvFile.open(sweep.csvPath);
+
+        if(!csvFile)
+        {
+            std::cerr << "Unable to open " << sweep.csvPath << '\n';
+            return EXIT_FAILURE;
         }
-        else if(datatype == HIP_R_8I)
+    }
+
+    hipblasLtHandle_t handle{};
+    auto              hipblasLtErr = hipblasLtCreate(&handle);
+    int               status       = EXIT_SUCCESS;
+
+    if(sweep.enabled)
+    {
+        std::ostream& os = csvFile.is_open() ? static_cast<std::ostream&>(csvFile) : std::cout;
+        status = runSweep(handle, cfg, sweep, init, runValidation, peakBandwidth, os);
+    }
+    else
+    {
+        float  avgDur{};
+        size_t elemNumBytes{};
+        status = benchmarkTransform(
+            handle, cfg, init, sweep.numRuns, runValidation, avgDur, elemNumBytes);
+
+        if(status != EXIT_SUCCESS)
         {
-            validation<int8_t>(dC,
-                               dA,
-                               dB,
-                               alpha,
-                               beta,
-                               m,
-                               n,
-                               ldA,
-                               ldB,
-                               ldC,
-                               batchSize,
-                               batchStride,
-                               rowMajA,
-                               rowMajB,
-                               rowMajC,
-                               transA,
-                               transB);
+            std::cerr << "Unable to launch hipblasLtMatrixTransform\n";
         }
-        else if(datatype == HIP_R_32I)
+        else
         {
-            validation<int32_t>(dC,
-                                dA,
-                                dB,
-                                alpha,
-                                beta,
-                                m,
-                                n,
-                                ldA,
-                                ldB,
-                                ldC,
-                                batchSize,
-                                batchStride,
-                                rowMajA,
-                                rowMajB,
-                                rowMajC,
-                                transA,
-                                transB);
+            const double throughput = 3. * cfg.m * cfg.n * cfg.batchSize * elemNumBytes
+                                      / std::pow(1024, 4) / avgDur * 1e3;
+            std::cout << "hipblasLtMatrixTransform elapsed time: " << std::to_string(avgDur)
+                      << " ms\n";
+            std::cout << "Throughput: " << throughput << " TB/s\n";
+
+            if(csvFile.is_open())
+            {
+                writeCsvHeader(csvFile);
+                writeCsvRow(csvFile, cfg, avgDur, elemNumBytes, peakBandwidth);
+            }
         }
     }
 
-releaseResource:
-    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
     hipblasLtErr = hipblasLtDestroy(handle);
-    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
-    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutB);
-    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
-    return EXIT_SUCCESS;
+    return status;
 }
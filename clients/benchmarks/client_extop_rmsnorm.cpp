@@ -0,0 +1,322 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <hip/hip_runtime.h>
+
+#include <hip/hip_runtime_api.h>
+#include <hipblaslt/hipblaslt-ext-op.h>
+#include <hipblaslt/hipblaslt.h>
+#include <hipblaslt_datatype2string.hpp>
+#include <hipblaslt_init.hpp>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t-m, --m\t\t\t\tSize of dim 0, default is 4096\n"
+              << "\t-n, --n\t\t\t\tSize of dim 1, default is 8192\n"
+              << "\t-a, --affine\t\t\tEnable Gamma, default is false\n"
+              << "\t-r, --residual\t\t\tAdd a residual and write the sum back to it, default is "
+                 "false\n"
+              << "\t--fp8\t\t\t\tWrite a scaled HIP_R_8F_E4M3_FNUZ output, default is false\n"
+              << "\t--initialization \t\tInitialize matrix data. Options: rand_int, trig_float, "
+                 "hpl(floating), special, zero. (default is hpl)\n";
+}
+
+void cpuRMSNorm(float*        out,
+                float*        residualOut,
+                const float*  in,
+                const float*  residual,
+                const float*  gamma,
+                std::uint32_t batch,
+                std::uint32_t length,
+                float         eps = 1e-05)
+{
+    for(std::uint32_t i = 0; i < batch; i++)
+    {
+        float squares = 0.f;
+        for(std::uint32_t j = 0; j < length; j++)
+        {
+            float v = in[i * length + j] + (residual ? residual[i * length + j] : 0.f);
+            if(residualOut)
+                residualOut[i * length + j] = v;
+            squares += v * v;
+        }
+
+        const float rrms = 1 / std::sqrt(squares / length + eps);
+        for(std::uint32_t j = 0; j < length; j++)
+        {
+            float v = in[i * length + j] + (residual ? residual[i * length + j] : 0.f);
+            out[i * length + j] = v * rrms * (gamma ? gamma[j] : 1.f);
+        }
+    }
+}
+
+int parseArgs(int                       argc,
+              char**                    argv,
+              size_t*                   m,
+              size_t*                   n,
+              bool*                     affine,
+              bool*                     residual,
+              bool*                     fp8,
+              hipblaslt_initialization* init)
+{
+    if(argc <= 1)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if(arg.at(0) == '-')
+        {
+            if((arg == "-h") || (arg == "--help"))
+            {
+                return EXIT_FAILURE;
+            }
+
+            if(arg == "-m" || arg == "--m")
+            {
+                *m = std::stoul(argv[++i]);
+            }
+            else if(arg == "-n" || arg == "--n")
+            {
+                *n = std::stoul(argv[++i]);
+            }
+            else if(arg == "-a" || arg == "--affine")
+            {
+                *affine = std::stoul(argv[++i]);
+            }
+            else if(arg == "-r" || arg == "--residual")
+            {
+                *residual = std::stoul(argv[++i]);
+            }
+            else if(arg == "--fp8")
+            {
+                *fp8 = std::stoul(argv[++i]);
+            }
+            else if(arg == "--initialization" || arg == "--init")
+            {
+                const std::string initStr{argv[++i]};
+
+                if(initStr != "rand_int" && initStr != "trig_float" && initStr != "hpl"
+                   && initStr != "special" && initStr != "zero")
+                {
+                    std::cerr << "Invalid initialization type: " << initStr << '\n';
+                    return EXIT_FAILURE;
+                }
+
+                *init = string2hipblaslt_initialization(initStr);
+            }
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            std::cerr << "option must start with - or --" << std::endl << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+template <typename DType>
+void initData(DType* data, std::size_t numElements, hipblaslt_initialization initMethod)
+{
+    switch(initMethod)
+    {
+    case hipblaslt_initialization::rand_int:
+        hipblaslt_init<DType>(data, numElements, 1, 1);
+        break;
+    case hipblaslt_initialization::trig_float:
+        hipblaslt_init_cos<DType>(data, numElements, 1, 1);
+        break;
+    case hipblaslt_initialization::hpl:
+        hipblaslt_init_hpl<DType>(data, numElements, 1, 1);
+        break;
+    case hipblaslt_initialization::special:
+        hipblaslt_init_alt_impl_big<DType>(data, numElements, 1, 1);
+        break;
+    case hipblaslt_initialization::zero:
+        hipblaslt_init_zero<DType>(data, numElements, 1, 1);
+        break;
+    default:
+        break;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t              m{4096};
+    std::size_t              n{8192};
+    bool                     affine{false};
+    bool                     residual{false};
+    bool                     fp8{false};
+    hipblaslt_initialization init{hipblaslt_initialization::hpl};
+
+    if(auto err = parseArgs(argc, argv, &m, &n, &affine, &residual, &fp8, &init))
+    {
+        printUsage(argv[0]);
+        return err;
+    }
+
+    std::size_t numElements     = m * n;
+    std::size_t elementNumBytes = sizeof(float);
+    std::size_t outNumBytes     = fp8 ? 1 : sizeof(float);
+    hipDataType outDatatype     = fp8 ? HIP_R_8F_E4M3_FNUZ : HIP_R_32F;
+
+    float* gpuOutput{nullptr};
+    float* gpuInput{nullptr};
+    float* gpuResidual{nullptr};
+    float* gpuGamma{nullptr};
+    float* gpuScale{nullptr};
+
+    auto hipErr = hipMalloc(&gpuOutput, numElements * outNumBytes);
+    hipErr      = hipMalloc(&gpuInput, numElements * elementNumBytes);
+    if(residual)
+        hipErr = hipMalloc(&gpuResidual, numElements * elementNumBytes);
+    if(affine)
+        hipErr = hipMalloc(&gpuGamma, n * elementNumBytes);
+    hipErr = hipMalloc(&gpuScale, sizeof(float));
+
+    std::vector<float> cpuOutput(numElements, 0.f);
+    std::vector<float> cpuInput(numElements, 0.f);
+    std::vector<float> cpuResidual(numElements, 0.f);
+    std::vector<float> cpuResidualOut(numElements, 0.f);
+    std::vector<float> cpuGamma(n, 1.f);
+    std::vector<float> refOutput(numElements, 0.f);
+    std::vector<float> refResidualOut(numElements, 0.f);
+    float              scale = 1.f;
+
+    initData(cpuInput.data(), cpuInput.size(), init);
+    if(residual)
+        initData(cpuResidual.data(), cpuResidual.size(), init);
+    if(affine)
+        initData(cpuGamma.data(), cpuGamma.size(), init);
+
+    hipErr = hipMemcpyHtoD(gpuInput, cpuInput.data(), numElements * elementNumBytes);
+    if(residual)
+        hipErr = hipMemcpyHtoD(gpuResidual, cpuResidual.data(), numElements * elementNumBytes);
+    if(affine)
+        hipErr = hipMemcpyHtoD(gpuGamma, cpuGamma.data(), n * elementNumBytes);
+    hipErr = hipMemcpyHtoD(gpuScale, &scale, sizeof(float));
+
+    hipStream_t stream{};
+    hipErr = hipStreamCreate(&stream);
+
+    // Check one call against the reference, the sum is written to a separate buffer
+    // so that the timed calls below do not keep accumulating into the residual
+    float* gpuResidualOut{nullptr};
+    if(residual)
+        hipErr = hipMalloc(&gpuResidualOut, numElements * elementNumBytes);
+
+    auto hipblasltErr = hipblasltExtRMSNorm(HIP_R_32F,
+                                            outDatatype,
+                                            gpuOutput,
+                                            gpuResidualOut,
+                                            gpuInput,
+                                            gpuResidual,
+                                            gpuGamma,
+                                            gpuScale,
+                                            m,
+                                            n,
+                                            1e-05,
+                                            stream);
+
+    if(hipblasltErr)
+    {
+        std::cerr << "hipblasltExtRMSNorm failed with " << hipblasltErr << '\n';
+        return EXIT_FAILURE;
+    }
+
+    cpuRMSNorm(refOutput.data(),
+               residual ? refResidualOut.data() : nullptr,
+               cpuInput.data(),
+               residual ? cpuResidual.data() : nullptr,
+               affine ? cpuGamma.data() : nullptr,
+               m,
+               n,
+               1e-05);
+
+    if(!fp8)
+    {
+        hipErr = hipMemcpyDtoH(cpuOutput.data(), gpuOutput, numElements * elementNumBytes);
+
+        float maxErr = 0.f;
+        for(std::size_t i = 0; i < numElements; i++)
+            maxErr = std::max(maxErr, std::abs(cpuOutput[i] - refOutput[i]));
+        std::cout << "max error : " << maxErr << std::endl;
+    }
+
+    hipEvent_t beg, end;
+    hipErr      = hipEventCreate(&beg);
+    hipErr      = hipEventCreate(&end);
+    int numRuns = 200;
+    hipErr      = hipEventRecord(beg, stream);
+
+    for(int i = 0; i < numRuns; ++i)
+    {
+        hipblasltErr = hipblasltExtRMSNorm(HIP_R_32F,
+                                           outDatatype,
+                                           gpuOutput,
+                                           gpuResidualOut,
+                                           gpuInput,
+                                           gpuResidual,
+                                           gpuGamma,
+                                           gpuScale,
+                                           m,
+                                           n,
+                                           1e-05,
+                                           stream);
+    }
+    hipErr = hipEventRecord(end, stream);
+    hipErr = hipEventSynchronize(end);
+    hipErr = hipStreamSynchronize(stream);
+    float dur{};
+    hipErr = hipEventElapsedTime(&dur, beg, end);
+
+    // input, plus residual read and sum written, plus output
+    const double bytes
+        = numElements * (elementNumBytes * (residual ? 3 : 1) + outNumBytes) + (affine ? n * 4 : 0);
+    std::cout << "Time elapsed: " << std::to_string(dur / numRuns) << " ms\n";
+    std::cout << "Bandwidth: " << std::to_string(bytes / (1e6 * dur / numRuns)) << " GB/s\n";
+
+    hipErr = hipEventDestroy(beg);
+    hipErr = hipEventDestroy(end);
+    hipErr = hipStreamDestroy(stream);
+    hipErr = hipFree(gpuOutput);
+    hipErr = hipFree(gpuInput);
+    hipErr = hipFree(gpuResidual);
+    hipErr = hipFree(gpuResidualOut);
+    hipErr = hipFree(gpuGamma);
+    hipErr = hipFree(gpuScale);
+    return 0;
+}
@@ -28,6 +28,7 @@
 #include <hipblaslt/hipblaslt-ext-op.h>
 #include <hipblaslt/hipblaslt.h>
 #include <hipblaslt_datatype2string.hpp>
+#include <hipblaslt_extop_tuning.hpp>
 #include <hipblaslt_init.hpp>
 #include <iostream>
 #include <numeric>
@@ -40,11 +41,21 @@ void printUsage(char* programName)
               << "\t-h, --help\t\t\tShow this help message\n"
               << "\t-m, --m\t\t\t\tSize of dim 0, default is 1335\n"
               << "\t-n, --n\t\t\t\tSize of dim 1, default is 16\n"
+              << "\t--datatype\t\t\tDatatype of input/output. Options: f32_r, f16_r, bf16_r. "
+                 "(default is f32_r)\n"
               << "\t--initialization \t\tInitialize matrix data. Options: rand_int, trig_float, "
-                 "hpl(floating), special, zero. (default is hpl)\n";
+                 "hpl(floating), special, zero. (default is hpl)\n"
+              << "\t--tune <file>\t\t\tTime every kernel on n buckets up to n and append the "
+                 "fastest to the ext op tuning file\n";
 }
 
-int parseArgs(int argc, char** argv, size_t* m, size_t* n, hipblaslt_initialization* init)
+int parseArgs(int                       argc,
+              char**                    argv,
+              size_t*                   m,
+              size_t*                   n,
+              hipDataType*              datatype,
+              hipblaslt_initialization* init,
+              std::string*              tuneFile)
 {
     if(argc <= 1)
     {
@@ -70,6 +81,22 @@ int parseArgs(int argc, char** argv, size_t* m, size_t* n, hipblaslt_initializat
             {
                 *n = std::stoul(argv[++i]);
             }
+            else if(arg == "--datatype")
+            {
+                const std::string typeStr{argv[++i]};
+
+                if(typeStr == "f32_r")
+                    *datatype = HIP_R_32F;
+                else if(typeStr == "f16_r")
+                    *datatype = HIP_R_16F;
+                else if(typeStr == "bf16_r")
+                    *datatype = HIP_R_16BF;
+                else
+                {
+                    std::cerr << "Invalid datatype: " << typeStr << '\n';
+                    return EXIT_FAILURE;
+                }
+            }
             else if(arg == "--initialization" || arg == "--init")
             {
                 const std::string initStr{argv[++i]};
@@ -82,6 +109,10 @@ int parseArgs(int argc, char** argv, size_t* m, size_t* n, hipblaslt_initializat
 
                 *init = string2hipblaslt_initialization(initStr);
             }
+            else if(arg == "--tune")
+            {
+                *tuneFile = argv[++i];
+            }
         }
         else
         {
@@ -119,36 +150,29 @@ void initData(DType* data, std::size_t numElements, hipblaslt_initialization ini
     }
 }
 
-int main(int argc, char** argv)
+template <typename DType>
+int runSoftmax(hipDataType datatype, std::size_t m, std::size_t n, hipblaslt_initialization init)
 {
-    std::size_t              m{1335};
-    std::size_t              n{16};
-    hipblaslt_initialization init{hipblaslt_initialization::hpl};
-
-    if(auto err = parseArgs(argc, argv, &m, &n, &init))
-    {
-        printUsage(argv[0]);
-        return err;
-    }
-
-    std::size_t numElements     = m * n;
-    std::size_t elementNumBytes = sizeof(float);
-    float*      input{};
-    float*      output{};
-    auto        hipErr = hipMalloc(&input, numElements * elementNumBytes);
-    hipErr             = hipMalloc(&output, numElements * elementNumBytes);
-    std::vector<float> data(numElements, 0.f);
-    // std::iota(begin(data), end(data), 0.f);
-    initData(input, numElements, init);
+    std::size_t        numElements     = m * n;
+    std::size_t        elementNumBytes = sizeof(DType);
+    DType*             input{};
+    DType*             output{};
+    auto               hipErr = hipMalloc(&input, numElements * elementNumBytes);
+    hipErr                    = hipMalloc(&output, numElements * elementNumBytes);
+    std::vector<DType> data(numElements);
+    initData(data.data(), numElements, init);
     hipErr = hipMemcpyHtoD(input, data.data(), numElements * elementNumBytes);
     hipStream_t stream{};
     hipErr = hipStreamCreate(&stream);
     //warmup
-    auto hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, m, n, 1, output, input, stream);
+    auto hipblasltErr = hipblasltExtSoftmax(datatype, m, n, 1, output, input, stream);
 
     if(hipblasltErr)
     {
-        std::cerr << "Invalid shape (" << m << ", " << n << "), currently support n <= 256\n";
+        if(hipblasltErr == HIPBLAS_STATUS_NOT_SUPPORTED)
+            std::cerr << "No softmax kernel for this datatype on this device\n";
+        else
+            std::cerr << "Invalid shape (" << m << ", " << n << ")\n";
         hipFree(input);
         hipFree(output);
         hipStreamDestroy(stream);
@@ -163,7 +187,7 @@ int main(int argc, char** argv)
 
     for(int i = 0; i < numRuns; ++i)
     {
-        hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, m, n, 1, output, input, stream);
+        hipblasltErr = hipblasltExtSoftmax(datatype, m, n, 1, output, input, stream);
     }
 
     hipErr = hipEventRecord(end, stream);
@@ -171,13 +195,95 @@ int main(int argc, char** argv)
     hipErr = hipStreamSynchronize(stream);
     float dur{};
     hipErr = hipEventElapsedTime(&dur, beg, end);
+    // Softmax is bandwidth bound: every element is read once and written once
+    const double us = 1000.0 * dur / numRuns;
     std::cout << "Time elapsed: " << std::to_string(dur / numRuns) << " ms\n";
-    std::vector<float> gpuOutput(numElements, 0.f);
+    std::cout << "Bandwidth: " << std::to_string(2.0 * numElements * elementNumBytes / us / 1e3)
+              << " GB/s\n";
+    std::vector<DType> gpuOutput(numElements);
     hipErr = hipEventDestroy(beg);
     hipErr = hipEventDestroy(end);
     hipErr = hipMemcpyDtoH(gpuOutput.data(), output, numElements * elementNumBytes);
     hipErr = hipStreamDestroy(stream);
     hipErr = hipFree(input);
     hipErr = hipFree(output);
-    return 0;
+    return EXIT_SUCCESS;
+}
+
+template <typename DType>
+int tuneSoftmax(hipDataType datatype, std::size_t m, std::size_t n, const std::string& tuneFile)
+{
+    // Longer rows run the online softmax, which has no library kernels to choose from
+    const uint32_t     maxN        = std::min<std::size_t>(n, 256);
+    const std::size_t  numElements = m * maxN;
+    DType*             input{};
+    DType*             output{};
+    auto               hipErr = hipMalloc(&input, numElements * sizeof(DType));
+    hipErr                    = hipMalloc(&output, numElements * sizeof(DType));
+    std::vector<DType> data(numElements);
+    initData(data.data(), numElements, hipblaslt_initialization::hpl);
+    hipErr = hipMemcpyHtoD(input, data.data(), numElements * sizeof(DType));
+    hipStream_t stream{};
+    hipErr = hipStreamCreate(&stream);
+
+    auto timeRun = [&](uint32_t cols) {
+        hipEvent_t beg, end;
+        hipErr      = hipEventCreate(&beg);
+        hipErr      = hipEventCreate(&end);
+        int numRuns = 50;
+        //warmup
+        auto hipblasltErr = hipblasltExtSoftmax(datatype, m, cols, 1, output, input, stream);
+        hipErr            = hipEventRecord(beg, stream);
+
+        for(int i = 0; i < numRuns; ++i)
+        {
+            hipblasltErr = hipblasltExtSoftmax(datatype, m, cols, 1, output, input, stream);
+        }
+
+        hipErr = hipEventRecord(end, stream);
+        hipErr = hipEventSynchronize(end);
+        float dur{};
+        hipErr = hipEventElapsedTime(&dur, beg, end);
+        hipErr = hipEventDestroy(beg);
+        hipErr = hipEventDestroy(end);
+        return dur / numRuns;
+    };
+
+    const char* typeName = datatype == HIP_R_16F ? "H" : datatype == HIP_R_16BF ? "B" : "S";
+    auto        err      = tuneExtOp(tuneFile, "Softmax", datatype, typeName, maxN, timeRun);
+
+    hipErr = hipStreamDestroy(stream);
+    hipErr = hipFree(input);
+    hipErr = hipFree(output);
+    return err;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t              m{1335};
+    std::size_t              n{16};
+    hipDataType              datatype{HIP_R_32F};
+    hipblaslt_initialization init{hipblaslt_initialization::hpl};
+    std::string              tuneFile;
+
+    if(auto err = parseArgs(argc, argv, &m, &n, &datatype, &init, &tuneFile))
+    {
+        printUsage(argv[0]);
+        return err;
+    }
+
+    if(!tuneFile.empty())
+    {
+        if(datatype == HIP_R_16F)
+            return tuneSoftmax<hipblasLtHalf>(datatype, m, n, tuneFile);
+        else if(datatype == HIP_R_16BF)
+            return tuneSoftmax<hip_bfloat16>(datatype, m, n, tuneFile);
+        return tuneSoftmax<float>(datatype, m, n, tuneFile);
+    }
+
+    if(datatype == HIP_R_16F)
+        return runSoftmax<hipblasLtHalf>(datatype, m, n, init);
+    else if(datatype == HIP_R_16BF)
+        return runSoftmax<hip_bfloat16>(datatype, m, n, init);
+    return runSoftmax<float>(datatype, m, n, init);
 }
@@ -0,0 +1,185 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Measures the selection latency of GridBased logic tables against their size.
+// The grid points are indexed by the KD-tree that the GridBased matching table
+// builds when it is deserialized; every query is also answered with a linear
+// scan of all points to compare the latency and check the results.
+
+#include <Tensile/PropertyMatching.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using Point  = TensileLite::Matching::PointND<int32_t, 2>;
+using KDTree = TensileLite::Matching::KDTree<int32_t, 2>;
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t--max_points\t\t\tLargest grid size of the sweep, default is 65536\n"
+              << "\t--queries\t\t\tNumber of queries per table size, default is 10000\n";
+}
+
+int parseArgs(int argc, char** argv, size_t& maxPoints, size_t& queries)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if((arg == "-h") || (arg == "--help"))
+        {
+            return EXIT_FAILURE;
+        }
+        else if(i + 1 >= argc)
+        {
+            std::cerr << "missing value for " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        else if(arg == "--max_points")
+        {
+            maxPoints = std::stoul(argv[++i]);
+        }
+        else if(arg == "--queries")
+        {
+            queries = std::stoul(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (maxPoints >= 4 && queries) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// The insert criteria of the GridBased matching table: prefer grid points that
+// cover the problem in the dimensions the grid extends over
+bool covers(const Point& pt, const Point& best, const std::array<int32_t, 2>& maximums)
+{
+    bool inM = pt.coord[0] <= maximums[0];
+    bool inN = pt.coord[1] <= maximums[1];
+    if(inM && inN)
+        return best.coord[0] >= pt.coord[0] && best.coord[1] >= pt.coord[1];
+    if(inN)
+        return best.coord[1] >= pt.coord[1];
+    if(inM)
+        return best.coord[0] >= pt.coord[0];
+    return true;
+}
+
+float squaredDistance(const Point& p, const Point& q)
+{
+    float dm = static_cast<float>(p.coord[0] - q.coord[0]);
+    float dn = static_cast<float>(p.coord[1] - q.coord[1]);
+    return dm * dm + dn * dn;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxPoints = 65536;
+    size_t queries   = 10000;
+
+    if(parseArgs(argc, argv, maxPoints, queries))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::mt19937                           gen(42);
+    std::uniform_int_distribution<int32_t> sizes(1, 16384);
+
+    std::cout << std::setw(10) << "points" << std::setw(14) << "kdtree(us)" << std::setw(14)
+              << "linear(us)" << std::setw(12) << "mismatch" << std::endl;
+
+    for(size_t side = 2; side * side <= maxPoints; side *= 2)
+    {
+        // A side x side grid with uneven spacing, like tuned logic files
+        std::vector<Point> points;
+        for(size_t i = 0; i < side; i++)
+            for(size_t j = 0; j < side; j++)
+                points.push_back({int32_t(16384 * (i + 1) * (i + 1) / (side * side)),
+                                  int32_t(16384 * (j + 1) / side)});
+
+        KDTree tree;
+        tree.build(tree.root, points.begin(), points.end(), 0);
+
+        std::vector<Point> targets(queries);
+        for(auto& t : targets)
+            t = {sizes(gen), sizes(gen)};
+
+        auto criteria = [&tree](auto pt, auto best) { return covers(pt, best, tree.maximums); };
+
+        std::vector<Point> kdResults(queries);
+        auto               begin = std::chrono::steady_clock::now();
+        for(size_t q = 0; q < queries; q++)
+        {
+            auto results = tree.query(targets[q], 1, criteria);
+            if(!results.empty())
+                kdResults[q] = results[0].node->pt;
+        }
+        auto kdTime = std::chrono::steady_clock::now() - begin;
+
+        size_t mismatch = 0;
+        begin           = std::chrono::steady_clock::now();
+        for(size_t q = 0; q < queries; q++)
+        {
+            float bestDistance = std::numeric_limits<float>::max();
+            Point best{};
+            for(auto const& p : points)
+            {
+                float d = squaredDistance(targets[q], p);
+                if(criteria(targets[q], p) && d < bestDistance)
+                {
+                    bestDistance = d;
+                    best         = p;
+                }
+            }
+            // Equidistant points may be picked in another order
+            if(squaredDistance(targets[q], best) != squaredDistance(targets[q], kdResults[q]))
+                mismatch++;
+        }
+        auto linearTime = std::chrono::steady_clock::now() - begin;
+
+        auto perQuery = [queries](auto t) {
+            return std::chrono::duration<double, std::micro>(t).count() / queries;
+        };
+        std::cout << std::setw(10) << points.size() << std::setw(14) << std::fixed
+                  << std::setprecision(3) << perQuery(kdTime) << std::setw(14)
+                  << perQuery(linearTime) << std::setw(12) << mismatch << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
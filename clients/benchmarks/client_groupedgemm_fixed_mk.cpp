@@ -245,6 +245,7 @@ static void show_usage(char* argv[])
         << "\t--act \t\t\tact \t\tGEMM_STRIDED set activation type: relu, gelu, none (default is "
            "none)\n"
         << "\t--bias \t\t\tbias \t\tGEMM_STRIDED set bias: 0 or 1 (default is 0)\n"
+        << "\t--shared_a \t\t\t\tAll groups read the A of the first group\n"
         << std::endl;
 }
 
@@ -274,7 +275,8 @@ static int parse_arguments(int                          argc,
                            int32_t&                     sync_count,
                            hipblaslt_initialization&    initialization,
                            bool&                        verbose,
-                           bool&                        validate)
+                           bool&                        validate,
+                           bool&                        shared_a)
 {
     if(argc >= 2)
     {
@@ -296,6 +298,10 @@ static int parse_arguments(int                          argc,
                 {
                     validate = true;
                 }
+                else if(arg == "--shared_a")
+                {
+                    shared_a = true;
+                }
                 else if(arg == "--initialization")
                 {
                     std::string initializationStr = argv[++i];
@@ -649,7 +655,8 @@ int test_hipblaslt(hipDataType                 in_datatype,
                    int32_t                     sync_count,
                    hipblaslt_initialization    initialization,
                    bool                        validate,
-                   bool                        verbose)
+                   bool                        verbose,
+                   bool                        shared_a)
 {
     int                  status = EXIT_SUCCESS;
     std::vector<int64_t> a_stride_1(gemm_count), a_stride_2(gemm_count), b_stride_1(gemm_count),
@@ -749,6 +756,9 @@ int test_hipblaslt(hipDataType                 in_datatype,
                               h_bias[i],
                               size_bias[i],
                               initialization);
+        // With a shared A every group computes with the data of the first one
+        if(shared_a && i > 0)
+            ha[i] = ha[0];
 
         CHECK_HIP_ERROR(hipMalloc(&da[i], size_a[i] * sizeof(Tin)));
         CHECK_HIP_ERROR(hipMalloc(&db[i], size_b[i] * sizeof(Tin)));
@@ -837,7 +847,9 @@ int test_hipblaslt(hipDataType                 in_datatype,
             epilogue[i] = HIPBLASLT_EPILOGUE_GELU;
         gemmEpilogue[i].setMode(epilogue[i]);
         gemmEpilogue[i].setBiasDataType(static_cast<hipDataType>(HIP_R_32F));
-        gemmInputs[i].setA(da[i]);
+        // A shared operand is declared once, by the first group
+        if(!shared_a || i == 0)
+            gemmInputs[i].setA(da[i]);
         gemmInputs[i].setB(db[i]);
         gemmInputs[i].setC(dc[i]);
         gemmInputs[i].setD(dd[i]);
@@ -854,6 +866,9 @@ int test_hipblaslt(hipDataType                 in_datatype,
                                                             out_datatype,
                                                             HIPBLAS_COMPUTE_32F);
 
+    if(shared_a)
+        CHECK_HIPBLASLT_ERROR(groupedGemm.setSharedOperand(hipblaslt_ext::SharedOperand::A));
+
     // step 1: set problem to {Ms, {sum of N, 1, 1, 1, ...}, Ks}
     CHECK_HIPBLASLT_ERROR(groupedGemm.setProblem(m,
                                                  sum_of_n_vec,
@@ -1075,6 +1090,7 @@ int main(int argc, char* argv[])
 
     bool    verbose     = false;
     bool    validate    = false;
+    bool    shared_a    = false;
     int32_t bench_count = 1;
     int32_t sync_count  = 1;
 
@@ -1106,7 +1122,8 @@ int main(int argc, char* argv[])
                        sync_count,
                        initialization,
                        verbose,
-                       validate))
+                       validate,
+                       shared_a))
     {
         show_usage(argv);
         return EXIT_FAILURE;
@@ -1208,7 +1225,8 @@ int main(int argc, char* argv[])
                                                                 sync_count,
                                                                 initialization,
                                                                 validate,
-                                                                verbose);
+                                                                verbose,
+                                                                shared_a);
     else if(in_datatype == HIP_R_16F && out_datatype == HIP_R_32F)
         status = test_hipblaslt<hipblasLtHalf, hipblasLtFloat>(in_datatype,
                                                                out_datatype,
@@ -1235,7 +1253,8 @@ int main(int argc, char* argv[])
                                                                sync_count,
                                                                initialization,
                                                                validate,
-                                                               verbose);
+                                                               verbose,
+                                                               shared_a);
     else if(in_datatype == HIP_R_16F && out_datatype == HIP_R_16F)
         status = test_hipblaslt<hipblasLtHalf, hipblasLtHalf>(in_datatype,
                                                               out_datatype,
@@ -1262,7 +1281,8 @@ int main(int argc, char* argv[])
                                                               sync_count,
                                                               initialization,
                                                               validate,
-                                                              verbose);
+                                                              verbose,
+                                                              shared_a);
     else if(in_datatype == HIP_R_16BF && out_datatype == HIP_R_16BF)
         status = test_hipblaslt<hipblasLtBfloat16, hipblasLtBfloat16>(in_datatype,
                                                                       out_datatype,
@@ -1289,7 +1309,8 @@ int main(int argc, char* argv[])
                                                                       sync_count,
                                                                       initialization,
                                                                       validate,
-                                                                      verbose);
+                                                                      verbose,
+                                                                      shared_a);
 
     return status;
 }
@@ -0,0 +1,258 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Measures how hipblasLtMatmulAlgoGetHeuristic throughput scales with the number
+// of host threads. Every thread owns a handle and repeatedly queries the same set
+// of problems, so after the first round all lookups are hits in the solution
+// cache of the Tensile library. Run with TENSILE_CACHE_MAP_MODE=0 and =1 to
+// compare the locked and snapshot cache read paths.
+
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK_HIPBLASLT_ERROR(expr)                                                                \
+    do                                                                                             \
+    {                                                                                              \
+        hipblasStatus_t status__ = (expr);                                                         \
+        if(status__ != HIPBLAS_STATUS_SUCCESS)                                                     \
+        {                                                                                          \
+            std::cerr << "hipBLASLt error " << status__ << " at " << __FILE__ << ":"               \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t--max_threads\t\t\tLargest thread count of the sweep, default is 16\n"
+              << "\t--problems\t\t\tNumber of distinct problem sizes, default is 64\n"
+              << "\t--duration_ms\t\t\tMeasurement time per thread count, default is 1000\n"
+              << "\t--requested_solutions\t\tSolutions requested per query, default is 1\n";
+}
+
+int parseArgs(int     argc,
+              char**  argv,
+              size_t& maxThreads,
+              size_t& problems,
+              size_t& durationMs,
+              int&    requestedSolutions)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if((arg == "-h") || (arg == "--help"))
+        {
+            return EXIT_FAILURE;
+        }
+        else if(i + 1 >= argc)
+        {
+            std::cerr << "missing value for " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        else if(arg == "--max_threads")
+        {
+            maxThreads = std::stoul(argv[++i]);
+        }
+        else if(arg == "--problems")
+        {
+            problems = std::stoul(argv[++i]);
+        }
+        else if(arg == "--duration_ms")
+        {
+            durationMs = std::stoul(argv[++i]);
+        }
+        else if(arg == "--requested_solutions")
+        {
+            requestedSolutions = std::stoi(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (maxThreads && problems && requestedSolutions > 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+struct HeuristicQuery
+{
+    hipblasLtMatmulDesc_t       matmul = nullptr;
+    hipblasLtMatrixLayout_t     matA   = nullptr;
+    hipblasLtMatrixLayout_t     matB   = nullptr;
+    hipblasLtMatrixLayout_t     matC   = nullptr;
+    hipblasLtMatmulPreference_t pref   = nullptr;
+};
+
+HeuristicQuery createQuery(int64_t m, int64_t n, int64_t k)
+{
+    HeuristicQuery q;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&q.matA, HIP_R_16F, m, k, m));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&q.matB, HIP_R_16F, k, n, k));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&q.matC, HIP_R_16F, m, n, m));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&q.matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceCreate(&q.pref));
+
+    uint64_t workspaceSize = 32 * 1024 * 1024;
+    CHECK_HIPBLASLT_ERROR(
+        hipblasLtMatmulPreferenceSetAttribute(q.pref,
+                                              HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                              &workspaceSize,
+                                              sizeof(workspaceSize)));
+    return q;
+}
+
+void destroyQuery(HeuristicQuery& q)
+{
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceDestroy(q.pref));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(q.matmul));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(q.matA));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(q.matB));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(q.matC));
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxThreads         = 16;
+    size_t problems           = 64;
+    size_t durationMs         = 1000;
+    int    requestedSolutions = 1;
+
+    if(parseArgs(argc, argv, maxThreads, problems, durationMs, requestedSolutions))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<HeuristicQuery> queries;
+    for(size_t i = 0; i < problems; i++)
+    {
+        int64_t size = 128 * (i + 1);
+        queries.push_back(createQuery(size, size / 2 + 64, size + 256));
+    }
+
+    const char* mode = std::getenv("TENSILE_CACHE_MAP_MODE");
+    std::cout << "TENSILE_CACHE_MAP_MODE=" << (mode ? mode : "0") << ", " << problems
+              << " problems, " << durationMs << " ms per step" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "lookups/s" << std::setw(20)
+              << "lookups/s/thread" << std::endl;
+
+    for(size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        std::atomic<bool>        start{false};
+        std::atomic<bool>        stop{false};
+        std::atomic<size_t>      ready{0};
+        std::vector<uint64_t>    lookups(threads, 0);
+        std::vector<std::thread> workers;
+
+        for(size_t t = 0; t < threads; t++)
+        {
+            workers.emplace_back([&, t]() {
+                hipblasLtHandle_t handle;
+                CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+                std::vector<hipblasLtMatmulHeuristicResult_t> results(requestedSolutions);
+                int                                           returned = 0;
+
+                // Warm up so that every problem is resident in the cache
+                for(auto& q : queries)
+                    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(handle,
+                                                                          q.matmul,
+                                                                          q.matA,
+                                                                          q.matB,
+                                                                          q.matC,
+                                                                          q.matC,
+                                                                          q.pref,
+                                                                          requestedSolutions,
+                                                                          results.data(),
+                                                                          &returned));
+
+                ready++;
+                while(!start.load())
+                    std::this_thread::yield();
+
+                uint64_t count = 0;
+                for(size_t i = t; !stop.load(std::memory_order_relaxed); i++, count++)
+                {
+                    auto& q = queries[i % queries.size()];
+                    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(handle,
+                                                                          q.matmul,
+                                                                          q.matA,
+                                                                          q.matB,
+                                                                          q.matC,
+                                                                          q.matC,
+                                                                          q.pref,
+                                                                          requestedSolutions,
+                                                                          results.data(),
+                                                                          &returned));
+                }
+                lookups[t] = count;
+
+                CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+            });
+        }
+
+        while(ready.load() < threads)
+            std::this_thread::yield();
+
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+        stop.store(true);
+        auto end = std::chrono::steady_clock::now();
+
+        for(auto& w : workers)
+            w.join();
+
+        uint64_t total = 0;
+        for(auto count : lookups)
+            total += count;
+
+        double seconds = std::chrono::duration<double>(end - begin).count();
+        double rate    = total / seconds;
+        std::cout << std::setw(8) << threads << std::setw(16) << std::fixed
+                  << std::setprecision(0) << rate << std::setw(20) << rate / threads
+                  << std::endl;
+    }
+
+    for(auto& q : queries)
+        destroyQuery(q);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,503 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+
+// Measures the host nanoseconds per call of the hot hipBLASLt entry points on a
+// tiny problem, and how they scale with the number of host threads. Every thread
+// owns a handle, a stream and the objects of each path, so the threads only meet
+// in the library. Launching paths are timed in rounds and the stream is drained
+// between rounds, only the enqueue is counted.
+
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt-ext.hpp>
+#include <hipblaslt/hipblaslt.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK_HIP_ERROR(expr)                                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        hipError_t error__ = (expr);                                                               \
+        if(error__ != hipSuccess)                                                                  \
+        {                                                                                          \
+            std::cerr << "hip error " << hipGetErrorString(error__) << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+#define CHECK_HIPBLASLT_ERROR(expr)                                                                \
+    do                                                                                             \
+    {                                                                                              \
+        hipblasStatus_t status__ = (expr);                                                         \
+        if(status__ != HIPBLAS_STATUS_SUCCESS)                                                     \
+        {                                                                                          \
+            std::cerr << "hipBLASLt error " << status__ << " at " << __FILE__ << ":"               \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t--size\t\t\t\tm, n and k of the fp16 gemm, default is 64\n"
+              << "\t--groups\t\t\tGroups of the grouped gemm, default is 16\n"
+              << "\t--max_threads\t\t\tLargest thread count of the sweep, default is 8\n"
+              << "\t--duration_ms\t\t\tMeasurement time per path and thread count, default is "
+                 "500\n"
+              << "\t--round\t\t\t\tCalls between two stream drains, default is 100\n"
+              << "\t--path\t\t\t\tOnly measure the paths whose name contains this\n";
+}
+
+int parseArgs(int          argc,
+              char**       argv,
+              int64_t&     size,
+              size_t&      groups,
+              size_t&      maxThreads,
+              size_t&      durationMs,
+              uint32_t&    round,
+              std::string& path)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if((arg == "-h") || (arg == "--help"))
+        {
+            return EXIT_FAILURE;
+        }
+        else if(i + 1 >= argc)
+        {
+            std::cerr << "missing value for " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        else if(arg == "--size")
+        {
+            size = std::stol(argv[++i]);
+        }
+        else if(arg == "--groups")
+        {
+            groups = std::stoul(argv[++i]);
+        }
+        else if(arg == "--max_threads")
+        {
+            maxThreads = std::stoul(argv[++i]);
+        }
+        else if(arg == "--duration_ms")
+        {
+            durationMs = std::stoul(argv[++i]);
+        }
+        else if(arg == "--round")
+        {
+            round = std::stoul(argv[++i]);
+        }
+        else if(arg == "--path")
+        {
+            path = argv[++i];
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (size > 0 && groups && maxThreads && durationMs && round) ? EXIT_SUCCESS
+                                                                       : EXIT_FAILURE;
+}
+
+constexpr uint64_t workspaceSize = 32 * 1024 * 1024;
+
+struct MatmulQuery
+{
+    hipblasLtMatmulDesc_t       matmul = nullptr;
+    hipblasLtMatrixLayout_t     matA   = nullptr;
+    hipblasLtMatrixLayout_t     matB   = nullptr;
+    hipblasLtMatrixLayout_t     matC   = nullptr;
+    hipblasLtMatmulPreference_t pref   = nullptr;
+
+    MatmulQuery(int64_t m, int64_t n, int64_t k)
+    {
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, HIP_R_16F, m, k, m));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB, HIP_R_16F, k, n, k));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matC, HIP_R_16F, m, n, m));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceCreate(&pref));
+        CHECK_HIPBLASLT_ERROR(
+            hipblasLtMatmulPreferenceSetAttribute(pref,
+                                                  HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                  &workspaceSize,
+                                                  sizeof(workspaceSize)));
+    }
+    ~MatmulQuery()
+    {
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceDestroy(pref));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matA));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matB));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matC));
+    }
+
+    hipblasLtMatmulHeuristicResult_t heuristic(hipblasLtHandle_t handle) const
+    {
+        hipblasLtMatmulHeuristicResult_t result;
+        int                              returned = 0;
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(
+            handle, matmul, matA, matB, matC, matC, pref, 1, &result, &returned));
+        if(!returned)
+        {
+            std::cerr << "no solution for the fp16 gemm" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        return result;
+    }
+};
+
+// Everything one thread calls into, created before the timing starts
+struct ThreadContext
+{
+    size_t            thread;
+    size_t            threads;
+    int64_t           size;
+    hipblasLtHandle_t handle;
+    hipStream_t       stream;
+    void*             da;
+    void*             db;
+    void*             dd;
+    void*             dWorkspace;
+    float             alpha = 1.f;
+    float             beta  = 0.f;
+
+    std::unique_ptr<MatmulQuery>                  query;
+    hipblasLtMatmulAlgo_t                         algo;
+    std::unique_ptr<hipblaslt_ext::Gemm>          gemm;
+    std::unique_ptr<hipblaslt_ext::GroupedGemm>   groupedGemm;
+    std::unique_ptr<MatmulQuery>                  coldQuery;
+    uint64_t                                      coldQueries = 0;
+    std::vector<hipblasLtMatmulHeuristicResult_t> results;
+
+    ThreadContext(size_t thread, size_t threads, int64_t size, size_t groups)
+        : thread(thread)
+        , threads(threads)
+        , size(size)
+        , results(1)
+    {
+        const size_t elements = size_t(size) * size;
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+        CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+        CHECK_HIP_ERROR(hipMalloc(&da, elements * groups * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMalloc(&db, elements * groups * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMalloc(&dd, elements * groups * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMalloc(&dWorkspace, workspaceSize));
+        CHECK_HIP_ERROR(hipMemset(da, 0, elements * groups * sizeof(_Float16)));
+        CHECK_HIP_ERROR(hipMemset(db, 0, elements * groups * sizeof(_Float16)));
+
+        query = std::make_unique<MatmulQuery>(size, size, size);
+        algo  = query->heuristic(handle).algo;
+
+        hipblaslt_ext::GemmPreferenceV2 pref;
+        pref.setMaxWorkspaceBytes(workspaceSize);
+
+        hipblaslt_ext::GemmEpilogueV2 epilogue;
+        hipblaslt_ext::GemmInputsV2   inputs;
+        inputs.setA(da);
+        inputs.setB(db);
+        inputs.setC(dd);
+        inputs.setD(dd);
+        inputs.setAlpha(&alpha);
+        inputs.setBeta(&beta);
+        gemm = std::make_unique<hipblaslt_ext::Gemm>(handle,
+                                                     HIPBLAS_OP_N,
+                                                     HIPBLAS_OP_N,
+                                                     HIP_R_16F,
+                                                     HIP_R_16F,
+                                                     HIP_R_16F,
+                                                     HIP_R_16F,
+                                                     HIPBLAS_COMPUTE_32F);
+        CHECK_HIPBLASLT_ERROR(gemm->setProblem(size, size, size, 1, epilogue, inputs));
+        CHECK_HIPBLASLT_ERROR(gemm->algoGetHeuristic(1, pref, results));
+        if(results.empty())
+        {
+            std::cerr << "no solution for a " << size << "^3 fp16 gemm" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        CHECK_HIPBLASLT_ERROR(gemm->initialize(results[0].algo, dWorkspace));
+
+        std::vector<int64_t>                       ms(groups, size), ns(groups, size);
+        std::vector<int64_t>                       ks(groups, size), batches(groups, 1);
+        std::vector<hipblaslt_ext::GemmEpilogueV2> epilogues(groups);
+        std::vector<hipblaslt_ext::GemmInputsV2>   groupInputs(groups);
+        for(size_t g = 0; g < groups; g++)
+        {
+            auto* a = static_cast<_Float16*>(da) + g * elements;
+            auto* b = static_cast<_Float16*>(db) + g * elements;
+            auto* d = static_cast<_Float16*>(dd) + g * elements;
+            groupInputs[g].setA(a);
+            groupInputs[g].setB(b);
+            groupInputs[g].setC(d);
+            groupInputs[g].setD(d);
+            groupInputs[g].setAlpha(&alpha);
+            groupInputs[g].setBeta(&beta);
+        }
+        groupedGemm = std::make_unique<hipblaslt_ext::GroupedGemm>(handle,
+                                                                   HIPBLAS_OP_N,
+                                                                   HIPBLAS_OP_N,
+                                                                   HIP_R_16F,
+                                                                   HIP_R_16F,
+                                                                   HIP_R_16F,
+                                                                   HIP_R_16F,
+                                                                   HIPBLAS_COMPUTE_32F);
+        CHECK_HIPBLASLT_ERROR(
+            groupedGemm->setProblem(ms, ns, ks, batches, epilogues, groupInputs));
+        CHECK_HIPBLASLT_ERROR(groupedGemm->algoGetHeuristic(1, pref, results));
+        if(results.empty())
+        {
+            std::cerr << "no solution for " << groups << " grouped fp16 gemms" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        CHECK_HIPBLASLT_ERROR(groupedGemm->initialize(results[0].algo, dWorkspace));
+    }
+    ~ThreadContext()
+    {
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        coldQuery.reset();
+        groupedGemm.reset();
+        gemm.reset();
+        query.reset();
+        CHECK_HIP_ERROR(hipFree(dWorkspace));
+        CHECK_HIP_ERROR(hipFree(da));
+        CHECK_HIP_ERROR(hipFree(db));
+        CHECK_HIP_ERROR(hipFree(dd));
+        CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    }
+
+    // A problem no thread has queried before, so the heuristic misses every cache.
+    // Only the shape changes, m grows by the thread count between the queries.
+    void nextColdQuery()
+    {
+        coldQuery.reset();
+        int64_t m = size + 16 + coldQueries++ * threads + thread;
+        coldQuery = std::make_unique<MatmulQuery>(m, size, size);
+    }
+};
+
+struct HostPath
+{
+    const char* name;
+    // Queues work on the stream, drained between rounds
+    bool launches;
+    // Untimed, runs before every call when set, the rounds are one call then
+    std::function<void(ThreadContext&)> prepare;
+    std::function<void(ThreadContext&)> call;
+};
+
+std::vector<HostPath> hostPaths()
+{
+    return {
+        {"hipblasLtMatmul, cached algo",
+         true,
+         nullptr,
+         [](ThreadContext& c) {
+             CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(c.handle,
+                                                   c.query->matmul,
+                                                   &c.alpha,
+                                                   c.da,
+                                                   c.query->matA,
+                                                   c.db,
+                                                   c.query->matB,
+                                                   &c.beta,
+                                                   c.dd,
+                                                   c.query->matC,
+                                                   c.dd,
+                                                   c.query->matC,
+                                                   &c.algo,
+                                                   c.dWorkspace,
+                                                   workspaceSize,
+                                                   c.stream));
+         }},
+        {"Gemm::run",
+         true,
+         nullptr,
+         [](ThreadContext& c) { CHECK_HIPBLASLT_ERROR(c.gemm->run(c.stream)); }},
+        {"GroupedGemm::run",
+         true,
+         nullptr,
+         [](ThreadContext& c) { CHECK_HIPBLASLT_ERROR(c.groupedGemm->run(c.stream)); }},
+        {"algoGetHeuristic, warm",
+         false,
+         nullptr,
+         [](ThreadContext& c) { c.query->heuristic(c.handle); }},
+        {"algoGetHeuristic, cold",
+         false,
+         [](ThreadContext& c) { c.nextColdQuery(); },
+         [](ThreadContext& c) { c.coldQuery->heuristic(c.handle); }},
+        {"hipblasLtMatmulDescSetAttribute",
+         false,
+         nullptr,
+         [](ThreadContext& c) {
+             hipblasLtEpilogue_t epilogue = HIPBLASLT_EPILOGUE_DEFAULT;
+             CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                 c.query->matmul, HIPBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue)));
+         }},
+        {"hipblasLtCreate + hipblasLtDestroy",
+         false,
+         nullptr,
+         [](ThreadContext& c) {
+             hipblasLtHandle_t handle;
+             CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+             CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+         }},
+    };
+}
+
+struct ThreadResult
+{
+    uint64_t calls  = 0;
+    double   hostNs = 0;
+};
+
+// Runs path on threads threads for durationMs, each thread sums the host time of its calls
+std::vector<ThreadResult> measure(const HostPath& path,
+                                  size_t          threads,
+                                  int64_t         size,
+                                  size_t          groups,
+                                  size_t          durationMs,
+                                  uint32_t        round)
+{
+    std::atomic<bool>         start{false};
+    std::atomic<bool>         stop{false};
+    std::atomic<size_t>       ready{0};
+    std::vector<ThreadResult> results(threads);
+    std::vector<std::thread>  workers;
+
+    for(size_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]() {
+            ThreadContext context(t, threads, size, groups);
+
+            // One untimed call loads everything the path needs
+            if(path.prepare)
+                path.prepare(context);
+            path.call(context);
+            CHECK_HIP_ERROR(hipStreamSynchronize(context.stream));
+
+            ready++;
+            while(!start.load())
+                std::this_thread::yield();
+
+            uint32_t                            count = path.prepare ? 1 : round;
+            std::chrono::steady_clock::duration total{0};
+            uint64_t                            calls = 0;
+            while(!stop.load(std::memory_order_relaxed))
+            {
+                if(path.prepare)
+                    path.prepare(context);
+                auto begin = std::chrono::steady_clock::now();
+                for(uint32_t i = 0; i < count; i++)
+                    path.call(context);
+                total += std::chrono::steady_clock::now() - begin;
+                calls += count;
+                if(path.launches)
+                    CHECK_HIP_ERROR(hipStreamSynchronize(context.stream));
+            }
+            results[t].calls  = calls;
+            results[t].hostNs = std::chrono::duration<double, std::nano>(total).count();
+        });
+    }
+
+    while(ready.load() < threads)
+        std::this_thread::yield();
+
+    start.store(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+    stop.store(true);
+
+    for(auto& w : workers)
+        w.join();
+    return results;
+}
+
+int main(int argc, char** argv)
+{
+    int64_t     size       = 64;
+    size_t      groups     = 16;
+    size_t      maxThreads = 8;
+    size_t      durationMs = 500;
+    uint32_t    round      = 100;
+    std::string filter;
+
+    if(parseArgs(argc, argv, size, groups, maxThreads, durationMs, round, filter))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "host ns per call, " << size << "^3 fp16 gemm, " << groups << " groups, "
+              << durationMs << " ms per step" << std::endl;
+
+    for(auto& path : hostPaths())
+    {
+        if(std::string(path.name).find(filter) == std::string::npos)
+            continue;
+
+        std::cout << path.name << std::endl;
+        std::cout << std::setw(8) << "threads" << std::setw(12) << "ns/call" << std::setw(16)
+                  << "calls/s" << std::setw(20) << "calls/s/thread" << std::endl;
+        for(size_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            auto results = measure(path, threads, size, groups, durationMs, round);
+
+            // ns/call is the mean over the threads of the host time they spent per
+            // call, calls/s only counts the timed calls against their host time
+            uint64_t calls  = 0;
+            double   hostNs = 0;
+            for(auto& result : results)
+            {
+                calls += result.calls;
+                hostNs += result.hostNs;
+            }
+            double nsPerCall = calls ? hostNs / calls : 0.0;
+            double rate      = nsPerCall ? threads * 1.0e9 / nsPerCall : 0.0;
+            std::cout << std::setw(8) << threads << std::setw(12) << std::fixed
+                      << std::setprecision(1) << nsPerCall << std::setw(16)
+                      << std::setprecision(0) << rate << std::setw(20) << rate / threads
+                      << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
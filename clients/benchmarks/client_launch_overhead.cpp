@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Measures the host time of one kernel launch through hipblaslt_ext::Gemm::run
+// against the raw hipModuleLaunchKernel and hipExtModuleLaunchKernel of an empty
+// kernel. Launches are issued in rounds and only the enqueue is timed, the stream
+// is drained between rounds so it never backs up.
+
+#include <hip/hip_ext.h>
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt-ext.hpp>
+#include <hipblaslt/hipblaslt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define CHECK_HIP_ERROR(expr)                                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        hipError_t error__ = (expr);                                                               \
+        if(error__ != hipSuccess)                                                                  \
+        {                                                                                          \
+            std::cerr << "hip error " << hipGetErrorString(error__) << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+#define CHECK_HIPBLASLT_ERROR(expr)                                                                \
+    do                                                                                             \
+    {                                                                                              \
+        hipblasStatus_t status__ = (expr);                                                         \
+        if(status__ != HIPBLAS_STATUS_SUCCESS)                                                     \
+        {                                                                                          \
+            std::cerr << "hipBLASLt error " << status__ << " at " << __FILE__ << ":"               \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+__global__ void emptyKernel() {}
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t--size\t\t\t\tm, n and k of the fp16 gemm, default is 64\n"
+              << "\t--launches\t\t\tTimed launches per path, default is 10000\n"
+              << "\t--round\t\t\t\tLaunches between two stream drains, default is 100\n";
+}
+
+int parseArgs(int argc, char** argv, int64_t& size, uint32_t& launches, uint32_t& round)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if((arg == "-h") || (arg == "--help"))
+        {
+            return EXIT_FAILURE;
+        }
+        else if(i + 1 >= argc)
+        {
+            std::cerr << "missing value for " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        else if(arg == "--size")
+        {
+            size = std::stol(argv[++i]);
+        }
+        else if(arg == "--launches")
+        {
+            launches = std::stoul(argv[++i]);
+        }
+        else if(arg == "--round")
+        {
+            round = std::stoul(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (size > 0 && launches && round) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Host microseconds per call of launch, excluding the stream drains
+template <typename Func>
+double hostUs(hipStream_t stream, uint32_t launches, uint32_t round, Func&& launch)
+{
+    // One untimed call loads everything the path needs
+    launch();
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    std::chrono::steady_clock::duration total{0};
+    for(uint32_t done = 0; done < launches; done += round)
+    {
+        uint32_t count = std::min(round, launches - done);
+        auto     begin = std::chrono::steady_clock::now();
+        for(uint32_t i = 0; i < count; i++)
+            launch();
+        total += std::chrono::steady_clock::now() - begin;
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    return std::chrono::duration<double, std::micro>(total).count() / launches;
+}
+
+int main(int argc, char** argv)
+{
+    int64_t  size     = 64;
+    uint32_t launches = 10000;
+    uint32_t round    = 100;
+
+    if(parseArgs(argc, argv, size, launches, round))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    hipblasLtHandle_t handle;
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    hipFunction_t function;
+    CHECK_HIP_ERROR(hipGetFuncBySymbol(&function, reinterpret_cast<const void*>(&emptyKernel)));
+
+    double rawUs = hostUs(stream, launches, round, [&]() {
+        CHECK_HIP_ERROR(
+            hipModuleLaunchKernel(function, 1, 1, 1, 64, 1, 1, 0, stream, nullptr, nullptr));
+    });
+
+    // The launch the library issues, with the kernel arguments in one buffer
+    std::vector<uint8_t> args(128);
+    size_t               argsSize       = args.size();
+    void*                launchParams[] = {HIP_LAUNCH_PARAM_BUFFER_POINTER,
+                                           args.data(),
+                                           HIP_LAUNCH_PARAM_BUFFER_SIZE,
+                                           &argsSize,
+                                           HIP_LAUNCH_PARAM_END};
+    double extUs = hostUs(stream, launches, round, [&]() {
+        CHECK_HIP_ERROR(hipExtModuleLaunchKernel(
+            function, 64, 1, 1, 64, 1, 1, 0, stream, nullptr, launchParams, nullptr, nullptr));
+    });
+
+    const size_t elements = size_t(size) * size;
+    void *       da, *db, *dd;
+    CHECK_HIP_ERROR(hipMalloc(&da, elements * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMalloc(&db, elements * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMalloc(&dd, elements * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMemset(da, 0, elements * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMemset(db, 0, elements * sizeof(_Float16)));
+
+    float                         alpha = 1.f;
+    float                         beta  = 0.f;
+    hipblaslt_ext::GemmInputsV2   inputs;
+    hipblaslt_ext::GemmEpilogueV2 epilogue;
+    inputs.setA(da);
+    inputs.setB(db);
+    inputs.setC(dd);
+    inputs.setD(dd);
+    inputs.setAlpha(&alpha);
+    inputs.setBeta(&beta);
+    hipblaslt_ext::GemmProblemTypeV2 problemType(HIPBLAS_OP_N,
+                                                 HIPBLAS_OP_N,
+                                                 HIP_R_16F,
+                                                 HIP_R_16F,
+                                                 HIP_R_16F,
+                                                 HIP_R_16F,
+                                                 HIPBLAS_COMPUTE_32F);
+    hipblaslt_ext::Gemm gemm(handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             HIP_R_16F,
+                             HIP_R_16F,
+                             HIP_R_16F,
+                             HIP_R_16F,
+                             HIPBLAS_COMPUTE_32F);
+    CHECK_HIPBLASLT_ERROR(gemm.setProblem(size,
+                                          size,
+                                          size,
+                                          1,
+                                          size,
+                                          size,
+                                          size,
+                                          size,
+                                          elements,
+                                          elements,
+                                          elements,
+                                          elements,
+                                          epilogue,
+                                          inputs,
+                                          problemType));
+
+    uint64_t workspaceSize = 32 * 1024 * 1024;
+    void*    dWorkspace;
+    CHECK_HIP_ERROR(hipMalloc(&dWorkspace, workspaceSize));
+    hipblaslt_ext::GemmPreferenceV2 pref;
+    pref.setMaxWorkspaceBytes(workspaceSize);
+    std::vector<hipblasLtMatmulHeuristicResult_t> results;
+    CHECK_HIPBLASLT_ERROR(gemm.algoGetHeuristic(1, pref, results));
+    if(results.empty())
+    {
+        std::cerr << "no solution for a " << size << "^3 fp16 gemm" << std::endl;
+        return EXIT_FAILURE;
+    }
+    CHECK_HIPBLASLT_ERROR(gemm.initialize(results[0].algo, dWorkspace));
+
+    double runUs
+        = hostUs(stream, launches, round, [&]() { CHECK_HIPBLASLT_ERROR(gemm.run(stream)); });
+
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+    double eventUs = hostUs(stream, launches, round, [&]() {
+        CHECK_HIPBLASLT_ERROR(gemm.run(stream, start, stop));
+    });
+
+    std::vector<hipblaslt_ext::GemmInstance*> batch(8, &gemm);
+    double batchUs = hostUs(stream, launches, round, [&]() {
+        CHECK_HIPBLASLT_ERROR(hipblaslt_ext::GemmInstance::runBatch(batch, stream));
+    });
+    batchUs /= batch.size();
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "host us per launch, " << launches << " launches, " << size << "^3 fp16 gemm"
+              << std::endl;
+    std::cout << "hipModuleLaunchKernel:    " << rawUs << std::endl;
+    std::cout << "hipExtModuleLaunchKernel: " << extUs << std::endl;
+    std::cout << "Gemm::run:                " << runUs << std::endl;
+    std::cout << "Gemm::run with events:    " << eventUs << std::endl;
+    std::cout << "runBatch of " << batch.size() << ", per gemm:  " << batchUs << std::endl;
+
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+    CHECK_HIP_ERROR(hipFree(dWorkspace));
+    CHECK_HIP_ERROR(hipFree(da));
+    CHECK_HIP_ERROR(hipFree(db));
+    CHECK_HIP_ERROR(hipFree(dd));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return EXIT_SUCCESS;
+}
@@ -23,10 +23,14 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <chrono>
+#include <fstream>
 #include <hip/hip_runtime.h>
 #include <hipblaslt/hipblaslt-ext.hpp>
 #include <hipblaslt_init.hpp>
+#include <iomanip>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <string>
 
@@ -83,6 +87,12 @@ public:
     // Internal switch
     bool is_using_bias = false;
 
+    // Scheduling: the layer runs on stream after the previous layer of that stream and the
+    // layers of depends_on, names or indices of earlier layers
+    int                      stream = 0;
+    std::vector<std::string> depends_on;
+    std::vector<size_t>      deps;
+
     // Internal data
     int64_t            ws_size;
     void*              ws   = NULL;
@@ -181,6 +191,17 @@ Layer::TYPE string2LayerType(std::string& value)
                               : Layer::TYPE::UNKNOWN;
 }
 
+// Index of the layer called name, or whose index name is; layers.size() when there is none
+size_t findLayer(const std::vector<Layer>& layers, const std::string& name)
+{
+    for(size_t i = 0; i < layers.size(); i++)
+        if(layers[i].name == name)
+            return i;
+    if(!name.empty() && name.find_first_not_of("0123456789") == std::string::npos)
+        return std::min<size_t>(std::stoul(name), layers.size());
+    return layers.size();
+}
+
 int32_t type2Size(hipDataType type)
 {
     switch(type)
@@ -252,6 +273,126 @@ void initNoCopy(
         CHECK_HIP_ERROR(hipMalloc(&d_data[b], size));
 }
 
+// Timeline of the timed iterations in the Chrome trace format, for chrome://tracing or Perfetto.
+// The host spans are the API calls, the device spans the work of each layer between events.
+class ChromeTrace
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ChromeTrace(size_t spanCount)
+    {
+        CHECK_HIP_ERROR(hipEventCreate(&m_origin));
+        m_events.resize(2 * spanCount);
+        for(auto& event : m_events)
+            CHECK_HIP_ERROR(hipEventCreate(&event));
+    }
+    ~ChromeTrace()
+    {
+        CHECK_HIP_ERROR(hipEventDestroy(m_origin));
+        for(auto& event : m_events)
+            CHECK_HIP_ERROR(hipEventDestroy(event));
+    }
+
+    // Lines up the host clock with the events recorded on stream from now on
+    void start(hipStream_t stream)
+    {
+        CHECK_HIP_ERROR(hipEventRecord(m_origin, stream));
+        CHECK_HIP_ERROR(hipEventSynchronize(m_origin));
+        m_hostOrigin = Clock::now();
+    }
+
+    void addHost(const std::string& name, Clock::time_point begin, Clock::time_point end)
+    {
+        m_host.push_back({name, begin, end});
+    }
+
+    // Brackets the work queued on stream until endDevice() with events, lane is the row of the
+    // stream in the trace
+    void beginDevice(const std::string& name, hipStream_t stream, int lane = 0)
+    {
+        size_t span = m_device.size();
+        m_device.push_back({name, lane});
+        m_lanes = std::max(m_lanes, lane + 1);
+        CHECK_HIP_ERROR(hipEventRecord(m_events[2 * span], stream));
+    }
+    void endDevice(hipStream_t stream)
+    {
+        CHECK_HIP_ERROR(hipEventRecord(m_events[2 * m_device.size() - 1], stream));
+    }
+
+    // Call once the events completed
+    void write(const std::string& path)
+    {
+        std::ofstream out(path);
+        if(!out)
+        {
+            std::cerr << "Cannot open trace file " << path << std::endl;
+            return;
+        }
+        out << "{\"traceEvents\":[\n"
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,"
+            << "\"args\":{\"name\":\"host\"}}";
+        for(int lane = 0; lane < m_lanes; lane++)
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << lane + 1
+                << ",\"args\":{\"name\":\"stream " << lane << "\"}}";
+        for(auto& span : m_host)
+            writeSpan(out, span.name, "host", 0, microseconds(span.begin), microseconds(span.end));
+        for(size_t i = 0; i < m_device.size(); i++)
+        {
+            float begin, end;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&begin, m_origin, m_events[2 * i]));
+            CHECK_HIP_ERROR(hipEventElapsedTime(&end, m_origin, m_events[2 * i + 1]));
+            writeSpan(out,
+                      m_device[i].name,
+                      "device",
+                      m_device[i].lane + 1,
+                      begin * 1000.0,
+                      end * 1000.0);
+        }
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        std::cout << "Trace written to " << path << std::endl;
+    }
+
+private:
+    struct HostSpan
+    {
+        std::string       name;
+        Clock::time_point begin;
+        Clock::time_point end;
+    };
+
+    struct DeviceSpan
+    {
+        std::string name;
+        int         lane;
+    };
+
+    double microseconds(Clock::time_point t) const
+    {
+        return std::chrono::duration<double, std::micro>(t - m_hostOrigin).count();
+    }
+
+    static void writeSpan(std::ofstream&     out,
+                          const std::string& name,
+                          const char*        category,
+                          int                tid,
+                          double             begin,
+                          double             end)
+    {
+        out << ",\n{\"name\":\"" << name << "\",\"cat\":\"" << category
+            << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid << ",\"ts\":" << std::fixed
+            << std::setprecision(3) << begin << ",\"dur\":" << end - begin << "}";
+    }
+
+    hipEvent_t               m_origin;
+    Clock::time_point        m_hostOrigin;
+    std::vector<hipEvent_t>  m_events;
+    std::vector<HostSpan>    m_host;
+    std::vector<DeviceSpan>  m_device;
+    int                      m_lanes = 1;
+};
+
 class LayerConfigIOGeneralSettings
 {
 public:
@@ -302,11 +443,13 @@ namespace llvm
                     std::cout << "Unknown Gemm type (GEMM/FLUSH)." << std::endl;
                     exit(1);
                 }
-                else if(l.type == Layer::TYPE::FLUSH)
+                io.mapOptional("Name", l.name);
+                io.mapOptional("Stream", l.stream);
+                io.mapOptional("DependsOn", l.depends_on);
+                if(l.type == Layer::TYPE::FLUSH)
                 {
                     return;
                 }
-                io.mapOptional("Name", l.name);
 
                 // Basic information
                 std::vector<uint32_t> sizes;
@@ -376,9 +519,12 @@ namespace llvm
 
 int main(int argc, char** argv)
 {
-    if(argc != 2)
+    std::string tracePath;
+    if(argc == 4 && std::string(argv[2]) == "--trace")
+        tracePath = argv[3];
+    else if(argc != 2)
     {
-        std::cerr << "Usage: " << argv[0] << " yaml-config.yaml" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " yaml-config.yaml [--trace out.json]" << std::endl;
         exit(1);
     }
     auto              inputFile = llvm::MemoryBuffer::getFile(argv[1]);
@@ -530,17 +676,104 @@ int main(int argc, char** argv)
                     heuristicResults[gemmIdx].algo, layer[gemmIdx].ws));
         }
 
+    // Resolve the dependencies and create a stream per Stream index, the first is stream
+    int32_t stream_count = 1;
+    for(size_t i = 0; i < layer.size(); i++)
+    {
+        Layer& l = layer[i];
+        if(l.stream < 0)
+        {
+            std::cerr << "Stream of layer " << i << " must not be negative." << std::endl;
+            exit(1);
+        }
+        stream_count = max(stream_count, l.stream + 1);
+        for(auto& dep : l.depends_on)
+        {
+            size_t d = findLayer(layer, dep);
+            if(d >= i)
+            {
+                std::cerr << "DependsOn of layer " << i << " must name an earlier layer: " << dep
+                          << std::endl;
+                exit(1);
+            }
+            l.deps.push_back(d);
+        }
+    }
+    std::vector<hipStream_t> streams(stream_count, stream);
+    std::vector<hipEvent_t>  stream_done(stream_count), layer_done(layer.size());
+    hipEvent_t               fork_event;
+    CHECK_HIP_ERROR(hipEventCreateWithFlags(&fork_event, hipEventDisableTiming));
+    for(int32_t s = 1; s < stream_count; s++)
+    {
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&streams[s], hipStreamNonBlocking));
+        CHECK_HIP_ERROR(hipEventCreateWithFlags(&stream_done[s], hipEventDisableTiming));
+    }
+    for(auto& event : layer_done)
+        CHECK_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    // An iteration forks the other streams from stream and joins them back into it, so that
+    // iterations do not overlap and graph capture sees every stream
+    auto fork = [&]() {
+        if(stream_count == 1)
+            return;
+        CHECK_HIP_ERROR(hipEventRecord(fork_event, stream));
+        for(int32_t s = 1; s < stream_count; s++)
+            CHECK_HIP_ERROR(hipStreamWaitEvent(streams[s], fork_event, 0));
+    };
+    auto join = [&]() {
+        for(int32_t s = 1; s < stream_count; s++)
+        {
+            CHECK_HIP_ERROR(hipEventRecord(stream_done[s], streams[s]));
+            CHECK_HIP_ERROR(hipStreamWaitEvent(stream, stream_done[s], 0));
+        }
+    };
+    auto wait_dependencies = [&](size_t gemmIdx) {
+        for(size_t d : layer[gemmIdx].deps)
+            if(layer[d].stream != layer[gemmIdx].stream)
+                CHECK_HIP_ERROR(
+                    hipStreamWaitEvent(streams[layer[gemmIdx].stream], layer_done[d], 0));
+    };
+    auto run_layer = [&](size_t gemmIdx, int i, hipStream_t layer_stream) {
+        switch(layer[gemmIdx].type)
+        {
+        case Layer::TYPE::GEMM:
+            static_cast<void>((*layer[gemmIdx].gemms)[i % block_count].run(layer_stream));
+            break;
+        case Layer::TYPE::FLUSH:
+            hipLaunchKernelGGL(flush_icache, dim3(gpu_block3), dim3(64), 0, layer_stream);
+            break;
+        default:
+            break;
+        }
+    };
+    auto mark_done = [&](size_t gemmIdx) {
+        if(stream_count > 1)
+            CHECK_HIP_ERROR(
+                hipEventRecord(layer_done[gemmIdx], streams[layer[gemmIdx].stream]));
+    };
+
     hipEvent_t event_gpu_time_start, event_gpu_time_end;
     CHECK_HIP_ERROR(hipEventCreate(&event_gpu_time_start));
     CHECK_HIP_ERROR(hipEventCreate(&event_gpu_time_end));
 
     for(int i = 0; i < cold_iters; i++)
     {
+        fork();
         for(size_t gemmIdx = 0; gemmIdx < layer.size(); gemmIdx++)
         {
-            if(layer[gemmIdx].type == Layer::TYPE::GEMM)
-                static_cast<void>((*layer[gemmIdx].gemms)[i % block_count].run(stream));
+            wait_dependencies(gemmIdx);
+            run_layer(gemmIdx, i, streams[layer[gemmIdx].stream]);
+            mark_done(gemmIdx);
         }
+        join();
+    }
+
+    // In graph mode the events are captured with the layers and recorded by the launch
+    std::unique_ptr<ChromeTrace> trace;
+    if(!tracePath.empty())
+    {
+        trace = std::make_unique<ChromeTrace>(iters * layer.size());
+        trace->start(stream);
     }
 
     CHECK_HIP_ERROR(hipEventSynchronize(event_gpu_time_start));
@@ -554,20 +787,31 @@ int main(int argc, char** argv)
 
     for(int i = 0; i < iters; i++)
     {
+        fork();
         for(size_t gemmIdx = 0; gemmIdx < layer.size(); gemmIdx++)
         {
-            switch(layer[gemmIdx].type)
+            hipStream_t layer_stream = streams[layer[gemmIdx].stream];
+            wait_dependencies(gemmIdx);
+            std::string spanName;
+            if(trace)
             {
-            case Layer::TYPE::GEMM:
-                static_cast<void>((*layer[gemmIdx].gemms)[i % block_count].run(stream));
-                break;
-            case Layer::TYPE::FLUSH:
-                hipLaunchKernelGGL(flush_icache, dim3(gpu_block3), dim3(64), 0, stream);
-                break;
-            default:
-                break;
+                spanName = layer[gemmIdx].name.empty() ? "layer " + std::to_string(gemmIdx)
+                                                        : layer[gemmIdx].name;
+                spanName += " iter " + std::to_string(i);
+                trace->beginDevice(spanName, layer_stream, layer[gemmIdx].stream);
             }
+            auto hostBegin = ChromeTrace::Clock::now();
+            run_layer(gemmIdx, i, layer_stream);
+            if(trace)
+            {
+                trace->addHost(rv.gs.graph_mode ? "capture " + spanName : spanName,
+                               hostBegin,
+                               ChromeTrace::Clock::now());
+                trace->endDevice(layer_stream);
+            }
+            mark_done(gemmIdx);
         }
+        join();
     }
 
     if(rv.gs.graph_mode)
@@ -583,16 +827,61 @@ int main(int argc, char** argv)
         CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
         CHECK_HIP_ERROR(hipEventSynchronize(event_gpu_time_start));
         CHECK_HIP_ERROR(hipEventRecord(event_gpu_time_start, stream));
+        auto hostBegin = ChromeTrace::Clock::now();
         hipGraphLaunch(graph_exec, stream);
+        if(trace)
+            trace->addHost("graph launch", hostBegin, ChromeTrace::Clock::now());
         CHECK_HIP_ERROR(hipEventRecord(event_gpu_time_end, stream));
         CHECK_HIP_ERROR(hipEventSynchronize(event_gpu_time_end));
         CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
     }
+    if(trace)
+        trace->write(tracePath);
     float gpu_time_ms;
     CHECK_HIP_ERROR(hipEventElapsedTime(&gpu_time_ms, event_gpu_time_start, event_gpu_time_end));
     auto gpu_time_used = gpu_time_ms * 1000; // ms to us
     std::cout << "Time: " << gpu_time_used / iters << std::endl;
 
+    // With several streams, compare the time of an iteration with the layers run one by one on
+    // stream and with the critical path of the dependencies over those layer times
+    if(stream_count > 1)
+    {
+        std::vector<double> layer_us(layer.size()), finish_us(layer.size());
+        std::vector<double> stream_finish_us(stream_count, 0.0);
+        double              sum_us = 0.0, critical_us = 0.0;
+        std::cout << "layer,name,stream,depends_on,us" << std::endl;
+        for(size_t gemmIdx = 0; gemmIdx < layer.size(); gemmIdx++)
+        {
+            CHECK_HIP_ERROR(hipEventRecord(event_gpu_time_start, stream));
+            for(int i = 0; i < iters; i++)
+                run_layer(gemmIdx, i, stream);
+            CHECK_HIP_ERROR(hipEventRecord(event_gpu_time_end, stream));
+            CHECK_HIP_ERROR(hipEventSynchronize(event_gpu_time_end));
+            CHECK_HIP_ERROR(
+                hipEventElapsedTime(&gpu_time_ms, event_gpu_time_start, event_gpu_time_end));
+            layer_us[gemmIdx] = gpu_time_ms * 1000 / max(iters, 1);
+            sum_us += layer_us[gemmIdx];
+
+            Layer& l     = layer[gemmIdx];
+            double ready = stream_finish_us[l.stream];
+            for(size_t d : l.deps)
+                ready = std::max(ready, finish_us[d]);
+            finish_us[gemmIdx]         = ready + layer_us[gemmIdx];
+            stream_finish_us[l.stream] = finish_us[gemmIdx];
+            critical_us                = std::max(critical_us, finish_us[gemmIdx]);
+
+            std::string deps;
+            for(auto& dep : l.depends_on)
+                deps += (deps.empty() ? "" : " ") + dep;
+            std::cout << gemmIdx << "," << l.name << "," << l.stream << "," << deps << ","
+                      << layer_us[gemmIdx] << std::endl;
+        }
+        std::cout << "Sum of layer times: " << sum_us << " us, critical path: " << critical_us
+                  << " us, iteration: " << gpu_time_used / iters
+                  << " us, speedup over serial: " << sum_us / (gpu_time_used / iters)
+                  << std::endl;
+    }
+
     // Print kernel info
     if(rv.gs.print_kernel_info)
     {
@@ -610,6 +899,14 @@ int main(int argc, char** argv)
     CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
     CHECK_HIP_ERROR(hipEventDestroy(event_gpu_time_start));
     CHECK_HIP_ERROR(hipEventDestroy(event_gpu_time_end));
+    CHECK_HIP_ERROR(hipEventDestroy(fork_event));
+    for(auto& event : layer_done)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+    for(int32_t s = 1; s < stream_count; s++)
+    {
+        CHECK_HIP_ERROR(hipEventDestroy(stream_done[s]));
+        CHECK_HIP_ERROR(hipStreamDestroy(streams[s]));
+    }
     CHECK_HIP_ERROR(hipStreamDestroy(stream));
     if(graph)
     {
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Shards the problems of a hipblaslt-bench yaml file over the GPUs of a node, or of several
+// nodes sharing a file system, and merges the winners they tuned into one tuning file that can
+// be set as HIPBLASLT_TUNING_OVERRIDE_FILE. Every GPU runs a hipblaslt-bench worker in tuning
+// mode; the workers take the problems one by one from a shared work file.
+
+#include <hip/hip_runtime.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    const std::string gitVersionPrefix = "Git Version: ";
+
+    struct SweepOptions
+    {
+        std::string              bench;
+        std::string              output;
+        std::string              workFile;
+        std::vector<int>         devices;
+        std::vector<std::string> merge;
+        std::vector<std::string> benchArgs;
+        bool                     join = false;
+    };
+
+    void printUsage(char* programName)
+    {
+        std::cout
+            << "Usage: " << programName << " <options> -- <hipblaslt-bench options>\n"
+            << "       " << programName << " --output <file> --merge <tuning files>\n"
+            << "options:\n"
+            << "\t-h, --help\t\t\tShow this help message\n"
+            << "\t--bench\t\t\t\thipblaslt-bench to run, the one next to this program by default\n"
+            << "\t--devices\t\t\tComma separated devices to run on, all by default\n"
+            << "\t--output\t\t\tMerged tuning file to write\n"
+            << "\t--work_file\t\t\tFile the workers take the problems from, <output>.work by "
+               "default\n"
+            << "\t--join\t\t\t\tJoin a sweep started on another node with the same work file\n"
+            << "\t--merge\t\t\t\tOnly merge the given tuning files, of several nodes for example\n";
+    }
+
+    int parseArgs(int argc, char** argv, SweepOptions& options)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if((arg == "-h") || (arg == "--help"))
+            {
+                return EXIT_FAILURE;
+            }
+            else if(arg == "--")
+            {
+                options.benchArgs.assign(argv + i + 1, argv + argc);
+                break;
+            }
+            else if(arg == "--join")
+            {
+                options.join = true;
+            }
+            else if(arg == "--merge")
+            {
+                options.merge.assign(argv + i + 1, argv + argc);
+                break;
+            }
+            else if(i + 1 >= argc)
+            {
+                std::cerr << "missing value for " << arg << std::endl;
+                return EXIT_FAILURE;
+            }
+            else if(arg == "--bench")
+            {
+                options.bench = argv[++i];
+            }
+            else if(arg == "--devices")
+            {
+                std::string list = argv[++i];
+                for(size_t pos = 0; pos < list.size();)
+                {
+                    size_t end = list.find(',', pos);
+                    options.devices.push_back(std::stoi(list.substr(pos, end - pos)));
+                    pos = end == std::string::npos ? list.size() : end + 1;
+                }
+            }
+            else if(arg == "--output")
+            {
+                options.output = argv[++i];
+            }
+            else if(arg == "--work_file")
+            {
+                options.workFile = argv[++i];
+            }
+            else
+            {
+                std::cerr << "error with " << arg << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+
+        if(options.output.empty() || (options.merge.empty() && options.benchArgs.empty()))
+            return EXIT_FAILURE;
+        return EXIT_SUCCESS;
+    }
+
+    // The tuned winners are only valid for the device they were measured on
+    bool validateDevices(const std::vector<int>& devices)
+    {
+        hipDeviceProp_t first;
+        for(size_t i = 0; i < devices.size(); i++)
+        {
+            hipDeviceProp_t props;
+            if(hipGetDeviceProperties(&props, devices[i]) != hipSuccess)
+            {
+                std::cerr << "cannot query device " << devices[i] << std::endl;
+                return false;
+            }
+            if(i == 0)
+                first = props;
+            else if(strcmp(props.gcnArchName, first.gcnArchName)
+                    || props.multiProcessorCount != first.multiProcessorCount)
+            {
+                std::cerr << "device " << devices[i] << " (" << props.gcnArchName << ", "
+                          << props.multiProcessorCount << " CUs) differs from device "
+                          << devices[0] << " (" << first.gcnArchName << ", "
+                          << first.multiProcessorCount << " CUs)" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string partName(const std::string& output, int device)
+    {
+        char host[256] = {};
+        gethostname(host, sizeof(host) - 1);
+        return output + "." + host + ".dev" + std::to_string(device);
+    }
+
+    // Runs one hipblaslt-bench per device, returns the tuning files they wrote
+    bool runWorkers(const SweepOptions& options, std::vector<std::string>& parts)
+    {
+        std::vector<pid_t> workers;
+        for(int device : options.devices)
+        {
+            std::string part = partName(options.output, device);
+            std::string log  = part + ".log";
+            std::remove(part.c_str());
+            parts.push_back(part);
+
+            std::vector<std::string> args = {options.bench};
+            args.insert(args.end(), options.benchArgs.begin(), options.benchArgs.end());
+            args.insert(args.end(),
+                        {"--device", std::to_string(device), "--work_file", options.workFile});
+
+            pid_t pid = fork();
+            if(pid < 0)
+            {
+                std::cerr << "cannot start the worker of device " << device << std::endl;
+                return false;
+            }
+            if(pid == 0)
+            {
+                std::vector<char*> argv;
+                for(auto& arg : args)
+                    argv.push_back(const_cast<char*>(arg.c_str()));
+                argv.push_back(nullptr);
+
+                int fd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                if(fd >= 0)
+                {
+                    dup2(fd, STDOUT_FILENO);
+                    dup2(fd, STDERR_FILENO);
+                    close(fd);
+                }
+                setenv("HIPBLASLT_TUNING_FILE", part.c_str(), 1);
+                execv(argv[0], argv.data());
+                std::cerr << "cannot run " << argv[0] << std::endl;
+                _exit(EXIT_FAILURE);
+            }
+            std::cout << "device " << device << ": worker " << pid << ", log " << log << std::endl;
+            workers.push_back(pid);
+        }
+
+        bool success = true;
+        for(size_t i = 0; i < workers.size(); i++)
+        {
+            int status = 0;
+            waitpid(workers[i], &status, 0);
+            if(!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+            {
+                std::cerr << "the worker of device " << options.devices[i] << " failed"
+                          << std::endl;
+                success = false;
+            }
+        }
+        return success;
+    }
+
+    // The last two fields of a tuning file line are the architecture and the CU count
+    std::string deviceOf(const std::string& line)
+    {
+        size_t cu = line.rfind(',');
+        if(cu == std::string::npos || cu == 0)
+            return "";
+        size_t arch = line.rfind(',', cu - 1);
+        return arch == std::string::npos ? "" : line.substr(arch + 1);
+    }
+
+    // Concatenates the winners of tuning files of the same hipBLASLt version and device,
+    // returns the number of lines written or -1
+    int64_t mergeTuningFiles(const std::vector<std::string>& inputs, const std::string& output)
+    {
+        std::string              gitVersion, device;
+        std::vector<std::string> lines;
+        std::set<std::string>    seen;
+        for(auto& input : inputs)
+        {
+            std::ifstream file(input);
+            std::string   line;
+            if(!std::getline(file, line)
+               || line.compare(0, gitVersionPrefix.size(), gitVersionPrefix))
+            {
+                std::cerr << input << " is not a tuning file" << std::endl;
+                return -1;
+            }
+            if(gitVersion.empty())
+                gitVersion = line;
+            else if(line != gitVersion)
+            {
+                std::cerr << input << " was tuned with another hipBLASLt: " << line << std::endl;
+                return -1;
+            }
+
+            while(std::getline(file, line))
+            {
+                if(line.empty() || !seen.insert(line).second)
+                    continue;
+                if(device.empty())
+                    device = deviceOf(line);
+                else if(deviceOf(line) != device)
+                {
+                    std::cerr << input << " was tuned on " << deviceOf(line) << " instead of "
+                              << device << std::endl;
+                    return -1;
+                }
+                lines.push_back(line);
+            }
+        }
+
+        std::ofstream file(output);
+        file << gitVersion << "\n";
+        for(auto& line : lines)
+            file << line << "\n";
+        return file ? int64_t(lines.size()) : -1;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    SweepOptions options;
+
+    if(parseArgs(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> parts = options.merge;
+    if(parts.empty())
+    {
+        if(options.bench.empty())
+        {
+            std::string self  = argv[0];
+            size_t      slash = self.rfind('/');
+            options.bench
+                = (slash == std::string::npos ? "" : self.substr(0, slash + 1)) + "hipblaslt-bench";
+        }
+        if(options.workFile.empty())
+            options.workFile = options.output + ".work";
+        if(options.devices.empty())
+        {
+            int count = 0;
+            if(hipGetDeviceCount(&count) != hipSuccess || count == 0)
+            {
+                std::cerr << "no device found" << std::endl;
+                return EXIT_FAILURE;
+            }
+            for(int device = 0; device < count; device++)
+                options.devices.push_back(device);
+        }
+        if(!validateDevices(options.devices))
+            return EXIT_FAILURE;
+
+        // The node starting the sweep resets the work file, the joining ones continue it
+        if(!options.join)
+            std::ofstream(options.workFile, std::ios::trunc);
+
+        if(!runWorkers(options, parts))
+            return EXIT_FAILURE;
+    }
+
+    int64_t count = mergeTuningFiles(parts, options.output);
+    if(count < 0)
+    {
+        std::cerr << "failed to merge the tuning files into " << options.output << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "wrote " << count << " winners to " << options.output << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,322 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Compares hipblaslt_ext::batchedTinyGemm against hipblaslt_ext::GroupedGemm for a
+// large number of small fp16 problems with random sizes in [1, max_size]. Both paths
+// compute the same problems with alpha 1 and beta 0, the grouped gemm path picks
+// the fastest supported solution.
+
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt-ext.hpp>
+#include <hipblaslt/hipblaslt.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#define CHECK_HIP_ERROR(expr)                                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        hipError_t error__ = (expr);                                                               \
+        if(error__ != hipSuccess)                                                                  \
+        {                                                                                          \
+            std::cerr << "hip error " << hipGetErrorString(error__) << " at " << __FILE__ << ":"   \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+#define CHECK_HIPBLASLT_ERROR(expr)                                                                \
+    do                                                                                             \
+    {                                                                                              \
+        hipblasStatus_t status__ = (expr);                                                         \
+        if(status__ != HIPBLAS_STATUS_SUCCESS)                                                     \
+        {                                                                                          \
+            std::cerr << "hipBLASLt error " << status__ << " at " << __FILE__ << ":"               \
+                      << __LINE__ << std::endl;                                                    \
+            std::exit(EXIT_FAILURE);                                                               \
+        }                                                                                          \
+    } while(0)
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t--problems\t\t\tNumber of problems, default is 4096\n"
+              << "\t--max_size\t\t\tLargest m, n and k, at most 64, default is 32\n"
+              << "\t--iters\t\t\t\tTimed iterations per path, default is 100\n"
+              << "\t--seed\t\t\t\tSeed of the size generator, default is 0\n";
+}
+
+int parseArgs(
+    int argc, char** argv, uint32_t& problems, uint32_t& maxSize, uint32_t& iters, uint32_t& seed)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if((arg == "-h") || (arg == "--help"))
+        {
+            return EXIT_FAILURE;
+        }
+        else if(i + 1 >= argc)
+        {
+            std::cerr << "missing value for " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        else if(arg == "--problems")
+        {
+            problems = std::stoul(argv[++i]);
+        }
+        else if(arg == "--max_size")
+        {
+            maxSize = std::stoul(argv[++i]);
+        }
+        else if(arg == "--iters")
+        {
+            iters = std::stoul(argv[++i]);
+        }
+        else if(arg == "--seed")
+        {
+            seed = std::stoul(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (problems && iters && maxSize && maxSize <= hipblaslt_ext::TinyGemmMaxSize)
+               ? EXIT_SUCCESS
+               : EXIT_FAILURE;
+}
+
+template <typename Func>
+float timeMs(hipStream_t stream, uint32_t iters, Func&& func)
+{
+    // One untimed call compiles/loads everything the path needs
+    func();
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+    CHECK_HIP_ERROR(hipEventRecord(start, stream));
+    for(uint32_t i = 0; i < iters; i++)
+        func();
+    CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+    CHECK_HIP_ERROR(hipEventSynchronize(stop));
+    float ms = 0;
+    CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+    return ms / iters;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t problems = 4096;
+    uint32_t maxSize  = 32;
+    uint32_t iters    = 100;
+    uint32_t seed     = 0;
+
+    if(parseArgs(argc, argv, problems, maxSize, iters, seed))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::mt19937                            gen(seed);
+    std::uniform_int_distribution<uint32_t> dist(1, maxSize);
+
+    // All problems share one allocation per matrix, every problem owns a
+    // maxSize x maxSize slice of it
+    const size_t slice = size_t(maxSize) * maxSize;
+    void *       da, *db, *dd;
+    CHECK_HIP_ERROR(hipMalloc(&da, problems * slice * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMalloc(&db, problems * slice * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMalloc(&dd, problems * slice * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMemset(da, 0, problems * slice * sizeof(_Float16)));
+    CHECK_HIP_ERROR(hipMemset(db, 0, problems * slice * sizeof(_Float16)));
+
+    float alpha = 1.f;
+    float beta  = 0.f;
+
+    std::vector<hipblaslt_ext::TinyGemmArguments> tiny(problems);
+    std::vector<int64_t>                          m(problems), n(problems), k(problems);
+    std::vector<int64_t>                          ld(problems, maxSize), stride(problems, slice);
+    std::vector<int64_t>                          batch(problems, 1);
+    std::vector<hipblaslt_ext::GemmEpilogueV2>    epilogue(problems);
+    std::vector<hipblaslt_ext::GemmInputsV2>      inputs(problems);
+    double                                        flops = 0;
+    for(uint32_t i = 0; i < problems; i++)
+    {
+        m[i] = dist(gen);
+        n[i] = dist(gen);
+        k[i] = dist(gen);
+        flops += 2.0 * m[i] * n[i] * k[i];
+
+        auto a = static_cast<_Float16*>(da) + i * slice;
+        auto b = static_cast<_Float16*>(db) + i * slice;
+        auto d = static_cast<_Float16*>(dd) + i * slice;
+        tiny[i] = {uint32_t(m[i]),
+                   uint32_t(n[i]),
+                   uint32_t(k[i]),
+                   maxSize,
+                   maxSize,
+                   maxSize,
+                   maxSize,
+                   alpha,
+                   beta,
+                   a,
+                   b,
+                   d,
+                   d};
+
+        inputs[i].setA(a);
+        inputs[i].setB(b);
+        inputs[i].setC(d);
+        inputs[i].setD(d);
+        inputs[i].setAlpha(&alpha);
+        inputs[i].setBeta(&beta);
+    }
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    hipblasLtHandle_t handle;
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    hipblaslt_ext::TinyGemmArguments* dTiny;
+    CHECK_HIP_ERROR(hipMalloc(&dTiny, problems * sizeof(hipblaslt_ext::TinyGemmArguments)));
+    CHECK_HIP_ERROR(hipMemcpy(dTiny,
+                              tiny.data(),
+                              problems * sizeof(hipblaslt_ext::TinyGemmArguments),
+                              hipMemcpyHostToDevice));
+
+    float tinyMs = timeMs(stream, iters, [&]() {
+        CHECK_HIPBLASLT_ERROR(hipblaslt_ext::batchedTinyGemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, HIP_R_16F, HIP_R_16F, dTiny, problems, stream));
+    });
+
+    // Grouped gemm baseline with device user arguments
+    uint64_t workspaceSize = 128 * 1024 * 1024;
+    void*    dWorkspace;
+    CHECK_HIP_ERROR(hipMalloc(&dWorkspace, workspaceSize));
+
+    hipblaslt_ext::GroupedGemm groupedGemm(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           HIP_R_16F,
+                                           HIP_R_16F,
+                                           HIP_R_16F,
+                                           HIP_R_16F,
+                                           HIPBLAS_COMPUTE_32F);
+    auto problemType = hipblaslt_ext::GemmProblemTypeV2(HIPBLAS_OP_N,
+                                                        HIPBLAS_OP_N,
+                                                        HIP_R_16F,
+                                                        HIP_R_16F,
+                                                        HIP_R_16F,
+                                                        HIP_R_16F,
+                                                        HIPBLAS_COMPUTE_32F);
+    CHECK_HIPBLASLT_ERROR(groupedGemm.setProblem(m,
+                                                 n,
+                                                 k,
+                                                 batch,
+                                                 ld,
+                                                 ld,
+                                                 ld,
+                                                 ld,
+                                                 stride,
+                                                 stride,
+                                                 stride,
+                                                 stride,
+                                                 epilogue,
+                                                 inputs,
+                                                 problemType));
+
+    std::vector<hipblasLtMatmulHeuristicResult_t> results;
+    hipblaslt_ext::GemmType gemmType = hipblaslt_ext::GemmType::HIPBLASLT_GROUPED_GEMM;
+    CHECK_HIPBLASLT_ERROR(hipblaslt_ext::getAllAlgos(handle,
+                                                     gemmType,
+                                                     HIPBLAS_OP_N,
+                                                     HIPBLAS_OP_N,
+                                                     HIP_R_16F,
+                                                     HIP_R_16F,
+                                                     HIP_R_16F,
+                                                     HIP_R_16F,
+                                                     HIPBLAS_COMPUTE_32F,
+                                                     results));
+
+    std::vector<hipblaslt_ext::UserArguments> userArgs(problems);
+    groupedGemm.getDefaultValueForDeviceUserArguments(userArgs.data());
+    hipblaslt_ext::UserArguments* dUserArgs;
+    CHECK_HIP_ERROR(hipMalloc(&dUserArgs, problems * sizeof(hipblaslt_ext::UserArguments)));
+    CHECK_HIP_ERROR(hipMemcpy(dUserArgs,
+                              userArgs.data(),
+                              problems * sizeof(hipblaslt_ext::UserArguments),
+                              hipMemcpyHostToDevice));
+
+    float  groupedMs = std::numeric_limits<float>::max();
+    size_t supported = 0;
+    for(auto& result : results)
+    {
+        size_t required = 0;
+        if(groupedGemm.isAlgoSupported(result.algo, required) != HIPBLAS_STATUS_SUCCESS
+           || required > workspaceSize)
+            continue;
+        supported++;
+        CHECK_HIPBLASLT_ERROR(groupedGemm.initialize(result.algo, dWorkspace));
+        groupedMs = std::min(groupedMs, timeMs(stream, iters, [&]() {
+                                 CHECK_HIPBLASLT_ERROR(groupedGemm.run(dUserArgs, stream));
+                             }));
+    }
+
+    std::cout << problems << " problems, sizes in [1, " << maxSize << "], " << iters
+              << " iterations" << std::endl;
+    std::cout << "batchedTinyGemm: " << tinyMs << " ms, " << flops / tinyMs / 1e6 << " Gflops"
+              << std::endl;
+    if(supported)
+        std::cout << "GroupedGemm:     " << groupedMs << " ms, " << flops / groupedMs / 1e6
+                  << " Gflops (best of " << supported << " solutions)" << std::endl;
+    else
+        std::cout << "GroupedGemm:     no supported solution" << std::endl;
+
+    CHECK_HIP_ERROR(hipFree(dUserArgs));
+    CHECK_HIP_ERROR(hipFree(dWorkspace));
+    CHECK_HIP_ERROR(hipFree(dTiny));
+    CHECK_HIP_ERROR(hipFree(da));
+    CHECK_HIP_ERROR(hipFree(db));
+    CHECK_HIP_ERROR(hipFree(dd));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return EXIT_SUCCESS;
+}
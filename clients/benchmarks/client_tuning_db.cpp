@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Converts a HIPBLASLT_TUNING_OVERRIDE_FILE text file into the binary tuning
+// database format. The output can be set as HIPBLASLT_TUNING_OVERRIDE_FILE
+// directly; the library maps it read-only and looks entries up in place.
+
+#include "tuning_database.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+void printUsage(char* programName)
+{
+    std::cout << "Usage: " << programName << " <options>\n"
+              << "options:\n"
+              << "\t-h, --help\t\t\tShow this help message\n"
+              << "\t--input\t\t\t\tText override file to convert\n"
+              << "\t--output\t\t\tBinary tuning database to write\n"
+              << "\t--info\t\t\t\tPrint the header of an existing binary tuning database\n";
+}
+
+int parseArgs(int argc, char** argv, std::string& input, std::string& output, std::string& info)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if((arg == "-h") || (arg == "--help"))
+        {
+            return EXIT_FAILURE;
+        }
+        else if(i + 1 >= argc)
+        {
+            std::cerr << "missing value for " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        else if(arg == "--input")
+        {
+            input = argv[++i];
+        }
+        else if(arg == "--output")
+        {
+            output = argv[++i];
+        }
+        else if(arg == "--info")
+        {
+            info = argv[++i];
+        }
+        else
+        {
+            std::cerr << "error with " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return (!info.empty() || (!input.empty() && !output.empty())) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char** argv)
+{
+    std::string input, output, info;
+
+    if(parseArgs(argc, argv, input, output, info))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if(!info.empty())
+    {
+        TuningDatabase database;
+        if(!database.open(info))
+        {
+            std::cerr << info << " is not a valid tuning database" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Git Version: " << database.gitVersion() << "\n"
+                  << "entries: " << database.size() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int64_t count = writeTuningDatabase(input, output);
+    if(count < 0)
+    {
+        std::cerr << "failed to convert " << input << " to " << output << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "wrote " << count << " entries to " << output << std::endl;
+    return EXIT_SUCCESS;
+}
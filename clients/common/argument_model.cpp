@@ -78,4 +78,55 @@ void ArgumentModel_log_frequencies(hipblaslt_internal_ostream& name_line,
 
     name_line << ",median-MCLK";
     val_line << "," << frequency_monitor.getMedianMEMCLK();
+
+    name_line << ",lowest-min-freq";
+    val_line << "," << frequency_monitor.getLowestMinimumSYSCLK();
+
+    name_line << ",min-MCLK";
+    val_line << "," << frequency_monitor.getMinimumMEMCLK();
+
+    name_line << ",avg-power";
+    val_line << "," << frequency_monitor.getAveragePower();
+
+    name_line << ",min-power";
+    val_line << "," << frequency_monitor.getMinimumPower();
+}
+
+double ArgumentModel_clock_normalization()
+{
+    FrequencyMonitor& frequency_monitor = getFrequencyMonitor();
+    if(!frequency_monitor.enabled())
+        return 0.0;
+
+    double peak   = frequency_monitor.getPeakSYSCLK();
+    double lowest = frequency_monitor.getLowestAverageSYSCLK();
+    return peak > 0 && lowest > 0 ? peak / lowest : 0.0;
+}
+
+bool ArgumentModel_below_min_sclk()
+{
+    return getFrequencyMonitor().belowMinSYSCLK();
+}
+
+static TensileLite::Client::TimingStatistics timing_statistics;
+
+void ArgumentModel_set_timing_statistics(const TensileLite::Client::TimingStatistics& stats)
+{
+    timing_statistics = stats;
+}
+
+void ArgumentModel_log_timing_statistics(hipblaslt_internal_ostream& name_line,
+                                         hipblaslt_internal_ostream& val_line,
+                                         double                      flush_us)
+{
+    if(!timing_statistics.samples)
+        return;
+
+    flush_us = flush_us > 0 ? flush_us : 0;
+    name_line << ",p90-us,p99-us,ci-low-us,ci-high-us,timed-calls,outliers";
+    val_line << "," << timing_statistics.p90 - flush_us << "," << timing_statistics.p99 - flush_us
+             << "," << timing_statistics.ciLow - flush_us << ","
+             << timing_statistics.ciHigh - flush_us << ","
+             << timing_statistics.samples + timing_statistics.outliers << ","
+             << timing_statistics.outliers;
 }
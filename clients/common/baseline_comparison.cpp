@@ -0,0 +1,415 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "baseline_comparison.hpp"
+#include "hipblaslt_ostream.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct ResultLine
+    {
+        int         index;
+        std::string names; // argument columns
+        std::string values;
+        double      us;
+    };
+
+    struct Problem
+    {
+        std::string         names;
+        std::string         values;
+        std::vector<double> baseline;
+        std::vector<double> current;
+    };
+
+    struct Comparison
+    {
+        std::string   baseline;
+        double        threshold = 0;
+        int           samples   = 1;
+        std::ofstream results;
+        std::string   resultsNames;
+        bool          enabled = false;
+
+        std::map<std::string, size_t> index;
+        std::vector<Problem>          problems;
+        std::map<std::string, double> pending;
+
+        Problem& problem(const ResultLine& line)
+        {
+            auto key = line.names + "\n" + line.values;
+            auto it  = index.find(key);
+            if(it == index.end())
+            {
+                it = index.emplace(key, problems.size()).first;
+                problems.push_back({line.names, line.values, {}, {}});
+            }
+            return problems[it->second];
+        }
+    };
+
+    Comparison& comparison()
+    {
+        static Comparison c;
+        return c;
+    }
+
+    std::vector<std::string> split(const std::string& line)
+    {
+        std::vector<std::string> fields;
+        size_t                   begin = 0;
+        while(true)
+        {
+            size_t end   = line.find(',', begin);
+            auto   field = line.substr(begin, end == std::string::npos ? end : end - begin);
+            size_t first = field.find_first_not_of(" \t\r");
+            size_t last  = field.find_last_not_of(" \t\r");
+            fields.push_back(first == std::string::npos ? ""
+                                                        : field.substr(first, last - first + 1));
+            if(end == std::string::npos)
+                return fields;
+            begin = end + 1;
+        }
+    }
+
+    // The index of "[0]:transA,..." name lines, 0 for the lines of a results file
+    int stripIndex(std::string& names)
+    {
+        size_t colon = names.find("]:");
+        if(names.empty() || names[0] != '[' || colon == std::string::npos)
+            return 0;
+        int index = std::atoi(names.c_str() + 1);
+        names     = names.substr(colon + 2);
+        return index;
+    }
+
+    // Measured columns, everything else identifies the problem
+    bool isResultColumn(const std::string& name)
+    {
+        static const std::set<std::string> columns = {"hipblaslt-Gflops",
+                                                      "clk-normalized-Gflops",
+                                                      "hipblaslt-GB/s",
+                                                      "us",
+                                                      "p90-us",
+                                                      "p99-us",
+                                                      "ci-low-us",
+                                                      "ci-high-us",
+                                                      "timed-calls",
+                                                      "outliers",
+                                                      "CPU-Gflops",
+                                                      "CPU-us",
+                                                      "norm_error",
+                                                      "atol",
+                                                      "rtol",
+                                                      "soulution_index"};
+        return columns.count(name) || name.find("freq") != std::string::npos
+               || name.find("MCLK") != std::string::npos
+               || name.find("power") != std::string::npos;
+    }
+
+    bool isNameLine(std::string names)
+    {
+        stripIndex(names);
+        auto fields = split(names);
+        return std::find(fields.begin(), fields.end(), "us") != fields.end();
+    }
+
+    bool parse(std::string names, const std::string& values, ResultLine& line)
+    {
+        line.index     = stripIndex(names);
+        auto nameList  = split(names);
+        auto valueList = split(values);
+        if(nameList.size() != valueList.size())
+            return false;
+
+        line.names.clear();
+        line.values.clear();
+        bool found = false;
+        for(size_t i = 0; i < nameList.size(); i++)
+        {
+            if(nameList[i] == "us")
+            {
+                char* end;
+                line.us = std::strtod(valueList[i].c_str(), &end);
+                found   = end != valueList[i].c_str() && line.us > 0;
+            }
+            if(isResultColumn(nameList[i]))
+                continue;
+            auto delim = line.names.empty() ? "" : ",";
+            line.names += delim + nameList[i];
+            line.values += delim + valueList[i];
+        }
+        return found;
+    }
+
+    // Result lines of a run follow their name line, the rows of a results file share
+    // one. The solutions of one measurement count from [0] up, the winner repeats one.
+    void loadBaseline(Comparison& c)
+    {
+        std::ifstream in(c.baseline);
+        if(!in)
+            throw std::invalid_argument("Cannot open baseline file " + c.baseline);
+
+        std::string names;
+        std::string text;
+        bool        winner = false;
+        Problem*    last   = nullptr;
+        while(std::getline(in, text))
+        {
+            if(text.rfind("Winner:", 0) == 0)
+            {
+                winner = true;
+                continue;
+            }
+            if(isNameLine(text))
+            {
+                names = text;
+                continue;
+            }
+
+            ResultLine line;
+            if(names.empty() || !parse(names, text, line))
+                continue;
+            if(std::exchange(winner, false))
+                continue;
+
+            auto& problem = c.problem(line);
+            if(line.index == 0 || &problem != last || problem.baseline.empty())
+                problem.baseline.push_back(line.us);
+            else
+                problem.baseline.back() = std::min(problem.baseline.back(), line.us);
+            last = &problem;
+        }
+    }
+
+    double mean(const std::vector<double>& samples)
+    {
+        double sum = 0;
+        for(double s : samples)
+            sum += s;
+        return sum / samples.size();
+    }
+
+    double variance(const std::vector<double>& samples, double m)
+    {
+        double sum = 0;
+        for(double s : samples)
+            sum += (s - m) * (s - m);
+        return sum / (samples.size() - 1);
+    }
+
+    // Continued fraction of the regularized incomplete beta function
+    double betaFraction(double a, double b, double x)
+    {
+        constexpr double tiny = 1e-300;
+        double           c    = 1;
+        double           d    = 1 - (a + b) * x / (a + 1);
+        d                     = 1 / (std::fabs(d) < tiny ? tiny : d);
+        double h              = d;
+        for(int m = 1; m <= 200; m++)
+        {
+            for(int step = 0; step < 2; step++)
+            {
+                double aa = step == 0
+                                ? m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m))
+                                : -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+                d = 1 + aa * d;
+                c = 1 + aa / c;
+                d = 1 / (std::fabs(d) < tiny ? tiny : d);
+                c = std::fabs(c) < tiny ? tiny : c;
+                h *= d * c;
+                if(step == 1 && std::fabs(d * c - 1) < 1e-12)
+                    return h;
+            }
+        }
+        return h;
+    }
+
+    double incompleteBeta(double a, double b, double x)
+    {
+        if(x <= 0 || x >= 1)
+            return x <= 0 ? 0 : 1;
+        double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b)
+                                + a * std::log(x) + b * std::log(1 - x));
+        if(x < (a + 1) / (a + b + 2))
+            return front * betaFraction(a, b, x) / a;
+        return 1 - front * betaFraction(b, a, 1 - x) / b;
+    }
+
+    // Two-sided p-value of Welch's t-test, NaN without two samples on each side
+    double welchPValue(const std::vector<double>& a, const std::vector<double>& b)
+    {
+        if(a.size() < 2 || b.size() < 2)
+            return std::numeric_limits<double>::quiet_NaN();
+        double ma = mean(a), mb = mean(b);
+        double va = variance(a, ma) / a.size(), vb = variance(b, mb) / b.size();
+        if(va + vb == 0)
+            return ma == mb ? 1 : 0;
+        double t  = (ma - mb) / std::sqrt(va + vb);
+        double df = (va + vb) * (va + vb)
+                    / (va * va / (a.size() - 1) + vb * vb / (b.size() - 1));
+        return incompleteBeta(df / 2, 0.5, df / (df + t * t));
+    }
+}
+
+void BaselineComparison_configure(const std::string& baseline,
+                                  const std::string& results,
+                                  double             threshold_percent,
+                                  int                samples)
+{
+    auto& c     = comparison();
+    c.baseline  = baseline;
+    c.threshold = threshold_percent;
+    c.samples   = std::max(samples, 1);
+    c.enabled   = !baseline.empty() || !results.empty();
+    if(!results.empty())
+    {
+        c.results.open(results);
+        if(!c.results)
+            throw std::invalid_argument("Cannot open results file " + results);
+    }
+    if(!baseline.empty())
+        loadBaseline(c);
+}
+
+int BaselineComparison_samples()
+{
+    return comparison().samples;
+}
+
+void BaselineComparison_record(const std::string& name_line, const std::string& val_line)
+{
+    auto& c = comparison();
+    if(!c.enabled)
+        return;
+
+    ResultLine line;
+    if(!parse(name_line, val_line, line))
+        return;
+    auto key = line.names + "\n" + line.values;
+    auto it  = c.pending.find(key);
+    if(it == c.pending.end())
+        c.pending.emplace(key, line.us);
+    else
+        it->second = std::min(it->second, line.us);
+}
+
+void BaselineComparison_end_sample()
+{
+    auto& c = comparison();
+    for(auto& [key, us] : c.pending)
+    {
+        size_t     split = key.find('\n');
+        ResultLine line{0, key.substr(0, split), key.substr(split + 1), us};
+        c.problem(line).current.push_back(us);
+
+        if(c.results.is_open())
+        {
+            if(line.names != c.resultsNames)
+            {
+                c.results << line.names << ",us\n";
+                c.resultsNames = line.names;
+            }
+            c.results << line.values << "," << us << std::endl;
+        }
+    }
+    c.pending.clear();
+}
+
+int BaselineComparison_report()
+{
+    auto& c = comparison();
+    if(c.baseline.empty())
+        return 0;
+
+    constexpr double alpha = 0.05;
+
+    size_t      compared = 0, regressions = 0, improvements = 0, missing = 0, added = 0;
+    std::string names;
+    hipblaslt_cout << "\nBaseline " << c.baseline << ", threshold " << c.threshold
+                   << "%, significance level " << alpha << std::endl;
+    for(auto& problem : c.problems)
+    {
+        if(problem.current.empty() || problem.baseline.empty())
+        {
+            missing += problem.current.empty();
+            added += problem.baseline.empty();
+            continue;
+        }
+
+        double baselineUs = mean(problem.baseline);
+        double us         = mean(problem.current);
+        double p          = welchPValue(problem.baseline, problem.current);
+        bool   confident  = std::isnan(p) || p < alpha;
+        double change     = (us / baselineUs - 1) * 100;
+
+        const char* verdict = "same";
+        if(confident && change > c.threshold)
+        {
+            verdict = "REGRESSION";
+            regressions++;
+        }
+        else if(confident && change < -c.threshold)
+        {
+            verdict = "improvement";
+            improvements++;
+        }
+        compared++;
+
+        if(problem.names != names)
+        {
+            names = problem.names;
+            hipblaslt_cout << names << ",baseline-us,baseline-samples,us,samples,speedup,p-value,"
+                           << "result" << std::endl;
+        }
+        hipblaslt_cout << problem.values << "," << baselineUs << "," << problem.baseline.size()
+                       << "," << us << "," << problem.current.size() << ","
+                       << baselineUs / us << ",";
+        if(std::isnan(p))
+            hipblaslt_cout << "n/a";
+        else
+            hipblaslt_cout << p;
+        hipblaslt_cout << "," << verdict << std::endl;
+    }
+
+    hipblaslt_cout << compared << " problems compared, " << regressions << " regressions, "
+                   << improvements << " improvements, " << missing
+                   << " baseline problems not run, " << added << " problems not in the baseline"
+                   << std::endl;
+    return regressions ? 1 : 0;
+}
@@ -25,10 +25,12 @@
  *******************************************************************************/
 #include "cblas_interface.hpp"
 #include "datatype_interface.hpp"
+#include "hipblaslt_math.hpp"
 #include "hipblaslt_vector.hpp"
 #include "utility.hpp"
 #include <bitset>
 #include <iostream>
+#include <memory>
 #include <omp.h>
 
 CBLAS_TRANSPOSE HIPOperationToCBLASTanspose(hipblasOperation_t trans)
@@ -48,10 +50,14 @@ template <typename T>
 class customVector
 {
 public:
+    // Zeroed by all threads, so the pages are first touched by the threads converting them
     void initialize(size_t size)
     {
-        m_data.resize(size);
-        m_pointer = m_data.data();
+        m_data.reset(new T[size]);
+        m_pointer = m_data.get();
+#pragma omp parallel for
+        for(size_t i = 0; i < size; i++)
+            m_data[i] = T(0);
     }
     void initialize(const void* buffer)
     {
@@ -74,8 +80,8 @@ public:
     }
 
 private:
-    std::vector<T> m_data;
-    void*          m_pointer = nullptr;
+    std::unique_ptr<T[]> m_data;
+    void*                m_pointer = nullptr;
 };
 
 template <typename TD, typename TcCast, typename Tc>
@@ -87,11 +93,13 @@ void sat_cast_mul(TD* dst, customVector<TcCast>& src, Tc scale, size_t size)
     {
         if(scale != 1)
         {
+#pragma omp parallel for
             for(size_t i = 0; i < size; i++)
                 dst[i] = saturate_cast<TD>(src[i] * scale);
         }
         else
         {
+#pragma omp parallel for
             for(size_t i = 0; i < size; i++)
                 dst[i] = saturate_cast<TD>(src[i]);
         }
@@ -157,10 +165,7 @@ void cast_mul(customVector<TcCast>& dst, const TiA* src, size_t size)
                      || !(std::is_same<TiA, hipblaslt_bf8>::value
                           || std::is_same<TiA, hipblaslt_f8>::value))
 #endif
-            for(size_t i = 0; i < size; i++)
-            {
-                dst[i] = static_cast<TcCast>(src[i]);
-            }
+            host_convert<TcCast>(dst, src, size);
     }
 }
 
@@ -233,20 +238,20 @@ void cast_mul(customVector<TcCast>& dst,
             {
                 if(transA)
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i % m] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(A[i]) * scaleA * AlphaVec[i % m];
+                        dst[i]      = host_cast<TcCast>(A[i]) * scaleA * AlphaVec[i % m];
                     }
                 }
                 else
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i / k] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(A[i]) * scaleA * AlphaVec[i / k];
+                        dst[i]      = host_cast<TcCast>(A[i]) * scaleA * AlphaVec[i / k];
                     }
                 }
             }
@@ -254,20 +259,20 @@ void cast_mul(customVector<TcCast>& dst,
             {
                 if(transA)
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i % m] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(A[i] * scaleA);
+                        dst[i]      = static_cast<TcCast>(host_value(A[i]) * scaleA);
                     }
                 }
                 else
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i / k] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(A[i] * scaleA);
+                        dst[i]      = static_cast<TcCast>(host_value(A[i]) * scaleA);
                     }
                 }
             }
@@ -438,22 +443,22 @@ void cast_mul_with_Tci(customVector<TcCast>& dst,
             {
                 if(transA)
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i % m] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(static_cast<TciACast>(A[i] * scaleA))
-                                 * AlphaVec[i % m];
+                        auto Tci    = static_cast<TciACast>(host_value(A[i]) * scaleA);
+                        dst[i]      = host_cast<TcCast>(Tci) * AlphaVec[i % m];
                     }
                 }
                 else
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i / k] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(static_cast<TciACast>(A[i] * scaleA))
-                                 * AlphaVec[i / k];
+                        auto Tci    = static_cast<TciACast>(host_value(A[i]) * scaleA);
+                        dst[i]      = host_cast<TcCast>(Tci) * AlphaVec[i / k];
                     }
                 }
             }
@@ -461,20 +466,22 @@ void cast_mul_with_Tci(customVector<TcCast>& dst,
             {
                 if(transA)
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i % m] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(static_cast<TciACast>(A[i] * scaleA));
+                        auto Tci    = static_cast<TciACast>(host_value(A[i]) * scaleA);
+                        dst[i]      = host_cast<TcCast>(Tci);
                     }
                 }
                 else
                 {
-#pragma omp for
+#pragma omp parallel for
                     for(size_t i = 0; i < size; i++)
                     {
                         auto scaleA = isScaleAVec ? scaleAVec[i / k] : scaleAVec[0];
-                        dst[i]      = static_cast<TcCast>(static_cast<TciACast>(A[i] * scaleA));
+                        auto Tci    = static_cast<TciACast>(host_value(A[i]) * scaleA);
+                        dst[i]      = host_cast<TcCast>(Tci);
                     }
                 }
             }
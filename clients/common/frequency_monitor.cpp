@@ -96,8 +96,9 @@ inline std::string concatenate(Ts&&... vals)
 class FrequencyMonitorImp : public FrequencyMonitor
 {
 public:
-    const double cHzToMHz = 0.000001;
-    const double cMhzToHz = 1000000;
+    const double cHzToMHz   = 0.000001;
+    const double cMhzToHz   = 1000000;
+    const double cMicroWToW = 0.000001;
 
     // deleting copy constructor
     FrequencyMonitorImp(const FrequencyMonitorImp& obj) = delete;
@@ -108,7 +109,7 @@ public:
     {
         static const char* env1 = getenv("HIPBLASLT_BENCH_FREQ");
         static const char* env2 = getenv("HIPBLASLT_BENCH_FREQ_ALL");
-        return env1 != nullptr || (env2 != nullptr && m_isMultiXCDSupported);
+        return env1 != nullptr || (env2 != nullptr && m_isMultiXCDSupported) || m_minSYSCLK > 0;
     }
 
     bool detailedReport()
@@ -144,6 +145,14 @@ public:
             m_XCDCount = 1;
         }
 #endif
+
+        // The supported levels are sorted, the last one is the peak
+        rsmi_frequencies_t freq;
+        m_peakSYSCLK = 0;
+        if(rsmi_dev_gpu_clk_freq_get(m_smiDeviceIndex, RSMI_CLK_TYPE_SYS, &freq)
+               == RSMI_STATUS_SUCCESS
+           && freq.num_supported > 0)
+            m_peakSYSCLK = freq.frequency[freq.num_supported - 1];
     }
 
     void start()
@@ -253,7 +262,66 @@ public:
         return medianValueMHz(m_MEMCLK_array);
     }
 
+    double getMinimumMEMCLK()
+    {
+        return minimumValueMHz(m_MEMCLK_array);
+    }
+
+    double getLowestMinimumSYSCLK()
+    {
+        double lowest = minimumValueMHz(m_SYSCLK_array[0]);
+        for(int i = 1; i < m_XCDCount; i++)
+        {
+            double minimum = minimumValueMHz(m_SYSCLK_array[i]);
+            if(minimum <= 0)
+                continue;
+            lowest = min(lowest, minimum);
+        }
+        return lowest;
+    }
+
+    double getPeakSYSCLK()
+    {
+        return m_peakSYSCLK * cHzToMHz;
+    }
+
+    // Watts
+    double getAveragePower()
+    {
+        assertNotActive();
+        return m_power_array.empty() ? 0.0 : m_power_sum / m_power_array.size() * cMicroWToW;
+    }
+
+    double getMinimumPower()
+    {
+        assertNotActive();
+        return m_power_array.empty()
+                   ? 0.0
+                   : *std::min_element(m_power_array.begin(), m_power_array.end()) * cMicroWToW;
+    }
+
+    void setMinSYSCLK(double minMHz)
+    {
+        m_minSYSCLK = minMHz;
+    }
+
+    bool belowMinSYSCLK()
+    {
+        if(m_minSYSCLK <= 0)
+            return false;
+        double lowest = getLowestAverageSYSCLK();
+        return lowest > 0 && lowest < m_minSYSCLK;
+    }
+
 private:
+    double minimumValueMHz(const std::vector<uint64_t>& data)
+    {
+        assertNotActive();
+        if(data.empty())
+            return 0.0;
+        return *std::min_element(data.begin(), data.end()) * cHzToMHz;
+    }
+
     void initThread()
     {
         m_stop = false;
@@ -339,6 +407,22 @@ private:
                 m_MEMCLK_array.push_back(freq.frequency[freq.current]);
             }
 
+            uint64_t power   = 0;
+            auto     status3 = rsmi_dev_power_ave_get(m_smiDeviceIndex, 0, &power);
+#if rocm_smi_VERSION_MAJOR >= 7
+            // The average power sensor is not exposed on every device
+            if(status3 != RSMI_STATUS_SUCCESS && status1 == RSMI_STATUS_SUCCESS)
+            {
+                power   = uint64_t(gpuMetrics.average_socket_power) * 1000000;
+                status3 = RSMI_STATUS_SUCCESS;
+            }
+#endif
+            if(status3 == RSMI_STATUS_SUCCESS && power > 0)
+            {
+                m_power_sum += power;
+                m_power_array.push_back(power);
+            }
+
             // collect freq every 50ms regardless of success
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
@@ -363,6 +447,8 @@ private:
         m_SYSCLK_array = std::vector<std::vector<uint64_t>>(m_XCDCount, std::vector<uint64_t>{});
         m_MEMCLK_sum   = 0;
         m_MEMCLK_array.clear();
+        m_power_sum = 0;
+        m_power_array.clear();
     }
 
     void wait()
@@ -459,6 +545,10 @@ private:
     std::vector<std::vector<uint64_t>> m_SYSCLK_array;
     uint64_t                           m_MEMCLK_sum;
     std::vector<uint64_t>              m_MEMCLK_array;
+    uint64_t                           m_power_sum = 0;
+    std::vector<uint64_t>              m_power_array;
+    uint64_t                           m_peakSYSCLK = 0;
+    double                             m_minSYSCLK  = 0;
 
 #else // WIN32
 
@@ -514,6 +604,38 @@ public:
     {
         return 0.0;
     }
+
+    double getMinimumMEMCLK()
+    {
+        return 0.0;
+    }
+
+    double getLowestMinimumSYSCLK()
+    {
+        return 0.0;
+    }
+
+    double getPeakSYSCLK()
+    {
+        return 0.0;
+    }
+
+    double getAveragePower()
+    {
+        return 0.0;
+    }
+
+    double getMinimumPower()
+    {
+        return 0.0;
+    }
+
+    void setMinSYSCLK(double minMHz) {}
+
+    bool belowMinSYSCLK()
+    {
+        return false;
+    }
 #endif
 };
 
@@ -101,24 +101,40 @@ void Arguments::init()
     transA = '*';
     transB = '*';
 
-    activation_type   = hipblaslt_activation_type::none;
-    activation_arg1   = 0.0f;
-    activation_arg2   = std::numeric_limits<float>::infinity();
-    bias_type         = HIPBLASLT_DATATYPE_INVALID;
-    bias_source       = hipblaslt_bias_source::d;
-    bias_vector       = false;
-    scaleA            = hipblaslt_scaling_format::none;
-    scaleB            = hipblaslt_scaling_format::none;
-    scaleC            = false;
-    scaleD            = false;
-    scaleE            = false;
-    scaleAlpha_vector = false;
-    grouped_gemm      = 0;
-    c_equal_d         = false;
-    HMM               = false;
-    use_e             = false;
-    gradient          = false;
-    norm_check_assert = true;
+    activation_type     = hipblaslt_activation_type::none;
+    activation_arg1     = 0.0f;
+    activation_arg2     = std::numeric_limits<float>::infinity();
+    bias_type           = HIPBLASLT_DATATYPE_INVALID;
+    bias_source         = hipblaslt_bias_source::d;
+    bias_vector         = false;
+    scaleA              = hipblaslt_scaling_format::none;
+    scaleB              = hipblaslt_scaling_format::none;
+    scaleC              = false;
+    scaleD              = false;
+    scaleE              = false;
+    scaleAlpha_vector   = false;
+    pointer_mode_device = false;
+    grouped_gemm        = 0;
+    c_equal_d           = false;
+    HMM                 = false;
+    use_e               = false;
+    gradient            = false;
+    norm_check_assert   = true;
+    gpu_reference       = false;
+
+    validation         = 0;
+    validation_samples = 4096;
+
+    d2_type             = HIPBLASLT_DATATYPE_INVALID;
+    scaleD_vector       = 0;
+    aux_type            = HIPBLASLT_DATATYPE_INVALID;
+    aux_amax            = false;
+    bgrad_deterministic = false;
+    residual_position   = 0;
+    dropout             = 0;
+    amax_history        = 0;
+    b_quant_group       = 0;
+    b_quant_int4        = false;
 
     use_ext                  = false;
     use_ext_setproblem       = false;
@@ -127,6 +143,9 @@ void Arguments::init()
     rotating                 = 0;
     use_gpu_timer            = false;
     skip_slow_solution_ratio = 0.0;
+    timing_statistics        = false;
+    ci_target                = 0.0;
+    max_iters                = 10000;
     // tuning
     gsu_vector[0] = 0;
     for(int32_t i = 1; i < MAX_SUPPORTED_NUM_PROBLEMS; i++)
@@ -139,8 +158,9 @@ void Arguments::init()
         wgm_vector[i] = -1;
     }
 
-    print_solution_found = false;
-    flush                = false;
+    print_solution_found  = false;
+    print_selection_trace = false;
+    flush                 = false;
 }
 
 // Function to print Arguments out to stream in YAML format
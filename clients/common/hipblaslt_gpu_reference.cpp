@@ -0,0 +1,732 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "hipblaslt_gpu_reference.hpp"
+#include "hipblaslt_ostream.hpp"
+#include <hipblaslt/hipblaslt_xfloat32.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int tile = 16;
+
+    // The atol and rtol grid of allclose_check_general
+    constexpr int             allclose_count                = 5;
+    constexpr double          host_tols[allclose_count]     = {1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
+    __constant__ const double allclose_tols[allclose_count] = {1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
+
+    // Slot 0 counts the unit check failures, the others the allclose grid
+    constexpr int count_slots = 1 + allclose_count * allclose_count;
+
+    template <typename Count>
+    __host__ __device__ void
+        count_failures(double r, double d, double tol, const double* tols, Count* counts)
+    {
+        double err = fabs(d - r);
+        counts[0] += tol == 0 ? !(d == r) : !(err <= tol);
+        for(int a = 0; a < allclose_count; a++)
+            for(int t = 0; t < allclose_count; t++)
+                counts[1 + a * allclose_count + t] += !(err <= tols[a] + fabs(tols[t] * d));
+    }
+
+    // Smallest atol first, then the smallest rtol, as allclose_check_general picks them
+    void pick_allclose(reference_error& error, const unsigned long long* counts)
+    {
+        error.mismatches = int64_t(counts[0]);
+        error.atol       = 1.0;
+        error.rtol       = 1.0;
+        for(int a = 0; a < allclose_count && error.atol == 1.0; a++)
+            for(int t = 0; t < allclose_count; t++)
+                if(counts[1 + a * allclose_count + t] == 0)
+                {
+                    error.atol = host_tols[a];
+                    error.rtol = host_tols[t];
+                    break;
+                }
+    }
+
+    template <typename T>
+    __host__ __device__ T load_value(const void* p, size_t idx, hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return T(static_cast<const float*>(p)[idx]);
+        case HIP_R_64F:
+            return T(static_cast<const double*>(p)[idx]);
+        case HIP_R_16F:
+            return T(float(static_cast<const hipblasLtHalf*>(p)[idx]));
+        case HIP_R_16BF:
+            return T(float(static_cast<const hip_bfloat16*>(p)[idx]));
+        case HIP_R_8F_E4M3_FNUZ:
+            return T(float(static_cast<const hipblaslt_f8_fnuz*>(p)[idx]));
+        case HIP_R_8F_E5M2_FNUZ:
+            return T(float(static_cast<const hipblaslt_bf8_fnuz*>(p)[idx]));
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+            return T(float(static_cast<const hipblaslt_f8*>(p)[idx]));
+        case HIP_R_8F_E5M2:
+            return T(float(static_cast<const hipblaslt_bf8*>(p)[idx]));
+#endif
+        case HIP_R_32I:
+            return T(static_cast<const int32_t*>(p)[idx]);
+        case HIP_R_8I:
+            return T(static_cast<const hipblasLtInt8*>(p)[idx]);
+        default:
+            return T(0);
+        }
+    }
+
+    // Same conversions as saturate_cast_to_type on the host
+    template <typename T>
+    __host__ __device__ void store_value(void* p, size_t idx, hipDataType type, T v)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            static_cast<float*>(p)[idx] = static_cast<float>(v);
+            return;
+        case HIP_R_64F:
+            static_cast<double*>(p)[idx] = static_cast<double>(v);
+            return;
+        case HIP_R_16F:
+            static_cast<hipblasLtHalf*>(p)[idx] = static_cast<hipblasLtHalf>(v);
+            return;
+        case HIP_R_16BF:
+            static_cast<hip_bfloat16*>(p)[idx] = static_cast<hip_bfloat16>(v);
+            return;
+        case HIP_R_8F_E4M3_FNUZ:
+            static_cast<hipblaslt_f8_fnuz*>(p)[idx] = static_cast<hipblaslt_f8_fnuz>(v);
+            return;
+        case HIP_R_8F_E5M2_FNUZ:
+            static_cast<hipblaslt_bf8_fnuz*>(p)[idx] = static_cast<hipblaslt_bf8_fnuz>(v);
+            return;
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+            static_cast<hipblaslt_f8*>(p)[idx] = static_cast<hipblaslt_f8>(v);
+            return;
+        case HIP_R_8F_E5M2:
+            static_cast<hipblaslt_bf8*>(p)[idx] = static_cast<hipblaslt_bf8>(v);
+            return;
+#endif
+        case HIP_R_32I:
+            static_cast<int32_t*>(p)[idx] = static_cast<int32_t>(v);
+            return;
+        case HIP_R_8I:
+        {
+            T r                                 = nearbyint(v); // round to even
+            static_cast<hipblasLtInt8*>(p)[idx] = hipblasLtInt8(r > T(127)    ? T(127)
+                                                                : r < T(-128) ? T(-128)
+                                                                              : r);
+            return;
+        }
+        default:
+            return;
+        }
+    }
+
+    // Round a scaled input to the narrower compute input type, as cast_mul_with_Tci does
+    template <typename T>
+    __host__ __device__ T round_to_type(T v, hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return T(float(static_cast<hipblasLtHalf>(v)));
+        case HIP_R_16BF:
+            return T(float(static_cast<hip_bfloat16>(v)));
+        case HIP_R_8F_E4M3_FNUZ:
+            return T(float(static_cast<hipblaslt_f8_fnuz>(v)));
+        case HIP_R_8F_E5M2_FNUZ:
+            return T(float(static_cast<hipblaslt_bf8_fnuz>(v)));
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+            return T(float(static_cast<hipblaslt_f8>(v)));
+        case HIP_R_8F_E5M2:
+            return T(float(static_cast<hipblaslt_bf8>(v)));
+#endif
+        default:
+            return v;
+        }
+    }
+
+    template <typename T>
+    __host__ __device__ T load_scale(const void* p, size_t idx, hipDataType type)
+    {
+        return p ? load_value<T>(p, idx, type) : T(1);
+    }
+
+    // op(A)(i, l) with scaleA and scaleAlphaVec folded in, the order of cast_mul_with_Tci
+    template <typename T>
+    __host__ __device__ T load_a(const reference_gemm& p, int64_t batch, int64_t i, int64_t l)
+    {
+        size_t idx = p.transA == HIPBLAS_OP_N ? i + l * p.lda : l + i * p.lda;
+        T      v   = load_value<T>(p.A, batch * p.stride_a + idx, p.TiA);
+        if(p.tf32)
+            v = T(float(hipblasLtXfloat32(float(v))));
+        v = round_to_type(v * load_scale<T>(p.scaleA, p.isScaleAVec ? i : 0, p.Tc), p.TciA);
+        return v * load_scale<T>(p.scaleAlphaVec, i, p.Tc);
+    }
+
+    template <typename T>
+    __host__ __device__ T load_b(const reference_gemm& p, int64_t batch, int64_t l, int64_t j)
+    {
+        size_t idx = p.transB == HIPBLAS_OP_N ? l + j * p.ldb : j + l * p.ldb;
+        T      v   = load_value<T>(p.B, batch * p.stride_b + idx, p.TiB);
+        if(p.tf32)
+            v = T(float(hipblasLtXfloat32(float(v))));
+        return round_to_type(v * load_scale<T>(p.scaleB, p.isScaleBVec ? j : 0, p.Tc), p.TciB);
+    }
+
+    // Matches _relu and _gelu of testing_matmul.hpp, gelu is evaluated in float there as well
+    template <typename T>
+    __host__ __device__ T activation(T v, hipblaslt_activation_type act)
+    {
+        switch(act)
+        {
+        case hipblaslt_activation_type::relu:
+            return v > T(0) ? v : T(0);
+        case hipblaslt_activation_type::gelu:
+        {
+            constexpr float k0 = 0.7978845608028654f;
+            constexpr float k1 = 0.044715f;
+            float           x  = float(v);
+            return T(0.5f * (x * (1.f + tanhf(k0 * (x * (1.f + k1 * (x * x)))))));
+        }
+        default:
+            return v;
+        }
+    }
+
+    // D(i, j) from the dot product of row i of op(A) and column j of op(B)
+    template <typename T>
+    __host__ __device__ T
+        epilogue(const reference_gemm& p, int64_t batch, int64_t i, int64_t j, T sum)
+    {
+        T v = T(p.alpha) * sum;
+        // BLAS semantics, C is not read when beta is 0
+        if(p.beta != 0)
+        {
+            T beta = T(p.beta) * load_scale<T>(p.scaleC, 0, p.Tc);
+            v += beta * load_value<T>(p.C, batch * p.stride_c + i + j * p.ldc, p.To);
+        }
+        if(p.bias)
+            v += load_value<T>(p.bias, i, p.Tbias);
+        return activation(v, p.activation) * load_scale<T>(p.scaleD, 0, p.Tc);
+    }
+
+    // D as the library stores it, rounded and saturated to To
+    template <typename T>
+    __host__ __device__ double round_to_output(T v, hipDataType To)
+    {
+        alignas(8) char element[8];
+        store_value(element, 0, To, v);
+        return load_value<double>(element, 0, To);
+    }
+
+    // The dot product of row i of op(A) and column j of op(B), staged through LDS a tile of K at
+    // a time. With Magnitude, also the sum of |op(A)(i, l) * op(B)(l, j)|.
+    template <typename T, bool Magnitude>
+    __device__ void tiled_dot(const reference_gemm& p,
+                              int64_t               batch,
+                              int64_t               i,
+                              int64_t               j,
+                              T (&As)[tile][tile + 1],
+                              T (&Bs)[tile][tile + 1],
+                              T& sum,
+                              T& mag)
+    {
+        sum = 0;
+        mag = 0;
+        for(int64_t l0 = 0; l0 < p.k; l0 += tile)
+        {
+            int64_t la                   = l0 + threadIdx.y;
+            int64_t lb                   = l0 + threadIdx.x;
+            As[threadIdx.y][threadIdx.x] = i < p.m && la < p.k ? load_a<T>(p, batch, i, la) : 0;
+            Bs[threadIdx.y][threadIdx.x] = j < p.n && lb < p.k ? load_b<T>(p, batch, lb, j) : 0;
+            __syncthreads();
+            for(int l = 0; l < tile; l++)
+            {
+                T ab = As[l][threadIdx.x] * Bs[threadIdx.y][l];
+                sum += ab;
+                if constexpr(Magnitude)
+                    mag += ab < T(0) ? -ab : ab;
+            }
+            __syncthreads();
+        }
+    }
+
+    // One thread per element of D
+    template <typename T>
+    __global__ void __launch_bounds__(tile * tile) gemm_reference_kernel(reference_gemm p)
+    {
+        __shared__ T As[tile][tile + 1];
+        __shared__ T Bs[tile][tile + 1];
+
+        int64_t i = int64_t(blockIdx.x) * tile + threadIdx.x;
+        int64_t j = int64_t(blockIdx.y) * tile + threadIdx.y;
+
+        for(int64_t batch = blockIdx.z; batch < p.batch_count; batch += gridDim.z)
+        {
+            T sum, mag;
+            tiled_dot<T, false>(p, batch, i, j, As, Bs, sum, mag);
+
+            if(i < p.m && j < p.n)
+            {
+                T v = epilogue(p, batch, i, j, sum);
+                store_value(p.D, batch * p.stride_d + i + j * p.ldd, p.To, v);
+            }
+        }
+    }
+
+    // Unit roundoff of a type, 0 for the integers and for no rounding at all
+    __host__ __device__ double unit_roundoff(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_64F:
+            return 0x1p-53;
+        case HIP_R_32F:
+            return 0x1p-24;
+        case HIP_R_16F:
+            return 0x1p-11;
+        case HIP_R_16BF:
+            return 0x1p-8;
+        case HIP_R_8F_E4M3_FNUZ:
+            return 0x1p-4;
+        case HIP_R_8F_E5M2_FNUZ:
+            return 0x1p-3;
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+            return 0x1p-4;
+        case HIP_R_8F_E5M2:
+            return 0x1p-3;
+#endif
+        default:
+            return 0;
+        }
+    }
+
+    // Spacing of the values of a type around 0, the rounding error of results that underflow
+    __host__ __device__ double zero_spacing(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_64F:
+            return 0x1p-1074;
+        case HIP_R_32F:
+            return 0x1p-149;
+        case HIP_R_16F:
+            return 0x1p-24;
+        case HIP_R_16BF:
+            return 0x1p-133;
+        case HIP_R_8F_E4M3_FNUZ:
+            return 0x1p-10;
+        case HIP_R_8F_E5M2_FNUZ:
+            return 0x1p-17;
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+            return 0x1p-9;
+        case HIP_R_8F_E5M2:
+            return 0x1p-16;
+#endif
+        default:
+            return 1;
+        }
+    }
+
+    /* Bound on |D(i, j) - ref(i, j)| for a library kernel accumulating in Tc and a reference
+     * accumulating in a type of unit roundoff u_ref, from mag = sum_l |op(A)(i, l) op(B)(l, j)|
+     * with the scales folded in:
+     *  - each of the two sums errs by up to k u mag,
+     *  - A and B rounded to TciA, TciB or xf32 may round differently, by up to an ulp each,
+     *  - the epilogue adds an ulp of each of its terms and gelu is at most 1.13-Lipschitz,
+     *  - and the two results are rounded to To independently.
+     */
+    __device__ double error_bound(const reference_gemm& p,
+                                  int64_t               batch,
+                                  int64_t               i,
+                                  int64_t               j,
+                                  double                sum,
+                                  double                mag,
+                                  double                r,
+                                  double                d,
+                                  double                u_ref)
+    {
+        constexpr double xf32_roundoff = 0x1p-11;
+
+        double u_acc = u_ref + unit_roundoff(p.Tc);
+        double u_in  = unit_roundoff(p.TciA) + unit_roundoff(p.TciB);
+        if(p.tf32)
+            u_in += 2 * xf32_roundoff;
+
+        double terms = fabs(p.alpha * sum);
+        if(p.beta != 0)
+            terms += fabs(p.beta * load_scale<double>(p.scaleC, 0, p.Tc)
+                          * load_value<double>(p.C, batch * p.stride_c + i + j * p.ldc, p.To));
+        if(p.bias)
+            terms += fabs(load_value<double>(p.bias, i, p.Tbias));
+
+        double pre       = (p.k * u_acc + u_in) * fabs(p.alpha) * mag + u_acc * terms;
+        double lipschitz = p.activation == hipblaslt_activation_type::gelu ? 1.13 : 1.0;
+        double scaleD    = fabs(load_scale<double>(p.scaleD, 0, p.Tc));
+        return lipschitz * scaleD * pre + unit_roundoff(p.To) * (fabs(r) + fabs(d))
+               + zero_spacing(p.To);
+    }
+
+    // Per batch sum of ref^2 and (D - ref)^2, and counts of the unit and allclose failures.
+    // Each block reduces in LDS and adds once to the global accumulators.
+    __global__ void __launch_bounds__(256) compare_kernel(int64_t             m,
+                                                          int64_t             n,
+                                                          int64_t             ldd,
+                                                          int64_t             stride_d,
+                                                          int64_t             batch_count,
+                                                          const void*         ref,
+                                                          const void*         out,
+                                                          hipDataType         To,
+                                                          double              tol,
+                                                          double*             sums,
+                                                          unsigned long long* counts)
+    {
+        __shared__ double             ref2[256];
+        __shared__ double             diff2[256];
+        __shared__ unsigned long long block_counts[count_slots];
+
+        for(int64_t batch = blockIdx.y; batch < batch_count; batch += gridDim.y)
+        {
+            if(threadIdx.x < count_slots)
+                block_counts[threadIdx.x] = 0;
+            __syncthreads();
+
+            double   r2 = 0, d2 = 0;
+            uint32_t c[count_slots] = {};
+            size_t   size           = size_t(m) * n;
+            size_t   step           = size_t(gridDim.x) * blockDim.x;
+            for(size_t e = size_t(blockIdx.x) * blockDim.x + threadIdx.x; e < size; e += step)
+            {
+                size_t idx = batch * stride_d + (e % m) + (e / m) * ldd;
+                double r   = load_value<double>(ref, idx, To);
+                double d   = load_value<double>(out, idx, To);
+                r2 += r * r;
+                d2 += (d - r) * (d - r);
+                count_failures(r, d, tol, allclose_tols, c);
+            }
+
+            ref2[threadIdx.x]  = r2;
+            diff2[threadIdx.x] = d2;
+            for(int i = 0; i < count_slots; i++)
+                if(c[i])
+                    atomicAdd(&block_counts[i], (unsigned long long)c[i]);
+            __syncthreads();
+            for(int s = blockDim.x / 2; s > 0; s /= 2)
+            {
+                if(threadIdx.x < s)
+                {
+                    ref2[threadIdx.x] += ref2[threadIdx.x + s];
+                    diff2[threadIdx.x] += diff2[threadIdx.x + s];
+                }
+                __syncthreads();
+            }
+            if(threadIdx.x == 0)
+            {
+                atomicAdd(&sums[2 * batch], ref2[0]);
+                atomicAdd(&sums[2 * batch + 1], diff2[0]);
+            }
+            if(threadIdx.x < count_slots && block_counts[threadIdx.x])
+                atomicAdd(&counts[threadIdx.x], block_counts[threadIdx.x]);
+            __syncthreads();
+        }
+    }
+
+    // The reference kernel fused with compare_kernel, p.D is the library result. The unit check
+    // fails an element of D when it is outside error_bound of the reference.
+    template <typename T>
+    __global__ void __launch_bounds__(tile * tile)
+        bounded_compare_kernel(reference_gemm p, double* sums, unsigned long long* counts)
+    {
+        __shared__ T                  As[tile][tile + 1];
+        __shared__ T                  Bs[tile][tile + 1];
+        __shared__ double             ref2[tile * tile];
+        __shared__ double             diff2[tile * tile];
+        __shared__ unsigned long long block_counts[count_slots];
+
+        constexpr double u_ref = sizeof(T) == sizeof(float) ? 0x1p-24 : 0x1p-53;
+
+        int     t = threadIdx.y * tile + threadIdx.x;
+        int64_t i = int64_t(blockIdx.x) * tile + threadIdx.x;
+        int64_t j = int64_t(blockIdx.y) * tile + threadIdx.y;
+
+        for(int64_t batch = blockIdx.z; batch < p.batch_count; batch += gridDim.z)
+        {
+            if(t < count_slots)
+                block_counts[t] = 0;
+
+            T sum, mag;
+            tiled_dot<T, true>(p, batch, i, j, As, Bs, sum, mag);
+            __syncthreads();
+
+            double   r2 = 0, d2 = 0;
+            uint32_t c[count_slots] = {};
+            if(i < p.m && j < p.n)
+            {
+                double r     = round_to_output(epilogue(p, batch, i, j, sum), p.To);
+                double d     = load_value<double>(p.D, batch * p.stride_d + i + j * p.ldd, p.To);
+                double bound = error_bound(p, batch, i, j, double(sum), double(mag), r, d, u_ref);
+                r2           = r * r;
+                d2           = (d - r) * (d - r);
+                count_failures(r, d, bound, allclose_tols, c);
+            }
+
+            ref2[t]  = r2;
+            diff2[t] = d2;
+            for(int s = 0; s < count_slots; s++)
+                if(c[s])
+                    atomicAdd(&block_counts[s], (unsigned long long)c[s]);
+            __syncthreads();
+            for(int s = tile * tile / 2; s > 0; s /= 2)
+            {
+                if(t < s)
+                {
+                    ref2[t] += ref2[t + s];
+                    diff2[t] += diff2[t + s];
+                }
+                __syncthreads();
+            }
+            if(t == 0)
+            {
+                atomicAdd(&sums[2 * batch], ref2[0]);
+                atomicAdd(&sums[2 * batch + 1], diff2[0]);
+            }
+            if(t < count_slots && block_counts[t])
+                atomicAdd(&counts[t], block_counts[t]);
+            __syncthreads();
+        }
+    }
+
+    // Runs a compare kernel into zeroed per batch sums and failure counts, then reduces them to
+    // the norm error and picks the allclose tolerances as the host checks do
+    template <typename Launch>
+    reference_error device_compare(int64_t batch_count, hipStream_t stream, Launch launch)
+    {
+        reference_error     error      = {0.0, 0, 0.0, 0.0};
+        double*             dSums      = nullptr;
+        unsigned long long* dCounts    = nullptr;
+        size_t              sumsBytes  = 2 * batch_count * sizeof(double);
+        size_t              countBytes = count_slots * sizeof(unsigned long long);
+        if(hipMalloc(&dSums, sumsBytes) != hipSuccess
+           || hipMalloc(&dCounts, countBytes) != hipSuccess)
+        {
+            hipblaslt_cerr << "hipblaslt_gpu_compare: out of device memory" << std::endl;
+            static_cast<void>(hipFree(dSums));
+            error.norm_error = std::numeric_limits<double>::infinity();
+            error.mismatches = std::numeric_limits<int64_t>::max();
+            error.atol = error.rtol = 1.0;
+            return error;
+        }
+        static_cast<void>(hipMemsetAsync(dSums, 0, sumsBytes, stream));
+        static_cast<void>(hipMemsetAsync(dCounts, 0, countBytes, stream));
+
+        launch(dSums, dCounts);
+
+        std::vector<double>             sums(2 * batch_count);
+        std::vector<unsigned long long> counts(count_slots);
+        static_cast<void>(
+            hipMemcpyAsync(sums.data(), dSums, sumsBytes, hipMemcpyDeviceToHost, stream));
+        static_cast<void>(
+            hipMemcpyAsync(counts.data(), dCounts, countBytes, hipMemcpyDeviceToHost, stream));
+        static_cast<void>(hipStreamSynchronize(stream));
+        static_cast<void>(hipFree(dSums));
+        static_cast<void>(hipFree(dCounts));
+
+        // Frobenius norms add up over the batches, as in norm_check_general
+        for(int64_t b = 0; b < batch_count; b++)
+        {
+            double refNorm  = std::sqrt(sums[2 * b]);
+            double diffNorm = std::sqrt(sums[2 * b + 1]);
+            error.norm_error += refNorm > 0 ? diffNorm / refNorm : diffNorm;
+        }
+        pick_allclose(error, counts.data());
+        return error;
+    }
+}
+
+void hipblaslt_gpu_reference(const reference_gemm& problem, hipStream_t stream)
+{
+    if(problem.m == 0 || problem.n == 0 || problem.batch_count == 0)
+        return;
+
+    dim3 block(tile, tile);
+    dim3 grid((problem.m + tile - 1) / tile,
+              (problem.n + tile - 1) / tile,
+              std::min<int64_t>(problem.batch_count, 1 << 15));
+    if(problem.Tc == HIP_R_32F)
+        gemm_reference_kernel<float><<<grid, block, 0, stream>>>(problem);
+    else
+        gemm_reference_kernel<double><<<grid, block, 0, stream>>>(problem);
+}
+
+reference_error hipblaslt_gpu_compare(int64_t     M,
+                                      int64_t     N,
+                                      int64_t     ldd,
+                                      int64_t     stride_d,
+                                      int64_t     batch_count,
+                                      const void* dRef,
+                                      const void* dD,
+                                      hipDataType To,
+                                      double      tol,
+                                      hipStream_t stream)
+{
+    if(M * N == 0 || batch_count == 0)
+        return {0.0, 0, 0.0, 0.0};
+
+    return device_compare(batch_count, stream, [&](double* dSums, unsigned long long* dCounts) {
+        size_t blocks = std::min<size_t>((size_t(M) * N + 255) / 256, 1024);
+        dim3   grid(blocks, std::min<int64_t>(batch_count, 1 << 15));
+        compare_kernel<<<grid, dim3(256), 0, stream>>>(
+            M, N, ldd, stride_d, batch_count, dRef, dD, To, tol, dSums, dCounts);
+    });
+}
+
+reference_error hipblaslt_bounded_check(const reference_gemm& problem, hipStream_t stream)
+{
+    if(problem.m == 0 || problem.n == 0 || problem.batch_count == 0)
+        return {0.0, 0, 0.0, 0.0};
+
+    return device_compare(
+        problem.batch_count, stream, [&](double* dSums, unsigned long long* dCounts) {
+            dim3 block(tile, tile);
+            dim3 grid((problem.m + tile - 1) / tile,
+                      (problem.n + tile - 1) / tile,
+                      std::min<int64_t>(problem.batch_count, 1 << 15));
+            if(problem.Tc == HIP_R_32F)
+                bounded_compare_kernel<float><<<grid, block, 0, stream>>>(problem, dSums, dCounts);
+            else
+                bounded_compare_kernel<double><<<grid, block, 0, stream>>>(problem, dSums, dCounts);
+        });
+}
+
+reference_error hipblaslt_sampled_check(const reference_gemm& p, int64_t samples, double tol)
+{
+    reference_error error = {0.0, 0, 0.0, 0.0};
+    if(p.m * p.n * p.batch_count == 0 || samples <= 0)
+        return error;
+
+    std::mt19937_64      rng(samples);
+    std::vector<int64_t> batch(samples), row(samples), col(samples);
+    for(int64_t s = 0; s < samples; s++)
+    {
+        batch[s] = rng() % p.batch_count;
+        row[s]   = rng() % p.m;
+        col[s]   = rng() % p.n;
+    }
+
+    std::vector<double> ref(samples), out(samples);
+#pragma omp parallel for
+    for(int64_t s = 0; s < samples; s++)
+    {
+        double sum = 0;
+        for(int64_t l = 0; l < p.k; l++)
+            sum += load_a<double>(p, batch[s], row[s], l) * load_b<double>(p, batch[s], l, col[s]);
+        ref[s] = round_to_output(epilogue(p, batch[s], row[s], col[s], sum), p.To);
+        out[s] = load_value<double>(p.D, batch[s] * p.stride_d + row[s] + col[s] * p.ldd, p.To);
+    }
+
+    double                          ref2 = 0, diff2 = 0;
+    std::vector<unsigned long long> counts(count_slots);
+    for(int64_t s = 0; s < samples; s++)
+    {
+        ref2 += ref[s] * ref[s];
+        diff2 += (out[s] - ref[s]) * (out[s] - ref[s]);
+        count_failures(ref[s], out[s], tol, host_tols, counts.data());
+    }
+    error.norm_error = ref2 > 0 ? std::sqrt(diff2 / ref2) : std::sqrt(diff2);
+    pick_allclose(error, counts.data());
+    return error;
+}
+
+reference_error hipblaslt_checksum_check(const reference_gemm& p, double tol)
+{
+    reference_error error = {0.0, 0, 0.0, 0.0};
+    if(p.m * p.n * p.batch_count == 0)
+        return error;
+
+    double beta = p.beta * load_scale<double>(p.scaleC, 0, p.Tc);
+    double bias = 0;
+    if(p.bias)
+        for(int64_t i = 0; i < p.m; i++)
+            bias += load_value<double>(p.bias, i, p.Tbias);
+    double scaleD = load_scale<double>(p.scaleD, 0, p.Tc);
+
+    std::vector<unsigned long long> counts(count_slots);
+    std::vector<double>             colA(p.k), ref(p.n), out(p.n), mag(p.n);
+    for(int64_t b = 0; b < p.batch_count; b++)
+    {
+        // e^T op(A), the column sums of op(A)
+#pragma omp parallel for
+        for(int64_t l = 0; l < p.k; l++)
+        {
+            double sum = 0;
+            for(int64_t i = 0; i < p.m; i++)
+                sum += load_a<double>(p, b, i, l);
+            colA[l] = sum;
+        }
+
+#pragma omp parallel for
+        for(int64_t j = 0; j < p.n; j++)
+        {
+            double ab = 0;
+            for(int64_t l = 0; l < p.k; l++)
+                ab += colA[l] * load_b<double>(p, b, l, j);
+            double c = 0, d = 0, m = 0;
+            for(int64_t i = 0; i < p.m; i++)
+            {
+                if(p.beta != 0)
+                    c += load_value<double>(p.C, b * p.stride_c + i + j * p.ldc, p.To);
+                double v = load_value<double>(p.D, b * p.stride_d + i + j * p.ldd, p.To);
+                d += v;
+                m += std::abs(v);
+            }
+            ref[j] = (p.alpha * ab + beta * c + bias) * scaleD;
+            out[j] = d;
+            mag[j] = m;
+        }
+
+        double mag2 = 0, diff2 = 0;
+        for(int64_t j = 0; j < p.n; j++)
+        {
+            mag2 += mag[j] * mag[j];
+            diff2 += (out[j] - ref[j]) * (out[j] - ref[j]);
+            count_failures(ref[j], out[j], tol, host_tols, counts.data());
+        }
+        error.norm_error += mag2 > 0 ? std::sqrt(diff2 / mag2) : std::sqrt(diff2);
+    }
+    pick_allclose(error, counts.data());
+    return error;
+}
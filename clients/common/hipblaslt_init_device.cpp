@@ -30,11 +30,12 @@
 #include "hipblaslt_random.hpp"
 #include <hipblaslt/hipblaslt.h>
 
+// Grid-stride loop, so buffers of more than 2^32 elements are filled with a bounded grid
 template <typename T, typename F>
 __global__ void fill_kernel(T* A, size_t size, F f)
 {
-    size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if(idx < size)
+    size_t step = size_t(gridDim.x) * blockDim.x;
+    for(size_t idx = size_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < size; idx += step)
         A[idx] = f(idx);
 }
 
@@ -43,7 +44,7 @@ void fill_batch(T* A, size_t M, size_t N, size_t lda, size_t stride, size_t batc
 {
     size_t size       = std::max(lda * N, stride) * batch_count;
     size_t block_size = 256;
-    size_t grid_size  = (size + block_size - 1) / block_size;
+    size_t grid_size  = std::min<size_t>((size + block_size - 1) / block_size, 1 << 16);
     fill_kernel<<<dim3(grid_size), dim3(block_size), 0, hipStreamDefault>>>(A, size, f);
 }
 
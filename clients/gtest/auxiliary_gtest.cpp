@@ -133,6 +133,42 @@ namespace
                 testing_aux_matmul_pref_init(arg);
             else if(!strcmp(arg.function, "aux_matmul_alg_null_matmul"))
                 testing_aux_matmul_alg_null_matmul(arg);
+            else if(!strcmp(arg.function, "aux_matmul_heuristic_memo"))
+                testing_aux_matmul_heuristic_memo(arg);
+            else if(!strcmp(arg.function, "aux_matmul_workspace_pool"))
+                testing_aux_matmul_workspace_pool(arg);
+            else if(!strcmp(arg.function, "aux_matmul_priority_stream"))
+                testing_aux_matmul_priority_stream(arg);
+            else if(!strcmp(arg.function, "aux_matmul_reproducible"))
+                testing_aux_matmul_reproducible(arg);
+            else if(!strcmp(arg.function, "aux_matmul_solution_cache_stats"))
+                testing_aux_matmul_solution_cache_stats(arg);
+            else if(!strcmp(arg.function, "aux_matmul_call_timings"))
+                testing_aux_matmul_call_timings(arg);
+            else if(!strcmp(arg.function, "aux_matmul_statistics"))
+                testing_aux_matmul_statistics(arg);
+            else if(!strcmp(arg.function, "aux_batched_tiny_gemm"))
+                testing_aux_batched_tiny_gemm(arg);
+            else if(!strcmp(arg.function, "aux_fused_mlp_gemm"))
+                testing_aux_fused_mlp_gemm(arg);
+            else if(!strcmp(arg.function, "aux_multi_device_gemm"))
+                testing_aux_multi_device_gemm(arg);
+            else if(!strcmp(arg.function, "aux_host_streaming_gemm"))
+                testing_aux_host_streaming_gemm(arg);
+            else if(!strcmp(arg.function, "aux_gemm_graph_node"))
+                testing_aux_gemm_graph_node(arg);
+            else if(!strcmp(arg.function, "aux_gemm_program"))
+                testing_aux_gemm_program(arg);
+            else if(!strcmp(arg.function, "aux_matmul_exec_cache"))
+                testing_aux_matmul_exec_cache(arg);
+            else if(!strcmp(arg.function, "aux_matmul_beta_one_in_place"))
+                testing_aux_matmul_beta_one_in_place(arg);
+            else if(!strcmp(arg.function, "aux_matmul_c_aliases_d_ld"))
+                testing_aux_matmul_c_aliases_d_ld(arg);
+            else if(!strcmp(arg.function, "aux_matmul_skinny_gemm"))
+                testing_aux_matmul_skinny_gemm(arg);
+            else if(!strcmp(arg.function, "aux_module_registry"))
+                testing_aux_module_registry(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -172,6 +208,24 @@ namespace
                    || !strcmp(arg.function, "aux_matmul_plan_init_bad_arg")
                    || !strcmp(arg.function, "aux_matmul_plan_init")
                    || !strcmp(arg.function, "aux_matmul_alg_null_matmul")
+                   || !strcmp(arg.function, "aux_matmul_heuristic_memo")
+                   || !strcmp(arg.function, "aux_matmul_workspace_pool")
+                   || !strcmp(arg.function, "aux_matmul_priority_stream")
+                   || !strcmp(arg.function, "aux_matmul_reproducible")
+                   || !strcmp(arg.function, "aux_matmul_solution_cache_stats")
+                   || !strcmp(arg.function, "aux_matmul_call_timings")
+                   || !strcmp(arg.function, "aux_matmul_statistics")
+                   || !strcmp(arg.function, "aux_batched_tiny_gemm")
+                   || !strcmp(arg.function, "aux_fused_mlp_gemm")
+                   || !strcmp(arg.function, "aux_multi_device_gemm")
+                   || !strcmp(arg.function, "aux_host_streaming_gemm")
+                   || !strcmp(arg.function, "aux_gemm_graph_node")
+                   || !strcmp(arg.function, "aux_gemm_program")
+                   || !strcmp(arg.function, "aux_matmul_exec_cache")
+                   || !strcmp(arg.function, "aux_matmul_beta_one_in_place")
+                   || !strcmp(arg.function, "aux_matmul_c_aliases_d_ld")
+                   || !strcmp(arg.function, "aux_matmul_skinny_gemm")
+                   || !strcmp(arg.function, "aux_module_registry")
                    || !strcmp(arg.function, "aux_matmul_pref_get_attr_bad_arg")
                    || !strcmp(arg.function, "aux_matmul_pref_get_attr");
         }
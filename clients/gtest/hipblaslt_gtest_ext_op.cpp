@@ -7,6 +7,7 @@
 #include <hipblaslt_init.hpp>
 #include <limits>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "../include/hipblaslt_random.hpp"
@@ -80,6 +81,44 @@ namespace
         }
     }
 
+    void cpuLayerNormBackward(float*        dInput,
+                              float*        dGamma,
+                              float*        dBeta,
+                              const float*  dOutput,
+                              const float*  in,
+                              const float*  mean,
+                              const float*  invvar,
+                              const float*  gamma,
+                              std::uint32_t batch,
+                              std::uint32_t length)
+    {
+        std::fill(dGamma, dGamma + length, 0.f);
+        std::fill(dBeta, dBeta + length, 0.f);
+
+        for(std::uint32_t i = 0; i < batch; i++)
+        {
+            double sumG     = 0;
+            double sumGXhat = 0;
+            for(std::uint32_t j = 0; j < length; j++)
+            {
+                const float xhat = (in[i * length + j] - mean[i]) * invvar[i];
+                const float g    = dOutput[i * length + j] * gamma[j];
+                sumG += g;
+                sumGXhat += g * xhat;
+                dGamma[j] += dOutput[i * length + j] * xhat;
+                dBeta[j] += dOutput[i * length + j];
+            }
+
+            for(std::uint32_t j = 0; j < length; j++)
+            {
+                const float xhat = (in[i * length + j] - mean[i]) * invvar[i];
+                const float g    = dOutput[i * length + j] * gamma[j];
+                dInput[i * length + j]
+                    = invvar[i] * (g - sumG / length - xhat * sumGXhat / length);
+            }
+        }
+    }
+
     template <typename T>
     T abs(T a)
     {
@@ -147,9 +186,18 @@ struct AMaxWithScaleTestData
 class ExtOpSoftmaxTest : public testing::TestWithParam<uint32_t>
 {
 };
+class ExtOpSoftmaxLongRowTest : public testing::TestWithParam<std::pair<uint32_t, uint32_t>>
+{
+};
 class ExtOpSoftmaxUnsupportedDatatypeTest : public testing::TestWithParam<hipDataType>
 {
 };
+class ExtOpScaleMaskSoftmaxTest : public testing::TestWithParam<bool>
+{
+};
+class ExtOpAttentionTest : public testing::TestWithParam<bool>
+{
+};
 
 class ExtOpLayerNormTest : public testing::TestWithParam<uint32_t>
 {
@@ -158,6 +206,25 @@ class ExtOpLayerNormUnsupportedDatatypeTest : public testing::TestWithParam<hipD
 {
 };
 
+class ExtOpLayerNormBackwardTest : public testing::TestWithParam<uint32_t>
+{
+};
+
+class ExtOpRMSNormTest : public testing::TestWithParam<uint32_t>
+{
+};
+class ExtOpRMSNormUnsupportedDatatypeTest : public testing::TestWithParam<hipDataType>
+{
+};
+
+class ExtOpLayerNormAMaxWithScaleTest : public testing::TestWithParam<uint32_t>
+{
+};
+class ExtOpLayerNormAMaxWithScaleUnsupportedDatatypeTest
+    : public testing::TestWithParam<hipDataType>
+{
+};
+
 class ExtOpAMaxTest : public testing::TestWithParam<AMaxTestData>
 {
 };
@@ -172,6 +239,18 @@ class ExtOpAMaxWithScaleUnsupportedDatatypeTest : public testing::TestWithParam<
 {
 };
 
+class ExtOpAMaxWithBlockScaleTest : public testing::TestWithParam<hipblasltExtAMaxScaleMode_t>
+{
+};
+
+class ExtOpFp8QuantizeTest : public testing::TestWithParam<hipblasltExtFp8Scaling_t>
+{
+};
+
+class ExtOpSparseCompressTest : public testing::TestWithParam<hipblasOperation_t>
+{
+};
+
 TEST_P(ExtOpSoftmaxTest, softmaxSuccess)
 {
     uint32_t           m = GetParam();
@@ -209,6 +288,225 @@ TEST_P(ExtOpSoftmaxTest, softmaxSuccess)
     err = hipFree(gpuOutput);
 }
 
+TEST_P(ExtOpSoftmaxLongRowTest, softmaxLongRowSuccess)
+{
+    const auto         m = GetParam().first;
+    const auto         n = GetParam().second;
+    std::vector<float> input(size_t(m) * n, 0.f);
+    std::vector<float> output(size_t(m) * n, 0.f);
+    hipblaslt_uniform_int_1_10_run_float(input.data(), input.size());
+    float* gpuInput{};
+    float* gpuOutput{};
+
+    auto err          = hipMalloc(&gpuInput, input.size() * sizeof(float));
+    err               = hipMalloc(&gpuOutput, output.size() * sizeof(float));
+    err               = hipMemcpyHtoD(gpuInput, input.data(), input.size() * sizeof(float));
+    auto hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, m, n, 1, gpuOutput, gpuInput, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+    std::vector<float> cpuRef(input.size(), 0.f);
+    cpuSoftmax(cpuRef.data(), input.data(), m, n);
+    err = hipMemcpyDtoH(output.data(), gpuOutput, output.size() * sizeof(float));
+
+    for(std::size_t i = 0; i < output.size(); ++i)
+    {
+        EXPECT_NEAR(output[i], cpuRef[i], 1e-5);
+    }
+
+    err = hipFree(gpuInput);
+    err = hipFree(gpuOutput);
+}
+
+TEST_P(ExtOpScaleMaskSoftmaxTest, scaleMaskSoftmaxSuccess)
+{
+    const bool     causal     = GetParam();
+    const uint32_t m          = 16;
+    const uint32_t n          = 300;
+    const uint32_t batchCount = 3;
+    const float    scale      = 0.125f;
+
+    std::vector<float> input(size_t(batchCount) * m * n, 0.f);
+    std::vector<float> output(input.size(), 0.f);
+    std::vector<float> bias(size_t(batchCount) * n, 0.f);
+    hipblaslt_uniform_int_1_10_run_float(input.data(), input.size());
+    hipblaslt_uniform_int_1_10_run_float(bias.data(), bias.size());
+    float* gpuInput{};
+    float* gpuOutput{};
+    float* gpuBias{};
+
+    auto err = hipMalloc(&gpuInput, input.size() * sizeof(float));
+    err      = hipMalloc(&gpuOutput, output.size() * sizeof(float));
+    err      = hipMalloc(&gpuBias, bias.size() * sizeof(float));
+    err      = hipMemcpyHtoD(gpuInput, input.data(), input.size() * sizeof(float));
+    err      = hipMemcpyHtoD(gpuBias, bias.data(), bias.size() * sizeof(float));
+
+    // One bias row per batch, broadcast over the rows as a key padding mask would be
+    auto hipblasltErr = hipblasltExtScaleMaskSoftmax(HIP_R_32F,
+                                                     m,
+                                                     n,
+                                                     batchCount,
+                                                     gpuOutput,
+                                                     int64_t(m) * n,
+                                                     gpuInput,
+                                                     int64_t(m) * n,
+                                                     scale,
+                                                     causal,
+                                                     gpuBias,
+                                                     0,
+                                                     n,
+                                                     nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<float> cpuRef(input.size(), 0.f);
+    for(uint32_t b = 0; b < batchCount; b++)
+        for(uint32_t i = 0; i < m; i++)
+        {
+            const uint32_t     end = causal ? i + n - m + 1 : n;
+            std::vector<float> logits(end);
+            for(uint32_t j = 0; j < end; j++)
+                logits[j] = scale * input[(size_t(b) * m + i) * n + j] + bias[size_t(b) * n + j];
+            cpuSoftmax(cpuRef.data() + (size_t(b) * m + i) * n, logits.data(), 1, end);
+        }
+    err = hipMemcpyDtoH(output.data(), gpuOutput, output.size() * sizeof(float));
+
+    for(std::size_t i = 0; i < output.size(); ++i)
+    {
+        EXPECT_NEAR(output[i], cpuRef[i], 1e-5);
+    }
+
+    err = hipFree(gpuInput);
+    err = hipFree(gpuOutput);
+    err = hipFree(gpuBias);
+}
+
+TEST(ExtOpTest, scaleMaskSoftmaxFailure)
+{
+    auto hipblasltErr = hipblasltExtScaleMaskSoftmax(
+        HIP_R_64F, 1, 1, 1, nullptr, 0, nullptr, 0, 1.f, 0, nullptr, 0, 0, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+    hipblasltErr = hipblasltExtScaleMaskSoftmax(
+        HIP_R_32F, 1, 1, 1, nullptr, 0, nullptr, 0, 1.f, 0, nullptr, 0, 0, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+}
+
+TEST_P(ExtOpAttentionTest, attentionSuccess)
+{
+    const bool     causal     = GetParam();
+    const uint32_t batchCount = 2;
+    const uint32_t numHeads   = 4;
+    const uint32_t numKvHeads = 2;
+    const uint32_t seqQ       = 20;
+    const uint32_t seqK       = 70;
+    const uint32_t headDim    = 24;
+    const float    scale      = 0.125f;
+
+    std::vector<float> q(size_t(batchCount) * seqQ * numHeads * headDim, 0.f);
+    std::vector<float> k(size_t(batchCount) * seqK * numKvHeads * headDim, 0.f);
+    std::vector<float> v(k.size(), 0.f);
+    std::vector<float> output(q.size(), 0.f);
+    hipblaslt_uniform_int_1_10_run_float(q.data(), q.size());
+    hipblaslt_uniform_int_1_10_run_float(k.data(), k.size());
+    hipblaslt_uniform_int_1_10_run_float(v.data(), v.size());
+    float* gpuQ{};
+    float* gpuK{};
+    float* gpuV{};
+    float* gpuOutput{};
+
+    auto err = hipMalloc(&gpuQ, q.size() * sizeof(float));
+    err      = hipMalloc(&gpuK, k.size() * sizeof(float));
+    err      = hipMalloc(&gpuV, v.size() * sizeof(float));
+    err      = hipMalloc(&gpuOutput, output.size() * sizeof(float));
+    err      = hipMemcpyHtoD(gpuQ, q.data(), q.size() * sizeof(float));
+    err      = hipMemcpyHtoD(gpuK, k.data(), k.size() * sizeof(float));
+    err      = hipMemcpyHtoD(gpuV, v.data(), v.size() * sizeof(float));
+
+    auto hipblasltErr = hipblasltExtAttention(HIP_R_32F,
+                                              HIP_R_32F,
+                                              batchCount,
+                                              numHeads,
+                                              numKvHeads,
+                                              seqQ,
+                                              seqK,
+                                              headDim,
+                                              gpuOutput,
+                                              gpuQ,
+                                              gpuK,
+                                              gpuV,
+                                              scale,
+                                              1.f,
+                                              causal,
+                                              nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    // Q * K^T, the masked softmax and P * V of each head on the host
+    std::vector<float> cpuRef(output.size(), 0.f);
+    for(uint32_t b = 0; b < batchCount; b++)
+        for(uint32_t h = 0; h < numHeads; h++)
+            for(uint32_t i = 0; i < seqQ; i++)
+            {
+                const uint32_t     kvHead = h / (numHeads / numKvHeads);
+                const uint32_t     end    = causal ? i + seqK - seqQ + 1 : seqK;
+                const float*       qi     = &q[((size_t(b) * seqQ + i) * numHeads + h) * headDim];
+                std::vector<float> logits(end), probs(end);
+                for(uint32_t j = 0; j < end; j++)
+                {
+                    const float* kj = &k[((size_t(b) * seqK + j) * numKvHeads + kvHead) * headDim];
+                    logits[j] = scale * std::inner_product(qi, qi + headDim, kj, 0.f);
+                }
+                cpuSoftmax(probs.data(), logits.data(), 1, end);
+                float* out = &cpuRef[((size_t(b) * seqQ + i) * numHeads + h) * headDim];
+                for(uint32_t j = 0; j < end; j++)
+                    for(uint32_t d = 0; d < headDim; d++)
+                        out[d]
+                            += probs[j]
+                               * v[((size_t(b) * seqK + j) * numKvHeads + kvHead) * headDim + d];
+            }
+    err = hipMemcpyDtoH(output.data(), gpuOutput, output.size() * sizeof(float));
+
+    for(std::size_t i = 0; i < output.size(); ++i)
+    {
+        EXPECT_NEAR(output[i], cpuRef[i], 1e-4);
+    }
+
+    err = hipFree(gpuQ);
+    err = hipFree(gpuK);
+    err = hipFree(gpuV);
+    err = hipFree(gpuOutput);
+}
+
+TEST(ExtOpTest, attentionFailure)
+{
+    // Unsupported types and head sizes are refused before the buffers are checked
+    auto hipblasltErr = hipblasltExtAttention(
+        HIP_R_64F, HIP_R_32F, 1, 1, 1, 1, 1, 1, nullptr, nullptr, nullptr, nullptr, 1.f, 1.f, 0, 0);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+    hipblasltErr = hipblasltExtAttention(HIP_R_32F,
+                                         HIP_R_32F,
+                                         1,
+                                         1,
+                                         1,
+                                         1,
+                                         1,
+                                         257,
+                                         nullptr,
+                                         nullptr,
+                                         nullptr,
+                                         nullptr,
+                                         1.f,
+                                         1.f,
+                                         0,
+                                         0);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+    hipblasltErr = hipblasltExtAttention(
+        HIP_R_32F, HIP_R_32F, 1, 1, 1, 1, 1, 1, nullptr, nullptr, nullptr, nullptr, 1.f, 1.f, 0, 0);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+}
+
 TEST_P(ExtOpLayerNormTest, layernormSuccess)
 {
     uint32_t m = GetParam();
@@ -421,6 +719,355 @@ void AMaxTestWithScale(hipDataType    type,
     hipErr = hipFree(gpuInputScale);
 }
 
+TEST_P(ExtOpLayerNormBackwardTest, layernormBackwardSuccess)
+{
+    uint32_t m = GetParam();
+    uint32_t n = 1024;
+
+    std::vector<float> dInput(m * n, 0.f);
+    std::vector<float> dGamma(n, 0.f);
+    std::vector<float> dBeta(n, 0.f);
+    std::vector<float> dOutput(m * n, 0.f);
+    std::vector<float> input(m * n, 0.f);
+    std::vector<float> mean(m, 0.f);
+    std::vector<float> invvar(m, 0.f);
+    std::vector<float> gamma(n, 1.f);
+    std::vector<float> output(m * n, 0.f);
+
+    hipblaslt_init_hpl(input, n, m, n);
+    hipblaslt_init_hpl(dOutput, n, m, n);
+    hipblaslt_init_hpl(gamma, n, 1, n);
+    cpuLayerNorm<float>(
+        output.data(), mean.data(), invvar.data(), input.data(), m, n, 1e-05, gamma.data());
+
+    float* gpuDInput{};
+    float* gpuDGamma{};
+    float* gpuDBeta{};
+    float* gpuDOutput{};
+    float* gpuInput{};
+    float* gpuMean{};
+    float* gpuInvvar{};
+    float* gpuGamma{};
+
+    auto err = hipMalloc(&gpuDInput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuDGamma, n * sizeof(float));
+    err      = hipMalloc(&gpuDBeta, n * sizeof(float));
+    err      = hipMalloc(&gpuDOutput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuInput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuMean, m * sizeof(float));
+    err      = hipMalloc(&gpuInvvar, m * sizeof(float));
+    err      = hipMalloc(&gpuGamma, n * sizeof(float));
+
+    err = hipMemcpyHtoD(gpuDOutput, dOutput.data(), m * n * sizeof(float));
+    err = hipMemcpyHtoD(gpuInput, input.data(), m * n * sizeof(float));
+    err = hipMemcpyHtoD(gpuMean, mean.data(), m * sizeof(float));
+    err = hipMemcpyHtoD(gpuInvvar, invvar.data(), m * sizeof(float));
+    err = hipMemcpyHtoD(gpuGamma, gamma.data(), n * sizeof(float));
+
+    std::vector<float> firstDGamma(n, 0.f);
+    for(int run = 0; run < 2; run++)
+    {
+        auto hipblasltErr = hipblasltExtLayerNormBackward(HIP_R_32F,
+                                                          gpuDInput,
+                                                          gpuDGamma,
+                                                          gpuDBeta,
+                                                          gpuDOutput,
+                                                          gpuInput,
+                                                          gpuMean,
+                                                          gpuInvvar,
+                                                          gpuGamma,
+                                                          m,
+                                                          n,
+                                                          nullptr);
+        EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+        err = hipDeviceSynchronize();
+        EXPECT_EQ(err, hipSuccess);
+
+        err = hipMemcpyDtoH(dGamma.data(), gpuDGamma, n * sizeof(float));
+        if(run == 0)
+            firstDGamma = dGamma;
+    }
+
+    // The dgamma reduction has a fixed order, repeated runs match bit for bit
+    EXPECT_EQ(firstDGamma, dGamma);
+
+    std::vector<float> cpuDInput(m * n, 0.f);
+    std::vector<float> cpuDGamma(n, 0.f);
+    std::vector<float> cpuDBeta(n, 0.f);
+    cpuLayerNormBackward(cpuDInput.data(),
+                         cpuDGamma.data(),
+                         cpuDBeta.data(),
+                         dOutput.data(),
+                         input.data(),
+                         mean.data(),
+                         invvar.data(),
+                         gamma.data(),
+                         m,
+                         n);
+
+    err = hipMemcpyDtoH(dInput.data(), gpuDInput, m * n * sizeof(float));
+    err = hipMemcpyDtoH(dBeta.data(), gpuDBeta, n * sizeof(float));
+
+    for(std::size_t i = 0; i < m * n; ++i)
+    {
+        EXPECT_NEAR(dInput[i], cpuDInput[i], 1e-4);
+    }
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        EXPECT_NEAR(dGamma[i], cpuDGamma[i], 1e-4 * m);
+        EXPECT_NEAR(dBeta[i], cpuDBeta[i], 1e-4 * m);
+    }
+
+    err = hipFree(gpuDInput);
+    err = hipFree(gpuDGamma);
+    err = hipFree(gpuDBeta);
+    err = hipFree(gpuDOutput);
+    err = hipFree(gpuInput);
+    err = hipFree(gpuMean);
+    err = hipFree(gpuInvvar);
+    err = hipFree(gpuGamma);
+}
+
+TEST_P(ExtOpRMSNormTest, rmsnormResidualSuccess)
+{
+    uint32_t m = GetParam();
+    uint32_t n = 1024;
+
+    std::vector<float> output(m * n, 0.f);
+    std::vector<float> input(m * n, 0.f);
+    std::vector<float> residual(m * n, 0.f);
+    std::vector<float> gamma(n, 1.f);
+
+    hipblaslt_init_hpl(input, n, m, n);
+    hipblaslt_init_hpl(residual, n, m, n);
+    hipblaslt_init_hpl(gamma, n, 1, n);
+
+    float* gpuOutput{};
+    float* gpuInput{};
+    float* gpuResidual{};
+    float* gpuGamma{};
+
+    auto err = hipMalloc(&gpuOutput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuInput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuResidual, m * n * sizeof(float));
+    err      = hipMalloc(&gpuGamma, n * sizeof(float));
+
+    err = hipMemcpyHtoD(gpuInput, input.data(), m * n * sizeof(float));
+    err = hipMemcpyHtoD(gpuResidual, residual.data(), m * n * sizeof(float));
+    err = hipMemcpyHtoD(gpuGamma, gamma.data(), n * sizeof(float));
+
+    // The sum is written back over the residual, as in a transformer block
+    auto hipblasltErr = hipblasltExtRMSNorm(HIP_R_32F,
+                                            HIP_R_32F,
+                                            gpuOutput,
+                                            gpuResidual,
+                                            gpuInput,
+                                            gpuResidual,
+                                            gpuGamma,
+                                            nullptr,
+                                            m,
+                                            n,
+                                            1e-05,
+                                            nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<float> cpuRef(m * n, 0.0f);
+    std::vector<float> cpuSum(m * n, 0.0f);
+    for(uint32_t i = 0; i < m; i++)
+    {
+        float squares = 0.f;
+        for(uint32_t j = 0; j < n; j++)
+        {
+            cpuSum[i * n + j] = input[i * n + j] + residual[i * n + j];
+            squares += cpuSum[i * n + j] * cpuSum[i * n + j];
+        }
+
+        const float rrms = 1 / std::sqrt(squares / n + 1e-05f);
+        for(uint32_t j = 0; j < n; j++)
+            cpuRef[i * n + j] = cpuSum[i * n + j] * rrms * gamma[j];
+    }
+
+    err = hipMemcpyDtoH(output.data(), gpuOutput, m * n * sizeof(float));
+    err = hipMemcpyDtoH(residual.data(), gpuResidual, m * n * sizeof(float));
+
+    for(std::size_t i = 0; i < m * n; ++i)
+    {
+        EXPECT_NEAR(output[i], cpuRef[i], 1e-5);
+        EXPECT_NEAR(residual[i], cpuSum[i], 1e-5);
+    }
+
+    err = hipFree(gpuOutput);
+    err = hipFree(gpuInput);
+    err = hipFree(gpuResidual);
+    err = hipFree(gpuGamma);
+}
+
+TEST_P(ExtOpRMSNormUnsupportedDatatypeTest, rmsnormFailureUnsupportedDatatype)
+{
+    auto hipblasltErr = hipblasltExtRMSNorm(GetParam(),
+                                            GetParam(),
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            16,
+                                            1024,
+                                            1e-05,
+                                            nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+}
+
+TEST(ExtOpTest, rmsnormFailureInvalidValue)
+{
+    float* gpuBuffer{};
+    auto   err = hipMalloc(&gpuBuffer, sizeof(float));
+
+    // FP8 output needs a scale
+    auto hipblasltErr = hipblasltExtRMSNorm(HIP_R_32F,
+                                            HIP_R_8F_E4M3_FNUZ,
+                                            gpuBuffer,
+                                            nullptr,
+                                            gpuBuffer,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            1,
+                                            1,
+                                            1e-05,
+                                            nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+    hipblasltErr = hipblasltExtRMSNorm(HIP_R_32F,
+                                       HIP_R_32F,
+                                       gpuBuffer,
+                                       nullptr,
+                                       gpuBuffer,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       1,
+                                       1e-05,
+                                       nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+
+    err = hipFree(gpuBuffer);
+}
+
+TEST_P(ExtOpLayerNormAMaxWithScaleTest, layernormAMaxWithScaleSuccess)
+{
+    uint32_t m = GetParam();
+    uint32_t n = 1024;
+
+    int             deviceId;
+    hipDeviceProp_t deviceProperties;
+    static_cast<void>(hipGetDevice(&deviceId));
+    static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
+    if(!gpu_arch_match(deviceProperties.gcnArchName, "94\\d"))
+        return;
+
+    std::vector<hipblaslt_f8_fnuz> output(m * n);
+    std::vector<float>             mean(m, 0.f);
+    std::vector<float>             invvar(m, 0.f);
+    std::vector<float>             input(m * n, 0.f);
+    std::vector<float>             gamma(n, 1.f);
+    std::vector<float>             beta(n, 0.f);
+    std::vector<float>             scale(1, 0.5f);
+    float                          amax{};
+
+    hipblaslt_init_hpl(input, n, m, n);
+    hipblaslt_init_hpl(gamma, n, 1, n);
+    hipblaslt_init_hpl(beta, n, 1, n);
+
+    hipblaslt_f8_fnuz* gpuOutput{};
+    float*             gpuAmax{};
+    float*             gpuMean{};
+    float*             gpuInvvar{};
+    float*             gpuInput{};
+    float*             gpuGamma{};
+    float*             gpuBeta{};
+    float*             gpuScale{};
+
+    auto err = hipMalloc(&gpuOutput, m * n * sizeof(hipblaslt_f8_fnuz));
+    err      = hipMalloc(&gpuAmax, sizeof(float));
+    err      = hipMalloc(&gpuMean, m * sizeof(float));
+    err      = hipMalloc(&gpuInvvar, m * sizeof(float));
+    err      = hipMalloc(&gpuInput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuGamma, n * sizeof(float));
+    err      = hipMalloc(&gpuBeta, n * sizeof(float));
+    err      = hipMalloc(&gpuScale, sizeof(float));
+
+    err = hipMemcpyHtoD(gpuInput, input.data(), m * n * sizeof(float));
+    err = hipMemcpyHtoD(gpuGamma, gamma.data(), n * sizeof(float));
+    err = hipMemcpyHtoD(gpuBeta, beta.data(), n * sizeof(float));
+    err = hipMemcpyHtoD(gpuScale, scale.data(), sizeof(float));
+
+    auto hipblasltErr = hipblasltExtLayerNormAMaxWithScale(HIP_R_32F,
+                                                           HIP_R_8F_E4M3_FNUZ,
+                                                           gpuOutput,
+                                                           gpuAmax,
+                                                           gpuMean,
+                                                           gpuInvvar,
+                                                           gpuInput,
+                                                           gpuScale,
+                                                           m,
+                                                           n,
+                                                           1e-05,
+                                                           gpuGamma,
+                                                           gpuBeta,
+                                                           nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<float> cpuRef(m * n, 0.0f);
+    std::vector<float> cpuMean(m, 0.0f);
+    std::vector<float> cpuInvvar(m, 0.0f);
+    cpuLayerNorm<float>(cpuRef.data(),
+                        cpuMean.data(),
+                        cpuInvvar.data(),
+                        input.data(),
+                        m,
+                        n,
+                        1e-05,
+                        gamma.data(),
+                        beta.data());
+
+    float cpuAmax = 0.f;
+    for(auto v : cpuRef)
+        cpuAmax = std::max(cpuAmax, std::abs(v));
+
+    err = hipMemcpyDtoH(output.data(), gpuOutput, m * n * sizeof(hipblaslt_f8_fnuz));
+    err = hipMemcpyDtoH(&amax, gpuAmax, sizeof(float));
+    err = hipMemcpyDtoH(mean.data(), gpuMean, m * sizeof(float));
+    err = hipMemcpyDtoH(invvar.data(), gpuInvvar, m * sizeof(float));
+
+    EXPECT_NEAR(amax, cpuAmax, 1e-4);
+    for(std::size_t i = 0; i < m * n; ++i)
+    {
+        // Within one E4M3 step of the rounded reference, the fp32 inputs may round apart
+        const float ref = cpuRef[i] * scale[0];
+        EXPECT_NEAR(float(output[i]), ref, std::abs(ref) / 8 + 1e-3);
+    }
+    for(std::size_t i = 0; i < m; ++i)
+    {
+        EXPECT_NEAR(mean[i], cpuMean[i], 1e-5);
+        EXPECT_NEAR(invvar[i], cpuInvvar[i], 1e-5);
+    }
+
+    err = hipFree(gpuOutput);
+    err = hipFree(gpuAmax);
+    err = hipFree(gpuMean);
+    err = hipFree(gpuInvvar);
+    err = hipFree(gpuInput);
+    err = hipFree(gpuGamma);
+    err = hipFree(gpuBeta);
+    err = hipFree(gpuScale);
+}
+
 TEST_P(ExtOpAMaxTest, amaxSuccess)
 {
     AMaxTestData    testdata = GetParam();
@@ -450,6 +1097,121 @@ TEST_P(ExtOpAMaxTest, amaxSuccess)
     }
 }
 
+TEST(ExtOpTest, amaxGraphCaptureSuccess)
+{
+    // Large enough for many workgroups, replayed twice to check that the output is reset
+    const uint32_t     m = 4096;
+    const uint32_t     n = 4097;
+    std::vector<float> input(std::size_t(m) * n, 0.f);
+    hipblaslt_init_hpl(input, input.size(), 1, input.size());
+    float refOutput = 0.f;
+    for(auto v : input)
+        refOutput = std::max(refOutput, std::abs(v));
+
+    float* gpuOutput{};
+    float* gpuInput{};
+    auto   err = hipMalloc(&gpuOutput, sizeof(float));
+    err        = hipMalloc(&gpuInput, input.size() * sizeof(float));
+    err        = hipMemcpyHtoD(gpuInput, input.data(), input.size() * sizeof(float));
+
+    hipStream_t stream{};
+    hipGraph_t  graph{};
+    err = hipStreamCreate(&stream);
+    err = hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal);
+    auto hipblasltErr = hipblasltExtAMax(HIP_R_32F, HIP_R_32F, gpuOutput, gpuInput, m, n, stream);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipStreamEndCapture(stream, &graph);
+    EXPECT_EQ(err, hipSuccess);
+
+    hipGraphExec_t graphExec{};
+    err = hipGraphInstantiate(&graphExec, graph, nullptr, nullptr, 0);
+    EXPECT_EQ(err, hipSuccess);
+
+    for(int i = 0; i < 2; i++)
+    {
+        err = hipGraphLaunch(graphExec, stream);
+        err = hipStreamSynchronize(stream);
+        EXPECT_EQ(err, hipSuccess);
+
+        float output{};
+        err = hipMemcpyDtoH(&output, gpuOutput, sizeof(float));
+        EXPECT_EQ(output, refOutput);
+    }
+
+    err = hipGraphExecDestroy(graphExec);
+    err = hipGraphDestroy(graph);
+    err = hipStreamDestroy(stream);
+    err = hipFree(gpuOutput);
+    err = hipFree(gpuInput);
+}
+
+TEST(ExtOpTest, amaxMultiTensorSuccess)
+{
+    // Mixed sizes and types, including an empty tensor and one spanning many chunks
+    const std::vector<std::pair<uint32_t, uint32_t>> shapes{
+        {1, 1}, {16, 16}, {0, 16}, {1335, 666}, {7, 333}, {4096, 1024}};
+    const std::vector<hipDataType> types{
+        HIP_R_32F, HIP_R_16F, HIP_R_32F, HIP_R_32F, HIP_R_16F, HIP_R_16F};
+    const uint32_t numTensors = shapes.size();
+
+    std::vector<hipblasltExtAMaxTensor> tensors(numTensors);
+    std::vector<float>                  refOutput(numTensors, 0.f);
+    float*                              gpuOutput{};
+
+    auto err = hipMalloc(&gpuOutput, numTensors * sizeof(float));
+
+    for(uint32_t t = 0; t < numTensors; t++)
+    {
+        const std::size_t len = std::size_t(shapes[t].first) * shapes[t].second;
+        void*             gpuInput{};
+
+        if(types[t] == HIP_R_16F)
+        {
+            std::vector<hipblasLtHalf> input(len);
+            hipblaslt_init_hpl(input, len, 1, len);
+            err = hipMalloc(&gpuInput, std::max<std::size_t>(len, 1) * sizeof(hipblasLtHalf));
+            err = hipMemcpyHtoD(gpuInput, input.data(), len * sizeof(hipblasLtHalf));
+            for(auto v : input)
+                refOutput[t] = std::max(refOutput[t], std::abs(float(v)));
+        }
+        else
+        {
+            std::vector<float> input(len);
+            hipblaslt_init_hpl(input, len, 1, len);
+            err = hipMalloc(&gpuInput, std::max<std::size_t>(len, 1) * sizeof(float));
+            err = hipMemcpyHtoD(gpuInput, input.data(), len * sizeof(float));
+            for(auto v : input)
+                refOutput[t] = std::max(refOutput[t], std::abs(v));
+        }
+
+        tensors[t] = {gpuOutput + t, gpuInput, shapes[t].first, shapes[t].second, types[t]};
+    }
+
+    hipblasltExtAMaxTensor* gpuTensors{};
+    err = hipMalloc(&gpuTensors, numTensors * sizeof(hipblasltExtAMaxTensor));
+    err = hipMemcpyHtoD(gpuTensors, tensors.data(), numTensors * sizeof(hipblasltExtAMaxTensor));
+
+    // Outputs are overwritten, not combined with what they held before
+    err = hipMemset(gpuOutput, 0xff, numTensors * sizeof(float));
+
+    auto hipblasltErr = hipblasltExtAMaxMultiTensor(HIP_R_32F, gpuTensors, numTensors, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<float> output(numTensors, 0.f);
+    err = hipMemcpyDtoH(output.data(), gpuOutput, numTensors * sizeof(float));
+
+    for(uint32_t t = 0; t < numTensors; t++)
+    {
+        EXPECT_NEAR(output[t], refOutput[t], 1e-5);
+        err = hipFree(tensors[t].input);
+    }
+
+    err = hipFree(gpuTensors);
+    err = hipFree(gpuOutput);
+}
+
 TEST_P(ExtOpAMaxWithScaleTest, amaxSuccess)
 {
     AMaxWithScaleTestData testdata = GetParam();
@@ -503,12 +1265,47 @@ TEST_P(ExtOpSoftmaxUnsupportedDatatypeTest, softmaxFailureUnsupportedDatatype)
 
 TEST(ExtOpTest, softmaxFailureUnsupportedShapeOrReductionDim)
 {
-    auto hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, 16, 512, 1, nullptr, nullptr, nullptr);
+    auto hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, 16, 0, 1, nullptr, nullptr, nullptr);
     EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
     hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, 16, 16, 0, nullptr, nullptr, nullptr);
     EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
 }
 
+TEST_P(ExtOpLayerNormAMaxWithScaleUnsupportedDatatypeTest,
+       layernormAMaxWithScaleFailureUnsupportedDatatype)
+{
+    auto hipblasltErr = hipblasltExtLayerNormAMaxWithScale(GetParam(),
+                                                           HIP_R_8F_E4M3_FNUZ,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           16,
+                                                           1024,
+                                                           1e-05,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+    hipblasltErr = hipblasltExtLayerNormAMaxWithScale(HIP_R_32F,
+                                                      HIP_R_16F,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      16,
+                                                      1024,
+                                                      1e-05,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+}
+
 TEST_P(ExtOpLayerNormUnsupportedDatatypeTest, layernormFailureUnsupportedDatatype)
 {
     auto hipblasltErr = hipblasltExtLayerNorm(
@@ -516,6 +1313,64 @@ TEST_P(ExtOpLayerNormUnsupportedDatatypeTest, layernormFailureUnsupportedDatatyp
     EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
 }
 
+TEST(ExtOpTest, extOpTuningFailure)
+{
+    uint32_t count{};
+    auto hipblasltErr = hipblasltExtOpGetCandidateTiles("AMax", HIP_R_32F, 16, nullptr, &count);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+    hipblasltErr = hipblasltExtOpGetCandidateTiles("Softmax", HIP_R_32F, 0, nullptr, &count);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+    hipblasltErr = hipblasltExtOpForceTile("AMax", 16);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+}
+
+TEST_P(ExtOpSoftmaxTest, softmaxForcedTileSuccess)
+{
+    uint32_t m = GetParam();
+    uint32_t n = 16;
+    uint32_t count{};
+
+    auto hipblasltErr = hipblasltExtOpGetCandidateTiles("Softmax", HIP_R_32F, n, nullptr, &count);
+    if(hipblasltErr == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+
+    std::vector<uint32_t> tiles(count);
+    hipblasltErr = hipblasltExtOpGetCandidateTiles("Softmax", HIP_R_32F, n, tiles.data(), &count);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+
+    std::vector<float> input(m * n, 0.f);
+    std::vector<float> output(m * n, 0.f);
+    std::vector<float> cpuRef(m * n, 0.f);
+    hipblaslt_uniform_int_1_10_run_float(input.data(), input.size());
+    cpuSoftmax(cpuRef.data(), input.data(), m, n);
+    float* gpuInput{};
+    float* gpuOutput{};
+
+    auto err = hipMalloc(&gpuInput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuOutput, m * n * sizeof(float));
+    err      = hipMemcpyHtoD(gpuInput, input.data(), m * n * sizeof(float));
+
+    // Every candidate computes the same softmax
+    for(auto tile : tiles)
+    {
+        EXPECT_GE(tile, n);
+        EXPECT_EQ(hipblasltExtOpForceTile("Softmax", tile), HIPBLAS_STATUS_SUCCESS);
+        hipblasltErr = hipblasltExtSoftmax(HIP_R_32F, m, n, 1, gpuOutput, gpuInput, nullptr);
+        EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+        err = hipMemcpyDtoH(output.data(), gpuOutput, m * n * sizeof(float));
+
+        for(std::size_t i = 0; i < m * n; ++i)
+        {
+            EXPECT_NEAR(output[i], cpuRef[i], 1e-5);
+        }
+    }
+
+    EXPECT_EQ(hipblasltExtOpForceTile("Softmax", 0), HIPBLAS_STATUS_SUCCESS);
+    err = hipFree(gpuInput);
+    err = hipFree(gpuOutput);
+}
+
 TEST(ExtOpTest, layernormFailureInvalidValue)
 {
     auto hipblasltErr = hipblasltExtLayerNorm(
@@ -535,6 +1390,14 @@ TEST(ExtOpTest, amaxFailureInvalidValue)
     EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
 }
 
+TEST(ExtOpTest, amaxMultiTensorFailure)
+{
+    auto hipblasltErr = hipblasltExtAMaxMultiTensor(HIP_R_16BF, nullptr, 0, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+    hipblasltErr = hipblasltExtAMaxMultiTensor(HIP_R_32F, nullptr, 1, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+}
+
 TEST_P(ExtOpAMaxWithScaleUnsupportedDatatypeTest, amaxWithScaleFailureUnsupportedDatatype)
 {
     auto hipblasltErr = hipblasltExtAMaxWithScale(
@@ -557,10 +1420,348 @@ TEST(ExtOpTest, amaxWithScaleFailureInvalidValue)
     EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
 }
 
+TEST_P(ExtOpAMaxWithBlockScaleTest, amaxWithBlockScaleSuccess)
+{
+    const auto     mode      = GetParam();
+    const uint32_t m         = 300;
+    const uint32_t n         = 200;
+    const uint32_t blockSize = 128;
+
+    int             deviceId;
+    hipDeviceProp_t deviceProperties;
+    static_cast<void>(hipGetDevice(&deviceId));
+    static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
+    if(!gpu_arch_match(deviceProperties.gcnArchName, "94\\d"))
+        return;
+
+    // Partial tiles on the last tile row and column
+    const uint32_t tileM     = mode == HIPBLASLT_EXT_AMAX_SCALE_ROW ? 1 : blockSize;
+    const uint32_t tileN     = mode == HIPBLASLT_EXT_AMAX_SCALE_ROW ? n : blockSize;
+    const uint32_t tilesN    = (n + tileN - 1) / tileN;
+    const uint32_t numScales = (m + tileM - 1) / tileM * tilesN;
+
+    std::vector<hipblaslt_f8_fnuz> output(m * n);
+    std::vector<float>             input(m * n, 0.f);
+    std::vector<float>             amax(numScales, 0.f);
+    std::vector<float>             scale(numScales, 0.f);
+
+    hipblaslt_init_hpl(input, n, m, n);
+
+    hipblaslt_f8_fnuz* gpuOutput{};
+    float*             gpuInput{};
+    float*             gpuAmax{};
+    float*             gpuScale{};
+
+    auto err = hipMalloc(&gpuOutput, m * n * sizeof(hipblaslt_f8_fnuz));
+    err      = hipMalloc(&gpuInput, m * n * sizeof(float));
+    err      = hipMalloc(&gpuAmax, numScales * sizeof(float));
+    err      = hipMalloc(&gpuScale, numScales * sizeof(float));
+
+    err = hipMemcpyHtoD(gpuInput, input.data(), m * n * sizeof(float));
+
+    auto hipblasltErr = hipblasltExtAMaxWithBlockScale(HIP_R_32F,
+                                                       HIP_R_8F_E4M3_FNUZ,
+                                                       mode,
+                                                       blockSize,
+                                                       gpuAmax,
+                                                       gpuScale,
+                                                       gpuOutput,
+                                                       gpuInput,
+                                                       m,
+                                                       n,
+                                                       nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<float> cpuAmax(numScales, 0.f);
+    for(uint32_t i = 0; i < m; i++)
+        for(uint32_t j = 0; j < n; j++)
+        {
+            auto& a = cpuAmax[i / tileM * tilesN + j / tileN];
+            a       = std::max(a, std::abs(input[i * n + j]));
+        }
+
+    err = hipMemcpyDtoH(output.data(), gpuOutput, m * n * sizeof(hipblaslt_f8_fnuz));
+    err = hipMemcpyDtoH(amax.data(), gpuAmax, numScales * sizeof(float));
+    err = hipMemcpyDtoH(scale.data(), gpuScale, numScales * sizeof(float));
+
+    for(uint32_t t = 0; t < numScales; t++)
+    {
+        EXPECT_EQ(amax[t], cpuAmax[t]);
+        EXPECT_NEAR(scale[t], cpuAmax[t] > 0.f ? cpuAmax[t] / 240.f : 1.f, 1e-6);
+    }
+    for(uint32_t i = 0; i < m; i++)
+        for(uint32_t j = 0; j < n; j++)
+        {
+            // Dequantized back with its scale, within one E4M3 step of the input
+            const float ref = input[i * n + j];
+            const float s   = scale[i / tileM * tilesN + j / tileN];
+            EXPECT_NEAR(float(output[i * n + j]) * s, ref, std::abs(ref) / 8 + 1e-3);
+        }
+
+    err = hipFree(gpuOutput);
+    err = hipFree(gpuInput);
+    err = hipFree(gpuAmax);
+    err = hipFree(gpuScale);
+}
+
+TEST(ExtOpTest, amaxWithBlockScaleFailure)
+{
+    auto hipblasltErr = hipblasltExtAMaxWithBlockScale(HIP_R_32F,
+                                                       HIP_R_32F,
+                                                       HIPBLASLT_EXT_AMAX_SCALE_ROW,
+                                                       0,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       1,
+                                                       1,
+                                                       nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    float* gpuBuffer{};
+    auto   err = hipMalloc(&gpuBuffer, sizeof(float));
+
+    // Tiles need a size
+    hipblasltErr = hipblasltExtAMaxWithBlockScale(HIP_R_32F,
+                                                  HIP_R_8F_E4M3_FNUZ,
+                                                  HIPBLASLT_EXT_AMAX_SCALE_BLOCK,
+                                                  0,
+                                                  nullptr,
+                                                  gpuBuffer,
+                                                  gpuBuffer,
+                                                  gpuBuffer,
+                                                  1,
+                                                  1,
+                                                  nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+
+    err = hipFree(gpuBuffer);
+}
+
+TEST_P(ExtOpFp8QuantizeTest, fp8QuantizeSuccess)
+{
+    const auto scaling = GetParam();
+
+    int             deviceId;
+    hipDeviceProp_t deviceProperties;
+    static_cast<void>(hipGetDevice(&deviceId));
+    static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
+    if(!gpu_arch_match(deviceProperties.gcnArchName, "94\\d"))
+        return;
+
+    // An f32 tensor and an f16 tensor spanning many chunks, as a and b of a gemm
+    const std::vector<std::pair<uint32_t, uint32_t>> shapes{{300, 200}, {1335, 666}};
+    const std::vector<hipDataType>                   types{HIP_R_32F, HIP_R_16F};
+    const uint32_t                                   numTensors = shapes.size();
+
+    std::vector<hipblasltExtFp8QuantizeTensor> tensors(numTensors);
+    std::vector<std::vector<float>>            inputs(numTensors);
+    std::vector<float>                         cpuAmax(numTensors, 0.f);
+    float*                                     gpuScalars{};
+
+    // Scales followed by amax
+    auto err = hipMalloc(&gpuScalars, 2 * numTensors * sizeof(float));
+
+    for(uint32_t t = 0; t < numTensors; t++)
+    {
+        const std::size_t len = std::size_t(shapes[t].first) * shapes[t].second;
+        void*             gpuInput{};
+        void*             gpuOutput{};
+
+        inputs[t].resize(len);
+        hipblaslt_init_hpl(inputs[t], len, 1, len);
+        err = hipMalloc(&gpuOutput, len * sizeof(hipblaslt_f8_fnuz));
+        if(types[t] == HIP_R_16F)
+        {
+            std::vector<hipblasLtHalf> input(inputs[t].begin(), inputs[t].end());
+            for(std::size_t i = 0; i < len; i++)
+                inputs[t][i] = float(input[i]);
+            err = hipMalloc(&gpuInput, len * sizeof(hipblasLtHalf));
+            err = hipMemcpyHtoD(gpuInput, input.data(), len * sizeof(hipblasLtHalf));
+        }
+        else
+        {
+            err = hipMalloc(&gpuInput, len * sizeof(float));
+            err = hipMemcpyHtoD(gpuInput, inputs[t].data(), len * sizeof(float));
+        }
+        for(auto v : inputs[t])
+            cpuAmax[t] = std::max(cpuAmax[t], std::abs(v));
+
+        tensors[t] = {gpuOutput,
+                      gpuInput,
+                      gpuScalars + t,
+                      gpuScalars + numTensors + t,
+                      shapes[t].first,
+                      shapes[t].second,
+                      types[t],
+                      HIP_R_8F_E4M3_FNUZ};
+    }
+
+    // Delayed scales with headroom over the amax of the inputs, as from an amax history
+    std::vector<float> refScale(numTensors);
+    for(uint32_t t = 0; t < numTensors; t++)
+        refScale[t] = scaling == HIPBLASLT_EXT_FP8_SCALING_DELAYED ? 2.f * cpuAmax[t] / 240.f
+                                                                   : cpuAmax[t] / 240.f;
+    err = hipMemcpyHtoD(gpuScalars, refScale.data(), numTensors * sizeof(float));
+    if(scaling == HIPBLASLT_EXT_FP8_SCALING_CURRENT)
+        err = hipMemset(gpuScalars, 0, numTensors * sizeof(float));
+
+    auto hipblasltErr = hipblasltExtFp8Quantize(scaling, tensors.data(), numTensors, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<float> scalars(2 * numTensors);
+    err = hipMemcpyDtoH(scalars.data(), gpuScalars, 2 * numTensors * sizeof(float));
+
+    for(uint32_t t = 0; t < numTensors; t++)
+    {
+        const float scale = scalars[t];
+        EXPECT_EQ(scalars[numTensors + t], cpuAmax[t]);
+        EXPECT_NEAR(scale, refScale[t], 1e-6);
+
+        std::vector<hipblaslt_f8_fnuz> output(inputs[t].size());
+        err = hipMemcpyDtoH(
+            output.data(), tensors[t].output, output.size() * sizeof(hipblaslt_f8_fnuz));
+        for(std::size_t i = 0; i < output.size(); i++)
+        {
+            // Dequantized back with its scale, within one E4M3 step of the input
+            const float ref = inputs[t][i];
+            EXPECT_NEAR(float(output[i]) * scale, ref, std::abs(ref) / 8 + 1e-3);
+        }
+
+        err = hipFree(tensors[t].output);
+        err = hipFree(tensors[t].input);
+    }
+
+    err = hipFree(gpuScalars);
+}
+
+TEST(ExtOpTest, fp8QuantizeFailure)
+{
+    hipblasltExtFp8QuantizeTensor tensor{
+        nullptr, nullptr, nullptr, nullptr, 1, 1, HIP_R_32F, HIP_R_32F};
+
+    auto hipblasltErr
+        = hipblasltExtFp8Quantize(HIPBLASLT_EXT_FP8_SCALING_CURRENT, &tensor, 1, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // Every tensor needs a scale
+    tensor.outDatatype = HIP_R_8F_E4M3_FNUZ;
+    hipblasltErr = hipblasltExtFp8Quantize(HIPBLASLT_EXT_FP8_SCALING_DELAYED, &tensor, 1, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasltErr = hipblasltExtFp8Quantize(HIPBLASLT_EXT_FP8_SCALING_DELAYED,
+                                           &tensor,
+                                           HIPBLASLT_EXT_FP8_QUANTIZE_MAX_TENSORS + 1,
+                                           nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+}
+
+TEST_P(ExtOpSparseCompressTest, sparseCompressSuccess)
+{
+    const auto    opA     = GetParam();
+    const int64_t m       = 37;
+    const int64_t k       = 64;
+    const int64_t lda     = (opA == HIPBLAS_OP_N ? m : k) + 3;
+    const int64_t strideA = lda * (opA == HIPBLAS_OP_N ? k : m);
+    const int32_t batches = 2;
+    const int64_t groups  = k / 8;
+
+    std::vector<int8_t> a(strideA * batches, 0);
+    for(size_t i = 0; i < a.size(); i++)
+        a[i] = int8_t((i * 37 % 255) - 127);
+
+    size_t compressedBytes = 0, metadataBytes = 0;
+    auto   hipblasltErr    = hipblasltExtSparseCompressedSize(
+        HIP_R_8I, opA, m, k, lda, strideA, batches, &compressedBytes, &metadataBytes);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(metadataBytes, size_t(groups * m * batches));
+
+    int8_t*  gpuA{};
+    int8_t*  gpuCompressed{};
+    uint8_t* gpuMetadata{};
+    auto     err = hipMalloc(&gpuA, a.size());
+    err          = hipMalloc(&gpuCompressed, compressedBytes);
+    err          = hipMalloc(&gpuMetadata, metadataBytes);
+    err          = hipMemcpyHtoD(gpuA, a.data(), a.size());
+
+    hipblasltErr = hipblasltExtSparseCompress(
+        HIP_R_8I, opA, m, k, lda, strideA, batches, gpuA, gpuCompressed, gpuMetadata, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_SUCCESS);
+    err = hipDeviceSynchronize();
+    EXPECT_EQ(err, hipSuccess);
+
+    std::vector<int8_t>  compressed(compressedBytes);
+    std::vector<uint8_t> metadata(metadataBytes);
+    err = hipMemcpyDtoH(compressed.data(), gpuCompressed, compressedBytes);
+    err = hipMemcpyDtoH(metadata.data(), gpuMetadata, metadataBytes);
+
+    const int64_t ldc          = opA == HIPBLAS_OP_N ? lda : k / 2;
+    const int64_t strideC      = ldc * (opA == HIPBLAS_OP_N ? k / 2 : m);
+    auto          opAt         = [&](int32_t b, int64_t row, int64_t col) {
+        return opA == HIPBLAS_OP_N ? a[b * strideA + row + col * lda]
+                                   : a[b * strideA + col + row * lda];
+    };
+    auto          compressedAt = [&](int32_t b, int64_t row, int64_t col) {
+        return opA == HIPBLAS_OP_N ? compressed[b * strideC + row + col * ldc]
+                                   : compressed[b * strideC + col + row * ldc];
+    };
+
+    for(int32_t b = 0; b < batches; b++)
+        for(int64_t row = 0; row < m; row++)
+            for(int64_t col = 0; col < k; col += 4)
+            {
+                // The positions of the 2 largest magnitudes, the first on ties, in order
+                int idx[4] = {0, 1, 2, 3};
+                std::stable_sort(idx, idx + 4, [&](int x, int y) {
+                    return std::abs(opAt(b, row, col + x)) > std::abs(opAt(b, row, col + y));
+                });
+                std::sort(idx, idx + 2);
+
+                const uint8_t byte   = metadata[(b * m + row) * groups + col / 8];
+                const int     nibble = (byte >> (col % 8 == 0 ? 0 : 4)) & 0xf;
+                EXPECT_EQ(nibble, idx[0] | idx[1] << 2);
+                EXPECT_EQ(compressedAt(b, row, col / 2), opAt(b, row, col + idx[0]));
+                EXPECT_EQ(compressedAt(b, row, col / 2 + 1), opAt(b, row, col + idx[1]));
+            }
+
+    err = hipFree(gpuA);
+    err = hipFree(gpuCompressed);
+    err = hipFree(gpuMetadata);
+}
+
+TEST(ExtOpTest, sparseCompressFailure)
+{
+    size_t compressedBytes = 0, metadataBytes = 0;
+    auto   hipblasltErr    = hipblasltExtSparseCompressedSize(
+        HIP_R_32F, HIPBLAS_OP_N, 16, 16, 16, 0, 1, &compressedBytes, &metadataBytes);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // k must be a multiple of 8
+    hipblasltErr = hipblasltExtSparseCompressedSize(
+        HIP_R_16F, HIPBLAS_OP_N, 16, 12, 16, 0, 1, &compressedBytes, &metadataBytes);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasltErr = hipblasltExtSparseCompress(
+        HIP_R_16F, HIPBLAS_OP_T, 16, 16, 16, 0, 1, nullptr, nullptr, nullptr, nullptr);
+    EXPECT_EQ(hipblasltErr, HIPBLAS_STATUS_INVALID_VALUE);
+}
+
 INSTANTIATE_TEST_SUITE_P(ExtOpTest, ExtOpSoftmaxTest, testing::Values<uint32_t>(1, 16, 1335));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpSoftmaxLongRowTest,
+                         testing::Values(std::make_pair(16u, 257u),
+                                         std::make_pair(3u, 32000u),
+                                         std::make_pair(1u, 131072u + 7u)));
 INSTANTIATE_TEST_SUITE_P(ExtOpTest,
                          ExtOpSoftmaxUnsupportedDatatypeTest,
                          testing::Values<hipDataType>(HIP_R_16F, HIP_R_16BF));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest, ExtOpScaleMaskSoftmaxTest, testing::Bool());
+INSTANTIATE_TEST_SUITE_P(ExtOpTest, ExtOpAttentionTest, testing::Bool());
 
 INSTANTIATE_TEST_SUITE_P(ExtOpTest,
                          ExtOpLayerNormTest,
@@ -569,6 +1770,22 @@ INSTANTIATE_TEST_SUITE_P(ExtOpTest,
                          ExtOpLayerNormUnsupportedDatatypeTest,
                          testing::Values<hipDataType>(HIP_R_16F, HIP_R_16BF));
 
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpLayerNormBackwardTest,
+                         testing::Values<uint32_t>(1, 16, 1335));
+
+INSTANTIATE_TEST_SUITE_P(ExtOpTest, ExtOpRMSNormTest, testing::Values<uint32_t>(1, 16, 1335));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpRMSNormUnsupportedDatatypeTest,
+                         testing::Values<hipDataType>(HIP_R_64F, HIP_R_8F_E4M3_FNUZ));
+
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpLayerNormAMaxWithScaleTest,
+                         testing::Values<uint32_t>(1, 16, 1335));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpLayerNormAMaxWithScaleUnsupportedDatatypeTest,
+                         testing::Values<hipDataType>(HIP_R_64F, HIP_R_8F_E4M3_FNUZ));
+
 INSTANTIATE_TEST_SUITE_P(
     ExtOpTest,
     ExtOpAMaxTest,
@@ -622,3 +1839,14 @@ INSTANTIATE_TEST_SUITE_P(
 INSTANTIATE_TEST_SUITE_P(ExtOpTest,
                          ExtOpAMaxWithScaleUnsupportedDatatypeTest,
                          testing::Values<hipDataType>(HIP_R_16BF));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpAMaxWithBlockScaleTest,
+                         testing::Values<hipblasltExtAMaxScaleMode_t>(
+                             HIPBLASLT_EXT_AMAX_SCALE_ROW, HIPBLASLT_EXT_AMAX_SCALE_BLOCK));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpFp8QuantizeTest,
+                         testing::Values<hipblasltExtFp8Scaling_t>(
+                             HIPBLASLT_EXT_FP8_SCALING_CURRENT, HIPBLASLT_EXT_FP8_SCALING_DELAYED));
+INSTANTIATE_TEST_SUITE_P(ExtOpTest,
+                         ExtOpSparseCompressTest,
+                         testing::Values<hipblasOperation_t>(HIPBLAS_OP_N, HIPBLAS_OP_T));
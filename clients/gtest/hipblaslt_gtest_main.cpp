@@ -29,7 +29,13 @@
 #include "hipblaslt_test.hpp"
 #include "test_cleanup.hpp"
 #include "utility.hpp"
+#include <atomic>
 #include <string>
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using namespace testing;
 
@@ -45,6 +51,7 @@ public:
     bool showInlineFailures = true; // Show each failure as it occurs.
     bool showEnvironment    = true; // Show the setup of the global environment.
     bool showInlineSkips    = true; // Show when we skip a test.
+    bool showSummary        = true; // Show the test count and the result of each iteration.
 
     explicit ConfigurableEventListener(TestEventListener* theEventListener)
         : eventListener(theEventListener)
@@ -63,7 +70,8 @@ public:
 
     void OnTestIterationStart(const UnitTest& unit_test, int iteration) override
     {
-        eventListener->OnTestIterationStart(unit_test, iteration);
+        if(showSummary)
+            eventListener->OnTestIterationStart(unit_test, iteration);
     }
 
     void OnEnvironmentsSetUpStart(const UnitTest& unit_test) override
@@ -133,19 +141,94 @@ public:
 
     void OnTestIterationEnd(const UnitTest& unit_test, int iteration) override
     {
-        eventListener->OnTestIterationEnd(unit_test, iteration);
+        if(showSummary)
+            eventListener->OnTestIterationEnd(unit_test, iteration);
     }
 
     void OnTestProgramEnd(const UnitTest& unit_test) override
     {
-        if(skipped_tests)
+        if(skipped_tests && showSummary)
             hipblaslt_cout << "[ SKIPPED  ] " << skipped_tests << " tests." << std::endl;
         eventListener->OnTestProgramEnd(unit_test);
     }
 };
 
-// Set the listener for Google Tests
-static void hipblaslt_set_listener()
+#ifndef WIN32
+// Queue of the tests shared by the device workers of --parallel_devices. Every worker
+// instantiates the same tests in the same order, so the n-th test started by any worker is the
+// same test, and the first worker to claim its slot runs it while the others skip it.
+struct parallel_test_queue
+{
+    enum : uint8_t
+    {
+        unclaimed,
+        running,
+        passed,
+        failed,
+    };
+
+    static constexpr size_t max_tests = size_t(1) << 24;
+
+    std::atomic<size_t>  tests; // Tests to run, stored by each worker
+    std::atomic<uint8_t> status[max_tests];
+};
+
+class ParallelTestListener : public EmptyTestEventListener
+{
+    parallel_test_queue&     queue;
+    const std::string        device;
+    size_t                   next    = 0; // Slot of the next test started
+    bool                     claimed = false; // Whether this worker runs the current test
+    std::vector<std::string> failures;
+
+public:
+    ParallelTestListener(parallel_test_queue& queue, const std::string& device)
+        : queue(queue)
+        , device(device)
+    {
+    }
+
+    void OnTestIterationStart(const UnitTest& unit_test, int iteration) override
+    {
+        queue.tests = unit_test.test_to_run_count();
+    }
+
+    void OnTestStart(const TestInfo& test_info) override
+    {
+        size_t  slot     = next++;
+        uint8_t expected = parallel_test_queue::unclaimed;
+        uint8_t running  = parallel_test_queue::running;
+
+        claimed = slot < parallel_test_queue::max_tests
+                  && queue.status[slot].compare_exchange_strong(expected, running);
+        // A skip recorded before the test object is created keeps the test from running
+        if(!claimed)
+            GTEST_SKIP();
+    }
+
+    void OnTestEnd(const TestInfo& test_info) override
+    {
+        if(!claimed)
+            return;
+
+        bool failure = test_info.result()->Failed();
+        queue.status[next - 1]
+            = failure ? parallel_test_queue::failed : parallel_test_queue::passed;
+        if(failure)
+            failures.push_back(std::string(test_info.test_case_name()) + "." + test_info.name());
+    }
+
+    void OnTestProgramEnd(const UnitTest& unit_test) override
+    {
+        for(auto& name : failures)
+            hipblaslt_cout << "[  FAILED  ] " << name << " on device " << device << std::endl;
+    }
+};
+
+#endif
+
+// Set the listener for Google Tests, a device worker of --parallel_devices also passes its own
+static void hipblaslt_set_listener(TestEventListener* parallel_listener = nullptr)
 {
     // remove the default listener
     auto& listeners       = testing::UnitTest::GetInstance()->listeners();
@@ -171,6 +254,18 @@ static void hipblaslt_set_listener()
     }
 
     listeners.Append(listener);
+
+    // Only the failures of a worker are shown, the parent prints the combined result
+    if(parallel_listener)
+    {
+        listener->showTestCases   = false;
+        listener->showTestNames   = false;
+        listener->showSuccesses   = false;
+        listener->showInlineSkips = false;
+        listener->showEnvironment = false;
+        listener->showSummary     = false;
+        listeners.Append(parallel_listener);
+    }
 }
 
 static int hipblaslt_version()
@@ -215,6 +310,151 @@ static void hipblaslt_print_args(const std::string& args)
     hipblaslt_cout.flush();
 }
 
+#ifndef WIN32
+// Remove --parallel_devices <n> from the command line, returns -1 when it is not given
+static int hipblaslt_parse_parallel_devices(int& argc, char** argv)
+{
+    int    devices = -1;
+    char** argv_p  = argv + 1;
+
+    for(int i = 1; argv[i]; ++i)
+    {
+        if(!strcmp(argv[i], "--parallel_devices"))
+        {
+            if(!argv[i + 1] || !argv[i + 1][0])
+            {
+                // hipblaslt_cout starts a writer thread, which would not survive the fork
+                std::cerr << "The " << argv[i] << " option requires an argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            devices = std::max(atoi(argv[++i]), 0);
+        }
+        else
+            *argv_p++ = argv[i];
+    }
+
+    *argv_p = nullptr;
+    argc    = argv_p - argv;
+    return devices;
+}
+
+// Count the devices in a child process, so that HIP is not initialized before the fork
+static int hipblaslt_count_devices()
+{
+    pid_t pid = fork();
+    if(pid == 0)
+    {
+        int count = 0;
+        if(hipGetDeviceCount(&count) != hipSuccess)
+            count = 0;
+        _exit(std::min(count, 255));
+    }
+
+    int status = 0;
+    if(pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status))
+        return 0;
+    return WEXITSTATUS(status);
+}
+
+/*! \brief Fork one worker process per device, each running the tests that it claims first.
+ *
+ * Returns the device of the worker in each worker, after restricting HIP_VISIBLE_DEVICES to it.
+ * The parent waits for the workers, prints the combined result and exits with it.
+ */
+static std::string hipblaslt_fork_device_workers(int                   devices,
+                                                 parallel_test_queue*& queue,
+                                                 const std::string&    args)
+{
+    if(!devices)
+        devices = hipblaslt_count_devices();
+    if(!devices)
+    {
+        std::cerr << "Error: no devices found for --parallel_devices" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    void* shared = mmap(nullptr,
+                        sizeof(parallel_test_queue),
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE,
+                        -1,
+                        0);
+    if(shared == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+    queue = static_cast<parallel_test_queue*>(shared);
+
+    // The devices are numbered within the ones HIP_VISIBLE_DEVICES already selects
+    std::vector<std::string> ids;
+    if(const char* visible = getenv("HIP_VISIBLE_DEVICES"))
+    {
+        std::istringstream list(visible);
+        for(std::string id; std::getline(list, id, ',');)
+            ids.push_back(id);
+    }
+
+    std::vector<std::pair<pid_t, std::string>> workers;
+    for(int i = 0; i < devices; i++)
+    {
+        std::string device = size_t(i) < ids.size() ? ids[i] : std::to_string(i);
+        pid_t       pid    = fork();
+        if(pid == 0)
+        {
+            setenv("HIP_VISIBLE_DEVICES", device.c_str(), 1);
+            return device;
+        }
+        if(pid < 0)
+        {
+            perror("fork");
+            break;
+        }
+        workers.emplace_back(pid, device);
+    }
+
+    bool worker_failed = false;
+    for(auto& worker : workers)
+    {
+        int status = 0;
+        waitpid(worker.first, &status, 0);
+        if(WIFSIGNALED(status))
+        {
+            hipblaslt_cerr << "Worker on device " << worker.second << " terminated by signal "
+                           << WTERMSIG(status) << std::endl;
+            worker_failed = true;
+        }
+        else if(!WIFEXITED(status) || WEXITSTATUS(status))
+            worker_failed = true;
+    }
+
+    size_t counts[4] = {};
+    size_t tests     = std::min(queue->tests.load(), parallel_test_queue::max_tests);
+    for(size_t i = 0; i < tests; i++)
+        counts[queue->status[i]]++;
+
+    size_t ran = counts[parallel_test_queue::passed] + counts[parallel_test_queue::failed];
+    hipblaslt_cout << "[==========] " << ran << " of " << tests << " tests ran on "
+                   << workers.size() << " devices." << std::endl;
+    hipblaslt_cout << "[  PASSED  ] " << counts[parallel_test_queue::passed] << " tests."
+                   << std::endl;
+    if(counts[parallel_test_queue::failed])
+        hipblaslt_cout << "[  FAILED  ] " << counts[parallel_test_queue::failed]
+                       << " tests, listed above." << std::endl;
+    if(counts[parallel_test_queue::running])
+        hipblaslt_cout << "[  FAILED  ] " << counts[parallel_test_queue::running]
+                       << " tests did not finish, their worker exited." << std::endl;
+    if(counts[parallel_test_queue::unclaimed])
+        hipblaslt_cout << "[  FAILED  ] " << counts[parallel_test_queue::unclaimed]
+                       << " tests were not run." << std::endl;
+
+    hipblaslt_print_args(args);
+
+    bool failure = worker_failed || ran != tests || counts[parallel_test_queue::failed];
+    exit(failure ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+#endif
+
 // Device Query
 static void hipblaslt_set_test_device()
 {
@@ -235,15 +475,29 @@ int main(int argc, char** argv)
 {
     std::string args = hipblaslt_capture_args(argc, argv);
 
+    TestEventListener* parallel_listener = nullptr;
+#ifndef WIN32
+    // Fork the device workers before HIP or the output writer threads are started
+    int parallel_devices = hipblaslt_parse_parallel_devices(argc, argv);
+    if(parallel_devices >= 0)
+    {
+        parallel_test_queue* queue  = nullptr;
+        std::string          device = hipblaslt_fork_device_workers(parallel_devices, queue, args);
+        parallel_listener           = new ParallelTestListener(*queue, device);
+    }
+#endif
+
     // Set signal handler
     hipblaslt_test_sigaction();
 
-    hipblaslt_print_version();
+    if(!parallel_listener)
+        hipblaslt_print_version();
 
     // Set test device
     hipblaslt_set_test_device();
 
-    hipblaslt_print_usage_warning();
+    if(!parallel_listener)
+        hipblaslt_print_usage_warning();
 
     // Set data file path
     hipblaslt_parse_data(argc, argv, hipblaslt_exepath() + "hipblaslt_gtest.data");
@@ -255,11 +509,15 @@ int main(int argc, char** argv)
     test_cleanup::cleanup();
 
     // Set Google Test listener
-    hipblaslt_set_listener();
+    hipblaslt_set_listener(parallel_listener);
 
     // Run the tests
     int status = RUN_ALL_TESTS();
 
+    // A device worker leaves the version and the command line to its parent
+    if(parallel_listener)
+        return status;
+
     // Failures printed at end for reporting so repeat version info
     hipblaslt_print_version();
 
@@ -79,6 +79,8 @@ namespace
 #endif
             || (std::is_same<TiA, double>{} && std::is_same<TiB, double>{})
             || (std::is_same<TiA, hipblasLtInt8>{} && std::is_same<TiB, hipblasLtInt8>{})
+            || (std::is_same<TiA, hipblasLtHalf>{} && std::is_same<TiB, hipblasLtInt8>{})
+            || (std::is_same<TiA, hip_bfloat16>{} && std::is_same<TiB, hipblasLtInt8>{})
             || (std::is_same<TiA, hipblaslt_f8_fnuz>{} && std::is_same<TiB, hipblasLtHalf>{})
             || (std::is_same<TiA, hipblasLtHalf>{} && std::is_same<TiB, hipblaslt_f8_fnuz>{})>>
         : hipblaslt_test_valid
@@ -166,11 +168,15 @@ namespace
                     name << "_SA";
                 else if(arg.scaleA == hipblaslt_scaling_format::Vector)
                     name << "_SAV";
+                else if(arg.scaleA == hipblaslt_scaling_format::Block)
+                    name << "_SABlk";
 
                 if(arg.scaleB == hipblaslt_scaling_format::Scalar)
                     name << "_SB";
                 else if(arg.scaleB == hipblaslt_scaling_format::Vector)
                     name << "_SBV";
+                else if(arg.scaleB == hipblaslt_scaling_format::Block)
+                    name << "_SBBlk";
 
                 if(arg.scaleC)
                     name << "_SC";
@@ -184,6 +190,9 @@ namespace
                 if(arg.scaleAlpha_vector)
                     name << "_SAV";
 
+                if(arg.pointer_mode_device)
+                    name << "_PMDevice";
+
                 if(arg.amaxScaleA)
                     name << "_ASA";
 
@@ -193,6 +202,33 @@ namespace
                 if(arg.amaxD)
                     name << "_AMaxD";
 
+                if(arg.scaleD_vector)
+                    name << "_SDV" << arg.scaleD_vector;
+
+                if(arg.d2_type != HIPBLASLT_DATATYPE_INVALID)
+                    name << "_D2" << hip_datatype_to_string(arg.d2_type);
+
+                if(arg.aux_type != HIPBLASLT_DATATYPE_INVALID)
+                    name << "_Aux" << hip_datatype_to_string(arg.aux_type);
+
+                if(arg.aux_amax)
+                    name << "_AMaxAux";
+
+                if(arg.bgrad_deterministic)
+                    name << "_BGradDet";
+
+                if(arg.residual_position)
+                    name << "_RES" << arg.residual_position;
+
+                if(arg.dropout > 0)
+                    name << "_DO" << int(arg.dropout * 100);
+
+                if(arg.amax_history)
+                    name << "_AH" << arg.amax_history;
+
+                if(arg.b_quant_group)
+                    name << "_BQ" << arg.b_quant_group << (arg.b_quant_int4 ? "I4" : "");
+
                 if(arg.grouped_gemm > 0)
                     name << "_GG" << arg.grouped_gemm;
 
@@ -1151,11 +1151,614 @@ TEST(MatrixTransformTest, ScalarsOnDevice)
                       transB);
 }
 
+TEST(MatrixTransformTest, ConvertToFp8WithScale)
+{
+    int64_t m         = 256;
+    int64_t n         = 192;
+    float   alpha     = 1;
+    float   beta      = 0;
+    float   scale     = 0.5;
+    auto    opA       = HIPBLAS_OP_T;
+    auto    orderA    = HIPBLASLT_ORDER_ROW;
+    auto    orderC    = HIPBLASLT_ORDER_ROW;
+    int32_t saturate  = 1;
+    int64_t ldA       = m;
+    int64_t ldC       = n;
+
+    // A is n x m and transposed, values up to 500 * scale cover the clipping at 240
+    std::vector<hipblasLtHalf> hA(m * n);
+    for(size_t i = 0; i < hA.size(); ++i)
+    {
+        hA[i] = hipblasLtHalf(float(int(i % 251) - 125) * 4);
+    }
+
+    void*  dA{};
+    void*  dC{};
+    float* dScale{};
+    auto   hipErr = hipMalloc(&dA, hA.size() * sizeof(hipblasLtHalf));
+    hipErr        = hipMalloc(&dC, m * n * sizeof(hipblaslt_f8_fnuz));
+    hipErr        = hipMalloc(&dScale, sizeof(float));
+    hipErr        = hipMemcpy(dA, hA.data(), hA.size() * sizeof(hipblasLtHalf), hipMemcpyHostToDevice);
+    hipErr        = hipMemcpy(dScale, &scale, sizeof(float), hipMemcpyHostToDevice);
+    ASSERT_EQ(hipErr, hipSuccess);
+
+    hipblasLtMatrixTransformDesc_t desc;
+    auto hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+    hipblasLtErr      = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSA, &opA, sizeof(opA));
+    hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_C_SCALE_POINTER, &dScale, sizeof(dScale));
+    hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_SATURATE, &saturate, sizeof(saturate));
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+    hipblasLtMatrixLayout_t layoutA, layoutC;
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutA, HIP_R_16F, n, m, ldA);
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, HIP_R_8F_E4M3_FNUZ, m, n, ldC);
+    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+        layoutA, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderA, sizeof(orderA));
+    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+        layoutC, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderC, sizeof(orderC));
+    hipblasLtHandle_t handle{};
+    hipblasLtErr = hipblasLtCreate(&handle);
+    hipblasLtErr = hipblasLtMatrixTransform(
+        handle, desc, &alpha, dA, layoutA, &beta, nullptr, nullptr, dC, layoutC, nullptr);
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    std::vector<hipblaslt_f8_fnuz> hC(m * n);
+    hipErr = hipMemcpy(hC.data(), dC, hC.size() * sizeof(hipblaslt_f8_fnuz), hipMemcpyDeviceToHost);
+    ASSERT_EQ(hipErr, hipSuccess);
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        for(int64_t j = 0; j < n; ++j)
+        {
+            const auto ref = hipblaslt_f8_fnuz(float(hA[j * ldA + i]) * scale);
+            ASSERT_EQ(hC[i * ldC + j].data, ref.data) << "at (" << i << ", " << j << ")";
+        }
+    }
+
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtDestroy(handle);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
+    hipErr       = hipFree(dA);
+    hipErr       = hipFree(dC);
+    hipErr       = hipFree(dScale);
+}
+
+TEST(MatrixTransformTest, BatchPointerArray)
+{
+    int64_t m          = 20;
+    int64_t n          = 24;
+    int32_t batchCount = 100;
+    float   alpha      = 2;
+    float   beta       = 0;
+    auto    opA        = HIPBLAS_OP_T;
+    auto    orderC     = HIPBLASLT_ORDER_ROW;
+    int32_t ptrArray   = 1;
+    int64_t ldA        = n;
+    int64_t ldC        = n;
+    int64_t stride     = m * n + 1;
+
+    // A is column major n x m and transposed. Every other matrix starts at an odd offset so
+    // that both the vectorized and the scalar accesses are covered.
+    std::vector<float> hA(stride * batchCount);
+    for(size_t i = 0; i < hA.size(); ++i)
+    {
+        hA[i] = float(int(i % 97) - 48);
+    }
+
+    float* dA{};
+    float* dC{};
+    void*  dPtrA{};
+    void*  dPtrC{};
+    auto   hipErr = hipMalloc(&dA, hA.size() * sizeof(float));
+    hipErr        = hipMalloc(&dC, stride * batchCount * sizeof(float));
+    hipErr        = hipMalloc(&dPtrA, batchCount * sizeof(float*));
+    hipErr        = hipMalloc(&dPtrC, batchCount * sizeof(float*));
+    hipErr        = hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice);
+
+    std::vector<const float*> hPtrA(batchCount);
+    std::vector<float*>       hPtrC(batchCount);
+    for(int32_t k = 0; k < batchCount; ++k)
+    {
+        hPtrA[k] = dA + k * stride + k % 2;
+        hPtrC[k] = dC + k * stride + k % 2;
+    }
+    hipErr = hipMemcpy(dPtrA, hPtrA.data(), batchCount * sizeof(float*), hipMemcpyHostToDevice);
+    hipErr = hipMemcpy(dPtrC, hPtrC.data(), batchCount * sizeof(float*), hipMemcpyHostToDevice);
+    ASSERT_EQ(hipErr, hipSuccess);
+
+    hipblasLtMatrixTransformDesc_t desc;
+    auto hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+    hipblasLtErr      = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSA, &opA, sizeof(opA));
+    hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_BATCH_POINTER_ARRAY, &ptrArray, sizeof(ptrArray));
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+    hipblasLtMatrixLayout_t layoutA, layoutC;
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutA, HIP_R_32F, n, m, ldA);
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, HIP_R_32F, m, n, ldC);
+    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+        layoutC, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderC, sizeof(orderC));
+    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+        layoutA, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batchCount, sizeof(batchCount));
+    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+        layoutC, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batchCount, sizeof(batchCount));
+    hipblasLtHandle_t handle{};
+    hipblasLtErr = hipblasLtCreate(&handle);
+    hipblasLtErr = hipblasLtMatrixTransform(
+        handle, desc, &alpha, dPtrA, layoutA, &beta, nullptr, nullptr, dPtrC, layoutC, nullptr);
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    std::vector<float> hC(stride * batchCount);
+    hipErr = hipMemcpy(hC.data(), dC, hC.size() * sizeof(float), hipMemcpyDeviceToHost);
+    ASSERT_EQ(hipErr, hipSuccess);
+
+    for(int32_t k = 0; k < batchCount; ++k)
+    {
+        const auto a = hA.data() + k * stride + k % 2;
+        const auto c = hC.data() + k * stride + k % 2;
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            for(int64_t j = 0; j < n; ++j)
+            {
+                ASSERT_EQ(c[i * ldC + j], alpha * a[i * ldA + j])
+                    << "batch " << k << " at (" << i << ", " << j << ")";
+            }
+        }
+    }
+
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtDestroy(handle);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
+    hipErr       = hipFree(dA);
+    hipErr       = hipFree(dC);
+    hipErr       = hipFree(dPtrA);
+    hipErr       = hipFree(dPtrC);
+}
+
+TEST(MatrixTransformTest, InPlaceTranspose)
+{
+    // {m, n, ld of A}: square with padding and packed rectangular matrices
+    const std::vector<std::tuple<int64_t, int64_t, int64_t>> sizes{
+        {96, 96, 100}, {75, 75, 75}, {64, 48, 64}, {37, 100, 37}};
+    float   alpha      = 2;
+    float   beta       = 0;
+    auto    orderC     = HIPBLASLT_ORDER_ROW;
+    int32_t batchCount = 2;
+
+    for(const auto& size : sizes)
+    {
+        const auto [m, n, ld] = size;
+        // A is column major m x n, C the row major m x n result in the same buffer
+        const int64_t ldC    = m == n ? ld : n;
+        const int64_t stride = std::max(ld * n, ldC * m);
+
+        std::vector<float> hA(stride * batchCount);
+        for(size_t i = 0; i < hA.size(); ++i)
+        {
+            hA[i] = float(int(i % 113) - 56);
+        }
+
+        float* dA{};
+        auto   hipErr = hipMalloc(&dA, hA.size() * sizeof(float));
+        hipErr        = hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        hipblasLtMatrixTransformDesc_t desc;
+        auto hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+        ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+        hipblasLtMatrixLayout_t layoutA, layoutC;
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutA, HIP_R_32F, m, n, ld);
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, HIP_R_32F, m, n, ldC);
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layoutC, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderC, sizeof(orderC));
+        for(auto layout : {layoutA, layoutC})
+        {
+            hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+                layout, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batchCount, sizeof(batchCount));
+            hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+                layout, HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, &stride, sizeof(stride));
+        }
+        hipblasLtHandle_t handle{};
+        hipblasLtErr = hipblasLtCreate(&handle);
+        hipblasLtErr = hipblasLtMatrixTransform(
+            handle, desc, &alpha, dA, layoutA, &beta, nullptr, nullptr, dA, layoutC, nullptr);
+        ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+        std::vector<float> hC(hA.size());
+        hipErr = hipMemcpy(hC.data(), dA, hC.size() * sizeof(float), hipMemcpyDeviceToHost);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        for(int32_t k = 0; k < batchCount; ++k)
+        {
+            for(int64_t i = 0; i < m; ++i)
+            {
+                for(int64_t j = 0; j < n; ++j)
+                {
+                    ASSERT_EQ(hC[k * stride + i * ldC + j], alpha * hA[k * stride + j * ld + i])
+                        << m << "x" << n << " batch " << k << " at (" << i << ", " << j << ")";
+                }
+            }
+        }
+
+        hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+        hipblasLtErr = hipblasLtDestroy(handle);
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
+        hipErr       = hipFree(dA);
+    }
+}
+
+TEST(MatrixTransformTest, TiledOrders)
+{
+    int64_t m     = 40;
+    int64_t n     = 70;
+    float   alpha = 1;
+    float   beta  = 0;
+
+    // {order, ld, allocated elements} of the tiled copies
+    const std::vector<std::tuple<hipblasLtOrder_t, int64_t, int64_t>> orders{
+        {HIPBLASLT_ORDER_COL32, 32 * m, 32 * m * ((n + 31) / 32)},
+        {HIPBLASLT_ORDER_COL16_4R8, 16 * 64, 16 * 64 * ((n + 15) / 16)}};
+    auto tiledOffset = [](hipblasLtOrder_t order, int64_t row, int64_t col, int64_t ld) {
+        return order == HIPBLASLT_ORDER_COL32
+                   ? (col / 32) * ld + row * 32 + col % 32
+                   : (col / 16) * ld + (row / 32) * 512 + (row % 32 / 8) * 128 + (col % 16) * 8
+                         + row % 8;
+    };
+
+    std::vector<int8_t> hA(m * n);
+    for(size_t i = 0; i < hA.size(); ++i)
+    {
+        hA[i] = int8_t(int(i % 201) - 100);
+    }
+
+    int8_t* dA{};
+    auto    hipErr = hipMalloc(&dA, hA.size());
+    hipErr         = hipMemcpy(dA, hA.data(), hA.size(), hipMemcpyHostToDevice);
+    ASSERT_EQ(hipErr, hipSuccess);
+
+    hipblasLtHandle_t handle{};
+    auto              hipblasLtErr = hipblasLtCreate(&handle);
+    hipblasLtMatrixTransformDesc_t desc;
+    hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+    for(const auto& [order, ldT, numElements] : orders)
+    {
+        int8_t* dT{};
+        int8_t* dBack{};
+        hipErr = hipMalloc(&dT, numElements);
+        hipErr = hipMalloc(&dBack, hA.size());
+        hipErr = hipMemset(dT, 0x7f, numElements);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        hipblasLtMatrixLayout_t layoutCol, layoutTiled;
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutCol, HIP_R_8I, m, n, m);
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutTiled, HIP_R_8I, m, n, ldT);
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layoutTiled, HIPBLASLT_MATRIX_LAYOUT_ORDER, &order, sizeof(order));
+
+        // Column major to tiled and back
+        hipblasLtErr = hipblasLtMatrixTransform(
+            handle, desc, &alpha, dA, layoutCol, &beta, nullptr, nullptr, dT, layoutTiled, nullptr);
+        ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+        hipblasLtErr = hipblasLtMatrixTransform(
+            handle, desc, &alpha, dT, layoutTiled, &beta, nullptr, nullptr, dBack, layoutCol, nullptr);
+        ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+        std::vector<int8_t> hT(numElements);
+        std::vector<int8_t> hBack(hA.size());
+        hipErr = hipMemcpy(hT.data(), dT, hT.size(), hipMemcpyDeviceToHost);
+        hipErr = hipMemcpy(hBack.data(), dBack, hBack.size(), hipMemcpyDeviceToHost);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        // Every allocated element belongs to a tile, and the padding of the last tiles is zero
+        std::vector<int8_t> ref(numElements, 0);
+        for(int64_t i = 0; i < m; ++i)
+        {
+            for(int64_t j = 0; j < n; ++j)
+            {
+                ref[tiledOffset(order, i, j, ldT)] = hA[j * m + i];
+            }
+        }
+        ASSERT_EQ(hT, ref) << "order " << order;
+        ASSERT_EQ(hBack, hA) << "order " << order;
+
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutCol);
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutTiled);
+        hipErr       = hipFree(dT);
+        hipErr       = hipFree(dBack);
+    }
+
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtDestroy(handle);
+    hipErr       = hipFree(dA);
+}
+
+TEST(MatrixTransformTest, StreamingChunks)
+{
+    int64_t m          = 300;
+    int64_t n          = 257;
+    int32_t batchCount = 2;
+    int32_t chunkSize  = 64;
+    float   alpha      = 2;
+    float   beta       = -1;
+    auto    opA        = HIPBLAS_OP_T;
+    auto    orderA     = HIPBLASLT_ORDER_ROW;
+    int64_t ldA        = m + 3;
+    int64_t ldB        = m;
+    int64_t ldC        = m + 1;
+    int64_t strideA    = n * ldA;
+    int64_t strideB    = n * ldB;
+    int64_t strideC    = n * ldC;
+
+    // A is row major n x m and transposed, B and C are column major and stay in pinned host
+    // memory; n is not a multiple of the chunk size
+    float* hA{};
+    float* hB{};
+    float* hC{};
+    auto   hipErr = hipHostMalloc(&hA, strideA * batchCount * sizeof(float));
+    hipErr        = hipHostMalloc(&hB, strideB * batchCount * sizeof(float));
+    hipErr        = hipHostMalloc(&hC, strideC * batchCount * sizeof(float));
+    ASSERT_EQ(hipErr, hipSuccess);
+
+    for(int64_t i = 0; i < strideA * batchCount; ++i)
+    {
+        hA[i] = float(int(i % 97) - 48);
+    }
+    for(int64_t i = 0; i < strideB * batchCount; ++i)
+    {
+        hB[i] = float(int(i % 89) - 44);
+    }
+    std::fill(hC, hC + strideC * batchCount, 0.f);
+
+    hipblasLtMatrixTransformDesc_t desc;
+    auto hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+    hipblasLtErr      = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSA, &opA, sizeof(opA));
+    hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_STREAMING_CHUNK_SIZE, &chunkSize, sizeof(chunkSize));
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+    hipblasLtMatrixLayout_t layoutA, layoutB, layoutC;
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutA, HIP_R_32F, n, m, ldA);
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutB, HIP_R_32F, m, n, ldB);
+    hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, HIP_R_32F, m, n, ldC);
+    hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+        layoutA, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderA, sizeof(orderA));
+
+    const std::pair<hipblasLtMatrixLayout_t, int64_t> layouts[]
+        = {{layoutA, strideA}, {layoutB, strideB}, {layoutC, strideC}};
+    for(const auto& [layout, stride] : layouts)
+    {
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layout, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batchCount, sizeof(batchCount));
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layout, HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, &stride, sizeof(stride));
+    }
+
+    hipblasLtHandle_t handle{};
+    hipblasLtErr = hipblasLtCreate(&handle);
+    hipblasLtErr = hipblasLtMatrixTransform(
+        handle, desc, &alpha, hA, layoutA, &beta, hB, layoutB, hC, layoutC, nullptr);
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipStreamSynchronize(nullptr), hipSuccess);
+
+    for(int32_t k = 0; k < batchCount; ++k)
+    {
+        const auto a = hA + k * strideA;
+        const auto b = hB + k * strideB;
+        const auto c = hC + k * strideC;
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            for(int64_t j = 0; j < n; ++j)
+            {
+                ASSERT_EQ(c[j * ldC + i], alpha * a[j * ldA + i] + beta * b[j * ldB + i])
+                    << "batch " << k << " at (" << i << ", " << j << ")";
+            }
+        }
+    }
+
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtDestroy(handle);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutB);
+    hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
+    hipErr       = hipHostFree(hA);
+    hipErr       = hipHostFree(hB);
+    hipErr       = hipHostFree(hC);
+}
+
+TEST(MatrixTransformTest, PartiallyAlignedOperands)
+{
+    // fp16 operands that start 4 bytes past a 16-byte boundary with padded leading dimensions
+    // only allow some of the vector widths, on square, short and skinny shapes
+    const std::tuple<int64_t, int64_t, int64_t> configs[] = {{257, 130, 2}, {3, 1000, 6}, {1000, 2, 4}};
+    float alpha = 1;
+    float beta  = 3;
+    auto  opB   = HIPBLAS_OP_T;
+
+    hipblasLtHandle_t handle{};
+    auto              hipblasLtErr = hipblasLtCreate(&handle);
+    hipblasLtMatrixTransformDesc_t desc;
+    hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+    hipblasLtErr = hipblasLtMatrixTransformDescSetAttribute(
+        desc, HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSB, &opB, sizeof(opB));
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+    for(const auto& [m, n, pad] : configs)
+    {
+        // A and C are column major m x n, B is column major n x m and transposed
+        const int64_t ldA = m + pad;
+        const int64_t ldB = n + pad;
+        const int64_t ldC = m + pad;
+        const int64_t offset = 2;
+        std::vector<hipblasLtHalf> hA(ldA * n + offset);
+        std::vector<hipblasLtHalf> hB(ldB * m + offset);
+        for(size_t i = 0; i < hA.size(); ++i)
+        {
+            hA[i] = hipblasLtHalf(float(int(i % 31) - 15));
+        }
+        for(size_t i = 0; i < hB.size(); ++i)
+        {
+            hB[i] = hipblasLtHalf(float(int(i % 17) - 8));
+        }
+
+        hipblasLtHalf* dA{};
+        hipblasLtHalf* dB{};
+        hipblasLtHalf* dC{};
+        auto hipErr = hipMalloc(&dA, hA.size() * sizeof(hipblasLtHalf));
+        hipErr      = hipMalloc(&dB, hB.size() * sizeof(hipblasLtHalf));
+        hipErr      = hipMalloc(&dC, (ldC * n + offset) * sizeof(hipblasLtHalf));
+        hipErr = hipMemcpy(dA, hA.data(), hA.size() * sizeof(hipblasLtHalf), hipMemcpyHostToDevice);
+        hipErr = hipMemcpy(dB, hB.data(), hB.size() * sizeof(hipblasLtHalf), hipMemcpyHostToDevice);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        hipblasLtMatrixLayout_t layoutA, layoutB, layoutC;
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutA, HIP_R_16F, m, n, ldA);
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutB, HIP_R_16F, n, m, ldB);
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, HIP_R_16F, m, n, ldC);
+        hipblasLtErr = hipblasLtMatrixTransform(handle,
+                                                desc,
+                                                &alpha,
+                                                dA + offset,
+                                                layoutA,
+                                                &beta,
+                                                dB + offset,
+                                                layoutB,
+                                                dC + offset,
+                                                layoutC,
+                                                nullptr);
+        ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+        std::vector<hipblasLtHalf> hC(ldC * n + offset);
+        hipErr = hipMemcpy(hC.data(), dC, hC.size() * sizeof(hipblasLtHalf), hipMemcpyDeviceToHost);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            for(int64_t j = 0; j < n; ++j)
+            {
+                const float ref = alpha * float(hA[offset + j * ldA + i])
+                                  + beta * float(hB[offset + i * ldB + j]);
+                ASSERT_EQ(float(hC[offset + j * ldC + i]), ref)
+                    << m << "x" << n << " at (" << i << ", " << j << ")";
+            }
+        }
+
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutA);
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutB);
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layoutC);
+        hipErr       = hipFree(dA);
+        hipErr       = hipFree(dB);
+        hipErr       = hipFree(dC);
+    }
+
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtDestroy(handle);
+}
+
+TEST(MatrixTransformTest, GroupedJobs)
+{
+    // Weight-like matrices of different shapes, one of them empty, transposed from row major
+    // to column major C in one launch
+    const std::pair<int64_t, int64_t> shapes[] = {{1, 1}, {4096, 3}, {257, 130}, {0, 64}, {64, 1000}};
+    constexpr size_t numJobs = sizeof(shapes) / sizeof(shapes[0]);
+    float            alpha   = 2;
+    float            beta    = 0;
+    auto             orderA  = HIPBLASLT_ORDER_ROW;
+
+    hipblasLtHandle_t handle{};
+    auto              hipblasLtErr = hipblasLtCreate(&handle);
+    hipblasLtMatrixTransformDesc_t desc;
+    hipblasLtErr = hipblasLtMatrixTransformDescCreate(&desc, HIP_R_32F);
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+
+    std::vector<std::vector<float>>      hA(numJobs);
+    std::vector<float*>                  dA(numJobs);
+    std::vector<float*>                  dC(numJobs);
+    std::vector<hipblasLtMatrixLayout_t> layouts;
+    hipblasLtMatrixTransformJob_t        jobs[numJobs]{};
+
+    for(size_t k = 0; k < numJobs; ++k)
+    {
+        const auto [m, n] = shapes[k];
+        const int64_t ldA = n + 1;
+        hA[k].resize(std::max<int64_t>(m * ldA, 1));
+        for(size_t i = 0; i < hA[k].size(); ++i)
+        {
+            hA[k][i] = float(int((i + k) % 23) - 11);
+        }
+
+        auto hipErr = hipMalloc(&dA[k], hA[k].size() * sizeof(float));
+        hipErr      = hipMalloc(&dC[k], std::max<int64_t>(m * n, 1) * sizeof(float));
+        hipErr      = hipMemcpy(
+            dA[k], hA[k].data(), hA[k].size() * sizeof(float), hipMemcpyHostToDevice);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        hipblasLtMatrixLayout_t layoutA, layoutC;
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutA, HIP_R_32F, m, n, ldA);
+        hipblasLtErr = hipblasLtMatrixLayoutCreate(&layoutC, HIP_R_32F, m, n, m);
+        hipblasLtErr = hipblasLtMatrixLayoutSetAttribute(
+            layoutA, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderA, sizeof(orderA));
+        layouts.push_back(layoutA);
+        layouts.push_back(layoutC);
+        jobs[k] = {dA[k], layoutA, nullptr, nullptr, dC[k], layoutC};
+    }
+
+    hipblasLtErr
+        = hipblasLtMatrixTransformGrouped(handle, desc, &alpha, &beta, jobs, numJobs, nullptr);
+    ASSERT_EQ(hipblasLtErr, HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    for(size_t k = 0; k < numJobs; ++k)
+    {
+        const auto [m, n] = shapes[k];
+        const int64_t      ldA = n + 1;
+        std::vector<float> hC(m * n);
+        auto hipErr = hipMemcpy(hC.data(), dC[k], hC.size() * sizeof(float), hipMemcpyDeviceToHost);
+        ASSERT_EQ(hipErr, hipSuccess);
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            for(int64_t j = 0; j < n; ++j)
+            {
+                ASSERT_EQ(hC[j * m + i], alpha * hA[k][i * ldA + j])
+                    << "job " << k << " at (" << i << ", " << j << ")";
+            }
+        }
+
+        hipErr = hipFree(dA[k]);
+        hipErr = hipFree(dC[k]);
+    }
+
+    for(auto layout : layouts)
+    {
+        hipblasLtErr = hipblasLtMatrixLayoutDestroy(layout);
+    }
+    hipblasLtErr = hipblasLtMatrixTransformDescDestroy(desc);
+    hipblasLtErr = hipblasLtDestroy(handle);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     AllCombinations,
     MatrixTransformTest,
     ::testing::Combine(::testing::ValuesIn({int64_t(1), int64_t(127), int64_t(1024)}),
-                       ::testing::ValuesIn({int64_t(1), int64_t(127), int64_t(1024)}),
+                       ::testing::ValuesIn({int64_t(1), int64_t(48), int64_t(127), int64_t(1024)}),
                        ::testing::ValuesIn({HIP_R_32F, HIP_R_16F, HIP_R_16BF, HIP_R_8I, HIP_R_32I}),
                        ::testing::ValuesIn({HIP_R_32F}),
                        ::testing::ValuesIn({HIPBLAS_OP_N, HIPBLAS_OP_T}),
@@ -28,6 +28,7 @@
 
 #include "allclose.hpp"
 #include "cblas.h"
+#include "hipblaslt_math.hpp"
 #include "hipblaslt_ostream.hpp"
 #include "hipblaslt_vector.hpp"
 #include "utility.hpp"
@@ -66,14 +67,9 @@ bool allclose(size_t* N, T* a, T* b, double atol, double rtol, bool equal_nan =
     return true;
 }
 
-template <
-    typename T,
-    std::enable_if_t<!(std::is_same<T, hipblaslt_f8_fnuz>{} || std::is_same<T, hipblaslt_bf8_fnuz>{}
-#ifdef ROCM_USE_FLOAT8
-                       || std::is_same<T, hipblaslt_f8>{} || std::is_same<T, hipblaslt_bf8>{}
-#endif
-                ),
-              int> = 0>
+// Every (atol, rtol) pair of the grid is checked in one parallel pass over the matrices,
+// without converting them to double copies first
+template <typename T>
 bool allclose_check_general(char    allclose_type,
                             int64_t M,
                             int64_t N,
@@ -85,160 +81,44 @@ bool allclose_check_general(char    allclose_type,
 {
     if(M * N == 0)
         return 0;
-    size_t              size = N * (size_t)lda;
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(int64_t i = 0; i < N; i++)
-    {
-        for(int64_t j = 0; j < M; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(hCPU[idx]);
-            hGPU_double[idx] = double(hGPU[idx]);
-        }
-    }
-
-    std::vector<double> atols{1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
-    std::vector<double> rtols{1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
-    for(auto& atol : atols)
-    {
-        for(auto& rtol : rtols)
-        {
-            if(allclose(&size, hCPU_double.data(), hGPU_double.data(), atol, rtol, false))
-            {
-                hipblaslt_atol = atol;
-                hipblaslt_rtol = rtol;
-                //early termination for accending rtols
-                break;
-            }
-        }
-        //early termination for accending atols
-        if(hipblaslt_atol != 1)
-            break;
-    }
 
-    if(hipblaslt_atol == 1)
-    {
-        return false;
-    }
-
-    return true;
-}
-
-template <typename T,
-          std::enable_if_t<(std::is_same<T, hipblaslt_f8_fnuz>{}
-                            || std::is_same<T, hipblaslt_bf8_fnuz>{}),
-                           int> = 0>
-bool allclose_check_general(char    allclose_type,
-                            int64_t M,
-                            int64_t N,
-                            int64_t lda,
-                            T*      hCPU,
-                            T*      hGPU,
-                            double& hipblaslt_atol,
-                            double& hipblaslt_rtol)
-{
-    if(M * N == 0)
-        return 0;
-    size_t              size = N * (size_t)lda;
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
+    constexpr int tol_count       = 5;
+    const double  tols[tol_count] = {1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
 
+    // Bit atol_index * tol_count + rtol_index is set when some element fails that pair
+    uint32_t failed = 0;
+#pragma omp parallel for reduction(| : failed)
     for(int64_t i = 0; i < N; i++)
     {
         for(int64_t j = 0; j < M; j++)
         {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(float(hCPU[idx]));
-            hGPU_double[idx] = double(float(hGPU[idx]));
-        }
-    }
-
-    std::vector<double> atols{1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
-    std::vector<double> rtols{1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
-    for(auto& atol : atols)
-    {
-        for(auto& rtol : rtols)
-        {
-            if(allclose(&size, hCPU_double.data(), hGPU_double.data(), atol, rtol, false))
+            size_t idx   = j + i * (size_t)lda;
+            double b     = check_value(hGPU[idx]);
+            double error = std::abs(check_value(hCPU[idx]) - b);
+            for(int pair = 0; pair < tol_count * tol_count; pair++)
             {
-                hipblaslt_atol = atol;
-                hipblaslt_rtol = rtol;
-                //early termination for accending rtols
-                break;
+                double tolerance = tols[pair / tol_count] + std::abs(tols[pair % tol_count] * b);
+                failed |= uint32_t(!(error <= tolerance)) << pair;
             }
         }
-        //early termination for accending atols
-        if(hipblaslt_atol != 1)
-            break;
     }
 
-    if(hipblaslt_atol == 1)
+    // Smallest passing atol first, then the smallest rtol with it
+    for(int a = 0; a < tol_count; a++)
     {
-        return false;
-    }
-
-    return true;
-}
-
-#ifdef ROCM_USE_FLOAT8
-template <
-    typename T,
-    std::enable_if_t<(std::is_same<T, hipblaslt_f8>{} || std::is_same<T, hipblaslt_bf8>{}),
-                     int> = 0>
-bool allclose_check_general(char    allclose_type,
-                            int64_t M,
-                            int64_t N,
-                            int64_t lda,
-                            T*      hCPU,
-                            T*      hGPU,
-                            double& hipblaslt_atol,
-                            double& hipblaslt_rtol)
-{
-    if(M * N == 0)
-        return 0;
-    size_t              size = N * (size_t)lda;
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(int64_t i = 0; i < N; i++)
-    {
-        for(int64_t j = 0; j < M; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(float(hCPU[idx]));
-            hGPU_double[idx] = double(float(hGPU[idx]));
-        }
-    }
-
-    std::vector<double> atols{1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
-    std::vector<double> rtols{1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
-    for(auto& atol : atols)
-    {
-        for(auto& rtol : rtols)
+        for(int r = 0; r < tol_count; r++)
         {
-            if(allclose(&size, hCPU_double.data(), hGPU_double.data(), atol, rtol, false))
+            if(!(failed & (1u << (a * tol_count + r))))
             {
-                hipblaslt_atol = atol;
-                hipblaslt_rtol = rtol;
-                //early termination for accending rtols
-                break;
+                hipblaslt_atol = tols[a];
+                hipblaslt_rtol = tols[r];
+                return true;
             }
         }
-        //early termination for accending atols
-        if(hipblaslt_atol != 1)
-            break;
     }
-
-    if(hipblaslt_atol == 1)
-    {
-        return false;
-    }
-
-    return true;
+    return false;
 }
-#endif
+
 // For BF16 and half, we convert the results to double first
 template <
     typename T,
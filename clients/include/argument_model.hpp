@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include "Tensile/Source/client/include/Utility.hpp"
+#include "baseline_comparison.hpp"
 #include "hipblaslt_arguments.hpp"
 #include <fstream>
 #include <string>
@@ -41,6 +43,18 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_log_frequencies(hipblaslt_internal_ostream& name_line,
                                    hipblaslt_internal_ostream& val_line);
 
+// Peak over lowest average SYSCLK of the last timed region, 0 when the clocks are not monitored
+double ArgumentModel_clock_normalization();
+
+// Whether the last timed region ran below the --min_sclk threshold
+bool ArgumentModel_below_min_sclk();
+
+// Per-call times of the last timed region with --timing_statistics, logged after the us column
+void ArgumentModel_set_timing_statistics(const TensileLite::Client::TimingStatistics& stats);
+void ArgumentModel_log_timing_statistics(hipblaslt_internal_ostream& name_line,
+                                         hipblaslt_internal_ostream& val_line,
+                                         double                      flush_us);
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblaslt_argument... Args>
 class ArgumentModel
@@ -93,6 +107,14 @@ public:
         {
             name_line << ",hipblaslt-Gflops";
             val_line << "," << hipblaslt_gflops;
+
+            // Gflops the run would have reached at the peak SYSCLK
+            double clock_normalization = ArgumentModel_clock_normalization();
+            if(clock_normalization > 0)
+            {
+                name_line << ",clk-normalized-Gflops";
+                val_line << "," << hipblaslt_gflops * clock_normalization;
+            }
         }
 
         if(gbytes != ArgumentLogging::NA_value)
@@ -104,6 +126,7 @@ public:
 
         name_line << ",us";
         val_line << "," << gpu_us;
+        ArgumentModel_log_timing_statistics(name_line, val_line, flush_us);
 
         if(arg.unit_check || arg.norm_check || arg.allclose_check)
         {
@@ -268,7 +291,13 @@ public:
             file << value_list << delim << archName << delim << cuNum << std::endl;
         }
 
+        // Samples throttled below --min_sclk are shown but left out of the comparison
+        bool rejected = ArgumentModel_below_min_sclk();
+        if(!rejected)
+            BaselineComparison_record(name_list.str(), value_list.str());
         str << name_list << "\n" << value_list << std::endl;
+        if(rejected)
+            str << "    --Rejected: SYSCLK below --min_sclk" << std::endl;
 
         if(solution_name != "")
         {
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+// Compares the times of a hipblaslt-bench run against the results of an earlier run.
+// A problem is identified by the argument columns of its result line, the fastest
+// solution of every measurement is one sample of it.
+
+// baseline is a results file of --save_results or the output of an earlier run,
+// results is the file this run writes, either can be empty
+void BaselineComparison_configure(const std::string& baseline,
+                                  const std::string& results,
+                                  double             threshold_percent,
+                                  int                samples);
+
+// Number of measurements of every problem
+int BaselineComparison_samples();
+
+// Adds a result line as ArgumentModel::log_args prints it
+void BaselineComparison_record(const std::string& name_line, const std::string& val_line);
+
+// Ends a measurement of the problems recorded since the previous call
+void BaselineComparison_end_sample();
+
+// Prints the comparison against the baseline, 1 when a problem is significantly
+// slower than the threshold allows
+int BaselineComparison_report();
@@ -75,6 +75,7 @@ inline hipDataType computeTypeToRealDataType(hipblasComputeType_t ctype)
         {HIPBLAS_COMPUTE_32F_FAST_16F, HIP_R_32F},
         {HIPBLAS_COMPUTE_32F_FAST_16BF, HIP_R_32F},
         {HIPBLAS_COMPUTE_32F_FAST_TF32, HIP_R_32F},
+        {HIPBLASLT_COMPUTE_32F_FAST_3XBF16_EXT, HIP_R_32F},
         {HIPBLAS_COMPUTE_64F, HIP_R_64F},
         {HIPBLAS_COMPUTE_64F_PEDANTIC, HIP_R_64F},
         {HIPBLAS_COMPUTE_32I, HIP_R_32I},
@@ -41,6 +41,16 @@ public:
     virtual std::vector<double> getAllMedianSYSCLK()     = 0;
     virtual double              getAverageMEMCLK()       = 0;
     virtual double              getMedianMEMCLK()        = 0;
+    virtual double              getMinimumMEMCLK()       = 0;
+    virtual double              getLowestMinimumSYSCLK() = 0;
+    virtual double              getPeakSYSCLK()          = 0;
+    virtual double              getAveragePower()        = 0;
+    virtual double              getMinimumPower()        = 0;
+
+    // Timed regions whose lowest average SYSCLK is below minMHz are rejected, 0 accepts all.
+    // A threshold turns the monitor on without HIPBLASLT_BENCH_FREQ.
+    virtual void setMinSYSCLK(double minMHz) = 0;
+    virtual bool belowMinSYSCLK()            = 0;
 };
 
 FrequencyMonitor& getFrequencyMonitor();
@@ -28,6 +28,7 @@
 
 #include "d_vector.hpp"
 #include "datatype_interface.hpp"
+#include "hipblaslt_math.hpp"
 #include "hipblaslt_ostream.hpp"
 
 class HipDeviceBuffer : public d_vector_type
@@ -189,6 +190,14 @@ inline hipError_t synchronize(HipHostBuffer& hBuf, const HipDeviceBuffer& dBuf)
     return hipMemcpy(hBuf.as<char>(), dBuf.as<char>(), hBuf.getNumBytes(), hipMemcpyDeviceToHost);
 }
 
+// Stream ordered copy into the pinned host buffer, the caller synchronizes before reading it
+inline hipError_t
+    synchronize_async(HipHostBuffer& hBuf, const HipDeviceBuffer& dBuf, hipStream_t stream = 0)
+{
+    return hipMemcpyAsync(
+        hBuf.as<char>(), dBuf.as<char>(), hBuf.getNumBytes(), hipMemcpyDeviceToHost, stream);
+}
+
 template <typename T1>
 inline void copy_buf(HipHostBuffer& src, HipHostBuffer& dst)
 {
@@ -250,10 +259,11 @@ inline void transform_buf(HipHostBuffer& src, HipHostBuffer& dst)
                      || !(std::is_same<T1, hipblaslt_bf8>::value
                           || std::is_same<T1, hipblaslt_f8>::value))
 #endif
-            std::transform(static_cast<T1*>(src.buf()),
-                           static_cast<T1*>(src.end()),
-                           static_cast<Tc*>(dst.buf()),
-                           [](T1 c) -> Tc { return static_cast<Tc>(c); });
+        {
+            const T1* begin = static_cast<const T1*>(src.buf());
+            size_t    count = static_cast<const T1*>(src.end()) - begin;
+            host_convert<Tc>(static_cast<Tc*>(dst.buf()), begin, count);
+        }
     }
 }
 
@@ -39,6 +39,10 @@
 
 #define HIPBLASLT_MAX_REQUESTED_SOLUTION_NUM 65536
 
+// Special values of Arguments::rotating, positive values are sizes in MB
+#define HIPBLASLT_ROTATING_AUTO -1 // sized from the L2 and MALL for cold operands
+#define HIPBLASLT_ROTATING_WARM -2 // one block, the operands stay cached
+
 // Predeclare enumerator
 enum hipblaslt_argument : int;
 
@@ -137,6 +141,7 @@ struct Arguments
     bool                     scaleD;
     bool                     scaleE;
     bool                     scaleAlpha_vector;
+    bool                     pointer_mode_device; // alpha and beta on the device
     bool                     amaxScaleA;
     bool                     amaxScaleB;
     bool                     amaxD;
@@ -145,6 +150,21 @@ struct Arguments
     bool                     use_e;
     bool                     gradient;
     bool                     norm_check_assert;
+    bool                     gpu_reference; // validate against the device reference GEMM
+    int32_t                  validation; // 0 full, 1 sampled, 2 checksum, 3 bounded
+    int32_t                  validation_samples; // elements checked by the sampled validation
+
+    // passes that hipblasLtMatmul runs around the GEMM
+    hipDataType d2_type; // second output D2 = D * 0.5, off when invalid
+    int32_t     scaleD_vector; // 0 off, 1 per row, 2 per column of D
+    hipDataType aux_type; // type of the AUX output E, type of D when invalid
+    bool        aux_amax; // amax of the AUX output E
+    bool        bgrad_deterministic; // bias gradient reduced in a fixed order
+    int32_t     residual_position; // 0 off, residual of D added 1 after, 2 before the activation
+    float       dropout; // probability that an element of D is dropped, 0 off
+    int32_t     amax_history; // slots of an amax history of an FP8 D, 0 off
+    int32_t     b_quant_group; // k of a group of scales of an int8 B dequantized, 0 off
+    bool        b_quant_int4; // the quantized B packed two elements per byte
 
     // API related
     bool    use_ext;
@@ -155,6 +175,9 @@ struct Arguments
     int32_t rotating;
     bool    use_gpu_timer;
     float   skip_slow_solution_ratio;
+    bool    timing_statistics; // time every hot call, report the median and its spread
+    float   ci_target; // percent of the median, 0 runs iters hot calls
+    int32_t max_iters; // most hot calls with ci_target
     // tuning
     int32_t gsu_vector[MAX_SUPPORTED_NUM_PROBLEMS]; // This is for client
     int32_t wgm_vector[MAX_SUPPORTED_NUM_PROBLEMS]; // This is for client
@@ -162,6 +185,7 @@ struct Arguments
     // print
     bool print_solution_found;
     bool print_kernel_info;
+    bool print_selection_trace;
 
     bool flush;
 
@@ -236,6 +260,7 @@ struct Arguments
     OPER(scaleD) SEP                 \
     OPER(scaleE) SEP                 \
     OPER(scaleAlpha_vector) SEP      \
+    OPER(pointer_mode_device) SEP    \
     OPER(amaxScaleA) SEP             \
     OPER(amaxScaleB) SEP             \
     OPER(amaxD) SEP                  \
@@ -244,6 +269,19 @@ struct Arguments
     OPER(use_e) SEP                  \
     OPER(gradient) SEP               \
     OPER(norm_check_assert) SEP      \
+    OPER(gpu_reference) SEP          \
+    OPER(validation) SEP             \
+    OPER(validation_samples) SEP     \
+    OPER(d2_type) SEP                \
+    OPER(scaleD_vector) SEP          \
+    OPER(aux_type) SEP               \
+    OPER(aux_amax) SEP               \
+    OPER(bgrad_deterministic) SEP    \
+    OPER(residual_position) SEP      \
+    OPER(dropout) SEP                \
+    OPER(amax_history) SEP           \
+    OPER(b_quant_group) SEP          \
+    OPER(b_quant_int4) SEP           \
     OPER(use_ext) SEP                \
     OPER(use_ext_setproblem) SEP     \
     OPER(algo_method) SEP            \
@@ -252,10 +290,14 @@ struct Arguments
     OPER(rotating) SEP               \
     OPER(use_gpu_timer) SEP          \
     OPER(skip_slow_solution_ratio) SEP\
+    OPER(timing_statistics) SEP      \
+    OPER(ci_target) SEP              \
+    OPER(max_iters) SEP              \
     OPER(gsu_vector) SEP             \
     OPER(wgm_vector) SEP             \
     OPER(print_solution_found) SEP   \
     OPER(print_kernel_info) SEP      \
+    OPER(print_selection_trace) SEP  \
     OPER(flush) SEP
 
     // clang-format on
@@ -846,6 +888,10 @@ namespace ArgumentsHelper
         [](auto&& func, const Arguments& arg, auto T) {
             if(arg.rotating > 0)
                 func("rotating_buffer", arg.rotating);
+            else if(arg.rotating == HIPBLASLT_ROTATING_AUTO)
+                func("rotating_buffer", "auto");
+            else if(arg.rotating == HIPBLASLT_ROTATING_WARM)
+                func("rotating_buffer", "warm");
         };
 };
 // clang-format on
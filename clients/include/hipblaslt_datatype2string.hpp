@@ -42,9 +42,11 @@ enum class hipblaslt_initialization
 
 typedef enum class _hipblaslt_activation_type
 {
-    none = 1,
-    relu = 2,
-    gelu = 3,
+    none   = 1,
+    relu   = 2,
+    gelu   = 3,
+    swiglu = 4,
+    geglu  = 5,
 } hipblaslt_activation_type;
 
 typedef enum class _hipblaslt_bias_source
@@ -59,6 +61,7 @@ typedef enum class _hipblaslt_scaling_format
     none   = 0,
     Scalar = 1,
     Vector = 2,
+    Block  = 3,
 } hipblaslt_scaling_format;
 
 inline hipblaslt_internal_ostream& operator<<(hipblaslt_internal_ostream& os,
@@ -75,6 +78,12 @@ inline hipblaslt_internal_ostream& operator<<(hipblaslt_internal_ostream& os,
     case hipblaslt_activation_type::gelu:
         os << "gelu";
         break;
+    case hipblaslt_activation_type::swiglu:
+        os << "swiglu";
+        break;
+    case hipblaslt_activation_type::geglu:
+        os << "geglu";
+        break;
     }
     return os;
 }
@@ -134,10 +143,12 @@ inline hipblaslt_initialization string2hipblaslt_initialization(const std::strin
 // clang-format on
 inline const hipblaslt_activation_type string_to_hipblaslt_activation_type(const std::string& value)
 {
-    return value == "none"   ? hipblaslt_activation_type::none
-           : value == "gelu" ? hipblaslt_activation_type::gelu
-           : value == "relu" ? hipblaslt_activation_type::relu
-                             : static_cast<hipblaslt_activation_type>(0);
+    return value == "none"     ? hipblaslt_activation_type::none
+           : value == "gelu"   ? hipblaslt_activation_type::gelu
+           : value == "relu"   ? hipblaslt_activation_type::relu
+           : value == "swiglu" ? hipblaslt_activation_type::swiglu
+           : value == "geglu"  ? hipblaslt_activation_type::geglu
+                               : static_cast<hipblaslt_activation_type>(0);
 }
 
 inline const hipblaslt_bias_source string_to_hipblaslt_bias_source(const std::string& value)
@@ -157,6 +168,10 @@ inline const char* hipblaslt_activation_type_to_string(hipblaslt_activation_type
         return "gelu";
     case hipblaslt_activation_type::relu:
         return "relu";
+    case hipblaslt_activation_type::swiglu:
+        return "swiglu";
+    case hipblaslt_activation_type::geglu:
+        return "geglu";
     case hipblaslt_activation_type::none:
         return "none";
     default:
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <hip/hip_runtime.h>
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt-ext-op.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Times every library kernel of opName on the n buckets 1, 2, 4, ... up to maxN with
+// timeRun(n) in ms per call, and appends the fastest tile of each bucket to path as a
+// "<arch> <op> <type> <max n> <tile>" line of HIPBLASLT_EXT_OP_TUNING_FILE
+inline int tuneExtOp(const std::string&                    path,
+                     const char*                           opName,
+                     hipDataType                           datatype,
+                     const char*                           typeName,
+                     uint32_t                              maxN,
+                     const std::function<float(uint32_t)>& timeRun)
+{
+    int             deviceId{};
+    hipDeviceProp_t deviceProperties;
+    static_cast<void>(hipGetDevice(&deviceId));
+    static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
+    std::string arch = deviceProperties.gcnArchName;
+    arch             = arch.substr(0, arch.find(':'));
+
+    std::ofstream ofs(path, std::ios::app);
+
+    if(!ofs)
+    {
+        std::cerr << "Can't open tuning file " << path << '\n';
+        return EXIT_FAILURE;
+    }
+
+    for(uint32_t n = 1;; n = std::min(n * 2, maxN))
+    {
+        uint32_t count{};
+
+        if(hipblasltExtOpGetCandidateTiles(opName, datatype, n, nullptr, &count) || !count)
+        {
+            std::cerr << "No " << opName << " kernel for n = " << n << '\n';
+            static_cast<void>(hipblasltExtOpForceTile(opName, 0));
+            return EXIT_FAILURE;
+        }
+
+        std::vector<uint32_t> tiles(count);
+        static_cast<void>(hipblasltExtOpGetCandidateTiles(opName, datatype, n, tiles.data(), &count));
+
+        uint32_t bestTile = tiles.front();
+        float    bestMs   = -1.f;
+
+        for(auto tile : tiles)
+        {
+            static_cast<void>(hipblasltExtOpForceTile(opName, tile));
+            const float ms = timeRun(n);
+            std::cout << opName << " n = " << n << ", tile = " << tile << ": " << ms << " ms\n";
+
+            if(bestMs < 0.f || ms < bestMs)
+            {
+                bestMs   = ms;
+                bestTile = tile;
+            }
+        }
+
+        ofs << arch << ' ' << opName << ' ' << typeName << ' ' << n << ' ' << bestTile << '\n';
+
+        if(n == maxN)
+            break;
+    }
+
+    static_cast<void>(hipblasltExtOpForceTile(opName, 0));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include "hipblaslt_datatype2string.hpp"
+#include <cinttypes>
+#include <hipblaslt/hipblaslt.h>
+
+/*! \brief GEMM checked by the reference, column major like cblas_gemm.
+ *
+ * D = act(alpha * scaleAlphaVec[i] * sum_l Tci(A(i, l) * scaleA[i]) * Tci(B(l, j) * scaleB[j])
+ *         + beta * scaleC * C(i, j) + bias[i]) * scaleD
+ *
+ * The operands, the scales and the bias live in device memory for hipblaslt_gpu_reference and
+ * in host memory for the sampled and checksum checks. The scales and scaleAlphaVec are of
+ * type Tc, a null pointer stands for 1. The GPU reference accumulates in float when Tc is
+ * HIP_R_32F and in double otherwise, the same as the CPU reference.
+ */
+struct reference_gemm
+{
+    hipblasOperation_t transA;
+    hipblasOperation_t transB;
+    int64_t            m;
+    int64_t            n;
+    int64_t            k;
+    int64_t            batch_count;
+
+    const void* A;
+    int64_t     lda;
+    int64_t     stride_a;
+    hipDataType TiA;
+    hipDataType TciA; // HIPBLASLT_DATATYPE_INVALID when A is not rounded to the compute input type
+    const void* B;
+    int64_t     ldb;
+    int64_t     stride_b;
+    hipDataType TiB;
+    hipDataType TciB;
+    const void* C;
+    int64_t     ldc;
+    int64_t     stride_c;
+    void*       D;
+    int64_t     ldd;
+    int64_t     stride_d;
+    hipDataType To;
+
+    hipDataType Tc;
+    double      alpha;
+    double      beta;
+    bool        tf32; // truncate float A and B to xfloat32 first
+
+    const void*               scaleAlphaVec;
+    const void*               scaleA;
+    bool                      isScaleAVec;
+    const void*               scaleB;
+    bool                      isScaleBVec;
+    const void*               scaleC;
+    const void*               scaleD;
+    const void*               bias;
+    hipDataType               Tbias;
+    hipblaslt_activation_type activation;
+};
+
+//! \brief Error of D against a reference
+struct reference_error
+{
+    double  norm_error; // sum over the batches of ||D - ref||_F / ||ref||_F
+    int64_t mismatches; // elements with |D - ref| > tol, or D != ref when tol is 0
+    double  atol; // smallest passing allclose tolerances, 1 when none of them pass
+    double  rtol;
+};
+
+void hipblaslt_gpu_reference(const reference_gemm& problem, hipStream_t stream);
+
+//! \brief Compare D with the GPU reference on the device, only the summary is copied back
+reference_error hipblaslt_gpu_compare(int64_t     M,
+                                      int64_t     N,
+                                      int64_t     ldd,
+                                      int64_t     stride_d,
+                                      int64_t     batch_count,
+                                      const void* dRef,
+                                      const void* dD,
+                                      hipDataType To,
+                                      double      tol,
+                                      hipStream_t stream);
+
+/*! \brief Check the D of the library, in problem.D on the device, against a reference recomputed
+ * on the device within an error bound instead of a fixed tolerance. The bound of each element
+ * follows from K, the magnitude of its dot product with the scales applied, the unit roundoff of
+ * Tc, of the compute input types and of To, so the reference can accumulate in float for the
+ * HIP_R_32F compute types without the ad hoc tolerances of a low precision D.
+ */
+reference_error hipblaslt_bounded_check(const reference_gemm& problem, hipStream_t stream);
+
+/*! \brief Check D at random elements, each an O(K) dot product on the host.
+ * The elements are drawn from a fixed seed, so every solution is checked at the same ones,
+ * and the norm error is that of all the samples together.
+ */
+reference_error hipblaslt_sampled_check(const reference_gemm& problem, int64_t samples, double tol);
+
+/*! \brief Check the column sums of D against (e^T op(A)) op(B) + beta e^T C, ABFT style.
+ * O(MK + KN + MN) on the host. Only holds for a linear epilogue, so no activation, and the
+ * norm error is relative to the sums of |D|, since the column sums may cancel out.
+ */
+reference_error hipblaslt_checksum_check(const reference_gemm& problem, double tol);
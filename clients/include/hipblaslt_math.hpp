@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
 #include <hip/hip_runtime.h>
 #include <hipblaslt/hipblaslt.h>
@@ -98,6 +99,86 @@ inline __device__ __host__ hipblaslt_bf8 negate(hipblaslt_bf8 x)
 }
 #endif
 
+/* ============================================================================================ */
+/*! \brief host conversions, with FP8 decoded through a table of its 256 values since its
+ *  float conversion is done in software, one element at a time and branchy */
+
+template <class T>
+struct is_host_fp8 : std::false_type
+{
+};
+
+template <>
+struct is_host_fp8<hipblaslt_f8_fnuz> : std::true_type
+{
+};
+
+template <>
+struct is_host_fp8<hipblaslt_bf8_fnuz> : std::true_type
+{
+};
+
+#ifdef ROCM_USE_FLOAT8
+template <>
+struct is_host_fp8<hipblaslt_f8> : std::true_type
+{
+};
+
+template <>
+struct is_host_fp8<hipblaslt_bf8> : std::true_type
+{
+};
+#endif
+
+template <class T>
+inline float fp8_to_float(T x)
+{
+    static const std::array<float, 256> values = [] {
+        std::array<float, 256> table;
+        for(int i = 0; i < 256; i++)
+        {
+            T v;
+            v.data   = uint8_t(i);
+            table[i] = float(v);
+        }
+        return table;
+    }();
+    return values[uint8_t(x.data)];
+}
+
+// x itself, or its float value when x is FP8
+template <class T>
+inline auto host_value(T x)
+{
+    if constexpr(is_host_fp8<T>{})
+        return fp8_to_float(x);
+    else
+        return x;
+}
+
+template <class Tdst, class T>
+inline Tdst host_cast(T x)
+{
+    return static_cast<Tdst>(host_value(x));
+}
+
+/*! \brief convert n elements on the host in parallel; half, bf16 and the table lookups of
+ *  FP8 vectorize, half through F16C as the clients build with -mf16c */
+template <class Tdst, class T>
+void host_convert(Tdst* dst, const T* src, size_t n)
+{
+#pragma omp parallel for simd
+    for(size_t i = 0; i < n; i++)
+        dst[i] = host_cast<Tdst>(src[i]);
+}
+
+//! \brief value of an output element as double for the norm and allclose checks
+template <class T>
+inline double check_value(T x)
+{
+    return host_cast<double>(x);
+}
+
 // Helper function to reduce intermediate precision and the output type are the same as the input type.
 template <typename TxDLi, typename TxDLo, typename Ti>
 inline void type_to_xdl_math_op_type(Ti* in, size_t s)
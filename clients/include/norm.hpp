@@ -27,6 +27,7 @@
 #pragma once
 
 #include "cblas.h"
+#include "hipblaslt_math.hpp"
 #include "hipblaslt_ostream.hpp"
 #include "hipblaslt_vector.hpp"
 #include "norm.hpp"
@@ -102,16 +103,9 @@ void m_axpy(size_t* N, T* alpha, T* x, int* incx, T* y, int* incy)
 /* ============== Norm Check for General Matrix ============= */
 /*! \brief compare the norm error of two matrices hCPU & hGPU */
 
-// Real
-template <
-    typename T,
-    std::enable_if_t<!(std::is_same<T, hipblaslt_f8_fnuz>{} || std::is_same<T, hipblaslt_bf8_fnuz>{}
-#ifdef ROCM_USE_FLOAT8
-                       || std::is_same<T, hipblaslt_f8>{} || std::is_same<T, hipblaslt_bf8>{}
-#endif
-                       ),
-                     int>
-    = 0>
+// The Frobenius norm, the one the clients use, is a single parallel pass over the matrices.
+// The other norms go through LAPACK on double copies.
+template <typename T>
 double norm_check_general(char norm_type, int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU)
 {
     if(M * N == 0)
@@ -120,82 +114,24 @@ double norm_check_general(char norm_type, int64_t M, int64_t N, int64_t lda, T*
     // one norm is max column sum
     // infinity norm is max row sum
     // Frobenius is l2 norm of matrix entries
-    size_t size = N * (size_t)lda;
-
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(int64_t i = 0; i < N; i++)
-    {
-        for(int64_t j = 0; j < M; j++)
-        {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(hCPU[idx]);
-            hGPU_double[idx] = double(hGPU[idx]);
-        }
-    }
-
-    double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    m     = static_cast<int>(M);
-    int    n     = static_cast<int>(N);
-    int    l     = static_cast<int>(lda);
-
-    double cpu_norm = xlange(&norm_type, &m, &n, hCPU_double.data(), &l, work);
-    m_axpy(&size, &alpha, hCPU_double.data(), &incx, hGPU_double.data(), &incx);
-    double error = xlange(&norm_type, &m, &n, hGPU_double.data(), &l, work) / cpu_norm;
-
-    return error;
-}
-
-template <typename T,
-          std::enable_if_t<(std::is_same<T, hipblaslt_f8_fnuz>{}
-                            || std::is_same<T, hipblaslt_bf8_fnuz>{}),
-                           int>
-          = 0>
-double norm_check_general(char norm_type, int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU)
-{
-    if(M * N == 0)
-        return 0;
-    size_t size = N * (size_t)lda;
-
-    host_vector<double> hCPU_double(size);
-    host_vector<double> hGPU_double(size);
-
-    for(int64_t i = 0; i < N; i++)
+    if(norm_type == 'F' || norm_type == 'f')
     {
-        for(int64_t j = 0; j < M; j++)
+        double cpu_norm2 = 0, error_norm2 = 0;
+#pragma omp parallel for reduction(+ : cpu_norm2, error_norm2)
+        for(int64_t i = 0; i < N; i++)
         {
-            size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(float(hCPU[idx]));
-            hGPU_double[idx] = double(float(hGPU[idx]));
+            for(int64_t j = 0; j < M; j++)
+            {
+                size_t idx = j + i * (size_t)lda;
+                double cpu = check_value(hCPU[idx]);
+                double err = check_value(hGPU[idx]) - cpu;
+                cpu_norm2 += cpu * cpu;
+                error_norm2 += err * err;
+            }
         }
+        return std::sqrt(error_norm2) / std::sqrt(cpu_norm2);
     }
 
-    double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    m     = static_cast<int>(M);
-    int    n     = static_cast<int>(N);
-    int    l     = static_cast<int>(lda);
-
-    double cpu_norm = xlange(&norm_type, &m, &n, hCPU_double.data(), &l, work);
-    m_axpy(&size, &alpha, hCPU_double.data(), &incx, hGPU_double.data(), &incx);
-    double error = xlange(&norm_type, &m, &n, hGPU_double.data(), &l, work) / cpu_norm;
-
-    return error;
-}
-
-#ifdef ROCM_USE_FLOAT8
-template <
-    typename T,
-    std::enable_if_t<(std::is_same<T, hipblaslt_f8>{} || std::is_same<T, hipblaslt_bf8>{}), int>
-    = 0>
-double norm_check_general(char norm_type, int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU)
-{
-    if(M * N == 0)
-        return 0;
     size_t size = N * (size_t)lda;
 
     host_vector<double> hCPU_double(size);
@@ -206,8 +142,8 @@ double norm_check_general(char norm_type, int64_t M, int64_t N, int64_t lda, T*
         for(int64_t j = 0; j < M; j++)
         {
             size_t idx       = j + i * (size_t)lda;
-            hCPU_double[idx] = double(float(hCPU[idx]));
-            hGPU_double[idx] = double(float(hGPU[idx]));
+            hCPU_double[idx] = check_value(hCPU[idx]);
+            hGPU_double[idx] = check_value(hGPU[idx]);
         }
     }
 
@@ -224,7 +160,6 @@ double norm_check_general(char norm_type, int64_t M, int64_t N, int64_t lda, T*
 
     return error;
 }
-#endif
 
 /* ============== Norm Check for strided_batched case ============= */
 template <typename T, template <typename> class VEC, typename T_hpa>
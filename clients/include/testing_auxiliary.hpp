@@ -35,6 +35,11 @@
 #include "hipblaslt_vector.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
+
+#include "Tensile/Source/lib/include/Tensile/hip/ModuleRegistry.hpp"
+
+#include <filesystem>
+#include <fstream>
 #include <hipblaslt/hipblaslt-ext.hpp> // Add check for hipblaslt-ext
 #include <hipblaslt/hipblaslt.h>
 
@@ -201,6 +206,31 @@ void testing_aux_mat_set_get_attr(const Arguments& arg)
             HIPBLAS_STATUS_SUCCESS);
         ASSERT_TRUE(data64_r == data64);
     }
+
+    // The outer level of a two-level batch
+    data = 4;
+    EXPECT_HIPBLAS_STATUS(hipblasLtMatrixLayoutSetAttribute(
+                              mat, HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT, &data, sizeof(data)),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatrixLayoutGetAttribute(
+            mat, HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT, &data_r, sizeof(data), &sizeWritten),
+        HIPBLAS_STATUS_SUCCESS);
+    ASSERT_TRUE(data_r == data);
+
+    int64_t data64 = 2 * ld * col;
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatrixLayoutSetAttribute(
+            mat, HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE, &data64, sizeof(int64_t)),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatrixLayoutGetAttribute(mat,
+                                          HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE,
+                                          &data64_r,
+                                          sizeof(int64_t),
+                                          &sizeWritten),
+        HIPBLAS_STATUS_SUCCESS);
+    ASSERT_TRUE(data64_r == data64);
 }
 
 void testing_aux_matmul_init_bad_arg(const Arguments& arg)
@@ -294,6 +324,23 @@ void testing_aux_matmul_set_get_attr(const Arguments& arg)
             matmul, HIPBLASLT_MATMUL_DESC_EPILOGUE, &data_r, sizeof(data_r), &sizeWritten),
         HIPBLAS_STATUS_SUCCESS);
     ASSERT_TRUE(data == data_r);
+
+    const auto dCachePolicy = HIPBLASLT_MATMUL_DESC_D_CACHE_POLICY;
+    const auto bCachePolicy = HIPBLASLT_MATMUL_DESC_B_CACHE_POLICY;
+    int32_t    policy       = HIPBLASLT_CACHE_POLICY_STREAMING;
+    int32_t    policy_r     = HIPBLASLT_CACHE_POLICY_DEFAULT;
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatmulDescSetAttribute(matmul, dCachePolicy, &policy, sizeof(policy)),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatmulDescGetAttribute(
+            matmul, dCachePolicy, &policy_r, sizeof(policy_r), &sizeWritten),
+        HIPBLAS_STATUS_SUCCESS);
+    ASSERT_TRUE(policy == policy_r);
+    policy = 3;
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatmulDescSetAttribute(matmul, bCachePolicy, &policy, sizeof(policy)),
+        HIPBLAS_STATUS_INVALID_VALUE);
 }
 
 void testing_aux_matmul_pref_get_attr_bad_arg(const Arguments& arg)
@@ -540,6 +587,22 @@ void testing_aux_get_sol_with_zero_alpha_null_a_b(const Arguments& arg)
 
     CHECK_SOLUTION_FOUND(returnedAlgoCount);
 
+    // The batched query returns the solutions of the single query for each problem
+    std::vector<hipblaslt_ext::MatmulProblemDesc> problems(2, {matmul, matA, matB, matC, matD});
+    std::vector<std::vector<hipblasLtMatmulHeuristicResult_t>> batchedResults;
+    CHECK_HIPBLASLT_ERROR(hipblaslt_ext::matmulAlgoGetHeuristicBatched(
+        handle, problems, pref, request_solutions, batchedResults));
+    EXPECT_EQ(batchedResults.size(), problems.size());
+    for(auto const& results : batchedResults)
+    {
+        EXPECT_EQ(results.size(), returnedAlgoCount);
+        for(size_t i = 0; i < std::min<size_t>(results.size(), returnedAlgoCount); i++)
+            EXPECT_EQ(0,
+                      memcmp(&results[i].algo,
+                             &heuristicResult[i].algo,
+                             sizeof(hipblasLtMatmulAlgo_t)));
+    }
+
     // Validation for solution running.
     CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(handle,
                                           matmul,
@@ -621,6 +684,45 @@ void testing_aux_get_sol_with_zero_alpha_null_a_b_ext(const Arguments& arg)
     CHECK_HIPBLASLT_ERROR(gemm.algoGetHeuristic(request_solutions, gemmPref, heuristicResult));
     CHECK_SOLUTION_FOUND(heuristicResult.size());
 
+    // The background query returns the same solutions
+    std::vector<hipblasLtMatmulHeuristicResult_t> asyncResult;
+    auto query = gemm.algoGetHeuristicAsync(request_solutions, gemmPref, asyncResult);
+    CHECK_HIPBLASLT_ERROR(query.get());
+    EXPECT_EQ(asyncResult.size(), heuristicResult.size());
+    for(size_t i = 0; i < std::min(asyncResult.size(), heuristicResult.size()); i++)
+        EXPECT_EQ(0,
+                  memcmp(&asyncResult[i].algo,
+                         &heuristicResult[i].algo,
+                         sizeof(hipblasLtMatmulAlgo_t)));
+
+    // The cached names are the same strings on every query
+    const char* kernelName   = nullptr;
+    const char* solutionName = nullptr;
+    const char* cachedName   = nullptr;
+    EXPECT_HIPBLAS_STATUS(hipblasLtMatmulAlgoGetName(handle, nullptr, &kernelName, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatmulAlgoGetName(handle, &heuristicResult[0].algo, nullptr, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatmulAlgoGetName(handle, &heuristicResult[0].algo, &kernelName, &solutionName),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLtMatmulAlgoGetName(handle, &heuristicResult[0].algo, &cachedName, nullptr),
+        HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+    EXPECT_NE(kernelName, nullptr);
+    EXPECT_NE(solutionName, nullptr);
+    EXPECT_EQ(kernelName, cachedName);
+    if(hipblaslt_ext::getIndexFromAlgo(heuristicResult[0].algo) >= 0)
+    {
+        EXPECT_EQ(hipblaslt_ext::getKernelNameFromAlgo(handle, heuristicResult[0].algo),
+                  kernelName);
+        EXPECT_EQ(hipblaslt_ext::getSolutionNameFromAlgo(handle, heuristicResult[0].algo),
+                  solutionName);
+    }
+#endif
+
     // Make sure to initialize every time when algo changes
     CHECK_HIPBLASLT_ERROR(gemm.initialize(heuristicResult[0].algo, nullptr));
     // Validation for solution running.
@@ -634,6 +736,130 @@ void testing_aux_get_sol_with_zero_alpha_null_a_b_ext(const Arguments& arg)
 
 void testing_aux_matmul_alg_get_attr_bad_arg(const Arguments& arg) {}
 
+// The f16 problem of arg with algo == nullptr, shared by the tests of the handle options
+struct AuxNullAlgoMatmul
+{
+    using InTypeA = hipblasLtHalf;
+    using InTypeB = hipblasLtHalf;
+    using OutType = hipblasLtHalf;
+
+    hipStream_t             stream;
+    hipblasLtHandle_t       handle;
+    hipblasLtMatrixLayout_t matA, matB, matC, matD;
+    hipblasLtMatmulDesc_t   matmul;
+    int64_t                 m, n, k;
+    float                   alpha, beta;
+    void *                  d_a, *d_b, *d_c, *d_d;
+    std::vector<InTypeA>    a;
+    std::vector<InTypeB>    b;
+    std::vector<OutType>    c;
+
+    explicit AuxNullAlgoMatmul(const Arguments& arg)
+        : m(arg.M[0])
+        , n(arg.N[0])
+        , k(arg.K[0])
+        , alpha(arg.alpha)
+        , beta(arg.beta)
+    {
+        hipblasOperation_t trans_a = arg.transA == 'N' ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        hipblasOperation_t trans_b = arg.transB == 'N' ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+        CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+        CHECK_HIP_ERROR(hipMalloc(&d_a, m * k * sizeof(InTypeA)));
+        CHECK_HIP_ERROR(hipMalloc(&d_b, n * k * sizeof(InTypeB)));
+        CHECK_HIP_ERROR(hipMalloc(&d_c, m * n * sizeof(OutType)));
+        CHECK_HIP_ERROR(hipMalloc(&d_d, m * n * sizeof(OutType)));
+
+        // Small integers keep every sum exact, whatever the order of the solution
+        a.resize(m * k);
+        b.resize(n * k);
+        c.resize(m * n);
+        for(size_t i = 0; i < a.size(); i++)
+            a[i] = InTypeA(float(i % 7) - 3.f);
+        for(size_t i = 0; i < b.size(); i++)
+            b[i] = InTypeB(float(i % 5) - 2.f);
+        for(size_t i = 0; i < c.size(); i++)
+            c[i] = OutType(float(i % 3) - 1.f);
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_a, a.data(), a.size() * sizeof(InTypeA), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_b, b.data(), b.size() * sizeof(InTypeB), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_c, c.data(), c.size() * sizeof(OutType), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, arg.a_type, m, k, m));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB, arg.a_type, k, n, k));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matC, arg.a_type, m, n, m));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matD, arg.a_type, m, n, m));
+
+        CHECK_HIPBLASLT_ERROR(
+            hipblasLtMatmulDescCreate(&matmul, arg.compute_type, arg.scale_type));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+            matmul, HIPBLASLT_MATMUL_DESC_TRANSA, &trans_a, sizeof(int32_t)));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+            matmul, HIPBLASLT_MATMUL_DESC_TRANSB, &trans_b, sizeof(int32_t)));
+    }
+
+    ~AuxNullAlgoMatmul()
+    {
+        CHECK_HIP_ERROR(hipFree(d_a));
+        CHECK_HIP_ERROR(hipFree(d_b));
+        CHECK_HIP_ERROR(hipFree(d_c));
+        CHECK_HIP_ERROR(hipFree(d_d));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matA));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matB));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matC));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matD));
+        CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    }
+
+    void run(hipStream_t launchStream)
+    {
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(handle,
+                                              matmul,
+                                              &alpha,
+                                              d_a,
+                                              matA,
+                                              d_b,
+                                              matB,
+                                              &beta,
+                                              d_c,
+                                              matC,
+                                              d_d,
+                                              matD,
+                                              nullptr,
+                                              nullptr,
+                                              0,
+                                              launchStream));
+    }
+
+    void readD(std::vector<OutType>& d)
+    {
+        d.resize(m * n);
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            d.data(), d_d, d.size() * sizeof(OutType), hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    // D of the non-transposed problem
+    void expectReference(std::vector<OutType> const& d)
+    {
+#ifdef GOOGLE_TEST
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float sum = 0.f;
+                for(int64_t l = 0; l < k; l++)
+                    sum += float(a[i + l * m]) * float(b[l + j * k]);
+                EXPECT_EQ(float(d[i + j * m]), alpha * sum + beta * float(c[i + j * m]));
+            }
+#endif
+    }
+};
+
 void testing_aux_matmul_alg_null_matmul(const Arguments& arg)
 {
     using InTypeA   = hipblasLtHalf;
@@ -726,6 +952,1536 @@ void testing_aux_matmul_alg_null_matmul(const Arguments& arg)
     CHECK_HIP_ERROR(hipStreamDestroy(stream));
 }
 
+// The second call reuses the memoized heuristic result, the third selects it again
+void testing_aux_matmul_heuristic_memo(const Arguments& arg)
+{
+    AuxNullAlgoMatmul          problem(arg);
+    std::vector<hipblasLtHalf> selected, memoized, reselected;
+    problem.run(problem.stream);
+    problem.readD(selected);
+    problem.run(problem.stream);
+    problem.readD(memoized);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::clearMatmulCache(nullptr),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::clearMatmulCache(problem.handle),
+                          HIPBLAS_STATUS_SUCCESS);
+    problem.run(problem.stream);
+    problem.readD(reselected);
+    problem.expectReference(selected);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(memcmp(selected.data(), memoized.data(), selected.size() * sizeof(hipblasLtHalf)),
+              0);
+    EXPECT_EQ(
+        memcmp(selected.data(), reselected.data(), selected.size() * sizeof(hipblasLtHalf)), 0);
+#endif
+}
+
+// Without workspace the pool provides what split-K and stream-K solutions need
+void testing_aux_matmul_workspace_pool(const Arguments& arg)
+{
+    AuxNullAlgoMatmul          problem(arg);
+    std::vector<hipblasLtHalf> withoutPool, withPool;
+    problem.run(problem.stream);
+    problem.readD(withoutPool);
+
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setWorkspacePool(nullptr, 32 * 1024 * 1024),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setWorkspacePool(problem.handle, 32 * 1024 * 1024),
+                          HIPBLAS_STATUS_SUCCESS);
+    problem.run(problem.stream);
+    problem.readD(withPool);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setWorkspacePool(problem.handle, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+    problem.expectReference(withPool);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(memcmp(withPool.data(), withoutPool.data(), withPool.size() * sizeof(hipblasLtHalf)),
+              0);
+#endif
+}
+
+// The launch moves to the priority stream and D is ready once the caller's stream is
+void testing_aux_matmul_priority_stream(const Arguments& arg)
+{
+    AuxNullAlgoMatmul          problem(arg);
+    std::vector<hipblasLtHalf> normal, priority;
+    problem.run(problem.stream);
+    problem.readD(normal);
+    CHECK_HIP_ERROR(hipMemsetAsync(
+        problem.d_d, 0, problem.m * problem.n * sizeof(hipblasLtHalf), problem.stream));
+
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setPriorityStream(nullptr, true),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setPriorityStream(problem.handle, true),
+                          HIPBLAS_STATUS_SUCCESS);
+    problem.run(problem.stream);
+    problem.readD(priority);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setPriorityStream(problem.handle, false),
+                          HIPBLAS_STATUS_SUCCESS);
+    problem.expectReference(priority);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(memcmp(normal.data(), priority.data(), normal.size() * sizeof(hipblasLtHalf)), 0);
+#endif
+}
+
+// Split-K through the pool may be selected, but two runs give the same bits
+void testing_aux_matmul_reproducible(const Arguments& arg)
+{
+    AuxNullAlgoMatmul problem(arg);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setReproducible(nullptr, true),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setReproducible(problem.handle, true),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setWorkspacePool(problem.handle, 32 * 1024 * 1024),
+                          HIPBLAS_STATUS_SUCCESS);
+    std::vector<hipblasLtHalf> firstD, secondD;
+    problem.run(problem.stream);
+    problem.readD(firstD);
+    problem.run(problem.stream);
+    problem.readD(secondD);
+    problem.expectReference(firstD);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(memcmp(firstD.data(), secondD.data(), firstD.size() * sizeof(hipblasLtHalf)), 0);
+#endif
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setWorkspacePool(problem.handle, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::setReproducible(problem.handle, false),
+                          HIPBLAS_STATUS_SUCCESS);
+}
+
+void testing_aux_matmul_solution_cache_stats(const Arguments& arg)
+{
+    AuxNullAlgoMatmul problem(arg);
+    problem.run(problem.stream);
+    CHECK_HIP_ERROR(hipStreamSynchronize(problem.stream));
+
+    hipblaslt_ext::SolutionCacheStats stats;
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::getSolutionCacheStats(nullptr, stats),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::getSolutionCacheStats(problem.handle, stats),
+                          HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+    EXPECT_GT(stats.hits + stats.misses, 0);
+    if(stats.capacity != 0)
+        EXPECT_LE(stats.size, stats.capacity);
+#endif
+}
+
+// Empty unless HIPBLASLT_CALL_TIMING is set
+void testing_aux_matmul_call_timings(const Arguments& arg)
+{
+    AuxNullAlgoMatmul problem(arg);
+    problem.run(problem.stream);
+    CHECK_HIP_ERROR(hipStreamSynchronize(problem.stream));
+
+    std::vector<hipblaslt_ext::CallTimings> timings;
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::getCallTimings(timings), HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+    for(auto& timing : timings)
+    {
+        EXPECT_FALSE(timing.signature.empty());
+        EXPECT_EQ(timing.total.buckets.size(), 32);
+    }
+#endif
+}
+
+void testing_aux_matmul_statistics(const Arguments& arg)
+{
+    AuxNullAlgoMatmul problem(arg);
+    problem.run(problem.stream);
+    CHECK_HIP_ERROR(hipStreamSynchronize(problem.stream));
+
+    hipblasLtStatistics_t statistics;
+    EXPECT_HIPBLAS_STATUS(hipblasLtGetStatistics(nullptr, &statistics),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasLtGetStatistics(problem.handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLtGetStatistics(problem.handle, &statistics),
+                          HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+    EXPECT_GT(statistics.libraryCacheHits + statistics.libraryCacheMisses, 0);
+    EXPECT_GT(statistics.kernelsResolved, 0);
+#endif
+}
+
+// Two tiny problems of different shapes in one batchedTinyGemm launch
+void testing_aux_batched_tiny_gemm(const Arguments& arg)
+{
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::batchedTinyGemm(
+            nullptr, HIPBLAS_OP_N, HIPBLAS_OP_N, HIP_R_32F, HIP_R_32F, nullptr, 1, stream),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::batchedTinyGemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, HIP_R_32F, HIP_R_32F, nullptr, 1, stream),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    const uint32_t                   tm[2] = {3, 17}, tn[2] = {5, 2}, tk[2] = {7, 33};
+    const uint32_t                   ld = 64, slice = ld * ld;
+    std::vector<float>               hTA(2 * slice), hTB(2 * slice), hTD(2 * slice, 0.f);
+    hipblaslt_ext::TinyGemmArguments hTiny[2];
+    float *                          dTA, *dTB, *dTD;
+    hipblaslt_ext::TinyGemmArguments* dTiny;
+    for(size_t i = 0; i < hTA.size(); i++)
+    {
+        hTA[i] = float(i % 7) - 3.f;
+        hTB[i] = float(i % 5) - 2.f;
+    }
+    CHECK_HIP_ERROR(hipMalloc(&dTA, hTA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dTB, hTB.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dTD, hTD.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dTiny, sizeof(hTiny)));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dTA, hTA.data(), hTA.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dTB, hTB.data(), hTB.size() * sizeof(float), hipMemcpyHostToDevice));
+    for(int p = 0; p < 2; p++)
+        hTiny[p] = {tm[p],
+                    tn[p],
+                    tk[p],
+                    ld,
+                    ld,
+                    ld,
+                    ld,
+                    2.f,
+                    0.f,
+                    dTA + p * slice,
+                    dTB + p * slice,
+                    nullptr,
+                    dTD + p * slice};
+    CHECK_HIP_ERROR(hipMemcpy(dTiny, hTiny, sizeof(hTiny), hipMemcpyHostToDevice));
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::batchedTinyGemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, HIP_R_32F, HIP_R_32F, dTiny, 2, stream),
+        HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hTD.data(), dTD, hTD.size() * sizeof(float), hipMemcpyDeviceToHost));
+    for(int p = 0; p < 2; p++)
+        for(uint32_t j = 0; j < tn[p]; j++)
+            for(uint32_t i = 0; i < tm[p]; i++)
+            {
+                float ref = 0.f;
+                for(uint32_t kk = 0; kk < tk[p]; kk++)
+                    ref += hTA[p * slice + i + kk * ld] * hTB[p * slice + kk + j * ld];
+#ifdef GOOGLE_TEST
+                EXPECT_EQ(hTD[p * slice + i + j * ld], 2.f * ref);
+#endif
+            }
+    CHECK_HIP_ERROR(hipFree(dTA));
+    CHECK_HIP_ERROR(hipFree(dTB));
+    CHECK_HIP_ERROR(hipFree(dTD));
+    CHECK_HIP_ERROR(hipFree(dTiny));
+
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// A narrow MLP with a ReLU and bias between its gemms in one fusedMlpGemm launch
+void testing_aux_fused_mlp_gemm(const Arguments& arg)
+{
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    hipblaslt_ext::FusedMlpArguments mlp{};
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::fusedMlpGemm(nullptr, mlp, HIP_R_32F, HIP_R_32F, stream),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    mlp.hidden = hipblaslt_ext::FusedMlpMaxHidden + 1;
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::fusedMlpGemm(handle, mlp, HIP_R_32F, HIP_R_32F, stream),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    const uint32_t     mm = 37, kk = 24, hh = 40, nn = 9;
+    std::vector<float> hX(mm * kk), hW1(kk * hh), hB1(hh), hW2(hh * nn), hY(mm * nn);
+    for(size_t i = 0; i < hX.size(); i++)
+        hX[i] = float(i % 7) - 3.f;
+    for(size_t i = 0; i < hW1.size(); i++)
+        hW1[i] = float(i % 5) - 2.f;
+    for(size_t i = 0; i < hB1.size(); i++)
+        hB1[i] = float(i % 3) - 1.f;
+    for(size_t i = 0; i < hW2.size(); i++)
+        hW2[i] = float(i % 4) - 1.5f;
+    float *dX, *dW1, *dB1, *dW2, *dY;
+    CHECK_HIP_ERROR(hipMalloc(&dX, hX.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dW1, hW1.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB1, hB1.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dW2, hW2.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dY, hY.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dX, hX.data(), hX.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dW1, hW1.data(), hW1.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB1, hB1.data(), hB1.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dW2, hW2.data(), hW2.size() * sizeof(float), hipMemcpyHostToDevice));
+
+    mlp = {mm,
+           kk,
+           hh,
+           nn,
+           mm,
+           kk,
+           hh,
+           mm,
+           HIPBLASLT_EPILOGUE_RELU_BIAS,
+           HIPBLASLT_EPILOGUE_DEFAULT,
+           dX,
+           dW1,
+           dB1,
+           dW2,
+           nullptr,
+           dY};
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::fusedMlpGemm(handle, mlp, HIP_R_32F, HIP_R_32F, stream),
+        HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hY.data(), dY, hY.size() * sizeof(float), hipMemcpyDeviceToHost));
+    for(uint32_t j = 0; j < nn; j++)
+        for(uint32_t i = 0; i < mm; i++)
+        {
+            float ref = 0.f;
+            for(uint32_t c = 0; c < hh; c++)
+            {
+                float h = hB1[c];
+                for(uint32_t l = 0; l < kk; l++)
+                    h += hX[i + l * mm] * hW1[l + c * kk];
+                ref += std::max(h, 0.f) * hW2[c + j * hh];
+            }
+#ifdef GOOGLE_TEST
+            EXPECT_EQ(hY[i + j * mm], ref);
+#endif
+        }
+    CHECK_HIP_ERROR(hipFree(dX));
+    CHECK_HIP_ERROR(hipFree(dW1));
+    CHECK_HIP_ERROR(hipFree(dB1));
+    CHECK_HIP_ERROR(hipFree(dW2));
+    CHECK_HIP_ERROR(hipFree(dY));
+
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// multiDeviceGemm checks the shards and the epilogue before touching a device. Two shards of
+// the current device then compute blocks of 256 and 44 rows or columns of d.
+void testing_aux_multi_device_gemm(const Arguments& arg)
+{
+    hipblasLtHandle_t handle;
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    std::vector<hipblaslt_ext::MultiDeviceShard> shards;
+    hipblaslt_ext::GemmEpilogueV2                mdEpilogue;
+    hipblaslt_ext::GemmInputsV2                  mdInputs;
+    hipblaslt_ext::GemmProblemTypeV2             mdType(HIPBLAS_OP_N,
+                                                        HIPBLAS_OP_N,
+                                                        HIP_R_32F,
+                                                        HIP_R_32F,
+                                                        HIP_R_32F,
+                                                        HIP_R_32F,
+                                                        HIPBLAS_COMPUTE_32F);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::multiDeviceGemm(shards,
+                                                         hipblaslt_ext::MultiDeviceSplit::N,
+                                                         64,
+                                                         64,
+                                                         64,
+                                                         1,
+                                                         64,
+                                                         64,
+                                                         64,
+                                                         64,
+                                                         0,
+                                                         0,
+                                                         0,
+                                                         0,
+                                                         mdEpilogue,
+                                                         mdInputs,
+                                                         mdType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    shards.resize(2);
+    shards[0].handle = handle;
+    shards[1].handle = handle;
+    mdEpilogue.setMode(HIPBLASLT_EPILOGUE_BGRADB);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::multiDeviceGemm(shards,
+                                                         hipblaslt_ext::MultiDeviceSplit::N,
+                                                         64,
+                                                         64,
+                                                         64,
+                                                         1,
+                                                         64,
+                                                         64,
+                                                         64,
+                                                         64,
+                                                         0,
+                                                         0,
+                                                         0,
+                                                         0,
+                                                         mdEpilogue,
+                                                         mdInputs,
+                                                         mdType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    mdEpilogue.setMode(HIPBLASLT_EPILOGUE_DEFAULT);
+
+    int device = 0;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    for(auto& shard : shards)
+    {
+        shard.device = device;
+        CHECK_HIP_ERROR(hipStreamCreate(&shard.stream));
+        CHECK_HIP_ERROR(hipEventCreate(&shard.done));
+    }
+
+    const int64_t      split = 300, other = 40, k = 64;
+    float              alpha = 1.f, beta = 1.f;
+    std::vector<float> hA(split * k), hB(k * split), hC(split * other), hD(split * other);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3.f;
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = float(i % 5) - 2.f;
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 3) - 1.f;
+    float *dA, *dB, *dC, *dD;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, hB.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, hC.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD, hD.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), hC.size() * sizeof(float), hipMemcpyHostToDevice));
+    mdInputs.setA(dA);
+    mdInputs.setB(dB);
+    mdInputs.setC(dC);
+    mdInputs.setD(dD);
+    mdInputs.setAlpha(&alpha);
+    mdInputs.setBeta(&beta);
+
+    for(auto how : {hipblaslt_ext::MultiDeviceSplit::N, hipblaslt_ext::MultiDeviceSplit::M})
+    {
+        const int64_t m = how == hipblaslt_ext::MultiDeviceSplit::M ? split : other;
+        const int64_t n = how == hipblaslt_ext::MultiDeviceSplit::M ? other : split;
+        CHECK_HIP_ERROR(hipMemset(dD, 0, hD.size() * sizeof(float)));
+        EXPECT_HIPBLAS_STATUS(hipblaslt_ext::multiDeviceGemm(shards,
+                                                             how,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             1,
+                                                             m,
+                                                             k,
+                                                             m,
+                                                             m,
+                                                             m * k,
+                                                             k * n,
+                                                             m * n,
+                                                             m * n,
+                                                             mdEpilogue,
+                                                             mdInputs,
+                                                             mdType),
+                              HIPBLAS_STATUS_SUCCESS);
+        for(auto& shard : shards)
+            CHECK_HIP_ERROR(hipEventSynchronize(shard.done));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hD.data(), dD, m * n * sizeof(float), hipMemcpyDeviceToHost));
+#ifdef GOOGLE_TEST
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float ref = 0.f;
+                for(int64_t l = 0; l < k; l++)
+                    ref += hA[i + l * m] * hB[l + j * k];
+                EXPECT_EQ(hD[i + j * m], ref + hC[i + j * m]);
+            }
+#endif
+    }
+
+    for(auto& shard : shards)
+    {
+        CHECK_HIP_ERROR(hipEventDestroy(shard.done));
+        CHECK_HIP_ERROR(hipStreamDestroy(shard.stream));
+    }
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dD));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+}
+
+// hostStreamingGemm checks the chunking and the epilogue before allocating staging. A k of
+// 1000 then streams as three chunks of 256 and one of 232 over two copy streams.
+void testing_aux_host_streaming_gemm(const Arguments& arg)
+{
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    std::vector<hipStream_t>         copyStreams;
+    hipblaslt_ext::GemmEpilogueV2    hsEpilogue;
+    hipblaslt_ext::GemmInputsV2      hsInputs;
+    hipblaslt_ext::GemmProblemTypeV2 hsType(HIPBLAS_OP_N,
+                                            HIPBLAS_OP_T,
+                                            HIP_R_32F,
+                                            HIP_R_32F,
+                                            HIP_R_32F,
+                                            HIP_R_32F,
+                                            HIPBLAS_COMPUTE_32F);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::hostStreamingGemm(nullptr,
+                                                           64,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           64,
+                                                           512,
+                                                           hsEpilogue,
+                                                           hsInputs,
+                                                           hsType,
+                                                           nullptr,
+                                                           0,
+                                                           stream,
+                                                           copyStreams),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::hostStreamingGemm(handle,
+                                                           64,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           64,
+                                                           512,
+                                                           hsEpilogue,
+                                                           hsInputs,
+                                                           hsType,
+                                                           nullptr,
+                                                           0,
+                                                           stream,
+                                                           copyStreams),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    copyStreams.resize(2);
+    CHECK_HIP_ERROR(hipStreamCreate(&copyStreams[0]));
+    CHECK_HIP_ERROR(hipStreamCreate(&copyStreams[1]));
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::hostStreamingGemm(handle,
+                                                           64,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           64,
+                                                           0,
+                                                           hsEpilogue,
+                                                           hsInputs,
+                                                           hsType,
+                                                           nullptr,
+                                                           0,
+                                                           stream,
+                                                           copyStreams),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    hsEpilogue.setMode(HIPBLASLT_EPILOGUE_GELU_AUX);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::hostStreamingGemm(handle,
+                                                           64,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           4096,
+                                                           64,
+                                                           64,
+                                                           512,
+                                                           hsEpilogue,
+                                                           hsInputs,
+                                                           hsType,
+                                                           nullptr,
+                                                           0,
+                                                           stream,
+                                                           copyStreams),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    hsEpilogue.setMode(HIPBLASLT_EPILOGUE_DEFAULT);
+
+    // a is m x k and b is n x k in pinned host memory, c and d are on the device
+    const int64_t m = 64, n = 48, k = 1000;
+    float         alpha = 1.f, beta = 1.f;
+    float *       hA, *hB, *dC, *dD;
+    CHECK_HIP_ERROR(hipHostMalloc(&hA, m * k * sizeof(float)));
+    CHECK_HIP_ERROR(hipHostMalloc(&hB, n * k * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, m * n * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD, m * n * sizeof(float)));
+    std::vector<float> hC(m * n), hD(m * n);
+    for(int64_t i = 0; i < m * k; i++)
+        hA[i] = float(i % 7) - 3.f;
+    for(int64_t i = 0; i < n * k; i++)
+        hB[i] = float(i % 5) - 2.f;
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 3) - 1.f;
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), hC.size() * sizeof(float), hipMemcpyHostToDevice));
+    hsInputs.setA(hA);
+    hsInputs.setB(hB);
+    hsInputs.setC(dC);
+    hsInputs.setD(dD);
+    hsInputs.setAlpha(&alpha);
+    hsInputs.setBeta(&beta);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::hostStreamingGemm(handle,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           m,
+                                                           n,
+                                                           m,
+                                                           m,
+                                                           256,
+                                                           hsEpilogue,
+                                                           hsInputs,
+                                                           hsType,
+                                                           nullptr,
+                                                           0,
+                                                           stream,
+                                                           copyStreams),
+                          HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hD.data(), dD, hD.size() * sizeof(float), hipMemcpyDeviceToHost));
+#ifdef GOOGLE_TEST
+    // c is read by the first chunk only
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+        {
+            float ref = 0.f;
+            for(int64_t l = 0; l < k; l++)
+                ref += hA[i + l * m] * hB[j + l * n];
+            EXPECT_EQ(hD[i + j * m], ref + hC[i + j * m]);
+        }
+#endif
+
+    CHECK_HIP_ERROR(hipHostFree(hA));
+    CHECK_HIP_ERROR(hipHostFree(hB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dD));
+    for(auto copyStream : copyStreams)
+        CHECK_HIP_ERROR(hipStreamDestroy(copyStream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// Graph nodes and batches need the kernel arguments of initialize(). Once initialized, the
+// node, run() with new inputs and runBatch() each compute d into the buffers they point to.
+void testing_aux_gemm_graph_node(const Arguments& arg)
+{
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    hipblaslt_ext::Gemm         graphGemm(handle,
+                                  HIPBLAS_OP_N,
+                                  HIPBLAS_OP_N,
+                                  HIP_R_32F,
+                                  HIP_R_32F,
+                                  HIP_R_32F,
+                                  HIP_R_32F,
+                                  HIPBLAS_COMPUTE_32F);
+    hipblaslt_ext::GemmInputsV2 graphInputs;
+    hipGraph_t                  graph = nullptr;
+    hipGraphNode_t              node  = nullptr;
+    std::vector<hipGraphNode_t> dependencies;
+    CHECK_HIP_ERROR(hipGraphCreate(&graph, 0));
+    EXPECT_HIPBLAS_STATUS(graphGemm.createGraphNode(graph, dependencies, node),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(graphGemm.updateGraphNode(nullptr, node, graphInputs),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(graphGemm.run(graphInputs, stream), HIPBLAS_STATUS_INVALID_VALUE);
+
+    std::vector<hipblaslt_ext::GemmInstance*> batch;
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::GemmInstance::runBatch(batch, stream),
+                          HIPBLAS_STATUS_SUCCESS);
+    batch.push_back(&graphGemm);
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::GemmInstance::runBatch(batch, stream),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Two b and three d buffers, d[i] is computed with b[i % 2]
+    const int64_t      m = 64, n = 32, k = 48;
+    float              alpha = 1.f, beta = 0.f;
+    std::vector<float> hA(m * k), hB[2], hD(m * n);
+    float *            dA, *dB[2], *dD[3];
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3.f;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice));
+    for(int p = 0; p < 2; p++)
+    {
+        hB[p].resize(k * n);
+        for(size_t i = 0; i < hB[p].size(); i++)
+            hB[p][i] = float((i + 3 * p) % 5) - 2.f;
+        CHECK_HIP_ERROR(hipMalloc(&dB[p], hB[p].size() * sizeof(float)));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dB[p], hB[p].data(), hB[p].size() * sizeof(float), hipMemcpyHostToDevice));
+    }
+    for(int p = 0; p < 3; p++)
+        CHECK_HIP_ERROR(hipMalloc(&dD[p], hD.size() * sizeof(float)));
+
+    auto pointTo = [&](int p) {
+        graphInputs.setA(dA);
+        graphInputs.setB(dB[p % 2]);
+        graphInputs.setC(dD[p]);
+        graphInputs.setD(dD[p]);
+        graphInputs.setAlpha(&alpha);
+        graphInputs.setBeta(&beta);
+    };
+    auto expectD = [&](int p) {
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hD.data(), dD[p], hD.size() * sizeof(float), hipMemcpyDeviceToHost));
+#ifdef GOOGLE_TEST
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float ref = 0.f;
+                for(int64_t l = 0; l < k; l++)
+                    ref += hA[i + l * m] * hB[p % 2][l + j * k];
+                EXPECT_EQ(hD[i + j * m], ref);
+            }
+#endif
+    };
+
+    hipblaslt_ext::GemmEpilogueV2                 graphEpilogue;
+    hipblaslt_ext::GemmPreferenceV2               graphPref;
+    std::vector<hipblasLtMatmulHeuristicResult_t> heuristicResult;
+    pointTo(0);
+    CHECK_HIPBLASLT_ERROR(graphGemm.setProblem(m, n, k, 1, graphEpilogue, graphInputs));
+    CHECK_HIPBLASLT_ERROR(graphGemm.algoGetHeuristic(1, graphPref, heuristicResult));
+    CHECK_SOLUTION_FOUND(heuristicResult.size());
+    CHECK_HIPBLASLT_ERROR(graphGemm.initialize(heuristicResult[0].algo, nullptr));
+
+    hipGraphExec_t exec = nullptr;
+    EXPECT_HIPBLAS_STATUS(graphGemm.createGraphNode(graph, dependencies, node),
+                          HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+    CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+    expectD(0);
+
+    pointTo(1);
+    EXPECT_HIPBLAS_STATUS(graphGemm.updateGraphNode(exec, node, graphInputs),
+                          HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+    expectD(1);
+
+    pointTo(2);
+    EXPECT_HIPBLAS_STATUS(graphGemm.run(graphInputs, stream), HIPBLAS_STATUS_SUCCESS);
+    expectD(2);
+
+    // runBatch() launches with the pointers the instance kept
+    CHECK_HIP_ERROR(hipMemsetAsync(dD[2], 0, hD.size() * sizeof(float), stream));
+    EXPECT_HIPBLAS_STATUS(hipblaslt_ext::GemmInstance::runBatch(batch, stream),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectD(2);
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_HIP_ERROR(hipFree(dA));
+    for(int p = 0; p < 2; p++)
+        CHECK_HIP_ERROR(hipFree(dB[p]));
+    for(int p = 0; p < 3; p++)
+        CHECK_HIP_ERROR(hipFree(dD[p]));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// A program must be compiled before it runs, and only depends on earlier gemms. Compiled, a
+// chain of two gemms computes d2 = (a * b1) * b2, and setInputs() moves d2 to another buffer.
+void testing_aux_gemm_program(const Arguments& arg)
+{
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    hipblaslt_ext::GemmEpilogueV2    programEpilogue;
+    hipblaslt_ext::GemmInputsV2      programInputs;
+    hipblaslt_ext::GemmProblemTypeV2 programType(HIPBLAS_OP_N,
+                                                 HIPBLAS_OP_N,
+                                                 HIP_R_32F,
+                                                 HIP_R_32F,
+                                                 HIP_R_32F,
+                                                 HIP_R_32F,
+                                                 HIPBLAS_COMPUTE_32F);
+    {
+        hipblaslt_ext::GemmProgram program(handle);
+        std::vector<size_t>        dependencies{0};
+        size_t                     index = 0;
+        EXPECT_HIPBLAS_STATUS(program.compile(nullptr, 0), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(program.run(stream), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(program.setInputs(0, programInputs), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(program.addGemm(64,
+                                              64,
+                                              64,
+                                              1,
+                                              64,
+                                              64,
+                                              64,
+                                              64,
+                                              64 * 64,
+                                              64 * 64,
+                                              64 * 64,
+                                              64 * 64,
+                                              programEpilogue,
+                                              programInputs,
+                                              programType,
+                                              dependencies,
+                                              index),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(program.size(), size_t(0));
+#endif
+    }
+
+    const int64_t      m = 64, k = 32, n1 = 16, n2 = 24;
+    const size_t       workspaceBytes = 32 * 1024 * 1024;
+    float              alpha = 1.f, beta = 0.f;
+    std::vector<float> hA(m * k), hB1(k * n1), hB2(n1 * n2), hD1(m * n1, 0.f), hD2(m * n2);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3.f;
+    for(size_t i = 0; i < hB1.size(); i++)
+        hB1[i] = float(i % 5) - 2.f;
+    for(size_t i = 0; i < hB2.size(); i++)
+        hB2[i] = float(i % 3) - 1.f;
+    for(int64_t j = 0; j < n1; j++)
+        for(int64_t i = 0; i < m; i++)
+            for(int64_t l = 0; l < k; l++)
+                hD1[i + j * m] += hA[i + l * m] * hB1[l + j * k];
+
+    float *dA, *dB1, *dB2, *dD1, *dD2[2];
+    void*  workspace;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB1, hB1.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB2, hB2.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD1, hD1.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD2[0], hD2.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD2[1], hD2.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceBytes));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB1, hB1.data(), hB1.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB2, hB2.data(), hB2.size() * sizeof(float), hipMemcpyHostToDevice));
+
+    hipblaslt_ext::GemmInputsV2 inputs1, inputs2;
+    inputs1.setA(dA);
+    inputs1.setB(dB1);
+    inputs1.setC(dD1);
+    inputs1.setD(dD1);
+    inputs1.setAlpha(&alpha);
+    inputs1.setBeta(&beta);
+    inputs2.setA(dD1);
+    inputs2.setB(dB2);
+    inputs2.setC(dD2[0]);
+    inputs2.setD(dD2[0]);
+    inputs2.setAlpha(&alpha);
+    inputs2.setBeta(&beta);
+
+    auto expectD2 = [&](int p) {
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hD2.data(), dD2[p], hD2.size() * sizeof(float), hipMemcpyDeviceToHost));
+#ifdef GOOGLE_TEST
+        for(int64_t j = 0; j < n2; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float ref = 0.f;
+                for(int64_t l = 0; l < n1; l++)
+                    ref += hD1[i + l * m] * hB2[l + j * n1];
+                EXPECT_EQ(hD2[i + j * m], ref);
+            }
+#endif
+    };
+
+    {
+        hipblaslt_ext::GemmProgram program(handle);
+        size_t                     first = 0, second = 0;
+        EXPECT_HIPBLAS_STATUS(program.addGemm(m,
+                                              n1,
+                                              k,
+                                              1,
+                                              m,
+                                              k,
+                                              m,
+                                              m,
+                                              m * k,
+                                              k * n1,
+                                              m * n1,
+                                              m * n1,
+                                              programEpilogue,
+                                              inputs1,
+                                              programType,
+                                              {},
+                                              first),
+                              HIPBLAS_STATUS_SUCCESS);
+        EXPECT_HIPBLAS_STATUS(program.addGemm(m,
+                                              n2,
+                                              n1,
+                                              1,
+                                              m,
+                                              n1,
+                                              m,
+                                              m,
+                                              m * n1,
+                                              n1 * n2,
+                                              m * n2,
+                                              m * n2,
+                                              programEpilogue,
+                                              inputs2,
+                                              programType,
+                                              {first},
+                                              second),
+                              HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(program.size(), size_t(2));
+#endif
+        EXPECT_HIPBLAS_STATUS(program.compile(workspace, workspaceBytes), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_HIPBLAS_STATUS(program.run(stream), HIPBLAS_STATUS_SUCCESS);
+        expectD2(0);
+
+        inputs2.setC(dD2[1]);
+        inputs2.setD(dD2[1]);
+        EXPECT_HIPBLAS_STATUS(program.setInputs(second, inputs2), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_HIPBLAS_STATUS(program.run(stream), HIPBLAS_STATUS_SUCCESS);
+        expectD2(1);
+    }
+
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB1));
+    CHECK_HIP_ERROR(hipFree(dB2));
+    CHECK_HIP_ERROR(hipFree(dD1));
+    CHECK_HIP_ERROR(hipFree(dD2[0]));
+    CHECK_HIP_ERROR(hipFree(dD2[1]));
+    CHECK_HIP_ERROR(hipFree(workspace));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// Calls alternating shapes and buffers go through the execution cache of the handle, and
+// each gives the bits of a solve on a handle whose cache was just cleared
+void testing_aux_matmul_exec_cache(const Arguments& arg)
+{
+    const int64_t shapes[2][3] = {{64, 48, 32}, {33, 17, 80}};
+    const size_t  maxSize      = 80 * 80;
+    float         alpha        = 1.f;
+    float         beta         = 0.f;
+
+    hipStream_t       stream;
+    hipblasLtHandle_t handle, freshHandle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&freshHandle));
+
+    std::vector<float> hA[2], hB[2];
+    float *            dA[2], *dB[2], *dD[2];
+    for(int p = 0; p < 2; p++)
+    {
+        hA[p].resize(maxSize);
+        hB[p].resize(maxSize);
+        for(size_t i = 0; i < maxSize; i++)
+        {
+            hA[p][i] = float((i + p) % 7) - 3.f;
+            hB[p][i] = float((i + 2 * p) % 5) - 2.f;
+        }
+        CHECK_HIP_ERROR(hipMalloc(&dA[p], maxSize * sizeof(float)));
+        CHECK_HIP_ERROR(hipMalloc(&dB[p], maxSize * sizeof(float)));
+        CHECK_HIP_ERROR(hipMalloc(&dD[p], maxSize * sizeof(float)));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dA[p], hA[p].data(), maxSize * sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dB[p], hB[p].data(), maxSize * sizeof(float), hipMemcpyHostToDevice));
+    }
+
+    hipblasLtMatrixLayout_t matA[2], matB[2], matD[2];
+    for(int s = 0; s < 2; s++)
+    {
+        int64_t m = shapes[s][0], n = shapes[s][1], k = shapes[s][2];
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA[s], HIP_R_32F, m, k, m));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB[s], HIP_R_32F, k, n, k));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matD[s], HIP_R_32F, m, n, m));
+    }
+
+    hipblasLtMatmulDesc_t matmul;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+
+    auto run = [&](hipblasLtHandle_t h, int s, int p, std::vector<float>& out) {
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(h,
+                                              matmul,
+                                              &alpha,
+                                              dA[p],
+                                              matA[s],
+                                              dB[p],
+                                              matB[s],
+                                              &beta,
+                                              dD[p],
+                                              matD[s],
+                                              dD[p],
+                                              matD[s],
+                                              nullptr,
+                                              nullptr,
+                                              0,
+                                              stream));
+        out.resize(shapes[s][0] * shapes[s][1]);
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            out.data(), dD[p], out.size() * sizeof(float), hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    };
+
+    // Shape and buffer set of each call, every pair is seen twice
+    const int calls[][2] = {{0, 0}, {1, 1}, {0, 1}, {1, 0}, {0, 0}, {1, 1}, {0, 1}, {1, 0}};
+    std::vector<float> cached, fresh;
+    for(auto const& call : calls)
+    {
+        int s = call[0], p = call[1];
+        run(handle, s, p, cached);
+        EXPECT_HIPBLAS_STATUS(hipblaslt_ext::clearMatmulCache(freshHandle),
+                              HIPBLAS_STATUS_SUCCESS);
+        run(freshHandle, s, p, fresh);
+
+        int64_t m = shapes[s][0], n = shapes[s][1], k = shapes[s][2];
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(memcmp(cached.data(), fresh.data(), cached.size() * sizeof(float)), 0);
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float ref = 0.f;
+                for(int64_t l = 0; l < k; l++)
+                    ref += hA[p][i + l * m] * hB[p][l + j * k];
+                EXPECT_EQ(cached[i + j * m], ref);
+            }
+#endif
+    }
+
+    hipblasLtStatistics_t statistics;
+    EXPECT_HIPBLAS_STATUS(hipblasLtGetStatistics(handle, &statistics), HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+    EXPECT_GT(statistics.handleCacheHits, 0);
+#endif
+
+    for(int p = 0; p < 2; p++)
+    {
+        CHECK_HIP_ERROR(hipFree(dA[p]));
+        CHECK_HIP_ERROR(hipFree(dB[p]));
+        CHECK_HIP_ERROR(hipFree(dD[p]));
+    }
+    for(int s = 0; s < 2; s++)
+    {
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matA[s]));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matB[s]));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matD[s]));
+    }
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(freshHandle));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// D += A * B with beta 1 alternating between in-place and out-of-place calls. A long K
+// favors split-k, which drops its beta-only kernel only while C and D are the same buffer.
+void testing_aux_matmul_beta_one_in_place(const Arguments& arg)
+{
+    const int64_t m = 32, n = 32, k = 8192;
+    float         alpha = 1.f;
+    float         beta  = 1.f;
+
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    std::vector<float> hA(m * k), hB(k * n), hC(m * n), hD(m * n), ref(m * n);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3.f;
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = float(i % 5) - 2.f;
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 11) - 5.f;
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+        {
+            float sum = 0.f;
+            for(int64_t l = 0; l < k; l++)
+                sum += hA[i + l * m] * hB[l + j * k];
+            ref[i + j * m] = sum + hC[i + j * m];
+        }
+
+    float *dA, *dB, *dC, *dD;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, hB.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, hC.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD, hD.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), hC.size() * sizeof(float), hipMemcpyHostToDevice));
+
+    hipblasLtMatrixLayout_t matA, matB, matC;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, HIP_R_32F, m, k, m));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB, HIP_R_32F, k, n, k));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matC, HIP_R_32F, m, n, m));
+
+    hipblasLtMatmulDesc_t matmul;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+
+    size_t workspaceSize = 32 * 1024 * 1024;
+    void*  workspace;
+    CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceSize));
+
+    for(bool inPlace : {true, false, true, false})
+    {
+        CHECK_HIP_ERROR(hipMemcpy(
+            dD, inPlace ? hC.data() : hD.data(), hD.size() * sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(handle,
+                                              matmul,
+                                              &alpha,
+                                              dA,
+                                              matA,
+                                              dB,
+                                              matB,
+                                              &beta,
+                                              inPlace ? dD : dC,
+                                              matC,
+                                              dD,
+                                              matC,
+                                              nullptr,
+                                              workspace,
+                                              workspaceSize,
+                                              stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hD.data(), dD, hD.size() * sizeof(float), hipMemcpyDeviceToHost));
+#ifdef GOOGLE_TEST
+        for(size_t i = 0; i < ref.size(); i++)
+            EXPECT_EQ(hD[i], ref[i]);
+#endif
+    }
+
+    CHECK_HIP_ERROR(hipFree(workspace));
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dD));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matA));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matB));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matC));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// C at the address of D but with a longer leading dimension is an out-of-place GEMM. Its
+// columns past the first lie beyond D, so only column 0 is shared and updated in place.
+// The in-place calls around it must not be served the solution cached for it, or the reverse.
+void testing_aux_matmul_c_aliases_d_ld(const Arguments& arg)
+{
+    const int64_t m = 64, n = 8, k = 256;
+    const int64_t ldd = m, ldcOut = n * m;
+    float         alpha = 1.f;
+    float         beta  = 2.f;
+
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    std::vector<float> hA(m * k), hB(k * n), hC(ldcOut * n), hD(ldcOut * n);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3.f;
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = float(i % 5) - 2.f;
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 11) - 5.f;
+
+    float *dA, *dB, *dD;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, hB.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dD, hC.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice));
+
+    hipblasLtMatrixLayout_t matA, matB, matD, matCOut;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, HIP_R_32F, m, k, m));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB, HIP_R_32F, k, n, k));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matD, HIP_R_32F, m, n, ldd));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matCOut, HIP_R_32F, m, n, ldcOut));
+
+    hipblasLtMatmulDesc_t matmul;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+
+    size_t workspaceSize = 32 * 1024 * 1024;
+    void*  workspace;
+    CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceSize));
+
+    for(bool inPlace : {true, false, true, false})
+    {
+        int64_t ldc = inPlace ? ldd : ldcOut;
+        CHECK_HIP_ERROR(
+            hipMemcpy(dD, hC.data(), hC.size() * sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(handle,
+                                              matmul,
+                                              &alpha,
+                                              dA,
+                                              matA,
+                                              dB,
+                                              matB,
+                                              &beta,
+                                              dD,
+                                              inPlace ? matD : matCOut,
+                                              dD,
+                                              matD,
+                                              nullptr,
+                                              workspace,
+                                              workspaceSize,
+                                              stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hD.data(), dD, hD.size() * sizeof(float), hipMemcpyDeviceToHost));
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float ref = beta * hC[i + j * ldc];
+                for(int64_t l = 0; l < k; l++)
+                    ref += alpha * hA[i + l * m] * hB[l + j * k];
+#ifdef GOOGLE_TEST
+                EXPECT_EQ(hD[i + j * ldd], ref);
+#endif
+            }
+    }
+
+    CHECK_HIP_ERROR(hipFree(workspace));
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dD));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matA));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matB));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matD));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matCOut));
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// Runs the first heuristic result of a decode shape, which is the skinny GEMM under its
+// reserved solution index -2, splitting k only when maxWorkspace holds the partials
+template <typename Ti, typename To>
+void testing_aux_skinny_gemm_run(hipblasLtHandle_t handle,
+                                 hipDataType       inType,
+                                 hipDataType       outType,
+                                 size_t            maxWorkspace,
+                                 hipStream_t       stream)
+{
+    const int64_t m = 4, n = 64, k = 8192;
+    float         alpha = 1.f;
+    float         beta  = 1.f;
+
+    std::vector<Ti> hA(m * k), hB(k * n);
+    std::vector<To> hC(m * n), hD(m * n);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = static_cast<Ti>(float(i % 3) - 1.f);
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = static_cast<Ti>(float(i % 5) - 2.f);
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = static_cast<To>(float(i % 7) - 3.f);
+
+    Ti *dA, *dB;
+    To *dC, *dD;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(Ti)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, hB.size() * sizeof(Ti)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, hC.size() * sizeof(To)));
+    CHECK_HIP_ERROR(hipMalloc(&dD, hD.size() * sizeof(To)));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size() * sizeof(Ti), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), hB.size() * sizeof(Ti), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), hC.size() * sizeof(To), hipMemcpyHostToDevice));
+
+    hipblasLtMatrixLayout_t matA, matB, matC;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, inType, m, k, m));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB, inType, k, n, k));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matC, outType, m, n, m));
+
+    hipblasLtMatmulDesc_t matmul;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescCreate(&matmul, HIPBLAS_COMPUTE_32F, HIP_R_32F));
+
+    hipblasLtMatmulPreference_t pref;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceCreate(&pref));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceSetAttribute(
+        pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &maxWorkspace, sizeof(maxWorkspace)));
+    hipblasLtMatmulHeuristicResult_t heuristicResult[1];
+    int                              returnedAlgoCount = 0;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(
+        handle, matmul, matA, matB, matC, matC, pref, 1, heuristicResult, &returnedAlgoCount));
+    CHECK_SOLUTION_FOUND(returnedAlgoCount);
+
+    auto&  algo          = heuristicResult[0].algo;
+    size_t workspaceSize = 0;
+    EXPECT_HIPBLAS_STATUS(
+        hipblaslt_ext::matmulIsAlgoSupported(
+            handle, matmul, &alpha, matA, matB, &beta, matC, matC, algo, workspaceSize),
+        HIPBLAS_STATUS_SUCCESS);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(hipblaslt_ext::getIndexFromAlgo(algo), -2);
+    EXPECT_EQ(hipblaslt_ext::getKernelNameFromAlgo(handle, algo), "SkinnyGemm");
+    EXPECT_EQ(hipblaslt_ext::getSolutionNameFromAlgo(handle, algo), "SkinnyGemm");
+    EXPECT_EQ(workspaceSize, heuristicResult[0].workspaceSize);
+    if(maxWorkspace)
+        EXPECT_GT(workspaceSize, 0);
+    else
+        EXPECT_EQ(workspaceSize, 0);
+#endif
+
+    // The skinny GEMM is dispatched before the execution cache of the handle is consulted
+    hipblasLtStatistics_t before, after;
+    CHECK_HIPBLASLT_ERROR(hipblasLtGetStatistics(handle, &before));
+
+    void* workspace = nullptr;
+    if(workspaceSize)
+        CHECK_HIP_ERROR(hipMalloc(&workspace, workspaceSize));
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmul(handle,
+                                              matmul,
+                                              &alpha,
+                                              dA,
+                                              matA,
+                                              dB,
+                                              matB,
+                                              &beta,
+                                              dC,
+                                              matC,
+                                              dD,
+                                              matC,
+                                              &algo,
+                                              workspace,
+                                              workspaceSize,
+                                              stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hipMemcpy(hD.data(), dD, hD.size() * sizeof(To), hipMemcpyDeviceToHost));
+
+        // Integer inputs accumulate exactly in f32, only the store to D rounds
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                float ref = float(hC[i + j * m]);
+                for(int64_t l = 0; l < k; l++)
+                    ref += float(hA[i + l * m]) * float(hB[l + j * k]);
+#ifdef GOOGLE_TEST
+                EXPECT_EQ(float(hD[i + j * m]), float(static_cast<To>(ref)));
+#endif
+            }
+    }
+
+    CHECK_HIPBLASLT_ERROR(hipblasLtGetStatistics(handle, &after));
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(after.handleCacheHits + after.handleCacheMisses,
+              before.handleCacheHits + before.handleCacheMisses);
+#endif
+
+    if(workspace)
+        CHECK_HIP_ERROR(hipFree(workspace));
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dD));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceDestroy(pref));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescDestroy(matmul));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matA));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matB));
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutDestroy(matC));
+}
+
+// The skinny GEMM with and without split-k partials, for each input and output type
+void testing_aux_matmul_skinny_gemm(const Arguments& arg)
+{
+    hipStream_t       stream;
+    hipblasLtHandle_t handle;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLASLT_ERROR(hipblasLtCreate(&handle));
+
+    for(size_t maxWorkspace : {size_t(0), size_t(32 * 1024 * 1024)})
+    {
+        testing_aux_skinny_gemm_run<float, float>(
+            handle, HIP_R_32F, HIP_R_32F, maxWorkspace, stream);
+        testing_aux_skinny_gemm_run<hipblasLtHalf, hipblasLtHalf>(
+            handle, HIP_R_16F, HIP_R_16F, maxWorkspace, stream);
+        testing_aux_skinny_gemm_run<hipblasLtHalf, float>(
+            handle, HIP_R_16F, HIP_R_32F, maxWorkspace, stream);
+        testing_aux_skinny_gemm_run<hip_bfloat16, hip_bfloat16>(
+            handle, HIP_R_16BF, HIP_R_16BF, maxWorkspace, stream);
+        testing_aux_skinny_gemm_run<hip_bfloat16, float>(
+            handle, HIP_R_16BF, HIP_R_32F, maxWorkspace, stream);
+    }
+
+    CHECK_HIPBLASLT_ERROR(hipblasLtDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+// Loader of TensileLite::hip::ModuleRegistry that counts the loads, unloads and file reads
+struct CountingModuleLoader
+{
+    using Module   = int;
+    using Function = int;
+    using Error    = int;
+
+    static constexpr int Success = 0;
+
+    int modules   = 0;
+    int pathLoads = 0;
+    int dataLoads = 0;
+    int unloads   = 0;
+    int reads     = 0;
+    int functions = 0;
+
+    int device(int& id)
+    {
+        id = 0;
+        return Success;
+    }
+
+    int load(int& module, std::string const& path)
+    {
+        pathLoads++;
+        module = ++modules;
+        return Success;
+    }
+
+    int loadData(int& module, void const* image)
+    {
+        dataLoads++;
+        module = ++modules;
+        return Success;
+    }
+
+    void unload(int module)
+    {
+        unloads++;
+    }
+
+    int getFunction(int& function, int module, std::string const& name)
+    {
+        functions++;
+        function = module;
+        return Success;
+    }
+
+    size_t fileSize(std::string const& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        return file ? static_cast<size_t>(file.tellg()) : 0;
+    }
+
+    bool readFile(std::string const& path, std::vector<char>& bytes)
+    {
+        reads++;
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !bytes.empty();
+    }
+};
+
+// Identical code objects share a module, which is unloaded with its last user. Files are
+// only read when another code object of their size is loaded.
+void testing_aux_module_registry(const Arguments& arg)
+{
+    auto dir  = std::filesystem::temp_directory_path();
+    auto save = [&](std::string const& name, std::string const& content) {
+        auto path = (dir / ("hipblaslt_module_registry_" + name)).string();
+        std::ofstream(path, std::ios::binary) << content;
+        return path;
+    };
+    std::string a1 = save("a1.co", std::string(64, 'a'));
+    std::string a2 = save("a2.co", std::string(64, 'a'));
+    std::string b  = save("b.co", std::string(63, 'a') + 'b');
+    std::string c  = save("c.co", std::string(100, 'c'));
+
+    TensileLite::hip::ModuleRegistry<CountingModuleLoader> registry;
+    auto&                                                  loader = registry.loader();
+    int                                                    moduleA1, moduleA2, moduleB, moduleC;
+    size_t                                                 bytes  = 0;
+    bool                                                   shared = false;
+
+    // Sizes seen for the first time load from the path without a read
+    EXPECT_EQ(registry.acquireFile(moduleC, c, bytes, shared), 0);
+    EXPECT_EQ(registry.acquireFile(moduleA1, a1, bytes, shared), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(bytes, size_t(64));
+    EXPECT_FALSE(shared);
+    EXPECT_EQ(loader.pathLoads, 2);
+    EXPECT_EQ(loader.reads, 0);
+#endif
+
+    // Same size, different bytes
+    EXPECT_EQ(registry.acquireFile(moduleB, b, bytes, shared), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_FALSE(shared);
+    EXPECT_NE(moduleB, moduleA1);
+    EXPECT_EQ(loader.dataLoads, 1);
+    EXPECT_EQ(loader.reads, 2);
+#endif
+
+    // Same bytes as a1 in another file
+    EXPECT_EQ(registry.acquireFile(moduleA2, a2, bytes, shared), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_TRUE(shared);
+    EXPECT_EQ(moduleA2, moduleA1);
+    EXPECT_EQ(registry.users(moduleA1), size_t(2));
+    EXPECT_EQ(loader.modules, 3);
+#endif
+
+    // Kernels are resolved once per module
+    int function = 0;
+    EXPECT_EQ(registry.getFunction(function, moduleA1, "kernel"), 0);
+    EXPECT_EQ(registry.getFunction(function, moduleA2, "kernel"), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(loader.functions, 1);
+#endif
+
+    // An image that can't be kept uses the module of identical bytes, but isn't shared itself
+    std::string image = std::string(63, 'a') + 'b';
+    int         moduleImage, moduleImage2;
+    EXPECT_EQ(registry.acquireImage(moduleImage, image.data(), image.size(), {}, shared), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_TRUE(shared);
+    EXPECT_EQ(moduleImage, moduleB);
+#endif
+    image = std::string(200, 'i');
+    EXPECT_EQ(registry.acquireImage(moduleImage, image.data(), image.size(), {}, shared), 0);
+    EXPECT_EQ(registry.acquireImage(moduleImage2, image.data(), image.size(), {}, shared), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_FALSE(shared);
+    EXPECT_NE(moduleImage2, moduleImage);
+#endif
+
+    // The shared module is unloaded with its last user
+    registry.release(moduleA1);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(loader.unloads, 0);
+    EXPECT_EQ(registry.users(moduleA2), size_t(1));
+#endif
+    registry.release(moduleA2);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(loader.unloads, 1);
+    EXPECT_EQ(registry.users(moduleA2), size_t(0));
+#endif
+
+    // Once unloaded, a1 no longer matches
+    EXPECT_EQ(registry.acquireFile(moduleA1, a1, bytes, shared), 0);
+#ifdef GOOGLE_TEST
+    EXPECT_FALSE(shared);
+    EXPECT_NE(moduleA1, moduleA2);
+#endif
+
+    for(int module : {moduleA1, moduleB, moduleB, moduleC, moduleImage, moduleImage2})
+        registry.release(module);
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(loader.unloads, 6);
+#endif
+    for(auto const& path : {a1, a2, b, c})
+        std::filesystem::remove(path);
+}
+
 void testing_aux_matmul_pref_init_bad_arg(const Arguments& arg)
 {
     hipblasLtMatmulPreference_t pref;
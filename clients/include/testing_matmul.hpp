@@ -26,12 +26,14 @@
 
 #pragma once
 
+#include "Tensile/Source/client/include/Utility.hpp"
 #include "allclose.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
 #include "frequency_monitor.hpp"
 #include "hipBuffer.hpp"
 #include "hipblaslt_datatype2string.hpp"
+#include "hipblaslt_gpu_reference.hpp"
 #include "hipblaslt_init.hpp"
 #include "hipblaslt_math.hpp"
 #include "hipblaslt_random.hpp"
@@ -44,6 +46,7 @@
 #include "utility.hpp"
 #include <cstddef>
 #include <functional>
+#include <future>
 #include <hipblaslt/hipblaslt-ext-op.h>
 #include <hipblaslt/hipblaslt-ext.hpp>
 #include <hipblaslt/hipblaslt.h>
@@ -104,6 +107,107 @@ inline void post_gpu_time(bool         use_gpu_timer,
     }
 }
 
+// Times the hot calls one by one with --timing_statistics, so that the median and the spread of
+// the calls are reported rather than the mean of the batch. With --ci_target the calls go on past
+// --iters until the confidence interval of the median is narrower than the target.
+class HotCallTiming
+{
+public:
+    HotCallTiming(const Arguments& arg, hipStream_t stream)
+        : m_enabled(arg.timing_statistics || arg.ci_target > 0)
+        , m_iters(arg.iters)
+        , m_maxIters(std::max(arg.iters, arg.max_iters))
+        , m_ciTarget(arg.ci_target / 100)
+        , m_stream(stream)
+    {
+    }
+
+    ~HotCallTiming()
+    {
+        for(size_t i = 0; i < m_starts.size(); i++)
+        {
+            CHECK_HIP_ERROR(hipEventDestroy(m_starts[i]));
+            CHECK_HIP_ERROR(hipEventDestroy(m_stops[i]));
+        }
+    }
+
+    HotCallTiming(const HotCallTiming&)            = delete;
+    HotCallTiming& operator=(const HotCallTiming&) = delete;
+
+    // Condition of the hot call loop, i counts the calls of a solution from 0
+    bool more(int i)
+    {
+        if(i == 0)
+        {
+            m_calls     = 0;
+            m_nextCheck = m_iters;
+        }
+        if(i < m_iters)
+            return true;
+        if(!m_enabled || m_ciTarget <= 0 || i == 0 || i >= m_maxIters)
+            return false;
+        if(i < m_nextCheck)
+            return true;
+        // The bootstrap is redone as the calls grow by a quarter, not after every call
+        m_nextCheck = i + i / 4;
+        return statistics().ciRelativeWidth() > m_ciTarget;
+    }
+
+    void start(int i)
+    {
+        if(!m_enabled)
+            return;
+        while(m_starts.size() <= size_t(i))
+        {
+            m_starts.emplace_back();
+            m_stops.emplace_back();
+            CHECK_HIP_ERROR(hipEventCreate(&m_starts.back()));
+            CHECK_HIP_ERROR(hipEventCreate(&m_stops.back()));
+        }
+        CHECK_HIP_ERROR(hipEventRecord(m_starts[i], m_stream));
+        m_calls = i + 1;
+    }
+
+    void stop(int i)
+    {
+        if(m_enabled)
+            CHECK_HIP_ERROR(hipEventRecord(m_stops[i], m_stream));
+    }
+
+    // Replaces the time of the batch by the median times the --iters the logging divides by
+    void finish(double& gpu_time_used)
+    {
+        if(!m_enabled || !m_calls)
+            return;
+        TensileLite::Client::TimingStatistics stats = statistics();
+        ArgumentModel_set_timing_statistics(stats);
+        gpu_time_used = stats.median * std::max(1, m_iters);
+    }
+
+private:
+    TensileLite::Client::TimingStatistics statistics()
+    {
+        CHECK_HIP_ERROR(hipEventSynchronize(m_stops[m_calls - 1]));
+        std::vector<double> times(m_calls);
+        for(int i = 0; i < m_calls; i++)
+        {
+            float ms = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, m_starts[i], m_stops[i]));
+            times[i] = ms * 1000.0;
+        }
+        return TensileLite::Client::timingStatistics(times);
+    }
+
+    bool                    m_enabled;
+    int32_t                 m_iters;
+    int32_t                 m_maxIters;
+    double                  m_ciTarget;
+    hipStream_t             m_stream;
+    int32_t                 m_calls     = 0;
+    int32_t                 m_nextCheck = 0;
+    std::vector<hipEvent_t> m_starts, m_stops;
+};
+
 template <typename Tout>
 Tout cast_from_type(void* in, hipDataType type, size_t index)
 {
@@ -119,20 +223,20 @@ Tout cast_from_type(void* in, hipDataType type, size_t index)
         return static_cast<Tout>((static_cast<hip_bfloat16*>(in))[index]);
     case HIP_R_8F_E4M3_FNUZ:
         if constexpr(std::is_same<Tout, float>::value)
-            return static_cast<Tout>((static_cast<hipblaslt_f8_fnuz*>(in))[index]);
+            return host_cast<Tout>((static_cast<hipblaslt_f8_fnuz*>(in))[index]);
         return 0;
     case HIP_R_8F_E5M2_FNUZ:
         if constexpr(std::is_same<Tout, float>::value)
-            return static_cast<Tout>((static_cast<hipblaslt_bf8_fnuz*>(in))[index]);
+            return host_cast<Tout>((static_cast<hipblaslt_bf8_fnuz*>(in))[index]);
         return 0;
 #ifdef ROCM_USE_FLOAT8
     case HIP_R_8F_E4M3:
         if constexpr(std::is_same<Tout, float>::value)
-            return static_cast<Tout>((static_cast<hipblaslt_f8*>(in))[index]);
+            return host_cast<Tout>((static_cast<hipblaslt_f8*>(in))[index]);
         return 0;
     case HIP_R_8F_E5M2:
         if constexpr(std::is_same<Tout, float>::value)
-            return static_cast<Tout>((static_cast<hipblaslt_bf8*>(in))[index]);
+            return host_cast<Tout>((static_cast<hipblaslt_bf8*>(in))[index]);
         return 0;
 #endif
     case HIP_R_32I:
@@ -187,6 +291,59 @@ void saturate_cast_to_type(void* dst, Tin src, hipDataType typeD, size_t indexD)
     }
 }
 
+// The largest finite value of an FP8 type, that the conversions of the passes of hipblasLtMatmul
+// clip to, 0 for the other types
+inline float fp8_max_finite(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8F_E4M3_FNUZ:
+        return 240.f;
+    case HIP_R_8F_E5M2_FNUZ:
+        return 57344.f;
+#ifdef ROCM_USE_FLOAT8
+    case HIP_R_8F_E4M3:
+        return 448.f;
+    case HIP_R_8F_E5M2:
+        return 57344.f;
+#endif
+    default:
+        return 0.f;
+    }
+}
+
+// saturate_cast_to_type of a result of a pass, FP8 clipped like the device conversion
+inline void pass_cast_to_type(void* dst, float src, hipDataType typeD, size_t indexD)
+{
+    if(float max = fp8_max_finite(typeD))
+        src = std::min(std::max(src, -max), max);
+    saturate_cast_to_type(dst, src, typeD, indexD);
+}
+
+// Philox4x32-10 block of the dropout of hipblasLtMatmul
+void philox4x32_host(uint32_t x[4], uint64_t counter, uint64_t subsequence, uint64_t key)
+{
+    uint32_t c0 = uint32_t(counter), c1 = uint32_t(counter >> 32);
+    uint32_t c2 = uint32_t(subsequence), c3 = uint32_t(subsequence >> 32);
+    uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32);
+    for(int round = 0; round < 10; ++round)
+    {
+        const uint64_t p0 = uint64_t(0xD2511F53u) * c0;
+        const uint64_t p1 = uint64_t(0xCD9E8D57u) * c2;
+
+        c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        c1 = uint32_t(p1);
+        c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c3 = uint32_t(p0);
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    x[0] = c0;
+    x[1] = c1;
+    x[2] = c2;
+    x[3] = c3;
+}
+
 template <typename Ti, typename Tc, typename Tact, typename F>
 void epilogue_func(int64_t     m,
                    int64_t     n,
@@ -589,17 +746,26 @@ void testing_matmul_bad_arg(const Arguments& arg)
     hipStream_t stream = nullptr;
 }
 
+// Queue the copies after the work on the stream, the host buffers are pinned so the host can
+// go on until it synchronizes with the stream
+void copy_gemm_to_host_async(hipStream_t                   stream,
+                             const uint32_t&               gemm_count,
+                             std::vector<HipHostBuffer>&   hDst,
+                             std::vector<HipDeviceBuffer>& dSrc)
+{
+    for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
+    {
+        CHECK_HIP_ERROR(synchronize_async(hDst[gemmIdx], dSrc[gemmIdx], stream));
+    }
+}
+
 void copy_gemm_to_host(hipStream_t                   stream,
                        const uint32_t&               gemm_count,
                        std::vector<HipHostBuffer>&   hDst,
                        std::vector<HipDeviceBuffer>& dSrc)
 {
-
+    copy_gemm_to_host_async(stream, gemm_count, hDst, dSrc);
     CHECK_HIP_ERROR(hipStreamSynchronize(stream));
-    for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
-    {
-        CHECK_HIP_ERROR(synchronize(hDst[gemmIdx], dSrc[gemmIdx]));
-    }
 }
 
 void check(hipStream_t                   stream,
@@ -631,7 +797,8 @@ void check(hipStream_t                   stream,
            double&                       hipblaslt_rtol,
            hipDataType                   To,
            hipDataType                   Tbias,
-           hipDataType                   Tc)
+           hipDataType                   Tc,
+           hipDataType                   Te)
 {
     // fetch GPU
     CHECK_HIP_ERROR(hipStreamSynchronize(stream));
@@ -714,7 +881,7 @@ void check(hipStream_t                   stream,
                                        hE[gemmIdx].buf(),
                                        num_batches[gemmIdx],
                                        tol[gemmIdx],
-                                       To);
+                                       Te);
                 }
                 else
                 {
@@ -725,7 +892,7 @@ void check(hipStream_t                   stream,
                                        hE_gold[gemmIdx].buf(),
                                        hE[gemmIdx].buf(),
                                        num_batches[gemmIdx],
-                                       To);
+                                       Te);
                 }
             }
             if(arg.gradient && arg.bias_vector)
@@ -800,11 +967,11 @@ void check(hipStream_t                   stream,
                                                          hE_gold[gemmIdx].buf(),
                                                          hE[gemmIdx].buf(),
                                                          num_batches[gemmIdx],
-                                                         To));
+                                                         Te));
                 hipblaslt_error += norm_error;
                 if(arg.norm_check_assert)
                 {
-                    CHECK_SUCCESS(norm_check(norm_error, To));
+                    CHECK_SUCCESS(norm_check(norm_error, Te));
                 }
             }
             if(arg.gradient && arg.bias_vector)
@@ -845,6 +1012,98 @@ void check(hipStream_t                   stream,
     }
 }
 
+// Compare an output of a pass of hipblasLtMatmul in the layout of D like check does for D
+void check_pass_output(const Arguments& arg,
+                       int64_t          m,
+                       int64_t          n,
+                       int64_t          ld,
+                       int64_t          stride,
+                       int              batch_count,
+                       HipHostBuffer&   hGold,
+                       HipHostBuffer&   hResult,
+                       double&          hipblaslt_error,
+                       hipDataType      type)
+{
+    if(arg.unit_check)
+        unit_check_general(m, n, ld, stride, hGold.buf(), hResult.buf(), batch_count, type);
+
+    if(arg.norm_check)
+    {
+        double norm_error = std::abs(norm_check_general(
+            'F', m, n, ld, stride, hGold.buf(), hResult.buf(), batch_count, type));
+        hipblaslt_error += norm_error;
+        if(arg.norm_check_assert)
+            CHECK_SUCCESS(norm_check(norm_error, type));
+    }
+}
+
+// Assert and accumulate a reference_error like check does for a full host comparison
+void check_reference_error(const Arguments&      arg,
+                           const reference_error& error,
+                           const char*            reference,
+                           double&                hipblaslt_error,
+                           double&                hipblaslt_atol,
+                           double&                hipblaslt_rtol,
+                           hipDataType            To)
+{
+    if(arg.unit_check)
+    {
+        if(error.mismatches)
+            hipblaslt_cerr << error.mismatches << " elements of D differ from the " << reference
+                           << std::endl;
+        CHECK_SUCCESS(error.mismatches == 0);
+    }
+
+    if(arg.norm_check)
+    {
+        hipblaslt_error += error.norm_error;
+        if(arg.norm_check_assert)
+        {
+            CHECK_SUCCESS(norm_check(error.norm_error, To));
+        }
+    }
+
+    if(arg.allclose_check)
+    {
+        hipblaslt_atol = error.atol;
+        hipblaslt_rtol = error.rtol;
+    }
+}
+
+// Compare D against the device reference, only the error summaries come back to the host
+void check_gpu_reference(hipStream_t                   stream,
+                         const Arguments&              arg,
+                         const uint32_t&               gemm_count,
+                         const std::vector<int64_t>&   M,
+                         const std::vector<int64_t>&   N,
+                         const std::vector<int64_t>&   ldd,
+                         const std::vector<int64_t>&   stride_d,
+                         const std::vector<int>&       num_batches,
+                         std::vector<HipDeviceBuffer>& dD_ref,
+                         std::vector<HipDeviceBuffer>& dD,
+                         std::vector<double>&          tol,
+                         double&                       hipblaslt_error,
+                         double&                       hipblaslt_atol,
+                         double&                       hipblaslt_rtol,
+                         hipDataType                   To)
+{
+    for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
+    {
+        reference_error error = hipblaslt_gpu_compare(M[gemmIdx],
+                                                      N[gemmIdx],
+                                                      ldd[gemmIdx],
+                                                      stride_d[gemmIdx],
+                                                      num_batches[gemmIdx],
+                                                      dD_ref[gemmIdx].buf(),
+                                                      dD[gemmIdx].buf(),
+                                                      To,
+                                                      tol[gemmIdx],
+                                                      stream);
+        check_reference_error(
+            arg, error, "GPU reference", hipblaslt_error, hipblaslt_atol, hipblaslt_rtol, To);
+    }
+}
+
 // A function to determing the default bias_type
 hipDataType derive_unset_bias_type(const Arguments& arg)
 {
@@ -861,7 +1120,8 @@ hipDataType derive_unset_bias_type(const Arguments& arg)
         {
             real_bias_type = HIP_R_32I;
         }
-        else if(arg.compute_type == HIPBLAS_COMPUTE_32F_FAST_TF32)
+        else if(arg.compute_type == HIPBLAS_COMPUTE_32F_FAST_TF32
+                || arg.compute_type == HIPBLASLT_COMPUTE_32F_FAST_3XBF16_EXT)
         {
             real_bias_type = HIP_R_32F;
         }
@@ -1001,6 +1261,116 @@ void testing_matmul_with_bias(const Arguments& arg,
                               hipDataType      TciB,
                               hipDataType      Tbias)
 {
+    // hipblasLtMatmul takes device alpha and beta for the f32 compute types
+    if(arg.pointer_mode_device
+       && (arg.use_ext || arg.grouped_gemm > 0 || arg.scaleAlpha_vector || Tc != HIP_R_32F))
+    {
+        hipblaslt_cout << "Device alpha and beta need hipblasLtMatmul, no alpha vector and f32 "
+                       << "alpha, skipping." << std::endl;
+        return;
+    }
+
+    // The AUX output E may take its own type, scaled by scaleE, and an amax
+    hipDataType Te     = arg.aux_type != HIPBLASLT_DATATYPE_INVALID ? arg.aux_type : To;
+    bool        aux_on = arg.use_e && !arg.gradient && (Te != To || arg.aux_amax);
+    if((arg.aux_type != HIPBLASLT_DATATYPE_INVALID || arg.aux_amax)
+       && (!arg.use_e || arg.gradient))
+    {
+        hipblaslt_cout << "An AUX type or amax needs use_e without gradient, skipping."
+                       << std::endl;
+        return;
+    }
+
+    if(arg.bgrad_deterministic
+       && (!arg.gradient || !arg.bias_vector || arg.batch_count > 1 || arg.c_equal_d))
+    {
+        hipblaslt_cout << "A deterministic bias gradient needs gradient, bias_vector, one batch "
+                       << "and a C apart from D, skipping." << std::endl;
+        return;
+    }
+
+    if(arg.residual_position
+       && (arg.gradient || arg.use_e || arg.scaleD || arg.amaxD || arg.scaleD_vector
+           || (To != HIP_R_32F && To != HIP_R_16F && To != HIP_R_16BF)))
+    {
+        hipblaslt_cout << "A residual needs a float D and no gradient, AUX, scaleD or amaxD, "
+                       << "skipping." << std::endl;
+        return;
+    }
+
+    if(arg.dropout > 0
+       && (arg.gradient || arg.use_e || arg.amaxD || arg.scaleD_vector || arg.residual_position
+           || (To != HIP_R_32F && To != HIP_R_16F && To != HIP_R_16BF)))
+    {
+        hipblaslt_cout << "A dropout needs a float D and no gradient, AUX, amaxD, D scale vector "
+                       << "or residual, skipping." << std::endl;
+        return;
+    }
+
+    if(arg.amax_history && (!arg.amaxD || !fp8_max_finite(To)))
+    {
+        hipblaslt_cout << "An amax history needs amaxD and an FP8 D, skipping." << std::endl;
+        return;
+    }
+
+    // The passes that hipblasLtMatmul runs around the GEMM take the C API
+    bool pass_on = arg.d2_type != HIPBLASLT_DATATYPE_INVALID || arg.scaleD_vector || aux_on
+                   || arg.bgrad_deterministic || arg.residual_position || arg.dropout > 0
+                   || arg.amax_history;
+
+    // E8M0 block scales dequantize FP8 operands for an f32 GEMM, the other operand unscaled
+    bool blockA = arg.scaleA == hipblaslt_scaling_format::Block;
+    bool blockB = arg.scaleB == hipblaslt_scaling_format::Block;
+    if((blockA || blockB)
+       && ((blockA && !fp8_max_finite(TiA)) || (blockB && !fp8_max_finite(TiB))
+           || (!blockA && arg.scaleA != hipblaslt_scaling_format::none)
+           || (!blockB && arg.scaleB != hipblaslt_scaling_format::none) || Tc != HIP_R_32F
+           || arg.amaxScaleA || arg.amaxScaleB || pass_on))
+    {
+        hipblaslt_cout << "Block scales need FP8 operands, f32 compute and no other A or B "
+                       << "scale or pass, skipping." << std::endl;
+        return;
+    }
+    pass_on = pass_on || blockA || blockB;
+
+    // A weight-only quantized int8 or int4 B is dequantized by groups along k to the type of A
+    bool quantB = arg.b_quant_group > 0;
+    if(quantB != (TiB == HIP_R_8I && TiA != HIP_R_8I)
+       || (quantB
+           && ((TiA != HIP_R_16F && TiA != HIP_R_16BF)
+               || arg.scaleB != hipblaslt_scaling_format::none || pass_on))
+       || (arg.b_quant_int4 && !quantB))
+    {
+        hipblaslt_cout << "A quantized B needs an int8 B, an f16 or bf16 A and no B scale or "
+                       << "other pass, skipping." << std::endl;
+        return;
+    }
+    pass_on = pass_on || quantB;
+
+    // The gated epilogues give D half the rows of the GEMM result and C
+    bool gated = arg.activation_type == hipblaslt_activation_type::swiglu
+                 || arg.activation_type == hipblaslt_activation_type::geglu;
+    if(gated
+       && (arg.gradient || arg.use_e || arg.scaleD || arg.amaxD || arg.c_equal_d || arg.M[0] % 2
+           || pass_on || (To != HIP_R_32F && To != HIP_R_16F && To != HIP_R_16BF)))
+    {
+        hipblaslt_cout << "A gated epilogue needs an even m, a float D apart from C and no "
+                       << "gradient, AUX, scaleD, amaxD or other pass, skipping." << std::endl;
+        return;
+    }
+    pass_on = pass_on || gated;
+    if(pass_on && (arg.use_ext || arg.grouped_gemm > 0))
+    {
+        hipblaslt_cout << "The passes around the GEMM need hipblasLtMatmul, skipping."
+                       << std::endl;
+        return;
+    }
+    if(arg.scaleD_vector && (arg.scaleD || arg.amaxD))
+    {
+        hipblaslt_cout << "A D scale vector takes no scaleD or amaxD, skipping." << std::endl;
+        return;
+    }
+
     double gpu_time_used, cpu_time_used, gpu_mem_gbytes;
     gpu_time_used = cpu_time_used = gpu_mem_gbytes = 0.0;
     bool                   HMM                     = arg.HMM;
@@ -1015,14 +1385,47 @@ void testing_matmul_with_bias(const Arguments& arg,
     hipblasOperation_t transA(char_to_hipblas_operation(arg.transA));
     hipblasOperation_t transB(char_to_hipblas_operation(arg.transB));
 
-    hipDataType Talpha = Tc;
+    hipDataType Talpha  = Tc;
+    hipDataType TscaleA = blockA ? HIP_R_8U : Talpha;
+    hipDataType TscaleB = blockB ? HIP_R_8U : Talpha;
 
     bool    do_grouped_gemm = arg.grouped_gemm > 0;
     int32_t gemm_count      = std::max(1, arg.grouped_gemm);
     int64_t rotating        = arg.rotating * 1024 * 1024;
 
+    // The GPU reference covers the forward epilogues, the rest is validated on the CPU.
+    // Bounded validation always runs on the device.
+    bool validate      = arg.unit_check || arg.norm_check || arg.allclose_check;
+    bool gpu_reference = validate && (arg.gpu_reference || arg.validation == 3);
+    if(gpu_reference && (arg.gradient || arg.use_e || arg.amaxD || arg.c_equal_d || pass_on))
+    {
+        hipblaslt_cout << "GPU reference does not support gradient, use_e, amaxD, c_equal_d or "
+                       << "the passes around the GEMM, using the CPU reference." << std::endl;
+        gpu_reference = false;
+    }
+    bool host_reference = validate && !gpu_reference;
+
+    // The bounded check recomputes the reference, so no D_ref is kept for it
+    bool bounded = gpu_reference && arg.validation == 3;
+
+    // Sampled and checksum validations replace the full CPU GEMM of the forward epilogues
+    int32_t validation = host_reference && arg.validation != 3 ? arg.validation : 0;
+    if(validation && (arg.gradient || arg.use_e || arg.amaxD || arg.c_equal_d || pass_on))
+    {
+        hipblaslt_cout << "Sampled and checksum validation do not support gradient, use_e, amaxD, "
+                       << "c_equal_d or the passes around the GEMM, validating every element."
+                       << std::endl;
+        validation = 0;
+    }
+    if(validation == 2 && arg.activation_type != hipblaslt_activation_type::none)
+    {
+        hipblaslt_cout << "Checksum validation needs a linear epilogue, using sampled validation."
+                       << std::endl;
+        validation = 1;
+    }
+
     std::vector<int64_t> M(gemm_count), N(gemm_count), K(gemm_count), lda(gemm_count),
-        ldb(gemm_count), ldc(gemm_count), ldd(gemm_count), lde(gemm_count);
+        ldb(gemm_count), ldc(gemm_count), ldd(gemm_count), lde(gemm_count), rowsD(gemm_count);
     std::vector<computeTypeInterface> h_alpha(gemm_count), h_beta(gemm_count);
     std::vector<int64_t> A_row(gemm_count), A_col(gemm_count), B_row(gemm_count), B_col(gemm_count);
     std::vector<int64_t> stride_a(gemm_count), stride_b(gemm_count), stride_c(gemm_count),
@@ -1031,32 +1434,50 @@ void testing_matmul_with_bias(const Arguments& arg,
     std::vector<int>    num_batches(gemm_count);
     std::vector<size_t> size_A(gemm_count), size_B(gemm_count), size_C(gemm_count),
         size_D(gemm_count), size_D_copy(gemm_count), size_E(gemm_count), size_bias(gemm_count),
-        size_scaleAlphaVec(gemm_count), size_scaleAVec(gemm_count), size_scaleBVec(gemm_count);
+        size_scaleAlphaVec(gemm_count), size_scaleAVec(gemm_count), size_scaleBVec(gemm_count),
+        size_scaleDVec(gemm_count);
 
     std::vector<hipblasLtMatrixLayout_t> matA(gemm_count), matB(gemm_count), matC(gemm_count),
         matD(gemm_count);
     std::vector<std::vector<hipblasLtMatmulDesc_t>> matmul;
     std::vector<hipblasLtEpilogue_t> epilogue(gemm_count, HIPBLASLT_EPILOGUE_DEFAULT);
 
-    std::vector<HipDeviceBuffer>  dA, dB, dC, dD, dE, dBias;
+    std::vector<HipDeviceBuffer>  dA, dB, dC, dD, dE, dBias, dD_ref;
     std::vector<HipDeviceBuffer>* dDp;
     std::vector<HipDeviceBuffer>  dScaleAlphaVec, dScaleA, dScaleB, dScaleC, dScaleD, dScaleE,
-        dAmaxD;
+        dAmaxD, dAlpha, dBeta;
+    std::vector<HipDeviceBuffer>  dD2, dScaleD2, dScaleDVec, dEAmax, dR, dSeed, dOffset, dMask;
+    std::vector<HipDeviceBuffer>  dHistory, dHistoryIndex, dHistoryScale, dBQuantScale,
+        dBQuantZero;
 
     std::vector<HipHostBuffer> hE, hE_gold, hBias, hBias_gold;
     std::vector<HipHostBuffer> hA, hB, hC, hD_gold, hD_1;
     std::vector<HipHostBuffer> hScaleAlphaVec, hScaleA, hScaleB, hScaleC, hScaleD, hScaleE,
         hAmaxD_gold, hAmaxD, hD_gold_epl, hD_gold_ScaleAlpha, hBias_gold_epl;
+    std::vector<HipHostBuffer> hD2, hD2_gold, hScaleDVec, hE_pre, hEAmax, hEAmax_gold, hR;
+    std::vector<HipHostBuffer> hMask, hMask_gold, hBQuantScale, hBQuantZero;
+
+    // A power of two, so that D2 is D converted once
+    const float scaleD2 = 0.5f;
+
+    // The Philox stream of the dropout, and the 32 bit words of its mask per column
+    const uint64_t       dropoutSeed   = 0x2545F4914F6CDD1Dull;
+    const uint64_t       dropoutOffset = 7;
+    std::vector<int64_t> maskWords(gemm_count);
+
+    // The next D scale of an amax history is 2^-margin of the largest finite FP8 value
+    const int32_t amaxHistoryMargin = 1;
 
-    std::vector<void*> alpha_in(gemm_count);
+    std::vector<void*> alpha_in(gemm_count), beta_in(gemm_count);
 
     // Need to split into two for loop to calculate the rotating buffer
     int64_t totalRotatingSizeNeeded = 0;
     for(int i = 0; i < gemm_count; i++)
     {
-        M[i] = arg.M[i];
-        N[i] = arg.N[i];
-        K[i] = arg.K[i];
+        M[i]     = arg.M[i];
+        N[i]     = arg.N[i];
+        K[i]     = arg.K[i];
+        rowsD[i] = gated ? M[i] / 2 : M[i];
         set_alpha_type(h_alpha[i], arg, Tc);
         set_beta_type(h_beta[i], arg, Tc);
         lda[i] = arg.lda[i];
@@ -1098,20 +1519,25 @@ void testing_matmul_with_bias(const Arguments& arg,
             size_D[i]   = size_C[i];
         }
 
-        size_D_copy[i] = (arg.unit_check || arg.norm_check || arg.allclose_check) ? size_D[i] : 0;
+        size_D_copy[i]        = host_reference ? size_D[i] : 0;
         size_scaleAlphaVec[i] = arg.scaleAlpha_vector ? M[i] : 0;
         if(arg.scaleA == hipblaslt_scaling_format::Scalar)
             size_scaleAVec[i] = 1;
         else if(arg.scaleA == hipblaslt_scaling_format::Vector)
             size_scaleAVec[i] = M[i];
+        else if(arg.scaleA == hipblaslt_scaling_format::Block)
+            size_scaleAVec[i] = M[i] * ((K[i] + 31) / 32) * num_batches[i];
         else
             size_scaleAVec[i] = 0;
         if(arg.scaleB == hipblaslt_scaling_format::Scalar)
             size_scaleBVec[i] = 1;
         else if(arg.scaleB == hipblaslt_scaling_format::Vector)
             size_scaleBVec[i] = N[i];
+        else if(arg.scaleB == hipblaslt_scaling_format::Block)
+            size_scaleBVec[i] = ((K[i] + 31) / 32) * N[i] * num_batches[i];
         else
             size_scaleBVec[i] = 0;
+        size_scaleDVec[i] = arg.scaleD_vector == 2 ? N[i] : arg.scaleD_vector ? M[i] : 0;
         if(arg.bias_vector)
         {
             if(arg.bias_source == hipblaslt_bias_source::a
@@ -1128,17 +1554,36 @@ void testing_matmul_with_bias(const Arguments& arg,
         int64_t sizeC    = get_computeInterface(h_beta[i], Tc) == 0 ? 0 : size_C[i] * sizeof(To);
         totalRotatingSizeNeeded
             += size_A[i] * realDataTypeSize(TiA) + size_B[i] * realDataTypeSize(TiB) + sizeC
-               + size_D[i] * realDataTypeSize(To) + size_E[i] * realDataTypeSize(To) + biasSize
+               + size_D[i] * realDataTypeSize(To) + size_E[i] * realDataTypeSize(Te) + biasSize
                + size_scaleAlphaVec[i] * realDataTypeSize(Talpha)
-               + size_scaleAVec[i] * realDataTypeSize(Talpha)
-               + size_scaleBVec[i] * realDataTypeSize(Talpha);
+               + size_scaleAVec[i] * realDataTypeSize(TscaleA)
+               + size_scaleBVec[i] * realDataTypeSize(TscaleB);
     }
 
     gpu_mem_gbytes = static_cast<double>(totalRotatingSizeNeeded) / (1024 * 1024 * 1024);
 
     // Calculating block count
-    int32_t max_iters   = max(arg.cold_iters, arg.iters);
+    TensileLite::Client::DeviceCacheSizes caches;
+
+    int32_t max_iters = max(arg.cold_iters, arg.iters);
+    if(arg.rotating == HIPBLASLT_ROTATING_AUTO)
+    {
+        int device;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+        caches   = TensileLite::Client::deviceCacheSizes(device);
+        rotating = TensileLite::Client::coldCacheRotatingSize(caches, totalRotatingSizeNeeded);
+    }
     int32_t block_count = max(1, min(max_iters, ceil((float)rotating / totalRotatingSizeNeeded)));
+    if(arg.rotating == HIPBLASLT_ROTATING_AUTO)
+    {
+        hipblaslt_cout << "Rotating buffer auto (cold caches). "
+                       << "L2: " << caches.l2 / (1024 * 1024) << " MiB. "
+                       << "MALL: " << caches.mall / (1024 * 1024) << " MiB. ";
+    }
+    else if(arg.rotating == HIPBLASLT_ROTATING_WARM)
+    {
+        hipblaslt_cout << "Rotating buffer warm (one block, operands stay cached)." << std::endl;
+    }
     if(rotating > 0)
     {
         hipblaslt_cout << "Rotating buffer " << rotating / (1024 * 1024) << " MiB. "
@@ -1154,11 +1599,15 @@ void testing_matmul_with_bias(const Arguments& arg,
         CHECK_HIPBLASLT_ERROR(
             hipblasLtMatrixLayoutCreate(&(matA[i]), arg.a_type, A_row[i], A_col[i], lda[i]));
         CHECK_HIPBLASLT_ERROR(
-            hipblasLtMatrixLayoutCreate(&(matB[i]), arg.b_type, B_row[i], B_col[i], ldb[i]));
+            hipblasLtMatrixLayoutCreate(&(matB[i]),
+                                        arg.b_quant_int4 ? HIP_R_4I : arg.b_type,
+                                        B_row[i],
+                                        B_col[i],
+                                        ldb[i]));
         CHECK_HIPBLASLT_ERROR(
             hipblasLtMatrixLayoutCreate(&(matC[i]), arg.c_type, M[i], N[i], ldc[i]));
         CHECK_HIPBLASLT_ERROR(
-            hipblasLtMatrixLayoutCreate(&(matD[i]), arg.d_type, M[i], N[i], ldc[i]));
+            hipblasLtMatrixLayoutCreate(&(matD[i]), arg.d_type, rowsD[i], N[i], ldc[i]));
 
         if(do_batched[i])
         {
@@ -1234,6 +1683,12 @@ void testing_matmul_with_bias(const Arguments& arg,
             case hipblaslt_activation_type::gelu:
                 epilogue[i] = HIPBLASLT_EPILOGUE_GELU_BIAS;
                 break;
+            case hipblaslt_activation_type::swiglu:
+                epilogue[i] = HIPBLASLT_EPILOGUE_SWIGLU_BIAS;
+                break;
+            case hipblaslt_activation_type::geglu:
+                epilogue[i] = HIPBLASLT_EPILOGUE_GEGLU_BIAS;
+                break;
             default:
                 epilogue[i] = HIPBLASLT_EPILOGUE_BIAS;
                 break;
@@ -1251,6 +1706,14 @@ void testing_matmul_with_bias(const Arguments& arg,
                 epilogue[i]    = HIPBLASLT_EPILOGUE_GELU;
                 epilogue_on[i] = true;
                 break;
+            case hipblaslt_activation_type::swiglu:
+                epilogue[i]    = HIPBLASLT_EPILOGUE_SWIGLU;
+                epilogue_on[i] = true;
+                break;
+            case hipblaslt_activation_type::geglu:
+                epilogue[i]    = HIPBLASLT_EPILOGUE_GEGLU;
+                epilogue_on[i] = true;
+                break;
             default:
                 break;
             }
@@ -1329,18 +1792,16 @@ void testing_matmul_with_bias(const Arguments& arg,
 
         if(arg.use_e)
         {
-            dE.emplace_back(To, size_E[i] * block_count, HMM);
+            dE.emplace_back(Te, size_E[i] * block_count, HMM);
         }
 
-        if(arg.scaleA == hipblaslt_scaling_format::Scalar
-           || arg.scaleA == hipblaslt_scaling_format::Vector)
+        if(arg.scaleA != hipblaslt_scaling_format::none)
         {
-            dScaleA.emplace_back(Talpha, size_scaleAVec[i] * block_count, HMM);
+            dScaleA.emplace_back(TscaleA, size_scaleAVec[i] * block_count, HMM);
         }
-        if(arg.scaleB == hipblaslt_scaling_format::Scalar
-           || arg.scaleB == hipblaslt_scaling_format::Vector)
+        if(arg.scaleB != hipblaslt_scaling_format::none)
         {
-            dScaleB.emplace_back(Talpha, size_scaleBVec[i] * block_count, HMM);
+            dScaleB.emplace_back(TscaleB, size_scaleBVec[i] * block_count, HMM);
         }
         if(arg.scaleC)
         {
@@ -1359,12 +1820,56 @@ void testing_matmul_with_bias(const Arguments& arg,
         {
             dScaleE.emplace_back(Talpha, 1, HMM);
         }
+        if(arg.pointer_mode_device)
+        {
+            dAlpha.emplace_back(Talpha, 1, HMM);
+            dBeta.emplace_back(Talpha, 1, HMM);
+        }
+        if(arg.d2_type != HIPBLASLT_DATATYPE_INVALID)
+        {
+            dD2.emplace_back(arg.d2_type, size_D[i], HMM);
+            dScaleD2.emplace_back(HIP_R_32F, 1, HMM);
+        }
+        if(arg.scaleD_vector)
+        {
+            // The unscaled result is kept in hD_gold_epl for the reference
+            epilogue_on[i] = true;
+            dScaleDVec.emplace_back(HIP_R_32F, size_scaleDVec[i], HMM);
+        }
+        if(arg.aux_amax)
+            dEAmax.emplace_back(HIP_R_32F, 1, HMM);
+        if(arg.residual_position)
+            dR.emplace_back(To, size_D[i], HMM);
+        if(quantB)
+        {
+            int64_t groups = (K[i] + arg.b_quant_group - 1) / arg.b_quant_group;
+            dBQuantScale.emplace_back(TiA, groups * N[i] * num_batches[i], HMM);
+            dBQuantZero.emplace_back(TiA, groups * N[i] * num_batches[i], HMM);
+        }
+        if(arg.dropout > 0)
+        {
+            maskWords[i] = (M[i] + 31) / 32;
+            dSeed.emplace_back(HIP_R_64U, 1, HMM);
+            dOffset.emplace_back(HIP_R_64U, 1, HMM);
+            dMask.emplace_back(HIP_R_32U, maskWords[i] * N[i] * num_batches[i], HMM);
+        }
+        if(arg.amax_history)
+        {
+            dHistory.emplace_back(HIP_R_32F, arg.amax_history, HMM);
+            dHistoryIndex.emplace_back(HIP_R_32I, 1, HMM);
+            dHistoryScale.emplace_back(HIP_R_32F, 1, HMM);
+        }
+
+        // The GPU reference is computed once, from the first block of the operands
+        if(gpu_reference && !bounded)
+            dD_ref.emplace_back(To, size_D[i], HMM);
 
         // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
-        hA.emplace_back(TiA, size_A[i]);
-        hB.emplace_back(TiB, size_B[i]);
-        hC.emplace_back(To, size_C[i]);
-        hD_gold.emplace_back(To, size_D_copy[i]);
+        // The inputs are initialized on the device, the host copies are only for the reference
+        hA.emplace_back(TiA, host_reference ? size_A[i] : 0);
+        hB.emplace_back(TiB, host_reference ? size_B[i] : 0);
+        hC.emplace_back(To, host_reference ? size_C[i] : 0);
+        hD_gold.emplace_back(To, validation ? 0 : size_D_copy[i]);
         hD_1.emplace_back(To, size_D_copy[i]);
         if(size_bias[i] * block_count != 0)
         {
@@ -1372,19 +1877,18 @@ void testing_matmul_with_bias(const Arguments& arg,
             hBias_gold.emplace_back(Tbias, size_bias[i]);
         }
 
-        hD_gold_epl.emplace_back(Talpha, size_D_copy[i]);
-        hD_gold_ScaleAlpha.emplace_back(Talpha, size_D_copy[i]);
-        hBias_gold_epl.emplace_back(Talpha, size_D_copy[i]); // Reduction for matrix D
+        hD_gold_epl.emplace_back(Talpha, validation ? 0 : size_D_copy[i]);
+        hD_gold_ScaleAlpha.emplace_back(Talpha, validation ? 0 : size_D_copy[i]);
+        hBias_gold_epl.emplace_back(Talpha,
+                                    validation ? 0 : size_D_copy[i]); // Reduction for matrix D
 
         if(arg.scaleAlpha_vector)
             hScaleAlphaVec.emplace_back(Talpha, size_scaleAlphaVec[i]);
 
-        if(arg.scaleA == hipblaslt_scaling_format::Scalar
-           || arg.scaleA == hipblaslt_scaling_format::Vector)
-            hScaleA.emplace_back(Talpha, size_scaleAVec[i]);
-        if(arg.scaleB == hipblaslt_scaling_format::Scalar
-           || arg.scaleB == hipblaslt_scaling_format::Vector)
-            hScaleB.emplace_back(Talpha, size_scaleBVec[i]);
+        if(arg.scaleA != hipblaslt_scaling_format::none)
+            hScaleA.emplace_back(TscaleA, size_scaleAVec[i]);
+        if(arg.scaleB != hipblaslt_scaling_format::none)
+            hScaleB.emplace_back(TscaleB, size_scaleBVec[i]);
         if(arg.scaleC)
             hScaleC.emplace_back(Talpha, 1);
         if(arg.scaleD)
@@ -1396,13 +1900,40 @@ void testing_matmul_with_bias(const Arguments& arg,
         }
         if(arg.scaleE)
             hScaleE.emplace_back(Talpha, 1);
+        if(arg.d2_type != HIPBLASLT_DATATYPE_INVALID)
+        {
+            hD2.emplace_back(arg.d2_type, size_D_copy[i]);
+            hD2_gold.emplace_back(arg.d2_type, size_D_copy[i]);
+        }
+        if(arg.scaleD_vector)
+            hScaleDVec.emplace_back(HIP_R_32F, size_scaleDVec[i]);
+        if(arg.residual_position)
+            hR.emplace_back(To, size_D[i]);
+        if(quantB)
+        {
+            int64_t groups = (K[i] + arg.b_quant_group - 1) / arg.b_quant_group;
+            hBQuantScale.emplace_back(TiA, groups * N[i] * num_batches[i]);
+            hBQuantZero.emplace_back(TiA, groups * N[i] * num_batches[i]);
+        }
+        if(arg.dropout > 0)
+        {
+            hMask.emplace_back(HIP_R_32U, maskWords[i] * N[i] * num_batches[i]);
+            hMask_gold.emplace_back(HIP_R_32U, maskWords[i] * N[i] * num_batches[i]);
+        }
 
         if(arg.use_e)
         {
-            hE.emplace_back(To, size_E[i]);
+            hE.emplace_back(Te, host_reference ? size_E[i] : 0);
             if(!arg.gradient)
             {
-                hE_gold.emplace_back(To, size_E[i]);
+                hE_gold.emplace_back(Te, host_reference ? size_E[i] : 0);
+            }
+            if(aux_on)
+                hE_pre.emplace_back(To, host_reference ? size_E[i] : 0);
+            if(arg.aux_amax)
+            {
+                hEAmax.emplace_back(HIP_R_32F, 1);
+                hEAmax_gold.emplace_back(HIP_R_32F, 1);
             }
         }
 
@@ -1439,21 +1970,49 @@ void testing_matmul_with_bias(const Arguments& arg,
                               stride_c[i],
                               num_batches[i]);
 
+        if(arg.gradient && arg.use_e)
+        {
+            hipblaslt_init_device(ABC::A,
+                                  hipblaslt_initialization::rand_int,
+                                  false,
+                                  dE[i].buf(),
+                                  M[i],
+                                  N[i],
+                                  lde[i],
+                                  To,
+                                  stride_e[i],
+                                  num_batches[i]);
+        }
+
         // broadcast first block
         CHECK_HIP_ERROR(broadcast(dA[i], block_count));
         CHECK_HIP_ERROR(broadcast(dB[i], block_count));
         CHECK_HIP_ERROR(broadcast(dC[i], block_count));
+        if(arg.gradient && arg.use_e)
+            CHECK_HIP_ERROR(broadcast(dE[i], block_count));
 
-        if(arg.unit_check || arg.norm_check || arg.allclose_check)
+        // The host operands are set up while they come back, until the copy of C to D_gold
+        if(host_reference)
         {
-            CHECK_HIP_ERROR(synchronize(hA[i], dA[i]));
-            CHECK_HIP_ERROR(synchronize(hB[i], dB[i]));
-            CHECK_HIP_ERROR(synchronize(hC[i], dC[i]));
+            CHECK_HIP_ERROR(synchronize_async(hA[i], dA[i]));
+            CHECK_HIP_ERROR(synchronize_async(hB[i], dB[i]));
+            CHECK_HIP_ERROR(synchronize_async(hC[i], dC[i]));
+            if(arg.gradient && arg.use_e)
+                CHECK_HIP_ERROR(synchronize_async(hE[i], dE[i]));
         }
 
-        if(arg.gradient && arg.use_e)
+        // An int4 B packs each block of the int8 B in place, the even element in the low nibble
+        if(arg.b_quant_int4)
         {
-            hipblaslt_init(hE[i].buf(), M[i], N[i], lde[i], To, stride_e[i], num_batches[i]);
+            size_t               bytes = size_B[i] * block_count;
+            std::vector<int8_t>  q(bytes);
+            std::vector<uint8_t> packed(bytes);
+            CHECK_HIP_ERROR(hipMemcpy(q.data(), dB[i].buf(), bytes, hipMemcpyDeviceToHost));
+            for(size_t b = 0; b < block_count; b++)
+                for(size_t e = 0; e < size_B[i]; e++)
+                    packed[b * size_B[i] + e / 2]
+                        |= (uint8_t(q[b * size_B[i] + e]) & 15) << (e % 2 * 4);
+            CHECK_HIP_ERROR(hipMemcpy(dB[i].buf(), packed.data(), bytes, hipMemcpyHostToDevice));
         }
 
         if(arg.bias_vector)
@@ -1469,6 +2028,15 @@ void testing_matmul_with_bias(const Arguments& arg,
            || arg.scaleB == hipblaslt_scaling_format::Vector)
             hipblaslt_init(hScaleB[i].buf(), size_scaleBVec[i], 1, size_scaleBVec[i], Talpha);
 
+        // E8M0 block scales 2^(e - 127) from 1/2 to 2
+        if(arg.scaleA == hipblaslt_scaling_format::Block)
+            for(int64_t s = 0; s < size_scaleAVec[i]; s++)
+                hScaleA[i].as<uint8_t>()[s] = uint8_t(126 + s % 3);
+
+        if(arg.scaleB == hipblaslt_scaling_format::Block)
+            for(int64_t s = 0; s < size_scaleBVec[i]; s++)
+                hScaleB[i].as<uint8_t>()[s] = uint8_t(126 + s % 2 * 2);
+
         if(arg.scaleC)
         {
             if(To == HIP_R_8F_E4M3_FNUZ || To == HIP_R_8F_E5M2_FNUZ)
@@ -1502,10 +2070,6 @@ void testing_matmul_with_bias(const Arguments& arg,
         if(arg.scaleAlpha_vector)
             hipblaslt_init(hScaleAlphaVec[i].buf(), M[i], 1, M[i], Talpha);
 
-        if(arg.gradient && arg.use_e)
-        {
-            CHECK_HIP_ERROR(synchronize(dE[i], hE[i], block_count));
-        }
         if(!arg.gradient && arg.bias_vector)
         {
             CHECK_HIP_ERROR(synchronize(dBias[i], hBias[i], block_count));
@@ -1520,9 +2084,21 @@ void testing_matmul_with_bias(const Arguments& arg,
         }
         else
             alpha_in[i] = &(h_alpha[i]);
+        beta_in[i] = &(h_beta[i]);
 
-        if(arg.scaleA == hipblaslt_scaling_format::Scalar
-           || arg.scaleA == hipblaslt_scaling_format::Vector)
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dAlpha[i].buf(),
+                                      &(h_alpha[i]),
+                                      realDataTypeSize(Talpha),
+                                      hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(
+                dBeta[i].buf(), &(h_beta[i]), realDataTypeSize(Talpha), hipMemcpyHostToDevice));
+            alpha_in[i] = dAlpha[i].buf();
+            beta_in[i]  = dBeta[i].buf();
+        }
+
+        if(arg.scaleA != hipblaslt_scaling_format::none)
         {
             if(arg.amaxScaleA && (arg.a_type == HIP_R_32F || arg.a_type == HIP_R_16F))
             {
@@ -1540,8 +2116,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                 CHECK_HIP_ERROR(synchronize(dScaleA[i], hScaleA[i], block_count));
         }
 
-        if(arg.scaleB == hipblaslt_scaling_format::Scalar
-           || arg.scaleB == hipblaslt_scaling_format::Vector)
+        if(arg.scaleB != hipblaslt_scaling_format::none)
         {
             if(arg.amaxScaleB && (arg.b_type == HIP_R_32F || arg.b_type == HIP_R_16F))
             {
@@ -1567,8 +2142,55 @@ void testing_matmul_with_bias(const Arguments& arg,
         if(arg.scaleE)
             CHECK_HIP_ERROR(synchronize(dScaleE[i], hScaleE[i]));
 
+        if(arg.d2_type != HIPBLASLT_DATATYPE_INVALID)
+            CHECK_HIP_ERROR(hipMemcpy(
+                dScaleD2[i].buf(), &scaleD2, sizeof(float), hipMemcpyHostToDevice));
+
+        if(arg.scaleD_vector)
+        {
+            // Powers of two of both signs from 2^-6 to 2, so that D is rounded once and the
+            // larger scales take integer and FP8 D out of range
+            for(size_t s = 0; s < size_scaleDVec[i]; s++)
+                hScaleDVec[i].as<float>()[s] = std::ldexp(s % 2 ? -1.f : 1.f, int(s % 8) - 6);
+            CHECK_HIP_ERROR(synchronize(dScaleDVec[i], hScaleDVec[i]));
+        }
+
+        if(quantB)
+        {
+            // Scales 2^-1, 2^0 and 2^1 and zero points -1, 0 and 1, so that B is dequantized
+            // exactly
+            int64_t groups = (K[i] + arg.b_quant_group - 1) / arg.b_quant_group;
+            for(int64_t s = 0; s < groups * N[i] * num_batches[i]; s++)
+            {
+                float scale = std::ldexp(1.f, int(s % 3) - 1);
+                saturate_cast_to_type(hBQuantScale[i].buf(), scale, TiA, s);
+                saturate_cast_to_type(hBQuantZero[i].buf(), float(s % 3) - 1.f, TiA, s);
+            }
+            CHECK_HIP_ERROR(synchronize(dBQuantScale[i], hBQuantScale[i]));
+            CHECK_HIP_ERROR(synchronize(dBQuantZero[i], hBQuantZero[i]));
+        }
+
+        if(arg.residual_position)
+        {
+            // Small integers, so that the residual adds no rounding of its own
+            for(size_t s = 0; s < size_D[i]; s++)
+                pass_cast_to_type(hR[i].buf(), float(s % 7) - 3.f, To, s);
+            CHECK_HIP_ERROR(synchronize(dR[i], hR[i]));
+        }
+
+        if(arg.dropout > 0)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(
+                dSeed[i].buf(), &dropoutSeed, sizeof(uint64_t), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(
+                dOffset[i].buf(), &dropoutOffset, sizeof(uint64_t), hipMemcpyHostToDevice));
+        }
+
         //// copy data from CPU to device end
-        if(size_D_copy[i])
+        if(host_reference)
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        if(size_D_copy[i] && !validation)
         {
             if(epilogue_on[i])
             {
@@ -1599,6 +2221,21 @@ void testing_matmul_with_bias(const Arguments& arg,
                                                 HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_BATCH_STRIDE,
                                                 &stride_e[i],
                                                 sizeof(int64_t)));
+            if(aux_on)
+                CHECK_HIPBLASLT_ERROR(
+                    hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                    HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE,
+                                                    &Te,
+                                                    sizeof(hipDataType)));
+            if(arg.aux_amax)
+            {
+                void* eAmax_addr = dEAmax[i].buf();
+                CHECK_HIPBLASLT_ERROR(
+                    hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                    HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER,
+                                                    &eAmax_addr,
+                                                    sizeof(void*)));
+            }
         }
 
         if(arg.bias_vector)
@@ -1618,8 +2255,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                 HIPBLAS_STATUS_SUCCESS);
         }
 
-        if(arg.scaleA == hipblaslt_scaling_format::Scalar
-           || arg.scaleA == hipblaslt_scaling_format::Vector)
+        if(arg.scaleA != hipblaslt_scaling_format::none)
         {
             hipblasLtMatmulDescAttributes_t attr
                 = arg.scaleA == hipblaslt_scaling_format::Vector
@@ -1630,8 +2266,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                 hipblasLtMatmulDescSetAttribute(matmul[0][i], attr, &scaleA_addr, sizeof(void*)));
         }
 
-        if(arg.scaleB == hipblaslt_scaling_format::Scalar
-           || arg.scaleB == hipblaslt_scaling_format::Vector)
+        if(arg.scaleB != hipblaslt_scaling_format::none)
         {
             hipblasLtMatmulDescAttributes_t attr
                 = arg.scaleB == hipblaslt_scaling_format::Vector
@@ -1642,6 +2277,21 @@ void testing_matmul_with_bias(const Arguments& arg,
                 hipblasLtMatmulDescSetAttribute(matmul[0][i], attr, &scaleB_addr, sizeof(void*)));
         }
 
+        if(arg.scaleA == hipblaslt_scaling_format::Block
+           || arg.scaleB == hipblaslt_scaling_format::Block)
+        {
+            int32_t modeA = arg.scaleA == hipblaslt_scaling_format::Block
+                                ? HIPBLASLT_MATMUL_MATRIX_SCALE_VEC32_UE8M0
+                                : HIPBLASLT_MATMUL_MATRIX_SCALE_SCALAR_32F;
+            int32_t modeB = arg.scaleB == hipblaslt_scaling_format::Block
+                                ? HIPBLASLT_MATMUL_MATRIX_SCALE_VEC32_UE8M0
+                                : HIPBLASLT_MATMUL_MATRIX_SCALE_SCALAR_32F;
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                matmul[0][i], HIPBLASLT_MATMUL_DESC_A_SCALE_MODE, &modeA, sizeof(int32_t)));
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                matmul[0][i], HIPBLASLT_MATMUL_DESC_B_SCALE_MODE, &modeB, sizeof(int32_t)));
+        }
+
         if(arg.scaleC)
         {
             void* scaleC_addr = dScaleC[i].buf();
@@ -1673,6 +2323,159 @@ void testing_matmul_with_bias(const Arguments& arg,
                                                 sizeof(void*)));
         }
 
+        if(arg.scaleD_vector)
+        {
+            void*   scaleDVec_addr = dScaleDVec[i].buf();
+            int32_t alongN         = arg.scaleD_vector == 2;
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT,
+                                                &scaleDVec_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT,
+                                                &alongN,
+                                                sizeof(int32_t)));
+        }
+
+        if(quantB)
+        {
+            void* scale_addr = dBQuantScale[i].buf();
+            void* zero_addr  = dBQuantZero[i].buf();
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_B_QUANT_SCALE_POINTER,
+                                                &scale_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_B_QUANT_ZERO_POINTER,
+                                                &zero_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_B_QUANT_GROUP_SIZE,
+                                                &arg.b_quant_group,
+                                                sizeof(int32_t)));
+        }
+
+        if(arg.residual_position)
+        {
+            void*                       r_addr   = dR[i].buf();
+            hipblasLtResidualPosition_t position = arg.residual_position == 2
+                                                       ? HIPBLASLT_RESIDUAL_BEFORE_ACTIVATION
+                                                       : HIPBLASLT_RESIDUAL_AFTER_ACTIVATION;
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                matmul[0][i], HIPBLASLT_MATMUL_DESC_RESIDUAL_POINTER, &r_addr, sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                matmul[0][i], HIPBLASLT_MATMUL_DESC_RESIDUAL_LD, &ldd[i], sizeof(int64_t)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_RESIDUAL_BATCH_STRIDE,
+                                                &stride_d[i],
+                                                sizeof(int64_t)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_RESIDUAL_POSITION,
+                                                &position,
+                                                sizeof(int32_t)));
+        }
+
+        if(arg.dropout > 0)
+        {
+            void* seed_addr   = dSeed[i].buf();
+            void* offset_addr = dOffset[i].buf();
+            void* mask_addr   = dMask[i].buf();
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_DROPOUT_PROBABILITY,
+                                                &arg.dropout,
+                                                sizeof(float)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_DROPOUT_SEED_POINTER,
+                                                &seed_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_DROPOUT_OFFSET_POINTER,
+                                                &offset_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_POINTER,
+                                                &mask_addr,
+                                                sizeof(void*)));
+        }
+
+        if(arg.amax_history)
+        {
+            void* history_addr = dHistory[i].buf();
+            void* index_addr   = dHistoryIndex[i].buf();
+            void* scale_addr   = dHistoryScale[i].buf();
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_POINTER,
+                                                &history_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH,
+                                                &arg.amax_history,
+                                                sizeof(int32_t)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER,
+                                                &index_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER,
+                                                &scale_addr,
+                                                sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_MARGIN,
+                                                &amaxHistoryMargin,
+                                                sizeof(int32_t)));
+        }
+
+        if(arg.bgrad_deterministic)
+        {
+            int32_t deterministic = 1;
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_BGRAD_DETERMINISTIC,
+                                                &deterministic,
+                                                sizeof(int32_t)));
+        }
+
+        if(arg.d2_type != HIPBLASLT_DATATYPE_INVALID)
+        {
+            void* d2_addr      = dD2[i].buf();
+            void* scaleD2_addr = dScaleD2[i].buf();
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                matmul[0][i], HIPBLASLT_MATMUL_DESC_D2_POINTER, &d2_addr, sizeof(void*)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_D2_DATA_TYPE,
+                                                &arg.d2_type,
+                                                sizeof(hipDataType)));
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+                matmul[0][i], HIPBLASLT_MATMUL_DESC_D2_LD, &ldd[i], sizeof(int64_t)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_D2_BATCH_STRIDE,
+                                                &stride_d[i],
+                                                sizeof(int64_t)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_D2_SCALE_POINTER,
+                                                &scaleD2_addr,
+                                                sizeof(void*)));
+        }
+
         if(arg.scaleAlpha_vector)
         {
             hipblasLtPointerMode_t scale_mode
@@ -1685,6 +2488,17 @@ void testing_matmul_with_bias(const Arguments& arg,
                 HIPBLAS_STATUS_SUCCESS);
         }
 
+        if(arg.pointer_mode_device)
+        {
+            hipblasLtPointerMode_t pointer_mode = HIPBLASLT_POINTER_MODE_DEVICE;
+            EXPECT_HIPBLAS_STATUS(
+                hipblasLtMatmulDescSetAttribute(matmul[0][i],
+                                                HIPBLASLT_MATMUL_DESC_POINTER_MODE,
+                                                &pointer_mode,
+                                                sizeof(pointer_mode)),
+                HIPBLAS_STATUS_SUCCESS);
+        }
+
         for(int32_t b = 1; b < matmul.size(); b++)
         {
             CHECK_HIPBLASLT_ERROR(
@@ -1719,15 +2533,14 @@ void testing_matmul_with_bias(const Arguments& arg,
             }
             if(arg.use_e)
             {
-                void* e_addr = (void*)(dE[i].as<char>() + b * size_E[i] * realDataTypeSize(To));
+                void* e_addr = (void*)(dE[i].as<char>() + b * size_E[i] * realDataTypeSize(Te));
                 CHECK_HIPBLASLT_ERROR(
                     hipblasLtMatmulDescSetAttribute(matmul[b][i],
                                                     HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_POINTER,
                                                     &e_addr,
                                                     sizeof(void*)));
             }
-            if(arg.scaleA == hipblaslt_scaling_format::Scalar
-               || arg.scaleA == hipblaslt_scaling_format::Vector)
+            if(arg.scaleA != hipblaslt_scaling_format::none)
             {
                 hipblasLtMatmulDescAttributes_t attr
                     = arg.scaleA == hipblaslt_scaling_format::Vector
@@ -1738,8 +2551,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                     matmul[b][i], attr, &scaleA_addr, sizeof(void*)));
             }
 
-            if(arg.scaleB == hipblaslt_scaling_format::Scalar
-               || arg.scaleB == hipblaslt_scaling_format::Vector)
+            if(arg.scaleB != hipblaslt_scaling_format::none)
             {
                 hipblasLtMatmulDescAttributes_t attr
                     = arg.scaleB == hipblaslt_scaling_format::Vector
@@ -1871,7 +2683,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                 if(arg.use_e)
                     extinputs[b][gemmIdx].setAux(
                         (void*)((dE[gemmIdx].as<char>())
-                                + b * size_E[gemmIdx] * realDataTypeSize(To)));
+                                + b * size_E[gemmIdx] * realDataTypeSize(Te)));
                 if(arg.scaleAlpha_vector)
                     extinputs[b][gemmIdx].setScaleAlphaVec(
                         (void*)((dScaleAlphaVec[gemmIdx].as<char>())
@@ -2330,6 +3142,29 @@ void testing_matmul_with_bias(const Arguments& arg,
     {
         std::vector<hipblasLtMatmulHeuristicResult_t> tmpAlgo;
 
+        if(!do_grouped_gemm && arg.print_selection_trace)
+        {
+            std::vector<hipblaslt_ext::SolutionSelectionCandidate> candidates;
+            CHECK_HIPBLASLT_ERROR(hipblaslt_ext::traceSolutionSelection(handle,
+                                                                        matmul[0][0],
+                                                                        matA[0],
+                                                                        matB[0],
+                                                                        matC[0],
+                                                                        matD[0],
+                                                                        max_workspace_size,
+                                                                        requestAlgoCount,
+                                                                        candidates));
+            hipblaslt_cout << "Selection trace: " << candidates.size() << " candidates\n"
+                           << "solution_index,accepted,rank,required_workspace,"
+                              "provided_workspace,score,failed_predicate,solution_name\n";
+            for(auto const& candidate : candidates)
+                hipblaslt_cout << candidate.solutionIndex << ',' << candidate.accepted << ','
+                               << candidate.rank << ',' << candidate.requiredWorkspace << ','
+                               << candidate.providedWorkspace << ',' << candidate.score << ",\""
+                               << candidate.failedPredicate << "\"," << candidate.solutionName
+                               << std::endl;
+        }
+
         if(!do_grouped_gemm)
         {
             if(arg.use_ext)
@@ -2527,9 +3362,296 @@ void testing_matmul_with_bias(const Arguments& arg,
         exit(EXIT_FAILURE);
     }
 
-    // get CPU result
-    if(arg.unit_check || arg.norm_check || arg.allclose_check)
-    {
+    // The reference problem on the device operands, or on their host copies with D from the
+    // library for the sampled and checksum validations. The bounded check passes the D of the
+    // library on the device.
+    auto reference_problem = [&](int gemmIdx, bool host, void* D = nullptr) {
+        auto buf = [host, gemmIdx](auto& hX, auto& dX) -> void* {
+            return host ? hX[gemmIdx].buf() : dX[gemmIdx].buf();
+        };
+
+        // A or B is rounded to the compute input type when it is narrower, as in cblas_gemm
+        auto narrowed = [](hipDataType Ti, hipDataType Tci) {
+            hipDataType TciCast = Tci == HIP_R_32I ? HIP_R_64F : Tci;
+            return realDataTypeSize(Ti) > realDataTypeSize(TciCast) ? Tci
+                                                                    : HIPBLASLT_DATATYPE_INVALID;
+        };
+        bool hasScaleA = arg.scaleA == hipblaslt_scaling_format::Scalar
+                         || arg.scaleA == hipblaslt_scaling_format::Vector;
+        bool hasScaleB = arg.scaleB == hipblaslt_scaling_format::Scalar
+                         || arg.scaleB == hipblaslt_scaling_format::Vector;
+
+        reference_gemm problem = {};
+        problem.transA         = transA;
+        problem.transB         = transB;
+        problem.m              = M[gemmIdx];
+        problem.n              = N[gemmIdx];
+        problem.k              = K[gemmIdx];
+        problem.batch_count    = num_batches[gemmIdx];
+        problem.A              = buf(hA, dA);
+        problem.lda            = lda[gemmIdx];
+        problem.stride_a       = stride_a[gemmIdx];
+        problem.TiA            = TiA;
+        problem.TciA           = narrowed(TiA, TciA);
+        problem.B              = buf(hB, dB);
+        problem.ldb            = ldb[gemmIdx];
+        problem.stride_b       = stride_b[gemmIdx];
+        problem.TiB            = TiB;
+        problem.TciB           = narrowed(TiB, TciB);
+        problem.C              = buf(hC, dC);
+        problem.ldc            = ldc[gemmIdx];
+        problem.stride_c       = stride_c[gemmIdx];
+        problem.D              = D ? D : buf(hD_1, dD_ref);
+        problem.ldd            = ldd[gemmIdx];
+        problem.stride_d       = stride_d[gemmIdx];
+        problem.To             = To;
+        problem.Tc             = Talpha;
+        problem.alpha          = get_computeInterface(h_alpha[gemmIdx], Talpha);
+        problem.beta           = get_computeInterface(h_beta[gemmIdx], Talpha);
+        problem.tf32 = TiA == HIP_R_32F && TiB == HIP_R_32F && To == HIP_R_32F
+                       && Talpha == HIP_R_32F
+                       && arg.compute_type == HIPBLAS_COMPUTE_32F_FAST_TF32;
+        problem.scaleAlphaVec
+            = arg.scaleAlpha_vector ? buf(hScaleAlphaVec, dScaleAlphaVec) : nullptr;
+        problem.scaleA      = hasScaleA ? buf(hScaleA, dScaleA) : nullptr;
+        problem.isScaleAVec = arg.scaleA == hipblaslt_scaling_format::Vector;
+        problem.scaleB      = hasScaleB ? buf(hScaleB, dScaleB) : nullptr;
+        problem.isScaleBVec = arg.scaleB == hipblaslt_scaling_format::Vector;
+        problem.scaleC      = arg.scaleC ? buf(hScaleC, dScaleC) : nullptr;
+        problem.scaleD      = arg.scaleD ? buf(hScaleD, dScaleD) : nullptr;
+        problem.bias        = arg.bias_vector ? buf(hBias, dBias) : nullptr;
+        problem.Tbias       = Tbias;
+        problem.activation  = arg.activation_type;
+        return problem;
+    };
+
+    // Sampled or checksum validation of the D copied back to hD_1
+    auto check_validation = [&](const std::vector<double>& tol,
+                                double&                    hipblaslt_error,
+                                double&                    hipblaslt_atol,
+                                double&                    hipblaslt_rtol) {
+        for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
+        {
+            reference_gemm  problem = reference_problem(gemmIdx, true);
+            reference_error error
+                = validation == 1
+                      ? hipblaslt_sampled_check(problem, arg.validation_samples, tol[gemmIdx])
+                      : hipblaslt_checksum_check(problem, tol[gemmIdx]);
+            check_reference_error(arg,
+                                  error,
+                                  validation == 1 ? "sampled reference" : "checksum reference",
+                                  hipblaslt_error,
+                                  hipblaslt_atol,
+                                  hipblaslt_rtol,
+                                  To);
+        }
+    };
+
+    // Bounded validation of the D of the library on the device
+    auto check_bounded = [&](std::vector<HipDeviceBuffer>& dD,
+                             double&                       hipblaslt_error,
+                             double&                       hipblaslt_atol,
+                             double&                       hipblaslt_rtol) {
+        for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
+        {
+            reference_gemm  problem = reference_problem(gemmIdx, false, dD[gemmIdx].buf());
+            reference_error error   = hipblaslt_bounded_check(problem, stream);
+            check_reference_error(arg,
+                                  error,
+                                  "bounded reference",
+                                  hipblaslt_error,
+                                  hipblaslt_atol,
+                                  hipblaslt_rtol,
+                                  To);
+        }
+    };
+
+    // Another run of the solution of the check, for the passes that carry state between runs
+    auto run_again = [&](int gemmIdx, const hipblasLtMatmulAlgo_t& algo) {
+        EXPECT_HIPBLAS_STATUS(hipblasLtMatmul(handle,
+                                              matmul[0][gemmIdx],
+                                              alpha_in[gemmIdx],
+                                              dA[gemmIdx].buf(),
+                                              matA[gemmIdx],
+                                              dB[gemmIdx].buf(),
+                                              matB[gemmIdx],
+                                              beta_in[gemmIdx],
+                                              dC[gemmIdx].buf(),
+                                              matC[gemmIdx],
+                                              (*dDp)[gemmIdx].buf(),
+                                              matD[gemmIdx],
+                                              &algo,
+                                              *dWorkspace,
+                                              workspace_size,
+                                              stream),
+                              HIPBLAS_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    };
+
+    // The outputs of the passes around the GEMM, from the D of the library in hD_1
+    auto check_passes = [&](double& hipblaslt_error, const hipblasLtMatmulAlgo_t& algo) {
+        for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
+        {
+            if(arg.amax_history)
+            {
+                // Steps from a history whose largest slot is overwritten by the last of them
+                const int32_t      length = arg.amax_history;
+                std::vector<float> history(length, 0.f), nextHistory(length);
+                int32_t            index = 1 % length, nextIndex = 0;
+                float              scale = 1.f, nextScale = 0.f, amax = 0.f;
+                history[0]               = std::ldexp(1.f, 20);
+                CHECK_HIP_ERROR(hipMemcpy(dHistory[gemmIdx].buf(),
+                                          history.data(),
+                                          length * sizeof(float),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dHistoryIndex[gemmIdx].buf(), &index, sizeof(int32_t), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dHistoryScale[gemmIdx].buf(), &scale, sizeof(float), hipMemcpyHostToDevice));
+                for(int32_t step = 0; step < length; step++)
+                {
+                    run_again(gemmIdx, algo);
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        &amax, dAmaxD[gemmIdx].buf(), sizeof(float), hipMemcpyDeviceToHost));
+                    CHECK_HIP_ERROR(hipMemcpy(nextHistory.data(),
+                                              dHistory[gemmIdx].buf(),
+                                              length * sizeof(float),
+                                              hipMemcpyDeviceToHost));
+                    CHECK_HIP_ERROR(hipMemcpy(&nextIndex,
+                                              dHistoryIndex[gemmIdx].buf(),
+                                              sizeof(int32_t),
+                                              hipMemcpyDeviceToHost));
+                    CHECK_HIP_ERROR(hipMemcpy(&nextScale,
+                                              dHistoryScale[gemmIdx].buf(),
+                                              sizeof(float),
+                                              hipMemcpyDeviceToHost));
+
+                    int32_t slot  = index % length;
+                    history[slot] = amax;
+                    float maxAmax = *std::max_element(history.begin(), history.end());
+                    if(maxAmax > 0.f && std::isfinite(maxAmax))
+                        scale = std::ldexp(fp8_max_finite(To), -amaxHistoryMargin) / maxAmax;
+                    index = (slot + 1) % length;
+#ifdef GOOGLE_TEST
+                    EXPECT_EQ(nextHistory, history);
+                    EXPECT_EQ(nextIndex, index);
+                    EXPECT_FLOAT_EQ(nextScale, scale);
+#endif
+                }
+            }
+            if(arg.dropout > 0)
+            {
+                CHECK_HIP_ERROR(synchronize(hMask[gemmIdx], dMask[gemmIdx]));
+#ifdef GOOGLE_TEST
+                EXPECT_EQ(memcmp(hMask[gemmIdx].buf(),
+                                 hMask_gold[gemmIdx].buf(),
+                                 hMask[gemmIdx].getNumBytes()),
+                          0);
+#endif
+            }
+            if(arg.bgrad_deterministic)
+            {
+                // A second run gives the same D and bias gradient bit for bit
+                HipHostBuffer hD_again(To, size_D_copy[gemmIdx]);
+                HipHostBuffer hBias_again(Tbias, size_bias[gemmIdx]);
+                run_again(gemmIdx, algo);
+                CHECK_HIP_ERROR(synchronize(hD_again, (*dDp)[gemmIdx]));
+                CHECK_HIP_ERROR(synchronize(hBias_again, dBias[gemmIdx]));
+#ifdef GOOGLE_TEST
+                EXPECT_EQ(memcmp(hD_again.buf(), hD_1[gemmIdx].buf(), hD_again.getNumBytes()), 0);
+                EXPECT_EQ(
+                    memcmp(hBias_again.buf(), hBias[gemmIdx].buf(), hBias_again.getNumBytes()),
+                    0);
+#endif
+            }
+            if(arg.d2_type != HIPBLASLT_DATATYPE_INVALID)
+            {
+                CHECK_HIP_ERROR(synchronize(hD2[gemmIdx], dD2[gemmIdx]));
+                for(int b = 0; b < num_batches[gemmIdx]; b++)
+                    for(int64_t j = 0; j < N[gemmIdx]; j++)
+                        for(int64_t i = 0; i < M[gemmIdx]; i++)
+                        {
+                            size_t pos = b * stride_d[gemmIdx] + j * ldd[gemmIdx] + i;
+                            float  d   = cast_from_type<float>(hD_1[gemmIdx].buf(), To, pos);
+                            pass_cast_to_type(
+                                hD2_gold[gemmIdx].buf(), d * scaleD2, arg.d2_type, pos);
+                        }
+                check_pass_output(arg,
+                                  M[gemmIdx],
+                                  N[gemmIdx],
+                                  ldd[gemmIdx],
+                                  stride_d[gemmIdx],
+                                  num_batches[gemmIdx],
+                                  hD2_gold[gemmIdx],
+                                  hD2[gemmIdx],
+                                  hipblaslt_error,
+                                  arg.d2_type);
+            }
+            if(gated)
+            {
+                // The 2m x n GEMM result takes workspace, without it there is no solution and
+                // hipblasLtMatmul fails
+                hipblaslt_local_preference       noWorkspacePref;
+                uint64_t                         noWorkspace = 0;
+                hipblasLtMatmulHeuristicResult_t result;
+                int                              returned = 0;
+                CHECK_HIPBLASLT_ERROR(
+                    hipblasLtMatmulPreferenceSetAttribute(noWorkspacePref,
+                                                          HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                          &noWorkspace,
+                                                          sizeof(uint64_t)));
+                CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(handle,
+                                                                      matmul[0][gemmIdx],
+                                                                      matA[gemmIdx],
+                                                                      matB[gemmIdx],
+                                                                      matC[gemmIdx],
+                                                                      matD[gemmIdx],
+                                                                      noWorkspacePref,
+                                                                      1,
+                                                                      &result,
+                                                                      &returned));
+#ifdef GOOGLE_TEST
+                EXPECT_EQ(returned, 0);
+#endif
+                EXPECT_HIPBLAS_STATUS(hipblasLtMatmul(handle,
+                                                      matmul[0][gemmIdx],
+                                                      alpha_in[gemmIdx],
+                                                      dA[gemmIdx].buf(),
+                                                      matA[gemmIdx],
+                                                      dB[gemmIdx].buf(),
+                                                      matB[gemmIdx],
+                                                      beta_in[gemmIdx],
+                                                      dC[gemmIdx].buf(),
+                                                      matC[gemmIdx],
+                                                      (*dDp)[gemmIdx].buf(),
+                                                      matD[gemmIdx],
+                                                      &algo,
+                                                      nullptr,
+                                                      0,
+                                                      stream),
+                                      HIPBLAS_STATUS_INVALID_VALUE);
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            }
+            if(arg.aux_amax)
+            {
+                CHECK_HIP_ERROR(synchronize(hEAmax[gemmIdx], dEAmax[gemmIdx]));
+                check_pass_output(arg,
+                                  1,
+                                  1,
+                                  1,
+                                  1,
+                                  1,
+                                  hEAmax_gold[gemmIdx],
+                                  hEAmax[gemmIdx],
+                                  hipblaslt_error,
+                                  HIP_R_32F);
+            }
+        }
+    };
+
+    // get CPU result. Without timing it runs on its own thread while the first solution runs
+    // and its D is copied back, and is waited for before the first check.
+    auto cpu_reference = [&]() {
         if(arg.timing)
         {
             cpu_time_used = get_time_us_no_sync();
@@ -2577,6 +3699,65 @@ void testing_matmul_with_bias(const Arguments& arg,
                                     : (void*)(&scale);
             void* scaleDValue = arg.scaleD ? hScaleD[gemmIdx].buf() : (void*)(&scale);
             void* scaleEValue = arg.scaleE ? hScaleE[gemmIdx].buf() : (void*)(&scale);
+            // The AUX pass scales E after the GEMM rounds it to the type of D
+            if(aux_on)
+                scaleEValue = (void*)(&scale);
+            // A residual before the activation leaves the activation to the residual pass
+            hipblaslt_activation_type activation = arg.residual_position == 2
+                                                       ? hipblaslt_activation_type::none
+                                                       : arg.activation_type;
+
+            // Block scaled and quantized operands go to the reference dequantized into unscaled
+            // f32 copies, with op(A) m x kBlocks and op(B) kBlocks x n column major block scales
+            // and groups x n column major B group scales per batch
+            int64_t            kBlocks = (K[gemmIdx] + 31) / 32;
+            int64_t            groups  = quantB ? (K[gemmIdx] - 1) / arg.b_quant_group + 1 : 0;
+            bool               deqB    = blockB || quantB;
+            std::vector<float> hA_block(blockA ? size_A[gemmIdx] : 0);
+            std::vector<float> hB_block(deqB ? size_B[gemmIdx] : 0);
+            for(int64_t b = 0; blockA && b < num_batches[gemmIdx]; b++)
+                for(int64_t l = 0; l < K[gemmIdx]; l++)
+                    for(int64_t i = 0; i < M[gemmIdx]; i++)
+                    {
+                        size_t  pos = b * stride_a[gemmIdx]
+                                     + (transA == HIPBLAS_OP_N ? i + l * lda[gemmIdx]
+                                                               : l + i * lda[gemmIdx]);
+                        size_t  s   = (b * kBlocks + l / 32) * M[gemmIdx] + i;
+                        uint8_t e   = hScaleA[gemmIdx].as<uint8_t>()[s];
+                        hA_block[pos] = std::ldexp(
+                            cast_from_type<float>(hA[gemmIdx].buf(), TiA, pos), int(e) - 127);
+                    }
+            for(int64_t b = 0; blockB && b < num_batches[gemmIdx]; b++)
+                for(int64_t j = 0; j < N[gemmIdx]; j++)
+                    for(int64_t l = 0; l < K[gemmIdx]; l++)
+                    {
+                        size_t  pos = b * stride_b[gemmIdx]
+                                     + (transB == HIPBLAS_OP_N ? l + j * ldb[gemmIdx]
+                                                               : j + l * ldb[gemmIdx]);
+                        size_t  s   = (b * N[gemmIdx] + j) * kBlocks + l / 32;
+                        uint8_t e   = hScaleB[gemmIdx].as<uint8_t>()[s];
+                        hB_block[pos] = std::ldexp(
+                            cast_from_type<float>(hB[gemmIdx].buf(), TiB, pos), int(e) - 127);
+                    }
+            for(int64_t b = 0; quantB && b < num_batches[gemmIdx]; b++)
+                for(int64_t j = 0; j < N[gemmIdx]; j++)
+                    for(int64_t l = 0; l < K[gemmIdx]; l++)
+                    {
+                        size_t pos = b * stride_b[gemmIdx]
+                                     + (transB == HIPBLAS_OP_N ? l + j * ldb[gemmIdx]
+                                                               : j + l * ldb[gemmIdx]);
+                        size_t s   = (b * N[gemmIdx] + j) * groups + l / arg.b_quant_group;
+                        float  q   = cast_from_type<float>(hB[gemmIdx].buf(), TiB, pos);
+                        float  z   = cast_from_type<float>(hBQuantZero[gemmIdx].buf(), TiA, s);
+                        float  sc  = cast_from_type<float>(hBQuantScale[gemmIdx].buf(), TiA, s);
+                        hB_block[pos] = (q - z) * sc;
+                    }
+            char* refA   = blockA ? (char*)hA_block.data() : hA[gemmIdx].as<char>();
+            char* refB   = deqB ? (char*)hB_block.data() : hB[gemmIdx].as<char>();
+            auto  TrefA  = blockA ? HIP_R_32F : TiA;
+            auto  TrefB  = deqB ? HIP_R_32F : TiB;
+            auto  TrefcA = blockA ? HIP_R_32F : TciA;
+            auto  TrefcB = deqB ? HIP_R_32F : TciB;
 
             for(int batchIdx = 0; batchIdx < num_batches[gemmIdx]; batchIdx++)
             {
@@ -2588,11 +3769,9 @@ void testing_matmul_with_bias(const Arguments& arg,
                                N[gemmIdx],
                                K[gemmIdx],
                                alpha,
-                               hA[gemmIdx].as<char>()
-                                   + stride_a[gemmIdx] * batchIdx * realDataTypeSize(TiA),
+                               refA + stride_a[gemmIdx] * batchIdx * realDataTypeSize(TrefA),
                                lda[gemmIdx],
-                               hB[gemmIdx].as<char>()
-                                   + stride_b[gemmIdx] * batchIdx * realDataTypeSize(TiB),
+                               refB + stride_b[gemmIdx] * batchIdx * realDataTypeSize(TrefB),
                                ldb[gemmIdx],
                                betaTemp,
                                hD_gold_epl[gemmIdx].as<char>()
@@ -2605,22 +3784,23 @@ void testing_matmul_with_bias(const Arguments& arg,
                                (void*)(&scale),
                                (arg.scaleA == hipblaslt_scaling_format::Vector),
                                (arg.scaleB == hipblaslt_scaling_format::Vector),
-                               TiA,
-                               TiB,
+                               TrefA,
+                               TrefB,
                                Tc,
                                Tc,
-                               TciA,
-                               TciB,
+                               TrefcA,
+                               TrefcB,
                                false);
                     auto                        pos       = stride_d[gemmIdx] * batchIdx;
-                    std::vector<HipHostBuffer>* hEInst    = arg.gradient ? &hE : &hE_gold;
+                    std::vector<HipHostBuffer>* hEInst
+                        = arg.gradient ? &hE : (aux_on ? &hE_pre : &hE_gold);
                     void*                       ePos      = ((*hEInst).size() <= gemmIdx)
                                                                 ? nullptr
                                                                 : ((*hEInst)[gemmIdx].as<char>() + pos * realDataTypeSize(To));
                     auto                        applyBias = arg.gradient ? false : arg.bias_vector;
                     void* hBias_buf = ((hBias).size() <= gemmIdx) ? nullptr : hBias[gemmIdx].buf();
 
-                    switch(arg.activation_type)
+                    switch(activation)
                     {
                     case hipblaslt_activation_type::gelu:
                         if(arg.gradient)
@@ -2746,11 +3926,9 @@ void testing_matmul_with_bias(const Arguments& arg,
                                N[gemmIdx],
                                K[gemmIdx],
                                alpha,
-                               hA[gemmIdx].as<char>()
-                                   + stride_a[gemmIdx] * batchIdx * realDataTypeSize(TiA),
+                               refA + stride_a[gemmIdx] * batchIdx * realDataTypeSize(TrefA),
                                lda[gemmIdx],
-                               hB[gemmIdx].as<char>()
-                                   + stride_b[gemmIdx] * batchIdx * realDataTypeSize(TiB),
+                               refB + stride_b[gemmIdx] * batchIdx * realDataTypeSize(TrefB),
                                ldb[gemmIdx],
                                betaTemp,
                                hD_gold[gemmIdx].as<char>()
@@ -2762,21 +3940,150 @@ void testing_matmul_with_bias(const Arguments& arg,
                                scaleDValue,
                                (arg.scaleA == hipblaslt_scaling_format::Vector),
                                (arg.scaleB == hipblaslt_scaling_format::Vector),
-                               TiA,
-                               TiB,
+                               TrefA,
+                               TrefB,
                                To,
                                Tc,
-                               TciA,
-                               TciB,
+                               TrefcA,
+                               TrefcB,
                                false);
                 }
             }
+
+            // The D scale vector scales the result of the epilogue and converts it once
+            if(arg.scaleD_vector)
+            {
+                const float* scaleDVec = hScaleDVec[gemmIdx].as<float>();
+                for(int b = 0; b < num_batches[gemmIdx]; b++)
+                    for(int64_t j = 0; j < N[gemmIdx]; j++)
+                        for(int64_t i = 0; i < M[gemmIdx]; i++)
+                        {
+                            size_t pos   = b * stride_d[gemmIdx] + j * ldd[gemmIdx] + i;
+                            float  scale = scaleDVec[arg.scaleD_vector == 2 ? j : i];
+                            float  v
+                                = cast_from_type<float>(hD_gold_epl[gemmIdx].buf(), Talpha, pos);
+                            pass_cast_to_type(hD_gold[gemmIdx].buf(), v * scale, To, pos);
+                        }
+            }
+
+            // The AUX pass converts E to its type scaled by scaleE, and takes the amax before
+            if(aux_on)
+            {
+                float scale = arg.scaleE
+                                  ? cast_from_type<float>(hScaleE[gemmIdx].buf(), Talpha, 0)
+                                  : 1.f;
+                float amax  = 0.f;
+                for(int b = 0; b < num_batches[gemmIdx]; b++)
+                    for(int64_t j = 0; j < N[gemmIdx]; j++)
+                        for(int64_t i = 0; i < M[gemmIdx]; i++)
+                        {
+                            size_t pos = b * stride_d[gemmIdx] + j * ldd[gemmIdx] + i;
+                            float  v   = cast_from_type<float>(hE_pre[gemmIdx].buf(), To, pos);
+                            amax       = std::max(amax, std::abs(v));
+                            pass_cast_to_type(hE_gold[gemmIdx].buf(), v * scale, Te, pos);
+                        }
+                if(arg.aux_amax)
+                    *hEAmax_gold[gemmIdx].as<float>() = amax;
+            }
+
+            // The residual pass adds R to the D of the GEMM, and activates the sum before
+            if(arg.residual_position)
+            {
+                for(int b = 0; b < num_batches[gemmIdx]; b++)
+                    for(int64_t j = 0; j < N[gemmIdx]; j++)
+                        for(int64_t i = 0; i < M[gemmIdx]; i++)
+                        {
+                            size_t pos = b * stride_d[gemmIdx] + j * ldd[gemmIdx] + i;
+                            float  v   = cast_from_type<float>(hD_gold[gemmIdx].buf(), To, pos)
+                                      + cast_from_type<float>(hR[gemmIdx].buf(), To, pos);
+                            if(arg.residual_position == 2)
+                            {
+                                if(arg.activation_type == hipblaslt_activation_type::relu)
+                                    v = _relu(v, 0.f, 0.f);
+                                else if(arg.activation_type == hipblaslt_activation_type::gelu)
+                                    v = _gelu(v, 0.f, 0.f);
+                            }
+                            pass_cast_to_type(hD_gold[gemmIdx].buf(), v, To, pos);
+                        }
+            }
+
+            // The dropout keeps element e of D in memory order when the 24 high bits of word
+            // e % 4 of the Philox block e / 4 are a uniform number of at least the probability
+            if(arg.dropout > 0)
+            {
+                uint32_t*   mask  = hMask_gold[gemmIdx].as<uint32_t>();
+                const float scale = 1.f / (1.f - arg.dropout);
+                int64_t     words = maskWords[gemmIdx];
+                for(int b = 0; b < num_batches[gemmIdx]; b++)
+                    for(int64_t j = 0; j < N[gemmIdx]; j++)
+                        for(int64_t i = 0; i < M[gemmIdx]; i++)
+                        {
+                            size_t   pos = b * stride_d[gemmIdx] + j * ldd[gemmIdx] + i;
+                            uint64_t e   = uint64_t((b * N[gemmIdx] + j) * M[gemmIdx] + i);
+                            uint32_t x[4];
+                            philox4x32_host(x, e / 4, dropoutOffset, dropoutSeed);
+                            bool  keep = float(x[e % 4] >> 8) * (1.f / 16777216.f) >= arg.dropout;
+                            float v    = cast_from_type<float>(hD_gold[gemmIdx].buf(), To, pos);
+                            pass_cast_to_type(
+                                hD_gold[gemmIdx].buf(), keep ? v * scale : 0.f, To, pos);
+
+                            uint32_t& word = mask[(b * N[gemmIdx] + j) * words + i / 32];
+                            if(i % 32 == 0)
+                                word = 0;
+                            word |= uint32_t(keep) << (i % 32);
+                        }
+            }
+
+            // The gated epilogues take rows 2i and 2i + 1 of the GEMM result with the bias, in
+            // hBias_gold_epl, as the gate and up of row i of D
+            if(gated)
+            {
+                for(int b = 0; b < num_batches[gemmIdx]; b++)
+                    for(int64_t j = 0; j < N[gemmIdx]; j++)
+                        for(int64_t i = 0; i < rowsD[gemmIdx]; i++)
+                        {
+                            size_t pos  = b * stride_d[gemmIdx] + j * ldd[gemmIdx] + i;
+                            void*  gemm = hBias_gold_epl[gemmIdx].buf();
+                            float  gate = cast_from_type<float>(gemm, Talpha, pos + i);
+                            float  up   = cast_from_type<float>(gemm, Talpha, pos + i + 1);
+                            float  act  = arg.activation_type == hipblaslt_activation_type::geglu
+                                              ? _gelu(gate, 0.f, 0.f)
+                                              : gate / (1.f + std::exp(-gate));
+                            pass_cast_to_type(hD_gold[gemmIdx].buf(), act * up, To, pos);
+                        }
+            }
         }
 
         if(arg.timing)
         {
             cpu_time_used = get_time_us_no_sync() - cpu_time_used;
         }
+    };
+
+    std::future<void> cpu_reference_done;
+    if(host_reference && !validation && arg.timing)
+    {
+        cpu_reference();
+    }
+    else if(host_reference && !validation)
+    {
+        cpu_reference_done = std::async(std::launch::async, cpu_reference);
+    }
+    else if(gpu_reference && !bounded)
+    {
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us_sync(stream);
+        }
+
+        for(int gemmIdx = 0; gemmIdx < gemm_count; gemmIdx++)
+            hipblaslt_gpu_reference(reference_problem(gemmIdx, false), stream);
+
+        // Reported in the cpu_time_used column, which is the reference time
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us_sync(stream) - cpu_time_used;
+        }
     }
 
     if(!arg.timing)
@@ -2810,7 +4117,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                                                           matA[0],
                                                           dB[0].buf(),
                                                           matB[0],
-                                                          &(h_beta[0]),
+                                                          beta_in[0],
                                                           dC[0].buf(),
                                                           matC[0],
                                                           (*dDp)[0].buf(),
@@ -2839,6 +4146,53 @@ void testing_matmul_with_bias(const Arguments& arg,
                                               hipMemcpyHostToDevice));
 
                     CHECK_HIPBLASLT_ERROR(groupedGemmVec[0].run(d_userArgs, stream));
+
+                    // Back to back uploads through the instance ring must give the same D
+                    if(!arg.c_equal_d)
+                    {
+                        CHECK_HIPBLASLT_ERROR(
+                            groupedGemmVec[0].runWithHostUserArgs(userArgs, stream));
+                        CHECK_HIPBLASLT_ERROR(
+                            groupedGemmVec[0].runWithHostUserArgs(userArgs, stream));
+
+                        // Sizes patched on the device must give the same D as well
+                        int64_t* d_m = nullptr;
+                        int64_t* d_k = nullptr;
+                        CHECK_HIP_ERROR(hipMalloc(&d_m, gemm_count * sizeof(int64_t)));
+                        CHECK_HIP_ERROR(hipMalloc(&d_k, gemm_count * sizeof(int64_t)));
+                        CHECK_HIP_ERROR(hipMemcpy(
+                            d_m, M.data(), gemm_count * sizeof(int64_t), hipMemcpyHostToDevice));
+                        CHECK_HIP_ERROR(hipMemcpy(
+                            d_k, K.data(), gemm_count * sizeof(int64_t), hipMemcpyHostToDevice));
+                        hipblaslt_ext::DeviceGroupSizes sizes;
+                        sizes.m = d_m;
+                        CHECK_HIPBLASLT_ERROR(groupedGemmVec[0].run(d_userArgs, sizes, stream));
+                        sizes.m = nullptr;
+                        sizes.k = d_k;
+                        CHECK_HIPBLASLT_ERROR(groupedGemmVec[0].run(d_userArgs, sizes, stream));
+                        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                        CHECK_HIP_ERROR(hipFree(d_m));
+                        CHECK_HIP_ERROR(hipFree(d_k));
+
+                        // So must the compact encoding, when the groups share the header
+                        hipblaslt_ext::UserArguments                      sharedArgs;
+                        std::vector<hipblaslt_ext::CompactGroupArguments> groupArgs(gemm_count);
+                        if(groupedGemmVec[0].getDefaultValueForCompactUserArguments(
+                               sharedArgs, groupArgs.data())
+                           == HIPBLAS_STATUS_SUCCESS)
+                        {
+                            hipblaslt_ext::CompactGroupArguments* d_groupArgs = nullptr;
+                            size_t                                groupBytes
+                                = gemm_count * sizeof(hipblaslt_ext::CompactGroupArguments);
+                            CHECK_HIP_ERROR(hipMalloc(&d_groupArgs, groupBytes));
+                            CHECK_HIP_ERROR(hipMemcpy(
+                                d_groupArgs, groupArgs.data(), groupBytes, hipMemcpyHostToDevice));
+                            CHECK_HIPBLASLT_ERROR(
+                                groupedGemmVec[0].run(d_userArgs, sharedArgs, d_groupArgs, stream));
+                            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                            CHECK_HIP_ERROR(hipFree(d_groupArgs));
+                        }
+                    }
                 }
                 else
                 {
@@ -2866,13 +4220,46 @@ void testing_matmul_with_bias(const Arguments& arg,
                     tol[gemmIdx] = K[gemmIdx] * sum_error_tolerance_for_gfx11_type(Tc, TiA, To);
                 }
             }
-            if(arg.unit_check || arg.norm_check || arg.allclose_check)
+            // D comes back while the CPU reference finishes
+            if(host_reference)
+                copy_gemm_to_host_async(stream, gemm_count, hD_1, (*dDp));
+            if(cpu_reference_done.valid())
+                cpu_reference_done.get();
+            if(host_reference)
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            if(bounded)
+            {
+                check_bounded((*dDp), hipblaslt_error, hipblaslt_atol, hipblaslt_rtol);
+            }
+            else if(gpu_reference)
+            {
+                check_gpu_reference(stream,
+                                    arg,
+                                    gemm_count,
+                                    M,
+                                    N,
+                                    ldd,
+                                    stride_d,
+                                    num_batches,
+                                    dD_ref,
+                                    (*dDp),
+                                    tol,
+                                    hipblaslt_error,
+                                    hipblaslt_atol,
+                                    hipblaslt_rtol,
+                                    To);
+            }
+            else if(host_reference && validation)
+            {
+                check_validation(tol, hipblaslt_error, hipblaslt_atol, hipblaslt_rtol);
+            }
+            else if(host_reference)
             {
-                copy_gemm_to_host(stream, gemm_count, hD_1, (*dDp));
                 check(stream,
                       arg,
                       gemm_count,
-                      M,
+                      rowsD,
                       N,
                       ldd,
                       lde,
@@ -2898,7 +4285,10 @@ void testing_matmul_with_bias(const Arguments& arg,
                       hipblaslt_rtol,
                       To,
                       Tbias,
-                      Talpha);
+                      Talpha,
+                      Te);
+                if(pass_on)
+                    check_passes(hipblaslt_error, heuristicResult[sol].algo);
             }
         }
     }
@@ -2922,7 +4312,6 @@ void testing_matmul_with_bias(const Arguments& arg,
             = ((arg.unit_check || arg.norm_check || arg.allclose_check) && arg.cold_iters == 0)
                   ? 1
                   : arg.cold_iters;
-        int number_hot_calls = arg.iters;
 
         int    flush_iter      = 100000;
         double flush_time_used = 0;
@@ -2955,6 +4344,7 @@ void testing_matmul_with_bias(const Arguments& arg,
             flush_time_used /= flush_iter;
         }
 
+        HotCallTiming hot_timing(arg, stream);
         for(size_t sol = 0; sol < heuristicResult.size(); sol++)
         {
             if((arg.unit_check || arg.norm_check || arg.allclose_check) && arg.c_equal_d)
@@ -2980,7 +4370,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                     for(int i = 0; i < number_cold_calls; i++)
                     {
                         CHECK_HIPBLASLT_ERROR(gemmVec[i % block_count].run(stream));
-                        if(i == 0 && (arg.unit_check || arg.norm_check || arg.allclose_check))
+                        if(i == 0 && host_reference)
                             copy_gemm_to_host(stream, gemm_count, hD_1, (*dDp));
                     }
                     if(arg.skip_slow_solution_ratio)
@@ -3006,11 +4396,13 @@ void testing_matmul_with_bias(const Arguments& arg,
                     freq_monitor.start();
                     pre_gpu_time(arg.use_gpu_timer, event_gpu_time_start, gpu_time_used, stream);
 
-                    for(int i = 0; i < number_hot_calls; i++)
+                    for(int i = 0; hot_timing.more(i); i++)
                     {
+                        hot_timing.start(i);
                         CHECK_HIPBLASLT_ERROR(gemmVec[i % block_count].run(stream));
                         if(arg.flush)
                             hipLaunchKernelGGL(flush_icache, dim3(gpu_block3), dim3(64), 0, stream);
+                        hot_timing.stop(i);
                     }
                 }
                 else
@@ -3036,7 +4428,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                                 dB[0].as<char>()
                                     + (i % block_count) * size_B[0] * realDataTypeSize(TiB),
                                 matB[0],
-                                &(h_beta[0]),
+                                beta_in[0],
                                 dC[0].as<char>()
                                     + (i % block_count) * size_C[0] * realDataTypeSize(To),
                                 matC[0],
@@ -3048,7 +4440,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                                 workspace_size,
                                 stream),
                             HIPBLAS_STATUS_SUCCESS);
-                        if(i == 0 && (arg.unit_check || arg.norm_check || arg.allclose_check))
+                        if(i == 0 && host_reference)
                             copy_gemm_to_host(stream, gemm_count, hD_1, (*dDp));
                     }
                     if(arg.skip_slow_solution_ratio)
@@ -3073,8 +4465,9 @@ void testing_matmul_with_bias(const Arguments& arg,
                     }
                     freq_monitor.start();
                     pre_gpu_time(arg.use_gpu_timer, event_gpu_time_start, gpu_time_used, stream);
-                    for(int i = 0; i < number_hot_calls; i++)
+                    for(int i = 0; hot_timing.more(i); i++)
                     {
+                        hot_timing.start(i);
                         auto ptr_matmul = matmul[i % block_count][0];
                         auto ptr_alpha  = arg.scaleAlpha_vector
                                               ? (dScaleAlphaVec[0].as<char>())
@@ -3091,7 +4484,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                                 dB[0].as<char>()
                                     + (i % block_count) * size_B[0] * realDataTypeSize(TiB),
                                 matB[0],
-                                &(h_beta[0]),
+                                beta_in[0],
                                 dC[0].as<char>()
                                     + (i % block_count) * size_C[0] * realDataTypeSize(To),
                                 matC[0],
@@ -3105,6 +4498,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                             HIPBLAS_STATUS_SUCCESS);
                         if(arg.flush)
                             hipLaunchKernelGGL(flush_icache, dim3(gpu_block3), dim3(64), 0, stream);
+                        hot_timing.stop(i);
                     }
                 }
                 post_gpu_time(arg.use_gpu_timer,
@@ -3112,6 +4506,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                               event_gpu_time_end,
                               gpu_time_used,
                               stream);
+                hot_timing.finish(gpu_time_used);
                 freq_monitor.stop();
             }
             else
@@ -3143,7 +4538,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                     {
                         CHECK_HIPBLASLT_ERROR(groupedGemmVec[i % block_count].run(
                             d_userArgsVec[i % block_count], stream));
-                        if(i == 0 && (arg.unit_check || arg.norm_check || arg.allclose_check))
+                        if(i == 0 && host_reference)
                             copy_gemm_to_host(stream, gemm_count, hD_1, (*dDp));
                     }
                     if(arg.skip_slow_solution_ratio)
@@ -3169,15 +4564,20 @@ void testing_matmul_with_bias(const Arguments& arg,
                     freq_monitor.start();
                     pre_gpu_time(arg.use_gpu_timer, event_gpu_time_start, gpu_time_used, stream);
 
-                    for(int i = 0; i < number_hot_calls; i++)
+                    for(int i = 0; hot_timing.more(i); i++)
+                    {
+                        hot_timing.start(i);
                         CHECK_HIPBLASLT_ERROR(groupedGemmVec[i % block_count].run(
                             d_userArgsVec[i % block_count], stream));
+                        hot_timing.stop(i);
+                    }
 
                     post_gpu_time(arg.use_gpu_timer,
                                   event_gpu_time_start,
                                   event_gpu_time_end,
                                   gpu_time_used,
                                   stream);
+                    hot_timing.finish(gpu_time_used);
                     freq_monitor.stop();
                 }
                 else
@@ -3197,7 +4597,7 @@ void testing_matmul_with_bias(const Arguments& arg,
                     for(int i = 0; i < number_cold_calls; i++)
                     {
                         CHECK_HIPBLASLT_ERROR(groupedGemmVec[i % block_count].run(stream));
-                        if(i == 0 && (arg.unit_check || arg.norm_check || arg.allclose_check))
+                        if(i == 0 && host_reference)
                             copy_gemm_to_host(stream, gemm_count, hD_1, (*dDp));
                     }
                     if(arg.skip_slow_solution_ratio)
@@ -3223,14 +4623,19 @@ void testing_matmul_with_bias(const Arguments& arg,
                     freq_monitor.start();
                     pre_gpu_time(arg.use_gpu_timer, event_gpu_time_start, gpu_time_used, stream);
 
-                    for(int i = 0; i < number_hot_calls; i++)
+                    for(int i = 0; hot_timing.more(i); i++)
+                    {
+                        hot_timing.start(i);
                         CHECK_HIPBLASLT_ERROR(groupedGemmVec[i % block_count].run(stream));
+                        hot_timing.stop(i);
+                    }
 
                     post_gpu_time(arg.use_gpu_timer,
                                   event_gpu_time_start,
                                   event_gpu_time_end,
                                   gpu_time_used,
                                   stream);
+                    hot_timing.finish(gpu_time_used);
                     freq_monitor.stop();
                 }
             }
@@ -3265,12 +4670,38 @@ void testing_matmul_with_bias(const Arguments& arg,
                     tol[gemmIdx] = K[gemmIdx] * sum_error_tolerance_for_gfx11_type(Tc, TiA, To);
                 }
             }
-            if(arg.unit_check || arg.norm_check || arg.allclose_check)
+            if(bounded)
+            {
+                check_bounded((*dDp), hipblaslt_error, hipblaslt_atol, hipblaslt_rtol);
+            }
+            else if(gpu_reference)
+            {
+                check_gpu_reference(stream,
+                                    arg,
+                                    gemm_count,
+                                    M,
+                                    N,
+                                    ldd,
+                                    stride_d,
+                                    num_batches,
+                                    dD_ref,
+                                    (*dDp),
+                                    tol,
+                                    hipblaslt_error,
+                                    hipblaslt_atol,
+                                    hipblaslt_rtol,
+                                    To);
+            }
+            else if(host_reference && validation)
+            {
+                check_validation(tol, hipblaslt_error, hipblaslt_atol, hipblaslt_rtol);
+            }
+            else if(host_reference)
             {
                 check(stream,
                       arg,
                       gemm_count,
-                      M,
+                      rowsD,
                       N,
                       ldd,
                       lde,
@@ -3296,7 +4727,8 @@ void testing_matmul_with_bias(const Arguments& arg,
                       hipblaslt_rtol,
                       To,
                       Tbias,
-                      Talpha);
+                      Talpha,
+                      Te);
             }
 
 #define argument_param                                                                            \
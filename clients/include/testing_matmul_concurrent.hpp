@@ -0,0 +1,356 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include "flops.hpp"
+#include "hipBuffer.hpp"
+#include "hipblaslt_init.hpp"
+#include "hipblaslt_test.hpp"
+#include "hipblaslt_vector.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <hipblaslt/hipblaslt.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* ============================================================================================ */
+/*! \brief  Runs GEMMs from several host threads on several streams at once, the way a serving
+            process does. Thread t runs problem t % problems on stream t % streams with a handle
+            of its own. After the cold iterations all threads start together, then every thread
+            queues arg.iters calls without waiting on the device. */
+
+namespace concurrent_matmul
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Worker
+    {
+        const Arguments*    arg;
+        int32_t             problem;
+        int32_t             stream;
+        double              gflops = 0.0;
+        std::vector<double> hostUs;
+        std::vector<double> deviceUs;
+        Clock::time_point   end;
+    };
+
+    // Releases all threads at once when the last one arrives
+    struct StartLine
+    {
+        std::mutex              mutex;
+        std::condition_variable released;
+        int32_t                 waiting;
+        Clock::time_point       start;
+
+        void arrive()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if(--waiting == 0)
+            {
+                start = Clock::now();
+                released.notify_all();
+            }
+            else
+                released.wait(lock, [this] { return waiting == 0; });
+        }
+    };
+
+    // Upper value of the given fraction of the sorted values
+    inline double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        if(sorted.empty())
+            return 0.0;
+        size_t rank = std::min(sorted.size() - 1, static_cast<size_t>(fraction * sorted.size()));
+        return sorted[rank];
+    }
+
+    inline bool supported(const Arguments& arg)
+    {
+        return arg.grouped_gemm == 0 && !arg.bias_vector
+               && arg.activation_type == hipblaslt_activation_type::none
+               && arg.scaleA == hipblaslt_scaling_format::none
+               && arg.scaleB == hipblaslt_scaling_format::none && !arg.scaleC && !arg.scaleD
+               && !arg.scaleE && !arg.scaleAlpha_vector && !arg.amaxD && !arg.use_e
+               && !arg.gradient;
+    }
+
+    inline void run(Worker& worker, hipStream_t stream, StartLine& startLine)
+    {
+        const Arguments&   arg = *worker.arg;
+        hipblasOperation_t transA(char_to_hipblas_operation(arg.transA));
+        hipblasOperation_t transB(char_to_hipblas_operation(arg.transB));
+
+        int64_t M       = arg.M[0];
+        int64_t N       = arg.N[0];
+        int64_t K       = arg.K[0];
+        int64_t A_row   = transA == HIPBLAS_OP_N ? M : K;
+        int64_t A_col   = transA == HIPBLAS_OP_N ? K : M;
+        int64_t B_row   = transB == HIPBLAS_OP_N ? K : N;
+        int64_t B_col   = transB == HIPBLAS_OP_N ? N : K;
+        int     batches = std::max(1, arg.batch_count);
+
+        int64_t stride_a = batches > 1 ? arg.stride_a[0] : arg.lda[0] * A_col;
+        int64_t stride_b = batches > 1 ? arg.stride_b[0] : arg.ldb[0] * B_col;
+        int64_t stride_c = batches > 1 ? arg.stride_c[0] : arg.ldc[0] * N;
+        int64_t stride_d = batches > 1 ? arg.stride_d[0] : arg.ldd[0] * N;
+
+        hipblaslt_local_handle        handle{arg};
+        hipblaslt_local_matrix_layout matA(A_row, A_col, arg.lda[0], arg.a_type);
+        hipblaslt_local_matrix_layout matB(B_row, B_col, arg.ldb[0], arg.b_type);
+        hipblaslt_local_matrix_layout matC(M, N, arg.ldc[0], arg.c_type);
+        hipblaslt_local_matrix_layout matD(M, N, arg.ldd[0], arg.d_type);
+        hipblaslt_local_matmul_descr  matmul(transA,
+                                            transB,
+                                            arg.compute_type,
+                                            arg.scale_type,
+                                            arg.compute_input_typeA,
+                                            arg.compute_input_typeB);
+
+        hipblasLtMatrixLayout_t layouts[] = {matA, matB, matC, matD};
+        int64_t                 strides[] = {stride_a, stride_b, stride_c, stride_d};
+        for(int i = 0; batches > 1 && i < 4; i++)
+        {
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutSetAttribute(
+                layouts[i], HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batches, sizeof(int)));
+            CHECK_HIPBLASLT_ERROR(
+                hipblasLtMatrixLayoutSetAttribute(layouts[i],
+                                                  HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                                                  &strides[i],
+                                                  sizeof(int64_t)));
+        }
+
+        HipDeviceBuffer dA(arg.a_type, stride_a * batches);
+        HipDeviceBuffer dB(arg.b_type, stride_b * batches);
+        HipDeviceBuffer dC(arg.c_type, stride_c * batches);
+        HipDeviceBuffer dD(arg.d_type, stride_d * batches);
+        hipblaslt_init_device(ABC::A,
+                              arg.initialization,
+                              false,
+                              dA.buf(),
+                              A_row,
+                              A_col,
+                              arg.lda[0],
+                              arg.a_type,
+                              stride_a,
+                              batches);
+        hipblaslt_init_device(ABC::B,
+                              arg.initialization,
+                              false,
+                              dB.buf(),
+                              B_row,
+                              B_col,
+                              arg.ldb[0],
+                              arg.b_type,
+                              stride_b,
+                              batches);
+        hipblaslt_init_device(ABC::C,
+                              arg.initialization,
+                              false,
+                              dC.buf(),
+                              M,
+                              N,
+                              arg.ldc[0],
+                              arg.c_type,
+                              stride_c,
+                              batches);
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        computeTypeInterface alpha, beta;
+        set_alpha_type(alpha, arg, arg.scale_type);
+        set_beta_type(beta, arg, arg.scale_type);
+
+        size_t                     max_workspace_size = arg.user_allocated_workspace;
+        hipblaslt_local_preference pref;
+        CHECK_HIPBLASLT_ERROR(
+            hipblasLtMatmulPreferenceSetAttribute(pref,
+                                                  HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                  &max_workspace_size,
+                                                  sizeof(max_workspace_size)));
+        hipblasLtMatmulHeuristicResult_t result;
+        int                              returnedAlgoCount = 0;
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(
+            handle, matmul, matA, matB, matC, matD, pref, 1, &result, &returnedAlgoCount));
+        CHECK_SOLUTION_FOUND(returnedAlgoCount);
+        device_vector<unsigned char> workspace(std::max<size_t>(result.workspaceSize, 1));
+
+        auto launch = [&] {
+            return hipblasLtMatmul(handle,
+                                   matmul,
+                                   &alpha,
+                                   dA.buf(),
+                                   matA,
+                                   dB.buf(),
+                                   matB,
+                                   &beta,
+                                   dC.buf(),
+                                   matC,
+                                   dD.buf(),
+                                   matD,
+                                   &result.algo,
+                                   workspace,
+                                   result.workspaceSize,
+                                   stream);
+        };
+
+        for(int i = 0; i < arg.cold_iters; i++)
+            CHECK_HIPBLASLT_ERROR(launch());
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        std::vector<hipEvent_t> starts(arg.iters), stops(arg.iters);
+        for(int i = 0; i < arg.iters; i++)
+        {
+            CHECK_HIP_ERROR(hipEventCreate(&starts[i]));
+            CHECK_HIP_ERROR(hipEventCreate(&stops[i]));
+        }
+        worker.gflops = gemm_gflop_count<float>(M, N, K) * batches;
+        worker.hostUs.reserve(arg.iters);
+
+        startLine.arrive();
+        for(int i = 0; i < arg.iters; i++)
+        {
+            CHECK_HIP_ERROR(hipEventRecord(starts[i], stream));
+            auto callStart = Clock::now();
+            CHECK_HIPBLASLT_ERROR(launch());
+            worker.hostUs.push_back(
+                std::chrono::duration<double, std::micro>(Clock::now() - callStart).count());
+            CHECK_HIP_ERROR(hipEventRecord(stops[i], stream));
+        }
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        worker.end = Clock::now();
+
+        for(int i = 0; i < arg.iters; i++)
+        {
+            float ms = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, starts[i], stops[i]));
+            worker.deviceUs.push_back(ms * 1000.0);
+            CHECK_HIP_ERROR(hipEventDestroy(starts[i]));
+            CHECK_HIP_ERROR(hipEventDestroy(stops[i]));
+        }
+    }
+} // namespace concurrent_matmul
+
+/*! \brief  Runs the problems concurrently and prints the latency percentiles of every stream,
+            the host time per hipblasLtMatmul call and the aggregate throughput. streams 0 gives
+            every thread a stream of its own. Calls of threads sharing a stream are queued in
+            between, their latency includes the time they wait behind each other. */
+inline void testing_matmul_concurrent(const std::vector<Arguments>& problems,
+                                      int32_t                       threads,
+                                      int32_t                       streams)
+{
+    using namespace concurrent_matmul;
+
+    std::vector<Arguments> args;
+    for(auto const& arg : problems)
+    {
+        if(supported(arg))
+            args.push_back(arg);
+        else
+            hipblaslt_cout << "Concurrent mode runs plain GEMMs, skipped " << arg.M[0] << "x"
+                           << arg.N[0] << "x" << arg.K[0] << " with an epilogue, scaling or "
+                           << "grouped GEMM" << std::endl;
+    }
+    if(args.empty())
+        return;
+    if(streams <= 0 || streams > threads)
+        streams = threads;
+
+    std::vector<hipStream_t> hipStreams(streams);
+    for(auto& stream : hipStreams)
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    std::vector<Worker> workers(threads);
+    StartLine           startLine;
+    startLine.waiting = threads;
+    std::vector<std::thread> pool;
+    for(int32_t t = 0; t < threads; t++)
+    {
+        workers[t].problem = t % args.size();
+        workers[t].stream  = t % streams;
+        workers[t].arg     = &args[workers[t].problem];
+        pool.emplace_back([&, t] { run(workers[t], hipStreams[workers[t].stream], startLine); });
+    }
+    for(auto& thread : pool)
+        thread.join();
+
+    for(auto& stream : hipStreams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    Clock::time_point   end    = startLine.start;
+    double              gflops = 0.0;
+    size_t              calls  = 0;
+    std::vector<double> hostUs;
+    for(auto const& worker : workers)
+    {
+        end = std::max(end, worker.end);
+        gflops += worker.gflops * worker.deviceUs.size();
+        calls += worker.deviceUs.size();
+        hostUs.insert(hostUs.end(), worker.hostUs.begin(), worker.hostUs.end());
+    }
+    double wallUs = std::chrono::duration<double, std::micro>(end - startLine.start).count();
+
+    hipblaslt_cout << "Concurrent matmul: " << threads << " threads, " << streams << " streams, "
+                   << args.size() << " problems, " << args[0].iters << " calls per thread"
+                   << std::endl;
+
+    hipblaslt_cout << "stream,threads,calls,latency-p50-us,latency-p90-us,latency-p99-us,"
+                      "latency-max-us"
+                   << std::endl;
+    for(int32_t s = 0; s < streams; s++)
+    {
+        std::vector<double> deviceUs;
+        int32_t             streamThreads = 0;
+        for(auto const& worker : workers)
+        {
+            if(worker.stream != s)
+                continue;
+            streamThreads++;
+            deviceUs.insert(deviceUs.end(), worker.deviceUs.begin(), worker.deviceUs.end());
+        }
+        std::sort(deviceUs.begin(), deviceUs.end());
+        hipblaslt_cout << s << "," << streamThreads << "," << deviceUs.size() << ","
+                       << percentile(deviceUs, 0.5) << "," << percentile(deviceUs, 0.9) << ","
+                       << percentile(deviceUs, 0.99) << "," << percentile(deviceUs, 1.0)
+                       << std::endl;
+    }
+
+    std::sort(hostUs.begin(), hostUs.end());
+    double hostTotalUs = 0.0;
+    for(double us : hostUs)
+        hostTotalUs += us;
+    hipblaslt_cout << "host-api-mean-us,host-api-p50-us,host-api-p99-us,host-api-max-us"
+                   << std::endl;
+    hipblaslt_cout << (hostUs.empty() ? 0.0 : hostTotalUs / hostUs.size()) << ","
+                   << percentile(hostUs, 0.5) << "," << percentile(hostUs, 0.99) << ","
+                   << percentile(hostUs, 1.0) << std::endl;
+
+    hipblaslt_cout << "calls,wall-us,calls-per-s,aggregate-Gflops" << std::endl;
+    hipblaslt_cout << calls << "," << wallUs << "," << (wallUs > 0 ? calls * 1.0e6 / wallUs : 0)
+                   << "," << (wallUs > 0 ? gflops * 1.0e6 / wallUs : 0) << std::endl;
+}
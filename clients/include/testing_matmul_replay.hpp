@@ -0,0 +1,505 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include "hipblaslt_datatype2string.hpp"
+#include "testing_matmul_concurrent.hpp"
+#include <fstream>
+#include <hipblaslt/hipblaslt-ext.hpp>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+
+/* ============================================================================================ */
+/*! \brief  Replays the calls of a bench log (HIPBLASLT_LOG_MASK=32) in their logged order, on the
+            streams and at the times they were logged, so that the timings include the cache
+            interference between the calls. Every call runs the solution it logged. */
+
+namespace replay_matmul
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Call
+    {
+        int32_t problem;
+        int32_t stream;
+        double  timeUs;
+    };
+
+    // A distinct problem of the log, set up once for all its calls
+    struct Problem
+    {
+        Arguments                        arg;
+        std::string                      key;
+        int32_t                          stream;
+        hipblasLtMatrixLayout_t          layouts[4] = {};
+        hipblasLtMatmulDesc_t            matmul     = nullptr;
+        std::unique_ptr<HipDeviceBuffer> buffers[4];
+        computeTypeInterface             alpha, beta;
+        hipblasLtMatmulAlgo_t            algo;
+        double                           gflops     = 0.0;
+        double                           isolatedUs = 0.0;
+        std::vector<double>              hostUs, deviceUs;
+
+        ~Problem()
+        {
+            for(auto layout : layouts)
+                if(layout)
+                    hipblasLtMatrixLayoutDestroy(layout);
+            if(matmul)
+                hipblasLtMatmulDescDestroy(matmul);
+        }
+    };
+
+    // Reads the options of a hipblaslt-bench line over arg. Returns why the call cannot be
+    // replayed, empty when it can.
+    inline std::string
+        parse(const std::string& line, Arguments& arg, int32_t& stream, double& timeUs)
+    {
+        std::istringstream       text(line);
+        std::vector<std::string> words{std::istream_iterator<std::string>(text), {}};
+        for(size_t i = 1; i < words.size(); i++)
+        {
+            const std::string& option = words[i];
+            if(option == "--grouped_gemm")
+                return "grouped GEMM";
+            if(option == "--scaleC" || option == "--scaleD" || option == "--scaleAlpha_vector")
+                return "scaling";
+            if(option == "--gradient" || option == "--use_e" || option == "--bias_vector")
+                return "epilogue";
+            if(i + 1 >= words.size())
+                return "no value for " + option;
+
+            const std::string& value = words[++i];
+            if(option == "-m")
+                arg.M[0] = std::stoll(value);
+            else if(option == "-n")
+                arg.N[0] = std::stoll(value);
+            else if(option == "-k")
+                arg.K[0] = std::stoll(value);
+            else if(option == "--lda")
+                arg.lda[0] = std::stoll(value);
+            else if(option == "--ldb")
+                arg.ldb[0] = std::stoll(value);
+            else if(option == "--ldc")
+                arg.ldc[0] = std::stoll(value);
+            else if(option == "--ldd")
+                arg.ldd[0] = std::stoll(value);
+            else if(option == "--stride_a")
+                arg.stride_a[0] = std::stoll(value);
+            else if(option == "--stride_b")
+                arg.stride_b[0] = std::stoll(value);
+            else if(option == "--stride_c")
+                arg.stride_c[0] = std::stoll(value);
+            else if(option == "--stride_d")
+                arg.stride_d[0] = std::stoll(value);
+            else if(option == "--alpha")
+                arg.alpha = std::stod(value);
+            else if(option == "--beta")
+                arg.beta = std::stod(value);
+            else if(option == "--transA")
+                arg.transA = value[0];
+            else if(option == "--transB")
+                arg.transB = value[0];
+            else if(option == "--batch_count")
+                arg.batch_count = std::stoi(value);
+            else if(option == "--a_type")
+                arg.a_type = string_to_hip_datatype(value);
+            else if(option == "--b_type")
+                arg.b_type = string_to_hip_datatype(value);
+            else if(option == "--c_type")
+                arg.c_type = string_to_hip_datatype(value);
+            else if(option == "--d_type")
+                arg.d_type = string_to_hip_datatype(value);
+            else if(option == "--scale_type")
+                arg.scale_type = string_to_hip_datatype(value);
+            else if(option == "--compute_type")
+                arg.compute_type = string_to_hipblas_computetype(value);
+            else if(option == "--solution_index")
+                arg.solution_index = std::stoi(value);
+            else if(option == "--stream_id")
+                stream = std::stoi(value);
+            else if(option == "--time_us")
+                timeUs = std::stod(value);
+            else if((option == "--scaleA" || option == "--scaleB") && value != "0")
+                return "scaling";
+            else if(option == "--activation_type" && value != "none")
+                return "epilogue";
+            else if(option == "--splitk" || option == "--wgm")
+                return "tuning override";
+            else if(option != "--api_method" && option != "--algo_method"
+                    && option != "--bias_type" && option != "--bias_source"
+                    && option != "--scaleA" && option != "--scaleB" && option != "--lde"
+                    && option != "--stride_e" && option != "--activation_type")
+                return "unknown option " + option;
+        }
+        if(arg.a_type == HIPBLASLT_DATATYPE_INVALID || arg.b_type == HIPBLASLT_DATATYPE_INVALID
+           || arg.c_type == HIPBLASLT_DATATYPE_INVALID || arg.d_type == HIPBLASLT_DATATYPE_INVALID
+           || arg.compute_type == HIPBLASLT_COMPUTE_TYPE_INVALID)
+            return "data type";
+        return "";
+    }
+
+    // Creates the descriptors and buffers of a problem and the algo of its logged solution
+    inline bool setup(Problem& problem, hipblasLtHandle_t handle, size_t maxWorkspace)
+    {
+        const Arguments&   arg = problem.arg;
+        hipblasOperation_t transA(char_to_hipblas_operation(arg.transA));
+        hipblasOperation_t transB(char_to_hipblas_operation(arg.transB));
+
+        int64_t M       = arg.M[0];
+        int64_t N       = arg.N[0];
+        int64_t K       = arg.K[0];
+        int64_t rows[]  = {transA == HIPBLAS_OP_N ? M : K, transB == HIPBLAS_OP_N ? K : N, M, M};
+        int64_t cols[]  = {transA == HIPBLAS_OP_N ? K : M, transB == HIPBLAS_OP_N ? N : K, N, N};
+        int64_t lds[]   = {arg.lda[0], arg.ldb[0], arg.ldc[0], arg.ldd[0]};
+        int     batches = std::max(1, arg.batch_count);
+
+        hipDataType types[]   = {arg.a_type, arg.b_type, arg.c_type, arg.d_type};
+        int64_t     strides[]
+            = {arg.stride_a[0], arg.stride_b[0], arg.stride_c[0], arg.stride_d[0]};
+        for(int i = 0; i < 4; i++)
+        {
+            if(batches == 1)
+                strides[i] = lds[i] * cols[i];
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(
+                &problem.layouts[i], types[i], rows[i], cols[i], lds[i]));
+            if(batches > 1)
+            {
+                CHECK_HIPBLASLT_ERROR(
+                    hipblasLtMatrixLayoutSetAttribute(problem.layouts[i],
+                                                      HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
+                                                      &batches,
+                                                      sizeof(int)));
+                CHECK_HIPBLASLT_ERROR(
+                    hipblasLtMatrixLayoutSetAttribute(problem.layouts[i],
+                                                      HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                                                      &strides[i],
+                                                      sizeof(int64_t)));
+            }
+            problem.buffers[i] = std::make_unique<HipDeviceBuffer>(types[i], strides[i] * batches);
+            if(i < 3)
+                hipblaslt_init_device(ABC(i),
+                                      arg.initialization,
+                                      false,
+                                      problem.buffers[i]->buf(),
+                                      rows[i],
+                                      cols[i],
+                                      lds[i],
+                                      types[i],
+                                      strides[i],
+                                      batches);
+        }
+
+        CHECK_HIPBLASLT_ERROR(
+            hipblasLtMatmulDescCreate(&problem.matmul, arg.compute_type, arg.scale_type));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+            problem.matmul, HIPBLASLT_MATMUL_DESC_TRANSA, &transA, sizeof(int32_t)));
+        CHECK_HIPBLASLT_ERROR(hipblasLtMatmulDescSetAttribute(
+            problem.matmul, HIPBLASLT_MATMUL_DESC_TRANSB, &transB, sizeof(int32_t)));
+        set_alpha_type(problem.alpha, arg, arg.scale_type);
+        set_beta_type(problem.beta, arg, arg.scale_type);
+        problem.gflops = gemm_gflop_count<float>(M, N, K) * batches;
+
+        std::vector<hipblasLtMatmulHeuristicResult_t> algos;
+        std::vector<int>                              index = {arg.solution_index};
+        size_t                                        workspace = 0;
+        if(arg.solution_index < 0
+           || hipblaslt_ext::getAlgosFromIndex(handle, index, algos) != HIPBLAS_STATUS_SUCCESS
+           || algos.empty()
+           || hipblaslt_ext::matmulIsAlgoSupported(handle,
+                                                   problem.matmul,
+                                                   &problem.alpha,
+                                                   problem.layouts[0],
+                                                   problem.layouts[1],
+                                                   &problem.beta,
+                                                   problem.layouts[2],
+                                                   problem.layouts[3],
+                                                   algos[0].algo,
+                                                   workspace)
+                  != HIPBLAS_STATUS_SUCCESS
+           || workspace > maxWorkspace)
+            return false;
+        problem.algo = algos[0].algo;
+        return true;
+    }
+
+    inline hipblasStatus_t launch(hipblasLtHandle_t            handle,
+                                  Problem&                     problem,
+                                  const hipblasLtMatmulAlgo_t* algo,
+                                  void*                        workspace,
+                                  size_t                       workspaceSize,
+                                  hipStream_t                  stream)
+    {
+        return hipblasLtMatmul(handle,
+                               problem.matmul,
+                               &problem.alpha,
+                               problem.buffers[0]->buf(),
+                               problem.layouts[0],
+                               problem.buffers[1]->buf(),
+                               problem.layouts[1],
+                               &problem.beta,
+                               problem.buffers[2]->buf(),
+                               problem.layouts[2],
+                               problem.buffers[3]->buf(),
+                               problem.layouts[3],
+                               algo,
+                               workspace,
+                               workspaceSize,
+                               stream);
+    }
+} // namespace replay_matmul
+
+/*! \brief  Replays a bench log and prints the time of every problem in the replay against its
+            time run in isolation, then the end-to-end totals. base supplies the options the log
+            does not record, such as the initialization and the workspace size. speed scales the
+            logged pacing, 0 issues the calls back to back. With heuristic, every call queries
+            hipblasLtMatmulAlgoGetHeuristic first, so that its host time includes the selection;
+            the launch then uses the solution the heuristic returns. */
+inline void testing_matmul_replay(const std::string& path,
+                                  const Arguments&   base,
+                                  double             speed,
+                                  bool               heuristic)
+{
+    using namespace replay_matmul;
+
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open the replay log " + path);
+
+    std::vector<std::unique_ptr<Problem>> problems;
+    std::map<std::string, int32_t>        problemIds;
+    std::map<std::string, size_t>         skipped;
+    std::vector<Call>                     calls;
+    int32_t                               streams = 1;
+    std::string                           line;
+    while(std::getline(file, line))
+    {
+        size_t begin = line.find("hipblaslt-bench ");
+        if(begin == std::string::npos)
+            continue;
+        line = line.substr(begin);
+
+        Arguments   arg    = base;
+        int32_t     stream = 0;
+        double      timeUs = calls.empty() ? 0.0 : calls.back().timeUs;
+        std::string reason = parse(line, arg, stream, timeUs);
+        if(!reason.empty())
+        {
+            skipped[reason]++;
+            continue;
+        }
+
+        // The problem is the line without the call's stream and time
+        std::string key = line.substr(0, line.find(" --stream_id"));
+        auto        id  = problemIds.find(key);
+        if(id == problemIds.end())
+        {
+            id = problemIds.emplace(key, int32_t(problems.size())).first;
+            problems.push_back(std::make_unique<Problem>());
+            problems.back()->arg    = arg;
+            problems.back()->key    = key;
+            problems.back()->stream = stream;
+        }
+        calls.push_back(Call{id->second, stream, timeUs});
+        streams = std::max(streams, stream + 1);
+    }
+    for(auto const& reason : skipped)
+        hipblaslt_cout << "Replay skipped " << reason.second << " calls: " << reason.first
+                       << std::endl;
+
+    hipblaslt_local_handle handle{base};
+    size_t                 workspaceSize = base.user_allocated_workspace;
+    std::vector<bool>      runnable(problems.size());
+    for(size_t p = 0; p < problems.size(); p++)
+    {
+        runnable[p] = setup(*problems[p], handle, workspaceSize);
+        if(!runnable[p])
+            hipblaslt_cout << "Replay skipped the solution " << problems[p]->arg.solution_index
+                           << " it cannot run: " << problems[p]->key << std::endl;
+    }
+    calls.erase(std::remove_if(calls.begin(),
+                               calls.end(),
+                               [&](const Call& call) { return !runnable[call.problem]; }),
+                calls.end());
+    if(calls.empty())
+        return;
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    using Workspace = device_vector<unsigned char>;
+    std::vector<hipStream_t>                hipStreams(streams);
+    std::vector<std::unique_ptr<Workspace>> workspaces;
+    for(auto& stream : hipStreams)
+    {
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        workspaces.push_back(std::make_unique<Workspace>(std::max<size_t>(workspaceSize, 1)));
+    }
+
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+    // Isolated: each problem alone and back to back, the way hipblaslt-bench runs a line
+    for(size_t p = 0; p < problems.size(); p++)
+    {
+        if(!runnable[p])
+            continue;
+        Problem&    problem = *problems[p];
+        hipStream_t stream  = hipStreams[problem.stream];
+        void*       ws      = *workspaces[problem.stream];
+        auto        run     = [&]() {
+            CHECK_HIPBLASLT_ERROR(
+                launch(handle, problem, &problem.algo, ws, workspaceSize, stream));
+        };
+        for(int i = 0; i < base.cold_iters; i++)
+            run();
+        CHECK_HIP_ERROR(hipEventRecord(start, stream));
+        for(int i = 0; i < std::max(1, base.iters); i++)
+            run();
+        CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+        CHECK_HIP_ERROR(hipEventSynchronize(stop));
+        float ms = 0.0f;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+        problem.isolatedUs = ms * 1000.0 / std::max(1, base.iters);
+    }
+
+    std::vector<hipEvent_t> starts(calls.size()), stops(calls.size());
+    for(size_t c = 0; c < calls.size(); c++)
+    {
+        CHECK_HIP_ERROR(hipEventCreate(&starts[c]));
+        CHECK_HIP_ERROR(hipEventCreate(&stops[c]));
+    }
+
+    hipblaslt_local_preference pref;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceSetAttribute(
+        pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &workspaceSize, sizeof(workspaceSize)));
+
+    // Replay: call c is issued at the logged offset from the first call, scaled by speed
+    double            firstUs = calls[0].timeUs;
+    Clock::time_point begin   = Clock::now();
+    for(size_t c = 0; c < calls.size(); c++)
+    {
+        Call&       call    = calls[c];
+        Problem&    problem = *problems[call.problem];
+        hipStream_t stream  = hipStreams[call.stream];
+        if(speed > 0)
+        {
+            auto due = begin
+                       + std::chrono::duration_cast<Clock::duration>(
+                           std::chrono::duration<double, std::micro>((call.timeUs - firstUs)
+                                                                     / speed));
+            // Sleep until shortly before, then spin for the last microseconds
+            std::this_thread::sleep_until(due - std::chrono::microseconds(100));
+            while(Clock::now() < due)
+                ;
+        }
+
+        CHECK_HIP_ERROR(hipEventRecord(starts[c], stream));
+        auto callStart = Clock::now();
+
+        hipblasLtMatmulHeuristicResult_t result;
+        const hipblasLtMatmulAlgo_t*     algo = &problem.algo;
+        if(heuristic)
+        {
+            int returned = 0;
+            CHECK_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(handle,
+                                                                  problem.matmul,
+                                                                  problem.layouts[0],
+                                                                  problem.layouts[1],
+                                                                  problem.layouts[2],
+                                                                  problem.layouts[3],
+                                                                  pref,
+                                                                  1,
+                                                                  &result,
+                                                                  &returned));
+            CHECK_SOLUTION_FOUND(returned);
+            algo = &result.algo;
+        }
+        CHECK_HIPBLASLT_ERROR(
+            launch(handle, problem, algo, *workspaces[call.stream], workspaceSize, stream));
+
+        problem.hostUs.push_back(
+            std::chrono::duration<double, std::micro>(Clock::now() - callStart).count());
+        CHECK_HIP_ERROR(hipEventRecord(stops[c], stream));
+    }
+    for(auto& stream : hipStreams)
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    double wallUs = std::chrono::duration<double, std::micro>(Clock::now() - begin).count();
+
+    double deviceTotalUs = 0.0, hostTotalUs = 0.0, gflops = 0.0;
+    for(size_t c = 0; c < calls.size(); c++)
+    {
+        float ms = 0.0f;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, starts[c], stops[c]));
+        Problem& problem = *problems[calls[c].problem];
+        problem.deviceUs.push_back(ms * 1000.0);
+        deviceTotalUs += ms * 1000.0;
+        gflops += problem.gflops;
+        CHECK_HIP_ERROR(hipEventDestroy(starts[c]));
+        CHECK_HIP_ERROR(hipEventDestroy(stops[c]));
+    }
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+    for(auto& stream : hipStreams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    hipblaslt_cout << "Replay: " << calls.size() << " calls of " << problems.size()
+                   << " problems on " << streams << " streams, speed " << speed
+                   << (heuristic ? ", heuristic per call" : "") << std::endl;
+
+    hipblaslt_cout << "problem,calls,isolated-us,replay-mean-us,replay-p50-us,replay-p99-us,"
+                      "host-api-mean-us,replay-Gflops,command"
+                   << std::endl;
+    for(size_t p = 0; p < problems.size(); p++)
+    {
+        Problem& problem = *problems[p];
+        if(problem.deviceUs.empty())
+            continue;
+        double deviceSum = 0.0, hostSum = 0.0;
+        for(double us : problem.deviceUs)
+            deviceSum += us;
+        for(double us : problem.hostUs)
+            hostSum += us;
+        double mean = deviceSum / problem.deviceUs.size();
+        std::sort(problem.deviceUs.begin(), problem.deviceUs.end());
+        hipblaslt_cout << p << "," << problem.deviceUs.size() << "," << problem.isolatedUs << ","
+                       << mean << "," << concurrent_matmul::percentile(problem.deviceUs, 0.5)
+                       << "," << concurrent_matmul::percentile(problem.deviceUs, 0.99) << ","
+                       << hostSum / problem.hostUs.size() << ","
+                       << (mean > 0 ? problem.gflops * 1.0e6 / mean : 0) << ",\"" << problem.key
+                       << "\"" << std::endl;
+        hostTotalUs += hostSum;
+    }
+
+    double loggedUs = calls.back().timeUs - firstUs;
+    hipblaslt_cout << "calls,logged-us,wall-us,device-us,host-api-us,aggregate-Gflops"
+                   << std::endl;
+    hipblaslt_cout << calls.size() << "," << loggedUs << "," << wallUs << "," << deviceTotalUs
+                   << "," << hostTotalUs << "," << (wallUs > 0 ? gflops * 1.0e6 / wallUs : 0)
+                   << std::endl;
+}
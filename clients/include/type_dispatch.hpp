@@ -162,7 +162,8 @@ auto hipblaslt_matmul_dispatch(const Arguments& arg)
             return TEST<hip_bfloat16, hip_bfloat16, hip_bfloat16, float>{}(arg);
         }
         else if(TiA == To && TiB == To && To == HIP_R_32F
-                && (Tc == HIPBLAS_COMPUTE_32F || Tc == HIPBLAS_COMPUTE_32F_FAST_TF32))
+                && (Tc == HIPBLAS_COMPUTE_32F || Tc == HIPBLAS_COMPUTE_32F_FAST_TF32
+                    || Tc == HIPBLASLT_COMPUTE_32F_FAST_3XBF16_EXT))
         {
             return TEST<float, float, float, float>{}(arg);
         }
@@ -392,6 +393,26 @@ auto hipblaslt_matmul_dispatch(const Arguments& arg)
         {
             return TEST<hipblasLtInt8, hipblasLtInt8, int32_t, int32_t>{}(arg);
         }
+        else if(TiA == HIP_R_16F && TiB == HIP_R_8I && To == HIP_R_16F
+                && Tc == HIPBLAS_COMPUTE_32F)
+        {
+            return TEST<hipblasLtHalf,
+                        hipblasLtInt8,
+                        hipblasLtHalf,
+                        float,
+                        hipblasLtHalf,
+                        hipblasLtHalf>{}(arg);
+        }
+        else if(TiA == HIP_R_16BF && TiB == HIP_R_8I && To == HIP_R_16BF
+                && Tc == HIPBLAS_COMPUTE_32F)
+        {
+            return TEST<hip_bfloat16,
+                        hipblasLtInt8,
+                        hip_bfloat16,
+                        float,
+                        hip_bfloat16,
+                        hip_bfloat16>{}(arg);
+        }
         else if(TiA == HIP_R_8F_E4M3_FNUZ && TiB == HIP_R_16F && To == HIP_R_8F_E4M3_FNUZ
                 && Tc == HIPBLAS_COMPUTE_32F_FAST_16F)
         {
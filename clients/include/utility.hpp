@@ -102,6 +102,8 @@ inline bool is_bias_enabled(hipblasLtEpilogue_t value_)
     case HIPBLASLT_EPILOGUE_DGELU_BGRAD:
     case HIPBLASLT_EPILOGUE_BGRADA:
     case HIPBLASLT_EPILOGUE_BGRADB:
+    case HIPBLASLT_EPILOGUE_SWIGLU_BIAS:
+    case HIPBLASLT_EPILOGUE_GEGLU_BIAS:
         return true;
     default:
         return false;
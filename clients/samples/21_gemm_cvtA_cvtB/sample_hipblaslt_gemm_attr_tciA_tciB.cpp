@@ -50,9 +50,11 @@ void simpleGemm(hipblasLtHandle_t  handle,
 int main()
 {
     /** This is a NN example with
-     *  a = (m, k). lda = m
+     *  a = (m, k), row major. lda = k
      *  b = (k, n). ldb = k
      *  c = d = (m, n). ldc = ldd = m
+     *  A and B are converted to FP8 and A is transposed while they are loaded by the kernel,
+     *  without a separate hipblasLtMatrixTransform pass.
      */
     Runner<hipblasLtHalf, hipblasLtHalf, hipblasLtHalf, float, float> runner(
         128, 128, 128, 1, 1.f, 1.f, 32 * 128 * 128);
@@ -97,7 +99,10 @@ void simpleGemm(hipblasLtHandle_t  handle,
                 hipStream_t        stream)
 {
     hipblasLtMatrixLayout_t matA, matB, matC, matD;
-    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, HIP_R_16F, m, k, m));
+    hipblasLtOrder_t        orderA = HIPBLASLT_ORDER_ROW;
+    CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matA, HIP_R_16F, m, k, k));
+    CHECK_HIPBLASLT_ERROR(
+        hipblasLtMatrixLayoutSetAttribute(matA, HIPBLASLT_MATRIX_LAYOUT_ORDER, &orderA, sizeof(orderA)));
     CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matB, HIP_R_16F, k, n, k));
     CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matC, HIP_R_16F, m, n, m));
     CHECK_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&matD, HIP_R_16F, m, n, m));
@@ -403,6 +403,7 @@ update_cmake=true
 enable_gprof=false
 keep_build_tmp=false
 disable_hipblaslt_marker=false
+disable_instrumentation=false
 enable_tensile_marker=false
 logic_filter=
 
@@ -419,7 +420,7 @@ fi
 # check if we have a modern version of getopt that can handle whitespace and long parameters
 getopt -T
 if [[ $? -eq 4 ]]; then
-  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,clients,dependencies,debug,hip-clang,static,relocatable,codecoverage,relwithdebinfo,address-sanitizer,merge-files,no-merge-files,no_tensile,no-tensile,msgpack,no-msgpack,logic:,cov:,fork:,branch:,test_local_path:,cpu_ref_lib:,build_dir:,use-custom-version:,architecture:,gprof,keep-build-tmp,legacy_hipblas_direct,disable-hipblaslt-marker,enable-tensile-marker,logic-yaml-filter: --options hicdgrka:j:o:l:f:b:nu:t: -- "$@")
+  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,clients,dependencies,debug,hip-clang,static,relocatable,codecoverage,relwithdebinfo,address-sanitizer,merge-files,no-merge-files,no_tensile,no-tensile,msgpack,no-msgpack,logic:,cov:,fork:,branch:,test_local_path:,cpu_ref_lib:,build_dir:,use-custom-version:,architecture:,gprof,keep-build-tmp,legacy_hipblas_direct,disable-hipblaslt-marker,disable-instrumentation,enable-tensile-marker,logic-yaml-filter: --options hicdgrka:j:o:l:f:b:nu:t: -- "$@")
 else
   echo "Need a new version of getopt"
   exit 1
@@ -533,6 +534,9 @@ while true; do
         --disable-hipblaslt-marker)
             disable_hipblaslt_marker=true
             shift;;
+        --disable-instrumentation)
+            disable_instrumentation=true
+            shift;;
         --enable-tensile-marker)
             enable_tensile_marker=true
             shift;;
@@ -797,6 +801,10 @@ pushd .
     tensile_opt="${tensile_opt} -DHIPBLASLT_ENABLE_MARKER=OFF"
   fi
 
+  if [[ "${disable_instrumentation}" == true ]]; then
+    tensile_opt="${tensile_opt} -DHIPBLASLT_ENABLE_INSTRUMENTATION=OFF"
+  fi
+
   if [[ "${enable_tensile_marker}" == true ]]; then
     tensile_opt="${tensile_opt} -DTensile_ENABLE_MARKER=ON"
   fi
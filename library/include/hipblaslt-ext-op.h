@@ -43,13 +43,15 @@ extern "C" {
  *  This function computes softmax on given 2D-tensor along specified dimension.
  *
  *  @param[in]
- *  datatype Datatype of input/output tensor, currently support HIP_R_32F only.
+ *  datatype Datatype of input/output tensor, HIP_R_32F, or HIP_R_16F and HIP_R_16BF
+ *  where the ext op library provides kernels for them. Half precision kernels accumulate in fp32.
  *
  *  @param[in]
  *  m The first dimension of input/output tensor.
  *
  *  @param[in]
- *  n The second dimension of input/output tensor. Currently only values less than or equal to 256 are supported.
+ *  n The second dimension of input/output tensor. Rows longer than 256 are split across
+ *  several workgroups and computed with a running max and sum, for any \p datatype.
  *
  *  @param[in]
  *  dim Specified dimension to perform softmax on. Currently 1 is the only valid value.
@@ -64,8 +66,8 @@ extern "C" {
  *  output output tensor buffer.
  *
  *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
- *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p n is greater than 256.
- *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p dim is not 1 or \p datatype is not HIP_R_32F.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m or \p n is 0.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p dim is not 1 or there is no kernel for \p datatype.
  */
 HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtSoftmax(hipDataType datatype,
                                                      uint32_t    m,
@@ -75,6 +77,212 @@ HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtSoftmax(hipDataType datatype,
                                                      void*       input,
                                                      hipStream_t stream);
 
+/*! \ingroup library_module
+ *  \brief Perform softmax(scale * input + bias) with an optional causal mask on a batch of attention score matrices.
+ *
+ *  \details
+ *  This function computes softmax along the rows of \p batchCount m x n row-major matrices in one launch,
+ *  replacing an elementwise scale and mask pass followed by hipblasltExtSoftmax. With \p causal, element
+ *  (i, j) is masked when j > i + n - m, so the last row sees every column; a fully masked row is set to 0.
+ *
+ *  @param[in]
+ *  datatype Datatype of input, output and bias tensor, currently support HIP_R_32F, HIP_R_16F and HIP_R_16BF.
+ *  Half precision is accumulated in fp32.
+ *
+ *  @param[in]
+ *  m The number of rows of each matrix.
+ *
+ *  @param[in]
+ *  n The number of columns of each matrix.
+ *
+ *  @param[in]
+ *  batchCount The number of matrices.
+ *
+ *  @param[out]
+ *  output output tensor buffer. can't be nullptr. may be the same buffer as input.
+ *
+ *  @param[in]
+ *  strideOutput Elements between two output matrices.
+ *
+ *  @param[in]
+ *  input input tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  strideInput Elements between two input matrices.
+ *
+ *  @param[in]
+ *  scale Scalar multiplied with input before bias and mask are applied.
+ *
+ *  @param[in]
+ *  causal Non-zero to apply the causal triangular mask.
+ *
+ *  @param[in]
+ *  bias Additive tensor buffer. nullptr means calculation doesn't involve bias.
+ *
+ *  @param[in]
+ *  biasRowStride Elements between two bias rows, 0 broadcasts one row over all rows.
+ *
+ *  @param[in]
+ *  biasBatchStride Elements between two bias matrices, 0 broadcasts one matrix over the batch.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m, n or batchCount is 0, or input or output is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype is not HIP_R_32F, HIP_R_16F or HIP_R_16BF.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtScaleMaskSoftmax(hipDataType datatype,
+                                                              uint32_t    m,
+                                                              uint32_t    n,
+                                                              uint32_t    batchCount,
+                                                              void*       output,
+                                                              int64_t     strideOutput,
+                                                              void*       input,
+                                                              int64_t     strideInput,
+                                                              float       scale,
+                                                              int32_t     causal,
+                                                              void*       bias,
+                                                              int64_t     biasRowStride,
+                                                              int64_t     biasBatchStride,
+                                                              hipStream_t stream);
+
+/*! \ingroup library_module
+ *  \brief Perform attention softmax(scale * Q * K^T) * V with an optional causal mask in one launch.
+ *
+ *  \details
+ *  This function replaces a Q * K^T gemm, hipblasltExtScaleMaskSoftmax and a P * V gemm. Each workgroup
+ *  streams the keys and values of its head once and keeps a running softmax of its query rows, so the
+ *  seqQ x seqK score matrix is never written to memory. Q and output are [batchCount, seqQ, numHeads,
+ *  headDim] and K and V are [batchCount, seqK, numKvHeads, headDim] row-major tensors; query head h reads
+ *  key and value head h / (numHeads / numKvHeads). With \p causal, key j is masked for query i when
+ *  j > i + seqK - seqQ, as in hipblasltExtScaleMaskSoftmax; the output of a fully masked row is 0.
+ *
+ *  @param[in]
+ *  inputType Datatype of Q, K and V, currently support HIP_R_32F, HIP_R_16F, HIP_R_16BF,
+ *  HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ. All inputs are accumulated in fp32.
+ *
+ *  @param[in]
+ *  outputType Datatype of output, currently support HIP_R_32F, HIP_R_16F and HIP_R_16BF.
+ *
+ *  @param[in]
+ *  batchCount The number of sequences.
+ *
+ *  @param[in]
+ *  numHeads The number of query heads.
+ *
+ *  @param[in]
+ *  numKvHeads The number of key and value heads, a divisor of \p numHeads.
+ *
+ *  @param[in]
+ *  seqQ The number of queries of each sequence.
+ *
+ *  @param[in]
+ *  seqK The number of keys and values of each sequence.
+ *
+ *  @param[in]
+ *  headDim The size of each head, at most 256.
+ *
+ *  @param[out]
+ *  output output tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  q query tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  k key tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  v value tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  scale Scalar multiplied with Q * K^T before the mask and softmax, e.g. 1 / sqrt(headDim) times the
+ *  dequantization scales of fp8 Q and K.
+ *
+ *  @param[in]
+ *  outputScale Scalar multiplied with the output, e.g. the dequantization scale of fp8 V.
+ *
+ *  @param[in]
+ *  causal Non-zero to apply the causal triangular mask.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If a size is 0, \p numKvHeads does not divide \p numHeads, or a
+ *  buffer is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p headDim is above 256 or a datatype is not supported.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtAttention(hipDataType inputType,
+                                                       hipDataType outputType,
+                                                       uint32_t    batchCount,
+                                                       uint32_t    numHeads,
+                                                       uint32_t    numKvHeads,
+                                                       uint32_t    seqQ,
+                                                       uint32_t    seqK,
+                                                       uint32_t    headDim,
+                                                       void*       output,
+                                                       const void* q,
+                                                       const void* k,
+                                                       const void* v,
+                                                       float       scale,
+                                                       float       outputScale,
+                                                       int32_t     causal,
+                                                       hipStream_t stream);
+
+/*! \ingroup library_module
+ *  \brief Query the tiles of the ext op library kernels that can run rows of \p n columns.
+ *
+ *  \details
+ *  The tile is the row length a kernel is built for, tileN of a "Softmax" kernel and the limit of a
+ *  "LayerNorm" kernel. The ext op picks the smallest one by default, or the one listed for its
+ *  architecture, op, type and n in the file named by HIPBLASLT_EXT_OP_TUNING_FILE, or in
+ *  hipblasltExtOpTuning.txt next to the ext op library. Each line of that file is
+ *  "<arch> <op> <type> <max n> <tile>", with type S, H or B.
+ *
+ *  @param[in]
+ *  opName "Softmax" or "LayerNorm".
+ *
+ *  @param[in]
+ *  datatype Datatype of the kernels.
+ *
+ *  @param[in]
+ *  n The second dimension of input/output tensor.
+ *
+ *  @param[out]
+ *  tiles Buffer of *count tiles in increasing order. nullptr means only \p count is returned.
+ *
+ *  @param[inout]
+ *  count Capacity of \p tiles on input, number of tiles on output. can't be nullptr.
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p opName or count is nullptr, or n is 0.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If there is no kernel for \p opName and datatype on this device.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtOpGetCandidateTiles(const char* opName,
+                                                                 hipDataType datatype,
+                                                                 uint32_t    n,
+                                                                 uint32_t*   tiles,
+                                                                 uint32_t*   count);
+
+/*! \ingroup library_module
+ *  \brief Make the following calls of an ext op on this thread use the kernel of \p tile, for tuning.
+ *
+ *  @param[in]
+ *  opName "Softmax" or "LayerNorm".
+ *
+ *  @param[in]
+ *  tile A tile from hipblasltExtOpGetCandidateTiles. 0 goes back to the tuned or default choice.
+ *  A tile that can't run a call is ignored for it.
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p opName is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p opName is not "Softmax" or "LayerNorm".
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtOpForceTile(const char* opName, uint32_t tile);
+
 /*! \ingroup library_module
  *  \brief Perform 2-D layernorm on with source input tensor and result output tensor.
  *
@@ -131,6 +339,128 @@ HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtLayerNorm(hipDataType datatype,
                                                        void*       beta,
                                                        hipStream_t stream);
 
+/*! \ingroup library_module
+ *  \brief Perform the backward pass of 2-D layernorm with the mean and invvar saved by hipblasltExtLayerNorm.
+ *
+ *  \details
+ *  This function computes dInput, dGamma and dBeta from dOutput. dGamma and dBeta are reduced over the rows
+ *  in a fixed order, so the results are the same on every run.
+ *
+ *  @param[in]
+ *  datatype Datatype of dInput, dGamma, dBeta, dOutput, input and gamma tensor, currently support HIP_R_32F, HIP_R_16F and HIP_R_16BF.
+ *
+ *  @param[out]
+ *  dInput 2-D tensor buffer. nullptr means dInput is not computed.
+ *
+ *  @param[out]
+ *  dGamma tensor buffer of n elements. nullptr means dGamma is not computed.
+ *
+ *  @param[out]
+ *  dBeta tensor buffer of n elements. nullptr means dBeta is not computed.
+ *
+ *  @param[in]
+ *  dOutput 2-D tensor buffer, gradient of the layernorm output. can't be nullptr.
+ *
+ *  @param[in]
+ *  input 2-D tensor buffer, the layernorm input. can't be nullptr.
+ *
+ *  @param[in]
+ *  mean tensor buffer of m floats. can't be nullptr.
+ *
+ *  @param[in]
+ *  invvar tensor buffer of m floats. can't be nullptr.
+ *
+ *  @param[in]
+ *  gamma tensor buffer. nullptr means the forward calculation didn't involve gamma.
+ *
+ *  @param[in]
+ *  m The first dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  n The second dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m or n is 0, or dOutput, input, mean or invvar is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype is not HIP_R_32F, HIP_R_16F or HIP_R_16BF.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtLayerNormBackward(hipDataType datatype,
+                                                               void*       dInput,
+                                                               void*       dGamma,
+                                                               void*       dBeta,
+                                                               void*       dOutput,
+                                                               void*       input,
+                                                               void*       mean,
+                                                               void*       invvar,
+                                                               void*       gamma,
+                                                               uint32_t    m,
+                                                               uint32_t    n,
+                                                               hipStream_t stream);
+
+/*! \ingroup library_module
+ *  \brief Perform 2-D RMSNorm on given tensor, with an optional residual added before normalization.
+ *
+ *  \details
+ *  This function computes s = input + residual, output = s / sqrt(mean(s * s) + eps) * gamma,
+ *  optionally stores s to residualOut and optionally quantizes output to FP8 with outputScale.
+ *
+ *  @param[in]
+ *  datatype Datatype of input, residual, residualOut and gamma tensor, currently support HIP_R_32F, HIP_R_16F and HIP_R_16BF.
+ *
+ *  @param[in]
+ *  outDatatype Datatype of output tensor, either \p datatype or HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ.
+ *
+ *  @param[out]
+ *  output 2-D tensor buffer. can't be nullptr.
+ *
+ *  @param[out]
+ *  residualOut 2-D tensor buffer of input + residual. nullptr means the sum is not stored. may be the same buffer as input or residual.
+ *
+ *  @param[in]
+ *  input 2-D tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  residual 2-D tensor buffer. nullptr means calculation doesn't involve residual.
+ *
+ *  @param[in]
+ *  gamma tensor buffer. nullptr means calculation doesn't involve gamma.
+ *
+ *  @param[in]
+ *  outputScale 1-D tensor buffer. only support float. can't be nullptr when outDatatype is a FP8 type, ignored otherwise.
+ *
+ *  @param[in]
+ *  m The first dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  n The second dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  eps for sqrt to avoid inf value.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m or n is 0, input or output is nullptr, or outputScale is nullptr with a FP8 outDatatype.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype is not HIP_R_32F, HIP_R_16F or HIP_R_16BF, or outDatatype is not datatype, HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtRMSNorm(const hipDataType datatype,
+                                                     const hipDataType outDatatype,
+                                                     void*             output,
+                                                     void*             residualOut,
+                                                     void*             input,
+                                                     void*             residual,
+                                                     void*             gamma,
+                                                     void*             outputScale,
+                                                     uint32_t          m,
+                                                     uint32_t          n,
+                                                     float             eps,
+                                                     hipStream_t       stream);
+
 /*! \ingroup library_module
  *  \brief Perform absmax on given 2-D tensor and output one value absmax(tensor) value.
  *
@@ -171,6 +501,48 @@ HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtAMax(const hipDataType datatype,
                                                   uint32_t          n,
                                                   hipStream_t       stream);
 
+/*! \ingroup library_module
+ *  \brief One tensor of hipblasltExtAMaxMultiTensor.
+ */
+typedef struct hipblasltExtAMaxTensor
+{
+    void*       output; /**< Amax buffer of one outDatatype value. can't be nullptr. */
+    void*       input; /**< 2-D tensor buffer. can't be nullptr unless m or n is 0. */
+    uint32_t    m; /**< The first dimension of input tensor. */
+    uint32_t    n; /**< The second dimension of input tensor. */
+    hipDataType datatype; /**< Datatype of input tensor, HIP_R_32F, HIP_R_16F or HIP_R_16BF. */
+} hipblasltExtAMaxTensor;
+
+/*! \ingroup library_module
+ *  \brief Perform absmax on many 2-D tensors in one launch and output one absmax value per tensor.
+ *
+ *  \details
+ *  This function computes the amax of every tensor described in \p tensors. The tensors are cut into
+ *  chunks of equal size that are dealt round robin to a persistent grid, so small tensors cost no
+ *  launch of their own and large ones still spread over the whole device. A tensor with m or n 0 gets 0.
+ *
+ *  @param[in]
+ *  outDatatype Datatype of output tensors, currently support HIP_R_32F and HIP_R_16F only.
+ *
+ *  @param[in]
+ *  tensors Device buffer of \p numTensors hipblasltExtAMaxTensor. can't be nullptr.
+ *
+ *  @param[in]
+ *  numTensors The number of tensors.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p numTensors is 0 or tensors is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p outDatatype is not HIP_R_32F or HIP_R_16F.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtAMaxMultiTensor(const hipDataType             outDatatype,
+                                                             const hipblasltExtAMaxTensor* tensors,
+                                                             uint32_t                      numTensors,
+                                                             hipStream_t                   stream);
+
 /*! \ingroup library_module
  *  \brief Perform absmax and scaling on given 2-D tensor. Generate one absmax value and scaled 2-D tensor output.
  *
@@ -222,6 +594,314 @@ HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtAMaxWithScale(const hipDataType dat
                                                            uint32_t          m,
                                                            uint32_t          n,
                                                            hipStream_t       stream);
+
+/*! \ingroup types_module
+ *  \brief Granularity of the scales of hipblasltExtAMaxWithBlockScale.
+ */
+typedef enum
+{
+    HIPBLASLT_EXT_AMAX_SCALE_ROW   = 0, /**< One scale per row, m floats. Usable as HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER_VEC_EXT or HIPBLASLT_MATMUL_DESC_B_SCALE_POINTER_VEC_EXT of the matrix whose rows or columns are the rows of the input. */
+    HIPBLASLT_EXT_AMAX_SCALE_BLOCK = 1, /**< One scale per blockSize x blockSize tile, ceil(m / blockSize) x ceil(n / blockSize) floats in row-major order. */
+} hipblasltExtAMaxScaleMode_t;
+
+/*! \ingroup library_module
+ *  \brief Perform absmax and FP8 quantization on given 2-D tensor with one scale per row or per tile.
+ *
+ *  \details
+ *  This function computes the amax of every row or tile of the row-major input, the scale
+ *  s = amax / max(scaleDatatype) of it, 1 if amax is 0, and outputD = input / s. The scales are
+ *  dequantization scales, so a GEMM that multiplies by them recovers the input range.
+ *
+ *  @param[in]
+ *  datatype Datatype of input tensor, currently support HIP_R_32F, HIP_R_16F and HIP_R_16BF.
+ *
+ *  @param[in]
+ *  scaleDatatype Datatype of outputD tensor, currently support HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ only.
+ *
+ *  @param[in]
+ *  mode Row or tile scales, see hipblasltExtAMaxScaleMode_t.
+ *
+ *  @param[in]
+ *  blockSize Edge of a square tile with HIPBLASLT_EXT_AMAX_SCALE_BLOCK, 128 for the usual recipes. ignored with HIPBLASLT_EXT_AMAX_SCALE_ROW.
+ *
+ *  @param[out]
+ *  amax float buffer of one value per row or tile. nullptr means amax is not stored.
+ *
+ *  @param[out]
+ *  scale float buffer of one value per row or tile. can't be nullptr.
+ *
+ *  @param[out]
+ *  outputD quantized 2-D tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  input 2-D tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  m The first dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  n The second dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m or n is 0, blockSize is 0 with HIPBLASLT_EXT_AMAX_SCALE_BLOCK, or input, scale or outputD is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype is not HIP_R_32F, HIP_R_16F or HIP_R_16BF, scaleDatatype is not HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ, or mode is unknown.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtAMaxWithBlockScale(const hipDataType                 datatype,
+                                                                const hipDataType                 scaleDatatype,
+                                                                const hipblasltExtAMaxScaleMode_t mode,
+                                                                uint32_t                          blockSize,
+                                                                void*                             amax,
+                                                                void*                             scale,
+                                                                void*                             outputD,
+                                                                void*                             input,
+                                                                uint32_t                          m,
+                                                                uint32_t                          n,
+                                                                hipStream_t                       stream);
+
+/*! \ingroup types_module
+ *  \brief Source of the per-tensor scales of hipblasltExtFp8Quantize.
+ */
+typedef enum
+{
+    HIPBLASLT_EXT_FP8_SCALING_CURRENT = 0, /**< The scales are computed from the amax of the inputs of this call and written to the scale buffers, taking a second pass over the inputs. */
+    HIPBLASLT_EXT_FP8_SCALING_DELAYED = 1, /**< The scales are read from the scale buffers, typically derived from the amax history of earlier steps, and the inputs are read once. */
+} hipblasltExtFp8Scaling_t;
+
+/*! \ingroup library_module
+ *  \brief Maximum number of tensors of one hipblasltExtFp8Quantize call.
+ */
+#define HIPBLASLT_EXT_FP8_QUANTIZE_MAX_TENSORS 8
+
+/*! \ingroup library_module
+ *  \brief One tensor of hipblasltExtFp8Quantize.
+ */
+typedef struct hipblasltExtFp8QuantizeTensor
+{
+    void*       output; /**< Quantized 2-D tensor buffer of outDatatype. can't be nullptr unless m or n is 0. */
+    void*       input; /**< 2-D tensor buffer. can't be nullptr unless m or n is 0. */
+    void*       scale; /**< Dequantization scale, one float. Written with HIPBLASLT_EXT_FP8_SCALING_CURRENT, read with HIPBLASLT_EXT_FP8_SCALING_DELAYED. can't be nullptr. */
+    void*       amax; /**< Amax of the input, one float. nullptr means amax is not stored. */
+    uint32_t    m; /**< The first dimension of input tensor. */
+    uint32_t    n; /**< The second dimension of input tensor. */
+    hipDataType datatype; /**< Datatype of input tensor, HIP_R_32F, HIP_R_16F or HIP_R_16BF. */
+    hipDataType outDatatype; /**< Datatype of output tensor, HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ. */
+} hipblasltExtFp8QuantizeTensor;
+
+/*! \ingroup library_module
+ *  \brief Quantize many 2-D tensors to FP8 with one scale per tensor.
+ *
+ *  \details
+ *  This function computes outputD = input / scale for every tensor, saturating to the range of
+ *  outDatatype, and the amax of the input. With HIPBLASLT_EXT_FP8_SCALING_CURRENT the scale is
+ *  amax / max(outDatatype), 1 if amax is 0, found by an amax launch over all tensors before the
+ *  quantize launch. With HIPBLASLT_EXT_FP8_SCALING_DELAYED the given scales are used and the amax
+ *  is reduced while quantizing, in a single launch. The scales are dequantization scales, usable as
+ *  HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER and HIPBLASLT_MATMUL_DESC_B_SCALE_POINTER. The tensors
+ *  are cut into chunks that are dealt round robin to a persistent grid as in
+ *  hipblasltExtAMaxMultiTensor.
+ *
+ *  @param[in]
+ *  scaling Current or delayed scaling, see hipblasltExtFp8Scaling_t.
+ *
+ *  @param[in]
+ *  tensors Host array of \p numTensors hipblasltExtFp8QuantizeTensor. can't be nullptr.
+ *
+ *  @param[in]
+ *  numTensors The number of tensors, at most HIPBLASLT_EXT_FP8_QUANTIZE_MAX_TENSORS.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p numTensors is 0 or above HIPBLASLT_EXT_FP8_QUANTIZE_MAX_TENSORS, tensors is nullptr, or a tensor has no scale or, with m and n not 0, no input or output.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p scaling is unknown, or a datatype is not HIP_R_32F, HIP_R_16F or HIP_R_16BF, or an outDatatype is not HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtFp8Quantize(hipblasltExtFp8Scaling_t             scaling,
+                                                         const hipblasltExtFp8QuantizeTensor* tensors,
+                                                         uint32_t                             numTensors,
+                                                         hipStream_t                          stream);
+
+/*! \ingroup library_module
+ *  \brief Perform 2-D layernorm, scaling and FP8 quantization on given tensor in one pass. Generate one absmax value of the layernorm result and the scaled FP8 2-D tensor output.
+ *
+ *  \details
+ *  This function computes y = layernorm(input) * gamma + beta, output = y * inputScale and amax = absmax(y),
+ *  replacing hipblasltExtLayerNorm followed by hipblasltExtAMaxWithScale.
+ *
+ *  @param[in]
+ *  datatype Datatype of input, gamma and beta tensor, currently support HIP_R_32F, HIP_R_16F and HIP_R_16BF.
+ *
+ *  @param[in]
+ *  outDatatype Datatype of output tensor, currently support HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ only.
+ *
+ *  @param[out]
+ *  output scaled 2-D tensor buffer. can't be nullptr.
+ *
+ *  @param[out]
+ *  amax Amax tensor buffer, one float. can't be nullptr.
+ *
+ *  @param[out]
+ *  mean tensor buffer of m floats. nullptr means mean is not stored.
+ *
+ *  @param[out]
+ *  invvar tensor buffer of m floats. 1 / sqrt(std). nullptr means invvar is not stored.
+ *
+ *  @param[in]
+ *  input 2-D tensor buffer. can't be nullptr.
+ *
+ *  @param[in]
+ *  inputScale 1-D tensor buffer. can't be nullptr. only support float.
+ *
+ *  @param[in]
+ *  m The first dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  n The second dimension of input/output tensor.
+ *
+ *  @param[in]
+ *  eps for sqrt to avoid inf value.
+ *
+ *  @param[in]
+ *  gamma tensor buffer. nullptr means calculation doesn't involve gamma.
+ *
+ *  @param[in]
+ *  beta tensor buffer. nullptr means calculation doesn't involve beta.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m or n is 0, or input, inputScale, output, or amax is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype is not HIP_R_32F, HIP_R_16F or HIP_R_16BF, or outDatatype is not HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtLayerNormAMaxWithScale(const hipDataType datatype,
+                                                                    const hipDataType outDatatype,
+                                                                    void*             output,
+                                                                    void*             amax,
+                                                                    void*             mean,
+                                                                    void*             invvar,
+                                                                    void*             input,
+                                                                    void*             inputScale,
+                                                                    uint32_t          m,
+                                                                    uint32_t          n,
+                                                                    float             eps,
+                                                                    void*             gamma,
+                                                                    void*             beta,
+                                                                    hipStream_t       stream);
+
+/*! \ingroup library_module
+ *  \brief Sizes of the buffers written by hipblasltExtSparseCompress.
+ *
+ *  \details
+ *  The compressed values keep the layout of A with half of k: an A that is not transposed keeps \p lda, a transposed
+ *  one is packed. The metadata holds one byte per 8 elements along k of every row of op(A). A batch stride of 0 has
+ *  a single batch of each.
+ *
+ *  @param[in]
+ *  datatype Datatype of A, currently support HIP_R_16F, HIP_R_16BF, HIP_R_8I, HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ.
+ *
+ *  @param[in]
+ *  opA Operation of A in the GEMM, HIPBLAS_OP_N or HIPBLAS_OP_T.
+ *
+ *  @param[in]
+ *  m Rows of op(A).
+ *
+ *  @param[in]
+ *  k Columns of op(A), a multiple of 8.
+ *
+ *  @param[in]
+ *  lda Leading dimension of A.
+ *
+ *  @param[in]
+ *  strideA Batch stride of A.
+ *
+ *  @param[in]
+ *  batchCount The number of batches.
+ *
+ *  @param[out]
+ *  compressedBytes Size of the compressed values. can't be nullptr.
+ *
+ *  @param[out]
+ *  metadataBytes Size of the metadata. can't be nullptr.
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If \p m, k or batchCount is not positive, k is not a multiple of 8, lda is too small, or an output is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype or opA is not supported.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtSparseCompressedSize(hipDataType        datatype,
+                                                                  hipblasOperation_t opA,
+                                                                  int64_t            m,
+                                                                  int64_t            k,
+                                                                  int64_t            lda,
+                                                                  int64_t            strideA,
+                                                                  int32_t            batchCount,
+                                                                  size_t*            compressedBytes,
+                                                                  size_t*            metadataBytes);
+
+/*! \ingroup library_module
+ *  \brief Compress A into the 2:4 structured-sparse form read by hipblasLtMatmul.
+ *
+ *  \details
+ *  Of every 4 consecutive elements of a row of op(A) along k, the 2 of largest magnitude are kept in order and the
+ *  position of each is stored in 2 bits of the metadata. An A that is already 2:4 sparse is compressed exactly,
+ *  any other A is pruned. The GEMM then runs with HIPBLASLT_MATRIX_LAYOUT_SPARSITY of A set to
+ *  HIPBLASLT_SPARSITY_2_4_COMPRESSED, \p compressed as A and \p metadata as
+ *  HIPBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER, while the layout of A still describes the dense matrix.
+ *
+ *  @param[in]
+ *  datatype Datatype of A, see hipblasltExtSparseCompressedSize.
+ *
+ *  @param[in]
+ *  opA Operation of A in the GEMM, HIPBLAS_OP_N or HIPBLAS_OP_T.
+ *
+ *  @param[in]
+ *  m Rows of op(A).
+ *
+ *  @param[in]
+ *  k Columns of op(A), a multiple of 8.
+ *
+ *  @param[in]
+ *  lda Leading dimension of A.
+ *
+ *  @param[in]
+ *  strideA Batch stride of A.
+ *
+ *  @param[in]
+ *  batchCount The number of batches.
+ *
+ *  @param[in]
+ *  A Dense A. can't be nullptr.
+ *
+ *  @param[out]
+ *  compressed Buffer of the size given by hipblasltExtSparseCompressedSize. can't be nullptr.
+ *
+ *  @param[out]
+ *  metadata Buffer of the size given by hipblasltExtSparseCompressedSize. can't be nullptr.
+ *
+ *  @param[in]
+ *  stream The HIP stream where all the GPU work will be submitted.
+ *
+ *  \retval HIPBLAS_STATUS_SUCCESS If it runs successfully.
+ *  \retval HIPBLAS_STATUS_INVALID_VALUE If the sizes are invalid, see hipblasltExtSparseCompressedSize, or a buffer is nullptr.
+ *  \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p datatype or opA is not supported.
+ */
+HIPBLASLT_EXPORT hipblasStatus_t hipblasltExtSparseCompress(hipDataType        datatype,
+                                                            hipblasOperation_t opA,
+                                                            int64_t            m,
+                                                            int64_t            k,
+                                                            int64_t            lda,
+                                                            int64_t            strideA,
+                                                            int32_t            batchCount,
+                                                            const void*        A,
+                                                            void*              compressed,
+                                                            void*              metadata,
+                                                            hipStream_t        stream);
 #ifdef __cplusplus
 }
 #endif
@@ -30,9 +30,12 @@
  */
 
 #pragma once
+#include "hipblaslt/hipblaslt-ext-op.h"
 #include "hipblaslt/hipblaslt.h"
 
+#include <future>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace hipblaslt_ext
@@ -53,6 +56,17 @@ namespace hipblaslt_ext
         HIPBLASLT_GROUPED_GEMM = 2,
     };
 
+    /*! \ingroup types_module
+     *  \brief The operand that all groups of a GroupedGemm share, see
+     * GroupedGemm::setSharedOperand().
+     */
+    enum class SharedOperand
+    {
+        NONE = 0,
+        A    = 1,
+        B    = 2,
+    };
+
     /*! \ingroup types_module
      *  \brief hipblasLt extension preference for gemm problems. (deprecated)
      *
@@ -83,7 +97,9 @@ namespace hipblaslt_ext
     /*! \ingroup types_module
      *  \brief hipblasLt extension preference for gemm problems.
      *
-     * \details Currently only supports setting max workspace size.
+     * \details Sets the max workspace size and the knobs that steer the ranking
+     * of algoGetHeuristic, e.g. to avoid atomics and full-device persistent grids
+     * when several streams share the GPU.
      */
     class GemmPreferenceV2
     {
@@ -112,6 +128,99 @@ namespace hipblaslt_ext
          */
         HIPBLASLT_EXPORT const size_t getMaxWorkspaceBytes() const;
 
+        /*! \ingroup library_module
+         *  \brief This function ranks solutions that need no workspace first.
+         *
+         *  @param[in]
+         *  preferNoWorkspace  Rank solutions without workspace first, default is false.
+         */
+        HIPBLASLT_EXPORT void setPreferNoWorkspace(bool preferNoWorkspace);
+
+        /*! \ingroup library_module
+         *  \brief This function returns whether solutions without workspace rank first.
+         */
+        HIPBLASLT_EXPORT bool getPreferNoWorkspace() const;
+
+        /*! \ingroup library_module
+         *  \brief This function sets the max fraction of CUs a persistent grid may hold.
+         *
+         *  \details Persistent and StreamK kernels keep their grid resident until the
+         *  problem is done. Solutions whose grid exceeds this fraction of the CUs are
+         *  skipped. Regular grids are not limited.
+         *
+         *  @param[in]
+         *  maxCUOccupancy  Fraction of CUs in (0, 1], default is 1.
+         */
+        HIPBLASLT_EXPORT void setMaxCUOccupancy(float maxCUOccupancy);
+
+        /*! \ingroup library_module
+         *  \brief This function returns the max fraction of CUs a persistent grid may hold.
+         */
+        HIPBLASLT_EXPORT float getMaxCUOccupancy() const;
+
+        /*! \ingroup library_module
+         *  \brief This function skips solutions that reduce with atomics.
+         *
+         *  @param[in]
+         *  deterministicReduction  Only return bitwise reproducible solutions, default is false.
+         */
+        HIPBLASLT_EXPORT void setDeterministicReduction(bool deterministicReduction);
+
+        /*! \ingroup library_module
+         *  \brief This function returns whether solutions that reduce with atomics are skipped.
+         */
+        HIPBLASLT_EXPORT bool getDeterministicReduction() const;
+
+        /*! \ingroup library_module
+         *  \brief This function ranks persistent and StreamK solutions first.
+         *
+         *  @param[in]
+         *  preferPersistent  Rank persistent solutions first, default is false.
+         */
+        HIPBLASLT_EXPORT void setPreferPersistent(bool preferPersistent);
+
+        /*! \ingroup library_module
+         *  \brief This function returns whether persistent solutions rank first.
+         */
+        HIPBLASLT_EXPORT bool getPreferPersistent() const;
+
+        /*! \ingroup library_module
+         *  \brief This function ranks solutions with regular grids first.
+         *
+         *  \details Regular grids hand CUs back workgroup by workgroup, so a latency
+         *  critical GEMM on a high-priority stream doesn't hold the device while other
+         *  streams wait. Ignored when persistent solutions are preferred.
+         *
+         *  @param[in]
+         *  preferNonPersistent  Rank non-persistent solutions first, default is false.
+         */
+        HIPBLASLT_EXPORT void setPreferNonPersistent(bool preferNonPersistent);
+
+        /*! \ingroup library_module
+         *  \brief This function returns whether non-persistent solutions rank first.
+         */
+        HIPBLASLT_EXPORT bool getPreferNonPersistent() const;
+
+        /*! \ingroup library_module
+         *  \brief This function picks the most energy-efficient tuned solution within a
+         *  latency bound.
+         *
+         *  \details Applies to the entries of the override file that record the time and
+         *  the energy per call next to the solution index. Of the entries of the problem,
+         *  the one with the least energy whose time is at most latencyBound times the
+         *  fastest time is returned first.
+         *
+         *  @param[in]
+         *  latencyBound  Allowed slowdown, at least 1, or 0 to pick the fastest entry,
+         *  default is 0.
+         */
+        HIPBLASLT_EXPORT void setEnergyLatencyBound(float latencyBound);
+
+        /*! \ingroup library_module
+         *  \brief This function returns the latency bound of the energy-efficient pick.
+         */
+        HIPBLASLT_EXPORT float getEnergyLatencyBound() const;
+
     private:
         friend GemmInstance;
         class GemmPreferenceImpl;
@@ -248,11 +357,37 @@ namespace hipblaslt_ext
         std::unique_ptr<GemmEpilogueImpl> pimpl;
     };
 
+    /*! \ingroup types_module
+     *  \brief hipblasLt extension Epilogue for gemm problems, by value.
+     *
+     * \details The fields of GemmEpilogueV2 in a trivially copyable structure, so that a vector
+     * of them for the groups of a GroupedGemm is built without a heap allocation per group.
+     */
+    struct GemmEpilogueV2Data
+    {
+        hipblasLtEpilogue_t mode
+            = HIPBLASLT_EPILOGUE_DEFAULT; //!< The mode of epilogue. Default is gemm.
+        hipDataType bias_data_type
+            = HIPBLASLT_DATATYPE_INVALID; //!< The bias datatype. Only works if mode is set to bias related epilogues.
+        int aux_ld
+            = 0; //!< The aux leading dimension. Only works if mode is set to aux related epilogues.
+        int aux_stride
+            = 0; //!< The aux batch stride. Only works if mode is set to aux related epilogues.
+        int scaling_a_type
+            = 0; //!< 0 is scalar, 1 is vector. Only works if DataTypeA = DataTypeB = FP8.
+        int scaling_b_type
+            = 0; //!< 0 is scalar, 1 is vector. Only works if DataTypeA = DataTypeB = FP8.
+    };
+
     struct GemmTuning
     {
         uint8_t splitK = 0; //!< Value of splitK, 0 is off (use the splitK inside the solution).
         uint8_t wgm
             = 0; //!< Value of workgroup mapping, 0 is off (use the workgroup mapping inside the solution).
+        uint8_t streamK
+            = 0; //!< StreamK mode the solution must use (1 basic, 2 two-tile), 0 is off (any solution).
+        float skGridFraction
+            = 0.0f; //!< StreamK grid size as a fraction of the CUs, 0 is off (use the solution's grid).
     };
 
     struct GemmTuningV2
@@ -274,8 +409,17 @@ namespace hipblaslt_ext
             int16_t
                 wgm); //!< Set the value of workgroup mapping, 0 is off (use the workgroup mapping inside the solution).
 
+        HIPBLASLT_EXPORT void setStreamK(
+            uint8_t
+                streamK); //!< Set the StreamK mode the solution must use (1 basic, 2 two-tile), 0 is off (any solution).
+        HIPBLASLT_EXPORT void setSKGridFraction(
+            float
+                skGridFraction); //!< Set the StreamK grid size as a fraction of the CUs, 0 is off (use the solution's grid).
+
         HIPBLASLT_EXPORT uint16_t getSplitK() const; //!< Value of splitK.
         HIPBLASLT_EXPORT int16_t  getWgm() const; //!< Value of workgroup mapping.
+        HIPBLASLT_EXPORT uint8_t  getStreamK() const; //!< Value of StreamK mode.
+        HIPBLASLT_EXPORT float    getSKGridFraction() const; //!< Value of StreamK grid fraction.
     private:
         friend GemmInstance;
         class GemmTuningImpl;
@@ -359,17 +503,51 @@ namespace hipblaslt_ext
         HIPBLASLT_EXPORT const void* getAmaxD() const; //!< The AmaxD input pointer
 
     private:
+        friend GemmInstance;
         friend Gemm;
         friend GroupedGemm;
         class GemmInputsImpl;
         std::unique_ptr<GemmInputsImpl> pimpl;
     };
 
+    /*! \ingroup types_module
+     *  \brief hipblasLt extension Inputs for gemm problems, by value.
+     *
+     * \details The pointers of GemmInputsV2 in a trivially copyable structure, see
+     * GemmEpilogueV2Data.
+     */
+    struct GemmInputsV2Data
+    {
+        const void* a     = nullptr; //!< The a matrix input pointer.
+        const void* b     = nullptr; //!< The b matrix input pointer.
+        const void* c     = nullptr; //!< The c matrix input pointer.
+        const void* d     = nullptr; //!< The d matrix input pointer.
+        const void* alpha = nullptr; //!< The alpha value.
+        const void* beta  = nullptr; //!< The beta value.
+        // Epilogue inputs
+        const void* bias          = nullptr; //!< The bias input pointer.
+        const void* scaleA        = nullptr; //!< The Scale A input pointer.
+        const void* scaleB        = nullptr; //!< The Scale B input pointer.
+        const void* scaleC        = nullptr; //!< The Scale C input pointer.
+        const void* scaleD        = nullptr; //!< The Scale D input pointer.
+        const void* scaleAux      = nullptr; //!< The Scale AUX input pointer.
+        const void* scaleAlphaVec = nullptr; //!< The scaleAlpha vector input pointer.
+        const void* aux           = nullptr; //!< The aux input pointer.
+        const void* amaxD         = nullptr; //!< The AmaxD input pointer.
+    };
+
     /*! \ingroup types_module
      *  \brief hipblasLt extension GPU inputs for gemm problems.
      *
      * \details This structure sets the input gpu pointers of a gemm problem.
      * Only supports solutions loading arguments from global memory.
+     *
+     * In a grouped gemm, \p bias, \p scaleA, \p scaleB and \p activationType are read
+     * per group. When the epilogues given to GroupedGemm::setProblem() differ between
+     * groups, groups without bias get a zero bias, groups without scaleA/B get unit
+     * scales and every group keeps its own activation type, so one launch covers them
+     * all. The groups must still agree on the aux output, the gradient and the bias
+     * datatype and source.
      */
 
     struct UserArguments
@@ -411,6 +589,82 @@ namespace hipblaslt_ext
         int   activationType; //!< The activation type.  Only works if mode is set to activation related epilogues.
     } __attribute__((packed));
 
+    /*! \ingroup types_module
+     *  \brief Options of GroupedGemm::run(const FanOutOptions&, hipStream_t).
+     *
+     * \details Groups are sorted by their work m * n * k * batch_count, and a new size
+     * class starts at the first group whose work is \p classRatio times smaller than
+     * the first group of the current class, up to \p maxClasses classes.
+     */
+    struct FanOutOptions
+    {
+        uint32_t maxClasses     = 4; //!< The largest number of size classes.
+        double   classRatio     = 16; //!< The work ratio that starts a new class.
+        void*    workspace      = nullptr; //!< GPU workspace, split evenly between the classes.
+        size_t   workspaceBytes = 0; //!< The size of \p workspace in bytes.
+    };
+
+    /*! \ingroup types_module
+     *  \brief Per-group part of the compact DeviceUserArguments encoding.
+     *
+     * \details Holds the fields of UserArguments that usually differ between groups.
+     * Everything else (alpha, beta, the scale pointers, the bias type and the activation)
+     * is stored once in a shared UserArguments header, see
+     * GroupedGemm::getDefaultValueForCompactUserArguments().
+     */
+    struct CompactGroupArguments
+    {
+        uint32_t m; //!< size m
+        uint32_t n; //!< size n
+        uint32_t batch; //!< size batch
+        uint32_t k; //!< size k
+        void*    d; //!< The d matrix input pointer.
+        void*    c; //!< The c matrix input pointer.
+        void*    a; //!< The a matrix input pointer.
+        void*    b; //!< The b matrix input pointer.
+        void*    bias; //!< The bias input pointer.
+        void*    e; //!< The aux input pointer.
+        uint32_t strideD1; //!< The d leading dimension.
+        uint32_t strideD2; //!< The d batch stride
+        uint32_t strideC1; //!< The c leading dimension.
+        uint32_t strideC2; //!< The c batch stride
+        uint32_t strideA1; //!< The a leading dimension.
+        uint32_t strideA2; //!< The a batch stride
+        uint32_t strideB1; //!< The b leading dimension.
+        uint32_t strideB2; //!< The b batch stride
+        uint32_t strideE1; //!< The aux leading dimension.
+        uint32_t strideE2; //!< The aux batch stride.
+    };
+
+    /*! \ingroup types_module
+     *  \brief Per-group sizes and offsets resident in GPU memory.
+     *
+     * \details Used by GroupedGemm::run(void*, const DeviceGroupSizes&, hipStream_t) to
+     * patch the DeviceUserArguments on the device, for example with the expert token
+     * counts produced by a MoE router kernel. Every array holds one value per group. At
+     * least one of \p m, \p n and \p k is required, a null array leaves the
+     * corresponding field unchanged. The launch grid is sized from the problems passed to
+     * setProblem(), so those must bound the m and n written here. Groups with an m or n
+     * of 0 compute no tiles.
+     *
+     * A per-group \p k, as in the MoE weight gradient dW = X^T * dY where k is the token
+     * count of each expert, is read by each workgroup when it walks the k loop. Split-K
+     * solutions divide the k of their own group, so the reduction stays correct for
+     * heterogeneous k, and the workspace they need only depends on m and n.
+     */
+    struct DeviceGroupSizes
+    {
+        const int64_t* m       = nullptr; //!< The size m of each group.
+        const int64_t* n       = nullptr; //!< The size n of each group.
+        const int64_t* k       = nullptr; //!< The size k of each group.
+        const int64_t* offsetA = nullptr; //!< Byte offset of each group's a from \p baseA.
+        const int64_t* offsetB = nullptr; //!< Byte offset of each group's b from \p baseB.
+        const int64_t* offsetD = nullptr; //!< Byte offset of each group's d from \p baseD.
+        const void*    baseA   = nullptr; //!< The pointer \p offsetA is applied to.
+        const void*    baseB   = nullptr; //!< The pointer \p offsetB is applied to.
+        void*          baseD   = nullptr; //!< The pointer \p offsetD is applied to.
+    };
+
     /*! \ingroup types_module
      *  \brief hipblasLt extension instance for gemm problems.
      */
@@ -480,6 +734,54 @@ namespace hipblaslt_ext
                              const GemmPreferenceV2&                        pref,
                              std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults);
 
+        /*! \ingroup library_module
+        *  \brief Retrieve the possible algorithms on a background thread
+        *
+        *  \details
+        *  This function runs algoGetHeuristic() with the problem currently set on a
+        * background thread, on the HIP device that is current when it is called, so
+        * that the first query of a shape, which may load the library, overlaps other
+        * work. The instance must not be changed, run or destroyed, and heuristicResults
+        * must not be accessed, until the returned future is ready.
+        *
+        *  @param[in]
+        *  requestedAlgoCount  number of requested algorithms.
+        *  @param[in]
+        *  pref hipblasLt extension preference for gemm problems, copied by the call.
+        *  @param[out]
+        *  heuristicResults    The algorithm heuristic vector, filled when the future is ready.
+        *
+        *  \retval std::future  The status algoGetHeuristic() returns for the query.
+        */
+        HIPBLASLT_EXPORT
+        std::future<hipblasStatus_t>
+            algoGetHeuristicAsync(const int                                      requestedAlgoCount,
+                                  const GemmPreferenceV2&                        pref,
+                                  std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults);
+
+        /*! \ingroup library_module
+        *  \brief Retrieve the tradeoff between workspace and predicted time
+        *
+        *  \details
+        *  This function returns the algorithms of the problem currently set that are on the
+        * Pareto frontier of the required workspace and the predicted time: each one needs
+        * more workspace than the one before it and is predicted to be faster. The
+        * workspaceSize of a result is its required workspace, which is also the
+        * max_workspace_bytes of its algo, and predictedSpeedup is relative to the first
+        * result when it needs no workspace. Frameworks can size their workspace pools from
+        * the point past which more workspace no longer pays off. Only GEMM is supported.
+        *
+        *  @param[out]
+        *  frontier    The frontier, by increasing workspace.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If query was successful.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If no problem is set.
+        *  \retval HIPBLAS_STATUS_NOT_SUPPORTED     If the instance is a grouped gemm.
+        */
+        HIPBLASLT_EXPORT
+        hipblasStatus_t
+            getWorkspaceFrontier(std::vector<hipblasLtMatmulHeuristicResult_t>& frontier);
+
         /*! \ingroup library_module
         *  \brief Check if the algorithm supports the problem. (For hipblaslt extension API)
         *
@@ -669,6 +971,104 @@ namespace hipblaslt_ext
         hipblasStatus_t
             run(hipStream_t stream, hipEvent_t start = nullptr, hipEvent_t stop = nullptr);
 
+        /*! \ingroup library_module
+        *  \brief Execute the stored kernels with new pointers.
+        *
+        *  \details
+        *  Patches the pointers of the stored kernel arguments in place and launches them,
+        * without building the problem or the kernel arguments again. The pointers of
+        * \p inputs replace those of the problem as in updateGraphNode(), alpha and beta keep
+        * the values given to setProblem(), and the instance keeps the new pointers. The
+        * kernel arguments are copied at launch, so the next call may follow right away.
+        *
+        *  @param[in]
+        *  inputs                  The new pointers.
+        *  @param[in]
+        *  stream                  The HIP stream where all the GPU work will be submitted.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the kernels are launched.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If the instance is not initialized.
+        *  \retval HIPBLAS_STATUS_NOT_SUPPORTED     If the instance is a grouped gemm.
+        */
+        HIPBLASLT_EXPORT
+        hipblasStatus_t run(const GemmInputsV2& inputs, hipStream_t stream);
+
+        /*! \ingroup library_module
+        *  \brief Add the kernels of the hipblaslt_ext::GemmInstance to a graph as one node.
+        *
+        *  \details
+        *  Builds the node from the kernel arguments made by initialize(), without stream
+        * capture, so nothing is allocated or copied on the host side. The node is a kernel
+        * node when the solution runs a single kernel, and a child graph node of the
+        * kernels in order otherwise. Only Gemm is supported; capture run() of a GroupedGemm
+        * with device arguments instead.
+        *
+        *  @param[in]
+        *  graph                   The graph the node is added to.
+        *  @param[in]
+        *  dependencies            The nodes the new node runs after.
+        *  @param[out]
+        *  node                    The new node.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the node is added.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If the instance is not initialized.
+        *  \retval HIPBLAS_STATUS_NOT_SUPPORTED     If the instance is a grouped gemm.
+        */
+        HIPBLASLT_EXPORT
+        hipblasStatus_t createGraphNode(hipGraph_t                         graph,
+                                        const std::vector<hipGraphNode_t>& dependencies,
+                                        hipGraphNode_t&                    node);
+
+        /*! \ingroup library_module
+        *  \brief Point a node of createGraphNode() in an instantiated graph to new inputs.
+        *
+        *  \details
+        *  Patches the pointers of the kernel arguments in place and sets them on \p node
+        * of \p exec, so the graph is not rebuilt or instantiated again. The a, b, c and d
+        * pointers of \p inputs always replace those of the problem; its bias, scale and
+        * amax pointers replace those the problem was set up with and are ignored otherwise.
+        * alpha and beta keep the values given to setProblem(). The instance keeps the new
+        * pointers, so run() uses them too.
+        *
+        *  @param[in]
+        *  exec                    The instantiated graph.
+        *  @param[in]
+        *  node                    The node returned by createGraphNode().
+        *  @param[in]
+        *  inputs                  The new pointers.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the node is updated.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If the instance is not initialized.
+        *  \retval HIPBLAS_STATUS_NOT_SUPPORTED     If the instance is a grouped gemm.
+        */
+        HIPBLASLT_EXPORT
+        hipblasStatus_t
+            updateGraphNode(hipGraphExec_t exec, hipGraphNode_t node, GemmInputsV2& inputs);
+
+        /*! \ingroup library_module
+        *  \brief Execute the kernel arguments of several instances with one call.
+        *
+        *  \details
+        *  Checks every instance first and then launches their kernels back to back on
+        * \p stream, in order, with one library lookup for the whole batch. This saves the
+        * per call overhead of run() when a layer runs dozens of small gemms. Every instance
+        * must be initialized on the same device; a GroupedGemm must have been initialized
+        * with useUserArgs set to false, as for run().
+        *
+        *  @param[in]
+        *  instances               The instances to run, in order.
+        *  @param[in]
+        *  stream                  The HIP stream where all the GPU work will be submitted.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If an instance is null, not initialized,
+        * or on another device than the first one. Nothing is launched then.
+        */
+        HIPBLASLT_EXPORT
+        static hipblasStatus_t runBatch(const std::vector<GemmInstance*>& instances,
+                                        hipStream_t                       stream);
+
         HIPBLASLT_EXPORT GemmType getGemmType();
         HIPBLASLT_EXPORT size_t   getGemmCount();
 
@@ -984,6 +1384,113 @@ namespace hipblaslt_ext
         HIPBLASLT_EXPORT GemmProblemTypeV2 getProblemTypesV2();
     };
 
+    /*! \ingroup types_module
+     *  \brief The hipDataType of a C++ element type, see TypedGemm.
+     *
+     * \details Only the element types of the library are defined, so a TypedGemm of any other
+     * type does not compile.
+     */
+    template <typename T>
+    struct GemmDataType;
+
+    template <hipDataType Type>
+    struct GemmTypeConstant
+    {
+        static constexpr hipDataType value = Type;
+    };
+
+    // clang-format off
+    template <> struct GemmDataType<float> : GemmTypeConstant<HIP_R_32F> {};
+    template <> struct GemmDataType<double> : GemmTypeConstant<HIP_R_64F> {};
+    template <> struct GemmDataType<hipblasLtHalf> : GemmTypeConstant<HIP_R_16F> {};
+    template <> struct GemmDataType<hip_bfloat16> : GemmTypeConstant<HIP_R_16BF> {};
+    template <> struct GemmDataType<int8_t> : GemmTypeConstant<HIP_R_8I> {};
+    template <> struct GemmDataType<int32_t> : GemmTypeConstant<HIP_R_32I> {};
+    template <> struct GemmDataType<hipblaslt_f8_fnuz> : GemmTypeConstant<HIP_R_8F_E4M3_FNUZ> {};
+    template <> struct GemmDataType<hipblaslt_bf8_fnuz> : GemmTypeConstant<HIP_R_8F_E5M2_FNUZ> {};
+#ifdef ROCM_USE_FLOAT8
+    template <> struct GemmDataType<hipblaslt_f8> : GemmTypeConstant<HIP_R_8F_E4M3> {};
+    template <> struct GemmDataType<hipblaslt_bf8> : GemmTypeConstant<HIP_R_8F_E5M2> {};
+#endif
+    // clang-format on
+
+    /*! \ingroup types_module
+     *  \brief hipblasLt extension instance for a gemm of element types known at compile time.
+     *
+     * \details A Gemm of A of type TiA, B of type TiB, C and D of type To, accumulated in Tc
+     * (float, double or int32_t), with the epilogue mode Epilogue. The types and the
+     * combinations the library rejects for every problem, such as an int32_t accumulator
+     * without int8_t inputs or a gated epilogue, are resolved at compile time. The sizes and
+     * pointers are still checked by setProblem().
+     */
+    template <typename TiA,
+              typename TiB,
+              typename To,
+              typename Tc                  = float,
+              hipblasLtEpilogue_t Epilogue = HIPBLASLT_EPILOGUE_DEFAULT>
+    class TypedGemm : public Gemm
+    {
+        static_assert(std::is_same<Tc, float>::value || std::is_same<Tc, double>::value
+                          || std::is_same<Tc, int32_t>::value,
+                      "The accumulator of a TypedGemm is float, double or int32_t");
+        static_assert(!std::is_same<Tc, int32_t>::value
+                          || (std::is_same<TiA, int8_t>::value && std::is_same<TiB, int8_t>::value
+                              && (std::is_same<To, int32_t>::value
+                                  || std::is_same<To, int8_t>::value)),
+                      "An int32_t accumulator takes int8_t A and B and an int8_t or int32_t D");
+        static_assert(!std::is_same<Tc, double>::value
+                          || (std::is_same<TiA, double>::value && std::is_same<TiB, double>::value
+                              && std::is_same<To, double>::value),
+                      "A double accumulator takes double A, B and D");
+        static_assert(Epilogue != HIPBLASLT_EPILOGUE_SWIGLU
+                          && Epilogue != HIPBLASLT_EPILOGUE_SWIGLU_BIAS
+                          && Epilogue != HIPBLASLT_EPILOGUE_GEGLU
+                          && Epilogue != HIPBLASLT_EPILOGUE_GEGLU_BIAS,
+                      "Gated epilogues are only supported by hipblasLtMatmul");
+
+    public:
+        static constexpr hipDataType typeA = GemmDataType<TiA>::value;
+        static constexpr hipDataType typeB = GemmDataType<TiB>::value;
+        static constexpr hipDataType typeD = GemmDataType<To>::value;
+        static constexpr hipblasComputeType_t typeCompute
+            = std::is_same<Tc, double>::value    ? HIPBLAS_COMPUTE_64F
+              : std::is_same<Tc, int32_t>::value ? HIPBLAS_COMPUTE_32I
+                                                 : HIPBLAS_COMPUTE_32F;
+
+        explicit TypedGemm(hipblasLtHandle_t handle, hipblasOperation_t opA, hipblasOperation_t opB)
+            : Gemm(handle, opA, opB, typeA, typeB, typeD, typeD, typeCompute)
+        {
+            m_epilogue.setMode(Epilogue);
+        }
+
+        using Gemm::setProblem;
+
+        /*! \ingroup library_module
+        *  \brief Sets the problem with the epilogue mode of the type.
+        *
+        *  @param[in]
+        *  m,n,k                      The problem size.
+        *  @param[in]
+        *  batch_count                The batch count.
+        *  @param[in]
+        *  inputs                     The inputs of the problem.
+        */
+        hipblasStatus_t
+            setProblem(int64_t m, int64_t n, int64_t k, int64_t batch_count, GemmInputsV2& inputs)
+        {
+            return Gemm::setProblem(m, n, k, batch_count, m_epilogue, inputs);
+        }
+
+        //! The epilogue of setProblem() without one, to set its bias type or aux dimensions.
+        GemmEpilogueV2& epilogue()
+        {
+            return m_epilogue;
+        }
+
+    private:
+        GemmEpilogueV2 m_epilogue;
+    };
+
     /*! \ingroup types_module
      *  \brief hipblasLt extension instance for grouped gemm.
      *
@@ -1231,33 +1738,100 @@ namespace hipblaslt_ext
                                                     GemmProblemTypeV2&           problemtype);
 
         /*! \ingroup library_module
-        *  \brief Sets the grouped gemm problem from hipblasLt structures
+        *  \brief Sets the problem for a gemm problem from structures by value.
         *
         *  \details
-        *  This function sets the problem from hipblasLt structures. For more information
-        * about the structures, see hipblasLtMatmul for more information.
+        *  The same as setProblem() with GemmEpilogueV2 and GemmInputsV2, for callers that
+        * rebuild the epilogues and inputs of many groups every step. The vectors are passed
+        * to the library as they are, without a conversion per group. Groups past the end of
+        * \p epilogue use its last element.
         *
         *  @param[in]
-        *  matmul_descr              Vectors of handle to a previously created matrix
-        * multiplication descriptor of type \ref hipblasLtMatmulDesc_t .
+        *  m,n,k                            The problem size in vector.
         *  @param[in]
-        *  alpha,beta              Vectors of float used in the multiplication.
+        *  batch_count                      The batch count in vector.
         *  @param[in]
-        *  matA,matB,matC,matD Vectors of handle to the previously created matrix
-        * layout descriptors of the type \ref hipblasLtMatrixLayout_t .
+        *  lda,ldb,ldc,ldd                  The leading dimensions in vector of the matrix.
         *  @param[in]
-        *  A,B,C                   Vectors of pointer to the GPU memory associated
-        * with the corresponding descriptors \p matA, \p matB and \p matC .
-        *  @param[out]
-        *  D                       Vector of pointer to the GPU memory associated with
-        * the descriptor \p matD .
+        *  strideA,strideB,strideC,strideD  The batch stride in vector of the matrix.
+        *  @param[in]
+        *  epilogue                         The structure in vector that controls the epilogue.
+        *  @param[in]
+        *  inputs                           The inputs in vector of the problem.
+        *  @param[in]
+        *  problemtype                      The structure that sets the problem type
+        * of a gemm problem.
         *
         *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
-        * successfully. \retval HIPBLAS_STATUS_EXECUTION_FAILED  If HIP reported an
-        * execution error from the device. \retval HIPBLAS_STATUS_ARCH_MISMATCH     If
-        * the configured operation cannot be run using the selected device. \retval
-        * HIPBLAS_STATUS_NOT_SUPPORTED     If the current implementation on the
-        * selected device doesn't support the configured operation. \retval
+        * successfully. \retval HIPBLAS_STATUS_NOT_SUPPORTED     If the current
+        * implementation on the selected device doesn't support the configured operation.
+        * \retval HIPBLAS_STATUS_INVALID_VALUE     If the parameters are unexpectedly NULL, in
+        * conflict or in an impossible configuration.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t setProblem(std::vector<int64_t>&            m,
+                                                    std::vector<int64_t>&            n,
+                                                    std::vector<int64_t>&            k,
+                                                    std::vector<int64_t>&            batch_count,
+                                                    std::vector<int64_t>&            lda,
+                                                    std::vector<int64_t>&            ldb,
+                                                    std::vector<int64_t>&            ldc,
+                                                    std::vector<int64_t>&            ldd,
+                                                    std::vector<int64_t>&            strideA,
+                                                    std::vector<int64_t>&            strideB,
+                                                    std::vector<int64_t>&            strideC,
+                                                    std::vector<int64_t>&            strideD,
+                                                    std::vector<GemmEpilogueV2Data>& epilogue,
+                                                    std::vector<GemmInputsV2Data>&   inputs,
+                                                    GemmProblemTypeV2&               problemtype);
+
+        /*! \ingroup library_module
+        *  \brief Declare an operand that all groups share
+        *
+        *  \details
+        *  Applies to the following setProblem() calls with GemmInputsV2. With
+        * SharedOperand::A (B), only the a (b) pointer of the first group is used and
+        * every group must have the same size, leading dimension, batch stride and batch
+        * count for that operand, as in LoRA adapters or multi-head projections of
+        * one activation. The groups of the launch then read a single copy of the
+        * operand, so its tiles can be served from L2 to adjacent groups. The pointer is
+        * also replicated into every group of getDefaultValueForDeviceUserArguments().
+        *
+        *  @param[in]
+        *  operand                 The shared operand, SharedOperand::NONE to turn it off.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t setSharedOperand(SharedOperand operand);
+
+        /*! \ingroup library_module
+        *  \brief Sets the grouped gemm problem from hipblasLt structures
+        *
+        *  \details
+        *  This function sets the problem from hipblasLt structures. For more information
+        * about the structures, see hipblasLtMatmul for more information.
+        *
+        *  @param[in]
+        *  matmul_descr              Vectors of handle to a previously created matrix
+        * multiplication descriptor of type \ref hipblasLtMatmulDesc_t .
+        *  @param[in]
+        *  alpha,beta              Vectors of float used in the multiplication.
+        *  @param[in]
+        *  matA,matB,matC,matD Vectors of handle to the previously created matrix
+        * layout descriptors of the type \ref hipblasLtMatrixLayout_t .
+        *  @param[in]
+        *  A,B,C                   Vectors of pointer to the GPU memory associated
+        * with the corresponding descriptors \p matA, \p matB and \p matC .
+        *  @param[out]
+        *  D                       Vector of pointer to the GPU memory associated with
+        * the descriptor \p matD .
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully. \retval HIPBLAS_STATUS_EXECUTION_FAILED  If HIP reported an
+        * execution error from the device. \retval HIPBLAS_STATUS_ARCH_MISMATCH     If
+        * the configured operation cannot be run using the selected device. \retval
+        * HIPBLAS_STATUS_NOT_SUPPORTED     If the current implementation on the
+        * selected device doesn't support the configured operation. \retval
         * HIPBLAS_STATUS_INVALID_VALUE     If the parameters are unexpectedly NULL, in
         * conflict or in an impossible configuration.
         *  \retval HIBLAS_STATUS_NOT_INITIALIZED    If hipBLASLt handle has not been
@@ -1292,6 +1866,23 @@ namespace hipblaslt_ext
         HIPBLASLT_EXPORT hipblasStatus_t
             getDefaultValueForDeviceUserArguments(void* hostDeviceUserArgs);
 
+        /*! \ingroup library_module
+        *  \brief A helper function to initialize the compact DeviceUserArguments encoding
+        * using the set problem(s) saved in the gemm object.
+        *
+        *  @param[out]
+        *  sharedArgs              The fields that are the same for all groups. Group
+        * specific fields of the header are zero.
+        *  @param[out]
+        *  hostGroupArgs           Host array of one CompactGroupArguments per group.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If the gemm_count = 0, or
+        * \p hostGroupArgs is NULL, or the groups differ in a field of the shared header.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t getDefaultValueForCompactUserArguments(
+            UserArguments& sharedArgs, CompactGroupArguments* hostGroupArgs);
+
         using GemmInstance::run;
 
         /*! \ingroup library_module
@@ -1308,12 +1899,568 @@ namespace hipblaslt_ext
         * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If the gemm_count = 0.
         */
         HIPBLASLT_EXPORT hipblasStatus_t run(void* deviceUserArgs, hipStream_t stream);
+
+        /*! \ingroup library_module
+        *  \brief Run the kernel using DeviceUserArguments patched with device sizes
+        *
+        *  \details
+        *  Before the launch, a kernel on \p stream writes the sizes and offsets of
+        * \p sizes into \p deviceUserArgs. The sizes never travel through the host, so
+        * the call does not wait for the kernel that produced them. When a group's c
+        * and d are the same buffer, c follows the new d.
+        *
+        *  @param[in]
+        *  deviceUserArgs          Pointer to the DeviceUserArguments buffer allocated
+        * in the GPU memory, initialized from getDefaultValueForDeviceUserArguments().
+        *  @param[in]
+        *  sizes                   The per-group device arrays, see DeviceGroupSizes.
+        *  @param[in]
+        *  stream                  The HIP stream where all the GPU work will be
+        * submitted.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If the gemm_count = 0, or
+        * \p sizes.m, \p sizes.n and \p sizes.k are all NULL, or an offset array is set
+        * without its base pointer.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t run(void*                   deviceUserArgs,
+                                             const DeviceGroupSizes& sizes,
+                                             hipStream_t             stream);
+
+        /*! \ingroup library_module
+        *  \brief Run the kernel using the compact DeviceUserArguments encoding
+        *
+        *  \details
+        *  A kernel on \p stream decodes \p sharedArgs and \p deviceGroupArgs into
+        * \p deviceUserArgs before the launch. The per-group records are roughly half the
+        * size of UserArguments, so producing or uploading them for hundreds of groups
+        * moves less data, and the shared header travels as a kernel argument.
+        *
+        *  @param[in]
+        *  deviceUserArgs          Pointer to a GPU buffer of gemm_count UserArguments that
+        * receives the decoded arguments. Its previous content is not read.
+        *  @param[in]
+        *  sharedArgs              The fields shared by all groups, for example from
+        * getDefaultValueForCompactUserArguments().
+        *  @param[in]
+        *  deviceGroupArgs         Pointer to gemm_count CompactGroupArguments in GPU
+        * memory.
+        *  @param[in]
+        *  stream                  The HIP stream where all the GPU work will be
+        * submitted.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If the gemm_count = 0 or a
+        * pointer is NULL.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t run(void*                        deviceUserArgs,
+                                             const UserArguments&         sharedArgs,
+                                             const CompactGroupArguments* deviceGroupArgs,
+                                             hipStream_t                  stream);
+
+        /*! \ingroup library_module
+        *  \brief Upload host DeviceUserArguments and run the kernel with them
+        *
+        *  \details
+        *  The arguments are copied into one of a small ring of pinned host and device
+        * slots owned by the instance and uploaded with hipMemcpyAsync on \p stream. A
+        * slot is reused once the kernels that read it have completed, so repeated calls
+        * pipeline the upload with the previous launch and the host buffer can be
+        * rewritten as soon as this function returns.
+        *
+        *  @param[in]
+        *  hostDeviceUserArgs      Pointer to the DeviceUserArguments in host memory, for
+        * example filled by getDefaultValueForDeviceUserArguments().
+        *  @param[in]
+        *  stream                  The HIP stream where all the GPU work will be
+        * submitted.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If the gemm_count = 0 or
+        * hostDeviceUserArgs is NULL.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t runWithHostUserArgs(const void* hostDeviceUserArgs,
+                                                             hipStream_t stream);
+
+        /*! \ingroup library_module
+        *  \brief Run the groups split into size classes on forked streams
+        *
+        *  \details
+        *  A single grouped launch runs every group with one solution and macro tile.
+        * This function partitions the groups of the last setProblem() with
+        * GemmInputsV2 into size classes, see FanOutOptions. Each class is a grouped gemm
+        * with its own best heuristic solution and its share of the workspace. The first
+        * class runs on \p stream, the others on internal streams that fork from and join
+        * back into \p stream with events, so the call is ordered like run(). The classes
+        * and their solutions are kept until the problem or the options change. It does
+        * not use the algorithm of initialize().
+        *
+        *  @param[in]
+        *  options                 The partitioning and the workspace of the classes.
+        *  @param[in]
+        *  stream                  The HIP stream where all the GPU work will be
+        * submitted.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+        * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If the gemm_count = 0 or
+        * \p options.maxClasses is 0. \retval HIPBLAS_STATUS_NOT_SUPPORTED If the problem
+        * was not set with GemmInputsV2 or a class has no solution.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t run(const FanOutOptions& options, hipStream_t stream);
+
+    private:
+        SharedOperand         m_shared_operand = SharedOperand::NONE;
+        std::shared_ptr<void> m_fan_out; // Problem and size classes of run(FanOutOptions)
     };
 
     /*******************************************************************************
      * Ext APIs
      ******************************************************************************/
 
+    //! Largest m, n and k accepted by batchedTinyGemm().
+    constexpr uint32_t TinyGemmMaxSize = 64;
+
+    /*! \ingroup types_module
+     *  \brief Arguments of one problem of batchedTinyGemm().
+     *
+     * \details Matrices are column major, \p d = \p alpha * op(\p a) * op(\p b) + \p beta *
+     * \p c. \p c is not read when \p beta is 0.
+     */
+    struct TinyGemmArguments
+    {
+        uint32_t    m; //!< size m
+        uint32_t    n; //!< size n
+        uint32_t    k; //!< size k
+        uint32_t    lda; //!< The a leading dimension.
+        uint32_t    ldb; //!< The b leading dimension.
+        uint32_t    ldc; //!< The c leading dimension.
+        uint32_t    ldd; //!< The d leading dimension.
+        float       alpha; //!< The alpha value.
+        float       beta; //!< The beta value.
+        const void* a; //!< The a matrix input pointer.
+        const void* b; //!< The b matrix input pointer.
+        const void* c; //!< The c matrix input pointer.
+        void*       d; //!< The d matrix output pointer.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Run many independent small gemms in one launch
+     *
+     *  \details
+     *  Each workgroup takes a run of consecutive problems and spreads their output
+     * elements over its threads, so one wavefront may compute several tiny problems.
+     * There is no padding to a macro tile and no per-problem kernel argument record
+     * beyond \p TinyGemmArguments. Use GroupedGemm for problems above
+     * \p TinyGemmMaxSize.
+     *
+     *  @param[in]
+     *  handle                  Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  opA, opB                Transpose setting of a and b, shared by all problems.
+     *  @param[in]
+     *  typeAB                  Datatype of a and b, HIP_R_16F, HIP_R_16BF or HIP_R_32F.
+     *  @param[in]
+     *  typeCD                  Datatype of c and d, either \p typeAB or HIP_R_32F.
+     *  @param[in]
+     *  deviceArgs              Pointer to \p count TinyGemmArguments in GPU memory.
+     *  @param[in]
+     *  count                   The number of problems.
+     *  @param[in]
+     *  stream                  The HIP stream where all the GPU work will be
+     * submitted.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+     * successfully. \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is NULL.
+     * \retval HIPBLAS_STATUS_INVALID_VALUE If \p deviceArgs is NULL while \p count is not
+     * 0. \retval HIPBLAS_STATUS_NOT_SUPPORTED If the datatypes are not supported.
+     */
+    HIPBLASLT_EXPORT hipblasStatus_t batchedTinyGemm(hipblasLtHandle_t        handle,
+                                                     hipblasOperation_t       opA,
+                                                     hipblasOperation_t       opB,
+                                                     hipDataType              typeAB,
+                                                     hipDataType              typeCD,
+                                                     const TinyGemmArguments* deviceArgs,
+                                                     uint32_t                 count,
+                                                     hipStream_t              stream);
+
+    //! Largest hidden size accepted by fusedMlpGemm().
+    constexpr uint32_t FusedMlpMaxHidden = 256;
+
+    /*! \ingroup types_module
+     *  \brief Arguments of fusedMlpGemm().
+     *
+     * \details Matrices are column major, \p y = epilogue2(epilogue1(\p x * \p w1) * \p w2)
+     * with \p x of m x k, \p w1 of k x hidden, \p w2 of hidden x n and \p y of m x n.
+     * The epilogues are HIPBLASLT_EPILOGUE_DEFAULT, RELU, GELU, BIAS, RELU_BIAS or GELU_BIAS,
+     * the biases are vectors of hidden and n elements of the datatype of \p y and are only
+     * read by the epilogues with a bias.
+     */
+    struct FusedMlpArguments
+    {
+        uint32_t            m; //!< Rows of x and y.
+        uint32_t            k; //!< Columns of x and rows of w1.
+        uint32_t            hidden; //!< Columns of w1 and rows of w2.
+        uint32_t            n; //!< Columns of w2 and y.
+        uint32_t            ldx; //!< The x leading dimension.
+        uint32_t            ldw1; //!< The w1 leading dimension.
+        uint32_t            ldw2; //!< The w2 leading dimension.
+        uint32_t            ldy; //!< The y leading dimension.
+        hipblasLtEpilogue_t epilogue1; //!< The epilogue of x * w1.
+        hipblasLtEpilogue_t epilogue2; //!< The epilogue of the product with w2.
+        const void*         x; //!< The x matrix input pointer.
+        const void*         w1; //!< The w1 matrix input pointer.
+        const void*         bias1; //!< The bias of epilogue1.
+        const void*         w2; //!< The w2 matrix input pointer.
+        const void*         bias2; //!< The bias of epilogue2.
+        void*               y; //!< The y matrix output pointer.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Run the two gemms of a narrow MLP in one launch
+     *
+     *  \details
+     *  Each workgroup computes a tile of rows of the intermediate
+     * epilogue1(\p x * \p w1) into LDS and multiplies it by \p w2 right away, so the
+     * intermediate is never written to memory and both gemms share one launch. Use two
+     * matmuls for \p hidden above \p FusedMlpMaxHidden.
+     *
+     *  @param[in]
+     *  handle                  Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  args                    The problem, see FusedMlpArguments.
+     *  @param[in]
+     *  typeIn                  Datatype of x, w1 and w2, HIP_R_16F, HIP_R_16BF or HIP_R_32F.
+     *  @param[in]
+     *  typeOut                 Datatype of y and the biases, either \p typeIn or HIP_R_32F.
+     *  @param[in]
+     *  stream                  The HIP stream where all the GPU work will be
+     * submitted.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+     * successfully. \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is NULL.
+     * \retval HIPBLAS_STATUS_INVALID_VALUE If a pointer the problem reads is NULL or a
+     * leading dimension is too small. \retval HIPBLAS_STATUS_NOT_SUPPORTED If \p hidden is
+     * above \p FusedMlpMaxHidden, or an epilogue or the datatypes are not supported.
+     */
+    HIPBLASLT_EXPORT hipblasStatus_t fusedMlpGemm(hipblasLtHandle_t        handle,
+                                                  const FusedMlpArguments& args,
+                                                  hipDataType              typeIn,
+                                                  hipDataType              typeOut,
+                                                  hipStream_t              stream);
+
+    /*! \ingroup types_module
+     *  \brief The dimension of d that multiDeviceGemm() partitions.
+     */
+    enum class MultiDeviceSplit
+    {
+        M, //!< Each device computes a block of rows of d.
+        N, //!< Each device computes a block of columns of d.
+    };
+
+    /*! \ingroup types_module
+     *  \brief One device of multiDeviceGemm().
+     */
+    struct MultiDeviceShard
+    {
+        int               device         = 0; //!< The device that computes this block of d.
+        hipblasLtHandle_t handle         = nullptr; //!< A handle created on \p device.
+        hipStream_t       stream         = nullptr; //!< A stream of \p device.
+        void*             workspace      = nullptr; //!< GPU workspace on \p device.
+        size_t            workspaceBytes = 0; //!< The size of \p workspace in bytes.
+        hipEvent_t        done = nullptr; //!< If set, recorded on \p stream after the block.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Run one gemm split over the devices of a node
+     *
+     *  \details
+     *  Partitions d along \p split into one block per shard, in multiples of 256 rows or
+     * columns, and sets up a Gemm on each shard's handle with the part of a or b, c and d
+     * of its block. Each block runs the best heuristic solution of its device on the
+     * shard's stream, and the shard's event is recorded after it, so callers wait on the
+     * events to gather the result. A shard without rows or columns only records its
+     * event. The matrices, which may live on any one device, must be accessible from
+     * every shard's device, for example with hipDeviceEnablePeerAccess. The current
+     * device is restored on return.
+     *
+     *  The epilogue may be HIPBLASLT_EPILOGUE_DEFAULT, RELU, BIAS, RELU_BIAS, GELU or
+     * GELU_BIAS. Splitting along m needs the bias datatype set for a bias, and no alpha
+     * vector or vector scale of a; splitting along n needs no vector scale of b. The amax
+     * of d is not supported.
+     *
+     *  @param[in]
+     *  shards                  The devices, in the order of the blocks of d.
+     *  @param[in]
+     *  split                   The dimension of d that is partitioned.
+     *  @param[in]
+     *  m,n,k,batch_count       The problem of Gemm::setProblem() with GemmInputsV2.
+     *  @param[in]
+     *  lda,ldb,ldc,ldd         The leading dimensions of the matrices.
+     *  @param[in]
+     *  strideA,strideB,strideC,strideD The batch strides of the matrices.
+     *  @param[in]
+     *  epilogue,inputs,problemtype     The epilogue, pointers and types of the whole gemm.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+     * successfully. \retval HIPBLAS_STATUS_INVALID_VALUE If \p shards is empty or has a
+     * null handle. \retval HIPBLAS_STATUS_NOT_SUPPORTED If the epilogue or inputs cannot
+     * be split, or a block has no solution on its device.
+     */
+    HIPBLASLT_EXPORT hipblasStatus_t multiDeviceGemm(std::vector<MultiDeviceShard>& shards,
+                                                     MultiDeviceSplit               split,
+                                                     int64_t                        m,
+                                                     int64_t                        n,
+                                                     int64_t                        k,
+                                                     int64_t                        batch_count,
+                                                     int64_t                        lda,
+                                                     int64_t                        ldb,
+                                                     int64_t                        ldc,
+                                                     int64_t                        ldd,
+                                                     int64_t                        strideA,
+                                                     int64_t                        strideB,
+                                                     int64_t                        strideC,
+                                                     int64_t                        strideD,
+                                                     GemmEpilogueV2&                epilogue,
+                                                     GemmInputsV2&                  inputs,
+                                                     GemmProblemTypeV2&             problemtype);
+
+    /*! \ingroup library_module
+     *  \brief Run a gemm whose a and b are streamed from host memory along k
+     *
+     *  \details
+     *  For a k too large to keep a and b on the device, a and b stay in pinned host
+     * memory and are copied chunkK columns of op(a) and rows of op(b) at a time into
+     * device staging buffers allocated on \p stream. Each chunk is copied on one of
+     * \p copyStreams, in turn, while \p stream runs the partial gemm of the previous
+     * chunk: the first chunk reads c with the given beta, the later ones accumulate into
+     * d with a beta of 1, and the epilogue is applied with the last chunk only. The
+     * staging holds one more chunk than there are copy streams, so a single copy stream
+     * already double buffers. c, d and the bias are device memory, and c and d share a
+     * datatype. The partial sums are rounded to the datatype of d between chunks.
+     *
+     *  The epilogue may be HIPBLASLT_EPILOGUE_DEFAULT, RELU, BIAS, RELU_BIAS, GELU or
+     * GELU_BIAS, with no vector scales, scaleC, scaleD, aux or amax of d.
+     *
+     *  @param[in]
+     *  handle                  A handle of the current device.
+     *  @param[in]
+     *  m,n,k                   The problem of Gemm::setProblem() without batches.
+     *  @param[in]
+     *  lda,ldb,ldc,ldd         The leading dimensions of the matrices.
+     *  @param[in]
+     *  chunkK                  The size of k copied and multiplied at a time.
+     *  @param[in]
+     *  epilogue,inputs,problemtype     The epilogue, pointers and types of the whole gemm.
+     *  @param[in]
+     *  workspace,workspaceBytes        GPU workspace of the partial gemms.
+     *  @param[in]
+     *  stream                  The stream of the partial gemms.
+     *  @param[in]
+     *  copyStreams             The streams of the host to device copies.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+     * successfully. \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is NULL.
+     * \retval HIPBLAS_STATUS_INVALID_VALUE If a size or \p chunkK is not positive or
+     * \p copyStreams is empty. \retval HIPBLAS_STATUS_NOT_SUPPORTED If the epilogue or
+     * inputs cannot be streamed, or a chunk has no solution.
+     */
+    HIPBLASLT_EXPORT hipblasStatus_t hostStreamingGemm(hipblasLtHandle_t         handle,
+                                                       int64_t                   m,
+                                                       int64_t                   n,
+                                                       int64_t                   k,
+                                                       int64_t                   lda,
+                                                       int64_t                   ldb,
+                                                       int64_t                   ldc,
+                                                       int64_t                   ldd,
+                                                       int64_t                   chunkK,
+                                                       GemmEpilogueV2&           epilogue,
+                                                       GemmInputsV2&             inputs,
+                                                       GemmProblemTypeV2&        problemtype,
+                                                       void*                     workspace,
+                                                       size_t                    workspaceBytes,
+                                                       hipStream_t               stream,
+                                                       std::vector<hipStream_t>& copyStreams);
+
+    /*! \ingroup types_module
+     *  \brief The per-tensor scales of a and b of autoFp8Gemm().
+     *
+     * \details All pointers are device memory of one float. The scales are dequantization
+     * scales, amax / max(fp8 type), as used by HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER.
+     */
+    struct AutoFp8Scales
+    {
+        hipblasltExtFp8Scaling_t scaling
+            = HIPBLASLT_EXT_FP8_SCALING_CURRENT; //!< Compute the scales now or read them.
+        float* scaleA = nullptr; //!< The scale of a, written or read according to \p scaling.
+        float* scaleB = nullptr; //!< The scale of b, written or read according to \p scaling.
+        float* amaxA  = nullptr; //!< If set, the amax of a, for the amax history of the caller.
+        float* amaxB  = nullptr; //!< If set, the amax of b, for the amax history of the caller.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Run a gemm of f16 or bf16 a and b as an FP8 gemm with per-tensor scaling
+     *
+     *  \details
+     *  Quantizes a and b to \p fp8TypeA and \p fp8TypeB with hipblasltExtFp8Quantize, in
+     * one launch with delayed scales or two with current scales, into buffers allocated on
+     * \p stream, then runs the FP8 gemm with the scales of \p scales as the scales of a and
+     * b. The amax of d is returned through the AmaxD pointer of \p inputs, so the whole
+     * step stays on the device. \p problemtype holds the types of the unquantized a and b,
+     * which must be packed: the leading dimensions are the rows of the stored matrices and
+     * the batch strides their sizes.
+     *
+     *  The epilogue and inputs are those of Gemm::setProblem() without vector scales of a
+     * and b; the scale pointers of a and b of \p inputs are replaced by those of \p scales.
+     *
+     *  @param[in]
+     *  handle                  A handle of the current device.
+     *  @param[in]
+     *  m,n,k,batch_count       The problem of Gemm::setProblem() with GemmInputsV2.
+     *  @param[in]
+     *  lda,ldb,ldc,ldd         The leading dimensions of the matrices.
+     *  @param[in]
+     *  strideA,strideB,strideC,strideD The batch strides of the matrices.
+     *  @param[in]
+     *  fp8TypeA,fp8TypeB       HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ.
+     *  @param[in]
+     *  scales                  The scales and amax of a and b.
+     *  @param[in]
+     *  epilogue,inputs,problemtype     The epilogue, pointers and types of the gemm.
+     *  @param[in]
+     *  workspace,workspaceBytes        GPU workspace of the gemm.
+     *  @param[in]
+     *  stream                  The stream of the quantization and the gemm.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS           If the operation completed
+     * successfully. \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is NULL.
+     * \retval HIPBLAS_STATUS_INVALID_VALUE If a size is not positive, a or b is not packed,
+     * or a scale of \p scales is NULL. \retval HIPBLAS_STATUS_NOT_SUPPORTED If a datatype
+     * or vector scale is not supported, or the FP8 gemm has no solution.
+     */
+    HIPBLASLT_EXPORT hipblasStatus_t autoFp8Gemm(hipblasLtHandle_t  handle,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 int64_t            k,
+                                                 int64_t            batch_count,
+                                                 int64_t            lda,
+                                                 int64_t            ldb,
+                                                 int64_t            ldc,
+                                                 int64_t            ldd,
+                                                 int64_t            strideA,
+                                                 int64_t            strideB,
+                                                 int64_t            strideC,
+                                                 int64_t            strideD,
+                                                 hipDataType        fp8TypeA,
+                                                 hipDataType        fp8TypeB,
+                                                 AutoFp8Scales&     scales,
+                                                 GemmEpilogueV2&    epilogue,
+                                                 GemmInputsV2&      inputs,
+                                                 GemmProblemTypeV2& problemtype,
+                                                 void*              workspace,
+                                                 size_t             workspaceBytes,
+                                                 hipStream_t        stream);
+
+    /*! \ingroup library_module
+     *  \brief A fixed list of gemms compiled once into a graph
+     *
+     *  \details
+     *  For a model whose layers keep their shapes from step to step. Each gemm is added with
+     * its problem, its first inputs and the earlier gemms it must run after. compile()
+     * queries the best solution of every gemm once, makes its kernel arguments and builds
+     * and instantiates a hipGraph with one node per gemm, see GemmInstance::createGraphNode.
+     * After that run() only launches the graph, and setInputs() points a gemm to new buffers
+     * by patching the arguments of its node.
+     *
+     *  All gemms share the workspace given to compile(), so the gemms that need workspace
+     * also run in the order they were added. The program belongs to the device of \p handle.
+     */
+    class GemmProgram
+    {
+    public:
+        HIPBLASLT_EXPORT explicit GemmProgram(hipblasLtHandle_t handle);
+        HIPBLASLT_EXPORT ~GemmProgram();
+
+        GemmProgram(const GemmProgram&) = delete;
+        GemmProgram& operator=(const GemmProgram&) = delete;
+
+        /*! \ingroup library_module
+        *  \brief Add a gemm to the program.
+        *
+        *  @param[in]
+        *  m,n,k,batch_count,...   The problem, as given to Gemm::setProblem() with leading
+        * dimensions, strides and a GemmProblemTypeV2.
+        *  @param[in]
+        *  dependencies            Indices of earlier gemms of the program this one runs after.
+        *  @param[out]
+        *  index                   The index of the gemm in the program.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the gemm is added.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If a dependency is not an earlier gemm,
+        * the program is already compiled, or setProblem() rejects the problem.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t addGemm(int64_t                    m,
+                                                 int64_t                    n,
+                                                 int64_t                    k,
+                                                 int64_t                    batch_count,
+                                                 int64_t                    lda,
+                                                 int64_t                    ldb,
+                                                 int64_t                    ldc,
+                                                 int64_t                    ldd,
+                                                 int64_t                    strideA,
+                                                 int64_t                    strideB,
+                                                 int64_t                    strideC,
+                                                 int64_t                    strideD,
+                                                 GemmEpilogueV2&            epilogue,
+                                                 GemmInputsV2&              inputs,
+                                                 GemmProblemTypeV2&         problemtype,
+                                                 const std::vector<size_t>& dependencies,
+                                                 size_t&                    index);
+
+        /*! \ingroup library_module
+        *  \brief Resolve the solutions and build the graph of the program.
+        *
+        *  @param[in]
+        *  workspace,workspaceBytes        GPU workspace of the gemms, which must outlive
+        * the program.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the graph is instantiated.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If the program is empty or compiled.
+        *  \retval HIPBLAS_STATUS_NOT_SUPPORTED     If a gemm has no solution within the
+        * workspace.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t compile(void* workspace, size_t workspaceBytes);
+
+        /*! \ingroup library_module
+        *  \brief Point a gemm of a compiled program to new inputs.
+        *
+        *  \details
+        *  The pointers of \p inputs replace those of the gemm as in
+        * GemmInstance::updateGraphNode(). Must not be called while a run() of the program
+        * may still be reading the arguments, that is before the stream of the last run() has
+        * passed the program.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the node is updated.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If the program is not compiled or
+        * \p index is out of range.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t setInputs(size_t index, GemmInputsV2& inputs);
+
+        /*! \ingroup library_module
+        *  \brief Launch the graph of a compiled program on \p stream.
+        *
+        *  \retval HIPBLAS_STATUS_SUCCESS           If the graph is launched.
+        *  \retval HIPBLAS_STATUS_INVALID_VALUE     If the program is not compiled.
+        */
+        HIPBLASLT_EXPORT hipblasStatus_t run(hipStream_t stream);
+
+        //! The number of gemms in the program.
+        HIPBLASLT_EXPORT size_t size() const;
+
+    private:
+        class GemmProgramImpl;
+        std::unique_ptr<GemmProgramImpl> pimpl;
+    };
+
     HIPBLASLT_EXPORT std::string gemmType2String(GemmType type);
 
     /*! \ingroup library_module
@@ -1497,4 +2644,278 @@ namespace hipblaslt_ext
                       hipblasLtMatrixLayout_t Bdesc,
                       hipblasLtMatrixLayout_t Cdesc,
                       hipblasLtMatrixLayout_t Ddesc);
+
+    /*! \ingroup types_module
+     *  \brief The descriptors of one problem of matmulAlgoGetHeuristicBatched().
+     */
+    struct MatmulProblemDesc
+    {
+        hipblasLtMatmulDesc_t   matmulDesc; //!< The matrix multiplication descriptor.
+        hipblasLtMatrixLayout_t Adesc; //!< The layout of A.
+        hipblasLtMatrixLayout_t Bdesc; //!< The layout of B.
+        hipblasLtMatrixLayout_t Cdesc; //!< The layout of C.
+        hipblasLtMatrixLayout_t Ddesc; //!< The layout of D.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Retrieve the possible algorithms of many problems in one call
+     *
+     *  \details
+     *  This function returns for each problem the algorithms hipblasLtMatmulAlgoGetHeuristic()
+     * returns for it. The problems are selected together, so the nodes of the library that
+     * problems of the same type share are visited once instead of once per problem, which
+     * shortens the warm-up of models that query many shapes.
+     *
+     *  @param[in]
+     *  handle                  Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  problems                The descriptors of the problems.
+     *  @param[in]
+     *  pref                    The preference shared by all problems.
+     *  @param[in]
+     *  requestedAlgoCount      number of requested algorithms per problem.
+     *  @param[out]
+     *  heuristicResults        The algorithm heuristic vector of each problem, in order.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS           If query was successful. A problem without
+     * a solution has an empty vector.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED   If \p handle, \p pref or a descriptor is
+     * NULL.
+     *  \retval HIPBLAS_STATUS_INVALID_VALUE     If \p requestedAlgoCount is less than 1.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t matmulAlgoGetHeuristicBatched(
+        hipblasLtHandle_t                                           handle,
+        const std::vector<MatmulProblemDesc>&                       problems,
+        hipblasLtMatmulPreference_t                                 pref,
+        int                                                         requestedAlgoCount,
+        std::vector<std::vector<hipblasLtMatmulHeuristicResult_t>>& heuristicResults);
+
+    /*! \ingroup library_module
+     *  \brief Clear the matmul caches of a handle.
+     *
+     *  \details
+     *  hipblasLtMatmul caches the heuristic result of calls made without an algo and
+     *  the resolved solution of each problem per handle. This function drops both, so
+     *  the next call selects and resolves the solution again.
+     *
+     *  @param[in]
+     *  handle Pointer to the allocated hipBLASLt handle.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS        If the caches were cleared.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is invalid.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t clearMatmulCache(hipblasLtHandle_t handle);
+
+    /*! \ingroup library_module
+     *  \brief Enable a workspace pool on a handle.
+     *
+     *  \details
+     *  Solutions that need split-K or stream-K workspace are skipped when the workspace
+     *  passed to hipblasLtMatmul is too small. With the pool enabled, hipblasLtMatmul
+     *  considers solutions needing up to \p maxBytes of workspace. When the given
+     *  workspace is too small, the workspace is allocated from a stream-ordered memory
+     *  pool of the handle and released in stream order after the launch. The pool
+     *  keeps up to \p maxBytes cached, so repeated calls don't allocate device memory.
+     *  The pool must not be changed while hipblasLtMatmul calls on the handle are in flight.
+     *
+     *  @param[in]
+     *  handle   Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  maxBytes Largest workspace the pool provides, 0 disables the pool.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS        If the pool was set.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is invalid.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t setWorkspacePool(hipblasLtHandle_t handle, size_t maxBytes);
+
+    /*! \ingroup library_module
+     *  \brief Run the GEMMs of a handle on a high-priority stream.
+     *
+     *  \details
+     *  With the priority stream enabled, the kernels of hipblasLtMatmul and of the
+     *  GemmInstance run calls on the handle are launched on a stream of the greatest
+     *  priority of the device that the handle owns. The stream waits for the work queued
+     *  on the caller's stream and the caller's stream waits for the kernels through
+     *  events, so the order on the caller's stream is kept while the hardware schedules
+     *  the kernels ahead of other streams. The heuristic of hipblasLtMatmul then ranks
+     *  solutions with regular grids first, see GemmPreferenceV2::setPreferNonPersistent.
+     *  The setting must not be changed while calls on the handle are in flight.
+     *
+     *  @param[in]
+     *  handle   Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  enable   true to launch on the priority stream, false to launch on the caller's stream.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS        If the priority stream was set.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is invalid.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t setPriorityStream(hipblasLtHandle_t handle, bool enable);
+
+    /*! \ingroup library_module
+     *  \brief Make the GEMMs of a handle bitwise reproducible.
+     *
+     *  \details
+     *  With the reproducible mode enabled, the heuristics of the handle rank among the
+     *  solutions whose reductions have an order that the problem fixes: no atomic split-K
+     *  or StreamK accumulation, while split-K through the workspace and StreamK fix-ups
+     *  without atomics are kept. hipblasLtMatmul and GemmInstance::initialize refuse other
+     *  algos, and online tuning, whose winners depend on the timings of the process, is
+     *  skipped. The same problem then selects the same solution and produces the same bits
+     *  across processes and runs on the same device, CU budget and stream CU mask.
+     *  The setting must not be changed while calls on the handle are in flight.
+     *
+     *  @param[in]
+     *  handle   Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  enable   true to enable the reproducible mode, false to disable it.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS        If the mode was set.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is invalid.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t setReproducible(hipblasLtHandle_t handle, bool enable);
+
+    /*! \ingroup types_module
+     *  \brief Counters of the solution caches of the library.
+     *
+     * \details This structure is filled by \ref getSolutionCacheStats.
+     */
+    struct SolutionCacheStats
+    {
+        uint64_t hits      = 0; //!< Lookups served from the caches.
+        uint64_t misses    = 0; //!< Lookups that ran the solution selection.
+        uint64_t evictions = 0; //!< Entries evicted to stay within the capacity.
+        uint64_t size      = 0; //!< Entries currently cached.
+        uint64_t capacity
+            = 0; //!< Maximum number of entries, set with TENSILE_CACHE_MAP_CAPACITY. 0 is unbounded.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Read the counters of the solution caches.
+     *
+     *  \details
+     *  The library caches the solutions selected for each problem size.
+     *  Setting TENSILE_CACHE_MAP_CAPACITY bounds the number of entries of each
+     *  cache, entries that were not hit recently are evicted first. The counters cover
+     *  all handles using the same device as \p handle.
+     *
+     *  @param[in]
+     *  handle Pointer to the allocated hipBLASLt handle.
+     *  @param[out]
+     *  stats  The current counters.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS        If the counters were read.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is invalid.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t getSolutionCacheStats(hipblasLtHandle_t handle, SolutionCacheStats& stats);
+
+    /*! \ingroup types_module
+     *  \brief Histogram of the durations of one phase of the timed calls.
+     */
+    struct CallTimingHistogram
+    {
+        uint64_t count   = 0; //!< Calls that went through the phase.
+        uint64_t totalNs = 0; //!< Sum of the durations in nanoseconds.
+        std::vector<uint64_t>
+            buckets; //!< Bucket i counts the durations in [2^i, 2^(i+1)) nanoseconds.
+    };
+
+    /*! \ingroup types_module
+     *  \brief Phase durations of the hipblasLtMatmul calls of one problem signature.
+     *
+     * \details This structure is filled by \ref getCallTimings.
+     */
+    struct CallTimings
+    {
+        std::string         signature;  //!< Sizes, operations, types and epilogue of the problem.
+        CallTimingHistogram total;      //!< Whole call on the host.
+        CallTimingHistogram validation; //!< Argument checks.
+        CallTimingHistogram heuristic;  //!< Solution selection, when no algo was passed.
+        CallTimingHistogram solve;      //!< Kernel and argument resolution.
+        CallTimingHistogram launch;     //!< Kernel launches.
+        CallTimingHistogram device;     //!< Kernels on the device, with HIPBLASLT_CALL_TIMING=2.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Read the call timing histograms.
+     *
+     *  \details
+     *  Setting HIPBLASLT_CALL_TIMING=1 splits the host time of the hipblasLtMatmul calls
+     *  into phases, HIPBLASLT_CALL_TIMING=2 also times their kernels with events on the
+     *  caller's stream. Each thread adds to histograms of its own, this function sums the
+     *  histograms of all threads. The kernel times are added once the kernels completed,
+     *  this function doesn't wait for them. With HIPBLASLT_CALL_TIMING_FILE set, the
+     *  histograms are summarized into the file when the library is unloaded.
+     *
+     *  @param[out]
+     *  timings One entry per problem signature, empty when the timing is disabled.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS If the histograms were read.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t getCallTimings(std::vector<CallTimings>& timings);
+
+    /*! \ingroup types_module
+     *  \brief A solution the heuristic evaluated for a problem.
+     *
+     * \details This structure is filled by \ref traceSolutionSelection.
+     */
+    struct SolutionSelectionCandidate
+    {
+        int         solutionIndex = -1;    //!< Index of the solution in the library.
+        std::string solutionName;          //!< Kernel name of the solution.
+        bool        accepted = false;      //!< The predicates of the solution hold for the problem.
+        int         rank     = -1;         //!< Position in the heuristic result, -1 if none.
+        std::string failedPredicate;       //!< Innermost predicate that rejected the solution.
+        size_t      requiredWorkspace = 0; //!< Workspace the solution needs for the problem.
+        size_t      providedWorkspace = 0; //!< Workspace the problem provides.
+        double      score = 0.0; //!< Distance of the logic entry to the problem, NaN if none.
+    };
+
+    /*! \ingroup library_module
+     *  \brief Trace the solution selection of a problem.
+     *
+     *  \details
+     *  Runs the heuristic selection of hipblasLtMatmulAlgoGetHeuristic for the problem
+     *  without the cached results and records every solution it evaluated, in order.
+     *  A rejected solution names the innermost hardware or problem predicate that
+     *  failed, with the values it compared. The scores are the distances of the logic
+     *  table entries that lead to the solutions, the smallest distance ranks first.
+     *  Only the libraries that select a single GEMM through predicates and distance
+     *  tables are traced; the other libraries return their results without candidates.
+     *
+     *  @param[in]
+     *  handle             Pointer to the allocated hipBLASLt handle.
+     *  @param[in]
+     *  matmulDesc         Handle to a previously created matrix multiplication descriptor.
+     *  @param[in]
+     *  Adesc,Bdesc,Cdesc,Ddesc Handles to the previously created matrix layout descriptors.
+     *  @param[in]
+     *  maxWorkspaceBytes  Workspace the selection may assume.
+     *  @param[in]
+     *  requestedAlgoCount Number of solutions the selection returns.
+     *  @param[out]
+     *  candidates         The evaluated solutions.
+     *
+     *  \retval HIPBLAS_STATUS_SUCCESS        If the selection was traced.
+     *  \retval HIPBLAS_STATUS_NOT_INITIALIZED If \p handle is invalid.
+     *  \retval HIPBLAS_STATUS_INVALID_VALUE   If a descriptor is invalid or
+     *  \p requestedAlgoCount is less than 1.
+     */
+    HIPBLASLT_EXPORT
+    hipblasStatus_t
+        traceSolutionSelection(hipblasLtHandle_t                        handle,
+                               hipblasLtMatmulDesc_t                    matmulDesc,
+                               hipblasLtMatrixLayout_t                  Adesc,
+                               hipblasLtMatrixLayout_t                  Bdesc,
+                               hipblasLtMatrixLayout_t                  Cdesc,
+                               hipblasLtMatrixLayout_t                  Ddesc,
+                               size_t                                   maxWorkspaceBytes,
+                               int                                      requestedAlgoCount,
+                               std::vector<SolutionSelectionCandidate>& candidates);
 } // End of namespace hipblasltext
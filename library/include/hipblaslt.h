@@ -75,6 +75,14 @@
 #define HIPBLASLT_OPERATION_INVALID static_cast<hipblasOperation_t>(0)
 #define ROCBLASLT_COMPUTE_TYPE_INVALID static_cast<rocblaslt_compute_type>(255)
 
+/*! \ingroup types_module
+ *  \brief Compute type of f32 A and B that splits each into hi and lo bf16 parts and
+ *  accumulates the three bf16 products hi*hi + hi*lo + lo*hi in fp32, which is close to fp32
+ *  accuracy at bf16 MFMA speed. C and D keep their types. It is the largest value that
+ *  hipblasComputeType_t can hold, so that it may appear in constant expressions.
+ */
+#define HIPBLASLT_COMPUTE_32F_FAST_3XBF16_EXT static_cast<hipblasComputeType_t>(15)
+
 /*! \ingroup types_module
  *  \brief Specify the enum type to set the postprocessing options for the epilogue.
  */
@@ -90,7 +98,11 @@ typedef enum {
   HIPBLASLT_EPILOGUE_DGELU = 192,         /**<Apply gradient GELU transform. Requires additional aux input. */
   HIPBLASLT_EPILOGUE_DGELU_BGRAD = 208,   /**<Apply gradient GELU transform and bias gradient to the results. Requires additional aux input. */
   HIPBLASLT_EPILOGUE_BGRADA = 256,        /**<Apply bias gradient to A and output gemm result. */
-  HIPBLASLT_EPILOGUE_BGRADB = 512         /**<Apply bias gradient to B and output gemm result. */
+  HIPBLASLT_EPILOGUE_BGRADB = 512,        /**<Apply bias gradient to B and output gemm result. */
+  HIPBLASLT_EPILOGUE_SWIGLU = 1024,       /**<Gated SiLU: rows 2i and 2i+1 of the GEMM result (gate and up) give row i of D = SiLU(gate) * up. C and the bias have the m rows of the GEMM result, D has m/2 rows. hipblasLtMatmul only. */
+  HIPBLASLT_EPILOGUE_SWIGLU_BIAS = 1028,  /**<Apply bias to the GEMM result and then the gated SiLU. */
+  HIPBLASLT_EPILOGUE_GEGLU = 2048,        /**<Gated GELU: like HIPBLASLT_EPILOGUE_SWIGLU with D = GELU(gate) * up. */
+  HIPBLASLT_EPILOGUE_GEGLU_BIAS = 2052    /**<Apply bias to the GEMM result and then the gated GELU. */
 } hipblasLtEpilogue_t;
 
 /*! \ingroup types_module
@@ -106,6 +118,9 @@ typedef enum {
   HIPBLASLT_MATRIX_LAYOUT_TYPE = 2,
 
   /** Memory order of the data, see hipblasLtOrder_t.
+   *
+   * hipblasLtMatmul reads A and B in HIPBLASLT_ORDER_COL or HIPBLASLT_ORDER_ROW; a row-major operand is transposed
+   * while it is loaded, without a separate hipblasLtMatrixTransform. C and D must be HIPBLASLT_ORDER_COL.
    *
    * int32_t, default: HIPBLASLT_ORDER_COL
    */
@@ -138,8 +153,66 @@ typedef enum {
    * int64_t;
    */
   HIPBLASLT_MATRIX_LAYOUT_LD = 6,
+
+  /** How the batches of the matrix are found, see hipblasLtBatchMode_t.
+   *
+   * With HIPBLASLT_BATCH_MODE_POINTER_ARRAY the matrix pointer passed to hipblasLtMatmul is a device array of
+   * HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT pointers, one per batch, and HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET
+   * is ignored. hipblasLtMatmul only.
+   *
+   * int32_t, default: HIPBLASLT_BATCH_MODE_STRIDED
+   */
+  HIPBLASLT_MATRIX_LAYOUT_BATCH_MODE = 7,
+
+  /** Whether the matrix is stored compressed, see hipblasLtSparsity_t.
+   *
+   * Only A can be compressed. A compressed A is the output of hipblasltExtSparseCompress and its metadata is passed
+   * with HIPBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER. The layout keeps describing the dense matrix, and of its
+   * strides only the leading dimension of an A that is not transposed is used. A must be HIPBLASLT_ORDER_COL and
+   * strided, of type HIP_R_16F, HIP_R_16BF, HIP_R_8I, HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ, with k a multiple
+   * of 8.
+   *
+   * int32_t, default: HIPBLASLT_SPARSITY_DENSE
+   */
+  HIPBLASLT_MATRIX_LAYOUT_SPARSITY = 8,
+
+  /** Number of outer batches of a two-level batch, such as the sequences around the heads of attention.
+   *
+   * Batch (o, i), with o below HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT and i below HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
+   * starts HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE * o + HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET * i elements
+   * after the matrix pointer. A stride of 0 broadcasts the matrix over a level, as K and V over the heads of
+   * multi-query attention. A, B, C and D have the same counts. When the levels of every matrix flatten into one batch
+   * stride the GEMM is one strided batched launch; otherwise it runs one launch per batch of the smaller level, and
+   * aux, residual, second output, dropout, amax and completion flags are not supported. Strided batches and
+   * hipblasLtMatmul only.
+   *
+   * int32_t, default: 1
+   */
+  HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT = 9,
+
+  /** Stride (in elements) to the next outer batch, see HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT.
+   *
+   * int64_t, default: 0
+   */
+  HIPBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE = 10,
 } hipblasLtMatrixLayoutAttribute_t;
 
+/*! \ingroup types_module
+ *  \brief How a matrix is stored.
+ */
+typedef enum {
+  HIPBLASLT_SPARSITY_DENSE = 0,         /**<Every element is stored.*/
+  HIPBLASLT_SPARSITY_2_4_COMPRESSED = 1, /**<At most 2 of every 4 consecutive elements along k are nonzero, and only 2 of them are stored, with a metadata index of where they are.*/
+} hipblasLtSparsity_t;
+
+/*! \ingroup types_module
+ *  \brief How the batches of a matrix are found.
+ */
+typedef enum {
+  HIPBLASLT_BATCH_MODE_STRIDED = 0,       /**<Batch i starts HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET * i elements after the matrix pointer.*/
+  HIPBLASLT_BATCH_MODE_POINTER_ARRAY = 1, /**<The matrix pointer is a device array with the pointer of each batch, which may be anywhere in memory.*/
+} hipblasLtBatchMode_t;
+
 /*! \ingroup types_module
  *  \brief Pointer mode to use for alpha.
  */
@@ -149,6 +222,31 @@ typedef enum {
     HIPBLASLT_POINTER_MODE_ALPHA_DEVICE_VECTOR_BETA_HOST = 4, /** alpha pointer targets a device memory vector of length equal to the number of rows of matrix D, and beta is a single value in host memory. */
 } hipblasLtPointerMode_t;
 
+/*! \ingroup types_module
+ *  \brief Where the residual of HIPBLASLT_MATMUL_DESC_RESIDUAL_POINTER is added.
+ */
+typedef enum {
+    HIPBLASLT_RESIDUAL_AFTER_ACTIVATION = 0,  /** D = act(alpha * A * B + beta * C + bias) + R */
+    HIPBLASLT_RESIDUAL_BEFORE_ACTIVATION = 1, /** D = act(alpha * A * B + beta * C + bias + R) */
+} hipblasLtResidualPosition_t;
+
+/*! \ingroup types_module
+ *  \brief How HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER and HIPBLASLT_MATMUL_DESC_B_SCALE_POINTER scale their matrix.
+ */
+typedef enum {
+    HIPBLASLT_MATMUL_MATRIX_SCALE_SCALAR_32F = 0,   /** a single float scale of the matrix */
+    HIPBLASLT_MATMUL_MATRIX_SCALE_VEC32_UE8M0 = 1,  /** one unsigned E8M0 scale 2^(e - 127) per block of 32 elements along k, stored as uint8_t. op(A) has m x ceil(k / 32) and op(B) has ceil(k / 32) x n packed column major scales per batch. */
+} hipblasLtMatmulMatrixScale_t;
+
+/*! \ingroup types_module
+ *  \brief How the loads of B or the stores of D of HIPBLASLT_MATMUL_DESC_B_CACHE_POLICY and HIPBLASLT_MATMUL_DESC_D_CACHE_POLICY treat the caches.
+ */
+typedef enum {
+    HIPBLASLT_CACHE_POLICY_DEFAULT = 0,    /** regular loads and stores */
+    HIPBLASLT_CACHE_POLICY_STREAMING = 1,  /** nontemporal accesses that do not evict the lines other data keeps in L2 and MALL, for a D consumed much later or by another device */
+    HIPBLASLT_CACHE_POLICY_PERSISTING = 2, /** high temporal accesses whose lines are kept in L2 and MALL over regular ones, for a B that the next GEMMs read again */
+} hipblasLtCachePolicy_t;
+
 /*! \ingroup types_module
  *  \brief Specify the attributes that define the specifics of the matrix multiply operation.
  */
@@ -168,10 +266,45 @@ typedef enum {
   HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_BATCH_STRIDE = 12, /**<The batch stride of the epilogue auxiliary buffer pointer in the device memory. Data Type:int64_t */
   HIPBLASLT_MATMUL_DESC_POINTER_MODE = 13,              /**<Specifies alpha and beta are passed by reference, whether they are scalars on the host or on the device, or device vectors. Default value is: HIPBLASLT_POINTER_MODE_HOST (i.e., on the host). Data Type: int32_t based on hipblasLtPointerMode_t*/
   HIPBLASLT_MATMUL_DESC_AMAX_D_POINTER = 14,           /**<Device pointer to the memory location that on completion will be set to the maximum of absolute values in the output matrix. Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_RESIDUAL_POINTER = 15,         /**<Device pointer to a residual matrix R of the shape of D that is added to the result independently of C, see HIPBLASLT_MATMUL_DESC_RESIDUAL_POSITION. Works with the DEFAULT, BIAS, RELU and GELU epilogues of hipblasLtMatmul. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_RESIDUAL_DATA_TYPE = 16,       /**<Type of the residual matrix, HIP_R_32F, HIP_R_16F or HIP_R_16BF. Default value: the type of D Data Type:int32_t based on hipDataType*/
+  HIPBLASLT_MATMUL_DESC_RESIDUAL_LD = 17,              /**<The leading dimension of the column major residual matrix. Default value: the rows of D Data Type:int64_t */
+  HIPBLASLT_MATMUL_DESC_RESIDUAL_BATCH_STRIDE = 18,    /**<The batch stride of the residual matrix. Default value: the leading dimension times the columns of D Data Type:int64_t */
+  HIPBLASLT_MATMUL_DESC_RESIDUAL_POSITION = 19,        /**<Whether the residual is added before or after the activation of the epilogue. Default value: HIPBLASLT_RESIDUAL_AFTER_ACTIVATION Data Type:int32_t based on hipblasLtResidualPosition_t*/
+  HIPBLASLT_MATMUL_DESC_DROPOUT_PROBABILITY = 20,      /**<Probability in [0, 1) that the dropout of the epilogue zeroes an element of D, scaling the kept elements by 1 / (1 - probability). Works with the DEFAULT, BIAS, RELU and GELU epilogues of hipblasLtMatmul, and writes the keep bitmask to the EPILOGUE_AUX pointer when it is set. Bit i % 32 of 32-bit word i / 32 of a column is the row i, EPILOGUE_AUX_LD and EPILOGUE_AUX_BATCH_STRIDE count bits and default to the rows of D rounded up to 32 and the ld times the columns. Default value: 0, no dropout Data Type:float */
+  HIPBLASLT_MATMUL_DESC_DROPOUT_SEED_POINTER = 21,     /**<Device pointer to the uint64_t Philox seed of the dropout. Read when the matmul runs, so graphs can update it in place. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_DROPOUT_OFFSET_POINTER = 22,   /**<Device pointer to the uint64_t Philox offset of the dropout, which selects an independent random stream for the same seed. Default value: NULL, offset 0 Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_POINTER = 23,     /**<Device pointer to a float ring buffer of the amax of D over the last HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH steps for FP8 delayed scaling. Each hipblasLtMatmul stores the amax of HIPBLASLT_MATMUL_DESC_AMAX_D_POINTER, which must be set, into the current slot, advances the slot and writes the scale of the next step. D must be FP8. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH = 24,      /**<The number of slots of the amax history. Default value: 0 Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER = 25, /**<Device pointer to the int32_t slot of the amax history for the next hipblasLtMatmul, advanced by each call. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER = 26, /**<Device pointer to the float that receives the scale of the next step, the largest finite value of the type of D divided by the history maximum and 2^margin. It is left unchanged when the history maximum is zero or not finite. Can be the D scale pointer of the next hipblasLtMatmul. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_AMAX_HISTORY_MARGIN = 27,      /**<The margin of the next scale in powers of two. Default value: 0 Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_A_SCALE_MODE = 28,             /**<The scaling of A by HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER. Block scales need a column major FP8 A and work with hipblasLtMatmul. Default value: HIPBLASLT_MATMUL_MATRIX_SCALE_SCALAR_32F Data Type:int32_t based on hipblasLtMatmulMatrixScale_t*/
+  HIPBLASLT_MATMUL_DESC_B_SCALE_MODE = 29,             /**<Equivalent to HIPBLASLT_MATMUL_DESC_A_SCALE_MODE for matrix B. Default value: HIPBLASLT_MATMUL_MATRIX_SCALE_SCALAR_32F Data Type:int32_t based on hipblasLtMatmulMatrixScale_t*/
+  HIPBLASLT_MATMUL_DESC_B_QUANT_SCALE_POINTER = 30,    /**<Device pointer to the group scales of a weight-only quantized B of type HIP_R_8I or HIP_R_4I, which hipblasLtMatmul dequantizes to the type of A, HIP_R_16F or HIP_R_16BF, as (q - zero) * scale. The scales have the type of A, ceil(k / group size) x n packed column major per batch. A HIP_R_4I B packs two elements per byte, the even element in the low nibble. Default value: NULL, no quantization Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_B_QUANT_ZERO_POINTER = 31,     /**<Device pointer to the zero points of the groups of a quantized B, in the type and layout of the scales. Default value: NULL, zero points of 0 Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_B_QUANT_GROUP_SIZE = 32,       /**<The number of elements along k that share a scale and zero point of a quantized B. Default value: 0, one group over k per column Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE = 33,   /**<Type of the AUX matrix of the GELU_AUX and DGELU epilogues of hipblasLtMatmul, HIP_R_32F, HIP_R_16F, HIP_R_16BF or an FP8 type. A GELU_AUX epilogue stores the pre-activation times HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_SCALE_POINTER in this type with saturation, and a DGELU epilogue reads it back divided by that scale. Default value: HIPBLASLT_DATATYPE_INVALID, the type of D Data Type:int32_t based on hipDataType*/
+  HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER = 34, /**<Device pointer to the float that receives the maximum absolute value of the pre-activation that a GELU_AUX epilogue of hipblasLtMatmul stores into AUX, before its scale. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_D2_POINTER = 35,               /**<Device pointer to a second output D2 of the shape of D that hipblasLtMatmul writes from the final D as saturate(D * HIPBLASLT_MATMUL_DESC_D2_SCALE_POINTER) in its own type, for example an FP8 copy of a bf16 D. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_D2_DATA_TYPE = 36,             /**<Type of D2, HIP_R_32F, HIP_R_16F, HIP_R_16BF, HIP_R_8I, HIP_R_32I or an FP8 type. Default value: the type of D Data Type:int32_t based on hipDataType*/
+  HIPBLASLT_MATMUL_DESC_D2_LD = 37,                    /**<The leading dimension of the column major D2. Default value: the rows of D Data Type:int64_t */
+  HIPBLASLT_MATMUL_DESC_D2_BATCH_STRIDE = 38,          /**<The batch stride of D2. Default value: the leading dimension times the columns of D Data Type:int64_t */
+  HIPBLASLT_MATMUL_DESC_D2_SCALE_POINTER = 39,         /**<Device pointer to the float scale of D2. Default value: NULL, a scale of 1 Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_BGRAD_DETERMINISTIC = 40,      /**<Nonzero to reduce the bias gradient of the BGRADA, BGRADB and DGELU_BGRAD epilogues of hipblasLtMatmul in a fixed order after the GEMM, without workspace, so that the GEMM can use any split-k solution and repeated runs give identical bias gradients. Column major operands and a batch count of 1 only. Default value: 0 Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_DETERMINISTIC_REDUCTION = 41,  /**<Nonzero to only use solutions whose split-k and StreamK partials are reduced in a fixed order, through workspace or the Synchronizer, so that repeated runs are bitwise identical. Heuristic queries skip atomic solutions and hipblasLtMatmul rejects an atomic algo. Default value: 0 Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_CU_BUDGET = 42,                /**<Number of CUs that the persistent and StreamK grids of hipblasLtMatmul are sized to, so that kernels running concurrently keep the other CUs. The CU mask of the stream, if any, also bounds the grids. 0 uses every CU. Default value: 0 Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_COMPLETION_FLAGS_POINTER = 43, /**<Device pointer to one uint32_t counter per chunk of COMPLETION_CHUNK_COLS columns of D. hipblasLtMatmul runs the GEMM chunk by chunk and atomically increments the counter of a chunk, with a system scope fence, once the chunk is stored, so that a kernel on another stream can consume finished chunks. The counters are not reset. Default value: NULL Data Type:void* */
+  HIPBLASLT_MATMUL_DESC_COMPLETION_CHUNK_COLS = 44,    /**<Number of columns of D per chunk of COMPLETION_FLAGS_POINTER. 0 makes all of D one chunk. Default value: 0 Data Type:int32_t */
+  HIPBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER = 45, /**<Device pointer to the metadata of an A with HIPBLASLT_MATRIX_LAYOUT_SPARSITY set to HIPBLASLT_SPARSITY_2_4_COMPRESSED, written by hipblasltExtSparseCompress. Required by hipblasLtMatmul when A is compressed, heuristic queries do not read it. Default value: NULL Data Type:void* /const void* */
+  HIPBLASLT_MATMUL_DESC_D_CACHE_POLICY = 46,           /**<Cache policy of the stores of D. Heuristic queries rank the solutions whose kernels store D with the matching temporal hint first, and the skinny GEMM stores a streaming D with nontemporal stores. A hint, results are the same for every policy. Default value: HIPBLASLT_CACHE_POLICY_DEFAULT Data Type:int32_t based on hipblasLtCachePolicy_t*/
+  HIPBLASLT_MATMUL_DESC_B_CACHE_POLICY = 47,           /**<Equivalent to HIPBLASLT_MATMUL_DESC_D_CACHE_POLICY for the loads of B. Default value: HIPBLASLT_CACHE_POLICY_DEFAULT Data Type:int32_t based on hipblasLtCachePolicy_t*/
   HIPBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_A_EXT = 100,     /**<Compute input A types. Defines the data type used for the input A of matrix multiply. */
   HIPBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_B_EXT,           /**<Compute input B types. Defines the data type used for the input B of matrix multiply. */
   HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER_VEC_EXT,        /**<Equivalent to HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER but in vector. Default value: NULL Type: void* /const void* */
   HIPBLASLT_MATMUL_DESC_B_SCALE_POINTER_VEC_EXT,        /**<Equivalent to HIPBLASLT_MATMUL_DESC_B_SCALE_POINTER but in vector. Default value: NULL Type: void* /const void* */
+  HIPBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT,        /**<Equivalent to HIPBLASLT_MATMUL_DESC_D_SCALE_POINTER but a float vector with one scale per row of D, or per column with HIPBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT. The scaled result is converted to D with saturation, so D may be int8 or FP8 for per-channel quantization. hipblasLtMatmul only. Default value: NULL Type: void* /const void* */
+  HIPBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT,        /**<Nonzero if the vector of HIPBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT has one scale per column of D instead of per row. Default value: 0 Type: int32_t */
   HIPBLASLT_MATMUL_DESC_MAX,
 } hipblasLtMatmulDescAttributes_t;
 
@@ -196,6 +329,20 @@ typedef enum {
    * Leading dimension is the stride (in elements) to the beginning of next row in memory.
    */
   HIPBLASLT_ORDER_ROW = 1,
+  /** Column-major ordered tiles of 32 columns.
+   *
+   * Leading dimension is the stride (in elements) to the beginning of the next group of 32 columns, at least 32 *
+   * rows. Element (row, col) is at (col / 32) * ld + row * 32 + col % 32. Only supported by hipblasLtMatrixTransform.
+   */
+  HIPBLASLT_ORDER_COL32 = 2,
+  /** Column-major ordered tiles of 16 columns and 32 rows, in which the 8 consecutive rows of each column that an
+   * MFMA lane loads for an 8-bit operand are contiguous.
+   *
+   * Leading dimension is the stride (in elements) to the beginning of the next group of 16 columns, at least 16 *
+   * rows rounded up to 32. Element (row, col) is at (col / 16) * ld + (row / 32) * 512 + (row % 32 / 8) * 128 +
+   * (col % 16) * 8 + row % 8. Only supported by hipblasLtMatrixTransform.
+   */
+  HIPBLASLT_ORDER_COL16_4R8 = 100,
 } hipblasLtOrder_t;
 
 /** Matrix transform descriptor attributes to define details of the operation.
@@ -225,6 +372,48 @@ typedef enum {
    * int32_t, default: HIPBLAS_OP_N
    */
   HIPBLASLT_MATRIX_TRANSFORM_DESC_TRANSB,
+
+  /** Device pointer to a float scale that results are multiplied by before they are converted to the type of matrix C.
+   * Matrix C may have a different type than matrices A and B, e.g. HIP_R_8F_E4M3_FNUZ or HIP_R_8F_E5M2_FNUZ to
+   * quantize them.
+   *
+   * void*, default: nullptr
+   */
+  HIPBLASLT_MATRIX_TRANSFORM_DESC_C_SCALE_POINTER,
+
+  /** Clip results beyond the range of an FP8/BF8 matrix C to its largest magnitude instead of converting them to NaN.
+   *
+   * int32_t, default: 1
+   */
+  HIPBLASLT_MATRIX_TRANSFORM_DESC_SATURATE,
+
+  /** Round results to an FP8/BF8 matrix C stochastically instead of to nearest even.
+   *
+   * int32_t, default: 0
+   */
+  HIPBLASLT_MATRIX_TRANSFORM_DESC_STOCHASTIC_ROUNDING,
+
+  /** Seed of the random numbers for HIPBLASLT_MATRIX_TRANSFORM_DESC_STOCHASTIC_ROUNDING.
+   *
+   * uint32_t, default: 0
+   */
+  HIPBLASLT_MATRIX_TRANSFORM_DESC_ROUNDING_SEED,
+
+  /** Treat A, B and C as device arrays of batch count pointers to the individual matrices instead of as the first
+   * matrix of a strided batch. The batch stride is ignored. All batches are transformed with a single launch.
+   *
+   * int32_t, default: 0
+   */
+  HIPBLASLT_MATRIX_TRANSFORM_DESC_BATCH_POINTER_ARRAY,
+
+  /** Number of columns of C, or rows for a row-major C, transformed per chunk when A, B and C are in host memory
+   * because they do not fit on the device. Chunks are copied to the device, transformed and copied back on several
+   * internal streams so that copies in both directions overlap the transforms; the host matrices should be pinned.
+   * The call is ordered with other work on the stream passed to hipblasLtMatrixTransform. 0 disables streaming.
+   *
+   * int32_t, default: 0
+   */
+  HIPBLASLT_MATRIX_TRANSFORM_DESC_STREAMING_CHUNK_SIZE,
 } hipblasLtMatrixTransformDescAttributes_t;
 
 #if defined(__HIP_PLATFORM_AMD__)
@@ -327,13 +516,15 @@ typedef struct _hipblasLtMatmulAlgo_t{
  *  @param algo \ref hipblasLtMatmulAlgo_t struct
  *  @param workspaceSize Actual size of workspace memory required
  *  @param state Result status. Other fields are valid only if, after call to hipblasLtMatmulAlgoGetHeuristic(), this member is set to HIPBLAS_STATUS_SUCCESS
+ *  @param predictedSpeedup Predicted speedup over the fastest result of the same query that needs no workspace, 0 when unknown
  */
 typedef struct _hipblasLtMatmulHeuristicResult_t{
   hipblasLtMatmulAlgo_t algo;                      /**<Algo struct*/
   size_t workspaceSize = 0;                        /**<Actual size of workspace memory required.*/
   hipblasStatus_t state = HIPBLAS_STATUS_SUCCESS;  /**<Result status. Other fields are valid only if, after call to hipblasLtMatmulAlgoGetHeuristic(), this member is set to HIPBLAS_STATUS_SUCCESS..*/
   float wavesCount = 1.0;                          /**<Waves count is a device utilization metric. A wavesCount value of 1.0f suggests that when the kernel is launched it will fully occupy the GPU.*/
-  int reserved[4];                                 /**<Reserved.*/
+  float predictedSpeedup = 0.0;                    /**<Predicted speedup over the fastest result of the same query that needs no workspace, 0 when unknown.*/
+  int reserved[3];                                 /**<Reserved.*/
 } hipblasLtMatmulHeuristicResult_t;
 #elif defined(__HIP_PLATFORM_NVIDIA__)
 #endif
@@ -936,6 +1127,118 @@ hipblasStatus_t hipblasLtMatrixTransform(hipblasLtHandle_t              lightHan
                                          void*                   C,
                                          hipblasLtMatrixLayout_t Cdesc,
                                          hipStream_t             stream);
+
+/*! \ingroup types_module
+ *  \brief One matrix transform of hipblasLtMatrixTransformGrouped()
+ *
+ *  \details
+ *  The pointers and layouts of one C = alpha * op(A) + beta * op(B), with the same meaning as the
+ *  arguments of hipblasLtMatrixTransform(). Every job has its own shape, leading dimensions,
+ *  orders, batch count and batch strides.
+ */
+typedef struct {
+  const void*             A;     /**<Matrix A in device memory, may be NULL if B is set.*/
+  hipblasLtMatrixLayout_t Adesc; /**<Layout of A, may be NULL if A is NULL.*/
+  const void*             B;     /**<Matrix B in device memory, may be NULL if A is set.*/
+  hipblasLtMatrixLayout_t Bdesc; /**<Layout of B, may be NULL if B is NULL.*/
+  void*                   C;     /**<Matrix C in device memory, must not alias A or B.*/
+  hipblasLtMatrixLayout_t Cdesc; /**<Layout of C.*/
+} hipblasLtMatrixTransformJob_t;
+
+/*! \ingroup library_module
+ *  \brief Matrix layout conversion of many matrices in one launch
+ *  \details
+ *   Performs hipblasLtMatrixTransform() for every job of \p jobs with one persistent kernel.
+ * The tiles of all jobs are dealt round robin to a grid sized to the device, so a set of small
+ * matrices of different shapes, such as the weights of a model, costs a single launch and
+ * large matrices still spread over the whole device. All jobs share \p transformDesc, \p alpha
+ * and \p beta, and A, B and C of every job must have the same datatype. Tiled orders, pointer
+ * arrays, streaming and datatype conversions are not supported.
+ * @param[in]  lightHandle   Pointer to the allocated hipBLASLt handle for the
+ * hipBLASLt context. See \ref hipblasLtHandle_t .
+ * @param[in]  transformDesc Pointer to allocated matrix transform descriptor.
+ * @param[in]  alpha         Pointer to scalar alpha, either pointer to host or device address.
+ * @param[in]  beta          Pointer to scalar beta, either pointer to host or device address.
+ * @param[in]  jobs          Host array of \p numJobs transforms.
+ * @param[in]  numJobs       The number of transforms.
+ * @param[in] stream         The HIP stream where all the GPU work will be submitted.
+ *
+ * \retval HIPBLAS_STATUS_NOT_INITIALIZED   if hipBLASLt handle has not been initialized
+ * \retval HIPBLAS_STATUS_INVALID_VALUE     if \p jobs is NULL while \p numJobs is not 0, or a job is
+ *                                              invalid for hipblasLtMatrixTransform()
+ * \retval HIPBLAS_STATUS_INTERNAL_ERROR    if the datatypes, orders or descriptor attributes of a job
+ *                                              are not supported by the grouped kernel
+ * \retval HIPBLAS_STATUS_ALLOC_FAILED      if the device job table cannot be allocated
+ * \retval HIPBLAS_STATUS_SUCCESS           if the operation completed successfully
+ */
+HIPBLASLT_EXPORT
+hipblasStatus_t hipblasLtMatrixTransformGrouped(hipblasLtHandle_t                    lightHandle,
+                                                hipblasLtMatrixTransformDesc_t       transformDesc,
+                                                const void*                          alpha,
+                                                const void*                          beta,
+                                                const hipblasLtMatrixTransformJob_t* jobs,
+                                                uint32_t                             numJobs,
+                                                hipStream_t                          stream);
+
+/*! \ingroup types_module
+ *  \brief Runtime counters filled by hipblasLtGetStatistics()
+ *
+ *  \details
+ *  The counters only grow. The handle counters cover the calls on the handle, the library,
+ *  code object and kernel counters the handles using the same device, and the others the
+ *  whole process.
+ */
+typedef struct {
+  uint64_t handleCacheHits;      /**<Lookups served by the execution cache of the handle.*/
+  uint64_t handleCacheMisses;    /**<Lookups that resolved the solution and its kernels.*/
+  uint64_t libraryCacheHits;     /**<Solution selections served from the caches of the library.*/
+  uint64_t libraryCacheMisses;   /**<Solution selections that searched the library.*/
+  uint64_t sharedCacheHits;      /**<Selections read from the node-wide TENSILE_SHARED_CACHE.*/
+  uint64_t sharedCacheMisses;    /**<Lookups of TENSILE_SHARED_CACHE that found nothing.*/
+  uint64_t lazyLibraryLoads;     /**<Child libraries loaded on demand.*/
+  uint64_t codeObjectsLoaded;    /**<Code objects loaded for the device.*/
+  uint64_t kernelsResolved;      /**<Kernels looked up in the loaded code objects.*/
+  uint64_t stagingReallocations; /**<Pinned host staging buffers allocated or resized.*/
+  uint64_t workspaceShortfalls;  /**<Solutions rejected because the workspace was too small.*/
+} hipblasLtStatistics_t;
+
+/*! \ingroup library_module
+ *  \brief Read the runtime counters
+ *  \details
+ *   Reads the counters of the caches, lazy loading, code objects, kernel lookups, host staging
+ * and workspace checks, so they can be exported to a monitoring system. Reading them takes a
+ * few locks and does not synchronize the device.
+ * @param[in]  handle Pointer to the allocated hipBLASLt handle.
+ * @param[out] stats  The current counters.
+ *
+ * \retval HIPBLAS_STATUS_NOT_INITIALIZED   if hipBLASLt handle has not been initialized
+ * \retval HIPBLAS_STATUS_INVALID_VALUE     if \p stats is NULL
+ * \retval HIPBLAS_STATUS_SUCCESS           if the counters were read
+ */
+HIPBLASLT_EXPORT
+hipblasStatus_t hipblasLtGetStatistics(hipblasLtHandle_t handle, hipblasLtStatistics_t* stats);
+
+/*! \ingroup library_module
+ *  \brief Get the kernel and solution names of an algorithm
+ *  \details
+ *   Points \p kernelName and \p solutionName at the names of the solution of \p algo, for
+ * logging and profiling. The names are cached per solution index, so queries after the first
+ * one of an algorithm do not allocate, and the strings stay valid until the process exits.
+ * @param[in]  handle       Pointer to the allocated hipBLASLt handle.
+ * @param[in]  algo         An algorithm returned by the heuristic or by index.
+ * @param[out] kernelName   The name of the first kernel of the solution. Can be NULL.
+ * @param[out] solutionName The name of the solution. Can be NULL.
+ *
+ * \retval HIPBLAS_STATUS_NOT_INITIALIZED   if hipBLASLt handle has not been initialized
+ * \retval HIPBLAS_STATUS_INVALID_VALUE     if \p algo is NULL, both names are NULL, or the
+ *                                          library of the device has no such solution
+ * \retval HIPBLAS_STATUS_SUCCESS           if the names were returned
+ */
+HIPBLASLT_EXPORT
+hipblasStatus_t hipblasLtMatmulAlgoGetName(hipblasLtHandle_t            handle,
+                                           const hipblasLtMatmulAlgo_t* algo,
+                                           const char**                 kernelName,
+                                           const char**                 solutionName);
 #ifdef __cplusplus
 }
 #endif
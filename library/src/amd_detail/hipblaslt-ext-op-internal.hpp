@@ -35,9 +35,13 @@
 #include <fstream>
 #include <libgen.h>
 #include <msgpack.hpp>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace hipblaslt_ext {
 
@@ -109,10 +113,20 @@ struct TensileLite::Serialization::MappingTraits<hipblaslt_ext::SoftmaxSolution,
         std::string datatypeStr;
         iot::mapRequired(io, "io_type", datatypeStr);
 
+        // Half and BFloat16 kernels load and store in the io type and accumulate in
+        // fp32, they share the tiling of the fp32 kernels
         if(datatypeStr == "S")
         {
             s.datatype = TensileLite::DataType::Float;
         }
+        else if(datatypeStr == "H")
+        {
+            s.datatype = TensileLite::DataType::Half;
+        }
+        else if(datatypeStr == "B")
+        {
+            s.datatype = TensileLite::DataType::BFloat16;
+        }
         else
         {
             throw std::runtime_error("Invalid datatype in ext op library");
@@ -217,6 +231,25 @@ public:
         return *bestSolIter;
     }
 
+    // Tiles of the solutions that can run rows of n columns, in increasing order
+    std::vector<std::uint32_t> getCandidateTiles(const SoftmaxProblem& problem) const
+    {
+        std::vector<std::uint32_t> tiles;
+        for(const auto& sol : solutions)
+            if(sol->getTileN() >= problem.getN())
+                tiles.push_back(sol->getTileN());
+        return tiles;
+    }
+
+    std::shared_ptr<SoftmaxSolution> findSolutionByTile(const SoftmaxProblem& problem,
+                                                        std::uint32_t         tile) const
+    {
+        for(const auto& sol : solutions)
+            if(sol->getTileN() == tile && tile >= problem.getN())
+                return sol;
+        return nullptr;
+    }
+
     void sortSolutions()
     {
         std::sort(begin(solutions), end(solutions), [](const auto& lhs, const auto& rhs) {
@@ -380,6 +413,25 @@ public:
         return *bestSolIter;
     }
 
+    // Limits of the solutions that can run rows of n columns, in increasing order
+    std::vector<std::uint32_t> getCandidateTiles(const LayerNormProblem& problem) const
+    {
+        std::vector<std::uint32_t> tiles;
+        for(const auto& sol : solutions)
+            if(sol->getLimit() >= problem.getN())
+                tiles.push_back(sol->getLimit());
+        return tiles;
+    }
+
+    std::shared_ptr<LayerNormSolution> findSolutionByTile(const LayerNormProblem& problem,
+                                                          std::uint32_t           tile) const
+    {
+        for(const auto& sol : solutions)
+            if(sol->getLimit() == tile && tile >= problem.getN())
+                return sol;
+        return nullptr;
+    }
+
     void sortSolutions()
     {
         std::sort(begin(solutions), end(solutions), [](const auto& lhs, const auto& rhs) {
@@ -638,6 +690,64 @@ private:
     TensileLite::SolutionVector<AMaxSolution> solutions;
 };
 
+// Measured choice of tile per (arch, op, type, n bucket), read from a text file of
+// lines "<arch> <op> <type> <max n> <tile>". A bucket holds the n up to its max n
+// and above the max n of the bucket before it.
+class ExtOpTuningTable
+{
+public:
+    ExtOpTuningTable() = default;
+
+    explicit ExtOpTuningTable(const std::string& path)
+    {
+        std::ifstream ifs(path);
+        std::string   line;
+
+        while(std::getline(ifs, line))
+        {
+            if(line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream iss(line);
+            std::string        arch, op, type;
+            std::uint32_t      maxN{}, tile{};
+
+            if(!(iss >> arch >> op >> type >> maxN >> tile))
+                throw std::runtime_error("Invalid ext op tuning line: " + line);
+
+            buckets[arch + ' ' + op + ' ' + type].emplace_back(maxN, tile);
+        }
+
+        for(auto& b : buckets)
+            std::sort(b.second.begin(), b.second.end());
+    }
+
+    // Tuned tile for rows of n columns, 0 when n is in no bucket
+    std::uint32_t lookup(const std::string& arch,
+                         const std::string& op,
+                         const std::string& type,
+                         std::uint32_t      n) const
+    {
+        auto it = buckets.find(arch + ' ' + op + ' ' + type);
+        if(it == buckets.end())
+            return 0;
+
+        auto bucket = std::lower_bound(it->second.begin(),
+                                       it->second.end(),
+                                       n,
+                                       [](const auto& b, std::uint32_t v) { return b.first < v; });
+        return bucket == it->second.end() ? 0 : bucket->second;
+    }
+
+    bool empty() const
+    {
+        return buckets.empty();
+    }
+
+private:
+    std::unordered_map<std::string, std::vector<std::pair<std::uint32_t, std::uint32_t>>> buckets;
+};
+
 class ExtOpMasterLibrary
 {
 public:
@@ -649,11 +759,25 @@ public:
         load(libPath);
     }
 
+    // The solutions of a library are deserialized the first time it is requested
     const ExtOpLibraryPtr& getLibrary(const std::string& archName,
                                       const std::string& opName,
                                       const std::string& typeName) const
     {
-        return libraries.at(archName).at(opName).at(typeName);
+        auto& entry = libraries.at(archName).at(opName).at(typeName);
+        std::call_once(entry.once, [&] { entry.library = makeLibrary(opName, entry.raw); });
+        return entry.library;
+    }
+
+    bool hasLibrary(const std::string& archName,
+                    const std::string& opName,
+                    const std::string& typeName) const
+    {
+        auto arch = libraries.find(archName);
+        if(arch == libraries.end())
+            return false;
+        auto op = arch->second.find(opName);
+        return op != arch->second.end() && op->second.count(typeName);
     }
 
     const std::string getLibraryPath() const
@@ -667,10 +791,47 @@ public:
     }
 
 private:
-    bool load(const std::string& libPath)
+    // The solutions of one arch, op and type, still in the unpacked file
+    struct LazyLibrary
+    {
+        msgpack::object         raw;
+        mutable std::once_flag  once;
+        mutable ExtOpLibraryPtr library;
+    };
+
+    template <typename Library, typename Solution>
+    static ExtOpLibraryPtr makeLibrary(const msgpack::object& rawKernels)
+    {
+        auto lib = std::make_unique<Library>();
+
+        for(uint32_t i = 0; i < rawKernels.via.array.size; ++i)
+        {
+            auto&    rawKernel = rawKernels.via.array.ptr[i];
+            Solution solution;
+            TensileLite::Serialization::MessagePackInput msgInput(rawKernel);
+            TensileLite::Serialization::MappingTraits<
+                Solution,
+                TensileLite::Serialization::MessagePackInput>::mapping(msgInput, solution);
+
+            lib->addSolution(solution);
+        }
+
+        lib->sortSolutions();
+        return lib;
+    }
+
+    static ExtOpLibraryPtr makeLibrary(const std::string& opName, const msgpack::object& rawKernels)
     {
-        msgpack::object_handle handle;
+        if(opName == SoftmaxSolutionLibrary::opName)
+            return makeLibrary<SoftmaxSolutionLibrary, SoftmaxSolution>(rawKernels);
+        else if(opName == LayerNormSolutionLibrary::opName)
+            return makeLibrary<LayerNormSolutionLibrary, LayerNormSolution>(rawKernels);
+        else
+            return makeLibrary<AMaxSolutionLibrary, AMaxSolution>(rawKernels);
+    }
 
+    bool load(const std::string& libPath)
+    {
         std::ifstream ifs(libPath, std::ios::in | std::ios::binary);
 
         if(!ifs.is_open())
@@ -695,112 +856,39 @@ private:
             throw std::runtime_error("Unexpected EOF!");
         }
 
+        // Only the arch, op and type keys are read here, the handle keeps the solutions
+        // alive until their library is requested
         msgpack::object                                  root = handle.get();
         std::unordered_map<std::string, msgpack::object> objMap;
         TensileLite::Serialization::objectToMap(root, objMap);
 
         for(auto& archObj : objMap)
         {
-            libraries.emplace(archObj.first,
-                              std::map<std::string, std::map<std::string, ExtOpLibraryPtr>>());
+            auto& archLibraries = libraries[archObj.first];
 
             std::unordered_map<std::string, msgpack::object> opMap;
             TensileLite::Serialization::objectToMap(archObj.second, opMap);
 
             for(auto& opObj : opMap)
             {
-                libraries.at(archObj.first)
-                    .emplace(opObj.first, std::map<std::string, ExtOpLibraryPtr>());
+                auto& opLibraries = archLibraries[opObj.first];
+
+                if(opObj.first != SoftmaxSolutionLibrary::opName
+                   && opObj.first != LayerNormSolutionLibrary::opName
+                   && opObj.first != AMaxSolutionLibrary::opName)
+                    continue;
 
                 std::unordered_map<std::string, msgpack::object> typeMap;
                 TensileLite::Serialization::objectToMap(opObj.second, typeMap);
 
                 for(auto& typeLib : typeMap)
                 {
-                    auto& rawKernels = typeLib.second;
-
-                    if(rawKernels.type != msgpack::type::ARRAY)
+                    if(typeLib.second.type != msgpack::type::ARRAY)
                     {
                         throw std::runtime_error("Invalid ext op lib format");
                     }
 
-                    const auto numKernels = rawKernels.via.array.size;
-
-                    if(opObj.first == "Softmax")
-                    {
-                        libraries.at(archObj.first)
-                            .at(opObj.first)
-                            .emplace(typeLib.first, std::make_unique<SoftmaxSolutionLibrary>());
-                        auto& lib = libraries.at(archObj.first)
-                                        .at(opObj.first)
-                                        .at(typeLib.first)
-                                        ->as<SoftmaxSolutionLibrary>();
-
-                        for(uint32_t i = 0; i < numKernels; ++i)
-                        {
-                            auto&           rawKernel = rawKernels.via.array.ptr[i];
-                            SoftmaxSolution solution;
-                            TensileLite::Serialization::MessagePackInput msgInput(rawKernel);
-                            TensileLite::Serialization::MappingTraits<
-                                SoftmaxSolution,
-                                TensileLite::Serialization::MessagePackInput>::mapping(msgInput,
-                                                                                   solution);
-
-                            lib.addSolution(solution);
-                        }
-
-                        lib.sortSolutions();
-                    }
-                    else if(opObj.first == "LayerNorm")
-                    {
-                        libraries.at(archObj.first)
-                            .at(opObj.first)
-                            .emplace(typeLib.first, std::make_unique<LayerNormSolutionLibrary>());
-                        auto& lib = libraries.at(archObj.first)
-                                        .at(opObj.first)
-                                        .at(typeLib.first)
-                                        ->as<LayerNormSolutionLibrary>();
-
-                        for(uint32_t i = 0; i < numKernels; ++i)
-                        {
-                            auto&             rawKernel = rawKernels.via.array.ptr[i];
-                            LayerNormSolution solution;
-                            TensileLite::Serialization::MessagePackInput msgInput(rawKernel);
-                            TensileLite::Serialization::MappingTraits<
-                                LayerNormSolution,
-                                TensileLite::Serialization::MessagePackInput>::mapping(msgInput,
-                                                                                   solution);
-
-                            lib.addSolution(solution);
-                        }
-
-                        lib.sortSolutions();
-                    }
-                    else if(opObj.first == "AMax")
-                    {
-                        libraries.at(archObj.first)
-                            .at(opObj.first)
-                            .emplace(typeLib.first, std::make_unique<AMaxSolutionLibrary>());
-                        auto& lib = libraries.at(archObj.first)
-                                        .at(opObj.first)
-                                        .at(typeLib.first)
-                                        ->as<AMaxSolutionLibrary>();
-
-                        for(uint32_t i = 0; i < numKernels; ++i)
-                        {
-                            auto&        rawKernel = rawKernels.via.array.ptr[i];
-                            AMaxSolution solution;
-                            TensileLite::Serialization::MessagePackInput msgInput(rawKernel);
-                            TensileLite::Serialization::MappingTraits<
-                                AMaxSolution,
-                                TensileLite::Serialization::MessagePackInput>::mapping(msgInput,
-                                                                                   solution);
-
-                            lib.addSolution(solution);
-                        }
-
-                        lib.sortSolutions();
-                    }
+                    opLibraries[typeLib.first].raw = typeLib.second;
                 }
             }
         }
@@ -809,9 +897,10 @@ private:
     }
 
 private:
-    std::map<std::string, std::map<std::string, std::map<std::string, ExtOpLibraryPtr>>> libraries;
-    std::string                                                                          libPath;
-    std::string                                                                          libDir;
+    msgpack::object_handle handle;
+    std::map<std::string, std::map<std::string, std::map<std::string, LazyLibrary>>> libraries;
+    std::string                                                                      libPath;
+    std::string                                                                      libDir;
 };
 
 } // namespace hipblaslt_ext
@@ -26,6 +26,7 @@
 
 #include "hipblaslt-ext-op.h"
 #include "hipblaslt-ext-op-internal.hpp"
+#include <Tensile/Debug.hpp>
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/msgpack/MessagePack.hpp>
@@ -33,14 +34,18 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <hip/hip_bfloat16.h>
 #include <hip/hip_ext.h>
+#include <hip/hip_runtime.h>
 #include <hip/hip_runtime_api.h>
+#include <hipblaslt/hipblaslt_float8.h>
 #include <libgen.h>
 #include <memory>
 #include <rocblaslt-auxiliary.h>
 #include <sstream>
 #include <string>
 #include <tensile_host.hpp>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -63,6 +68,104 @@ hipblasStatus_t hipblasltExtSoftmax(hipDataType datatype,
     return hipblasltSoftmaxRun(datatype, m, n, dim, output, input, stream);
 }
 
+hipblasStatus_t hipblasltScaleMaskSoftmaxRun(hipDataType datatype,
+                                             uint32_t    m,
+                                             uint32_t    n,
+                                             uint32_t    batchCount,
+                                             void*       output,
+                                             int64_t     strideOutput,
+                                             void*       input,
+                                             int64_t     strideInput,
+                                             float       scale,
+                                             int32_t     causal,
+                                             void*       bias,
+                                             int64_t     biasRowStride,
+                                             int64_t     biasBatchStride,
+                                             hipStream_t stream);
+
+hipblasStatus_t hipblasltExtScaleMaskSoftmax(hipDataType datatype,
+                                             uint32_t    m,
+                                             uint32_t    n,
+                                             uint32_t    batchCount,
+                                             void*       output,
+                                             int64_t     strideOutput,
+                                             void*       input,
+                                             int64_t     strideInput,
+                                             float       scale,
+                                             int32_t     causal,
+                                             void*       bias,
+                                             int64_t     biasRowStride,
+                                             int64_t     biasBatchStride,
+                                             hipStream_t stream)
+{
+    return hipblasltScaleMaskSoftmaxRun(datatype,
+                                        m,
+                                        n,
+                                        batchCount,
+                                        output,
+                                        strideOutput,
+                                        input,
+                                        strideInput,
+                                        scale,
+                                        causal,
+                                        bias,
+                                        biasRowStride,
+                                        biasBatchStride,
+                                        stream);
+}
+
+hipblasStatus_t hipblasltAttentionRun(hipDataType inputType,
+                                      hipDataType outputType,
+                                      uint32_t    batchCount,
+                                      uint32_t    numHeads,
+                                      uint32_t    numKvHeads,
+                                      uint32_t    seqQ,
+                                      uint32_t    seqK,
+                                      uint32_t    headDim,
+                                      void*       output,
+                                      const void* q,
+                                      const void* k,
+                                      const void* v,
+                                      float       scale,
+                                      float       outputScale,
+                                      int32_t     causal,
+                                      hipStream_t stream);
+
+hipblasStatus_t hipblasltExtAttention(hipDataType inputType,
+                                      hipDataType outputType,
+                                      uint32_t    batchCount,
+                                      uint32_t    numHeads,
+                                      uint32_t    numKvHeads,
+                                      uint32_t    seqQ,
+                                      uint32_t    seqK,
+                                      uint32_t    headDim,
+                                      void*       output,
+                                      const void* q,
+                                      const void* k,
+                                      const void* v,
+                                      float       scale,
+                                      float       outputScale,
+                                      int32_t     causal,
+                                      hipStream_t stream)
+{
+    return hipblasltAttentionRun(inputType,
+                                 outputType,
+                                 batchCount,
+                                 numHeads,
+                                 numKvHeads,
+                                 seqQ,
+                                 seqK,
+                                 headDim,
+                                 output,
+                                 q,
+                                 k,
+                                 v,
+                                 scale,
+                                 outputScale,
+                                 causal,
+                                 stream);
+}
+
 hipblasStatus_t hipblasltLayerNormRun(hipDataType datatype,
                                       void*       output,
                                       void*       mean,
@@ -121,6 +224,19 @@ hipblasStatus_t hipblasltExtAMax(const hipDataType datatype,
     return hipblasltAMaxRun(datatype, outDatatype, output, input, m, n, stream);
 }
 
+hipblasStatus_t hipblasltAMaxMultiTensorRun(const hipDataType             outDatatype,
+                                            const hipblasltExtAMaxTensor* tensors,
+                                            uint32_t                      numTensors,
+                                            hipStream_t                   stream);
+
+hipblasStatus_t hipblasltExtAMaxMultiTensor(const hipDataType             outDatatype,
+                                            const hipblasltExtAMaxTensor* tensors,
+                                            uint32_t                      numTensors,
+                                            hipStream_t                   stream)
+{
+    return hipblasltAMaxMultiTensorRun(outDatatype, tensors, numTensors, stream);
+}
+
 hipblasStatus_t hipblasltExtAMaxWithScale(const hipDataType datatype,
                                           const hipDataType outDatatype,
                                           const hipDataType scaleDatatype,
@@ -136,6 +252,191 @@ hipblasStatus_t hipblasltExtAMaxWithScale(const hipDataType datatype,
         datatype, outDatatype, scaleDatatype, output, outputD, input, inputScale, m, n, stream);
 }
 
+hipblasStatus_t hipblasltAMaxWithBlockScaleRun(const hipDataType                 datatype,
+                                               const hipDataType                 scaleDatatype,
+                                               const hipblasltExtAMaxScaleMode_t mode,
+                                               uint32_t                          blockSize,
+                                               void*                             amax,
+                                               void*                             scale,
+                                               void*                             outputD,
+                                               void*                             input,
+                                               uint32_t                          m,
+                                               uint32_t                          n,
+                                               hipStream_t                       stream);
+
+hipblasStatus_t hipblasltExtAMaxWithBlockScale(const hipDataType                 datatype,
+                                               const hipDataType                 scaleDatatype,
+                                               const hipblasltExtAMaxScaleMode_t mode,
+                                               uint32_t                          blockSize,
+                                               void*                             amax,
+                                               void*                             scale,
+                                               void*                             outputD,
+                                               void*                             input,
+                                               uint32_t                          m,
+                                               uint32_t                          n,
+                                               hipStream_t                       stream)
+{
+    return hipblasltAMaxWithBlockScaleRun(
+        datatype, scaleDatatype, mode, blockSize, amax, scale, outputD, input, m, n, stream);
+}
+
+hipblasStatus_t hipblasltFp8QuantizeRun(hipblasltExtFp8Scaling_t             scaling,
+                                        const hipblasltExtFp8QuantizeTensor* tensors,
+                                        uint32_t                             numTensors,
+                                        hipStream_t                          stream);
+
+hipblasStatus_t hipblasltExtFp8Quantize(hipblasltExtFp8Scaling_t             scaling,
+                                        const hipblasltExtFp8QuantizeTensor* tensors,
+                                        uint32_t                             numTensors,
+                                        hipStream_t                          stream)
+{
+    return hipblasltFp8QuantizeRun(scaling, tensors, numTensors, stream);
+}
+
+hipblasStatus_t hipblasltLayerNormAMaxWithScaleRun(const hipDataType datatype,
+                                                   const hipDataType outDatatype,
+                                                   void*             output,
+                                                   void*             amax,
+                                                   void*             mean,
+                                                   void*             invvar,
+                                                   void*             input,
+                                                   void*             inputScale,
+                                                   uint32_t          m,
+                                                   uint32_t          n,
+                                                   float             eps,
+                                                   void*             gamma,
+                                                   void*             beta,
+                                                   hipStream_t       stream);
+
+hipblasStatus_t hipblasltExtLayerNormAMaxWithScale(const hipDataType datatype,
+                                                   const hipDataType outDatatype,
+                                                   void*             output,
+                                                   void*             amax,
+                                                   void*             mean,
+                                                   void*             invvar,
+                                                   void*             input,
+                                                   void*             inputScale,
+                                                   uint32_t          m,
+                                                   uint32_t          n,
+                                                   float             eps,
+                                                   void*             gamma,
+                                                   void*             beta,
+                                                   hipStream_t       stream)
+{
+    return hipblasltLayerNormAMaxWithScaleRun(datatype,
+                                              outDatatype,
+                                              output,
+                                              amax,
+                                              mean,
+                                              invvar,
+                                              input,
+                                              inputScale,
+                                              m,
+                                              n,
+                                              eps,
+                                              gamma,
+                                              beta,
+                                              stream);
+}
+
+hipblasStatus_t hipblasltRMSNormRun(const hipDataType datatype,
+                                    const hipDataType outDatatype,
+                                    void*             output,
+                                    void*             residualOut,
+                                    void*             input,
+                                    void*             residual,
+                                    void*             gamma,
+                                    void*             outputScale,
+                                    uint32_t          m,
+                                    uint32_t          n,
+                                    float             eps,
+                                    hipStream_t       stream);
+
+hipblasStatus_t hipblasltExtRMSNorm(const hipDataType datatype,
+                                    const hipDataType outDatatype,
+                                    void*             output,
+                                    void*             residualOut,
+                                    void*             input,
+                                    void*             residual,
+                                    void*             gamma,
+                                    void*             outputScale,
+                                    uint32_t          m,
+                                    uint32_t          n,
+                                    float             eps,
+                                    hipStream_t       stream)
+{
+    return hipblasltRMSNormRun(datatype,
+                               outDatatype,
+                               output,
+                               residualOut,
+                               input,
+                               residual,
+                               gamma,
+                               outputScale,
+                               m,
+                               n,
+                               eps,
+                               stream);
+}
+
+hipblasStatus_t hipblasltLayerNormBackwardRun(hipDataType datatype,
+                                              void*       dInput,
+                                              void*       dGamma,
+                                              void*       dBeta,
+                                              void*       dOutput,
+                                              void*       input,
+                                              void*       mean,
+                                              void*       invvar,
+                                              void*       gamma,
+                                              uint32_t    m,
+                                              uint32_t    n,
+                                              hipStream_t stream);
+
+hipblasStatus_t hipblasltExtLayerNormBackward(hipDataType datatype,
+                                              void*       dInput,
+                                              void*       dGamma,
+                                              void*       dBeta,
+                                              void*       dOutput,
+                                              void*       input,
+                                              void*       mean,
+                                              void*       invvar,
+                                              void*       gamma,
+                                              uint32_t    m,
+                                              uint32_t    n,
+                                              hipStream_t stream)
+{
+    return hipblasltLayerNormBackwardRun(
+        datatype, dInput, dGamma, dBeta, dOutput, input, mean, invvar, gamma, m, n, stream);
+}
+
+hipblasStatus_t hipblasltSparseCompressRun(hipDataType        datatype,
+                                           hipblasOperation_t opA,
+                                           int64_t            m,
+                                           int64_t            k,
+                                           int64_t            lda,
+                                           int64_t            strideA,
+                                           int32_t            batchCount,
+                                           const void*        A,
+                                           void*              compressed,
+                                           void*              metadata,
+                                           hipStream_t        stream);
+
+hipblasStatus_t hipblasltExtSparseCompress(hipDataType        datatype,
+                                           hipblasOperation_t opA,
+                                           int64_t            m,
+                                           int64_t            k,
+                                           int64_t            lda,
+                                           int64_t            strideA,
+                                           int32_t            batchCount,
+                                           const void*        A,
+                                           void*              compressed,
+                                           void*              metadata,
+                                           hipStream_t        stream)
+{
+    return hipblasltSparseCompressRun(
+        datatype, opA, m, k, lda, strideA, batchCount, A, compressed, metadata, stream);
+}
+
 namespace
 {
     constexpr char DEFAULT_EXT_OP_LIBRARY_PATH[]
@@ -186,6 +487,8 @@ namespace
     {
         if(type == HIP_R_16F)
             return std::string("H");
+        else if(type == HIP_R_16BF)
+            return std::string("B");
         else if(type == HIP_R_32F)
             return std::string("S");
         return std::string("S");
@@ -196,29 +499,1520 @@ namespace
         return (m / tileM) + !!(m % tileM);
     }
 
-    inline uint32_t getSoftmaxBestKernelTileN(uint32_t n)
-    {
-        const uint32_t exponent = std::ceil(std::log2(n));
-        return 1 << exponent;
+    inline uint32_t getSoftmaxKernelTileM(uint32_t tileM)
+    {
+        return WORKGROUP_SIZE / tileM;
+    }
+
+    uint32_t elementNumBytes(hipDataType type)
+    {
+        if(type == HIP_R_16F || type == HIP_R_16BF)
+            return 2;
+        else if(type == HIP_R_32F)
+            return 4;
+        return 4;
+    }
+
+    inline uint32_t getLdsUsageByte(hipDataType datatype, uint32_t tileM, uint32_t tileN)
+    {
+        return elementNumBytes(datatype) * tileM * tileN;
+    }
+
+    // Rows longer than the widest library kernel are cut into slices, one workgroup
+    // per slice, so that a few very long rows still spread over the whole device
+    constexpr uint32_t ONLINE_SOFTMAX_SLICE_SIZE = WORKGROUP_SIZE * 16;
+
+    // Running max and sum of exp(x - max) of a part of a row
+    struct SoftmaxPartial
+    {
+        float max;
+        float sum;
+    };
+
+    __device__ inline SoftmaxPartial combineSoftmaxPartials(SoftmaxPartial a, SoftmaxPartial b)
+    {
+        const float max = fmaxf(a.max, b.max);
+
+        // Both empty or fully masked, keep -inf without computing exp(-inf + inf)
+        if(max == -INFINITY)
+            return {max, 0.f};
+
+        return {max, a.sum * __expf(a.max - max) + b.sum * __expf(b.max - max)};
+    }
+
+    // Tree reduction over a workgroup of WORKGROUP_SIZE threads, every thread gets
+    // the result and may start another reduction right away
+    template <typename T, typename Op>
+    __device__ inline T reduceWorkgroup(T value, Op op)
+    {
+        __shared__ T values[WORKGROUP_SIZE];
+
+        values[threadIdx.x] = value;
+        __syncthreads();
+
+        for(uint32_t stride = WORKGROUP_SIZE / 2; stride > 0; stride >>= 1)
+        {
+            if(threadIdx.x < stride)
+                values[threadIdx.x] = op(values[threadIdx.x], values[threadIdx.x + stride]);
+            __syncthreads();
+        }
+
+        T result = values[0];
+        __syncthreads();
+        return result;
+    }
+
+    __device__ inline SoftmaxPartial reduceSoftmaxPartial(SoftmaxPartial p)
+    {
+        return reduceWorkgroup(
+            p, [](SoftmaxPartial a, SoftmaxPartial b) { return combineSoftmaxPartials(a, b); });
+    }
+
+    // Grid is (rows, slices), each workgroup streams its slice once and stores its
+    // max and sum, rescaled on the fly whenever the max grows
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void onlineSoftmaxPartials(
+        const T* input, SoftmaxPartial* partials, uint32_t n)
+    {
+        const size_t   row   = blockIdx.x;
+        const uint32_t begin = blockIdx.y * ONLINE_SOFTMAX_SLICE_SIZE;
+        const uint32_t end   = min(n, begin + ONLINE_SOFTMAX_SLICE_SIZE);
+        const T*       x     = input + row * n;
+
+        SoftmaxPartial p{-INFINITY, 0.f};
+        for(uint32_t i = begin + threadIdx.x; i < end; i += WORKGROUP_SIZE)
+            p = combineSoftmaxPartials(p, {float(x[i]), 1.f});
+
+        p = reduceSoftmaxPartial(p);
+        if(threadIdx.x == 0)
+            partials[row * gridDim.y + blockIdx.y] = p;
+    }
+
+    // Same grid, each workgroup merges the partials of its row and writes its slice;
+    // output may alias input
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void onlineSoftmaxNormalize(
+        const T* input, T* output, const SoftmaxPartial* partials, uint32_t n)
+    {
+        const size_t   row   = blockIdx.x;
+        const uint32_t begin = blockIdx.y * ONLINE_SOFTMAX_SLICE_SIZE;
+        const uint32_t end   = min(n, begin + ONLINE_SOFTMAX_SLICE_SIZE);
+
+        SoftmaxPartial p{-INFINITY, 0.f};
+        for(uint32_t s = threadIdx.x; s < gridDim.y; s += WORKGROUP_SIZE)
+            p = combineSoftmaxPartials(p, partials[row * gridDim.y + s]);
+        p = reduceSoftmaxPartial(p);
+
+        const float scale = 1.f / p.sum;
+        for(uint32_t i = begin + threadIdx.x; i < end; i += WORKGROUP_SIZE)
+            output[row * n + i] = T(__expf(float(input[row * n + i]) - p.max) * scale);
+    }
+
+    template <typename T>
+    hipblasStatus_t launchOnlineSoftmax(
+        uint32_t m, uint32_t n, void* output, void* input, hipStream_t stream)
+    {
+        const uint32_t  slices = (n + ONLINE_SOFTMAX_SLICE_SIZE - 1) / ONLINE_SOFTMAX_SLICE_SIZE;
+        SoftmaxPartial* partials{};
+
+        // Stream ordered, so concurrent calls on other streams get their own buffer
+        if(hipMallocAsync(reinterpret_cast<void**>(&partials),
+                          sizeof(SoftmaxPartial) * m * slices,
+                          stream)
+           != hipSuccess)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        hipLaunchKernelGGL((onlineSoftmaxPartials<T>),
+                           dim3(m, slices),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<const T*>(input),
+                           partials,
+                           n);
+        hipLaunchKernelGGL((onlineSoftmaxNormalize<T>),
+                           dim3(m, slices),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<const T*>(input),
+                           static_cast<T*>(output),
+                           partials,
+                           n);
+        auto err = hipGetLastError();
+
+        if(hipFreeAsync(partials, stream) != hipSuccess || err != hipSuccess)
+        {
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Grid is (rows, batch), one workgroup per row. The logits scale * x + bias
+    // are recomputed in the normalize pass instead of being stored; masked
+    // columns past the causal limit are neither read nor counted.
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void scaleMaskSoftmax(T*       output,
+                                                                        int64_t  strideOutput,
+                                                                        const T* input,
+                                                                        int64_t  strideInput,
+                                                                        const T* bias,
+                                                                        int64_t  biasRowStride,
+                                                                        int64_t  biasBatchStride,
+                                                                        uint32_t m,
+                                                                        uint32_t n,
+                                                                        float    scale,
+                                                                        bool     causal)
+    {
+        const uint32_t row   = blockIdx.x;
+        const size_t   batch = blockIdx.y;
+        const T*       x     = input + batch * strideInput + size_t(row) * n;
+        T*             y     = output + batch * strideOutput + size_t(row) * n;
+        const T*       b     = bias ? bias + batch * biasBatchStride + row * biasRowStride : nullptr;
+
+        // Columns [0, end) are visible to this row
+        const int64_t  limit = causal ? int64_t(row) + n - m + 1 : n;
+        const uint32_t end   = uint32_t(max(int64_t(0), min(limit, int64_t(n))));
+
+        auto logit = [&](uint32_t i) {
+            return b ? scale * float(x[i]) + float(b[i]) : scale * float(x[i]);
+        };
+
+        SoftmaxPartial p{-INFINITY, 0.f};
+        for(uint32_t i = threadIdx.x; i < end; i += WORKGROUP_SIZE)
+            p = combineSoftmaxPartials(p, {logit(i), 1.f});
+        p = reduceSoftmaxPartial(p);
+
+        const float rsum = p.sum > 0.f ? 1.f / p.sum : 0.f;
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+            y[i] = T(i < end ? __expf(logit(i) - p.max) * rsum : 0.f);
+    }
+
+    template <typename T>
+    hipblasStatus_t launchScaleMaskSoftmax(uint32_t    m,
+                                           uint32_t    n,
+                                           uint32_t    batchCount,
+                                           void*       output,
+                                           int64_t     strideOutput,
+                                           void*       input,
+                                           int64_t     strideInput,
+                                           float       scale,
+                                           bool        causal,
+                                           void*       bias,
+                                           int64_t     biasRowStride,
+                                           int64_t     biasBatchStride,
+                                           hipStream_t stream)
+    {
+        hipLaunchKernelGGL((scaleMaskSoftmax<T>),
+                           dim3(m, batchCount),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<T*>(output),
+                           strideOutput,
+                           static_cast<const T*>(input),
+                           strideInput,
+                           static_cast<const T*>(bias),
+                           biasRowStride,
+                           biasBatchStride,
+                           m,
+                           n,
+                           scale,
+                           causal);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    constexpr uint32_t ATTENTION_MAX_HEAD_DIM = 256;
+    constexpr uint32_t ATTENTION_TILE_Q       = 16;
+    constexpr uint32_t ATTENTION_TILE_K       = 64;
+
+    // Grid is (query tiles, heads, batch). Each workgroup keeps the running max, sum
+    // and output of ATTENTION_TILE_Q query rows in LDS and streams the keys and values
+    // of its head once in tiles of ATTENTION_TILE_K, rescaling the output whenever a
+    // row max grows, so the scores of a tile are the only ones ever stored.
+    template <typename Ti, typename To>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void fusedAttention(To*       output,
+                                                                      const Ti* q,
+                                                                      const Ti* k,
+                                                                      const Ti* v,
+                                                                      uint32_t  numHeads,
+                                                                      uint32_t  numKvHeads,
+                                                                      uint32_t  seqQ,
+                                                                      uint32_t  seqK,
+                                                                      uint32_t  headDim,
+                                                                      float     scale,
+                                                                      float     outputScale,
+                                                                      bool      causal)
+    {
+        __shared__ float          qTile[ATTENTION_TILE_Q * ATTENTION_MAX_HEAD_DIM];
+        __shared__ float          oTile[ATTENTION_TILE_Q * ATTENTION_MAX_HEAD_DIM];
+        __shared__ float          sTile[ATTENTION_TILE_Q * ATTENTION_TILE_K];
+        __shared__ SoftmaxPartial rows[ATTENTION_TILE_Q];
+        __shared__ float          rescale[ATTENTION_TILE_Q];
+
+        const uint32_t q0       = blockIdx.x * ATTENTION_TILE_Q;
+        const uint32_t numQ     = min(ATTENTION_TILE_Q, seqQ - q0);
+        const uint32_t head     = blockIdx.y;
+        const uint32_t kvHead   = head / (numHeads / numKvHeads);
+        const size_t   batch    = blockIdx.z;
+        const size_t   qStride  = size_t(numHeads) * headDim;
+        const size_t   kvStride = size_t(numKvHeads) * headDim;
+
+        q += (batch * seqQ + q0) * qStride + head * headDim;
+        output += (batch * seqQ + q0) * qStride + head * headDim;
+        k += batch * seqK * kvStride + kvHead * headDim;
+        v += batch * seqK * kvStride + kvHead * headDim;
+
+        // Keys [0, limit(i)) are visible to query row q0 + i
+        auto limit = [&](uint32_t i) {
+            return causal ? int64_t(q0) + i + seqK - seqQ + 1 : int64_t(seqK);
+        };
+        const uint32_t end = uint32_t(max(int64_t(0), min(limit(numQ - 1), int64_t(seqK))));
+
+        for(uint32_t e = threadIdx.x; e < ATTENTION_TILE_Q * headDim; e += WORKGROUP_SIZE)
+        {
+            const uint32_t i = e / headDim;
+            qTile[e]         = i < numQ ? scale * float(q[i * qStride + e % headDim]) : 0.f;
+            oTile[e]         = 0.f;
+        }
+        if(threadIdx.x < ATTENTION_TILE_Q)
+            rows[threadIdx.x] = {-INFINITY, 0.f};
+        __syncthreads();
+
+        for(uint32_t k0 = 0; k0 < end; k0 += ATTENTION_TILE_K)
+        {
+            const uint32_t numK = min(ATTENTION_TILE_K, end - k0);
+
+            for(uint32_t e = threadIdx.x; e < ATTENTION_TILE_Q * ATTENTION_TILE_K;
+                e += WORKGROUP_SIZE)
+            {
+                const uint32_t i = e / ATTENTION_TILE_K;
+                const uint32_t j = e % ATTENTION_TILE_K;
+                float          s = -INFINITY;
+                if(i < numQ && j < numK && k0 + j < limit(i))
+                {
+                    const Ti*    key = k + (k0 + j) * kvStride;
+                    const float* qi  = qTile + i * headDim;
+                    s                = 0.f;
+                    for(uint32_t d = 0; d < headDim; d++)
+                        s += qi[d] * float(key[d]);
+                }
+                sTile[e] = s;
+            }
+            __syncthreads();
+
+            // One thread per row folds the tile into the running max and sum and turns
+            // its logits into exp(s - max)
+            if(threadIdx.x < ATTENTION_TILE_Q)
+            {
+                float*         s      = sTile + threadIdx.x * ATTENTION_TILE_K;
+                SoftmaxPartial row    = rows[threadIdx.x];
+                float          rowMax = row.max;
+                for(uint32_t j = 0; j < numK; j++)
+                    rowMax = fmaxf(rowMax, s[j]);
+
+                // Fully masked so far, keep -inf without computing exp(-inf + inf)
+                const float alpha = rowMax == -INFINITY ? 1.f : __expf(row.max - rowMax);
+                float       sum   = row.sum * alpha;
+                for(uint32_t j = 0; j < numK; j++)
+                {
+                    s[j] = rowMax == -INFINITY ? 0.f : __expf(s[j] - rowMax);
+                    sum += s[j];
+                }
+                rows[threadIdx.x]    = {rowMax, sum};
+                rescale[threadIdx.x] = alpha;
+            }
+            __syncthreads();
+
+            for(uint32_t e = threadIdx.x; e < ATTENTION_TILE_Q * headDim; e += WORKGROUP_SIZE)
+            {
+                const uint32_t i   = e / headDim;
+                const uint32_t d   = e % headDim;
+                const float*   p   = sTile + i * ATTENTION_TILE_K;
+                float          acc = oTile[e] * rescale[i];
+                for(uint32_t j = 0; j < numK; j++)
+                    acc += p[j] * float(v[(k0 + j) * kvStride + d]);
+                oTile[e] = acc;
+            }
+            __syncthreads();
+        }
+
+        for(uint32_t e = threadIdx.x; e < numQ * headDim; e += WORKGROUP_SIZE)
+        {
+            const float sum = rows[e / headDim].sum;
+            output[(e / headDim) * qStride + e % headDim]
+                = To(sum > 0.f ? outputScale * oTile[e] / sum : 0.f);
+        }
+    }
+
+    template <typename Ti, typename To>
+    hipblasStatus_t launchFusedAttention(uint32_t    batchCount,
+                                         uint32_t    numHeads,
+                                         uint32_t    numKvHeads,
+                                         uint32_t    seqQ,
+                                         uint32_t    seqK,
+                                         uint32_t    headDim,
+                                         void*       output,
+                                         const void* q,
+                                         const void* k,
+                                         const void* v,
+                                         float       scale,
+                                         float       outputScale,
+                                         bool        causal,
+                                         hipStream_t stream)
+    {
+        const uint32_t queryTiles = (seqQ + ATTENTION_TILE_Q - 1) / ATTENTION_TILE_Q;
+        hipLaunchKernelGGL((fusedAttention<Ti, To>),
+                           dim3(queryTiles, numHeads, batchCount),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<To*>(output),
+                           static_cast<const Ti*>(q),
+                           static_cast<const Ti*>(k),
+                           static_cast<const Ti*>(v),
+                           numHeads,
+                           numKvHeads,
+                           seqQ,
+                           seqK,
+                           headDim,
+                           scale,
+                           outputScale,
+                           causal);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Calls f with null pointers of the input and output element types of the attention
+    template <typename F>
+    hipblasStatus_t dispatchAttentionTypes(hipDataType inputType, hipDataType outputType, F&& f)
+    {
+        auto withInput = [&](auto* ti) {
+            switch(outputType)
+            {
+            case HIP_R_32F:
+                return f(ti, static_cast<float*>(nullptr));
+            case HIP_R_16F:
+                return f(ti, static_cast<_Float16*>(nullptr));
+            case HIP_R_16BF:
+                return f(ti, static_cast<hip_bfloat16*>(nullptr));
+            default:
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+            }
+        };
+
+        switch(inputType)
+        {
+        case HIP_R_32F:
+            return withInput(static_cast<float*>(nullptr));
+        case HIP_R_16F:
+            return withInput(static_cast<_Float16*>(nullptr));
+        case HIP_R_16BF:
+            return withInput(static_cast<hip_bfloat16*>(nullptr));
+        case HIP_R_8F_E4M3_FNUZ:
+            return withInput(static_cast<hipblaslt_f8_fnuz*>(nullptr));
+        case HIP_R_8F_E5M2_FNUZ:
+            return withInput(static_cast<hipblaslt_bf8_fnuz*>(nullptr));
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    // Count, mean and sum of squared deviations of a part of a row
+    struct RowMoments
+    {
+        float count;
+        float mean;
+        float m2;
+    };
+
+    __device__ inline RowMoments combineRowMoments(RowMoments a, RowMoments b)
+    {
+        const float count = a.count + b.count;
+
+        if(count == 0.f)
+            return a;
+
+        const float delta = b.mean - a.mean;
+        return {count,
+                a.mean + delta * (b.count / count),
+                a.m2 + b.m2 + delta * delta * (a.count * b.count / count)};
+    }
+
+    // Welford over the strided elements of a row seen by one thread, then merged
+    // over the workgroup
+    template <typename T>
+    __device__ inline RowMoments rowMoments(const T* x, uint32_t n)
+    {
+        RowMoments s{0.f, 0.f, 0.f};
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+        {
+            const float v     = float(x[i]);
+            const float delta = v - s.mean;
+            s.count += 1.f;
+            s.mean += delta / s.count;
+            s.m2 += delta * (v - s.mean);
+        }
+
+        return reduceWorkgroup(
+            s, [](RowMoments a, RowMoments b) { return combineRowMoments(a, b); });
+    }
+
+    // One workgroup per row: the statistics pass and the normalize pass read the
+    // same row, so the second one is served from cache and the activation makes a
+    // single trip through memory. amax is combined across rows as the bits of a
+    // non-negative float, whose order matches the order of the values.
+    template <typename Ti, typename To>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void layerNormAMaxWithScale(To*          output,
+                                                                              float*       amax,
+                                                                              float*       mean,
+                                                                              float*       invvar,
+                                                                              const Ti*    input,
+                                                                              const float* scale,
+                                                                              uint32_t     n,
+                                                                              float        eps,
+                                                                              const Ti*    gamma,
+                                                                              const Ti*    beta)
+    {
+        const size_t row = blockIdx.x;
+        const Ti*    x   = input + row * n;
+
+        const RowMoments s    = rowMoments(x, n);
+        const float      rstd = rsqrtf(s.m2 / n + eps);
+
+        if(threadIdx.x == 0)
+        {
+            if(mean)
+                mean[row] = s.mean;
+            if(invvar)
+                invvar[row] = rstd;
+        }
+
+        const float scaleValue = *scale;
+        float       rowAmax    = 0.f;
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+        {
+            float y = (float(x[i]) - s.mean) * rstd;
+            if(gamma)
+                y *= float(gamma[i]);
+            if(beta)
+                y += float(beta[i]);
+
+            rowAmax             = fmaxf(rowAmax, fabsf(y));
+            output[row * n + i] = To(y * scaleValue);
+        }
+
+        rowAmax = reduceWorkgroup(rowAmax, [](float a, float b) { return fmaxf(a, b); });
+        if(threadIdx.x == 0)
+            atomicMax(reinterpret_cast<unsigned int*>(amax), __float_as_uint(rowAmax));
+    }
+
+    template <typename Ti, typename To>
+    hipblasStatus_t launchLayerNormAMaxWithScaleKernel(void*       output,
+                                                       void*       amax,
+                                                       void*       mean,
+                                                       void*       invvar,
+                                                       void*       input,
+                                                       void*       scale,
+                                                       uint32_t    m,
+                                                       uint32_t    n,
+                                                       float       eps,
+                                                       void*       gamma,
+                                                       void*       beta,
+                                                       hipStream_t stream)
+    {
+        if(hipMemsetAsync(amax, 0, sizeof(float), stream) != hipSuccess)
+        {
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        hipLaunchKernelGGL((layerNormAMaxWithScale<Ti, To>),
+                           dim3(m),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<To*>(output),
+                           static_cast<float*>(amax),
+                           static_cast<float*>(mean),
+                           static_cast<float*>(invvar),
+                           static_cast<const Ti*>(input),
+                           static_cast<const float*>(scale),
+                           n,
+                           eps,
+                           static_cast<const Ti*>(gamma),
+                           static_cast<const Ti*>(beta));
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    template <typename Ti>
+    hipblasStatus_t launchLayerNormAMaxWithScale(hipDataType outDatatype,
+                                                 void*       output,
+                                                 void*       amax,
+                                                 void*       mean,
+                                                 void*       invvar,
+                                                 void*       input,
+                                                 void*       scale,
+                                                 uint32_t    m,
+                                                 uint32_t    n,
+                                                 float       eps,
+                                                 void*       gamma,
+                                                 void*       beta,
+                                                 hipStream_t stream)
+    {
+        if(outDatatype == HIP_R_8F_E4M3_FNUZ)
+            return launchLayerNormAMaxWithScaleKernel<Ti, hipblaslt_f8_fnuz>(
+                output, amax, mean, invvar, input, scale, m, n, eps, gamma, beta, stream);
+        return launchLayerNormAMaxWithScaleKernel<Ti, hipblaslt_bf8_fnuz>(
+            output, amax, mean, invvar, input, scale, m, n, eps, gamma, beta, stream);
+    }
+
+    // One workgroup per row. When residualOut is set the first pass stores the sum
+    // there and the second pass reads it back, which keeps residualOut aliasing
+    // residual or input correct; otherwise the second pass adds again from cache.
+    template <typename Ti, typename To>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void rmsNorm(To*          output,
+                                                              Ti*          residualOut,
+                                                              const Ti*    input,
+                                                              const Ti*    residual,
+                                                              const Ti*    gamma,
+                                                              const float* scale,
+                                                              uint32_t     n,
+                                                              float        eps)
+    {
+        const size_t row = blockIdx.x;
+        const Ti*    x   = input + row * n;
+        const Ti*    r   = residual ? residual + row * n : nullptr;
+        Ti*          sum = residualOut ? residualOut + row * n : nullptr;
+
+        float squares = 0.f;
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+        {
+            float v = float(x[i]);
+            if(r)
+                v += float(r[i]);
+            if(sum)
+            {
+                const Ti rounded = Ti(v);
+                sum[i]           = rounded;
+                v                = float(rounded);
+            }
+            squares += v * v;
+        }
+
+        squares = reduceWorkgroup(squares, [](float a, float b) { return a + b; });
+        const float rrms       = rsqrtf(squares / n + eps);
+        const float scaleValue = scale ? *scale : 1.f;
+
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+        {
+            float v;
+            if(sum)
+                v = float(sum[i]);
+            else
+                v = r ? float(x[i]) + float(r[i]) : float(x[i]);
+
+            v *= rrms;
+            if(gamma)
+                v *= float(gamma[i]);
+            output[row * n + i] = To(v * scaleValue);
+        }
+    }
+
+    template <typename Ti, typename To>
+    hipblasStatus_t launchRMSNormKernel(void*       output,
+                                        void*       residualOut,
+                                        void*       input,
+                                        void*       residual,
+                                        void*       gamma,
+                                        void*       scale,
+                                        uint32_t    m,
+                                        uint32_t    n,
+                                        float       eps,
+                                        hipStream_t stream)
+    {
+        hipLaunchKernelGGL((rmsNorm<Ti, To>),
+                           dim3(m),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<To*>(output),
+                           static_cast<Ti*>(residualOut),
+                           static_cast<const Ti*>(input),
+                           static_cast<const Ti*>(residual),
+                           static_cast<const Ti*>(gamma),
+                           static_cast<const float*>(scale),
+                           n,
+                           eps);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    template <typename Ti>
+    hipblasStatus_t launchRMSNorm(hipDataType outDatatype,
+                                  void*       output,
+                                  void*       residualOut,
+                                  void*       input,
+                                  void*       residual,
+                                  void*       gamma,
+                                  void*       scale,
+                                  uint32_t    m,
+                                  uint32_t    n,
+                                  float       eps,
+                                  hipStream_t stream)
+    {
+        if(outDatatype == HIP_R_8F_E4M3_FNUZ)
+            return launchRMSNormKernel<Ti, hipblaslt_f8_fnuz>(
+                output, residualOut, input, residual, gamma, scale, m, n, eps, stream);
+        else if(outDatatype == HIP_R_8F_E5M2_FNUZ)
+            return launchRMSNormKernel<Ti, hipblaslt_bf8_fnuz>(
+                output, residualOut, input, residual, gamma, scale, m, n, eps, stream);
+        return launchRMSNormKernel<Ti, Ti>(
+            output, residualOut, input, residual, gamma, scale, m, n, eps, stream);
+    }
+
+    // Rows summed by one workgroup of the first dgamma/dbeta stage
+    constexpr uint32_t LAYERNORM_BACKWARD_ROWS_PER_PARTIAL = 64;
+
+    struct LayerNormGradSums
+    {
+        float first;
+        float second;
+    };
+
+    // One workgroup per row:
+    // dx = invvar * (g - mean(g) - xhat * mean(g * xhat)) with g = dy * gamma
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void layerNormBackwardInput(T*           dInput,
+                                                                              const T*     dOutput,
+                                                                              const T*     input,
+                                                                              const float* mean,
+                                                                              const float* invvar,
+                                                                              const T*     gamma,
+                                                                              uint32_t     n)
+    {
+        const size_t row  = blockIdx.x;
+        const T*     dy   = dOutput + row * n;
+        const T*     x    = input + row * n;
+        const float  mu   = mean[row];
+        const float  rstd = invvar[row];
+
+        // Sums of g and of g * xhat
+        LayerNormGradSums sums{0.f, 0.f};
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+        {
+            const float g    = gamma ? float(dy[i]) * float(gamma[i]) : float(dy[i]);
+            const float xhat = (float(x[i]) - mu) * rstd;
+            sums.first += g;
+            sums.second += g * xhat;
+        }
+
+        sums = reduceWorkgroup(sums, [](LayerNormGradSums a, LayerNormGradSums b) {
+            return LayerNormGradSums{a.first + b.first, a.second + b.second};
+        });
+        const float meanG     = sums.first / n;
+        const float meanGXhat = sums.second / n;
+
+        for(uint32_t i = threadIdx.x; i < n; i += WORKGROUP_SIZE)
+        {
+            const float g    = gamma ? float(dy[i]) * float(gamma[i]) : float(dy[i]);
+            const float xhat = (float(x[i]) - mu) * rstd;
+            dInput[row * n + i] = T(rstd * (g - meanG - xhat * meanGXhat));
+        }
+    }
+
+    // Grid is (column tiles, row blocks), a thread per column sums dy * xhat and dy
+    // over LAYERNORM_BACKWARD_ROWS_PER_PARTIAL rows in order
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void layerNormBackwardGammaBetaPartials(
+        LayerNormGradSums* partials,
+        const T*           dOutput,
+        const T*           input,
+        const float*       mean,
+        const float*       invvar,
+        uint32_t           m,
+        uint32_t           n)
+    {
+        const uint32_t col   = blockIdx.x * WORKGROUP_SIZE + threadIdx.x;
+        const uint32_t begin = blockIdx.y * LAYERNORM_BACKWARD_ROWS_PER_PARTIAL;
+        const uint32_t end   = min(m, begin + LAYERNORM_BACKWARD_ROWS_PER_PARTIAL);
+
+        if(col >= n)
+            return;
+
+        // Sums of dy * xhat and of dy
+        LayerNormGradSums sums{0.f, 0.f};
+        for(uint32_t row = begin; row < end; row++)
+        {
+            const float dy   = float(dOutput[size_t(row) * n + col]);
+            const float xhat = (float(input[size_t(row) * n + col]) - mean[row]) * invvar[row];
+            sums.first += dy * xhat;
+            sums.second += dy;
+        }
+
+        partials[size_t(blockIdx.y) * n + col] = sums;
+    }
+
+    // A thread per column adds the partials of all row blocks in order, so the
+    // result does not depend on scheduling
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void layerNormBackwardGammaBeta(
+        T* dGamma, T* dBeta, const LayerNormGradSums* partials, uint32_t rowBlocks, uint32_t n)
+    {
+        const uint32_t col = blockIdx.x * WORKGROUP_SIZE + threadIdx.x;
+
+        if(col >= n)
+            return;
+
+        LayerNormGradSums sums{0.f, 0.f};
+        for(uint32_t b = 0; b < rowBlocks; b++)
+        {
+            const auto& p = partials[size_t(b) * n + col];
+            sums.first += p.first;
+            sums.second += p.second;
+        }
+
+        if(dGamma)
+            dGamma[col] = T(sums.first);
+        if(dBeta)
+            dBeta[col] = T(sums.second);
+    }
+
+    template <typename T>
+    hipblasStatus_t launchLayerNormBackward(void*       dInput,
+                                            void*       dGamma,
+                                            void*       dBeta,
+                                            void*       dOutput,
+                                            void*       input,
+                                            void*       mean,
+                                            void*       invvar,
+                                            void*       gamma,
+                                            uint32_t    m,
+                                            uint32_t    n,
+                                            hipStream_t stream)
+    {
+        if(dInput)
+            hipLaunchKernelGGL((layerNormBackwardInput<T>),
+                               dim3(m),
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               static_cast<T*>(dInput),
+                               static_cast<const T*>(dOutput),
+                               static_cast<const T*>(input),
+                               static_cast<const float*>(mean),
+                               static_cast<const float*>(invvar),
+                               static_cast<const T*>(gamma),
+                               n);
+
+        if(dGamma || dBeta)
+        {
+            const uint32_t     rowBlocks = (m + LAYERNORM_BACKWARD_ROWS_PER_PARTIAL - 1)
+                                       / LAYERNORM_BACKWARD_ROWS_PER_PARTIAL;
+            const uint32_t     colTiles  = (n + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+            LayerNormGradSums* partials{};
+
+            if(hipMallocAsync(reinterpret_cast<void**>(&partials),
+                              sizeof(LayerNormGradSums) * rowBlocks * n,
+                              stream)
+               != hipSuccess)
+            {
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+
+            hipLaunchKernelGGL((layerNormBackwardGammaBetaPartials<T>),
+                               dim3(colTiles, rowBlocks),
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               partials,
+                               static_cast<const T*>(dOutput),
+                               static_cast<const T*>(input),
+                               static_cast<const float*>(mean),
+                               static_cast<const float*>(invvar),
+                               m,
+                               n);
+            hipLaunchKernelGGL((layerNormBackwardGammaBeta<T>),
+                               dim3(colTiles),
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               static_cast<T*>(dGamma),
+                               static_cast<T*>(dBeta),
+                               partials,
+                               rowBlocks,
+                               n);
+
+            if(hipFreeAsync(partials, stream) != hipSuccess)
+            {
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            }
+        }
+
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Elements of op(A) along k described by one byte of 2:4 metadata
+    constexpr int64_t SPARSE_METADATA_GROUP = 8;
+
+    // A thread per 8 elements of a row of op(A) along k and a grid row per batch. Of
+    // every 4 elements the 2 of largest magnitude are kept in order, the first
+    // on ties, and their positions go to a nibble of the metadata byte, the lower
+    // nibble for the first 4. The compressed values of an A that is not transposed
+    // keep lda, those of a transposed one are packed.
+    template <typename T>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void sparseCompress(T*       compressed,
+                                                                      uint8_t* metadata,
+                                                                      const T* A,
+                                                                      bool     transA,
+                                                                      int64_t  m,
+                                                                      int64_t  k,
+                                                                      int64_t  lda,
+                                                                      int64_t  strideA)
+    {
+        const int64_t groups = k / SPARSE_METADATA_GROUP;
+        const int64_t idx    = int64_t(blockIdx.x) * WORKGROUP_SIZE + threadIdx.x;
+        if(idx >= groups * m)
+            return;
+
+        const int64_t row     = idx % m;
+        const int64_t group   = idx / m;
+        const int64_t ldc     = transA ? k / 2 : lda;
+        const T*      a       = A + blockIdx.y * strideA;
+        T*            c       = compressed + blockIdx.y * (transA ? k / 2 * m : lda * (k / 2));
+        auto          element = [transA, row](int64_t col, int64_t ld) {
+            return transA ? col + row * ld : row + col * ld;
+        };
+
+        uint8_t byte = 0;
+        for(int64_t half = 0; half < 2; half++)
+        {
+            const int64_t base = group * SPARSE_METADATA_GROUP + half * 4;
+            T             v[4];
+            float         mag[4];
+            for(int j = 0; j < 4; j++)
+            {
+                v[j]   = a[element(base + j, lda)];
+                mag[j] = fabsf(float(v[j]));
+            }
+
+            int first = 0;
+            for(int j = 1; j < 4; j++)
+                if(mag[j] > mag[first])
+                    first = j;
+            int second = first == 0 ? 1 : 0;
+            for(int j = 0; j < 4; j++)
+                if(j != first && mag[j] > mag[second])
+                    second = j;
+
+            const int     lo  = min(first, second);
+            const int     hi  = max(first, second);
+            const int64_t col = base / 2;
+            c[element(col, ldc)]     = v[lo];
+            c[element(col + 1, ldc)] = v[hi];
+            byte |= (lo | hi << 2) << (half * 4);
+        }
+
+        metadata[blockIdx.y * groups * m + group + row * groups] = byte;
+    }
+
+    template <typename T>
+    hipblasStatus_t launchSparseCompress(bool        transA,
+                                         int64_t     m,
+                                         int64_t     k,
+                                         int64_t     lda,
+                                         int64_t     strideA,
+                                         int32_t     batches,
+                                         const void* A,
+                                         void*       compressed,
+                                         void*       metadata,
+                                         hipStream_t stream)
+    {
+        const int64_t threads = k / SPARSE_METADATA_GROUP * m;
+        hipLaunchKernelGGL((sparseCompress<T>),
+                           dim3((threads + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, batches),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<T*>(compressed),
+                           static_cast<uint8_t*>(metadata),
+                           static_cast<const T*>(A),
+                           transA,
+                           m,
+                           k,
+                           lda,
+                           strideA);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Bytes of an element of a type that can be 2:4 compressed, 0 for any other type
+    size_t sparseElementSize(hipDataType datatype)
+    {
+        switch(datatype)
+        {
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_8I:
+        case HIP_R_8F_E4M3_FNUZ:
+        case HIP_R_8F_E5M2_FNUZ:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    hipblasStatus_t validateSparseCompress(hipDataType        datatype,
+                                           hipblasOperation_t opA,
+                                           int64_t            m,
+                                           int64_t            k,
+                                           int64_t            lda,
+                                           int32_t            batchCount)
+    {
+        if(!sparseElementSize(datatype) || (opA != HIPBLAS_OP_N && opA != HIPBLAS_OP_T))
+        {
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        if(m <= 0 || k <= 0 || k % SPARSE_METADATA_GROUP || batchCount <= 0
+           || lda < (opA == HIPBLAS_OP_N ? m : k))
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    bool getNumCUs(uint32_t& numCUs)
+    {
+        int deviceId{};
+        int value{};
+        if(hipGetDevice(&deviceId) != hipSuccess
+           || hipDeviceGetAttribute(&value, hipDeviceAttributeMultiprocessorCount, deviceId)
+                  != hipSuccess)
+        {
+            return false;
+        }
+
+        numCUs = value;
+        return true;
+    }
+
+    // Elements per unit of work of the multi-tensor amax grid
+    constexpr uint32_t MULTI_TENSOR_AMAX_CHUNK_SIZE = WORKGROUP_SIZE * 16;
+    // Persistent workgroups of the amax grids per compute unit
+    constexpr uint32_t AMAX_WORKGROUPS_PER_CU = 4;
+
+    template <typename T>
+    __device__ inline float chunkAMax(const void* input, size_t begin, size_t end)
+    {
+        const T* x    = static_cast<const T*>(input);
+        float    amax = 0.f;
+        for(size_t i = begin + threadIdx.x; i < end; i += WORKGROUP_SIZE)
+            amax = fmaxf(amax, fabsf(float(x[i])));
+        return amax;
+    }
+
+    // The chunks of all tensors are numbered one after the other and workgroup b
+    // takes every chunk whose number is b modulo the grid size, so the work is
+    // balanced whatever the mix of sizes. Per-tensor results are combined in
+    // scratch as the bits of a non-negative float; the last workgroup to finish
+    // converts them to the output type.
+    template <typename To>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void multiTensorAMax(
+        const hipblasltExtAMaxTensor* tensors, uint32_t numTensors, float* amax, uint32_t* doneCount)
+    {
+        size_t chunkBase = 0;
+        for(uint32_t t = 0; t < numTensors; t++)
+        {
+            const hipblasltExtAMaxTensor tensor = tensors[t];
+            const size_t                 len    = size_t(tensor.m) * tensor.n;
+            const size_t chunks = (len + MULTI_TENSOR_AMAX_CHUNK_SIZE - 1) / MULTI_TENSOR_AMAX_CHUNK_SIZE;
+            const size_t first  = (blockIdx.x + gridDim.x - chunkBase % gridDim.x) % gridDim.x;
+            chunkBase += chunks;
+
+            // Uniform over the workgroup, so the reduction below is reached by all threads
+            if(first >= chunks)
+                continue;
+
+            float tensorAmax = 0.f;
+            for(size_t c = first; c < chunks; c += gridDim.x)
+            {
+                const size_t begin = c * MULTI_TENSOR_AMAX_CHUNK_SIZE;
+                const size_t end   = min(len, begin + MULTI_TENSOR_AMAX_CHUNK_SIZE);
+                float        a;
+                if(tensor.datatype == HIP_R_16F)
+                    a = chunkAMax<_Float16>(tensor.input, begin, end);
+                else if(tensor.datatype == HIP_R_16BF)
+                    a = chunkAMax<hip_bfloat16>(tensor.input, begin, end);
+                else
+                    a = chunkAMax<float>(tensor.input, begin, end);
+                tensorAmax = fmaxf(tensorAmax, a);
+            }
+
+            tensorAmax = reduceWorkgroup(tensorAmax, [](float a, float b) { return fmaxf(a, b); });
+            if(threadIdx.x == 0)
+                atomicMax(reinterpret_cast<unsigned int*>(amax + t), __float_as_uint(tensorAmax));
+        }
+
+        __shared__ bool isLast;
+        __threadfence();
+        if(threadIdx.x == 0)
+            isLast = atomicAdd(doneCount, 1u) == gridDim.x - 1;
+        __syncthreads();
+
+        if(!isLast)
+            return;
+
+        for(uint32_t t = threadIdx.x; t < numTensors; t += WORKGROUP_SIZE)
+        {
+            const float value = __uint_as_float(
+                atomicOr(reinterpret_cast<unsigned int*>(amax + t), 0u));
+            *static_cast<To*>(tensors[t].output) = To(value);
+        }
+    }
+
+    template <typename To>
+    hipblasStatus_t launchMultiTensorAMax(const hipblasltExtAMaxTensor* tensors,
+                                          uint32_t                      numTensors,
+                                          hipStream_t                   stream)
+    {
+        uint32_t numCUs{};
+        if(!getNumCUs(numCUs))
+        {
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        // One float per tensor followed by the count of finished workgroups
+        const size_t scratchBytes = sizeof(float) * numTensors + sizeof(uint32_t);
+        float*       scratch{};
+
+        if(hipMallocAsync(reinterpret_cast<void**>(&scratch), scratchBytes, stream) != hipSuccess)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        auto err = hipMemsetAsync(scratch, 0, scratchBytes, stream);
+        if(err == hipSuccess)
+        {
+            hipLaunchKernelGGL((multiTensorAMax<To>),
+                               dim3(numCUs * AMAX_WORKGROUPS_PER_CU),
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               tensors,
+                               numTensors,
+                               scratch,
+                               reinterpret_cast<uint32_t*>(scratch + numTensors));
+            err = hipGetLastError();
+        }
+
+        if(hipFreeAsync(scratch, stream) != hipSuccess || err != hipSuccess)
+        {
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    constexpr float fp8MaxValue();
+
+    template <>
+    constexpr float fp8MaxValue<hipblaslt_f8_fnuz>()
+    {
+        return 240.f;
+    }
+
+    template <>
+    constexpr float fp8MaxValue<hipblaslt_bf8_fnuz>()
+    {
+        return 57344.f;
+    }
+
+    // Grid is (tile rows, tile columns), one workgroup per tile of tileM x tileN
+    // elements; a row is a tile of 1 x n. The quantize pass reads the tile again
+    // from cache. Scales are stored row-major over the tiles.
+    template <typename Ti, typename To>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void amaxWithBlockScale(To*       outputD,
+                                                                          float*    amax,
+                                                                          float*    scale,
+                                                                          const Ti* input,
+                                                                          uint32_t  m,
+                                                                          uint32_t  n,
+                                                                          uint32_t  tileM,
+                                                                          uint32_t  tileN)
+    {
+        const uint32_t row0  = blockIdx.x * tileM;
+        const uint32_t col0  = blockIdx.y * tileN;
+        const uint32_t rows  = min(tileM, m - row0);
+        const uint32_t cols  = min(tileN, n - col0);
+        const uint32_t count = rows * cols;
+        const size_t   tile  = size_t(blockIdx.x) * gridDim.y + blockIdx.y;
+
+        float tileAmax = 0.f;
+        for(uint32_t i = threadIdx.x; i < count; i += WORKGROUP_SIZE)
+        {
+            const size_t idx = size_t(row0 + i / cols) * n + col0 + i % cols;
+            tileAmax         = fmaxf(tileAmax, fabsf(float(input[idx])));
+        }
+
+        tileAmax = reduceWorkgroup(tileAmax, [](float a, float b) { return fmaxf(a, b); });
+        const float s   = tileAmax > 0.f ? tileAmax / fp8MaxValue<To>() : 1.f;
+        const float inv = 1.f / s;
+
+        if(threadIdx.x == 0)
+        {
+            if(amax)
+                amax[tile] = tileAmax;
+            scale[tile] = s;
+        }
+
+        for(uint32_t i = threadIdx.x; i < count; i += WORKGROUP_SIZE)
+        {
+            const size_t idx = size_t(row0 + i / cols) * n + col0 + i % cols;
+            outputD[idx]     = To(float(input[idx]) * inv);
+        }
+    }
+
+    template <typename Ti, typename To>
+    hipblasStatus_t launchAMaxWithBlockScaleKernel(hipblasltExtAMaxScaleMode_t mode,
+                                                   uint32_t                    blockSize,
+                                                   void*                       amax,
+                                                   void*                       scale,
+                                                   void*                       outputD,
+                                                   void*                       input,
+                                                   uint32_t                    m,
+                                                   uint32_t                    n,
+                                                   hipStream_t                 stream)
+    {
+        const uint32_t tileM = mode == HIPBLASLT_EXT_AMAX_SCALE_ROW ? 1 : blockSize;
+        const uint32_t tileN = mode == HIPBLASLT_EXT_AMAX_SCALE_ROW ? n : blockSize;
+
+        hipLaunchKernelGGL((amaxWithBlockScale<Ti, To>),
+                           dim3((m + tileM - 1) / tileM, (n + tileN - 1) / tileN),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<To*>(outputD),
+                           static_cast<float*>(amax),
+                           static_cast<float*>(scale),
+                           static_cast<const Ti*>(input),
+                           m,
+                           n,
+                           tileM,
+                           tileN);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    template <typename Ti>
+    hipblasStatus_t launchAMaxWithBlockScale(hipDataType                 scaleDatatype,
+                                             hipblasltExtAMaxScaleMode_t mode,
+                                             uint32_t                    blockSize,
+                                             void*                       amax,
+                                             void*                       scale,
+                                             void*                       outputD,
+                                             void*                       input,
+                                             uint32_t                    m,
+                                             uint32_t                    n,
+                                             hipStream_t                 stream)
+    {
+        if(scaleDatatype == HIP_R_8F_E4M3_FNUZ)
+            return launchAMaxWithBlockScaleKernel<Ti, hipblaslt_f8_fnuz>(
+                mode, blockSize, amax, scale, outputD, input, m, n, stream);
+        return launchAMaxWithBlockScaleKernel<Ti, hipblaslt_bf8_fnuz>(
+            mode, blockSize, amax, scale, outputD, input, m, n, stream);
+    }
+
+    // The tensors of one hipblasltExtFp8Quantize call, passed by value to the kernels
+    struct Fp8QuantizeTensors
+    {
+        hipblasltExtFp8QuantizeTensor tensor[HIPBLASLT_EXT_FP8_QUANTIZE_MAX_TENSORS];
+        uint32_t                      count;
+    };
+
+    template <typename Ti, typename To>
+    __device__ inline float
+        chunkFp8Quantize(const hipblasltExtFp8QuantizeTensor& tensor, size_t begin, size_t end)
+    {
+        const Ti*   x    = static_cast<const Ti*>(tensor.input);
+        To*         y    = static_cast<To*>(tensor.output);
+        const float inv  = 1.f / *static_cast<const float*>(tensor.scale);
+        float       amax = 0.f;
+        for(size_t i = begin + threadIdx.x; i < end; i += WORKGROUP_SIZE)
+        {
+            const float v = float(x[i]);
+            amax          = fmaxf(amax, fabsf(v));
+            y[i]          = To(v * inv);
+        }
+        return amax;
+    }
+
+    template <typename Ti>
+    __device__ inline float
+        chunkFp8Quantize(const hipblasltExtFp8QuantizeTensor& tensor, size_t begin, size_t end)
+    {
+        if(tensor.outDatatype == HIP_R_8F_E4M3_FNUZ)
+            return chunkFp8Quantize<Ti, hipblaslt_f8_fnuz>(tensor, begin, end);
+        return chunkFp8Quantize<Ti, hipblaslt_bf8_fnuz>(tensor, begin, end);
+    }
+
+    __device__ inline float
+        chunkFp8Quantize(const hipblasltExtFp8QuantizeTensor& tensor, size_t begin, size_t end)
+    {
+        if(tensor.datatype == HIP_R_16F)
+            return chunkFp8Quantize<_Float16>(tensor, begin, end);
+        if(tensor.datatype == HIP_R_16BF)
+            return chunkFp8Quantize<hip_bfloat16>(tensor, begin, end);
+        return chunkFp8Quantize<float>(tensor, begin, end);
+    }
+
+    __device__ inline float
+        chunkFp8AMax(const hipblasltExtFp8QuantizeTensor& tensor, size_t begin, size_t end)
+    {
+        if(tensor.datatype == HIP_R_16F)
+            return chunkAMax<_Float16>(tensor.input, begin, end);
+        if(tensor.datatype == HIP_R_16BF)
+            return chunkAMax<hip_bfloat16>(tensor.input, begin, end);
+        return chunkAMax<float>(tensor.input, begin, end);
+    }
+
+    // The passes are the amax pass of current scaling, which ends with the scales
+    // (Reduce only), the quantize pass of current scaling (Quantize only), and the
+    // single pass of delayed scaling (both). The chunks are dealt as in
+    // multiTensorAMax and the last workgroup to finish stores the amax and scales.
+    template <bool Quantize, bool Reduce>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void fp8Quantize(Fp8QuantizeTensors tensors,
+                                                                   float*             amax,
+                                                                   uint32_t*          doneCount)
+    {
+        size_t chunkBase = 0;
+        for(uint32_t t = 0; t < tensors.count; t++)
+        {
+            const hipblasltExtFp8QuantizeTensor& tensor = tensors.tensor[t];
+            const size_t                         len    = size_t(tensor.m) * tensor.n;
+            const size_t chunks = (len + MULTI_TENSOR_AMAX_CHUNK_SIZE - 1) / MULTI_TENSOR_AMAX_CHUNK_SIZE;
+            const size_t first  = (blockIdx.x + gridDim.x - chunkBase % gridDim.x) % gridDim.x;
+            chunkBase += chunks;
+
+            if(first >= chunks)
+                continue;
+
+            float tensorAmax = 0.f;
+            for(size_t c = first; c < chunks; c += gridDim.x)
+            {
+                const size_t begin = c * MULTI_TENSOR_AMAX_CHUNK_SIZE;
+                const size_t end   = min(len, begin + MULTI_TENSOR_AMAX_CHUNK_SIZE);
+                const float  a     = Quantize ? chunkFp8Quantize(tensor, begin, end)
+                                              : chunkFp8AMax(tensor, begin, end);
+                tensorAmax         = fmaxf(tensorAmax, a);
+            }
+
+            if(!Reduce)
+                continue;
+
+            tensorAmax = reduceWorkgroup(tensorAmax, [](float a, float b) { return fmaxf(a, b); });
+            if(threadIdx.x == 0)
+                atomicMax(reinterpret_cast<unsigned int*>(amax + t), __float_as_uint(tensorAmax));
+        }
+
+        if(!Reduce)
+            return;
+
+        __shared__ bool isLast;
+        __threadfence();
+        if(threadIdx.x == 0)
+            isLast = atomicAdd(doneCount, 1u) == gridDim.x - 1;
+        __syncthreads();
+
+        if(!isLast)
+            return;
+
+        for(uint32_t t = threadIdx.x; t < tensors.count; t += WORKGROUP_SIZE)
+        {
+            const hipblasltExtFp8QuantizeTensor& tensor = tensors.tensor[t];
+            const float                          value  = __uint_as_float(
+                atomicOr(reinterpret_cast<unsigned int*>(amax + t), 0u));
+            if(tensor.amax)
+                *static_cast<float*>(tensor.amax) = value;
+            if(!Quantize)
+            {
+                const float fp8Max = tensor.outDatatype == HIP_R_8F_E4M3_FNUZ
+                                         ? fp8MaxValue<hipblaslt_f8_fnuz>()
+                                         : fp8MaxValue<hipblaslt_bf8_fnuz>();
+                *static_cast<float*>(tensor.scale) = value > 0.f ? value / fp8Max : 1.f;
+            }
+        }
+    }
+
+    hipblasStatus_t launchFp8Quantize(hipblasltExtFp8Scaling_t  scaling,
+                                      const Fp8QuantizeTensors& tensors,
+                                      hipStream_t               stream)
+    {
+        uint32_t numCUs{};
+        if(!getNumCUs(numCUs))
+        {
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        // One float per tensor followed by the count of finished workgroups
+        const size_t scratchBytes = sizeof(float) * tensors.count + sizeof(uint32_t);
+        float*       scratch{};
+
+        if(hipMallocAsync(reinterpret_cast<void**>(&scratch), scratchBytes, stream) != hipSuccess)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        const dim3 grid(numCUs * AMAX_WORKGROUPS_PER_CU);
+        auto*      doneCount = reinterpret_cast<uint32_t*>(scratch + tensors.count);
+        auto       err       = hipMemsetAsync(scratch, 0, scratchBytes, stream);
+        if(err == hipSuccess && scaling == HIPBLASLT_EXT_FP8_SCALING_CURRENT)
+        {
+            hipLaunchKernelGGL((fp8Quantize<false, true>),
+                               grid,
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               tensors,
+                               scratch,
+                               doneCount);
+            hipLaunchKernelGGL((fp8Quantize<true, false>),
+                               grid,
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               tensors,
+                               nullptr,
+                               nullptr);
+            err = hipGetLastError();
+        }
+        else if(err == hipSuccess)
+        {
+            hipLaunchKernelGGL((fp8Quantize<true, true>),
+                               grid,
+                               dim3(WORKGROUP_SIZE),
+                               0,
+                               stream,
+                               tensors,
+                               scratch,
+                               doneCount);
+            err = hipGetLastError();
+        }
+
+        if(hipFreeAsync(scratch, stream) != hipSuccess || err != hipSuccess)
+        {
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Non-negative floats and halves order like their bits. A half is updated with a
+    // compare and swap of the aligned 32-bit word holding it.
+    __device__ inline void atomicMaxNonNegative(float* output, float value)
+    {
+        atomicMax(reinterpret_cast<unsigned int*>(output), __float_as_uint(value));
+    }
+
+    __device__ inline void atomicMaxNonNegative(_Float16* output, float value)
+    {
+        const auto         addr  = reinterpret_cast<uintptr_t>(output);
+        auto*              word  = reinterpret_cast<unsigned int*>(addr & ~uintptr_t(3));
+        const unsigned int shift = (addr & 2) * 8;
+        const unsigned int bits  = __builtin_bit_cast(uint16_t, _Float16(value));
+
+        unsigned int old = atomicOr(word, 0u);
+        while(((old >> shift) & 0xffffu) < bits)
+        {
+            const unsigned int assumed = old;
+            old = atomicCAS(word, assumed, (assumed & ~(0xffffu << shift)) | (bits << shift));
+            if(old == assumed)
+                break;
+        }
+    }
+
+    // Elements per thread before the grid is wide enough to stop growing
+    constexpr uint32_t AMAX_ELEMENTS_PER_THREAD = 16;
+
+    // Grid-stride over the whole tensor, each workgroup folds its maximum into the
+    // zeroed output, so one launch covers any size without workspace. With outputD
+    // the scaled input is written in the same pass.
+    template <typename Ti, typename To, typename Ts>
+    __global__ __launch_bounds__(WORKGROUP_SIZE) void amaxAtomic(
+        To* output, Ts* outputD, const Ti* input, const float* scale, size_t len)
+    {
+        const float scaleValue = outputD ? *scale : 0.f;
+        float       amax       = 0.f;
+
+        for(size_t i = size_t(blockIdx.x) * WORKGROUP_SIZE + threadIdx.x; i < len;
+            i += size_t(gridDim.x) * WORKGROUP_SIZE)
+        {
+            const float v = float(input[i]);
+            amax          = fmaxf(amax, fabsf(v));
+            if(outputD)
+                outputD[i] = Ts(v * scaleValue);
+        }
+
+        amax = reduceWorkgroup(amax, [](float a, float b) { return fmaxf(a, b); });
+        if(threadIdx.x == 0)
+            atomicMaxNonNegative(output, amax);
     }
 
-    inline uint32_t getSoftmaxKernelTileM(uint32_t tileM)
+    template <typename Ti, typename To, typename Ts>
+    hipblasStatus_t launchAMaxAtomicKernel(
+        void* output, void* outputD, void* input, void* scale, size_t len, hipStream_t stream)
     {
-        return WORKGROUP_SIZE / tileM;
-    }
+        uint32_t numCUs{};
+        if(!getNumCUs(numCUs))
+        {
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
 
-    uint32_t elementNumBytes(hipDataType type)
-    {
-        if(type == HIP_R_16F)
-            return 2;
-        else if(type == HIP_R_32F)
-            return 4;
-        return 4;
+        const size_t numWorkgroups
+            = std::min<size_t>((len + WORKGROUP_SIZE * AMAX_ELEMENTS_PER_THREAD - 1)
+                                   / (WORKGROUP_SIZE * AMAX_ELEMENTS_PER_THREAD),
+                               numCUs * AMAX_WORKGROUPS_PER_CU);
+
+        if(hipMemsetAsync(output, 0, sizeof(To), stream) != hipSuccess)
+        {
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        hipLaunchKernelGGL((amaxAtomic<Ti, To, Ts>),
+                           dim3(numWorkgroups),
+                           dim3(WORKGROUP_SIZE),
+                           0,
+                           stream,
+                           static_cast<To*>(output),
+                           static_cast<Ts*>(outputD),
+                           static_cast<const Ti*>(input),
+                           static_cast<const float*>(scale),
+                           len);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
     }
 
-    inline uint32_t getLdsUsageByte(hipDataType datatype, uint32_t tileM, uint32_t tileN)
+    template <typename Ti, typename Ts>
+    hipblasStatus_t launchAMaxAtomic(hipDataType outDatatype,
+                                     void*       output,
+                                     void*       outputD,
+                                     void*       input,
+                                     void*       scale,
+                                     size_t      len,
+                                     hipStream_t stream)
     {
-        return elementNumBytes(datatype) * tileM * tileN;
+        if(outDatatype == HIP_R_16F)
+            return launchAMaxAtomicKernel<Ti, _Float16, Ts>(
+                output, outputD, input, scale, len, stream);
+        return launchAMaxAtomicKernel<Ti, float, Ts>(output, outputD, input, scale, len, stream);
     }
 
     static const hipblaslt_ext::ExtOpMasterLibrary& getExtOpMasterLibrary()
@@ -247,6 +2041,9 @@ namespace
         int currentDevice{};
         err = hipGetDevice(&currentDevice);
 
+        auto const& debug = TensileLite::Debug::Instance();
+        debug.markerStart("LoadExtOpLibrary", getExtOpLibraryPath());
+
         try
         {
             auto& lib = getExtOpMasterLibrary();
@@ -261,9 +2058,138 @@ namespace
         {
             rocblaslt_log_error("extOpLibraries", "ExtOpLibPath", getExtOpLibraryPath().c_str());
         }
+        debug.markerStop();
 
         return adapters;
     }
+
+    const hipblaslt_ext::ExtOpTuningTable& getExtOpTuningTable()
+    {
+        static const hipblaslt_ext::ExtOpTuningTable table = [] {
+            std::string path;
+
+            if(auto tuningPath = std::getenv("HIPBLASLT_EXT_OP_TUNING_FILE"))
+                path = tuningPath;
+            else
+                path = getExtOpMasterLibrary().getLibraryFolder() + "/hipblasltExtOpTuning.txt";
+
+            if(!rocblaslt_internal_test_path(path))
+                return hipblaslt_ext::ExtOpTuningTable();
+
+            try
+            {
+                return hipblaslt_ext::ExtOpTuningTable(path);
+            }
+            catch(const std::runtime_error& e)
+            {
+                rocblaslt_log_error("getExtOpTuningTable", "ExtOpTuningFile", path.c_str());
+                return hipblaslt_ext::ExtOpTuningTable();
+            }
+        }();
+
+        return table;
+    }
+
+    // Set by hipblasltExtOpForceTile while a client measures the candidates
+    thread_local uint32_t forcedSoftmaxTile{};
+    thread_local uint32_t forcedLayerNormTile{};
+
+    uint32_t* getForcedTile(const std::string& opName)
+    {
+        if(opName == hipblaslt_ext::SoftmaxSolutionLibrary::opName)
+            return &forcedSoftmaxTile;
+        else if(opName == hipblaslt_ext::LayerNormSolutionLibrary::opName)
+            return &forcedLayerNormTile;
+        return nullptr;
+    }
+
+    // The forced tile, else the tuned tile, else the smallest tile that fits n
+    template <typename Library, typename Problem>
+    auto findTunedSolution(const Library&               lib,
+                           const Problem&               problem,
+                           const TensileLite::Hardware& hardware,
+                           const std::string&           archName,
+                           const std::string&           typeName)
+    {
+        uint32_t tile = *getForcedTile(Library::opName);
+
+        if(!tile)
+            tile = getExtOpTuningTable().lookup(archName, Library::opName, typeName, problem.getN());
+
+        if(tile)
+        {
+            if(auto sol = lib.findSolutionByTile(problem, tile))
+                return sol;
+        }
+
+        return lib.findBestSolution(problem, hardware);
+    }
+}
+
+hipblasStatus_t hipblasltExtOpGetCandidateTiles(
+    const char* opName, hipDataType datatype, uint32_t n, uint32_t* tiles, uint32_t* count)
+{
+    if(!opName || !count || !n)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    if(!getForcedTile(opName))
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    std::vector<uint32_t> candidates;
+
+    try
+    {
+        auto        gpu       = TensileLite::hip::GetCurrentDevice();
+        const auto  archName  = trimArchName(gpu->archName());
+        auto&       masterLib = getExtOpMasterLibrary();
+        const auto  typeName  = hipDataTypeo_char(datatype);
+
+        if(!masterLib.hasLibrary(archName, opName, typeName))
+        {
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        const auto& lib  = masterLib.getLibrary(archName, opName, typeName);
+        const auto  type = hipDataType_to_tensile_type(datatype);
+
+        if(std::string(opName) == hipblaslt_ext::SoftmaxSolutionLibrary::opName)
+            candidates = lib->as<hipblaslt_ext::SoftmaxSolutionLibrary>().getCandidateTiles(
+                hipblaslt_ext::SoftmaxProblem(1, n, type));
+        else
+            candidates = lib->as<hipblaslt_ext::LayerNormSolutionLibrary>().getCandidateTiles(
+                hipblaslt_ext::LayerNormProblem(1, n, type));
+    }
+    catch(const std::runtime_error& e)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(tiles)
+        std::copy_n(candidates.begin(), std::min<size_t>(*count, candidates.size()), tiles);
+    *count = candidates.size();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasltExtOpForceTile(const char* opName, uint32_t tile)
+{
+    if(!opName)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    auto forcedTile = getForcedTile(opName);
+
+    if(!forcedTile)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    *forcedTile = tile;
+    return HIPBLAS_STATUS_SUCCESS;
 }
 
 hipblasStatus_t hipblasltSoftmaxRun(hipDataType datatype,
@@ -274,7 +2200,7 @@ hipblasStatus_t hipblasltSoftmaxRun(hipDataType datatype,
                                     void*       input,
                                     hipStream_t stream)
 {
-    if(datatype != HIP_R_32F)
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F && datatype != HIP_R_16BF)
     {
         return HIPBLAS_STATUS_NOT_SUPPORTED;
     }
@@ -284,26 +2210,47 @@ hipblasStatus_t hipblasltSoftmaxRun(hipDataType datatype,
         return HIPBLAS_STATUS_NOT_SUPPORTED;
     }
 
-    const auto tileN = getSoftmaxBestKernelTileN(n);
-    const auto tileM = getSoftmaxKernelTileM(tileN);
-
-    if(tileN > SUPPORTED_MAX_N)
+    if(!m || !n)
     {
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
+    // A row does not fit in the tile of a library kernel
+    if(n > SUPPORTED_MAX_N)
+    {
+        if(datatype == HIP_R_16F)
+            return launchOnlineSoftmax<_Float16>(m, n, output, input, stream);
+        else if(datatype == HIP_R_16BF)
+            return launchOnlineSoftmax<hip_bfloat16>(m, n, output, input, stream);
+        return launchOnlineSoftmax<float>(m, n, output, input, stream);
+    }
+
     int         currentDeviceId{};
     auto        err       = hipGetDevice(&currentDeviceId);
     auto&       adapter   = extOpLibraries().at(currentDeviceId);
     auto        gpu       = TensileLite::hip::GetCurrentDevice();
     const auto  archName  = trimArchName(gpu->archName());
     auto&       masterLib = getExtOpMasterLibrary();
+
+    // Half and BFloat16 run only where the ext op library ships kernels for them
+    if(datatype != HIP_R_32F
+       && !masterLib.hasLibrary(
+           archName, hipblaslt_ext::SoftmaxSolutionLibrary::opName, hipDataTypeo_char(datatype)))
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
     const auto& lib
         = masterLib
               .getLibrary(archName, hipblaslt_ext::SoftmaxSolutionLibrary::opName, hipDataTypeo_char(datatype))
               ->as<hipblaslt_ext::SoftmaxSolutionLibrary>();
-    auto sol
-        = lib.findBestSolution(hipblaslt_ext::SoftmaxProblem(m, n, hipDataType_to_tensile_type(datatype)), *gpu);
+    auto sol = findTunedSolution(lib,
+                                 hipblaslt_ext::SoftmaxProblem(m, n, hipDataType_to_tensile_type(datatype)),
+                                 *gpu,
+                                 archName,
+                                 hipDataTypeo_char(datatype));
+    const auto tileN      = sol->getTileN();
+    const auto tileM      = getSoftmaxKernelTileM(tileN);
     const auto kernelName = sol->name();
     err                   = adapter->initKernel(kernelName);
     TensileLite::KernelArguments kArgs(false);
@@ -331,6 +2278,103 @@ hipblasStatus_t hipblasltSoftmaxRun(hipDataType datatype,
     return HIPBLAS_STATUS_SUCCESS;
 }
 
+hipblasStatus_t hipblasltScaleMaskSoftmaxRun(hipDataType datatype,
+                                             uint32_t    m,
+                                             uint32_t    n,
+                                             uint32_t    batchCount,
+                                             void*       output,
+                                             int64_t     strideOutput,
+                                             void*       input,
+                                             int64_t     strideInput,
+                                             float       scale,
+                                             int32_t     causal,
+                                             void*       bias,
+                                             int64_t     biasRowStride,
+                                             int64_t     biasBatchStride,
+                                             hipStream_t stream)
+{
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F && datatype != HIP_R_16BF)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(!output || !input || !m || !n || !batchCount)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    auto launch = datatype == HIP_R_16F    ? launchScaleMaskSoftmax<_Float16>
+                  : datatype == HIP_R_16BF ? launchScaleMaskSoftmax<hip_bfloat16>
+                                           : launchScaleMaskSoftmax<float>;
+    return launch(m,
+                  n,
+                  batchCount,
+                  output,
+                  strideOutput,
+                  input,
+                  strideInput,
+                  scale,
+                  causal != 0,
+                  bias,
+                  biasRowStride,
+                  biasBatchStride,
+                  stream);
+}
+
+hipblasStatus_t hipblasltAttentionRun(hipDataType inputType,
+                                      hipDataType outputType,
+                                      uint32_t    batchCount,
+                                      uint32_t    numHeads,
+                                      uint32_t    numKvHeads,
+                                      uint32_t    seqQ,
+                                      uint32_t    seqK,
+                                      uint32_t    headDim,
+                                      void*       output,
+                                      const void* q,
+                                      const void* k,
+                                      const void* v,
+                                      float       scale,
+                                      float       outputScale,
+                                      int32_t     causal,
+                                      hipStream_t stream)
+{
+    const bool floatOutput = outputType == HIP_R_32F || outputType == HIP_R_16F
+                             || outputType == HIP_R_16BF;
+    const bool floatInput  = inputType == HIP_R_32F || inputType == HIP_R_16F
+                            || inputType == HIP_R_16BF || inputType == HIP_R_8F_E4M3_FNUZ
+                            || inputType == HIP_R_8F_E5M2_FNUZ;
+
+    if(!floatInput || !floatOutput || headDim > ATTENTION_MAX_HEAD_DIM)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(!output || !q || !k || !v || !batchCount || !numHeads || !numKvHeads || !seqQ || !seqK
+       || !headDim || numHeads % numKvHeads)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    return dispatchAttentionTypes(inputType, outputType, [&](auto* ti, auto* to) {
+        using Ti = std::remove_pointer_t<decltype(ti)>;
+        using To = std::remove_pointer_t<decltype(to)>;
+        return launchFusedAttention<Ti, To>(batchCount,
+                                            numHeads,
+                                            numKvHeads,
+                                            seqQ,
+                                            seqK,
+                                            headDim,
+                                            output,
+                                            q,
+                                            k,
+                                            v,
+                                            scale,
+                                            outputScale,
+                                            causal != 0,
+                                            stream);
+    });
+}
+
 hipblasStatus_t hipblasltLayerNormRun(hipDataType datatype,
                                       void*       output,
                                       void*       mean,
@@ -362,8 +2406,11 @@ hipblasStatus_t hipblasltLayerNormRun(hipDataType datatype,
         = masterLib
               .getLibrary(archName, hipblaslt_ext::LayerNormSolutionLibrary::opName, hipDataTypeo_char(datatype))
               ->as<hipblaslt_ext::LayerNormSolutionLibrary>();
-    auto sol
-        = lib.findBestSolution(hipblaslt_ext::LayerNormProblem(m, n, hipDataType_to_tensile_type(datatype)), *gpu);
+    auto sol = findTunedSolution(lib,
+                                 hipblaslt_ext::LayerNormProblem(m, n, hipDataType_to_tensile_type(datatype)),
+                                 *gpu,
+                                 archName,
+                                 hipDataTypeo_char(datatype));
     const auto kernelName    = sol->name();
     err                      = adapter->initKernel(kernelName);
     const auto numWorkgroups = m;
@@ -411,7 +2458,8 @@ hipblasStatus_t hipblasltAMaxRun(const hipDataType datatype,
                                  uint32_t          n,
                                  hipStream_t       stream)
 {
-    if(datatype != HIP_R_32F && datatype != HIP_R_16F)
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F
+       || outDatatype != HIP_R_32F && outDatatype != HIP_R_16F)
     {
         return HIPBLAS_STATUS_NOT_SUPPORTED;
     }
@@ -419,50 +2467,32 @@ hipblasStatus_t hipblasltAMaxRun(const hipDataType datatype,
     if(output == nullptr || input == nullptr || m == 0 || n == 0)
         return HIPBLAS_STATUS_INVALID_VALUE;
 
-    uint32_t    len = m * n;
-    int         currentDeviceId{};
-    auto        err       = hipGetDevice(&currentDeviceId);
-    auto&       adapter   = extOpLibraries().at(currentDeviceId);
-    auto        gpu       = TensileLite::hip::GetCurrentDevice();
-    const auto  archName  = trimArchName(gpu->archName());
-    auto&       masterLib = getExtOpMasterLibrary();
-    const auto& lib
-        = masterLib.getLibrary(archName, hipblaslt_ext::AMaxSolutionLibrary::opName, hipDataTypeo_char(datatype))
-              ->as<hipblaslt_ext::AMaxSolutionLibrary>();
-    auto       sol        = lib.findBestSolution(hipblaslt_ext::AMaxProblem(len,
-                                                hipDataType_to_tensile_type(datatype),
-                                                hipDataType_to_tensile_type(outDatatype)),
-                                    *gpu);
-    const auto kernelName = sol->name();
-    err                   = adapter->initKernel(kernelName);
+    const size_t len = size_t(m) * n;
 
-    TensileLite::KernelInvocation invocation;
-    invocation.kernelName      = kernelName;
-    invocation.codeObjectFile  = sol->getCodeObjectPath();
-    invocation.workGroupSize.x = sol->getNumWorkitems();
-    invocation.workGroupSize.y = 1;
-    invocation.workGroupSize.z = 1;
-    invocation.numWorkGroups.x = 1;
-    invocation.numWorkGroups.y = 1;
-    invocation.numWorkGroups.z = 1;
-    invocation.numWorkItems.x  = sol->getNumWorkitems();
-    invocation.numWorkItems.y  = 1;
-    invocation.numWorkItems.z  = 1;
-    invocation.sharedMemBytes  = 32 * sizeof(float);
-    invocation.args            = TensileLite::KernelArguments(false);
-    invocation.args.reserve(20, 3);
-    invocation.args.append("output", output);
-    invocation.args.append("input", input);
-    invocation.args.append("length", len);
+    if(datatype == HIP_R_16F)
+        return launchAMaxAtomic<_Float16, _Float16>(
+            outDatatype, output, nullptr, input, nullptr, len, stream);
+    return launchAMaxAtomic<float, float>(outDatatype, output, nullptr, input, nullptr, len, stream);
+}
 
-    err = adapter->launchKernel(invocation, stream, nullptr, nullptr);
+hipblasStatus_t hipblasltAMaxMultiTensorRun(const hipDataType             outDatatype,
+                                            const hipblasltExtAMaxTensor* tensors,
+                                            uint32_t                      numTensors,
+                                            hipStream_t                   stream)
+{
+    if(outDatatype != HIP_R_32F && outDatatype != HIP_R_16F)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
 
-    if(err)
+    if(!tensors || !numTensors)
     {
-        return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
-    return HIPBLAS_STATUS_SUCCESS;
+    if(outDatatype == HIP_R_16F)
+        return launchMultiTensorAMax<_Float16>(tensors, numTensors, stream);
+    return launchMultiTensorAMax<float>(tensors, numTensors, stream);
 }
 
 hipblasStatus_t hipblasltAMaxWithScaleRun(const hipDataType datatype,
@@ -476,7 +2506,7 @@ hipblasStatus_t hipblasltAMaxWithScaleRun(const hipDataType datatype,
                                           uint32_t          n,
                                           hipStream_t       stream)
 {
-    if(datatype != HIP_R_32F
+    if(datatype != HIP_R_32F || outDatatype != HIP_R_32F && outDatatype != HIP_R_16F
        || scaleDatatype != HIP_R_8F_E4M3_FNUZ && scaleDatatype != HIP_R_8F_E5M2_FNUZ)
     {
         return HIPBLAS_STATUS_NOT_SUPPORTED;
@@ -487,59 +2517,250 @@ hipblasStatus_t hipblasltAMaxWithScaleRun(const hipDataType datatype,
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
-    uint32_t    len = m * n;
-    int         currentDeviceId{};
-    auto        err       = hipGetDevice(&currentDeviceId);
-    auto&       adapter   = extOpLibraries().at(currentDeviceId);
-    auto        gpu       = TensileLite::hip::GetCurrentDevice();
-    const auto  archName  = trimArchName(gpu->archName());
-    auto&       masterLib = getExtOpMasterLibrary();
-    const auto& lib
-        = masterLib.getLibrary(archName, hipblaslt_ext::AMaxSolutionLibrary::opName, hipDataTypeo_char(datatype))
-              ->as<hipblaslt_ext::AMaxSolutionLibrary>();
-    auto sol = lib.findBestSolution(hipblaslt_ext::AMaxProblem(len,
-                                                hipDataType_to_tensile_type(datatype),
-                                                hipDataType_to_tensile_type(outDatatype),
-                                                hipDataType_to_tensile_type(scaleDatatype),
-                                                true),
-                                    *gpu);
-
-    if(!sol)
-    {
-        std::cerr << "AMaxWithScale: No valid solution found!" << std::endl;
-        return HIPBLAS_STATUS_SUCCESS;
+    const size_t len = size_t(m) * n;
+
+    if(scaleDatatype == HIP_R_8F_E4M3_FNUZ)
+        return launchAMaxAtomic<float, hipblaslt_f8_fnuz>(
+            outDatatype, output, outputD, input, inputScale, len, stream);
+    return launchAMaxAtomic<float, hipblaslt_bf8_fnuz>(
+        outDatatype, output, outputD, input, inputScale, len, stream);
+}
+
+hipblasStatus_t hipblasltAMaxWithBlockScaleRun(const hipDataType                 datatype,
+                                               const hipDataType                 scaleDatatype,
+                                               const hipblasltExtAMaxScaleMode_t mode,
+                                               uint32_t                          blockSize,
+                                               void*                             amax,
+                                               void*                             scale,
+                                               void*                             outputD,
+                                               void*                             input,
+                                               uint32_t                          m,
+                                               uint32_t                          n,
+                                               hipStream_t                       stream)
+{
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F && datatype != HIP_R_16BF
+       || scaleDatatype != HIP_R_8F_E4M3_FNUZ && scaleDatatype != HIP_R_8F_E5M2_FNUZ
+       || mode != HIPBLASLT_EXT_AMAX_SCALE_ROW && mode != HIPBLASLT_EXT_AMAX_SCALE_BLOCK)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
     }
 
-    const auto kernelName = sol->name();
-    err                   = adapter->initKernel(kernelName);
+    if(!scale || !outputD || !input || !m || !n
+       || mode == HIPBLASLT_EXT_AMAX_SCALE_BLOCK && !blockSize)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
 
-    TensileLite::KernelInvocation invocation;
-    invocation.kernelName      = kernelName;
-    invocation.codeObjectFile  = sol->getCodeObjectPath();
-    invocation.workGroupSize.x = sol->getNumWorkitems();
-    invocation.workGroupSize.y = 1;
-    invocation.workGroupSize.z = 1;
-    invocation.numWorkGroups.x = 1;
-    invocation.numWorkGroups.y = 1;
-    invocation.numWorkGroups.z = 1;
-    invocation.numWorkItems.x  = sol->getNumWorkitems();
-    invocation.numWorkItems.y  = 1;
-    invocation.numWorkItems.z  = 1;
-    invocation.sharedMemBytes  = 32 * sizeof(float);
-    invocation.args            = TensileLite::KernelArguments(false);
-    invocation.args.reserve(20, 3);
-    invocation.args.append("output", output);
-    invocation.args.append("outputD", outputD);
-    invocation.args.append("input", input);
-    invocation.args.append("inputScae", inputScale);
-    invocation.args.append("length", len);
+    auto launch = datatype == HIP_R_16F    ? launchAMaxWithBlockScale<_Float16>
+                  : datatype == HIP_R_16BF ? launchAMaxWithBlockScale<hip_bfloat16>
+                                           : launchAMaxWithBlockScale<float>;
+    return launch(scaleDatatype, mode, blockSize, amax, scale, outputD, input, m, n, stream);
+}
 
-    err = adapter->launchKernel(invocation, stream, nullptr, nullptr);
+hipblasStatus_t hipblasltFp8QuantizeRun(hipblasltExtFp8Scaling_t             scaling,
+                                        const hipblasltExtFp8QuantizeTensor* tensors,
+                                        uint32_t                             numTensors,
+                                        hipStream_t                          stream)
+{
+    if(scaling != HIPBLASLT_EXT_FP8_SCALING_CURRENT && scaling != HIPBLASLT_EXT_FP8_SCALING_DELAYED)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
 
-    if(err)
+    if(!tensors || !numTensors || numTensors > HIPBLASLT_EXT_FP8_QUANTIZE_MAX_TENSORS)
     {
-        return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    Fp8QuantizeTensors args{};
+    for(uint32_t t = 0; t < numTensors; t++)
+    {
+        const auto& tensor = tensors[t];
+        if(tensor.datatype != HIP_R_32F && tensor.datatype != HIP_R_16F
+               && tensor.datatype != HIP_R_16BF
+           || tensor.outDatatype != HIP_R_8F_E4M3_FNUZ && tensor.outDatatype != HIP_R_8F_E5M2_FNUZ)
+        {
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        if(!tensor.scale || tensor.m && tensor.n && (!tensor.input || !tensor.output))
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        args.tensor[t] = tensor;
+    }
+    args.count = numTensors;
+
+    return launchFp8Quantize(scaling, args, stream);
+}
+
+hipblasStatus_t hipblasltLayerNormAMaxWithScaleRun(const hipDataType datatype,
+                                                   const hipDataType outDatatype,
+                                                   void*             output,
+                                                   void*             amax,
+                                                   void*             mean,
+                                                   void*             invvar,
+                                                   void*             input,
+                                                   void*             inputScale,
+                                                   uint32_t          m,
+                                                   uint32_t          n,
+                                                   float             eps,
+                                                   void*             gamma,
+                                                   void*             beta,
+                                                   hipStream_t       stream)
+{
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F && datatype != HIP_R_16BF
+       || outDatatype != HIP_R_8F_E4M3_FNUZ && outDatatype != HIP_R_8F_E5M2_FNUZ)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(!output || !amax || !input || !inputScale || !m || !n)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    auto launch = datatype == HIP_R_16F    ? launchLayerNormAMaxWithScale<_Float16>
+                  : datatype == HIP_R_16BF ? launchLayerNormAMaxWithScale<hip_bfloat16>
+                                           : launchLayerNormAMaxWithScale<float>;
+    return launch(
+        outDatatype, output, amax, mean, invvar, input, inputScale, m, n, eps, gamma, beta, stream);
+}
+
+hipblasStatus_t hipblasltRMSNormRun(const hipDataType datatype,
+                                    const hipDataType outDatatype,
+                                    void*             output,
+                                    void*             residualOut,
+                                    void*             input,
+                                    void*             residual,
+                                    void*             gamma,
+                                    void*             outputScale,
+                                    uint32_t          m,
+                                    uint32_t          n,
+                                    float             eps,
+                                    hipStream_t       stream)
+{
+    const bool fp8Output = outDatatype == HIP_R_8F_E4M3_FNUZ || outDatatype == HIP_R_8F_E5M2_FNUZ;
+
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F && datatype != HIP_R_16BF
+       || outDatatype != datatype && !fp8Output)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(!output || !input || !m || !n || fp8Output && !outputScale)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    auto launch = datatype == HIP_R_16F    ? launchRMSNorm<_Float16>
+                  : datatype == HIP_R_16BF ? launchRMSNorm<hip_bfloat16>
+                                           : launchRMSNorm<float>;
+    return launch(outDatatype,
+                  output,
+                  residualOut,
+                  input,
+                  residual,
+                  gamma,
+                  fp8Output ? outputScale : nullptr,
+                  m,
+                  n,
+                  eps,
+                  stream);
+}
+
+hipblasStatus_t hipblasltLayerNormBackwardRun(hipDataType datatype,
+                                              void*       dInput,
+                                              void*       dGamma,
+                                              void*       dBeta,
+                                              void*       dOutput,
+                                              void*       input,
+                                              void*       mean,
+                                              void*       invvar,
+                                              void*       gamma,
+                                              uint32_t    m,
+                                              uint32_t    n,
+                                              hipStream_t stream)
+{
+    if(datatype != HIP_R_32F && datatype != HIP_R_16F && datatype != HIP_R_16BF)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(!dOutput || !input || !mean || !invvar || !m || !n)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    auto launch = datatype == HIP_R_16F    ? launchLayerNormBackward<_Float16>
+                  : datatype == HIP_R_16BF ? launchLayerNormBackward<hip_bfloat16>
+                                           : launchLayerNormBackward<float>;
+    return launch(dInput, dGamma, dBeta, dOutput, input, mean, invvar, gamma, m, n, stream);
+}
+
+hipblasStatus_t hipblasltExtSparseCompressedSize(hipDataType        datatype,
+                                                 hipblasOperation_t opA,
+                                                 int64_t            m,
+                                                 int64_t            k,
+                                                 int64_t            lda,
+                                                 int64_t            strideA,
+                                                 int32_t            batchCount,
+                                                 size_t*            compressedBytes,
+                                                 size_t*            metadataBytes)
+{
+    auto status = validateSparseCompress(datatype, opA, m, k, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if(!compressedBytes || !metadataBytes)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
+    const size_t batches = strideA ? batchCount : 1;
+    const size_t values  = opA == HIPBLAS_OP_N ? lda * (k / 2) : k / 2 * m;
+    *compressedBytes     = batches * values * sparseElementSize(datatype);
+    *metadataBytes       = batches * (k / SPARSE_METADATA_GROUP) * m;
     return HIPBLAS_STATUS_SUCCESS;
 }
+
+hipblasStatus_t hipblasltSparseCompressRun(hipDataType        datatype,
+                                           hipblasOperation_t opA,
+                                           int64_t            m,
+                                           int64_t            k,
+                                           int64_t            lda,
+                                           int64_t            strideA,
+                                           int32_t            batchCount,
+                                           const void*        A,
+                                           void*              compressed,
+                                           void*              metadata,
+                                           hipStream_t        stream)
+{
+    auto status = validateSparseCompress(datatype, opA, m, k, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if(!A || !compressed || !metadata)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // A broadcast A is compressed once, the GEMM broadcasts the compressed A in turn
+    const int32_t batches = strideA ? batchCount : 1;
+    auto          launch  = launchSparseCompress<hipblaslt_bf8_fnuz>;
+    if(datatype == HIP_R_16F)
+        launch = launchSparseCompress<_Float16>;
+    else if(datatype == HIP_R_16BF)
+        launch = launchSparseCompress<hip_bfloat16>;
+    else if(datatype == HIP_R_8I)
+        launch = launchSparseCompress<int8_t>;
+    else if(datatype == HIP_R_8F_E4M3_FNUZ)
+        launch = launchSparseCompress<hipblaslt_f8_fnuz>;
+    return launch(
+        opA == HIPBLAS_OP_T, m, k, lda, strideA, batches, A, compressed, metadata, stream);
+}
@@ -29,17 +29,20 @@
 #include "hipblaslt_internal.hpp"
 #include <Debug.hpp>
 #include <algorithm>
+#include <cstring>
 #include <hip/hip_runtime.h>
 #include <hipblaslt/hipblaslt_float8.h>
 #include <iostream>
 #include <rocblaslt.h>
+#include <rocblaslt_skinny.hpp>
+#include <type_traits>
 
 namespace hipblaslt_ext
 {
     class GemmPreferenceV2::GemmPreferenceImpl
     {
     public:
-        size_t workspace_bytes;
+        rocblaslt::RocGemmPreference pref;
     };
 
     GemmPreferenceV2::GemmPreferenceV2()
@@ -65,12 +68,72 @@ namespace hipblaslt_ext
 
     void GemmPreferenceV2::setMaxWorkspaceBytes(size_t workspaceBytes)
     {
-        pimpl->workspace_bytes = workspaceBytes;
+        pimpl->pref.workspaceBytes = workspaceBytes;
     }
 
     const size_t GemmPreferenceV2::getMaxWorkspaceBytes() const
     {
-        return pimpl->workspace_bytes;
+        return pimpl->pref.workspaceBytes;
+    }
+
+    void GemmPreferenceV2::setPreferNoWorkspace(bool preferNoWorkspace)
+    {
+        pimpl->pref.preferNoWorkspace = preferNoWorkspace;
+    }
+
+    bool GemmPreferenceV2::getPreferNoWorkspace() const
+    {
+        return pimpl->pref.preferNoWorkspace;
+    }
+
+    void GemmPreferenceV2::setMaxCUOccupancy(float maxCUOccupancy)
+    {
+        pimpl->pref.maxCUOccupancy = maxCUOccupancy;
+    }
+
+    float GemmPreferenceV2::getMaxCUOccupancy() const
+    {
+        return pimpl->pref.maxCUOccupancy;
+    }
+
+    void GemmPreferenceV2::setDeterministicReduction(bool deterministicReduction)
+    {
+        pimpl->pref.deterministicReduction = deterministicReduction;
+    }
+
+    bool GemmPreferenceV2::getDeterministicReduction() const
+    {
+        return pimpl->pref.deterministicReduction;
+    }
+
+    void GemmPreferenceV2::setPreferPersistent(bool preferPersistent)
+    {
+        pimpl->pref.preferPersistent = preferPersistent;
+    }
+
+    bool GemmPreferenceV2::getPreferPersistent() const
+    {
+        return pimpl->pref.preferPersistent;
+    }
+
+    void GemmPreferenceV2::setPreferNonPersistent(bool preferNonPersistent)
+    {
+        pimpl->pref.preferNonPersistent = preferNonPersistent;
+    }
+
+    bool GemmPreferenceV2::getPreferNonPersistent() const
+    {
+        return pimpl->pref.preferNonPersistent;
+    }
+
+    void GemmPreferenceV2::setEnergyLatencyBound(float latencyBound)
+    {
+        pimpl->pref.energyLatencyBound = latencyBound;
+    }
+
+    float GemmPreferenceV2::getEnergyLatencyBound() const
+    {
+        return pimpl->pref.energyLatencyBound;
     }
 
     class GemmProblemTypeV2::GemmProblemTypeImpl
@@ -194,15 +257,16 @@ namespace hipblaslt_ext
         return pimpl->type_compute;
     }
 
-    class GemmEpilogueV2::GemmEpilogueImpl
+    // The grouped setProblem() hands vectors of the by-value structures to rocblaslt as is
+    static_assert(std::is_trivially_copyable<GemmEpilogueV2Data>::value
+                      && sizeof(GemmEpilogueV2Data) == sizeof(rocblaslt::RocGemmEpilogueV2),
+                  "GemmEpilogueV2Data must match rocblaslt::RocGemmEpilogueV2");
+    static_assert(std::is_trivially_copyable<GemmInputsV2Data>::value
+                      && sizeof(GemmInputsV2Data) == sizeof(rocblaslt::RocGemmInputsV2),
+                  "GemmInputsV2Data must match rocblaslt::RocGemmInputsV2");
+
+    class GemmEpilogueV2::GemmEpilogueImpl : public GemmEpilogueV2Data
     {
-    public:
-        hipblasLtEpilogue_t mode           = HIPBLASLT_EPILOGUE_DEFAULT;
-        hipDataType         bias_data_type = HIPBLASLT_DATATYPE_INVALID;
-        int                 aux_ld         = 0;
-        int                 aux_stride     = 0;
-        int                 scaling_a_type = 0;
-        int                 scaling_b_type = 0;
     };
 
     GemmEpilogueV2::GemmEpilogueV2()
@@ -291,6 +355,8 @@ namespace hipblaslt_ext
     public:
         u_int16_t splitK = 0;
         int16_t wgm = 0;
+        uint8_t streamK = 0;
+        float skGridFraction = 0.0f;
     };
 
     GemmTuningV2::GemmTuningV2()
@@ -324,6 +390,16 @@ namespace hipblaslt_ext
         pimpl->wgm = wgm;
     }
 
+    void GemmTuningV2::setStreamK(uint8_t streamK)
+    {
+        pimpl->streamK = streamK;
+    }
+
+    void GemmTuningV2::setSKGridFraction(float skGridFraction)
+    {
+        pimpl->skGridFraction = skGridFraction;
+    }
+
     u_int16_t GemmTuningV2::getSplitK() const
     {
         return pimpl->splitK;
@@ -334,25 +410,18 @@ namespace hipblaslt_ext
         return pimpl->wgm;
     }
 
-    class GemmInputsV2::GemmInputsImpl
+    uint8_t GemmTuningV2::getStreamK() const
+    {
+        return pimpl->streamK;
+    }
+
+    float GemmTuningV2::getSKGridFraction() const
+    {
+        return pimpl->skGridFraction;
+    }
+
+    class GemmInputsV2::GemmInputsImpl : public GemmInputsV2Data
     {
-    public:
-        const void* a     = nullptr;
-        const void* b     = nullptr;
-        const void* c     = nullptr;
-        const void* d     = nullptr;
-        const void* alpha = nullptr;
-        const void* beta  = nullptr;
-        // Epilogue inputs
-        const void* bias          = nullptr;
-        const void* scaleA        = nullptr;
-        const void* scaleB        = nullptr;
-        const void* scaleC        = nullptr;
-        const void* scaleD        = nullptr;
-        const void* scaleAux      = nullptr;
-        const void* scaleAlphaVec = nullptr;
-        const void* aux           = nullptr;
-        const void* amaxD         = nullptr;
     };
 
     GemmInputsV2::GemmInputsV2()
@@ -566,6 +635,255 @@ namespace hipblaslt_ext
         }
     }
 
+    __global__ void updateDeviceUserArguments(UserArguments*   userArgs,
+                                              uint32_t         gemmCount,
+                                              DeviceGroupSizes sizes)
+    {
+        const uint32_t id = blockIdx.x * blockDim.x + threadIdx.x;
+        if(id >= gemmCount)
+            return;
+
+        auto& args = userArgs[id];
+        if(sizes.m)
+            args.m = sizes.m[id];
+        if(sizes.n)
+            args.n = sizes.n[id];
+        if(sizes.k)
+            args.k = sizes.k[id];
+        if(sizes.offsetA)
+            args.a = (void*)((const uint8_t*)sizes.baseA + sizes.offsetA[id]);
+        if(sizes.offsetB)
+            args.b = (void*)((const uint8_t*)sizes.baseB + sizes.offsetB[id]);
+        if(sizes.offsetD)
+        {
+            void* d = (uint8_t*)sizes.baseD + sizes.offsetD[id];
+            if(args.c == args.d)
+                args.c = d;
+            args.d = d;
+        }
+    }
+
+    // Copy the per-group fields between the full and the compact encoding
+    template <typename Dst, typename Src>
+    __host__ __device__ void copyGroupArguments(Dst& dst, const Src& src)
+    {
+        dst.m        = src.m;
+        dst.n        = src.n;
+        dst.batch    = src.batch;
+        dst.k        = src.k;
+        dst.d        = src.d;
+        dst.c        = src.c;
+        dst.a        = src.a;
+        dst.b        = src.b;
+        dst.bias     = src.bias;
+        dst.e        = src.e;
+        dst.strideD1 = src.strideD1;
+        dst.strideD2 = src.strideD2;
+        dst.strideC1 = src.strideC1;
+        dst.strideC2 = src.strideC2;
+        dst.strideA1 = src.strideA1;
+        dst.strideA2 = src.strideA2;
+        dst.strideB1 = src.strideB1;
+        dst.strideB2 = src.strideB2;
+        dst.strideE1 = src.strideE1;
+        dst.strideE2 = src.strideE2;
+    }
+
+    __global__ void decodeCompactUserArguments(UserArguments*               userArgs,
+                                               uint32_t                     gemmCount,
+                                               UserArguments                shared,
+                                               const CompactGroupArguments* groupArgs)
+    {
+        const uint32_t id = blockIdx.x * blockDim.x + threadIdx.x;
+        if(id >= gemmCount)
+            return;
+
+        UserArguments args = shared;
+        copyGroupArguments(args, groupArgs[id]);
+        userArgs[id] = args;
+    }
+
+    constexpr uint32_t TinyGemmThreads          = 256;
+    constexpr uint32_t TinyGemmProblemsPerBlock = 16;
+
+    template <typename Ti, typename To>
+    __global__ __launch_bounds__(TinyGemmThreads) void tinyGemmKernel(
+        const TinyGemmArguments* args, uint32_t count, bool transA, bool transB)
+    {
+        __shared__ TinyGemmArguments problems[TinyGemmProblemsPerBlock];
+        __shared__ uint32_t          offsets[TinyGemmProblemsPerBlock + 1];
+
+        const uint32_t first       = blockIdx.x * TinyGemmProblemsPerBlock;
+        const uint32_t numProblems = min(TinyGemmProblemsPerBlock, count - first);
+        if(threadIdx.x < numProblems)
+            problems[threadIdx.x] = args[first + threadIdx.x];
+        __syncthreads();
+
+        if(threadIdx.x == 0)
+        {
+            offsets[0] = 0;
+            for(uint32_t p = 0; p < numProblems; p++)
+                offsets[p + 1] = offsets[p] + problems[p].m * problems[p].n;
+        }
+        __syncthreads();
+
+        // Output elements of all problems of the block are dealt out to the threads in
+        // column-major order, consecutive lanes write consecutive rows of d
+        uint32_t p = 0;
+        for(uint32_t e = threadIdx.x; e < offsets[numProblems]; e += TinyGemmThreads)
+        {
+            while(e >= offsets[p + 1])
+                p++;
+
+            auto const&    g     = problems[p];
+            const uint32_t local = e - offsets[p];
+            const uint32_t i     = local % g.m;
+            const uint32_t j     = local / g.m;
+
+            const Ti* a   = static_cast<const Ti*>(g.a);
+            const Ti* b   = static_cast<const Ti*>(g.b);
+            float     acc = 0.f;
+            for(uint32_t kk = 0; kk < g.k; kk++)
+            {
+                float va = float(transA ? a[kk + size_t(i) * g.lda] : a[i + size_t(kk) * g.lda]);
+                float vb = float(transB ? b[j + size_t(kk) * g.ldb] : b[kk + size_t(j) * g.ldb]);
+                acc += va * vb;
+            }
+
+            float result = g.alpha * acc;
+            if(g.beta != 0.f)
+                result += g.beta * float(static_cast<const To*>(g.c)[i + size_t(j) * g.ldc]);
+            static_cast<To*>(g.d)[i + size_t(j) * g.ldd] = To(result);
+        }
+    }
+
+    template <typename Ti, typename To>
+    hipblasStatus_t launchTinyGemm(const TinyGemmArguments* args,
+                                   uint32_t                 count,
+                                   bool                     transA,
+                                   bool                     transB,
+                                   hipStream_t              stream)
+    {
+        const uint32_t blocks = (count + TinyGemmProblemsPerBlock - 1) / TinyGemmProblemsPerBlock;
+        hipLaunchKernelGGL((tinyGemmKernel<Ti, To>),
+                           dim3(blocks),
+                           dim3(TinyGemmThreads),
+                           0,
+                           stream,
+                           args,
+                           count,
+                           transA,
+                           transB);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    constexpr uint32_t FusedMlpThreads = 256;
+    constexpr uint32_t FusedMlpRows    = 16;
+
+    // act is 0 for none, 1 for ReLU and 2 for the tanh approximation of GELU
+    __device__ float fusedMlpActivate(float x, int act)
+    {
+        if(act == 1)
+            return fmaxf(x, 0.f);
+        if(act == 2)
+            return 0.5f * x * (1.f + tanhf(0.7978845608028654f * x * (1.f + 0.044715f * x * x)));
+        return x;
+    }
+
+    // Each block computes FusedMlpRows rows of the intermediate into LDS, where consecutive
+    // lanes hold consecutive rows, then the same rows of y from it
+    template <typename Ti, typename To>
+    __global__ __launch_bounds__(FusedMlpThreads) void fusedMlpKernel(
+        FusedMlpArguments args, bool bias1, int act1, bool bias2, int act2)
+    {
+        __shared__ float h[FusedMlpRows * FusedMlpMaxHidden];
+
+        const uint32_t row0 = blockIdx.x * FusedMlpRows;
+        const uint32_t rows = min(FusedMlpRows, args.m - row0);
+        const Ti*      x    = static_cast<const Ti*>(args.x) + row0;
+        const Ti*      w1   = static_cast<const Ti*>(args.w1);
+        const Ti*      w2   = static_cast<const Ti*>(args.w2);
+        To*            y    = static_cast<To*>(args.y) + row0;
+
+        for(uint32_t e = threadIdx.x; e < FusedMlpRows * args.hidden; e += FusedMlpThreads)
+        {
+            const uint32_t i   = e % FusedMlpRows;
+            const uint32_t c   = e / FusedMlpRows;
+            float          acc = 0.f;
+            if(i < rows)
+                for(uint32_t kk = 0; kk < args.k; kk++)
+                    acc += float(x[i + size_t(kk) * args.ldx])
+                           * float(w1[kk + size_t(c) * args.ldw1]);
+            if(bias1)
+                acc += float(static_cast<const To*>(args.bias1)[c]);
+            h[e] = fusedMlpActivate(acc, act1);
+        }
+        __syncthreads();
+
+        for(uint32_t e = threadIdx.x; e < FusedMlpRows * args.n; e += FusedMlpThreads)
+        {
+            const uint32_t i = e % FusedMlpRows;
+            const uint32_t j = e / FusedMlpRows;
+            if(i >= rows)
+                continue;
+
+            float acc = 0.f;
+            for(uint32_t c = 0; c < args.hidden; c++)
+                acc += h[c * FusedMlpRows + i] * float(w2[c + size_t(j) * args.ldw2]);
+            if(bias2)
+                acc += float(static_cast<const To*>(args.bias2)[j]);
+            y[i + size_t(j) * args.ldy] = To(fusedMlpActivate(acc, act2));
+        }
+    }
+
+    template <typename Ti, typename To>
+    hipblasStatus_t launchFusedMlp(const FusedMlpArguments& args,
+                                   bool                     bias1,
+                                   int                      act1,
+                                   bool                     bias2,
+                                   int                      act2,
+                                   hipStream_t              stream)
+    {
+        hipLaunchKernelGGL((fusedMlpKernel<Ti, To>),
+                           dim3((args.m + FusedMlpRows - 1) / FusedMlpRows),
+                           dim3(FusedMlpThreads),
+                           0,
+                           stream,
+                           args,
+                           bias1,
+                           act1,
+                           bias2,
+                           act2);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Whether fusedMlpGemm() supports epilogue, and its bias and fusedMlpActivate() act
+    bool fusedMlpEpilogue(hipblasLtEpilogue_t epilogue, bool& bias, int& act)
+    {
+        switch(epilogue)
+        {
+        case HIPBLASLT_EPILOGUE_DEFAULT:
+        case HIPBLASLT_EPILOGUE_BIAS:
+            act = 0;
+            break;
+        case HIPBLASLT_EPILOGUE_RELU:
+        case HIPBLASLT_EPILOGUE_RELU_BIAS:
+            act = 1;
+            break;
+        case HIPBLASLT_EPILOGUE_GELU:
+        case HIPBLASLT_EPILOGUE_GELU_BIAS:
+            act = 2;
+            break;
+        default:
+            return false;
+        }
+        bias = epilogue == HIPBLASLT_EPILOGUE_BIAS || epilogue == HIPBLASLT_EPILOGUE_RELU_BIAS
+               || epilogue == HIPBLASLT_EPILOGUE_GELU_BIAS;
+        return true;
+    }
+
     auto NullDeleter = [](void*) { return hipSuccess; };
 
     HipBufferPtr makeHipBuffer(std::size_t numBytes)
@@ -624,10 +942,10 @@ namespace hipblaslt_ext
         const GemmPreference&                          pref,
         std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtAlgoGetHeuristicCpp");
+        rocblaslt::Debug::markerStart("hipblasLtAlgoGetHeuristicCpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
         auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
@@ -641,7 +959,7 @@ namespace hipblaslt_ext
                                              pref.getMaxWorkspaceBytes(),
                                              requestedAlgoCount,
                                              *results));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -650,10 +968,10 @@ namespace hipblaslt_ext
         const GemmPreferenceV2&                        pref,
         std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtAlgoGetHeuristicV2Cpp");
+        rocblaslt::Debug::markerStart("hipblasLtAlgoGetHeuristicV2Cpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
         auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
@@ -664,24 +982,78 @@ namespace hipblaslt_ext
             rocblaslt_algo_get_heuristic_cpp((rocblaslt_handle)m_handle,
                                              gemmType,
                                              m_data,
-                                             pref.pimpl->workspace_bytes,
+                                             pref.pimpl->pref,
                                              requestedAlgoCount,
                                              *results));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
+    hipblasStatus_t GemmInstance::getWorkspaceFrontier(
+        std::vector<hipblasLtMatmulHeuristicResult_t>& frontier)
+    {
+        if(m_gemm_count == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m_gemm_type != GemmType::HIPBLASLT_GEMM)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
+        auto results
+            = reinterpret_cast<std::vector<rocblaslt_matmul_heuristic_result>*>(&frontier);
+        results->clear();
+        return RocBlasLtStatusToHIPStatus(rocblaslt_algo_get_workspace_frontier_cpp(
+            (rocblaslt_handle)m_handle, gemmType, m_data, *results));
+    }
+
+    std::future<hipblasStatus_t> GemmInstance::algoGetHeuristicAsync(
+        const int                                      requestedAlgoCount,
+        const GemmPreferenceV2&                        pref,
+        std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults)
+    {
+        auto ready = [](hipblasStatus_t status) {
+            std::promise<hipblasStatus_t> promise;
+            promise.set_value(status);
+            return promise.get_future();
+        };
+
+        int device = 0;
+        if(hipGetDevice(&device) != hipSuccess)
+            return ready(HIPBLAS_STATUS_INTERNAL_ERROR);
+
+        auto query = [this, device, requestedAlgoCount, pref, &heuristicResults]() {
+            try
+            {
+                // The query resolves the library and adapter of the current device
+                if(hipSetDevice(device) != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+                return algoGetHeuristic(requestedAlgoCount, pref, heuristicResults);
+            }
+            catch(...)
+            {
+                return exception_to_hipblas_status();
+            }
+        };
+
+        try
+        {
+            return std::async(std::launch::async, std::move(query));
+        }
+        catch(...)
+        {
+            return ready(exception_to_hipblas_status());
+        }
+    }
+
     hipblasStatus_t GemmInstance::isAlgoSupported(hipblasLtMatmulAlgo_t& algo,
                                                   size_t&                workspaceSizeInBytes)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtIsAlgoSupportedCpp");
+        rocblaslt::Debug::markerStart("hipblasLtIsAlgoSupportedCpp");
         auto                    gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto                    rocalgo  = reinterpret_cast<rocblaslt_matmul_algo*>(&algo);
         rocblaslt::RocTuningV2* tuning   = nullptr;
         auto                    status = RocBlasLtStatusToHIPStatus(rocblaslt_is_algo_supported_cpp(
             (rocblaslt_handle)m_handle, gemmType, m_data, *rocalgo, tuning, workspaceSizeInBytes));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -694,7 +1066,7 @@ namespace hipblaslt_ext
                                                   size_t&                workspaceSizeInBytes)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtIsAlgoSupportedTuningCpp");
+        rocblaslt::Debug::markerStart("hipblasLtIsAlgoSupportedTuningCpp");
         auto gemmType  = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto rocalgo   = reinterpret_cast<rocblaslt_matmul_algo*>(&algo);
         auto roctuning = reinterpret_cast<rocblaslt::RocTuning*>(&tuning);
@@ -705,7 +1077,7 @@ namespace hipblaslt_ext
                                                                          *rocalgo,
                                                                          roctuning,
                                                                          workspaceSizeInBytes));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -718,10 +1090,10 @@ namespace hipblaslt_ext
                                                   size_t&                workspaceSizeInBytes)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtIsAlgoSupportedTuningV2Cpp");
+        rocblaslt::Debug::markerStart("hipblasLtIsAlgoSupportedTuningV2Cpp");
         auto gemmType  = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto rocalgo   = reinterpret_cast<rocblaslt_matmul_algo*>(&algo);
-        auto roctuning = reinterpret_cast<rocblaslt::RocTuningV2*>(&tuning);
+        auto roctuning = reinterpret_cast<rocblaslt::RocTuningV2*>(tuning.pimpl.get());
         auto status
             = RocBlasLtStatusToHIPStatus(rocblaslt_is_algo_supported_cpp((rocblaslt_handle)m_handle,
                                                                          gemmType,
@@ -729,7 +1101,7 @@ namespace hipblaslt_ext
                                                                          *rocalgo,
                                                                          roctuning,
                                                                          workspaceSizeInBytes));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -743,10 +1115,10 @@ namespace hipblaslt_ext
                                              hipStream_t                  stream)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtInitializeCpp");
+        rocblaslt::Debug::markerStart("hipblasLtInitializeCpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
         auto                    gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
@@ -761,7 +1133,7 @@ namespace hipblaslt_ext
                                                                     useUserArgs,
                                                                     stream,
                                                                     m_data));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -776,10 +1148,10 @@ namespace hipblaslt_ext
                                              hipStream_t                  stream)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtInitializeTuningCpp");
+        rocblaslt::Debug::markerStart("hipblasLtInitializeTuningCpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
         auto gemmType  = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
@@ -794,7 +1166,7 @@ namespace hipblaslt_ext
                                                                     useUserArgs,
                                                                     stream,
                                                                     m_data));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -809,15 +1181,15 @@ namespace hipblaslt_ext
                                              hipStream_t                  stream)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtInitializeTuningV2Cpp");
+        rocblaslt::Debug::markerStart("hipblasLtInitializeTuningV2Cpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
         auto gemmType  = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto rocalgo   = reinterpret_cast<const rocblaslt_matmul_algo*>(&algo);
-        auto roctuning = reinterpret_cast<const rocblaslt::RocTuningV2*>(&tuning);
+        auto roctuning = reinterpret_cast<const rocblaslt::RocTuningV2*>(tuning.pimpl.get());
         auto status
             = RocBlasLtStatusToHIPStatus(rocblaslt_makeArgument_cpp((rocblaslt_handle)m_handle,
                                                                     gemmType,
@@ -827,7 +1199,7 @@ namespace hipblaslt_ext
                                                                     useUserArgs,
                                                                     stream,
                                                                     m_data));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -838,17 +1210,140 @@ namespace hipblaslt_ext
     hipblasStatus_t GemmInstance::run(hipStream_t stream, hipEvent_t start, hipEvent_t stop)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtRunCpp");
+        rocblaslt::Debug::markerStart("hipblasLtRunCpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
 
         auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto status   = RocBlasLtStatusToHIPStatus(
             rocblaslt_run_cpp((rocblaslt_handle)m_handle, gemmType, m_data, stream, start, stop));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmInstance::run(const GemmInputsV2& inputs, hipStream_t stream)
+    try
+    {
+        rocblaslt::Debug::markerStart("hipblasLtRunInputsCpp");
+        if(m_gemm_count == 0)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        if(m_gemm_type != GemmType::HIPBLASLT_GEMM)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        auto gemmType    = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
+        auto rocepinputs = reinterpret_cast<const rocblaslt::RocGemmInputsV2*>(inputs.pimpl.get());
+        auto status      = RocBlasLtStatusToHIPStatus(rocblaslt_run_inputs_cpp(
+            (rocblaslt_handle)m_handle, gemmType, m_data, *rocepinputs, stream));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmInstance::runBatch(const std::vector<GemmInstance*>& instances,
+                                           hipStream_t                       stream)
+    try
+    {
+        rocblaslt::Debug::markerStart("hipblasLtRunBatchCpp");
+        std::vector<rocblaslt_handle>       handles;
+        std::vector<rocblaslt::RocGemmType> gemmTypes;
+        std::vector<void*>                  gemmData;
+        handles.reserve(instances.size());
+        gemmTypes.reserve(instances.size());
+        gemmData.reserve(instances.size());
+        for(auto instance : instances)
+        {
+            if(instance == nullptr || instance->m_gemm_count == 0)
+            {
+                rocblaslt::Debug::markerStop();
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            }
+            handles.push_back((rocblaslt_handle)instance->m_handle);
+            gemmTypes.push_back(static_cast<rocblaslt::RocGemmType>(instance->m_gemm_type));
+            gemmData.push_back(instance->m_data.get());
+        }
+
+        auto status = RocBlasLtStatusToHIPStatus(
+            rocblaslt_run_batch_cpp(handles, gemmTypes, gemmData, stream));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmInstance::createGraphNode(hipGraph_t                         graph,
+                                                  const std::vector<hipGraphNode_t>& dependencies,
+                                                  hipGraphNode_t&                    node)
+    try
+    {
+        rocblaslt::Debug::markerStart("hipblasLtCreateGraphNodeCpp");
+        if(m_gemm_count == 0)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        if(m_gemm_type != GemmType::HIPBLASLT_GEMM)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
+        auto status   = RocBlasLtStatusToHIPStatus(
+            rocblaslt_graph_node_create_cpp((rocblaslt_handle)m_handle,
+                                            gemmType,
+                                            m_data,
+                                            graph,
+                                            dependencies.data(),
+                                            dependencies.size(),
+                                            &node));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmInstance::updateGraphNode(hipGraphExec_t exec,
+                                                  hipGraphNode_t node,
+                                                  GemmInputsV2&  inputs)
+    try
+    {
+        rocblaslt::Debug::markerStart("hipblasLtUpdateGraphNodeCpp");
+        if(m_gemm_count == 0)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        if(m_gemm_type != GemmType::HIPBLASLT_GEMM)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        auto gemmType    = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
+        auto rocepinputs = reinterpret_cast<rocblaslt::RocGemmInputsV2*>(inputs.pimpl.get());
+        auto status      = RocBlasLtStatusToHIPStatus(rocblaslt_graph_node_update_cpp(
+            (rocblaslt_handle)m_handle, gemmType, m_data, *rocepinputs, exec, node));
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -880,7 +1375,7 @@ namespace hipblaslt_ext
                hipblasComputeType_t typeCompute)
         : GemmInstance(handle, GemmType::HIPBLASLT_GEMM)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtCreateGemmCpp");
+        rocblaslt::Debug::markerStart("hipblasLtCreateGemmCpp");
         m_problem_types.push_back({opA, opB, typeA, typeB, typeC, typeD, typeCompute});
         rocblaslt_init_gemmData((rocblaslt_handle)m_handle,
                                 static_cast<rocblaslt::RocGemmType>(m_gemm_type),
@@ -893,7 +1388,7 @@ namespace hipblaslt_ext
                                 (rocblaslt_compute_type)typeCompute,
                                 0,
                                 m_data);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
     }
 
     Gemm::Gemm(hipblasLtHandle_t       handle,
@@ -910,13 +1405,13 @@ namespace hipblaslt_ext
                hipblasLtMatrixLayout_t matD)
         : GemmInstance(handle, GemmType::HIPBLASLT_GEMM)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtCreateGemmCAPICpp");
+        rocblaslt::Debug::markerStart("hipblasLtCreateGemmCAPICpp");
         auto status = setProblem(matmul_descr, alpha, A, matA, B, matB, beta, C, matC, D, matD);
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             std::cout << "Failed to create instance " << status << std::endl;
         }
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
     }
 
     Gemm::Gemm(Gemm&&) noexcept            = default;
@@ -929,10 +1424,10 @@ namespace hipblaslt_ext
                                      GemmEpilogue& epilogue,
                                      GemmInputs&   inputs)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGemmSetProblemCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGemmSetProblemCpp");
         if(n == 0 || m == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
 
@@ -957,7 +1452,7 @@ namespace hipblaslt_ext
                                  epilogue,
                                  inputs,
                                  m_problem_types[0]);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -968,10 +1463,10 @@ namespace hipblaslt_ext
                                      GemmEpilogueV2& epilogue,
                                      GemmInputsV2&   inputs)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGemmSetProblemV2Cpp");
+        rocblaslt::Debug::markerStart("hipblasLtGemmSetProblemV2Cpp");
         if(n == 0 || m == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
 
@@ -1003,7 +1498,7 @@ namespace hipblaslt_ext
                                  epilogue,
                                  inputs,
                                  prob);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1023,7 +1518,7 @@ namespace hipblaslt_ext
                                      GemmInputs&        inputs,
                                      GemmProblemType&   problemtype)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGemmSetProblemFullCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGemmSetProblemFullCpp");
         GemmInputs      gemmInputs      = inputs;
         GemmProblemType gemmProblemType = problemtype;
         auto            rocepilogue     = reinterpret_cast<rocblaslt::RocGemmEpilogue*>(&epilogue);
@@ -1052,7 +1547,7 @@ namespace hipblaslt_ext
         {
             m_problem_types[0] = problemtype;
         }
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1072,7 +1567,7 @@ namespace hipblaslt_ext
                                      GemmInputsV2&      inputs,
                                      GemmProblemTypeV2& problemtype)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGemmSetProblemFullV2Cpp");
+        rocblaslt::Debug::markerStart("hipblasLtGemmSetProblemFullV2Cpp");
         auto rocepilogue = reinterpret_cast<rocblaslt::RocGemmEpilogueV2*>(epilogue.pimpl.get());
         auto rocepinputs = reinterpret_cast<rocblaslt::RocGemmInputsV2*>(inputs.pimpl.get());
         auto rocproblemtype
@@ -1106,7 +1601,7 @@ namespace hipblaslt_ext
                                                  problemtype.getTypeD(),
                                                  problemtype.getTypeCompute()};
         }
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1122,7 +1617,7 @@ namespace hipblaslt_ext
                                      void*                   D,
                                      hipblasLtMatrixLayout_t matD)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGemmSetProblemCAPICpp");
+        rocblaslt::Debug::markerStart("hipblasLtGemmSetProblemCAPICpp");
         auto rocproblemtypes
             = reinterpret_cast<std::vector<rocblaslt::RocGemmProblemType>*>(&m_problem_types);
         auto status = RocBlasLtStatusToHIPStatus(
@@ -1141,7 +1636,7 @@ namespace hipblaslt_ext
                                       (*rocproblemtypes)[0],
                                       m_data,
                                       m_gemm_count));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1162,6 +1657,153 @@ namespace hipblaslt_ext
         return problemtype;
     }
 
+    // State of GroupedGemm::run(const FanOutOptions&, hipStream_t)
+    struct GroupedGemmFanOut
+    {
+        // The problem of the last setProblem() with GemmInputsV2 or GemmInputsV2Data
+        std::vector<int64_t>            m, n, k, batch, lda, ldb, ldc, ldd;
+        std::vector<int64_t>            strideA, strideB, strideC, strideD;
+        std::vector<GemmEpilogueV2Data> epilogue;
+        std::vector<GemmInputsV2Data>   inputs;
+        GemmProblemTypeV2               problemType;
+
+        // Size classes built for options, streams[c - 1] and events[c] belong to class c
+        bool                     built = false;
+        FanOutOptions            options;
+        std::vector<GroupedGemm> classes;
+        std::vector<hipStream_t> streams;
+        std::vector<hipEvent_t>  events;
+
+        ~GroupedGemmFanOut()
+        {
+            for(auto stream : streams)
+                static_cast<void>(hipStreamDestroy(stream));
+            for(auto event : events)
+                static_cast<void>(hipEventDestroy(event));
+        }
+
+        bool sameOptions(const FanOutOptions& other) const
+        {
+            return options.maxClasses == other.maxClasses
+                   && options.classRatio == other.classRatio
+                   && options.workspace == other.workspace
+                   && options.workspaceBytes == other.workspaceBytes;
+        }
+
+        hipblasStatus_t build(hipblasLtHandle_t handle, const FanOutOptions& newOptions)
+        {
+            built   = false;
+            options = newOptions;
+            classes.clear();
+
+            std::vector<size_t> order(m.size());
+            std::vector<double> work(m.size());
+            for(size_t i = 0; i < m.size(); i++)
+            {
+                order[i] = i;
+                work[i]  = double(m[i]) * n[i] * k[i] * batch[i];
+            }
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return work[a] > work[b];
+            });
+
+            std::vector<std::vector<size_t>> members(1);
+            double                           classWork = work[order[0]];
+            for(auto i : order)
+            {
+                if(members.size() < options.maxClasses && !members.back().empty()
+                   && work[i] * options.classRatio < classWork)
+                {
+                    members.emplace_back();
+                    classWork = work[i];
+                }
+                members.back().push_back(i);
+            }
+
+            // Slices of the workspace keep the 256 byte alignment of the kernels
+            const size_t slice = options.workspaceBytes / members.size() / 256 * 256;
+            for(size_t c = 0; c < members.size(); c++)
+            {
+                GroupedGemm sub(handle,
+                                problemType.getOpA(),
+                                problemType.getOpB(),
+                                problemType.getTypeA(),
+                                problemType.getTypeB(),
+                                problemType.getTypeC(),
+                                problemType.getTypeD(),
+                                problemType.getTypeCompute());
+
+                std::vector<int64_t>            sm, sn, sk, sbatch, slda, sldb, sldc, sldd;
+                std::vector<int64_t>            sstrideA, sstrideB, sstrideC, sstrideD;
+                std::vector<GemmEpilogueV2Data> sepilogue;
+                std::vector<GemmInputsV2Data>   sinputs;
+                for(auto i : members[c])
+                {
+                    sm.push_back(m[i]);
+                    sn.push_back(n[i]);
+                    sk.push_back(k[i]);
+                    sbatch.push_back(batch[i]);
+                    slda.push_back(lda[i]);
+                    sldb.push_back(ldb[i]);
+                    sldc.push_back(ldc[i]);
+                    sldd.push_back(ldd[i]);
+                    sstrideA.push_back(strideA[i]);
+                    sstrideB.push_back(strideB[i]);
+                    sstrideC.push_back(strideC[i]);
+                    sstrideD.push_back(strideD[i]);
+                    sepilogue.push_back(epilogue[std::min(i, epilogue.size() - 1)]);
+                    sinputs.push_back(inputs[i]);
+                }
+                auto status = sub.setProblem(sm,
+                                             sn,
+                                             sk,
+                                             sbatch,
+                                             slda,
+                                             sldb,
+                                             sldc,
+                                             sldd,
+                                             sstrideA,
+                                             sstrideB,
+                                             sstrideC,
+                                             sstrideD,
+                                             sepilogue,
+                                             sinputs,
+                                             problemType);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+
+                GemmPreferenceV2 pref;
+                pref.setMaxWorkspaceBytes(slice);
+                std::vector<hipblasLtMatmulHeuristicResult_t> results;
+                status = sub.algoGetHeuristic(1, pref, results);
+                if(status != HIPBLAS_STATUS_SUCCESS || results.empty())
+                    return HIPBLAS_STATUS_NOT_SUPPORTED;
+                status = sub.initialize(results[0].algo,
+                                        slice ? (uint8_t*)options.workspace + c * slice : nullptr);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+                classes.push_back(std::move(sub));
+            }
+
+            while(streams.size() + 1 < classes.size())
+            {
+                hipStream_t stream;
+                if(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                streams.push_back(stream);
+            }
+            while(events.size() < classes.size())
+            {
+                hipEvent_t event;
+                if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                events.push_back(event);
+            }
+            built = true;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    };
+
     HIPBLASLT_EXPORT GroupedGemm::GroupedGemm(hipblasLtHandle_t    handle,
                                               hipblasOperation_t   opA,
                                               hipblasOperation_t   opB,
@@ -1172,7 +1814,7 @@ namespace hipblaslt_ext
                                               hipblasComputeType_t typeCompute)
         : GemmInstance(handle, GemmType::HIPBLASLT_GROUPED_GEMM)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtCreateGroupedGemmCpp");
+        rocblaslt::Debug::markerStart("hipblasLtCreateGroupedGemmCpp");
         m_problem_types.push_back({opA, opB, typeA, typeB, typeC, typeD, typeCompute});
         rocblaslt_init_gemmData((rocblaslt_handle)m_handle,
                                 static_cast<rocblaslt::RocGemmType>(m_gemm_type),
@@ -1185,7 +1827,7 @@ namespace hipblaslt_ext
                                 (rocblaslt_compute_type)typeCompute,
                                 0,
                                 m_data);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
     }
 
     GroupedGemm::GroupedGemm(GroupedGemm&&) noexcept            = default;
@@ -1205,13 +1847,13 @@ namespace hipblaslt_ext
                                               std::vector<hipblasLtMatrixLayout_t>& matD)
         : GemmInstance(handle, GemmType::HIPBLASLT_GROUPED_GEMM)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtCreateGroupedGemmCAPICpp");
+        rocblaslt::Debug::markerStart("hipblasLtCreateGroupedGemmCAPICpp");
         auto status = setProblem(matmul_descr, alpha, A, matA, B, matB, beta, C, matC, D, matD);
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             std::cout << "Failed to create instance " << status << std::endl;
         }
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
     }
 
     hipblasStatus_t GroupedGemm::setProblem(std::vector<int64_t>&      m,
@@ -1221,7 +1863,7 @@ namespace hipblaslt_ext
                                             std::vector<GemmEpilogue>& epilogue,
                                             std::vector<GemmInputs>&   inputs)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmSetProblemCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmSetProblemCpp");
         std::vector<int64_t> lda;
         std::vector<int64_t> ldb;
         std::vector<int64_t> ldc;
@@ -1230,6 +1872,8 @@ namespace hipblaslt_ext
         std::vector<int64_t> strideB;
         std::vector<int64_t> strideC;
         std::vector<int64_t> strideD;
+        for(auto v : {&lda, &ldb, &ldc, &ldd, &strideA, &strideB, &strideC, &strideD})
+            v->reserve(m.size());
         for(size_t i = 0; i < m.size(); i++)
         {
             size_t iIdx = m_problem_types.size() == 1 ? 0 : i;
@@ -1257,7 +1901,7 @@ namespace hipblaslt_ext
                                  epilogue,
                                  inputs,
                                  m_problem_types[0]);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1268,7 +1912,7 @@ namespace hipblaslt_ext
                                             std::vector<GemmEpilogueV2>& epilogue,
                                             std::vector<GemmInputsV2>&   inputs)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmSetProblemV2Cpp");
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmSetProblemV2Cpp");
         std::vector<int64_t> lda;
         std::vector<int64_t> ldb;
         std::vector<int64_t> ldc;
@@ -1277,6 +1921,8 @@ namespace hipblaslt_ext
         std::vector<int64_t> strideB;
         std::vector<int64_t> strideC;
         std::vector<int64_t> strideD;
+        for(auto v : {&lda, &ldb, &ldc, &ldd, &strideA, &strideB, &strideC, &strideD})
+            v->reserve(m.size());
         for(size_t i = 0; i < m.size(); i++)
         {
             size_t iIdx = m_problem_types.size() == 1 ? 0 : i;
@@ -1311,7 +1957,7 @@ namespace hipblaslt_ext
                                  epilogue,
                                  inputs,
                                  prob);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1331,7 +1977,7 @@ namespace hipblaslt_ext
                                             std::vector<GemmInputs>&   inputs,
                                             GemmProblemType&           problemtype)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmSetProblemFullCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmSetProblemFullCpp");
         auto rocepilogue = reinterpret_cast<std::vector<rocblaslt::RocGemmEpilogue>*>(&epilogue);
         auto rocinputs   = reinterpret_cast<std::vector<rocblaslt::RocGemmInputs>*>(&inputs);
         std::vector<GemmProblemType> tmptype = {problemtype};
@@ -1360,7 +2006,7 @@ namespace hipblaslt_ext
         {
             m_problem_types = tmptype;
         }
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1380,20 +2026,82 @@ namespace hipblaslt_ext
                                             std::vector<GemmInputsV2>&   inputs,
                                             GemmProblemTypeV2&           problemtype)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmSetProblemFullV2Cpp");
-        std::vector<rocblaslt::RocGemmEpilogueV2> rocepilogue;
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmSetProblemFullV2Cpp");
+        std::vector<GemmEpilogueV2Data> epilogueData;
+        epilogueData.reserve(epilogue.size());
         for(auto& e : epilogue)
-        {
-            rocepilogue.push_back(*reinterpret_cast<rocblaslt::RocGemmEpilogueV2*>(e.pimpl.get()));
-        }
+            epilogueData.push_back(*e.pimpl);
 
-        std::vector<rocblaslt::RocGemmInputsV2> rocinputs;
+        std::vector<GemmInputsV2Data> inputsData;
+        inputsData.reserve(inputs.size());
         for(auto& i : inputs)
+            inputsData.push_back(*i.pimpl);
+
+        auto status = setProblem(m,
+                                 n,
+                                 k,
+                                 batch_count,
+                                 lda,
+                                 ldb,
+                                 ldc,
+                                 ldd,
+                                 strideA,
+                                 strideB,
+                                 strideC,
+                                 strideD,
+                                 epilogueData,
+                                 inputsData,
+                                 problemtype);
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t GroupedGemm::setProblem(std::vector<int64_t>&            m,
+                                            std::vector<int64_t>&            n,
+                                            std::vector<int64_t>&            k,
+                                            std::vector<int64_t>&            batch_count,
+                                            std::vector<int64_t>&            lda,
+                                            std::vector<int64_t>&            ldb,
+                                            std::vector<int64_t>&            ldc,
+                                            std::vector<int64_t>&            ldd,
+                                            std::vector<int64_t>&            strideA,
+                                            std::vector<int64_t>&            strideB,
+                                            std::vector<int64_t>&            strideC,
+                                            std::vector<int64_t>&            strideD,
+                                            std::vector<GemmEpilogueV2Data>& epilogue,
+                                            std::vector<GemmInputsV2Data>&   inputs,
+                                            GemmProblemTypeV2&               problemtype)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmSetProblemDataCpp");
+        // Only a shared operand needs a copy of the inputs, to replicate its pointer
+        std::vector<GemmInputsV2Data> sharedInputs;
+        auto*                         groupInputs = &inputs;
+        if(m_shared_operand != SharedOperand::NONE && !inputs.empty())
         {
-            rocinputs.push_back(*reinterpret_cast<rocblaslt::RocGemmInputsV2*>(i.pimpl.get()));
+            const bool shareA = m_shared_operand == SharedOperand::A;
+            auto&      rows   = shareA ? m : n;
+            auto&      ld     = shareA ? lda : ldb;
+            auto&      stride = shareA ? strideA : strideB;
+            sharedInputs      = inputs;
+            for(size_t i = 1; i < sharedInputs.size(); i++)
+            {
+                if(rows[i] != rows[0] || k[i] != k[0] || ld[i] != ld[0]
+                   || stride[i] != stride[0] || batch_count[i] != batch_count[0])
+                {
+                    rocblaslt::Debug::markerStop();
+                    return HIPBLAS_STATUS_INVALID_VALUE;
+                }
+                if(shareA)
+                    sharedInputs[i].a = sharedInputs[0].a;
+                else
+                    sharedInputs[i].b = sharedInputs[0].b;
+            }
+            groupInputs = &sharedInputs;
         }
-        GemmProblemTypeV2 tmp = problemtype;
-        std::vector<rocblaslt::RocGemmProblemTypeV2> rocproblemtype = {*reinterpret_cast<rocblaslt::RocGemmProblemTypeV2*>(tmp.pimpl.get())};
+        auto rocepilogue = reinterpret_cast<std::vector<rocblaslt::RocGemmEpilogueV2>*>(&epilogue);
+        auto rocinputs = reinterpret_cast<std::vector<rocblaslt::RocGemmInputsV2>*>(groupInputs);
+        std::vector<rocblaslt::RocGemmProblemTypeV2> rocproblemtype
+            = {*reinterpret_cast<rocblaslt::RocGemmProblemTypeV2*>(problemtype.pimpl.get())};
         auto status = RocBlasLtStatusToHIPStatus(
             rocblaslt_groupedgemm_create_cpp((rocblaslt_handle)m_handle,
                                              m,
@@ -1408,13 +2116,37 @@ namespace hipblaslt_ext
                                              strideB,
                                              strideC,
                                              strideD,
-                                             rocepilogue,
-                                             rocinputs,
+                                             *rocepilogue,
+                                             *rocinputs,
                                              rocproblemtype,
                                              m_data,
                                              m_gemm_count));
         if(status == HIPBLAS_STATUS_SUCCESS)
         {
+            // A fan-out of this object alone is refilled in place, keeping its capacity, streams
+            // and events, so setting new sizes every step does not reallocate it
+            auto fanOut = std::static_pointer_cast<GroupedGemmFanOut>(m_fan_out);
+            if(!fanOut || m_fan_out.use_count() != 1)
+                fanOut = std::make_shared<GroupedGemmFanOut>();
+            fanOut->built       = false;
+            fanOut->m           = m;
+            fanOut->n           = n;
+            fanOut->k           = k;
+            fanOut->batch       = batch_count;
+            fanOut->lda         = lda;
+            fanOut->ldb         = ldb;
+            fanOut->ldc         = ldc;
+            fanOut->ldd         = ldd;
+            fanOut->strideA     = strideA;
+            fanOut->strideB     = strideB;
+            fanOut->strideC     = strideC;
+            fanOut->strideD     = strideD;
+            fanOut->epilogue    = epilogue;
+            // The classes are built without the shared operand
+            fanOut->inputs      = *groupInputs;
+            fanOut->problemType = problemtype;
+            m_fan_out           = fanOut;
+
             m_problem_types[0] = GemmProblemType{problemtype.getOpA(),
                                                  problemtype.getOpB(),
                                                  problemtype.getTypeA(),
@@ -1423,7 +2155,7 @@ namespace hipblaslt_ext
                                                  problemtype.getTypeD(),
                                                  problemtype.getTypeCompute()};
         }
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1439,7 +2171,7 @@ namespace hipblaslt_ext
                                             std::vector<void*>&                   D,
                                             std::vector<hipblasLtMatrixLayout_t>& matD)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmSetProblemCAPICpp");
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmSetProblemCAPICpp");
         auto matmul_descr_groupedGemm
             = reinterpret_cast<std::vector<rocblaslt_matmul_desc>*>(&matmul_descr);
         auto matA_groupedGemm  = reinterpret_cast<std::vector<rocblaslt_matrix_layout>*>(&matA);
@@ -1469,10 +2201,16 @@ namespace hipblaslt_ext
                                              (*rocproblemtypes),
                                              m_data,
                                              m_gemm_count));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
+    hipblasStatus_t GroupedGemm::setSharedOperand(SharedOperand operand)
+    {
+        m_shared_operand = operand;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
     std::vector<GemmProblemType> GroupedGemm::getProblemTypes()
     {
         return m_problem_types;
@@ -1497,28 +2235,974 @@ namespace hipblaslt_ext
     HIPBLASLT_EXPORT hipblasStatus_t
         GroupedGemm::getDefaultValueForDeviceUserArguments(void* hostDeviceUserArgs)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmGetDefaultUserArgsCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmGetDefaultUserArgsCpp");
         auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto status   = RocBlasLtStatusToHIPStatus(rocblaslt_get_default_user_args(
             (rocblaslt_handle)m_handle, gemmType, m_data, hostDeviceUserArgs));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
     HIPBLASLT_EXPORT hipblasStatus_t GroupedGemm::run(void* deviceUserArgs, hipStream_t stream)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGroupedGemmRunCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmRunCpp");
         if(m_gemm_count == 0)
         {
-            rocblaslt::Debug::Instance().markerStop();
+            rocblaslt::Debug::markerStop();
             return HIPBLAS_STATUS_INVALID_VALUE;
         }
         auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
         auto status   = RocBlasLtStatusToHIPStatus(rocblaslt_run_user_args_cpp(
             (rocblaslt_handle)m_handle, gemmType, m_data, deviceUserArgs, stream));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    HIPBLASLT_EXPORT hipblasStatus_t GroupedGemm::run(void*                   deviceUserArgs,
+                                                      const DeviceGroupSizes& sizes,
+                                                      hipStream_t             stream)
+    {
+        if(m_gemm_count == 0 || (!sizes.m && !sizes.n && !sizes.k)
+           || (sizes.offsetA && !sizes.baseA) || (sizes.offsetB && !sizes.baseB)
+           || (sizes.offsetD && !sizes.baseD))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmUpdateUserArgsCpp");
+        constexpr uint32_t threads = 256;
+        const uint32_t     blocks  = (m_gemm_count + threads - 1) / threads;
+        hipLaunchKernelGGL(updateDeviceUserArguments,
+                           dim3(blocks),
+                           dim3(threads),
+                           0,
+                           stream,
+                           (UserArguments*)deviceUserArgs,
+                           (uint32_t)m_gemm_count,
+                           sizes);
+        auto err = hipGetLastError();
+        rocblaslt::Debug::markerStop();
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        return run(deviceUserArgs, stream);
+    }
+
+    HIPBLASLT_EXPORT hipblasStatus_t GroupedGemm::getDefaultValueForCompactUserArguments(
+        UserArguments& sharedArgs, CompactGroupArguments* hostGroupArgs)
+    {
+        if(m_gemm_count == 0 || hostGroupArgs == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::vector<UserArguments> userArgs(m_gemm_count);
+        auto                       status = getDefaultValueForDeviceUserArguments(userArgs.data());
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        CompactGroupArguments zero = {};
+        for(size_t i = 0; i < m_gemm_count; i++)
+        {
+            copyGroupArguments(hostGroupArgs[i], userArgs[i]);
+            copyGroupArguments(userArgs[i], zero);
+            if(memcmp(&userArgs[i], &userArgs[0], sizeof(UserArguments)) != 0)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        sharedArgs = userArgs[0];
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    HIPBLASLT_EXPORT hipblasStatus_t GroupedGemm::run(void*                        deviceUserArgs,
+                                                      const UserArguments&         sharedArgs,
+                                                      const CompactGroupArguments* deviceGroupArgs,
+                                                      hipStream_t                  stream)
+    {
+        if(m_gemm_count == 0 || deviceUserArgs == nullptr || deviceGroupArgs == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmDecodeUserArgsCpp");
+        constexpr uint32_t threads = 256;
+        const uint32_t     blocks  = (m_gemm_count + threads - 1) / threads;
+        hipLaunchKernelGGL(decodeCompactUserArguments,
+                           dim3(blocks),
+                           dim3(threads),
+                           0,
+                           stream,
+                           (UserArguments*)deviceUserArgs,
+                           (uint32_t)m_gemm_count,
+                           sharedArgs,
+                           deviceGroupArgs);
+        auto err = hipGetLastError();
+        rocblaslt::Debug::markerStop();
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        return run(deviceUserArgs, stream);
+    }
+
+    HIPBLASLT_EXPORT hipblasStatus_t
+        GroupedGemm::runWithHostUserArgs(const void* hostDeviceUserArgs, hipStream_t stream)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmRunHostUserArgsCpp");
+        if(m_gemm_count == 0 || hostDeviceUserArgs == nullptr)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        auto gemmType = static_cast<rocblaslt::RocGemmType>(m_gemm_type);
+        auto status   = RocBlasLtStatusToHIPStatus(rocblaslt_run_host_user_args_cpp(
+            (rocblaslt_handle)m_handle, gemmType, m_data, hostDeviceUserArgs, stream));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    HIPBLASLT_EXPORT hipblasStatus_t GroupedGemm::run(const FanOutOptions& options,
+                                                      hipStream_t          stream)
+    try
+    {
+        if(m_gemm_count == 0 || options.maxClasses == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        auto fanOut = std::static_pointer_cast<GroupedGemmFanOut>(m_fan_out);
+        if(!fanOut || fanOut->m.size() != m_gemm_count)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        rocblaslt::Debug::markerStart("hipblasLtGroupedGemmRunFanOutCpp");
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(!fanOut->built || !fanOut->sameOptions(options))
+            status = fanOut->build(m_handle, options);
+
+        if(status == HIPBLAS_STATUS_SUCCESS && fanOut->classes.size() == 1)
+        {
+            status = fanOut->classes[0].run(stream);
+        }
+        else if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            auto& events = fanOut->events;
+            if(hipEventRecord(events[0], stream) != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            for(size_t c = 1; c < fanOut->classes.size() && status == HIPBLAS_STATUS_SUCCESS; c++)
+                if(hipStreamWaitEvent(fanOut->streams[c - 1], events[0], 0) != hipSuccess)
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = fanOut->classes[0].run(stream);
+            for(size_t c = 1; c < fanOut->classes.size() && status == HIPBLAS_STATUS_SUCCESS; c++)
+            {
+                auto forked = fanOut->streams[c - 1];
+                status      = fanOut->classes[c].run(forked);
+                if(status == HIPBLAS_STATUS_SUCCESS
+                   && (hipEventRecord(events[c], forked) != hipSuccess
+                       || hipStreamWaitEvent(stream, events[c], 0) != hipSuccess))
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            }
+        }
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t batchedTinyGemm(hipblasLtHandle_t        handle,
+                                    hipblasOperation_t       opA,
+                                    hipblasOperation_t       opB,
+                                    hipDataType              typeAB,
+                                    hipDataType              typeCD,
+                                    const TinyGemmArguments* deviceArgs,
+                                    uint32_t                 count,
+                                    hipStream_t              stream)
+    try
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(deviceArgs == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblaslt::Debug::markerStart("hipblasLtBatchedTinyGemmCpp");
+        const bool      transA = opA != HIPBLAS_OP_N;
+        const bool      transB = opB != HIPBLAS_OP_N;
+        hipblasStatus_t status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(typeAB == HIP_R_32F && typeCD == HIP_R_32F)
+            status = launchTinyGemm<float, float>(deviceArgs, count, transA, transB, stream);
+        else if(typeAB == HIP_R_16F && typeCD == HIP_R_16F)
+            status = launchTinyGemm<_Float16, _Float16>(deviceArgs, count, transA, transB, stream);
+        else if(typeAB == HIP_R_16F && typeCD == HIP_R_32F)
+            status = launchTinyGemm<_Float16, float>(deviceArgs, count, transA, transB, stream);
+        else if(typeAB == HIP_R_16BF && typeCD == HIP_R_16BF)
+            status = launchTinyGemm<hip_bfloat16, hip_bfloat16>(
+                deviceArgs, count, transA, transB, stream);
+        else if(typeAB == HIP_R_16BF && typeCD == HIP_R_32F)
+            status = launchTinyGemm<hip_bfloat16, float>(deviceArgs, count, transA, transB, stream);
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t fusedMlpGemm(hipblasLtHandle_t        handle,
+                                 const FusedMlpArguments& args,
+                                 hipDataType              typeIn,
+                                 hipDataType              typeOut,
+                                 hipStream_t              stream)
+    try
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        bool bias1, bias2;
+        int  act1, act2;
+        if(args.hidden > FusedMlpMaxHidden || !fusedMlpEpilogue(args.epilogue1, bias1, act1)
+           || !fusedMlpEpilogue(args.epilogue2, bias2, act2))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(args.m == 0 || args.n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(args.ldx < args.m || args.ldw1 < args.k || args.ldw2 < args.hidden
+           || args.ldy < args.m)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(args.y == nullptr || (args.hidden > 0 && args.w2 == nullptr)
+           || (args.hidden > 0 && args.k > 0 && (args.x == nullptr || args.w1 == nullptr))
+           || (bias1 && args.hidden > 0 && args.bias1 == nullptr)
+           || (bias2 && args.bias2 == nullptr))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblaslt::Debug::markerStart("hipblasLtFusedMlpGemmCpp");
+        hipblasStatus_t status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(typeIn == HIP_R_32F && typeOut == HIP_R_32F)
+            status = launchFusedMlp<float, float>(args, bias1, act1, bias2, act2, stream);
+        else if(typeIn == HIP_R_16F && typeOut == HIP_R_16F)
+            status = launchFusedMlp<_Float16, _Float16>(args, bias1, act1, bias2, act2, stream);
+        else if(typeIn == HIP_R_16F && typeOut == HIP_R_32F)
+            status = launchFusedMlp<_Float16, float>(args, bias1, act1, bias2, act2, stream);
+        else if(typeIn == HIP_R_16BF && typeOut == HIP_R_16BF)
+            status = launchFusedMlp<hip_bfloat16, hip_bfloat16>(
+                args, bias1, act1, bias2, act2, stream);
+        else if(typeIn == HIP_R_16BF && typeOut == HIP_R_32F)
+            status = launchFusedMlp<hip_bfloat16, float>(args, bias1, act1, bias2, act2, stream);
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    // Bytes of an element of a type that multiDeviceGemm() offsets pointers by, 0 if unknown
+    size_t multiDeviceElementBytes(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_64F:
+            return 8;
+        case HIP_R_32F:
+        case HIP_R_32I:
+            return 4;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_8I:
+        case HIP_R_8F_E4M3_FNUZ:
+        case HIP_R_8F_E5M2_FNUZ:
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+        case HIP_R_8F_E5M2:
+#endif
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    hipblasStatus_t multiDeviceGemm(std::vector<MultiDeviceShard>& shards,
+                                    MultiDeviceSplit               split,
+                                    int64_t                        m,
+                                    int64_t                        n,
+                                    int64_t                        k,
+                                    int64_t                        batch_count,
+                                    int64_t                        lda,
+                                    int64_t                        ldb,
+                                    int64_t                        ldc,
+                                    int64_t                        ldd,
+                                    int64_t                        strideA,
+                                    int64_t                        strideB,
+                                    int64_t                        strideC,
+                                    int64_t                        strideD,
+                                    GemmEpilogueV2&                epilogue,
+                                    GemmInputsV2&                  inputs,
+                                    GemmProblemTypeV2&             problemtype)
+    try
+    {
+        if(shards.empty())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        for(auto& shard : shards)
+            if(shard.handle == nullptr)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+        const bool splitM = split == MultiDeviceSplit::M;
+        switch(epilogue.getMode())
+        {
+        case HIPBLASLT_EPILOGUE_DEFAULT:
+        case HIPBLASLT_EPILOGUE_RELU:
+        case HIPBLASLT_EPILOGUE_BIAS:
+        case HIPBLASLT_EPILOGUE_RELU_BIAS:
+        case HIPBLASLT_EPILOGUE_GELU:
+        case HIPBLASLT_EPILOGUE_GELU_BIAS:
+            break;
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+        if(inputs.getAmaxD()
+           || (splitM
+               && (inputs.getScaleAlphaVec() || epilogue.getScalingAType()
+                   || (inputs.getBias()
+                       && !multiDeviceElementBytes(epilogue.getBiasDataType()))))
+           || (!splitM && epilogue.getScalingBType()))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        const size_t bytesA = multiDeviceElementBytes(problemtype.getTypeA());
+        const size_t bytesB = multiDeviceElementBytes(problemtype.getTypeB());
+        const size_t bytesC = multiDeviceElementBytes(problemtype.getTypeC());
+        const size_t bytesD = multiDeviceElementBytes(problemtype.getTypeD());
+        if(!bytesA || !bytesB || !bytesC || !bytesD)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        int previousDevice = 0;
+        if(hipGetDevice(&previousDevice) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        rocblaslt::Debug::markerStart("hipblasLtMultiDeviceGemmCpp");
+        // Blocks in multiples of 256 keep whole macro tiles on every device but the last
+        const int64_t   size   = splitM ? m : n;
+        const int64_t   shardN = shards.size();
+        const int64_t   block  = ((size + shardN - 1) / shardN + 255) / 256 * 256;
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(size_t i = 0; i < shards.size() && status == HIPBLAS_STATUS_SUCCESS; i++)
+        {
+            auto&         shard = shards[i];
+            const int64_t first = std::min<int64_t>(int64_t(i) * block, size);
+            const int64_t count = std::min(block, size - first);
+            if(hipSetDevice(shard.device) != hipSuccess)
+            {
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+                break;
+            }
+
+            if(count > 0)
+            {
+                GemmInputsV2 blockInputs(inputs);
+                if(splitM)
+                {
+                    const int64_t offsetA = problemtype.getOpA() == HIPBLAS_OP_N ? first
+                                                                                 : first * lda;
+                    blockInputs.setA((const uint8_t*)inputs.getA() + offsetA * bytesA);
+                    blockInputs.setC((const uint8_t*)inputs.getC() + first * bytesC);
+                    blockInputs.setD((const uint8_t*)inputs.getD() + first * bytesD);
+                    if(inputs.getBias())
+                        blockInputs.setBias(
+                            (const uint8_t*)inputs.getBias()
+                            + first * multiDeviceElementBytes(epilogue.getBiasDataType()));
+                }
+                else
+                {
+                    const int64_t offsetB = problemtype.getOpB() == HIPBLAS_OP_N ? first * ldb
+                                                                                 : first;
+                    blockInputs.setB((const uint8_t*)inputs.getB() + offsetB * bytesB);
+                    blockInputs.setC((const uint8_t*)inputs.getC() + first * ldc * bytesC);
+                    blockInputs.setD((const uint8_t*)inputs.getD() + first * ldd * bytesD);
+                }
+
+                Gemm gemm(shard.handle,
+                          problemtype.getOpA(),
+                          problemtype.getOpB(),
+                          problemtype.getTypeA(),
+                          problemtype.getTypeB(),
+                          problemtype.getTypeC(),
+                          problemtype.getTypeD(),
+                          problemtype.getTypeCompute());
+                status = gemm.setProblem(splitM ? count : m,
+                                         splitM ? n : count,
+                                         k,
+                                         batch_count,
+                                         lda,
+                                         ldb,
+                                         ldc,
+                                         ldd,
+                                         strideA,
+                                         strideB,
+                                         strideC,
+                                         strideD,
+                                         epilogue,
+                                         blockInputs,
+                                         problemtype);
+
+                std::vector<hipblasLtMatmulHeuristicResult_t> results;
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                {
+                    GemmPreferenceV2 pref;
+                    pref.setMaxWorkspaceBytes(shard.workspaceBytes);
+                    status = gemm.algoGetHeuristic(1, pref, results);
+                    if(status == HIPBLAS_STATUS_SUCCESS && results.empty())
+                        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+                }
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = gemm.initialize(results[0].algo, shard.workspace);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = gemm.run(shard.stream);
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS && shard.done
+               && hipEventRecord(shard.done, shard.stream) != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        if(hipSetDevice(previousDevice) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t hostStreamingGemm(hipblasLtHandle_t         handle,
+                                      int64_t                   m,
+                                      int64_t                   n,
+                                      int64_t                   k,
+                                      int64_t                   lda,
+                                      int64_t                   ldb,
+                                      int64_t                   ldc,
+                                      int64_t                   ldd,
+                                      int64_t                   chunkK,
+                                      GemmEpilogueV2&           epilogue,
+                                      GemmInputsV2&             inputs,
+                                      GemmProblemTypeV2&        problemtype,
+                                      void*                     workspace,
+                                      size_t                    workspaceBytes,
+                                      hipStream_t               stream,
+                                      std::vector<hipStream_t>& copyStreams)
+    try
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m <= 0 || n <= 0 || k <= 0 || chunkK <= 0 || copyStreams.empty())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        switch(epilogue.getMode())
+        {
+        case HIPBLASLT_EPILOGUE_DEFAULT:
+        case HIPBLASLT_EPILOGUE_RELU:
+        case HIPBLASLT_EPILOGUE_BIAS:
+        case HIPBLASLT_EPILOGUE_RELU_BIAS:
+        case HIPBLASLT_EPILOGUE_GELU:
+        case HIPBLASLT_EPILOGUE_GELU_BIAS:
+            break;
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+        // scaleC and scaleD would be applied again to the partial sums of every chunk
+        if(epilogue.getScalingAType() || epilogue.getScalingBType() || inputs.getScaleC()
+           || inputs.getScaleD() || inputs.getScaleAux() || inputs.getScaleAlphaVec()
+           || inputs.getAux() || inputs.getAmaxD()
+           || problemtype.getTypeC() != problemtype.getTypeD())
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        const size_t bytesA = multiDeviceElementBytes(problemtype.getTypeA());
+        const size_t bytesB = multiDeviceElementBytes(problemtype.getTypeB());
+        if(!bytesA || !bytesB)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // The accumulating chunks read d back as c with a beta of 1 in the scale type
+        union
+        {
+            float   f32;
+            double  f64;
+            int32_t i32;
+        } one;
+        if(problemtype.getTypeCompute() == HIPBLAS_COMPUTE_64F)
+            one.f64 = 1.0;
+        else if(problemtype.getTypeCompute() == HIPBLAS_COMPUTE_32I)
+            one.i32 = 1;
+        else
+            one.f32 = 1.f;
+
+        rocblaslt::Debug::markerStart("hipblasLtHostStreamingGemmCpp");
+        chunkK = std::min(chunkK, k);
+        const bool transA = problemtype.getOpA() != HIPBLAS_OP_N;
+        const bool transB = problemtype.getOpB() != HIPBLAS_OP_N;
+        // A staged chunk is packed: op(a) is m x chunkK and op(b) is chunkK x n
+        const size_t stageBytesA = (m * chunkK * bytesA + 255) / 256 * 256;
+        const size_t slotBytes   = stageBytesA + (chunkK * n * bytesB + 255) / 256 * 256;
+        const size_t slots       = copyStreams.size() + 1;
+
+        uint8_t*                staging = nullptr;
+        std::vector<hipEvent_t> ready(slots, nullptr), released(slots, nullptr);
+        hipblasStatus_t         status = HIPBLAS_STATUS_SUCCESS;
+        if(hipMallocAsync((void**)&staging, slots * slotBytes, stream) != hipSuccess)
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+        for(size_t s = 0; s < slots && status == HIPBLAS_STATUS_SUCCESS; s++)
+        {
+            // The first wait of each slot is on the allocation
+            if(hipEventCreateWithFlags(&ready[s], hipEventDisableTiming) != hipSuccess
+               || hipEventCreateWithFlags(&released[s], hipEventDisableTiming) != hipSuccess
+               || hipEventRecord(released[s], stream) != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        Gemm gemm(handle,
+                  problemtype.getOpA(),
+                  problemtype.getOpB(),
+                  problemtype.getTypeA(),
+                  problemtype.getTypeB(),
+                  problemtype.getTypeC(),
+                  problemtype.getTypeD(),
+                  problemtype.getTypeCompute());
+        GemmEpilogueV2        accumulate;
+        hipblasLtMatmulAlgo_t algo;
+        bool                  haveAlgo = false;
+        for(int64_t c = 0, k0 = 0; k0 < k && status == HIPBLAS_STATUS_SUCCESS; c++, k0 += chunkK)
+        {
+            const int64_t  kc      = std::min(chunkK, k - k0);
+            const size_t   slot    = c % slots;
+            hipStream_t    copy    = copyStreams[c % copyStreams.size()];
+            uint8_t*       stageA  = staging + slot * slotBytes;
+            uint8_t*       stageB  = stageA + stageBytesA;
+            const int64_t  ldA     = transA ? kc : m;
+            const int64_t  ldB     = transB ? n : kc;
+            const int64_t  offsetA = transA ? k0 : k0 * lda;
+            const int64_t  offsetB = transB ? k0 * ldb : k0;
+            const uint8_t* srcA    = (const uint8_t*)inputs.getA() + offsetA * bytesA;
+            const uint8_t* srcB    = (const uint8_t*)inputs.getB() + offsetB * bytesB;
+
+            if(hipStreamWaitEvent(copy, released[slot], 0) != hipSuccess
+               || hipMemcpy2DAsync(stageA,
+                                   ldA * bytesA,
+                                   srcA,
+                                   lda * bytesA,
+                                   ldA * bytesA,
+                                   transA ? m : kc,
+                                   hipMemcpyHostToDevice,
+                                   copy)
+                      != hipSuccess
+               || hipMemcpy2DAsync(stageB,
+                                   ldB * bytesB,
+                                   srcB,
+                                   ldb * bytesB,
+                                   ldB * bytesB,
+                                   transB ? kc : n,
+                                   hipMemcpyHostToDevice,
+                                   copy)
+                      != hipSuccess
+               || hipEventRecord(ready[slot], copy) != hipSuccess
+               || hipStreamWaitEvent(stream, ready[slot], 0) != hipSuccess)
+            {
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+                break;
+            }
+
+            const bool   first = k0 == 0;
+            const bool   last  = k0 + kc == k;
+            GemmInputsV2 chunkInputs(inputs);
+            chunkInputs.setA(stageA);
+            chunkInputs.setB(stageB);
+            if(!first)
+            {
+                chunkInputs.setC(inputs.getD());
+                chunkInputs.setBeta(&one);
+            }
+            if(!last)
+                chunkInputs.setBias(nullptr);
+            status = gemm.setProblem(m,
+                                     n,
+                                     kc,
+                                     1,
+                                     ldA,
+                                     ldB,
+                                     first ? ldc : ldd,
+                                     ldd,
+                                     ldA * (transA ? m : kc),
+                                     ldB * (transB ? kc : n),
+                                     (first ? ldc : ldd) * n,
+                                     ldd * n,
+                                     last ? epilogue : accumulate,
+                                     chunkInputs,
+                                     problemtype);
+
+            // Chunks of the same shape keep the solution of the first one that fits
+            size_t required = 0;
+            if(status == HIPBLAS_STATUS_SUCCESS
+               && (!haveAlgo || gemm.isAlgoSupported(algo, required) != HIPBLAS_STATUS_SUCCESS
+                   || required > workspaceBytes))
+            {
+                std::vector<hipblasLtMatmulHeuristicResult_t> results;
+                GemmPreferenceV2                              pref;
+                pref.setMaxWorkspaceBytes(workspaceBytes);
+                status = gemm.algoGetHeuristic(1, pref, results);
+                if(status == HIPBLAS_STATUS_SUCCESS && results.empty())
+                    status = HIPBLAS_STATUS_NOT_SUPPORTED;
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                {
+                    algo     = results[0].algo;
+                    haveAlgo = true;
+                }
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm.initialize(algo, workspace, true, stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm.run(stream);
+            if(status == HIPBLAS_STATUS_SUCCESS
+               && hipEventRecord(released[slot], stream) != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        // Copies already queued when a chunk failed must finish before the staging is freed
+        for(size_t s = 0; s < slots; s++)
+        {
+            if(ready[s])
+            {
+                hipStreamWaitEvent(stream, ready[s], 0);
+                hipEventDestroy(ready[s]);
+            }
+            if(released[s])
+                hipEventDestroy(released[s]);
+        }
+        if(staging && hipFreeAsync(staging, stream) != hipSuccess
+           && status == HIPBLAS_STATUS_SUCCESS)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t autoFp8Gemm(hipblasLtHandle_t  handle,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                int64_t            batch_count,
+                                int64_t            lda,
+                                int64_t            ldb,
+                                int64_t            ldc,
+                                int64_t            ldd,
+                                int64_t            strideA,
+                                int64_t            strideB,
+                                int64_t            strideC,
+                                int64_t            strideD,
+                                hipDataType        fp8TypeA,
+                                hipDataType        fp8TypeB,
+                                AutoFp8Scales&     scales,
+                                GemmEpilogueV2&    epilogue,
+                                GemmInputsV2&      inputs,
+                                GemmProblemTypeV2& problemtype,
+                                void*              workspace,
+                                size_t             workspaceBytes,
+                                hipStream_t        stream)
+    try
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || !scales.scaleA || !scales.scaleB)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto isHalf = [](hipDataType type) { return type == HIP_R_16F || type == HIP_R_16BF; };
+        auto isFp8  = [](hipDataType type) {
+            return type == HIP_R_8F_E4M3_FNUZ || type == HIP_R_8F_E5M2_FNUZ;
+        };
+        if(!isHalf(problemtype.getTypeA()) || !isHalf(problemtype.getTypeB()) || !isFp8(fp8TypeA)
+           || !isFp8(fp8TypeB) || epilogue.getScalingAType() || epilogue.getScalingBType())
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // a and b are quantized as flat tensors, so padding would count in their amax
+        const bool    transA = problemtype.getOpA() != HIPBLAS_OP_N;
+        const bool    transB = problemtype.getOpB() != HIPBLAS_OP_N;
+        const int64_t rowsA  = transA ? k : m;
+        const int64_t rowsB  = transB ? n : k;
+        const int64_t sizeA  = rowsA * (transA ? m : k);
+        const int64_t sizeB  = rowsB * (transB ? k : n);
+        const int64_t colsA  = sizeA / rowsA * batch_count;
+        const int64_t colsB  = sizeB / rowsB * batch_count;
+        if(lda != rowsA || ldb != rowsB
+           || batch_count > 1 && (strideA != sizeA || strideB != sizeB) || rowsA > UINT32_MAX || rowsB > UINT32_MAX || colsA > UINT32_MAX || colsB > UINT32_MAX)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblaslt::Debug::markerStart("hipblasLtAutoFp8GemmCpp");
+        const size_t bytesA    = (rowsA * colsA + 255) / 256 * 256;
+        uint8_t*     quantized = nullptr;
+        auto         status    = HIPBLAS_STATUS_SUCCESS;
+        if(hipMallocAsync((void**)&quantized, bytesA + rowsB * colsB, stream) != hipSuccess)
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasltExtFp8QuantizeTensor tensors[2];
+            tensors[0] = {quantized,
+                          const_cast<void*>(inputs.getA()),
+                          scales.scaleA,
+                          scales.amaxA,
+                          uint32_t(rowsA),
+                          uint32_t(colsA),
+                          problemtype.getTypeA(),
+                          fp8TypeA};
+            tensors[1] = {quantized + bytesA,
+                          const_cast<void*>(inputs.getB()),
+                          scales.scaleB,
+                          scales.amaxB,
+                          uint32_t(rowsB),
+                          uint32_t(colsB),
+                          problemtype.getTypeB(),
+                          fp8TypeB};
+            status = hipblasltExtFp8Quantize(scales.scaling, tensors, 2, stream);
+        }
+
+        GemmProblemTypeV2 fp8Type(problemtype);
+        fp8Type.setTypeA(fp8TypeA);
+        fp8Type.setTypeB(fp8TypeB);
+        GemmInputsV2 fp8Inputs(inputs);
+        fp8Inputs.setA(quantized);
+        fp8Inputs.setB(quantized + bytesA);
+        fp8Inputs.setScaleA(scales.scaleA);
+        fp8Inputs.setScaleB(scales.scaleB);
+
+        Gemm gemm(handle,
+                  fp8Type.getOpA(),
+                  fp8Type.getOpB(),
+                  fp8TypeA,
+                  fp8TypeB,
+                  fp8Type.getTypeC(),
+                  fp8Type.getTypeD(),
+                  fp8Type.getTypeCompute());
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm.setProblem(m,
+                                     n,
+                                     k,
+                                     batch_count,
+                                     lda,
+                                     ldb,
+                                     ldc,
+                                     ldd,
+                                     strideA,
+                                     strideB,
+                                     strideC,
+                                     strideD,
+                                     epilogue,
+                                     fp8Inputs,
+                                     fp8Type);
+
+        std::vector<hipblasLtMatmulHeuristicResult_t> results;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            GemmPreferenceV2 pref;
+            pref.setMaxWorkspaceBytes(workspaceBytes);
+            status = gemm.algoGetHeuristic(1, pref, results);
+            if(status == HIPBLAS_STATUS_SUCCESS && results.empty())
+                status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm.initialize(results[0].algo, workspace, true, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm.run(stream);
+
+        if(quantized && hipFreeAsync(quantized, stream) != hipSuccess
+           && status == HIPBLAS_STATUS_SUCCESS)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    class GemmProgram::GemmProgramImpl
+    {
+    public:
+        struct Entry
+        {
+            std::unique_ptr<Gemm> gemm;
+            std::vector<size_t>   dependencies;
+            hipGraphNode_t        node = nullptr;
+        };
+
+        void destroyGraph()
+        {
+            if(exec)
+                static_cast<void>(hipGraphExecDestroy(exec));
+            if(graph)
+                static_cast<void>(hipGraphDestroy(graph));
+            exec  = nullptr;
+            graph = nullptr;
+            for(auto& entry : entries)
+                entry.node = nullptr;
+        }
+
+        hipblasLtHandle_t  handle = nullptr;
+        std::vector<Entry> entries;
+        hipGraph_t         graph = nullptr;
+        hipGraphExec_t     exec  = nullptr;
+    };
+
+    GemmProgram::GemmProgram(hipblasLtHandle_t handle)
+        : pimpl(std::make_unique<GemmProgramImpl>())
+    {
+        pimpl->handle = handle;
+    }
+
+    GemmProgram::~GemmProgram()
+    {
+        pimpl->destroyGraph();
+    }
+
+    hipblasStatus_t GemmProgram::addGemm(int64_t                    m,
+                                         int64_t                    n,
+                                         int64_t                    k,
+                                         int64_t                    batch_count,
+                                         int64_t                    lda,
+                                         int64_t                    ldb,
+                                         int64_t                    ldc,
+                                         int64_t                    ldd,
+                                         int64_t                    strideA,
+                                         int64_t                    strideB,
+                                         int64_t                    strideC,
+                                         int64_t                    strideD,
+                                         GemmEpilogueV2&            epilogue,
+                                         GemmInputsV2&              inputs,
+                                         GemmProblemTypeV2&         problemtype,
+                                         const std::vector<size_t>& dependencies,
+                                         size_t&                    index)
+    try
+    {
+        if(pimpl->handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(pimpl->exec)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        for(auto dependency : dependencies)
+        {
+            if(dependency >= pimpl->entries.size())
+                return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        auto gemm   = std::make_unique<Gemm>(pimpl->handle,
+                                             problemtype.getOpA(),
+                                             problemtype.getOpB(),
+                                             problemtype.getTypeA(),
+                                             problemtype.getTypeB(),
+                                             problemtype.getTypeC(),
+                                             problemtype.getTypeD(),
+                                             problemtype.getTypeCompute());
+        auto status = gemm->setProblem(m,
+                                       n,
+                                       k,
+                                       batch_count,
+                                       lda,
+                                       ldb,
+                                       ldc,
+                                       ldd,
+                                       strideA,
+                                       strideB,
+                                       strideC,
+                                       strideD,
+                                       epilogue,
+                                       inputs,
+                                       problemtype);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        index = pimpl->entries.size();
+        pimpl->entries.push_back({std::move(gemm), dependencies, nullptr});
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmProgram::compile(void* workspace, size_t workspaceBytes)
+    try
+    {
+        if(pimpl->exec || pimpl->entries.empty())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblaslt::Debug::markerStart("hipblasLtGemmProgramCompileCpp");
+        GemmPreferenceV2 pref;
+        pref.setMaxWorkspaceBytes(workspaceBytes);
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(hipGraphCreate(&pimpl->graph, 0) != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        // The gemms that use the shared workspace run one after another
+        hipGraphNode_t lastWorkspaceNode = nullptr;
+        for(size_t i = 0; i < pimpl->entries.size() && status == HIPBLAS_STATUS_SUCCESS; i++)
+        {
+            auto& entry = pimpl->entries[i];
+
+            std::vector<hipblasLtMatmulHeuristicResult_t> results;
+            status = entry.gemm->algoGetHeuristic(1, pref, results);
+            if(status == HIPBLAS_STATUS_SUCCESS && results.empty())
+                status = HIPBLAS_STATUS_NOT_SUPPORTED;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = entry.gemm->initialize(results[0].algo, workspace);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            std::vector<hipGraphNode_t> dependencies;
+            for(auto dependency : entry.dependencies)
+                dependencies.push_back(pimpl->entries[dependency].node);
+            bool usesWorkspace = results[0].workspaceSize > 0;
+            if(usesWorkspace && lastWorkspaceNode
+               && std::find(dependencies.begin(), dependencies.end(), lastWorkspaceNode)
+                      == dependencies.end())
+                dependencies.push_back(lastWorkspaceNode);
+
+            status = entry.gemm->createGraphNode(pimpl->graph, dependencies, entry.node);
+            if(usesWorkspace)
+                lastWorkspaceNode = entry.node;
+        }
+
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && hipGraphInstantiate(&pimpl->exec, pimpl->graph, nullptr, nullptr, 0) != hipSuccess)
+        {
+            pimpl->exec = nullptr;
+            status      = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            pimpl->destroyGraph();
+        rocblaslt::Debug::markerStop();
         return status;
     }
+    catch(...)
+    {
+        pimpl->destroyGraph();
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmProgram::setInputs(size_t index, GemmInputsV2& inputs)
+    try
+    {
+        if(!pimpl->exec || index >= pimpl->entries.size())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        auto& entry = pimpl->entries[index];
+        return entry.gemm->updateGraphNode(pimpl->exec, entry.node, inputs);
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t GemmProgram::run(hipStream_t stream)
+    {
+        if(!pimpl->exec)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return hipGraphLaunch(pimpl->exec, stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                                 : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    size_t GemmProgram::size() const
+    {
+        return pimpl->entries.size();
+    }
 
     hipblasStatus_t matmulIsAlgoSupported(hipblasLtHandle_t       handle,
                                           hipblasLtMatmulDesc_t   matmulDesc,
@@ -1532,7 +3216,7 @@ namespace hipblaslt_ext
                                           size_t&                 workspaceSizeInBytes)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtMatMulIsAlgoSupportedCpp");
+        rocblaslt::Debug::markerStart("hipblasLtMatMulIsAlgoSupportedCpp");
         auto status = RocBlasLtStatusToHIPStatus(
             rocblaslt_matmul_is_algo_supported((rocblaslt_handle)handle,
                                                (rocblaslt_matmul_desc)matmulDesc,
@@ -1544,7 +3228,7 @@ namespace hipblaslt_ext
                                                (rocblaslt_matrix_layout)Ddesc,
                                                (rocblaslt_matmul_algo*)&algo,
                                                &workspaceSizeInBytes));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -1575,7 +3259,7 @@ namespace hipblaslt_ext
                                 std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults)
     try
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGetAllAlgosCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGetAllAlgosCpp");
         auto results
             = reinterpret_cast<std::vector<rocblaslt_matmul_heuristic_result>*>(&heuristicResults);
         results->clear();
@@ -1590,7 +3274,7 @@ namespace hipblaslt_ext
                                                typeD,
                                                (rocblaslt_compute_type)typeCompute,
                                                *results));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
     catch(...)
@@ -1611,7 +3295,7 @@ namespace hipblaslt_ext
     std::string getSolutionNameFromAlgo(hipblasLtHandle_t handle, hipblasLtMatmulAlgo_t& algo)
     {
         int* algo_ptr = (int*)algo.data;
-        if(*algo_ptr < 0)
+        if(*algo_ptr < 0 && *algo_ptr != SKINNY_GEMM_SOLUTION_INDEX)
         {
             return "";
         }
@@ -1622,7 +3306,7 @@ namespace hipblaslt_ext
     std::string getKernelNameFromAlgo(hipblasLtHandle_t handle, hipblasLtMatmulAlgo_t& algo)
     {
         int* algo_ptr = (int*)algo.data;
-        if(*algo_ptr < 0)
+        if(*algo_ptr < 0 && *algo_ptr != SKINNY_GEMM_SOLUTION_INDEX)
         {
             return "";
         }
@@ -1635,22 +3319,22 @@ namespace hipblaslt_ext
                           std::vector<int>&                              algoIndex,
                           std::vector<hipblasLtMatmulHeuristicResult_t>& heuristicResults)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtGetAlgosFromIndexCpp");
+        rocblaslt::Debug::markerStart("hipblasLtGetAlgosFromIndexCpp");
         auto results
             = reinterpret_cast<std::vector<rocblaslt_matmul_heuristic_result>*>(&heuristicResults);
         results->clear();
         auto status = RocBlasLtStatusToHIPStatus(rocblaslt_matmul_get_algos_from_index_cpp(
             (rocblaslt_handle)handle, algoIndex, *results));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
     hipblasStatus_t copyMatmul(hipblasLtMatmulDesc_t src, hipblasLtMatmulDesc_t dst)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtCopyMatmulCpp");
+        rocblaslt::Debug::markerStart("hipblasLtCopyMatmulCpp");
         auto status = RocBlasLtStatusToHIPStatus(
             rocblaslt_copy_matmul((rocblaslt_matmul_desc)src, (rocblaslt_matmul_desc)dst));
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
@@ -1661,14 +3345,191 @@ namespace hipblaslt_ext
                       hipblasLtMatrixLayout_t Cdesc,
                       hipblasLtMatrixLayout_t Ddesc)
     {
-        rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulIsTunedCpp");
+        rocblaslt::Debug::markerStart("hipblasLtMatmulIsTunedCpp");
         auto status = rocblaslt_matmul_is_tuned((rocblaslt_handle)handle,
                                                 (rocblaslt_matmul_desc)matmulDesc,
                                                 (rocblaslt_matrix_layout)Adesc,
                                                 (rocblaslt_matrix_layout)Bdesc,
                                                 (rocblaslt_matrix_layout)Cdesc,
                                                 (rocblaslt_matrix_layout)Ddesc);
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t matmulAlgoGetHeuristicBatched(
+        hipblasLtHandle_t                                           handle,
+        const std::vector<MatmulProblemDesc>&                       problems,
+        hipblasLtMatmulPreference_t                                 pref,
+        int                                                         requestedAlgoCount,
+        std::vector<std::vector<hipblasLtMatmulHeuristicResult_t>>& heuristicResults)
+    try
+    {
+        rocblaslt::Debug::markerStart("hipblasLtMatmulAlgoGetHeuristicBatchedCpp");
+        std::vector<rocblaslt::RocMatmulProblem> rocProblems(problems.size());
+        for(size_t i = 0; i < problems.size(); i++)
+        {
+            rocProblems[i].matmulDesc = (rocblaslt_matmul_desc)problems[i].matmulDesc;
+            rocProblems[i].matA       = (rocblaslt_matrix_layout)problems[i].Adesc;
+            rocProblems[i].matB       = (rocblaslt_matrix_layout)problems[i].Bdesc;
+            rocProblems[i].matC       = (rocblaslt_matrix_layout)problems[i].Cdesc;
+            rocProblems[i].matD       = (rocblaslt_matrix_layout)problems[i].Ddesc;
+        }
+
+        size_t count = std::max(requestedAlgoCount, 0);
+        std::vector<hipblasLtMatmulHeuristicResult_t> results(problems.size() * count);
+        std::vector<int>                              returnAlgoCount(problems.size(), 0);
+        auto status = RocBlasLtStatusToHIPStatus(rocblaslt_matmul_algo_get_heuristic_batched(
+            (rocblaslt_handle)handle,
+            rocProblems,
+            (rocblaslt_matmul_preference)pref,
+            requestedAlgoCount,
+            reinterpret_cast<rocblaslt_matmul_heuristic_result*>(results.data()),
+            returnAlgoCount.data()));
+
+        heuristicResults.clear();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            heuristicResults.resize(problems.size());
+            for(size_t i = 0; i < problems.size(); i++)
+                heuristicResults[i].assign(results.begin() + i * count,
+                                           results.begin() + i * count + returnAlgoCount[i]);
+        }
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+    catch(...)
+    {
+        return exception_to_hipblas_status();
+    }
+
+    hipblasStatus_t clearMatmulCache(hipblasLtHandle_t handle)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtClearMatmulCacheCpp");
+        auto status
+            = RocBlasLtStatusToHIPStatus(rocblaslt_clear_matmul_cache((rocblaslt_handle)handle));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t setWorkspacePool(hipblasLtHandle_t handle, size_t maxBytes)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtSetWorkspacePoolCpp");
+        auto status = RocBlasLtStatusToHIPStatus(
+            rocblaslt_set_workspace_pool((rocblaslt_handle)handle, maxBytes));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t setPriorityStream(hipblasLtHandle_t handle, bool enable)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtSetPriorityStreamCpp");
+        auto status = RocBlasLtStatusToHIPStatus(
+            rocblaslt_set_priority_stream((rocblaslt_handle)handle, enable));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t setReproducible(hipblasLtHandle_t handle, bool enable)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtSetReproducibleCpp");
+        auto status = RocBlasLtStatusToHIPStatus(
+            rocblaslt_set_reproducible((rocblaslt_handle)handle, enable));
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t getSolutionCacheStats(hipblasLtHandle_t handle, SolutionCacheStats& stats)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtGetSolutionCacheStatsCpp");
+        rocblaslt_solution_cache_stats cacheStats;
+        auto                           status = RocBlasLtStatusToHIPStatus(
+            rocblaslt_get_solution_cache_stats((rocblaslt_handle)handle, &cacheStats));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            stats.hits      = cacheStats.hits;
+            stats.misses    = cacheStats.misses;
+            stats.evictions = cacheStats.evictions;
+            stats.size      = cacheStats.size;
+            stats.capacity  = cacheStats.capacity;
+        }
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t getCallTimings(std::vector<CallTimings>& timings)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtGetCallTimingsCpp");
+        std::vector<rocblaslt::RocCallTiming> callTimings;
+        auto status = RocBlasLtStatusToHIPStatus(rocblaslt_get_call_timings(callTimings));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            timings.clear();
+            for(auto& callTiming : callTimings)
+            {
+                CallTimings entry;
+                entry.signature = callTiming.signature;
+
+                CallTimingHistogram* phases[] = {&entry.total,
+                                                 &entry.validation,
+                                                 &entry.heuristic,
+                                                 &entry.solve,
+                                                 &entry.launch,
+                                                 &entry.device};
+                for(int i = 0; i < rocblaslt::RocCallTiming::phaseCount; i++)
+                {
+                    phases[i]->count   = callTiming.count[i];
+                    phases[i]->totalNs = callTiming.totalNs[i];
+                    phases[i]->buckets.assign(std::begin(callTiming.buckets[i]),
+                                              std::end(callTiming.buckets[i]));
+                }
+                timings.push_back(std::move(entry));
+            }
+        }
+        rocblaslt::Debug::markerStop();
+        return status;
+    }
+
+    hipblasStatus_t
+        traceSolutionSelection(hipblasLtHandle_t                        handle,
+                               hipblasLtMatmulDesc_t                    matmulDesc,
+                               hipblasLtMatrixLayout_t                  Adesc,
+                               hipblasLtMatrixLayout_t                  Bdesc,
+                               hipblasLtMatrixLayout_t                  Cdesc,
+                               hipblasLtMatrixLayout_t                  Ddesc,
+                               size_t                                   maxWorkspaceBytes,
+                               int                                      requestedAlgoCount,
+                               std::vector<SolutionSelectionCandidate>& candidates)
+    {
+        rocblaslt::Debug::markerStart("hipblasLtTraceSolutionSelectionCpp");
+        std::vector<rocblaslt::RocSelectionCandidate> traced;
+        auto status = RocBlasLtStatusToHIPStatus(
+            rocblaslt_matmul_trace_selection((rocblaslt_handle)handle,
+                                             (rocblaslt_matmul_desc)matmulDesc,
+                                             (rocblaslt_matrix_layout)Adesc,
+                                             (rocblaslt_matrix_layout)Bdesc,
+                                             (rocblaslt_matrix_layout)Cdesc,
+                                             (rocblaslt_matrix_layout)Ddesc,
+                                             maxWorkspaceBytes,
+                                             requestedAlgoCount,
+                                             traced));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            candidates.clear();
+            for(auto& candidate : traced)
+            {
+                SolutionSelectionCandidate entry;
+                entry.solutionIndex     = candidate.solutionIndex;
+                entry.solutionName      = std::move(candidate.solutionName);
+                entry.accepted          = candidate.accepted;
+                entry.rank              = candidate.rank;
+                entry.failedPredicate   = std::move(candidate.failedPredicate);
+                entry.requiredWorkspace = candidate.requiredWorkspace;
+                entry.providedWorkspace = candidate.providedWorkspace;
+                entry.score             = candidate.score;
+                candidates.push_back(std::move(entry));
+            }
+        }
+        rocblaslt::Debug::markerStop();
         return status;
     }
 
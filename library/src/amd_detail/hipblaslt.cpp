@@ -46,6 +46,14 @@ bool override_path_compare_git_version(OverrideSingleton& override, hipblasLtHan
 {
     char git_version[128];
     hipblasLtGetGitRevision(handle, &git_version[0]);
+    if(override.database)
+    {
+        if(TuningDatabase::gitVersion(override.file_path) == git_version)
+            return true;
+        override.env_mode = false;
+        return false;
+    }
+
     std::ifstream file_read(override.file_path);
     std::string   firstline;
     std::string   header = "Git Version: ";
@@ -153,31 +161,27 @@ extern "C" {
 hipblasStatus_t hipblasLtCreate(hipblasLtHandle_t* handle)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtCreate");
+    rocblaslt::Debug::markerStart("hipblasLtCreate");
 
     // Check if handle is valid
     if(handle == nullptr)
     {
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
     int             deviceId;
     hipError_t      err;
     hipblasStatus_t retval = HIPBLAS_STATUS_SUCCESS;
-    // TODO: Synchronizer size pass into predicate SynchronizerSizeCheck
-    // 1K just for small size now, need to cal corner case if support all situations
-    void* d_Synchronizer = nullptr;
-    CHECK_HIP_ERROR(hipMalloc(&d_Synchronizer, 16 * 40960 * sizeof(int)));
-    CHECK_HIP_ERROR(hipMemset(d_Synchronizer, 0, sizeof(int) * 16 * 40960));
 
+    // The Synchronizer of GSU/StreamK solutions is allocated on first use, per handle and
+    // stream, with the size the solution requires
     err = hipGetDevice(&deviceId);
     if(err == hipSuccess)
     {
         retval = RocBlasLtStatusToHIPStatus(rocblaslt_create((rocblaslt_handle*)handle));
-        (*(rocblaslt_handle*)handle)->Synchronizer = d_Synchronizer;
     }
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return retval;
 }
 catch(...)
@@ -188,14 +192,9 @@ catch(...)
 hipblasStatus_t hipblasLtDestroy(const hipblasLtHandle_t handle)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtDestroy");
-    if(handle != nullptr and (*(rocblaslt_handle)handle).Synchronizer != nullptr)
-    {
-        CHECK_HIP_ERROR(hipFree((*(rocblaslt_handle)handle).Synchronizer));
-    }
-
+    rocblaslt::Debug::markerStart("hipblasLtDestroy");
     auto status = RocBlasLtStatusToHIPStatus(rocblaslt_destroy((const rocblaslt_handle)handle));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -210,10 +209,10 @@ hipblasStatus_t hipblasLtMatrixLayoutCreate(hipblasLtMatrixLayout_t* matDescr,
                                             int64_t                  ld)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixLayoutCreate");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixLayoutCreate");
     auto status = RocBlasLtStatusToHIPStatus(rocblaslt_matrix_layout_create(
         (rocblaslt_matrix_layout*)matDescr, valueType, rows, cols, ld));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -224,10 +223,10 @@ catch(...)
 hipblasStatus_t hipblasLtMatrixLayoutDestroy(const hipblasLtMatrixLayout_t descr)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixLayoutDestroy");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixLayoutDestroy");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matrix_layout_destory((const rocblaslt_matrix_layout)descr));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -240,10 +239,10 @@ hipblasStatus_t hipblasLtMatmulDescCreate(hipblasLtMatmulDesc_t* matmulDesc,
                                           hipDataType            scaleType)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulDescCreate");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulDescCreate");
     auto status = RocBlasLtStatusToHIPStatus(rocblaslt_matmul_desc_create(
         (rocblaslt_matmul_desc*)matmulDesc, (rocblaslt_compute_type)computeType, scaleType));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -257,13 +256,13 @@ hipblasStatus_t hipblasLtMatrixLayoutSetAttribute(hipblasLtMatrixLayout_t
                                                   size_t                           sizeInBytes)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixLayoutSetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixLayoutSetAttribute");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matrix_layout_set_attribute((rocblaslt_matrix_layout)matLayout,
                                               (rocblaslt_matrix_layout_attribute)attr,
                                               buf,
                                               sizeInBytes));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -278,14 +277,14 @@ hipblasStatus_t hipblasLtMatrixLayoutGetAttribute(hipblasLtMatrixLayout_t
                                                   size_t*                          sizeWritten)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixLayoutGetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixLayoutGetAttribute");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matrix_layout_get_attribute((rocblaslt_matrix_layout)matLayout,
                                               (rocblaslt_matrix_layout_attribute)attr,
                                               buf,
                                               sizeInBytes,
                                               sizeWritten));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -296,10 +295,10 @@ catch(...)
 hipblasStatus_t hipblasLtMatmulDescDestroy(const hipblasLtMatmulDesc_t descr)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulDescDestroy");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulDescDestroy");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_desc_destroy((const rocblaslt_matmul_desc)descr));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -313,13 +312,13 @@ hipblasStatus_t hipblasLtMatmulDescSetAttribute(hipblasLtMatmulDesc_t
                                                 size_t                          sizeInBytes)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulDescSetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulDescSetAttribute");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_desc_set_attribute((rocblaslt_matmul_desc)matmulDesc,
                                             (rocblaslt_matmul_desc_attributes)matmulAttr,
                                             buf,
                                             sizeInBytes));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -333,14 +332,14 @@ hipblasStatus_t hipblasLtMatmulDescGetAttribute(hipblasLtMatmulDesc_t
                                                 size_t*                         sizeWritten)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulDescGetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulDescGetAttribute");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_desc_get_attribute((rocblaslt_matmul_desc)matmulDesc,
                                             (rocblaslt_matmul_desc_attributes)matmulAttr,
                                             buf,
                                             sizeInBytes,
                                             sizeWritten));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -351,10 +350,10 @@ catch(...)
 hipblasStatus_t hipblasLtMatmulPreferenceCreate(hipblasLtMatmulPreference_t* pref)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulPreferenceCreate");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulPreferenceCreate");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_preference_create((rocblaslt_matmul_preference*)pref));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -364,10 +363,10 @@ catch(...)
 hipblasStatus_t hipblasLtMatmulPreferenceDestroy(const hipblasLtMatmulPreference_t pref)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulPreferenceDestroy");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulPreferenceDestroy");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_preference_destroy((const rocblaslt_matmul_preference)pref));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -382,13 +381,13 @@ hipblasStatus_t
                                           size_t                                dataSize)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulPreferenceSetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulPreferenceSetAttribute");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_preference_set_attribute((rocblaslt_matmul_preference)pref,
                                                   (rocblaslt_matmul_preference_attributes)attribute,
                                                   data,
                                                   dataSize));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -404,14 +403,14 @@ hipblasStatus_t
                                           size_t*                               sizeWritten)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulPreferenceGetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulPreferenceGetAttribute");
     auto status = RocBlasLtStatusToHIPStatus(
         rocblaslt_matmul_preference_get_attribute((rocblaslt_matmul_preference)pref,
                                                   (rocblaslt_matmul_preference_attributes)attribute,
                                                   data,
                                                   sizeInBytes,
                                                   sizeWritten));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -432,7 +431,7 @@ hipblasStatus_t
                                     int*                             returnAlgoCount)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmulAlgoGetHeuristic");
+    rocblaslt::Debug::markerStart("hipblasLtMatmulAlgoGetHeuristic");
 
     OverrideSingleton& override = OverrideSingleton::getInstance();
     if(override.env_mode)
@@ -457,7 +456,7 @@ try
         requestedAlgoCount,
         (rocblaslt_matmul_heuristic_result*)heuristicResultsArray,
         returnAlgoCount));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return status;
 }
 catch(...)
@@ -483,7 +482,7 @@ hipblasStatus_t hipblasLtMatmul(hipblasLtHandle_t            handle,
                                 hipStream_t                  stream)
 try
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatmul");
+    rocblaslt::Debug::markerStart("hipblasLtMatmul");
     hipblasStatus_t return_status = HIPBLAS_STATUS_SUCCESS;
 
     return_status = RocBlasLtStatusToHIPStatus(rocblaslt_matmul((rocblaslt_handle)handle,
@@ -502,7 +501,7 @@ try
                                                                 workspace,
                                                                 workspaceSizeInBytes,
                                                                 stream));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return return_status;
 }
 catch(...)
@@ -513,7 +512,7 @@ catch(...)
 hipblasStatus_t hipblasLtMatrixTransformDescCreate(hipblasLtMatrixTransformDesc_t* transformDesc,
                                                    hipDataType                     scaleType)
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixTransformDescCreate");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixTransformDescCreate");
     static_assert(sizeof(rocblaslt_matrix_transform_desc)
                       <= sizeof(hipblasLtMatrixTransformDescOpaque_t),
                   "hipblasLtMatrixTransformDescOpaque_t must have enough space");
@@ -521,16 +520,16 @@ hipblasStatus_t hipblasLtMatrixTransformDescCreate(hipblasLtMatrixTransformDesc_
     desc.scaleType = scaleType;
     *transformDesc = new hipblasLtMatrixTransformDescOpaque_t;
     memcpy((*transformDesc)->data, &desc, sizeof(desc));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return HIPBLAS_STATUS_SUCCESS;
 }
 
 hipblasStatus_t hipblasLtMatrixTransformDescDestroy(hipblasLtMatrixTransformDesc_t transformDesc)
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixTransformDescDestroy");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixTransformDescDestroy");
     if(transformDesc)
         delete transformDesc;
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -540,17 +539,27 @@ hipblasStatus_t
                                              const void*                              buf,
                                              size_t                                   sizeInBytes)
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixTransformDescSetAttribute");
-    if(!buf || sizeInBytes != sizeof(int32_t))
+    rocblaslt::Debug::markerStart("hipblasLtMatrixTransformDescSetAttribute");
+    const size_t expectedSize = attr == HIPBLASLT_MATRIX_TRANSFORM_DESC_C_SCALE_POINTER
+                                    ? sizeof(void*)
+                                    : sizeof(int32_t);
+    if(!buf || sizeInBytes != expectedSize)
     {
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
     rocblaslt_matrix_transform_desc* desc
         = reinterpret_cast<rocblaslt_matrix_transform_desc*>(&transformDesc->data[0]);
-    // all possible values should be int32_t
-    assert(sizeInBytes == sizeof(int32_t));
+
+    if(attr == HIPBLASLT_MATRIX_TRANSFORM_DESC_C_SCALE_POINTER)
+    {
+        memcpy(&desc->scaleCPointer, buf, sizeInBytes);
+        rocblaslt::Debug::markerStop();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // all other values should be int32_t
     int32_t value{};
     memcpy(&value, buf, sizeInBytes);
 
@@ -576,13 +585,43 @@ hipblasStatus_t
         desc->opB = static_cast<hipblasOperation_t>(value);
         break;
     }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_SATURATE:
+    {
+        desc->saturate = value;
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_STOCHASTIC_ROUNDING:
+    {
+        desc->stochasticRounding = value;
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_ROUNDING_SEED:
+    {
+        desc->roundingSeed = static_cast<uint32_t>(value);
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_BATCH_POINTER_ARRAY:
+    {
+        desc->batchPointerArray = value;
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_STREAMING_CHUNK_SIZE:
+    {
+        if(value < 0)
+        {
+            rocblaslt::Debug::markerStop();
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        desc->streamingChunkSize = value;
+        break;
+    }
     default:
         assert(false && "Unknown attribute");
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
         break;
     }
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -593,27 +632,39 @@ hipblasStatus_t
                                              size_t                                   sizeInBytes,
                                              size_t*                                  sizeWritten)
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixTransformDescGetAttribute");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixTransformDescGetAttribute");
     if(!sizeInBytes && !sizeWritten)
     {
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
     if(sizeInBytes && !sizeWritten)
     {
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
-    if(sizeInBytes != sizeof(int32_t))
+    const size_t expectedSize = attr == HIPBLASLT_MATRIX_TRANSFORM_DESC_C_SCALE_POINTER
+                                    ? sizeof(void*)
+                                    : sizeof(int32_t);
+    if(sizeInBytes != expectedSize)
     {
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
     rocblaslt_matrix_transform_desc* desc
         = reinterpret_cast<rocblaslt_matrix_transform_desc*>(&transformDesc->data[0]);
+
+    if(attr == HIPBLASLT_MATRIX_TRANSFORM_DESC_C_SCALE_POINTER)
+    {
+        memcpy(buf, &desc->scaleCPointer, sizeInBytes);
+        *sizeWritten = sizeof(void*);
+        rocblaslt::Debug::markerStop();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
     int32_t value{};
 
     switch(attr)
@@ -638,8 +689,33 @@ hipblasStatus_t
         value = static_cast<int32_t>(desc->opB);
         break;
     }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_SATURATE:
+    {
+        value = desc->saturate;
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_STOCHASTIC_ROUNDING:
+    {
+        value = desc->stochasticRounding;
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_ROUNDING_SEED:
+    {
+        value = static_cast<int32_t>(desc->roundingSeed);
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_BATCH_POINTER_ARRAY:
+    {
+        value = desc->batchPointerArray;
+        break;
+    }
+    case HIPBLASLT_MATRIX_TRANSFORM_DESC_STREAMING_CHUNK_SIZE:
+    {
+        value = desc->streamingChunkSize;
+        break;
+    }
     default:
-        rocblaslt::Debug::Instance().markerStop();
+        rocblaslt::Debug::markerStop();
         return HIPBLAS_STATUS_INVALID_VALUE;
         assert(false && "Unknown attribute");
         break;
@@ -647,7 +723,7 @@ hipblasStatus_t
 
     memcpy(buf, &value, sizeInBytes);
     *sizeWritten = sizeof(int32_t);
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -663,7 +739,7 @@ hipblasStatus_t hipblasLtMatrixTransform(hipblasLtHandle_t              lightHan
                                          hipblasLtMatrixLayout_t Cdesc,
                                          hipStream_t             stream)
 {
-    rocblaslt::Debug::Instance().markerStart("hipblasLtMatrixTransform");
+    rocblaslt::Debug::markerStart("hipblasLtMatrixTransform");
     auto status = RocBlasLtStatusToHIPStatus(rocblaslt_matrix_transform(
         (rocblaslt_handle)lightHandle,
         reinterpret_cast<rocblaslt_matrix_transform_desc*>(&transformDesc->data[0]),
@@ -676,9 +752,103 @@ hipblasStatus_t hipblasLtMatrixTransform(hipblasLtHandle_t              lightHan
         C,
         (rocblaslt_matrix_layout)Cdesc,
         stream));
-    rocblaslt::Debug::Instance().markerStop();
+    rocblaslt::Debug::markerStop();
+    return status;
+}
+
+hipblasStatus_t hipblasLtMatrixTransformGrouped(hipblasLtHandle_t                    lightHandle,
+                                                hipblasLtMatrixTransformDesc_t       transformDesc,
+                                                const void*                          alpha,
+                                                const void*                          beta,
+                                                const hipblasLtMatrixTransformJob_t* jobs,
+                                                uint32_t                             numJobs,
+                                                hipStream_t                          stream)
+try
+{
+    if(!jobs && numJobs)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<rocblaslt_matrix_transform_job> rocJobs(numJobs);
+
+    for(uint32_t i = 0; i < numJobs; ++i)
+    {
+        rocJobs[i] = {jobs[i].A,
+                      (rocblaslt_matrix_layout)jobs[i].Adesc,
+                      jobs[i].B,
+                      (rocblaslt_matrix_layout)jobs[i].Bdesc,
+                      jobs[i].C,
+                      (rocblaslt_matrix_layout)jobs[i].Cdesc};
+    }
+
+    rocblaslt::Debug::markerStart("hipblasLtMatrixTransformGrouped");
+    auto status = RocBlasLtStatusToHIPStatus(rocblaslt_matrix_transform_grouped(
+        (rocblaslt_handle)lightHandle,
+        reinterpret_cast<rocblaslt_matrix_transform_desc*>(&transformDesc->data[0]),
+        alpha,
+        beta,
+        rocJobs.data(),
+        numJobs,
+        stream));
+    rocblaslt::Debug::markerStop();
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasLtGetStatistics(hipblasLtHandle_t handle, hipblasLtStatistics_t* stats)
+try
+{
+    if(stats == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    rocblaslt::Debug::markerStart("hipblasLtGetStatistics");
+    rocblaslt_statistics rocStats;
+    auto                 status = RocBlasLtStatusToHIPStatus(
+        rocblaslt_get_statistics((rocblaslt_handle)handle, &rocStats));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        stats->handleCacheHits      = rocStats.handleCacheHits;
+        stats->handleCacheMisses    = rocStats.handleCacheMisses;
+        stats->libraryCacheHits     = rocStats.libraryCacheHits;
+        stats->libraryCacheMisses   = rocStats.libraryCacheMisses;
+        stats->sharedCacheHits      = rocStats.sharedCacheHits;
+        stats->sharedCacheMisses    = rocStats.sharedCacheMisses;
+        stats->lazyLibraryLoads     = rocStats.lazyLibraryLoads;
+        stats->codeObjectsLoaded    = rocStats.codeObjectsLoaded;
+        stats->kernelsResolved      = rocStats.kernelsResolved;
+        stats->stagingReallocations = rocStats.stagingReallocations;
+        stats->workspaceShortfalls  = rocStats.workspaceShortfalls;
+    }
+    rocblaslt::Debug::markerStop();
     return status;
 }
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasLtMatmulAlgoGetName(hipblasLtHandle_t            handle,
+                                           const hipblasLtMatmulAlgo_t* algo,
+                                           const char**                 kernelName,
+                                           const char**                 solutionName)
+try
+{
+    return RocBlasLtStatusToHIPStatus(
+        rocblaslt_matmul_algo_get_name((rocblaslt_handle)handle,
+                                       reinterpret_cast<const rocblaslt_matmul_algo*>(algo),
+                                       kernelName,
+                                       solutionName));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
 
 // Other Utilities
 hipblasStatus_t hipblasLtGetVersion(hipblasLtHandle_t handle, int* version)
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <string>
 #ifdef HIPBLASLT_ENABLE_MARKER
@@ -48,41 +50,130 @@ namespace rocblaslt
     private:
     };
 
+    // Bits of instrumentationFlags(): the rocblaslt_layer_mode mask of the logger, whether
+    // markers are emitted, the call timing mode, and whether the environment has not been
+    // read yet
+    constexpr uint32_t INSTRUMENTATION_LAYER_MODE        = 0xffff;
+    constexpr uint32_t INSTRUMENTATION_MARKER            = 1u << 16;
+    constexpr uint32_t INSTRUMENTATION_CALL_TIMING_SHIFT = 17;
+    constexpr uint32_t INSTRUMENTATION_CALL_TIMING       = 3u << INSTRUMENTATION_CALL_TIMING_SHIFT;
+    constexpr uint32_t INSTRUMENTATION_UNSET             = 1u << 31;
+
+    extern std::atomic<uint32_t> instrumentationWord;
+
+    // Reads the logger and marker settings of the environment into instrumentationWord
+    uint32_t loadInstrumentationFlags();
+
+    /**
+     * The enabled logging, marker and call timing hooks, read from one word that is loaded
+     * once from the environment, so a disabled hook costs a load and a predictable branch.
+     * Builds with HIPBLASLT_DISABLE_INSTRUMENTATION return a constant 0 and the hooks
+     * compile to nothing.
+     */
+    __attribute__((always_inline)) inline uint32_t instrumentationFlags()
+    {
+#ifdef HIPBLASLT_DISABLE_INSTRUMENTATION
+        return 0;
+#else
+        uint32_t flags = instrumentationWord.load(std::memory_order_relaxed);
+        if(__builtin_expect(flags & INSTRUMENTATION_UNSET, 0))
+            flags = loadInstrumentationFlags();
+        return flags;
+#endif
+    }
+
     /**
  * @brief Common place for defining flags which enable debug behaviour.
  */
     class Debug : public LazySingleton<Debug>
     {
     public:
-        __attribute__((always_inline)) inline void markerStart(const char* name) const
+        __attribute__((always_inline)) static inline void markerStart(const char* name)
         {
 #ifdef HIPBLASLT_ENABLE_MARKER
-            if(m_printMarker)
+            if(instrumentationFlags() & INSTRUMENTATION_MARKER)
             {
                 roctxRangePush(name);
             }
 #endif
         }
 
-        __attribute__((always_inline)) inline void markerStop() const
+        __attribute__((always_inline)) static inline void markerStop()
         {
 #ifdef HIPBLASLT_ENABLE_MARKER
-            if(m_printMarker)
+            if(instrumentationFlags() & INSTRUMENTATION_MARKER)
             {
                 roctxRangePop();
             }
 #endif
         }
 
+        // Whether markerStart() emits ranges, to skip formatting the names otherwise
+        static bool markerEnabled()
+        {
+#ifdef HIPBLASLT_ENABLE_MARKER
+            return instrumentationFlags() & INSTRUMENTATION_MARKER;
+#else
+            return false;
+#endif
+        }
+
         bool preload() const;
 
+        // File listing the kernels to load at handle creation, empty to disable
+        std::string preloadManifest() const;
+
+        // File that the kernels of new executions are appended to, empty to disable
+        std::string preloadManifestRecord() const;
+
+        // File that the distinct problems, their solutions and call counts are written to at
+        // exit, empty to disable
+        std::string captureFile() const;
+
+        // Directory of the code objects of the shape specialized transform kernels, empty to
+        // run the precompiled kernels only
+        std::string jitCacheDir() const;
+
+        // Pick the split-k of untuned GSU capable solutions from the tile and CU counts
+        bool autoSplitK() const;
+
+        // Pick the workgroup mapping of untuned WGM capable solutions from the L2 size
+        bool autoWGM() const;
+
+        // Offer the skinny GEMM first in the heuristic of the decode shapes it serves
+        bool skinnyGemm() const;
+
+        // Fail the calls that would block the host on the stream instead of blocking
+        bool noHostSync() const;
+
+        // 0: off, 1: time the host phases of matmul calls, 2: also their kernels
+        int callTiming() const;
+
+        // File that the call timing histograms are written to at exit, empty to disable
+        std::string callTimingFile() const;
+
+        // Times of the first call of each problem to compare with the device peak, 0 for off
+        int profileEfficiency() const;
+
     private:
         friend LazySingleton<Debug>;
+        friend uint32_t loadInstrumentationFlags();
 
         int         m_value;
         int         m_value2;
         bool        m_printMarker       = false;
         bool        m_preloadAllKernels = false;
+        bool        m_autoSplitK        = false;
+        bool        m_autoWGM           = false;
+        bool        m_skinnyGemm        = true;
+        bool        m_noHostSync        = false;
+        int         m_callTiming        = 0;
+        int         m_profileEfficiency = 0;
+        std::string m_preloadManifest;
+        std::string m_preloadManifestRecord;
+        std::string m_captureFile;
+        std::string m_jitCacheDir;
+        std::string m_callTimingFile;
 
         Debug();
     };
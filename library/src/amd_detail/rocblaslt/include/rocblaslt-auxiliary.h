@@ -395,8 +395,69 @@ rocblaslt_status
                                      const int              requestedAlgoCount,
                                      std::vector<rocblaslt_matmul_heuristic_result>& results);
 
+rocblaslt_status
+    rocblaslt_algo_get_heuristic_cpp(rocblaslt_handle                    handle,
+                                     rocblaslt::RocGemmType              gemmType,
+                                     std::shared_ptr<void>               gemmData,
+                                     const rocblaslt::RocGemmPreference& pref,
+                                     const int                           requestedAlgoCount,
+                                     std::vector<rocblaslt_matmul_heuristic_result>& results);
+
+rocblaslt_status rocblaslt_algo_get_workspace_frontier_cpp(
+    rocblaslt_handle                                handle,
+    rocblaslt::RocGemmType                          gemmType,
+    std::shared_ptr<void>                           gemmData,
+    std::vector<rocblaslt_matmul_heuristic_result>& results);
+
+/*! \ingroup aux_module
+ *  \brief rocblaslt_matmul_algo_get_heuristic for many problems
+ *
+ *  \details
+ *  The results of problems[i] are at heuristicResultsArray[i * requestedAlgoCount]
+ * and their count is returnAlgoCount[i]. The problems are selected together, so the
+ * nodes of the library that problems of the same type share are visited once.
+ */
+rocblaslt_status rocblaslt_matmul_algo_get_heuristic_batched(
+    rocblaslt_handle                                handle,
+    const std::vector<rocblaslt::RocMatmulProblem>& problems,
+    rocblaslt_matmul_preference                     pref,
+    int                                             requestedAlgoCount,
+    rocblaslt_matmul_heuristic_result               heuristicResultsArray[],
+    int                                             returnAlgoCount[]);
+
 rocblaslt_status rocblaslt_copy_matmul(rocblaslt_matmul_desc src, rocblaslt_matmul_desc dst);
 
+rocblaslt_status rocblaslt_clear_matmul_cache(rocblaslt_handle handle);
+
+rocblaslt_status rocblaslt_set_workspace_pool(rocblaslt_handle handle, size_t maxBytes);
+
+rocblaslt_status rocblaslt_set_priority_stream(rocblaslt_handle handle, bool enable);
+
+rocblaslt_status rocblaslt_set_reproducible(rocblaslt_handle handle, bool enable);
+
+rocblaslt_status rocblaslt_get_solution_cache_stats(rocblaslt_handle                handle,
+                                                  rocblaslt_solution_cache_stats* stats);
+
+rocblaslt_status rocblaslt_get_call_timings(std::vector<rocblaslt::RocCallTiming>& timings);
+
+rocblaslt_status
+    rocblaslt_matmul_trace_selection(rocblaslt_handle                               handle,
+                                     rocblaslt_matmul_desc                          matmul_descr,
+                                     rocblaslt_matrix_layout                        matA,
+                                     rocblaslt_matrix_layout                        matB,
+                                     rocblaslt_matrix_layout                        matC,
+                                     rocblaslt_matrix_layout                        matD,
+                                     size_t                                         workspaceBytes,
+                                     int                                            algoCount,
+                                     std::vector<rocblaslt::RocSelectionCandidate>& candidates);
+
+rocblaslt_status rocblaslt_get_statistics(rocblaslt_handle handle, rocblaslt_statistics* stats);
+
+rocblaslt_status rocblaslt_matmul_algo_get_name(rocblaslt_handle             handle,
+                                               const rocblaslt_matmul_algo* algo,
+                                               const char**                 kernelName,
+                                               const char**                 solutionName);
+
 // for internal use during testing, fetch arch name
 std::string rocblaslt_internal_get_arch_name();
 
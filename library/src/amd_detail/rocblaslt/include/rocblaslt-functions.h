@@ -127,6 +127,14 @@ rocblaslt_status rocblaslt_matrix_transform(rocblaslt_handle                 han
                                             rocblaslt_matrix_layout Cdesc,
                                             hipStream_t             stream);
 
+rocblaslt_status rocblaslt_matrix_transform_grouped(rocblaslt_handle                 handle,
+                                                    rocblaslt_matrix_transform_desc* transformDesc,
+                                                    const void* alpha, /* host or device pointer */
+                                                    const void* beta, /* host or device pointer */
+                                                    const rocblaslt_matrix_transform_job* jobs,
+                                                    uint32_t                              numJobs,
+                                                    hipStream_t                           stream);
+
 int rocblaslt_matmul_is_tuned(rocblaslt_handle handle,
                               rocblaslt_matmul_desc matmulDesc,
                               rocblaslt_matrix_layout Adesc,
@@ -277,12 +285,44 @@ rocblaslt_status rocblaslt_run_cpp(rocblaslt_handle       handle,
                                    hipEvent_t             start,
                                    hipEvent_t             stop);
 
+rocblaslt_status rocblaslt_run_inputs_cpp(rocblaslt_handle                  handle,
+                                          rocblaslt::RocGemmType            gemmType,
+                                          std::shared_ptr<void>             gemmData,
+                                          const rocblaslt::RocGemmInputsV2& inputs,
+                                          hipStream_t                       stream);
+
+rocblaslt_status rocblaslt_run_batch_cpp(const std::vector<rocblaslt_handle>&       handles,
+                                         const std::vector<rocblaslt::RocGemmType>& gemmTypes,
+                                         const std::vector<void*>&                  gemmData,
+                                         hipStream_t                                stream);
+
+rocblaslt_status rocblaslt_graph_node_create_cpp(rocblaslt_handle       handle,
+                                                 rocblaslt::RocGemmType gemmType,
+                                                 std::shared_ptr<void>  gemmData,
+                                                 hipGraph_t             graph,
+                                                 const hipGraphNode_t*  dependencies,
+                                                 size_t                 numDependencies,
+                                                 hipGraphNode_t*        node);
+
+rocblaslt_status rocblaslt_graph_node_update_cpp(rocblaslt_handle                  handle,
+                                                 rocblaslt::RocGemmType            gemmType,
+                                                 std::shared_ptr<void>             gemmData,
+                                                 const rocblaslt::RocGemmInputsV2& inputs,
+                                                 hipGraphExec_t                    exec,
+                                                 hipGraphNode_t                    node);
+
 rocblaslt_status rocblaslt_run_user_args_cpp(rocblaslt_handle       handle,
                                              rocblaslt::RocGemmType gemmType,
                                              std::shared_ptr<void>  gemmData,
                                              void*                  deviceUserArgs,
                                              hipStream_t            stream);
 
+rocblaslt_status rocblaslt_run_host_user_args_cpp(rocblaslt_handle       handle,
+                                                  rocblaslt::RocGemmType gemmType,
+                                                  std::shared_ptr<void>  gemmData,
+                                                  const void*            hostDeviceUserArgs,
+                                                  hipStream_t            stream);
+
 rocblaslt_status rocblaslt_run_user_args_cpp(rocblaslt_handle             handle,
                                              rocblaslt::RocGemmType       gemmType,
                                              size_t                       gemmCount,
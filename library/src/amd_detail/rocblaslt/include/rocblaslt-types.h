@@ -42,6 +42,7 @@
 #include <memory>
 #include <stddef.h>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 #define ROCBLASLT_KERNEL __global__
@@ -167,7 +168,11 @@ typedef enum rocblaslt_epilogue_
     ROCBLASLT_EPILOGUE_DGELU         = 192,
     ROCBLASLT_EPILOGUE_DGELU_BGRAD   = 208,
     ROCBLASLT_EPILOGUE_BGRADA        = 256,
-    ROCBLASLT_EPILOGUE_BGRADB        = 512
+    ROCBLASLT_EPILOGUE_BGRADB        = 512,
+    ROCBLASLT_EPILOGUE_SWIGLU        = 1024,
+    ROCBLASLT_EPILOGUE_SWIGLU_BIAS   = 1028,
+    ROCBLASLT_EPILOGUE_GEGLU         = 2048,
+    ROCBLASLT_EPILOGUE_GEGLU_BIAS    = 2052
 } rocblaslt_epilogue;
 
 /*! \ingroup types_module
@@ -187,6 +192,34 @@ typedef enum rocblaslt_pointer_mode_
     = 4 /** alpha pointer targets a device memory vector of length equal to the number of rows of matrix D, and beta is a single value in host memory. */
 } rocblaslt_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates where the residual matrix is added.
+ */
+typedef enum rocblaslt_residual_position_
+{
+    rocblaslt_residual_after_activation  = 0, /**< added to the result of the epilogue. */
+    rocblaslt_residual_before_activation = 1, /**< added before the activation of the epilogue. */
+} rocblaslt_residual_position;
+
+/*! \ingroup types_module
+ *  \brief Indicates how a scale pointer scales its matrix.
+ */
+typedef enum rocblaslt_matrix_scale_
+{
+    rocblaslt_matrix_scale_scalar_32f  = 0, /**< a single float scale. */
+    rocblaslt_matrix_scale_vec32_ue8m0 = 1, /**< an E8M0 scale per 32 elements along k. */
+} rocblaslt_matrix_scale;
+
+/*! \ingroup types_module
+ *  \brief Indicates how the loads or stores of a matrix treat the caches.
+ */
+typedef enum rocblaslt_cache_policy_
+{
+    rocblaslt_cache_policy_default    = 0, /**< regular accesses. */
+    rocblaslt_cache_policy_streaming  = 1, /**< nontemporal accesses. */
+    rocblaslt_cache_policy_persisting = 2, /**< high temporal accesses. */
+} rocblaslt_cache_policy;
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
@@ -268,6 +301,8 @@ typedef enum rocblaslt_compute_type_
     rocblaslt_compute_f64_pedantic  = 8, /**< compute will be exactly 64-bit precision */
     rocblaslt_compute_i32           = 9, /**< 32-bit integer precision. */
     rocblaslt_compute_i32_pedantic  = 10, /**< compute will be exactly 32-bit integer precision */
+    rocblaslt_compute_f32_fast_3xbf16
+    = 15, /**< 32-bit input computed as three bf16 products of its hi and lo parts */
     rocblaslt_compute_f32_fast_f8_fnuz  = 100, /**< 32-bit input can use fp8 compute */
     rocblaslt_compute_f32_fast_bf8_fnuz = 101, /**< 32-bit input can use bf8 compute */
     rocblaslt_compute_f32_fast_f8bf8_fnuz
@@ -296,12 +331,16 @@ typedef enum rocblaslt_matrix_layout_attribute_
     ROCBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET
     = 1, /**< stride between consecutive matrices in a batch expressed in terms
             of matrix elements. */
-    ROCBLASLT_MATRIX_LAYOUT_TYPE  = 2,
-    ROCBLASLT_MATRIX_LAYOUT_ORDER = 3,
-    ROCBLASLT_MATRIX_LAYOUT_ROWS  = 4,
-    ROCBLASLT_MATRIX_LAYOUT_COLS  = 5,
-    ROCBLASLT_MATRIX_LAYOUT_LD    = 6,
-    ROCBLASLT_MATRIX_LAYOUT_MAX   = 7
+    ROCBLASLT_MATRIX_LAYOUT_TYPE       = 2,
+    ROCBLASLT_MATRIX_LAYOUT_ORDER      = 3,
+    ROCBLASLT_MATRIX_LAYOUT_ROWS       = 4,
+    ROCBLASLT_MATRIX_LAYOUT_COLS       = 5,
+    ROCBLASLT_MATRIX_LAYOUT_LD         = 6,
+    ROCBLASLT_MATRIX_LAYOUT_BATCH_MODE         = 7,
+    ROCBLASLT_MATRIX_LAYOUT_SPARSITY           = 8,
+    ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT  = 9,
+    ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE = 10,
+    ROCBLASLT_MATRIX_LAYOUT_MAX                = 11
 } rocblaslt_matrix_layout_attribute;
 
 typedef enum
@@ -344,10 +383,45 @@ typedef enum rocblaslt_matmul_desc_attributes_
     ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_BATCH_STRIDE  = 12,
     ROCBLASLT_MATMUL_DESC_POINTER_MODE               = 13,
     ROCBLASLT_MATMUL_DESC_AMAX_D_POINTER             = 14,
+    ROCBLASLT_MATMUL_DESC_RESIDUAL_POINTER           = 15,
+    ROCBLASLT_MATMUL_DESC_RESIDUAL_DATA_TYPE         = 16,
+    ROCBLASLT_MATMUL_DESC_RESIDUAL_LD                = 17,
+    ROCBLASLT_MATMUL_DESC_RESIDUAL_BATCH_STRIDE      = 18,
+    ROCBLASLT_MATMUL_DESC_RESIDUAL_POSITION          = 19,
+    ROCBLASLT_MATMUL_DESC_DROPOUT_PROBABILITY        = 20,
+    ROCBLASLT_MATMUL_DESC_DROPOUT_SEED_POINTER       = 21,
+    ROCBLASLT_MATMUL_DESC_DROPOUT_OFFSET_POINTER     = 22,
+    ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_POINTER       = 23,
+    ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH        = 24,
+    ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER = 25,
+    ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER = 26,
+    ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_MARGIN        = 27,
+    ROCBLASLT_MATMUL_DESC_A_SCALE_MODE               = 28,
+    ROCBLASLT_MATMUL_DESC_B_SCALE_MODE               = 29,
+    ROCBLASLT_MATMUL_DESC_B_QUANT_SCALE_POINTER      = 30,
+    ROCBLASLT_MATMUL_DESC_B_QUANT_ZERO_POINTER       = 31,
+    ROCBLASLT_MATMUL_DESC_B_QUANT_GROUP_SIZE         = 32,
+    ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE     = 33,
+    ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER  = 34,
+    ROCBLASLT_MATMUL_DESC_D2_POINTER                 = 35,
+    ROCBLASLT_MATMUL_DESC_D2_DATA_TYPE               = 36,
+    ROCBLASLT_MATMUL_DESC_D2_LD                      = 37,
+    ROCBLASLT_MATMUL_DESC_D2_BATCH_STRIDE            = 38,
+    ROCBLASLT_MATMUL_DESC_D2_SCALE_POINTER           = 39,
+    ROCBLASLT_MATMUL_DESC_BGRAD_DETERMINISTIC        = 40,
+    ROCBLASLT_MATMUL_DESC_DETERMINISTIC_REDUCTION    = 41,
+    ROCBLASLT_MATMUL_DESC_CU_BUDGET                  = 42,
+    ROCBLASLT_MATMUL_DESC_COMPLETION_FLAGS_POINTER   = 43,
+    ROCBLASLT_MATMUL_DESC_COMPLETION_CHUNK_COLS      = 44,
+    ROCBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER  = 45,
+    ROCBLASLT_MATMUL_DESC_D_CACHE_POLICY             = 46,
+    ROCBLASLT_MATMUL_DESC_B_CACHE_POLICY             = 47,
     ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_A_EXT   = 100,
     ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_B_EXT,
     ROCBLASLT_MATMUL_DESC_A_SCALE_POINTER_VEC_EXT,
     ROCBLASLT_MATMUL_DESC_B_SCALE_POINTER_VEC_EXT,
+    ROCBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT,
+    ROCBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT,
     ROCBLASLT_MATMUL_DESC_MAX,
 } rocblaslt_matmul_desc_attributes;
 
@@ -384,10 +458,11 @@ typedef struct __attribute__((packed, aligned(8))) _rocblaslt_matmul_algo
 typedef struct _rocblaslt_matmul_heuristic_result
 {
     rocblaslt_matmul_algo algo;
-    size_t                workspaceSize = 0;
-    rocblaslt_status      state         = rocblaslt_status_success;
-    float                 wavesCount    = 1.0;
-    int                   reserved[4];
+    size_t                workspaceSize    = 0;
+    rocblaslt_status      state            = rocblaslt_status_success;
+    float                 wavesCount       = 1.0;
+    float                 predictedSpeedup = 0.0;
+    int                   reserved[3];
 } rocblaslt_matmul_heuristic_result;
 
 typedef struct _rocblaslt_solutions
@@ -396,13 +471,62 @@ typedef struct _rocblaslt_solutions
     int                                algoCount;
 } rocblaslt_solutions;
 
+/********************************************************************************
+ * \brief rocblaslt_solution_cache_stats holds the counters of the solution
+ * caches of the Tensile library.
+ *******************************************************************************/
+typedef struct _rocblaslt_solution_cache_stats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t size;
+    uint64_t capacity;
+} rocblaslt_solution_cache_stats;
+
+/********************************************************************************
+ * \brief rocblaslt_statistics holds the runtime counters of a handle, of the
+ * Tensile library of its device and of the process.
+ *******************************************************************************/
+typedef struct _rocblaslt_statistics
+{
+    uint64_t handleCacheHits;
+    uint64_t handleCacheMisses;
+    uint64_t libraryCacheHits;
+    uint64_t libraryCacheMisses;
+    uint64_t sharedCacheHits;
+    uint64_t sharedCacheMisses;
+    uint64_t lazyLibraryLoads;
+    uint64_t codeObjectsLoaded;
+    uint64_t kernelsResolved;
+    uint64_t stagingReallocations;
+    uint64_t workspaceShortfalls;
+} rocblaslt_statistics;
+
 typedef struct _rocblaslt_matrix_transform_desc
 {
     hipDataType            scaleType;
     hipblasLtPointerMode_t pointerMode{HIPBLASLT_POINTER_MODE_HOST};
     hipblasOperation_t     opA{HIPBLAS_OP_N};
     hipblasOperation_t     opB{HIPBLAS_OP_N};
+    const void*            scaleCPointer{nullptr};
+    int32_t                saturate{1};
+    int32_t                stochasticRounding{0};
+    uint32_t               roundingSeed{0};
+    int32_t                batchPointerArray{0};
+    int32_t                streamingChunkSize{0};
 } rocblaslt_matrix_transform_desc;
+
+/*! \brief One matrix transform of rocblaslt_matrix_transform_grouped */
+typedef struct _rocblaslt_matrix_transform_job
+{
+    const void*             A;
+    rocblaslt_matrix_layout Adesc;
+    const void*             B;
+    rocblaslt_matrix_layout Bdesc;
+    void*                   C;
+    rocblaslt_matrix_layout Cdesc;
+} rocblaslt_matrix_transform_job;
 #ifdef __cplusplus
 }
 #endif
@@ -461,15 +585,72 @@ namespace rocblaslt
 
     struct RocTuning
     {
-        uint8_t gsu = 0;
-        uint8_t wgm = 0;
+        uint8_t gsu            = 0;
+        uint8_t wgm            = 0;
+        uint8_t streamK        = 0;
+        float   skGridFraction = 0.0f;
     };
 
     class RocTuningV2
     {
     public:
-        uint16_t gsu = 0;
-        int16_t  wgm = 0;
+        uint16_t gsu            = 0;
+        int16_t  wgm            = 0;
+        uint8_t  streamK        = 0;
+        float    skGridFraction = 0.0f;
+    };
+
+    struct RocGemmPreference
+    {
+        size_t workspaceBytes         = 0;
+        bool   preferNoWorkspace      = false;
+        float  maxCUOccupancy         = 1.0f;
+        bool   deterministicReduction = false;
+        bool   preferPersistent       = false;
+        bool   preferNonPersistent    = false;
+        // Rank the solutions whose loads of B and stores of D have these temporal hints first
+        rocblaslt_cache_policy cachePolicyB = rocblaslt_cache_policy_default;
+        rocblaslt_cache_policy cachePolicyD = rocblaslt_cache_policy_default;
+        // Slowdown over the fastest measured override entry that the least energy entry may
+        // have, 0 picks the fastest
+        float energyLatencyBound = 0.0f;
+    };
+
+    // Histograms of the phase durations of the calls with one problem signature.
+    // Bucket i counts the durations in [2^i, 2^(i+1)) nanoseconds.
+    struct RocCallTiming
+    {
+        static constexpr int phaseCount  = 6;
+        static constexpr int bucketCount = 32;
+
+        std::string signature;
+        uint64_t    count[phaseCount]                = {};
+        uint64_t    totalNs[phaseCount]              = {};
+        uint64_t    buckets[phaseCount][bucketCount] = {};
+    };
+
+    // The descriptors of one problem of rocblaslt_matmul_algo_get_heuristic_batched.
+    struct RocMatmulProblem
+    {
+        rocblaslt_matmul_desc   matmulDesc = nullptr;
+        rocblaslt_matrix_layout matA       = nullptr;
+        rocblaslt_matrix_layout matB       = nullptr;
+        rocblaslt_matrix_layout matC       = nullptr;
+        rocblaslt_matrix_layout matD       = nullptr;
+    };
+
+    // A solution the heuristic evaluated for a problem, see rocblaslt_matmul_trace_selection.
+    // score is the distance of the logic table entry to the problem, NaN when there is none.
+    struct RocSelectionCandidate
+    {
+        int         solutionIndex = -1;
+        std::string solutionName;
+        bool        accepted = false;
+        int         rank     = -1;
+        std::string failedPredicate;
+        size_t      requiredWorkspace = 0;
+        size_t      providedWorkspace = 0;
+        double      score             = 0.0;
     };
 
     struct RocGemmInputs
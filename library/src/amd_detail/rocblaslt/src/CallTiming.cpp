@@ -0,0 +1,334 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "CallTiming.hpp"
+
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace CallTiming
+{
+    namespace
+    {
+        constexpr int    bucketCount = rocblaslt::RocCallTiming::bucketCount;
+        constexpr size_t maxPending  = 1024;
+
+        // Written by the owning thread only, read by collect()
+        struct Slot
+        {
+            std::atomic<uint64_t> count[PhaseCount]                = {};
+            std::atomic<uint64_t> totalNs[PhaseCount]              = {};
+            std::atomic<uint64_t> buckets[PhaseCount][bucketCount] = {};
+
+            void add(Phase phase, uint64_t ns)
+            {
+                int bucket = 0;
+                while(bucket + 1 < bucketCount && (ns >> (bucket + 1)))
+                    bucket++;
+                count[phase].fetch_add(1, std::memory_order_relaxed);
+                totalNs[phase].fetch_add(ns, std::memory_order_relaxed);
+                buckets[phase][bucket].fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        struct PendingKernels
+        {
+            Slot*      slot;
+            hipEvent_t start;
+            hipEvent_t stop;
+        };
+
+        struct ThreadTimings
+        {
+            // Guards adding slots, which collect() iterates, and the events
+            std::mutex                                   mutex;
+            std::map<std::string, std::unique_ptr<Slot>> slots;
+            std::deque<PendingKernels>                   pending;
+            std::vector<hipEvent_t>                      freeEvents;
+
+            // The open call, only used by the owning thread
+            Slot*    call = nullptr;
+            uint64_t phaseNs[PhaseCount];
+            bool     phaseSeen[PhaseCount];
+
+            // Adds the kernels that completed, in the order they were queued
+            void harvest()
+            {
+                while(!pending.empty() && hipEventQuery(pending.front().stop) == hipSuccess)
+                {
+                    auto  kernels = pending.front();
+                    float ms      = 0.0f;
+                    if(hipEventElapsedTime(&ms, kernels.start, kernels.stop) == hipSuccess)
+                        kernels.slot->add(Device, static_cast<uint64_t>(ms * 1.0e6));
+                    freeEvents.push_back(kernels.start);
+                    freeEvents.push_back(kernels.stop);
+                    pending.pop_front();
+                }
+            }
+        };
+
+        std::vector<std::shared_ptr<ThreadTimings>>& registry(std::mutex*& mutex);
+
+        // The histograms stay in the registry after the thread exits, the events go
+        struct ThreadHolder
+        {
+            std::shared_ptr<ThreadTimings> timings;
+
+            ThreadHolder()
+                : timings(std::make_shared<ThreadTimings>())
+            {
+                std::mutex* mutex;
+                auto&       threads = registry(mutex);
+                std::lock_guard<std::mutex> lock(*mutex);
+                threads.push_back(timings);
+            }
+            ~ThreadHolder()
+            {
+                std::lock_guard<std::mutex> lock(timings->mutex);
+                for(auto& kernels : timings->pending)
+                {
+                    static_cast<void>(hipEventDestroy(kernels.start));
+                    static_cast<void>(hipEventDestroy(kernels.stop));
+                }
+                for(auto event : timings->freeEvents)
+                    static_cast<void>(hipEventDestroy(event));
+                timings->pending.clear();
+                timings->freeEvents.clear();
+            }
+        };
+
+        ThreadTimings& threadTimings()
+        {
+            thread_local ThreadHolder holder;
+            return *holder.timings;
+        }
+
+        uint64_t elapsedNs(Clock::time_point start)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+                .count();
+        }
+
+        void add(rocblaslt::RocCallTiming& sum, const Slot& slot)
+        {
+            for(int phase = 0; phase < PhaseCount; phase++)
+            {
+                sum.count[phase] += slot.count[phase].load(std::memory_order_relaxed);
+                sum.totalNs[phase] += slot.totalNs[phase].load(std::memory_order_relaxed);
+                for(int bucket = 0; bucket < bucketCount; bucket++)
+                    sum.buckets[phase][bucket]
+                        += slot.buckets[phase][bucket].load(std::memory_order_relaxed);
+            }
+        }
+
+        std::vector<rocblaslt::RocCallTiming> collect(bool harvest)
+        {
+            std::map<std::string, rocblaslt::RocCallTiming> sums;
+
+            std::mutex* mutex;
+            auto&       threads = registry(mutex);
+            std::lock_guard<std::mutex> lock(*mutex);
+            for(auto& thread : threads)
+            {
+                std::lock_guard<std::mutex> threadLock(thread->mutex);
+                if(harvest)
+                    thread->harvest();
+                for(auto& [signature, slot] : thread->slots)
+                {
+                    auto& sum     = sums[signature];
+                    sum.signature = signature;
+                    add(sum, *slot);
+                }
+            }
+
+            std::vector<rocblaslt::RocCallTiming> timings;
+            for(auto& [signature, sum] : sums)
+                timings.push_back(sum);
+            return timings;
+        }
+
+        // Upper bound of the bucket holding the given fraction of the durations
+        double percentileUs(const rocblaslt::RocCallTiming& timing, int phase, double fraction)
+        {
+            uint64_t rank = static_cast<uint64_t>(timing.count[phase] * fraction);
+            uint64_t seen = 0;
+            for(int bucket = 0; bucket < bucketCount; bucket++)
+            {
+                seen += timing.buckets[phase][bucket];
+                if(seen > rank)
+                    return static_cast<double>(uint64_t(2) << bucket) * 1.0e-3;
+            }
+            return 0.0;
+        }
+
+        // Writes HIPBLASLT_CALL_TIMING_FILE when the library is unloaded. The kernels
+        // still in flight are left out, the HIP runtime may be gone by then.
+        struct ExitDump
+        {
+            ~ExitDump()
+            {
+                auto path = rocblaslt::Debug::Instance().callTimingFile();
+                if(path.empty() || !mode())
+                    return;
+                std::ofstream out(path);
+                if(!out)
+                    return;
+
+                static const char* phaseNames[PhaseCount]
+                    = {"total", "validation", "heuristic", "solve", "launch", "device"};
+                out << "signature,phase,count,mean_us,p50_us,p99_us\n";
+                for(auto& timing : collect(false))
+                {
+                    for(int phase = 0; phase < PhaseCount; phase++)
+                    {
+                        if(!timing.count[phase])
+                            continue;
+                        out << '"' << timing.signature << "\"," << phaseNames[phase] << ','
+                            << timing.count[phase] << ','
+                            << timing.totalNs[phase] * 1.0e-3 / timing.count[phase] << ','
+                            << percentileUs(timing, phase, 0.5) << ','
+                            << percentileUs(timing, phase, 0.99) << '\n';
+                    }
+                }
+            }
+        };
+
+        std::vector<std::shared_ptr<ThreadTimings>>& registry(std::mutex*& mutex)
+        {
+            static std::mutex                                  registryMutex;
+            static std::vector<std::shared_ptr<ThreadTimings>> threads;
+            // Constructed after the registry, so it is destroyed before it
+            static ExitDump exitDump;
+            mutex = &registryMutex;
+            return threads;
+        }
+    }
+
+    void Call::begin(const std::string& signature)
+    {
+        auto& timings = threadTimings();
+        if(timings.call)
+            return;
+
+        auto it = timings.slots.find(signature);
+        if(it == timings.slots.end())
+        {
+            std::lock_guard<std::mutex> lock(timings.mutex);
+            it = timings.slots.emplace(signature, std::make_unique<Slot>()).first;
+        }
+        if(mode() >= 2)
+        {
+            std::lock_guard<std::mutex> lock(timings.mutex);
+            timings.harvest();
+        }
+
+        timings.call = it->second.get();
+        for(int phase = 0; phase < PhaseCount; phase++)
+        {
+            timings.phaseNs[phase]   = 0;
+            timings.phaseSeen[phase] = false;
+        }
+        m_open  = true;
+        m_start = Clock::now();
+    }
+
+    void Call::end()
+    {
+        auto& timings = threadTimings();
+        timings.call->add(Total, elapsedNs(m_start));
+        for(int phase = Validation; phase < Device; phase++)
+        {
+            if(timings.phaseSeen[phase])
+                timings.call->add(Phase(phase), timings.phaseNs[phase]);
+        }
+        timings.call = nullptr;
+    }
+
+    void Scope::begin()
+    {
+        if(!threadTimings().call)
+            return;
+        m_active = true;
+        m_start  = Clock::now();
+    }
+
+    void Scope::end()
+    {
+        auto& timings = threadTimings();
+        timings.phaseNs[m_phase] += elapsedNs(m_start);
+        timings.phaseSeen[m_phase] = true;
+        m_active                   = false;
+    }
+
+    void DeviceScope::begin()
+    {
+        auto& timings = threadTimings();
+        if(!timings.call)
+            return;
+
+        std::lock_guard<std::mutex> lock(timings.mutex);
+        if(timings.pending.size() >= maxPending)
+            return;
+        while(timings.freeEvents.size() < 2)
+        {
+            hipEvent_t event;
+            if(hipEventCreate(&event) != hipSuccess)
+                return;
+            timings.freeEvents.push_back(event);
+        }
+        hipEvent_t start = timings.freeEvents.back();
+        if(hipEventRecord(start, m_stream) != hipSuccess)
+            return;
+        timings.freeEvents.pop_back();
+        m_stop = timings.freeEvents.back();
+        timings.freeEvents.pop_back();
+        m_start = start;
+    }
+
+    void DeviceScope::end()
+    {
+        auto&                       timings = threadTimings();
+        std::lock_guard<std::mutex> lock(timings.mutex);
+        if(hipEventRecord(m_stop, m_stream) == hipSuccess)
+            timings.pending.push_back({timings.call, m_start, m_stop});
+        else
+        {
+            timings.freeEvents.push_back(m_start);
+            timings.freeEvents.push_back(m_stop);
+        }
+        m_start = nullptr;
+        m_stop  = nullptr;
+    }
+
+    std::vector<rocblaslt::RocCallTiming> collect()
+    {
+        return collect(mode() >= 2);
+    }
+} // namespace CallTiming
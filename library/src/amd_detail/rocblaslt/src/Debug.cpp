@@ -43,6 +43,61 @@ namespace rocblaslt
         return m_preloadAllKernels;
     }
 
+    std::string Debug::preloadManifest() const
+    {
+        return m_preloadManifest;
+    }
+
+    std::string Debug::preloadManifestRecord() const
+    {
+        return m_preloadManifestRecord;
+    }
+
+    std::string Debug::captureFile() const
+    {
+        return m_captureFile;
+    }
+
+    std::string Debug::jitCacheDir() const
+    {
+        return m_jitCacheDir;
+    }
+
+    bool Debug::autoSplitK() const
+    {
+        return m_autoSplitK;
+    }
+
+    bool Debug::autoWGM() const
+    {
+        return m_autoWGM;
+    }
+
+    bool Debug::skinnyGemm() const
+    {
+        return m_skinnyGemm;
+    }
+
+    bool Debug::noHostSync() const
+    {
+        return m_noHostSync;
+    }
+
+    int Debug::callTiming() const
+    {
+        return m_callTiming;
+    }
+
+    std::string Debug::callTimingFile() const
+    {
+        return m_callTimingFile;
+    }
+
+    int Debug::profileEfficiency() const
+    {
+        return m_profileEfficiency;
+    }
+
     Debug::Debug()
         : m_value(DEBUG_SM)
         , m_value2(DEBUG_SM2)
@@ -59,6 +114,46 @@ namespace rocblaslt
 
         const char *hipblaslt_preload = std::getenv("HIPBLASLT_PRELOAD_KERNELS");
         m_preloadAllKernels = hipblaslt_preload && strtol(hipblaslt_preload, nullptr, 0) != 0;
+
+        const char *hipblaslt_preload_manifest = std::getenv("HIPBLASLT_PRELOAD_MANIFEST");
+        if(hipblaslt_preload_manifest)
+            m_preloadManifest = hipblaslt_preload_manifest;
+
+        const char *hipblaslt_preload_record = std::getenv("HIPBLASLT_PRELOAD_MANIFEST_RECORD");
+        if(hipblaslt_preload_record)
+            m_preloadManifestRecord = hipblaslt_preload_record;
+
+        const char *hipblaslt_capture = std::getenv("HIPBLASLT_CAPTURE_FILE");
+        if(hipblaslt_capture)
+            m_captureFile = hipblaslt_capture;
+
+        const char *hipblaslt_jit_cache_dir = std::getenv("HIPBLASLT_JIT_CACHE_DIR");
+        if(hipblaslt_jit_cache_dir)
+            m_jitCacheDir = hipblaslt_jit_cache_dir;
+
+        const char *hipblaslt_auto_splitk = std::getenv("HIPBLASLT_AUTO_SPLITK");
+        m_autoSplitK = hipblaslt_auto_splitk && strtol(hipblaslt_auto_splitk, nullptr, 0) != 0;
+
+        const char *hipblaslt_auto_wgm = std::getenv("HIPBLASLT_AUTO_WGM");
+        m_autoWGM = hipblaslt_auto_wgm && strtol(hipblaslt_auto_wgm, nullptr, 0) != 0;
+
+        const char *hipblaslt_skinny_gemm = std::getenv("HIPBLASLT_SKINNY_GEMM");
+        m_skinnyGemm = !hipblaslt_skinny_gemm || strtol(hipblaslt_skinny_gemm, nullptr, 0) != 0;
+
+        const char *hipblaslt_no_host_sync = std::getenv("HIPBLASLT_NO_HOST_SYNC");
+        m_noHostSync = hipblaslt_no_host_sync && strtol(hipblaslt_no_host_sync, nullptr, 0) != 0;
+
+        const char *hipblaslt_call_timing = std::getenv("HIPBLASLT_CALL_TIMING");
+        if(hipblaslt_call_timing)
+            m_callTiming = strtol(hipblaslt_call_timing, nullptr, 0);
+
+        const char *hipblaslt_call_timing_file = std::getenv("HIPBLASLT_CALL_TIMING_FILE");
+        if(hipblaslt_call_timing_file)
+            m_callTimingFile = hipblaslt_call_timing_file;
+
+        const char *hipblaslt_profile_efficiency = std::getenv("HIPBLASLT_PROFILE_EFFICIENCY");
+        if(hipblaslt_profile_efficiency)
+            m_profileEfficiency = strtol(hipblaslt_profile_efficiency, nullptr, 0);
     }
 
 } // namespace rocblaslt
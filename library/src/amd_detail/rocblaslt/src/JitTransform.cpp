@@ -0,0 +1,375 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "JitTransform.hpp"
+#include "Debug.hpp"
+#include "rocblaslt-auxiliary.h"
+
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace JitTransform
+{
+    namespace
+    {
+        constexpr char kernelName[] = "hipblasltJitTransform";
+
+        // The sizes, strides and types are -D options. A workgroup writes a TILE x TILE tile of
+        // C, the threads of a row of the workgroup walk the contiguous dimension of C.
+        constexpr char kernelSource[] = R"(
+#define TILE 64
+#define THREADS 256
+#define INNER (C_ROW_MAJOR ? N : M)
+#define OUTER (C_ROW_MAJOR ? M : N)
+
+typedef SCALE_TYPE Scale;
+#if DATA_BF16
+typedef unsigned short Data;
+__device__ inline Scale load(Data x)
+{
+    return __uint_as_float(unsigned(x) << 16);
+}
+__device__ inline Data store(Scale x)
+{
+    unsigned u = __float_as_uint(x);
+    if((u & 0x7fffffffu) > 0x7f800000u)
+        return Data((u >> 16) | 0x40u);
+    return Data((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+}
+#else
+typedef DATA_TYPE Data;
+__device__ inline Scale load(Data x)
+{
+    return static_cast<Scale>(x);
+}
+__device__ inline Data store(Scale x)
+{
+    return static_cast<Data>(x);
+}
+#endif
+
+extern "C" __global__ __launch_bounds__(THREADS) void hipblasltJitTransform(Data*        c,
+                                                                            const Data*  a,
+                                                                            const Data*  b,
+                                                                            Scale        alpha,
+                                                                            const Scale* alphaPtr,
+                                                                            Scale        beta,
+                                                                            const Scale* betaPtr)
+{
+    constexpr unsigned tilesInner  = unsigned((INNER + TILE - 1) / TILE);
+    constexpr unsigned rowsPerPass = THREADS / TILE;
+
+    const unsigned long long inner  = blockIdx.x % tilesInner * TILE + threadIdx.x % TILE;
+    const unsigned long long outer0 = blockIdx.x / tilesInner * TILE + threadIdx.x / TILE;
+    const unsigned long long batch  = blockIdx.z * BATCH_STRIDE;
+
+    if(alphaPtr)
+        alpha = *alphaPtr;
+    if(betaPtr)
+        beta = *betaPtr;
+    if(INNER % TILE != 0 && inner >= INNER)
+        return;
+
+#pragma unroll
+    for(unsigned pass = 0; pass < TILE / rowsPerPass; pass++)
+    {
+        const unsigned long long outer = outer0 + pass * rowsPerPass;
+        if(OUTER % TILE != 0 && outer >= OUTER)
+            break;
+
+        const unsigned long long row     = C_ROW_MAJOR ? outer : inner;
+        const unsigned long long col     = C_ROW_MAJOR ? inner : outer;
+        const unsigned long long offsetA = batch + row * A_ROW_STRIDE + col * A_COL_STRIDE;
+        const unsigned long long offsetB = batch + row * B_ROW_STRIDE + col * B_COL_STRIDE;
+        const Scale              aData   = HAS_A ? load(a[offsetA]) : Scale(0);
+        const Scale              bData   = HAS_B ? load(b[offsetB]) : Scale(0);
+        c[batch + row * C_ROW_STRIDE + col * C_COL_STRIDE] = store(aData * alpha + bData * beta);
+    }
+}
+)";
+
+        constexpr uint64_t TILE    = 64;
+        constexpr uint32_t THREADS = 256;
+
+        // Type name in the kernel source and in the cache file names
+        bool typeNames(hipDataType type, std::string& source, std::string& name)
+        {
+            switch(type)
+            {
+            case HIP_R_32F:
+                source = "float";
+                name   = "f32";
+                return true;
+            case HIP_R_16F:
+                source = "_Float16";
+                name   = "f16";
+                return true;
+            case HIP_R_16BF:
+                source = "unsigned short";
+                name   = "bf16";
+                return true;
+            case HIP_R_8I:
+                source = "signed char";
+                name   = "i8";
+                return true;
+            case HIP_R_32I:
+                source = "int";
+                name   = "i32";
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        std::string operandName(bool has, int64_t ld, bool rowMaj)
+        {
+            return has ? std::to_string(ld) + (rowMaj ? "r" : "c") : "none";
+        }
+
+        // Creates the missing directories of path
+        void makeDirectories(const std::string& path)
+        {
+            for(size_t pos = path.find('/', 1); ; pos = path.find('/', pos + 1))
+            {
+                const auto dir = path.substr(0, pos);
+                if(mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST)
+                    return;
+                if(pos == std::string::npos)
+                    return;
+            }
+        }
+
+        bool readFile(const std::string& path, std::vector<char>& data)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if(!file)
+                return false;
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return !data.empty();
+        }
+
+        // Written aside and renamed so that concurrent processes never read a partial file
+        void writeFile(const std::string& path, const std::vector<char>& data)
+        {
+            const auto    tmpPath = path + "." + std::to_string(getpid());
+            std::ofstream file(tmpPath, std::ios::binary);
+            if(!file.write(data.data(), data.size()))
+                return;
+            file.close();
+            if(std::rename(tmpPath.c_str(), path.c_str()) != 0)
+                std::remove(tmpPath.c_str());
+        }
+
+        bool compile(const std::string&              name,
+                     const std::string&              arch,
+                     const std::vector<std::string>& defines,
+                     std::vector<char>&              code)
+        {
+            hiprtcProgram program;
+            if(hiprtcCreateProgram(&program, kernelSource, name.c_str(), 0, nullptr, nullptr)
+               != HIPRTC_SUCCESS)
+                return false;
+
+            std::vector<std::string> options = {"-O3", "--offload-arch=" + arch};
+            options.insert(options.end(), defines.begin(), defines.end());
+            std::vector<const char*> optionPtrs;
+            for(auto const& option : options)
+                optionPtrs.push_back(option.c_str());
+
+            bool   compiled = hiprtcCompileProgram(program, int(optionPtrs.size()), optionPtrs.data())
+                            == HIPRTC_SUCCESS;
+            size_t size     = 0;
+            if(compiled && hiprtcGetCodeSize(program, &size) == HIPRTC_SUCCESS && size)
+            {
+                code.resize(size);
+                compiled = hiprtcGetCode(program, code.data()) == HIPRTC_SUCCESS;
+            }
+            else
+            {
+                size_t logSize = 0;
+                hiprtcGetProgramLogSize(program, &logSize);
+                std::string log(logSize, '\0');
+                if(logSize)
+                    hiprtcGetProgramLog(program, &log[0]);
+                rocblaslt_log_error("JitTransform", name.c_str(), log.c_str());
+                compiled = false;
+            }
+            hiprtcDestroyProgram(&program);
+            return compiled;
+        }
+
+        // Loads the kernel of name from the cache directory, compiling it on a miss. Functions
+        // stay loaded for the life of the process, failures are remembered as nullptr.
+        hipFunction_t loadKernel(const std::string& name, const std::vector<std::string>& defines)
+        {
+            static std::mutex                                            mutex;
+            static std::map<std::pair<int, std::string>, hipFunction_t> functions;
+
+            int device = 0;
+            if(hipGetDevice(&device) != hipSuccess)
+                return nullptr;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto [it, inserted] = functions.emplace(std::make_pair(device, name), nullptr);
+            if(!inserted)
+                return it->second;
+
+            hipDeviceProp_t prop;
+            if(hipGetDeviceProperties(&prop, device) != hipSuccess)
+                return nullptr;
+            const std::string arch    = prop.gcnArchName;
+            std::string       archDir = arch;
+            std::replace(archDir.begin(), archDir.end(), ':', '_');
+
+            const auto dir  = rocblaslt::Debug::Instance().jitCacheDir() + "/" + archDir;
+            const auto path = dir + "/" + name + ".hsaco";
+
+            std::vector<char> code;
+            if(!readFile(path, code))
+            {
+                if(!compile(name, arch, defines, code))
+                    return nullptr;
+                makeDirectories(dir);
+                writeFile(path, code);
+            }
+
+            hipModule_t   module;
+            hipFunction_t function;
+            if(hipModuleLoadData(&module, code.data()) != hipSuccess)
+                return nullptr;
+            if(hipModuleGetFunction(&function, module, kernelName) != hipSuccess)
+            {
+                (void)hipModuleUnload(module);
+                return nullptr;
+            }
+            return it->second = function;
+        }
+    } // namespace
+
+    bool enabled()
+    {
+        return !rocblaslt::Debug::Instance().jitCacheDir().empty();
+    }
+
+    hipError_t launch(const Signature& signature,
+                      void*            c,
+                      const void*      a,
+                      const void*      b,
+                      const void*      alpha,
+                      const void*      beta,
+                      bool             scalarInDevice,
+                      uint32_t         batchCount,
+                      hipStream_t      stream)
+    {
+        std::string dataType, dataName, scaleType, scaleName;
+        if(!typeNames(signature.dataType, dataType, dataName)
+           || !typeNames(signature.scaleType, scaleType, scaleName)
+           || !(signature.scaleType == HIP_R_32F
+                || (signature.scaleType == HIP_R_16F && signature.dataType == HIP_R_16F)))
+            return hipErrorNotSupported;
+
+        const uint64_t inner = signature.rowMajC ? signature.n : signature.m;
+        const uint64_t outer = signature.rowMajC ? signature.m : signature.n;
+        const uint64_t tiles = ((inner + TILE - 1) / TILE) * ((outer + TILE - 1) / TILE);
+        if(tiles == 0 || tiles > INT32_MAX || batchCount == 0)
+            return hipErrorNotSupported;
+
+        auto strides = [](const char* operand, int64_t ld, bool rowMaj) {
+            const std::string name = operand;
+            return std::vector<std::string>{
+                "-D" + name + "_ROW_STRIDE=" + std::to_string(rowMaj ? ld : 1) + "ull",
+                "-D" + name + "_COL_STRIDE=" + std::to_string(rowMaj ? 1 : ld) + "ull"};
+        };
+        std::vector<std::string> defines
+            = {"-DDATA_TYPE=" + dataType,
+               "-DDATA_BF16=" + std::to_string(signature.dataType == HIP_R_16BF),
+               "-DSCALE_TYPE=" + scaleType,
+               "-DM=" + std::to_string(signature.m) + "ull",
+               "-DN=" + std::to_string(signature.n) + "ull",
+               "-DHAS_A=" + std::to_string(signature.hasA),
+               "-DHAS_B=" + std::to_string(signature.hasB),
+               "-DC_ROW_MAJOR=" + std::to_string(signature.rowMajC),
+               "-DBATCH_STRIDE=" + std::to_string(signature.batchStride) + "ull"};
+        for(auto const& operand : {strides("A", signature.ldA, signature.rowMajA),
+                                   strides("B", signature.ldB, signature.rowMajB),
+                                   strides("C", signature.ldC, signature.rowMajC)})
+            defines.insert(defines.end(), operand.begin(), operand.end());
+
+        // The hash of the source retires the code objects of older kernels
+        static const auto sourceHash = std::hash<std::string>{}(kernelSource);
+        std::ostringstream name;
+        name << "transform_" << dataName << "_" << scaleName << "_" << signature.m << "x"
+             << signature.n << "_a" << operandName(signature.hasA, signature.ldA, signature.rowMajA)
+             << "_b" << operandName(signature.hasB, signature.ldB, signature.rowMajB) << "_c"
+             << operandName(true, signature.ldC, signature.rowMajC) << "_s"
+             << signature.batchStride << "_" << std::hex << sourceHash;
+
+        hipFunction_t function = loadKernel(name.str(), defines);
+        if(!function)
+            return hipErrorNotSupported;
+
+        // Host scalars are passed by value, device scalars by pointer. The kernel reads as many
+        // bytes of the value as its scale type holds.
+        static const double zero     = 0;
+        const void*         alphaPtr = scalarInDevice ? alpha : nullptr;
+        const void*         betaPtr  = scalarInDevice ? beta : nullptr;
+        const void*         alphaVal = !scalarInDevice && alpha ? alpha : &zero;
+        const void*         betaVal  = !scalarInDevice && beta ? beta : &zero;
+        void*               args[]   = {&c,
+                                        &a,
+                                        &b,
+                                        const_cast<void*>(alphaVal),
+                                        &alphaPtr,
+                                        const_cast<void*>(betaVal),
+                                        &betaPtr};
+
+        return hipModuleLaunchKernel(function,
+                                     uint32_t(tiles),
+                                     1,
+                                     batchCount,
+                                     THREADS,
+                                     1,
+                                     1,
+                                     0,
+                                     stream,
+                                     args,
+                                     nullptr);
+    }
+} // namespace JitTransform
@@ -0,0 +1,335 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "OnlineTuning.hpp"
+#include "handle.h"
+#include "utility.hpp"
+
+#include <Tensile/DataTypes.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+
+#define TO_STR2(x) #x
+#define TO_STR(x) TO_STR2(x)
+
+namespace
+{
+    const std::string gitVersionPrefix = "Git Version: ";
+
+    size_t matrixBytes(hipDataType type, size_t ld, size_t cols, size_t batchStride, size_t batches)
+    {
+        auto elementSize = TensileLite::GetElementSize(hipDataType_to_tensile_type(type));
+        return elementSize * (batchStride * (batches - 1) + ld * cols);
+    }
+}
+
+OnlineTuning::OnlineTuning()
+{
+    char* Env = getenv("HIPBLASLT_ONLINE_TUNING_FILE");
+    if(!Env)
+        return;
+    file_path = Env;
+    env_mode  = true;
+
+    if(char* topN = getenv("HIPBLASLT_ONLINE_TUNING_TOP_N"))
+        top_n = std::max(1, atoi(topN));
+    if(char* iters = getenv("HIPBLASLT_ONLINE_TUNING_ITERS"))
+        iterations = std::max(1, atoi(iters));
+
+    // Results of another hipBLASLt version are not reused, as solution indices change
+    std::ifstream file_read(file_path);
+    std::string   firstline;
+    if(std::getline(file_read, firstline))
+    {
+        if(firstline != gitVersionPrefix + TO_STR(HIPBLASLT_VERSION_TWEAK))
+        {
+            env_mode = false;
+            return;
+        }
+        for(auto const& problemSolution : TensileLite::problemsFromFile(file_path))
+        {
+            m_seen.insert(problemSolution.first);
+            m_winners[problemSolution.first] = problemSolution.second;
+        }
+    }
+}
+
+OnlineTuning::~OnlineTuning()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if(m_thread.joinable())
+        m_thread.join();
+}
+
+int OnlineTuning::winner(const TensileLite::ProblemOverride& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        iter = m_winners.find(key);
+    return iter == m_winners.end() ? -1 : iter->second;
+}
+
+void OnlineTuning::submit(rocblaslt_handle                   handle,
+                          const RocblasltContractionProblem& problem,
+                          size_t                             maxWorkspaceBytes)
+{
+    // Arrays of batch pointers can't be backed by scratch buffers
+    if(problem.batch_A || problem.batch_B || problem.batch_C || problem.batch_D
+       || problem.grouped_gemm)
+        return;
+
+    auto key = RocblasltContractionProblem2ProblemOverride(problem);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_stop || !m_seen.insert(key).second)
+        return;
+
+    Job job{key, problem, handle->device, maxWorkspaceBytes, {0}, {0}};
+    memcpy(job.alpha, problem.alpha, sizeof(job.alpha));
+    memcpy(job.beta, problem.beta, sizeof(job.beta));
+    job.problem.alpha = nullptr;
+    job.problem.beta  = nullptr;
+    m_jobs.push_back(job);
+
+    if(!m_thread.joinable())
+        m_thread = std::thread(&OnlineTuning::worker, this);
+    m_cv.notify_one();
+}
+
+void OnlineTuning::worker()
+{
+    // The thread owns a handle and a low priority stream per device
+    std::map<int, std::pair<rocblaslt_handle, hipStream_t>> contexts;
+
+    while(true)
+    {
+        std::optional<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [&]() { return m_stop || !m_jobs.empty(); });
+            if(m_stop)
+                break;
+            job.emplace(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        if(hipSetDevice(job->device) != hipSuccess)
+            continue;
+
+        auto context = contexts.find(job->device);
+        if(context == contexts.end())
+        {
+            rocblaslt_handle handle;
+            hipStream_t      stream;
+            int              leastPriority, greatestPriority;
+            if(rocblaslt_create(&handle) != rocblaslt_status_success)
+                continue;
+            if(hipDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority) != hipSuccess
+               || hipStreamCreateWithPriority(&stream, hipStreamNonBlocking, leastPriority)
+                      != hipSuccess)
+            {
+                rocblaslt_destroy(handle);
+                continue;
+            }
+            context = contexts.emplace(job->device, std::make_pair(handle, stream)).first;
+        }
+
+        int solutionIndex = tune(context->second.first, context->second.second, *job);
+        if(solutionIndex >= 0)
+            record(context->second.first, *job, solutionIndex);
+    }
+
+    for(auto& context : contexts)
+    {
+        static_cast<void>(hipSetDevice(context.first));
+        static_cast<void>(hipStreamDestroy(context.second.second));
+        rocblaslt_destroy(context.second.first);
+    }
+}
+
+int OnlineTuning::tune(rocblaslt_handle handle, hipStream_t stream, Job& job)
+{
+    auto& prob = job.problem;
+
+    std::vector<void*> buffers;
+    bool               allocated = true;
+    auto               scratch   = [&](size_t bytes) -> void* {
+        void* ptr = nullptr;
+        if(hipMalloc(&ptr, std::max(bytes, size_t(16))) != hipSuccess)
+        {
+            allocated = false;
+            return nullptr;
+        }
+        buffers.push_back(ptr);
+        static_cast<void>(hipMemsetAsync(ptr, 0, bytes, stream));
+        return ptr;
+    };
+
+    // The kernels only need buffers of the right size, the caller's data is never touched
+    const size_t batches = prob.batch_count;
+    const size_t vector  = std::max(prob.m, prob.n) * batches;
+    auto         matrix  = [&](hipDataType type, size_t ld, size_t cols, size_t batchStride) {
+        return scratch(matrixBytes(type, ld, cols, batchStride, batches));
+    };
+    const size_t colsA = prob.trans_a == HIPBLAS_OP_N ? prob.k : prob.m;
+    const size_t colsB = prob.trans_b == HIPBLAS_OP_N ? prob.n : prob.k;
+    prob.A             = matrix(prob.a_type, prob.col_stride_a, colsA, prob.batch_stride_a);
+    prob.B             = matrix(prob.b_type, prob.col_stride_b, colsB, prob.batch_stride_b);
+    prob.C             = matrix(prob.c_type, prob.col_stride_c, prob.n, prob.batch_stride_c);
+    prob.D             = matrix(prob.d_type, prob.col_stride_d, prob.n, prob.batch_stride_d);
+    if(prob.E)
+        prob.E = matrix(prob.d_type, prob.col_stride_e, prob.n, prob.batch_stride_e);
+    if(prob.bias)
+        prob.bias = scratch(
+            vector * TensileLite::GetElementSize(hipDataType_to_tensile_type(prob.bias_type)));
+
+    void* scales = scratch(vector * sizeof(float));
+    for(auto scale : {&prob.scaleA,
+                      &prob.scaleB,
+                      &prob.scaleC,
+                      &prob.scaleD,
+                      &prob.scaleE,
+                      &prob.scaleAlphaVec})
+        if(*scale)
+            *scale = scales;
+    if(prob.amaxD)
+        prob.amaxD = scratch(sizeof(float));
+    prob.alpha        = job.alpha;
+    prob.beta         = job.beta;
+    prob.stream       = stream;
+    prob.Synchronizer = nullptr;
+
+    int bestIndex = -1;
+    if(allocated)
+    {
+        std::shared_ptr<void> gemmData;
+        initTensileGemmData(handle,
+                            rocblaslt::RocGemmType::ROCBLASLT_GEMM,
+                            prob.trans_a,
+                            prob.trans_b,
+                            prob.a_type,
+                            prob.b_type,
+                            prob.c_type,
+                            prob.d_type,
+                            prob.compute_type,
+                            job.maxWorkspaceBytes,
+                            gemmData);
+
+        std::vector<rocblaslt_matmul_heuristic_result> candidates(top_n);
+        int                                            returned = 0;
+        prob.workspace     = nullptr;
+        prob.workspaceSize = job.maxWorkspaceBytes;
+        if(getBestSolutions(prob,
+                            handle,
+                            gemmData,
+                            top_n,
+                            candidates.data(),
+                            &returned,
+                            job.maxWorkspaceBytes)
+           != rocblaslt_status_success)
+            returned = 0;
+
+        size_t workspaceSize = 0;
+        for(int i = 0; i < returned; i++)
+            workspaceSize = std::max(workspaceSize, candidates[i].workspaceSize);
+        prob.workspace     = workspaceSize ? scratch(workspaceSize) : nullptr;
+        prob.workspaceSize = workspaceSize;
+
+        hipEvent_t start, stop;
+        bool       events   = hipEventCreate(&start) == hipSuccess;
+        events              = events && hipEventCreate(&stop) == hipSuccess;
+        float      bestTime = std::numeric_limits<float>::max();
+        for(int i = 0; events && allocated && i < returned; i++)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(m_stop)
+                    break;
+            }
+
+            // The first launch loads the code object and warms up the caches
+            auto algo = candidates[i].algo;
+            if(runContractionProblem(handle, &algo, prob, gemmData) != rocblaslt_status_success)
+                continue;
+
+            bool ok = hipEventRecord(start, stream) == hipSuccess;
+            for(int iter = 0; ok && iter < iterations; iter++)
+                ok = runContractionProblem(handle, &algo, prob, gemmData)
+                     == rocblaslt_status_success;
+            float time = 0;
+            ok         = ok && hipEventRecord(stop, stream) == hipSuccess
+                 && hipEventSynchronize(stop) == hipSuccess
+                 && hipEventElapsedTime(&time, start, stop) == hipSuccess;
+            if(ok && time < bestTime)
+            {
+                bestTime  = time;
+                bestIndex = *(int*)algo.data;
+            }
+        }
+        if(events)
+        {
+            static_cast<void>(hipEventDestroy(start));
+            static_cast<void>(hipEventDestroy(stop));
+        }
+    }
+
+    static_cast<void>(hipStreamSynchronize(stream));
+    for(auto ptr : buffers)
+        static_cast<void>(hipFree(ptr));
+
+    return bestIndex;
+}
+
+void OnlineTuning::record(rocblaslt_handle handle, const Job& job, int solutionIndex)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_winners[job.key] = solutionIndex;
+    }
+    invalidateTensileHeuristics();
+
+    std::string line = TensileLite::entriesFromProblem(job.key,
+                                                       solutionIndex,
+                                                       handle->properties.gcnArchName,
+                                                       handle->properties.multiProcessorCount);
+    if(line.empty())
+        return;
+
+    bool empty = std::ifstream(file_path).peek() == std::ifstream::traits_type::eof();
+    if(empty)
+        line = gitVersionPrefix + TO_STR(HIPBLASLT_VERSION_TWEAK) + "\n" + line;
+    std::ofstream file_write(file_path, std::ios::app);
+    // One write per line, so that processes sharing the file don't interleave their lines
+    file_write << line + "\n" << std::flush;
+}
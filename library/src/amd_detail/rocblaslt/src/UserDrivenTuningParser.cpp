@@ -1,5 +1,8 @@
 #include "UserDrivenTuningParser.hpp"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <limits>
 #include <shared_mutex>
 #include <sstream>
 #include <utility>
@@ -7,14 +10,72 @@
 namespace TensileLite
 {
 
-    void getContractionProblemsFromFile(const std::string& path)
+    namespace
     {
-        OverrideMap&                m_override = OverrideMap::getMap();
-        std::mutex&                 map_guard  = m_override.getLock();
-        std::lock_guard<std::mutex> lock(map_guard);
+        const char* entryFromDataType(DataType type)
+        {
+            switch(type)
+            {
+            case DataType::Float:
+                return "f32_r";
+            case DataType::Double:
+                return "f64_r";
+            case DataType::Half:
+                return "f16_r";
+            case DataType::BFloat16:
+                return "bf16_r";
+            case DataType::Float8:
+                return "f8_r";
+            case DataType::BFloat8:
+                return "bf8_r";
+            case DataType::Int8:
+                return "i8_r";
+            case DataType::Int32:
+                return "i32_r";
+            default:
+                return nullptr;
+            }
+        }
 
-        if(m_override.size() == 0)
+        bool isBlank(const std::string& entry, size_t pos)
+        {
+            return entry.find_first_not_of(" \t\n\r\f\v", pos) == std::string::npos;
+        }
+
+        // Parses a size column into the sizes [first, last), throws like std::stoul
+        void sizeRangeFromEntry(const std::string& entry, size_t& first, size_t& last)
+        {
+            size_t pos = 0;
+            first      = std::stoul(entry, &pos);
+            last       = first + 1;
+            if(isBlank(entry, pos))
+                return;
+
+            size_t end   = 0;
+            auto   value = std::stoul(entry.substr(pos + 1), &end);
+            if((entry[pos] != ':' && entry[pos] != '~') || !isBlank(entry, pos + 1 + end))
+                throw std::invalid_argument(entry);
+
+            if(entry[pos] == ':')
+            {
+                last = value;
+            }
+            else
+            {
+                // The sizes that round to first at a granularity of value
+                size_t half = value / 2;
+                last        = first + value - half;
+                first       = first > half ? first - half : 0;
+            }
+
+            if(last <= first)
+                throw std::invalid_argument(entry);
+        }
+
+        // Splits the lines of an override file into their columns
+        std::vector<std::vector<std::string>> entriesFromFile(const std::string& path)
         {
+            std::vector<std::vector<std::string>> lines;
 
             std::ifstream file_read(path);
             std::string   line, entry;
@@ -39,79 +100,360 @@ namespace TensileLite
                         entries.push_back(entry);
                     }
 
-                    auto problemSolution = problemFromEntries(entries);
+                    lines.push_back(std::move(entries));
+                }
+            }
+
+            return lines;
+        }
+
+        // Parses a line into a range, solution index pair with an index of -1 on failure
+        std::pair<ProblemOverrideRange, int> parseEntries(const std::vector<std::string>& entries)
+        {
+            // Measured lines add the time and energy per call after the CU count
+            const size_t entries_n = entries.size();
+            if(entries_n != 37 && entries_n != 39)
+            {
+                return std::make_pair(ProblemOverrideRange{}, -1);
+            }
+
+            //Expected format: transA,transB,batch_count,M,N,K,input_type,output_type,compute_type,
+            //solution_index
+            bool transA = (entries[0] != "N");
+            bool transB = (entries[1] != "N");
+
+            size_t   m, n, b, k, mEnd, nEnd, bEnd, kEnd;
+            DataType inputType   = DataType::None;
+            DataType outputType  = DataType::None;
+            DataType computeType = DataType::None;
+
+            int solution_idx = -1;
+
+            try
+            {
+
+                // TODO: are any additional mapping parameters needed?
+
+                sizeRangeFromEntry(entries[3], b, bEnd);
+                sizeRangeFromEntry(entries[4], m, mEnd);
+                sizeRangeFromEntry(entries[5], n, nEnd);
+                sizeRangeFromEntry(entries[6], k, kEnd);
+                inputType    = hipDataType_to_tensile_type(string_to_hip_datatype(entries[17]));
+                outputType   = hipDataType_to_tensile_type(string_to_hip_datatype(entries[19]));
+                computeType  = hipDataType_to_tensile_type(string_to_hip_datatype(entries[21]));
+                solution_idx = std::stoi(entries[34]);
+            }
+            catch(std::invalid_argument const& ex)
+            {
+                return std::make_pair(ProblemOverrideRange{}, -1);
+            }
+            catch(std::out_of_range const& ex)
+            {
+                return std::make_pair(ProblemOverrideRange{}, -1);
+            }
+
+            if(inputType == DataType::None || outputType == DataType::None
+               || computeType == DataType::None)
+            {
+                return std::make_pair(ProblemOverrideRange{}, -1);
+            }
+
+            ProblemOverride      po(transA, transB, inputType, computeType, outputType, m, n, k, b);
+            ProblemOverrideRange range{po, mEnd, nEnd, kEnd, bEnd};
+
+            return std::make_pair(range, solution_idx);
+        }
+
+        // Parses a time or energy column, NaN when blank or invalid
+        double measurementFromEntry(const std::string& entry)
+        {
+            try
+            {
+                size_t pos   = 0;
+                double value = std::stod(entry, &pos);
+                if(isBlank(entry, pos) && value >= 0)
+                    return value;
+            }
+            catch(std::invalid_argument const& ex)
+            {
+            }
+            catch(std::out_of_range const& ex)
+            {
+            }
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        bool isExact(const ProblemOverrideRange& range)
+        {
+            return range.mEnd == range.problem.m() + 1 && range.nEnd == range.problem.n() + 1
+                   && range.kEnd == range.problem.k() + 1
+                   && range.batchSizeEnd == range.problem.batchSize() + 1;
+        }
+
+        // log2 of how far size lies outside [first, last), negative beyond a factor of two
+        double sizeDistance(size_t size, size_t first, size_t last)
+        {
+            if(size >= first && size < last)
+                return 0;
+            if(size == 0)
+                return -1;
+
+            double ratio = size < first ? double(first) / size : double(size) / (last - 1);
+            return ratio > 2 ? -1 : std::log2(ratio);
+        }
+    }
+
+    std::vector<std::pair<ProblemOverride, int>> problemsFromFile(const std::string& path)
+    {
+        std::vector<std::pair<ProblemOverride, int>> problems;
+
+        for(auto const& entries : entriesFromFile(path))
+        {
+            auto problemSolution = problemFromEntries(entries);
+
+            if(problemSolution.second > 0)
+                problems.push_back(problemSolution);
+        }
+
+        return problems;
+    }
+
+    std::vector<std::pair<ProblemOverrideRange, int>>
+        problemRangesFromFile(const std::string& path)
+    {
+        std::vector<std::pair<ProblemOverrideRange, int>> ranges;
+
+        for(auto const& entries : entriesFromFile(path))
+        {
+            auto rangeSolution = problemRangeFromEntries(entries);
+
+            if(rangeSolution.second > 0)
+                ranges.push_back(rangeSolution);
+        }
+
+        return ranges;
+    }
+
+    void getContractionProblemsFromFile(const std::string& path)
+    {
+        OverrideMap&                m_override = OverrideMap::getMap();
+        std::mutex&                 map_guard  = m_override.getLock();
+        std::lock_guard<std::mutex> lock(map_guard);
 
-                    if(problemSolution.second > 0)
+        if(m_override.size() == 0)
+        {
+            for(auto const& problemSolution : problemsFromFile(path))
+            {
+                auto sol_iter = m_override.find(problemSolution.first);
+                for(auto sol_idx = sol_iter.first; sol_idx != sol_iter.second; sol_idx++)
+                {
+                    if(sol_idx->second == problemSolution.second)
                     {
-                        auto sol_iter = m_override.find(problemSolution.first);
-                        for(auto sol_idx = sol_iter.first; sol_idx != sol_iter.second; sol_idx++)
-                        {
-                            if(sol_idx->second == problemSolution.second)
-                            {
-                                m_override.erase(sol_idx);
-                                break;
-                            }
-                        }
-
-                        m_override.add(problemSolution);
+                        m_override.erase(sol_idx);
+                        break;
                     }
                 }
+
+                m_override.add(problemSolution);
+            }
+
+            for(auto const& rangeSolution : problemRangesFromFile(path))
+                m_override.addRange(rangeSolution);
+
+            for(auto const& entries : entriesFromFile(path))
+            {
+                auto measurement = measurementFromEntries(entries);
+                if(measurement.second.solutionIndex > 0)
+                    m_override.addMeasurement(measurement);
             }
         }
     }
 
-    std::pair<ProblemOverride, int> problemFromEntries(const std::vector<std::string>& entries)
+    std::vector<int> overrideSolutionIndices(const ProblemOverride&   problem,
+                                             const OverrideSingleton& override)
     {
+        std::vector<int> indices;
 
-        const size_t entries_n = entries.size();
-        if(entries_n != 37)
+        if(override.database)
         {
-            return std::make_pair(ProblemOverride{}, -1);
+            // Lookups read the mapped pages directly, nothing is parsed at startup
+            static TuningDatabase database;
+            static bool           opened = database.open(override.file_path);
+
+            const char* inputType   = entryFromDataType(problem.inputType());
+            const char* outputType  = entryFromDataType(problem.outputType());
+            const char* computeType = entryFromDataType(problem.computeType());
+            if(!opened || !inputType || !outputType || !computeType)
+                return indices;
+
+            TuningDatabaseEntry key{};
+            key.transA      = problem.transA();
+            key.transB      = problem.transB();
+            key.inputType   = tuningDatabaseType(string_to_hip_datatype(inputType));
+            key.outputType  = tuningDatabaseType(string_to_hip_datatype(outputType));
+            key.computeType = tuningDatabaseType(string_to_hip_datatype(computeType));
+            key.m           = problem.m();
+            key.n           = problem.n();
+            key.k           = problem.k();
+            key.batchSize   = problem.batchSize();
+
+            auto range = database.find(key);
+            for(auto entry = range.first; entry != range.second; entry++)
+                indices.push_back(entry->solutionIndex);
+            return indices;
         }
 
-        //Expected format: transA,transB,batch_count,M,N,K,input_type,output_type,compute_type,solution_index
-        bool transA = (entries[0] != "N");
-        bool transB = (entries[1] != "N");
+        getContractionProblemsFromFile(override.file_path);
+        OverrideMap& m_override = OverrideMap::getMap();
+        auto         sol_iter   = m_override.find(problem);
+        for(auto sol_idx = std::make_reverse_iterator(sol_iter.second);
+            sol_idx != std::make_reverse_iterator(sol_iter.first);
+            sol_idx++)
+            indices.push_back(sol_idx->second);
+
+        for(auto index : m_override.findRanges(problem))
+            indices.push_back(index);
 
-        size_t   m, n, b, k;
-        DataType inputType   = DataType::None;
-        DataType outputType  = DataType::None;
-        DataType computeType = DataType::None;
+        return indices;
+    }
 
-        int solution_idx = -1;
+    std::vector<int> energyEfficientSolutionIndices(const ProblemOverride&   problem,
+                                                    const OverrideSingleton& override,
+                                                    double                   latencyBound)
+    {
+        std::vector<int> indices;
+        if(override.database || latencyBound <= 0)
+            return indices;
 
-        try
-        {
+        getContractionProblemsFromFile(override.file_path);
+        auto measurements = OverrideMap::getMap().findMeasurements(problem);
 
-            // TODO: are any additional mapping parameters needed?
+        double fastest = std::numeric_limits<double>::infinity();
+        for(auto const& m : measurements)
+            if(m.timeUs >= 0)
+                fastest = std::min(fastest, m.timeUs);
 
-            b            = std::stol(entries[3]);
-            m            = std::stol(entries[4]);
-            n            = std::stol(entries[5]);
-            k            = std::stol(entries[6]);
-            inputType    = hipDataType_to_tensile_type(string_to_hip_datatype(entries[17]));
-            outputType   = hipDataType_to_tensile_type(string_to_hip_datatype(entries[19]));
-            computeType  = hipDataType_to_tensile_type(string_to_hip_datatype(entries[21]));
-            solution_idx = std::stoi(entries[34]);
-        }
-        catch(std::invalid_argument const& ex)
+        // Entries without an energy can't be ranked and are left to overrideSolutionIndices()
+        std::vector<OverrideMeasurement> candidates;
+        for(auto const& m : measurements)
+            if(m.timeUs <= fastest * std::max(latencyBound, 1.0) && m.energyUJ >= 0)
+                candidates.push_back(m);
+
+        std::stable_sort(candidates.begin(), candidates.end(), [](auto const& a, auto const& b) {
+            return a.energyUJ < b.energyUJ || (a.energyUJ == b.energyUJ && a.timeUs < b.timeUs);
+        });
+        for(auto const& m : candidates)
+            indices.push_back(m.solutionIndex);
+
+        return indices;
+    }
+
+    std::pair<ProblemOverride, OverrideMeasurement>
+        measurementFromEntries(const std::vector<std::string>& entries)
+    {
+        OverrideMeasurement none{-1, 0, 0};
+        if(entries.size() != 39)
+            return std::make_pair(ProblemOverride{}, none);
+
+        auto problemSolution = problemFromEntries(entries);
+        if(problemSolution.second < 0)
+            return std::make_pair(ProblemOverride{}, none);
+
+        OverrideMeasurement measurement{problemSolution.second,
+                                        measurementFromEntry(entries[37]),
+                                        measurementFromEntry(entries[38])};
+        if(std::isnan(measurement.timeUs))
+            return std::make_pair(ProblemOverride{}, none);
+
+        return std::make_pair(problemSolution.first, measurement);
+    }
+
+    std::pair<ProblemOverride, int> problemFromEntries(const std::vector<std::string>& entries)
+    {
+        auto rangeSolution = parseEntries(entries);
+        if(rangeSolution.second < 0 || !isExact(rangeSolution.first))
         {
             return std::make_pair(ProblemOverride{}, -1);
         }
-        catch(std::out_of_range const& ex)
+
+        return std::make_pair(rangeSolution.first.problem, rangeSolution.second);
+    }
+
+    std::pair<ProblemOverrideRange, int>
+        problemRangeFromEntries(const std::vector<std::string>& entries)
+    {
+        auto rangeSolution = parseEntries(entries);
+        if(rangeSolution.second < 0 || isExact(rangeSolution.first))
         {
-            return std::make_pair(ProblemOverride{}, -1);
+            return std::make_pair(ProblemOverrideRange{}, -1);
         }
 
-        if(inputType == DataType::None || outputType == DataType::None
-           || computeType == DataType::None)
+        return rangeSolution;
+    }
+
+    bool ProblemOverrideRange::contains(const ProblemOverride& po) const
+    {
+        return distance(po) == 0;
+    }
+
+    double ProblemOverrideRange::distance(const ProblemOverride& po) const
+    {
+        if(po.transA() != problem.transA() || po.transB() != problem.transB()
+           || po.inputType() != problem.inputType() || po.computeType() != problem.computeType()
+           || po.outputType() != problem.outputType())
+            return -1;
+
+        double total = 0;
+        for(double d : {sizeDistance(po.m(), problem.m(), mEnd),
+                        sizeDistance(po.n(), problem.n(), nEnd),
+                        sizeDistance(po.k(), problem.k(), kEnd),
+                        sizeDistance(po.batchSize(), problem.batchSize(), batchSizeEnd)})
         {
-            return std::make_pair(ProblemOverride{}, -1);
+            if(d < 0)
+                return -1;
+            total += d;
         }
+        return total;
+    }
 
-        ProblemOverride po(transA, transB, inputType, computeType, outputType, m, n, k, b);
+    std::string entriesFromProblem(const ProblemOverride& problem,
+                                   int                    solutionIndex,
+                                   const std::string&     archName,
+                                   int                    cuCount,
+                                   double                 timeUs,
+                                   double                 energyUJ)
+    {
+        const char* inputType   = entryFromDataType(problem.inputType());
+        const char* outputType  = entryFromDataType(problem.outputType());
+        const char* computeType = entryFromDataType(problem.computeType());
+        if(!inputType || !outputType || !computeType)
+            return std::string();
+
+        // Columns that problemFromEntries() does not read are left empty
+        bool                     measured = timeUs >= 0 && energyUJ >= 0;
+        std::vector<std::string> entries(measured ? 39 : 37);
+        entries[0]  = problem.transA() ? "T" : "N";
+        entries[1]  = problem.transB() ? "T" : "N";
+        entries[3]  = std::to_string(problem.batchSize());
+        entries[4]  = std::to_string(problem.m());
+        entries[5]  = std::to_string(problem.n());
+        entries[6]  = std::to_string(problem.k());
+        entries[17] = inputType;
+        entries[19] = outputType;
+        entries[21] = computeType;
+        entries[34] = std::to_string(solutionIndex);
+        entries[35] = archName;
+        entries[36] = std::to_string(cuCount);
+        if(measured)
+        {
+            entries[37] = std::to_string(timeUs);
+            entries[38] = std::to_string(energyUJ);
+        }
 
-        return std::make_pair(po, solution_idx);
+        std::string line = entries[0];
+        for(size_t i = 1; i < entries.size(); i++)
+            line += "," + entries[i];
+        return line;
     }
 
     ProblemOverride::ProblemOverride()
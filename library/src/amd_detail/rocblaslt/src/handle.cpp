@@ -28,17 +28,27 @@
 #include "definitions.h"
 #include "logging.h"
 
+#include <Tensile/hip/HipHardware.hpp>
 #include <hip/hip_runtime.h>
 
+namespace
+{
+    int activeDevice()
+    {
+        int device;
+        THROW_IF_HIP_ERROR(hipGetDevice(&device));
+        return device;
+    }
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
+// Default device is active device, its properties are queried once per process
 _rocblaslt_handle::_rocblaslt_handle()
+    : device(activeDevice())
+    , properties(TensileLite::hip::GetDeviceProperties(device))
 {
-    // Default device is active device
-    THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
-
     // Device wavefront size
     wavefront_size = properties.warpSize;
 
@@ -0,0 +1,160 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "Debug.hpp"
+#include "rocblaslt-types.h"
+
+#include <hip/hip_runtime_api.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * CallTiming splits the host time of hipblasLtMatmul calls into phases when   *
+ * HIPBLASLT_CALL_TIMING is set. Every thread adds the durations to log2       *
+ * histograms of its own, keyed by the problem signature, so the calls never   *
+ * wait on each other. With HIPBLASLT_CALL_TIMING=2 the kernels are bracketed  *
+ * by events on the caller's stream too, the events are read on later calls    *
+ * of the thread once they completed, without waiting on the stream.           *
+ *******************************************************************************/
+namespace CallTiming
+{
+    enum Phase
+    {
+        Total,
+        Validation,
+        Heuristic,
+        Solve,
+        Launch,
+        Device,
+        PhaseCount
+    };
+    static_assert(PhaseCount == rocblaslt::RocCallTiming::phaseCount);
+
+    using Clock = std::chrono::steady_clock;
+
+    // 0 when disabled, the only thing the instrumented calls check then
+    inline int mode()
+    {
+        return (rocblaslt::instrumentationFlags() & rocblaslt::INSTRUMENTATION_CALL_TIMING)
+               >> rocblaslt::INSTRUMENTATION_CALL_TIMING_SHIFT;
+    }
+
+    // Times a call from construction to destruction. Calls nested in an open call of
+    // the thread, such as the stages of the multi-GEMM epilogues, are part of the outer one.
+    class Call
+    {
+    public:
+        // signature is only invoked when the timing is enabled
+        template <typename Signature>
+        explicit Call(Signature&& signature)
+        {
+            if(mode())
+                begin(signature());
+        }
+        ~Call()
+        {
+            if(m_open)
+                end();
+        }
+
+        Call(const Call&)            = delete;
+        Call& operator=(const Call&) = delete;
+
+    private:
+        void begin(const std::string& signature);
+        void end();
+
+        bool              m_open = false;
+        Clock::time_point m_start;
+    };
+
+    // Adds the time until stop() or destruction to a phase of the open call of the thread
+    class Scope
+    {
+    public:
+        explicit Scope(Phase phase)
+            : m_phase(phase)
+        {
+            if(mode())
+                begin();
+        }
+        ~Scope()
+        {
+            stop();
+        }
+        void stop()
+        {
+            if(m_active)
+                end();
+        }
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        void begin();
+        void end();
+
+        Phase             m_phase;
+        bool              m_active = false;
+        Clock::time_point m_start;
+    };
+
+    // Brackets the kernels queued on stream during its lifetime with events
+    class DeviceScope
+    {
+    public:
+        explicit DeviceScope(hipStream_t stream)
+            : m_stream(stream)
+        {
+            if(mode() >= 2)
+                begin();
+        }
+        ~DeviceScope()
+        {
+            if(m_start)
+                end();
+        }
+
+        DeviceScope(const DeviceScope&)            = delete;
+        DeviceScope& operator=(const DeviceScope&) = delete;
+
+    private:
+        void begin();
+        void end();
+
+        hipStream_t m_stream;
+        hipEvent_t  m_start = nullptr;
+        hipEvent_t  m_stop  = nullptr;
+    };
+
+    // Sums the histograms of all threads, the signatures in order
+    std::vector<rocblaslt::RocCallTiming> collect();
+} // namespace CallTiming
@@ -0,0 +1,76 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include <hip/hip_runtime_api.h>
+#include <hip/library_types.h>
+
+#include <cstdint>
+
+/*******************************************************************************
+ * JitTransform compiles the same type matrix transform with hipRTC for the    *
+ * exact sizes, leading dimensions and orders of a problem when                *
+ * HIPBLASLT_JIT_CACHE_DIR is set. The sizes are folded into the kernel, so    *
+ * the index math is constant, the loops unroll and the bounds checks of       *
+ * evenly tiled shapes vanish. Code objects are kept in the directory per      *
+ * device architecture, a shape that repeats is compiled once across runs.     *
+ *******************************************************************************/
+namespace JitTransform
+{
+    // C = alpha * op(A) + beta * op(B), the orders have the transposes folded in
+    struct Signature
+    {
+        hipDataType dataType;
+        hipDataType scaleType;
+        uint64_t    m;
+        uint64_t    n;
+        int64_t     ldA;
+        int64_t     ldB;
+        int64_t     ldC;
+        bool        rowMajA;
+        bool        rowMajB;
+        bool        rowMajC;
+        bool        hasA;
+        bool        hasB;
+        int64_t     batchStride;
+    };
+
+    bool enabled();
+
+    // hipErrorNotSupported when the types are not covered or the kernel failed to compile,
+    // the caller then runs the precompiled kernels
+    hipError_t launch(const Signature& signature,
+                      void*            c,
+                      const void*      a,
+                      const void*      b,
+                      const void*      alpha,
+                      const void*      beta,
+                      bool             scalarInDevice,
+                      uint32_t         batchCount,
+                      hipStream_t      stream);
+} // namespace JitTransform
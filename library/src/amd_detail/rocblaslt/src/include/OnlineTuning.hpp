@@ -0,0 +1,98 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "UserDrivenTuningParser.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+/*******************************************************************************
+ * OnlineTuning benchmarks the top solutions of problems that the tuning       *
+ * override does not cover on a low priority stream of a background thread,   *
+ * and records the fastest one in HIPBLASLT_ONLINE_TUNING_FILE. The file uses   *
+ * the HIPBLASLT_TUNING_OVERRIDE_FILE format and is loaded on the next start.  *
+ *******************************************************************************/
+class OnlineTuning
+{
+public:
+    std::string file_path;
+    bool        env_mode   = false;
+    int         top_n      = 8;
+    int         iterations = 10;
+
+    static OnlineTuning& getInstance()
+    {
+        static OnlineTuning gInstance;
+        return gInstance;
+    }
+
+    // copy contructor
+    OnlineTuning(const OnlineTuning&) = delete;
+    // assignment operator
+    OnlineTuning& operator=(const OnlineTuning&) = delete;
+
+    // Returns the solution index tuned for the problem, or -1
+    int winner(const TensileLite::ProblemOverride& key);
+
+    // Queues the first sight of a problem for tuning, the problem pointers are not used
+    void submit(rocblaslt_handle                   handle,
+                const RocblasltContractionProblem& problem,
+                size_t                             maxWorkspaceBytes);
+
+private:
+    struct Job
+    {
+        TensileLite::ProblemOverride key;
+        RocblasltContractionProblem  problem;
+        int                          device;
+        size_t                       maxWorkspaceBytes;
+        int8_t                       alpha[16];
+        int8_t                       beta[16];
+    };
+
+    OnlineTuning();
+    ~OnlineTuning();
+
+    void worker();
+    int  tune(rocblaslt_handle handle, hipStream_t stream, Job& job);
+    void record(rocblaslt_handle handle, const Job& job, int solutionIndex);
+
+    std::mutex                                  m_mutex;
+    std::condition_variable                     m_cv;
+    std::deque<Job>                             m_jobs;
+    std::set<TensileLite::ProblemOverride>      m_seen;
+    std::map<TensileLite::ProblemOverride, int> m_winners;
+    std::thread                                 m_thread;
+    bool                                        m_stop = false;
+};
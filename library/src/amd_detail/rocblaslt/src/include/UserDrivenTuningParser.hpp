@@ -2,6 +2,7 @@
 
 #include "auxiliary.hpp"
 #include "tensile_host.hpp"
+#include "tuning_database.hpp"
 #include <Tensile/DataTypes.hpp>
 #include <shared_mutex>
 
@@ -14,6 +15,7 @@ class OverrideSingleton
 public:
     std::string file_path;
     bool        env_mode = false;
+    bool        database = false; // file_path is a binary tuning database
 
     static OverrideSingleton& getInstance()
     {
@@ -34,6 +36,7 @@ private:
         {
             file_path = Env;
             env_mode  = true;
+            database  = TuningDatabase::isDatabase(file_path);
         }
     }
 
@@ -107,8 +110,72 @@ namespace TensileLite
         size_t   m_batchSize;
     };
 
+    // Override entry of a range of sizes. The batch, m, n and k columns of a file line
+    // take an exact size, a half-open range "first:last" or a bucket "size~step" of the
+    // sizes that round to size at a granularity of step.
+    struct ProblemOverrideRange
+    {
+        ProblemOverride problem; // Transposes, types and the first size of each range
+        size_t          mEnd;
+        size_t          nEnd;
+        size_t          kEnd;
+        size_t          batchSizeEnd;
+
+        bool contains(const ProblemOverride& po) const;
+
+        // Sum of the log2 ratios between the sizes of po and the range. Negative if the
+        // kinds differ or a size of po is more than twice as far as the range.
+        double distance(const ProblemOverride& po) const;
+    };
+
+    // Time and energy per call that the tuning run measured for an override entry, in the
+    // two optional columns after the CU count
+    struct OverrideMeasurement
+    {
+        int    solutionIndex;
+        double timeUs;
+        double energyUJ;
+    };
+
     std::pair<ProblemOverride, int> problemFromEntries(const std::vector<std::string>& entries);
 
+    // Parses the measurement of a line of an exact size, the index is -1 for lines without one
+    std::pair<ProblemOverride, OverrideMeasurement>
+        measurementFromEntries(const std::vector<std::string>& entries);
+
+    // Parses a line with at least one range or bucket size, problemFromEntries() parses
+    // the lines of exact sizes
+    std::pair<ProblemOverrideRange, int>
+        problemRangeFromEntries(const std::vector<std::string>& entries);
+
+    // Returns a line that problemFromEntries() parses back, or an empty string for types
+    // that the file format can't express. The measurement columns are written when both
+    // the time and the energy are given.
+    std::string entriesFromProblem(const ProblemOverride& problem,
+                                   int                    solutionIndex,
+                                   const std::string&     archName,
+                                   int                    cuCount,
+                                   double                 timeUs   = -1,
+                                   double                 energyUJ = -1);
+
+    std::vector<std::pair<ProblemOverride, int>> problemsFromFile(const std::string& path);
+
+    std::vector<std::pair<ProblemOverrideRange, int>>
+        problemRangesFromFile(const std::string& path);
+
+    // Returns the solution indices of the override file for the problem, in order of
+    // preference. The file is a text override file or a binary tuning database. Exact
+    // entries come first, then the ranges containing the problem or, if there are none,
+    // the nearest ranges.
+    std::vector<int> overrideSolutionIndices(const ProblemOverride& problem,
+                                             const OverrideSingleton& override);
+
+    // Returns the solution indices of the measured exact entries of a text override file
+    // whose time is at most latencyBound times the fastest one, least energy first
+    std::vector<int> energyEfficientSolutionIndices(const ProblemOverride&   problem,
+                                                    const OverrideSingleton& override,
+                                                    double                   latencyBound);
+
     void getContractionProblemsFromFile(const std::string& path);
 
     template <>
@@ -161,7 +228,7 @@ namespace TensileLite
         int size()
         {
             std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
-            auto                                      size = m_override.size();
+            auto                                      size = m_override.size() + m_ranges.size();
             return size;
         }
 
@@ -176,12 +243,71 @@ namespace TensileLite
         {
             std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
             m_override.insert(problemSolution);
+            invalidateTensileHeuristics();
+        }
+
+        void addRange(const std::pair<ProblemOverrideRange, int>& problemSolution)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+            m_ranges.push_back(problemSolution);
+            invalidateTensileHeuristics();
+        }
+
+        // Later entries take precedence, as for the exact entries
+        std::vector<int> findRanges(const ProblemOverride& prob_key)
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+            std::vector<int>                          indices;
+            for(auto range = m_ranges.rbegin(); range != m_ranges.rend(); range++)
+                if(range->first.contains(prob_key))
+                    indices.push_back(range->second);
+            if(!indices.empty())
+                return indices;
+
+            double nearest = -1;
+            for(auto range = m_ranges.rbegin(); range != m_ranges.rend(); range++)
+            {
+                double distance = range->first.distance(prob_key);
+                if(distance < 0 || (nearest >= 0 && distance > nearest))
+                    continue;
+                if(distance != nearest)
+                    indices.clear();
+                nearest = distance;
+                indices.push_back(range->second);
+            }
+            return indices;
+        }
+
+        // A later measurement of a solution replaces the earlier one
+        void addMeasurement(const std::pair<ProblemOverride, OverrideMeasurement>& measurement)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+            auto& measurements = m_measurements[measurement.first];
+            for(auto& m : measurements)
+                if(m.solutionIndex == measurement.second.solutionIndex)
+                {
+                    m = measurement.second;
+                    invalidateTensileHeuristics();
+                    return;
+                }
+            measurements.push_back(measurement.second);
+            invalidateTensileHeuristics();
+        }
+
+        std::vector<OverrideMeasurement> findMeasurements(const ProblemOverride& prob_key)
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+            auto                                      iter = m_measurements.find(prob_key);
+            if(iter == m_measurements.end())
+                return {};
+            return iter->second;
         }
 
         void erase(std::multimap<ProblemOverride, int>::iterator& sol_idx)
         {
             std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
             m_override.erase(sol_idx);
+            invalidateTensileHeuristics();
         }
 
         std::mutex& getLock()
@@ -190,9 +316,11 @@ namespace TensileLite
         }
 
     private:
-        std::multimap<ProblemOverride, int> m_override;
-        std::mutex                          m_guard;
-        std::shared_timed_mutex             m_mutex;
+        std::multimap<ProblemOverride, int>                         m_override;
+        std::vector<std::pair<ProblemOverrideRange, int>>           m_ranges;
+        std::map<ProblemOverride, std::vector<OverrideMeasurement>> m_measurements;
+        std::mutex                                                  m_guard;
+        std::shared_timed_mutex                                     m_mutex;
     };
 } // namespace Tensile
 
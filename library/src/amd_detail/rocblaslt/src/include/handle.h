@@ -34,6 +34,7 @@
 #include <fstream>
 #include <hip/hip_runtime_api.h>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 struct _rocblaslt_attribute
@@ -85,16 +86,30 @@ struct _rocblaslt_handle
 
     // device id
     int device;
-    // device properties
-    hipDeviceProp_t properties;
+    // device properties, shared by all handles of the device
+    const hipDeviceProp_t& properties;
     // device wavefront size
     int wavefront_size;
     // asic revision
     int asic_rev;
 
+    // caller-owned Synchronizer, when null tensile_host.cpp uses a pooled one per stream
     void* Synchronizer = nullptr;
     // pointer mode ; default mode is host
     rocblaslt_pointer_mode pointer_mode = rocblaslt_pointer_mode_host;
+    // only select and run reductions of a fixed order, see setTensileReproducible()
+    bool reproducible = false;
+
+    // resolved matmul executions, managed by tensile_host.cpp
+    std::shared_ptr<void> m_execCache;
+    // opt-in stream-ordered workspace pool, managed by tensile_host.cpp
+    std::shared_ptr<void> m_workspacePool;
+    // opt-in high-priority launch stream, managed by tensile_host.cpp
+    std::shared_ptr<void> m_priorityStream;
+    // pinned host slots for grouped gemm arguments, managed by tensile_host.cpp
+    std::shared_ptr<void> m_hostStagingRing;
+    // pooled Synchronizer buffers per stream, managed by tensile_host.cpp
+    std::shared_ptr<void> m_synchronizerPool;
 };
 
 /********************************************************************************
@@ -122,6 +137,13 @@ struct _rocblaslt_matrix_layout
     int32_t          batch_count  = 1;
     int64_t          batch_stride = 0;
     hipblasLtOrder_t order        = HIPBLASLT_ORDER_COL;
+    // batches are strided or found through a device array of pointers
+    hipblasLtBatchMode_t batch_mode = HIPBLASLT_BATCH_MODE_STRIDED;
+    // 2:4 compressed by hipblasltExtSparseCompress, m, n and ld still describe the dense matrix
+    hipblasLtSparsity_t sparsity = HIPBLASLT_SPARSITY_DENSE;
+    // outer level of a two-level batch around batch_count and batch_stride
+    int32_t outer_batch_count  = 1;
+    int64_t outer_batch_stride = 0;
 };
 
 /********************************************************************************
@@ -158,6 +180,49 @@ struct _rocblaslt_matmul_desc
     void*   e        = nullptr;
     int64_t lde      = 0;
     int64_t stride_e = 0;
+    // nonzero to reduce the bias gradient in a fixed order after the GEMM
+    int32_t bgrad_deterministic = 0;
+    // nonzero to only run solutions that reduce split-k partials in a fixed order
+    int32_t reduce_deterministic = 0;
+    // CUs that persistent and StreamK grids are sized to, 0 for all of them
+    int32_t cu_budget = 0;
+    // uint32_t counters bumped as each chunk of completion_cols columns of D is stored
+    void*   completion_flags = nullptr;
+    int32_t completion_cols  = 0;
+    // metadata of a 2:4 compressed A
+    void* sparse_metadata_a = nullptr;
+    // rocblaslt_cache_policy of the stores of D and the loads of B
+    int32_t cache_policy_d = 0;
+    int32_t cache_policy_b = 0;
+    // type of E when it differs from D, and the amax of E before scaleE
+    hipDataType aux_type = HIPBLASLT_DATATYPE_INVALID;
+    void*       aux_amax = nullptr;
+    // R
+    void*                       residual          = nullptr;
+    hipDataType                 residual_type     = HIPBLASLT_DATATYPE_INVALID;
+    int64_t                     ldr               = 0;
+    int64_t                     stride_r          = 0;
+    rocblaslt_residual_position residual_position = rocblaslt_residual_after_activation;
+    // dropout, seed and offset are uint64_t in device memory
+    float dropout        = 0.f;
+    void* dropout_seed   = nullptr;
+    void* dropout_offset = nullptr;
+    // amax history of delayed scaling, with its int32 slot and next float scale in device memory
+    void*   amax_history        = nullptr;
+    int32_t amax_history_length = 0;
+    void*   amax_history_index  = nullptr;
+    void*   amax_history_scale  = nullptr;
+    int32_t amax_history_margin = 0;
+    // second output written from D in its own type and scale
+    void*       d2        = nullptr;
+    hipDataType d2_type   = HIPBLASLT_DATATYPE_INVALID;
+    int64_t     ldd2      = 0;
+    int64_t     stride_d2 = 0;
+    void*       scaleD2   = nullptr;
+    // group scales and zero points of a weight-only quantized B, in the type of A
+    void*   b_quant_scale      = nullptr;
+    void*   b_quant_zero       = nullptr;
+    int32_t b_quant_group_size = 0;
     //
     rocblaslt_compute_type compute_type;
     rocblaslt_compute_type compute_type_original;
@@ -167,6 +232,12 @@ struct _rocblaslt_matmul_desc
 
     bool isScaleAVec = false;
     bool isScaleBVec = false;
+    bool isScaleDVec = false;
+    // scaleA and scaleB hold one E8M0 scale per block of 32 elements along k
+    bool isScaleABlock = false;
+    bool isScaleBBlock = false;
+    // One scale of the vector scaleD per column of D instead of per row
+    bool scaleDVecAlongN = false;
 
     std::shared_ptr<void> m_data; // Tensile data
 
@@ -183,12 +254,47 @@ struct _rocblaslt_matmul_desc
         this->scaleE                = src.scaleE;
         this->isScaleAVec           = src.isScaleAVec;
         this->isScaleBVec           = src.isScaleBVec;
+        this->isScaleDVec           = src.isScaleDVec;
+        this->isScaleABlock         = src.isScaleABlock;
+        this->isScaleBBlock         = src.isScaleBBlock;
+        this->scaleDVecAlongN       = src.scaleDVecAlongN;
         this->pointermode           = src.pointermode;
         this->amaxD                 = src.amaxD;
         this->bias_type             = src.bias_type;
         this->e                     = src.e;
         this->lde                   = src.lde;
         this->stride_e              = src.stride_e;
+        this->bgrad_deterministic   = src.bgrad_deterministic;
+        this->reduce_deterministic  = src.reduce_deterministic;
+        this->cu_budget             = src.cu_budget;
+        this->completion_flags      = src.completion_flags;
+        this->completion_cols       = src.completion_cols;
+        this->sparse_metadata_a     = src.sparse_metadata_a;
+        this->cache_policy_d        = src.cache_policy_d;
+        this->cache_policy_b        = src.cache_policy_b;
+        this->aux_type              = src.aux_type;
+        this->aux_amax              = src.aux_amax;
+        this->residual              = src.residual;
+        this->residual_type         = src.residual_type;
+        this->ldr                   = src.ldr;
+        this->stride_r              = src.stride_r;
+        this->residual_position     = src.residual_position;
+        this->dropout               = src.dropout;
+        this->dropout_seed          = src.dropout_seed;
+        this->dropout_offset        = src.dropout_offset;
+        this->amax_history          = src.amax_history;
+        this->amax_history_length   = src.amax_history_length;
+        this->amax_history_index    = src.amax_history_index;
+        this->amax_history_scale    = src.amax_history_scale;
+        this->amax_history_margin   = src.amax_history_margin;
+        this->d2                    = src.d2;
+        this->d2_type               = src.d2_type;
+        this->ldd2                  = src.ldd2;
+        this->stride_d2             = src.stride_d2;
+        this->scaleD2               = src.scaleD2;
+        this->b_quant_scale         = src.b_quant_scale;
+        this->b_quant_zero          = src.b_quant_zero;
+        this->b_quant_group_size    = src.b_quant_group_size;
         this->compute_type          = src.compute_type;
         this->compute_type_original = src.compute_type_original;
         this->compute_input_typeA   = src.compute_input_typeA;
@@ -207,6 +207,7 @@ class LoggerSingleton
 public:
     std::ostream*           log_os         = nullptr;
     uint32_t                env_layer_mode = 0;
+    bool                    env_async      = false;
     static LoggerSingleton& getInstance()
     {
         static LoggerSingleton gInstance;
@@ -254,6 +255,10 @@ private:
             }
         }
 
+        // Format the log on a background thread
+        char* str_async = getenv("HIPBLASLT_LOG_ASYNC");
+        env_async       = str_async && atoi(str_async);
+
         // Open log file
         if(env_layer_mode != rocblaslt_layer_mode_none)
         {
@@ -393,6 +398,11 @@ void log_arguments_bench(std::ostream& os, T& x, Ts&&... xs)
         if(strlen(x) && strcmp(x, "invalid"))
             os << x << " ";
     }
+    else if constexpr(std::is_same_v<T, std::string>)
+    {
+        if(!x.empty() && x != "invalid")
+            os << x << " ";
+    }
     else
     {
         os << x << " ";
@@ -0,0 +1,273 @@
+/*! \file */
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCBLASLT_EPILOGUE_HPP
+#define ROCBLASLT_EPILOGUE_HPP
+
+#include "rocblaslt.h"
+
+#include <hip/hip_runtime_api.h>
+
+/*******************************************************************************
+ * Epilogues and operand scales that the GEMM kernels cannot apply run as a
+ * pass over the GEMM result, or over the operands before it, on the same stream.
+ * These are functional fallbacks, not fusions: each pass reads and writes the
+ * data once more than a kernel applying the work in its store would.
+ ******************************************************************************/
+
+/*******************************************************************************
+ * \brief D = act(gate) * up of a gated epilogue, where rows 2i and 2i+1 of the
+ * column major gemmD hold the gate and up values of row i of the m x n D.
+ ******************************************************************************/
+rocblaslt_status launchGatedActivation(rocblaslt_epilogue epilogue,
+                                       hipDataType        type,
+                                       void*              D,
+                                       const void*        gemmD,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            ldd,
+                                       int64_t            batchStrideD,
+                                       int64_t            ldGemm,
+                                       int64_t            batchStrideGemm,
+                                       int32_t            batchCount,
+                                       hipStream_t        stream);
+
+/*******************************************************************************
+ * \brief D = act(D + R) for the RELU and GELU epilogues, or D = D + R when
+ * activation is ROCBLASLT_EPILOGUE_DEFAULT, over column major m x n matrices.
+ ******************************************************************************/
+rocblaslt_status launchResidualAdd(rocblaslt_epilogue activation,
+                                   hipDataType        typeD,
+                                   void*              D,
+                                   int64_t            ldd,
+                                   int64_t            batchStrideD,
+                                   hipDataType        typeR,
+                                   const void*        R,
+                                   int64_t            ldr,
+                                   int64_t            batchStrideR,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   int32_t            batchCount,
+                                   hipStream_t        stream);
+
+/*******************************************************************************
+ * \brief Out = saturate(scale * In) over column major m x n matrices, where
+ * scale is a device vector with one float per row, or per column when
+ * scaleAlongN, or 1 when null. Out may be an int8 or FP8 type.
+ ******************************************************************************/
+rocblaslt_status launchScaleConvert(hipDataType  typeIn,
+                                    const void*  in,
+                                    int64_t      ldIn,
+                                    int64_t      batchStrideIn,
+                                    hipDataType  typeOut,
+                                    void*        out,
+                                    int64_t      ldOut,
+                                    int64_t      batchStrideOut,
+                                    const float* scale,
+                                    bool         scaleAlongN,
+                                    int64_t      m,
+                                    int64_t      n,
+                                    int32_t      batchCount,
+                                    hipStream_t  stream);
+
+/*******************************************************************************
+ * \brief Zeroes each element of the column major m x n D with probability
+ * dropout and scales the others by 1 / (1 - dropout). Element e, counted over
+ * the packed batches, takes value e % 4 of the Philox4x32-10 block e / 4 of
+ * the device seed and offset. The keep bits go to mask when it is not null,
+ * one 32-bit word per 32 rows of a column with ld and stride in words.
+ ******************************************************************************/
+rocblaslt_status launchDropout(hipDataType     type,
+                               void*           D,
+                               int64_t         ldd,
+                               int64_t         batchStrideD,
+                               uint32_t*       mask,
+                               int64_t         ldMask,
+                               int64_t         batchStrideMask,
+                               float           dropout,
+                               const uint64_t* seed,
+                               const uint64_t* offset,
+                               int64_t         m,
+                               int64_t         n,
+                               int32_t         batchCount,
+                               hipStream_t     stream);
+
+/*******************************************************************************
+ * \brief Stores amax into slot *index of the length long history, advances
+ * *index and sets *scale = maxOverMargin / max(history) when that maximum is
+ * positive and finite. One workgroup, so it costs a launch and no more.
+ ******************************************************************************/
+rocblaslt_status launchAmaxHistoryUpdate(const float* amax,
+                                         float*       history,
+                                         int32_t      length,
+                                         int32_t*     index,
+                                         float*       scale,
+                                         float        maxOverMargin,
+                                         hipStream_t  stream);
+
+/*******************************************************************************
+ * \brief Dequantizes the column major rows x cols operand In into a packed bf16
+ * Out before the GEMM. With blockScale, each element is scaled by the E8M0
+ * scale of its block of 32 along k, found at kBlock * scaleStrideK + mn *
+ * scaleStrideMN, where k runs along the rows when kAlongRows. Without it, the
+ * float at scale scales all elements, or 1 when null.
+ ******************************************************************************/
+rocblaslt_status launchBlockDequantize(hipDataType    typeIn,
+                                       const void*    in,
+                                       int64_t        ld,
+                                       int64_t        batchStride,
+                                       void*          out,
+                                       int64_t        rows,
+                                       int64_t        cols,
+                                       bool           kAlongRows,
+                                       const uint8_t* blockScale,
+                                       int64_t        scaleStrideK,
+                                       int64_t        scaleStrideMN,
+                                       int64_t        scaleBatchStride,
+                                       const float*   scale,
+                                       int32_t        batchCount,
+                                       hipStream_t    stream);
+
+/*******************************************************************************
+ * \brief Splits the f32 column major rows x cols operand In of a 3xBF16 GEMM
+ * into bf16 hi = bf16(x) and lo = bf16(x - hi), written as three packed blocks
+ * along k, where k runs along the rows when kAlongRows. Block loBlock holds
+ * lo and the other two hi, so the k of Out is three times that of In.
+ ******************************************************************************/
+rocblaslt_status launchSplitBf16(const float* in,
+                                 int64_t      ld,
+                                 int64_t      batchStride,
+                                 void*        out,
+                                 int64_t      rows,
+                                 int64_t      cols,
+                                 bool         kAlongRows,
+                                 int          loBlock,
+                                 int32_t      batchCount,
+                                 hipStream_t  stream);
+
+/*******************************************************************************
+ * \brief Dequantizes the int8 or packed int4 column major rows x cols operand
+ * In into a packed Out of the float type typeOut as (q - zero) * scale. Each
+ * group of groupSize elements along k shares a scale and zero point, stored
+ * as groups x mn column major per batch in the type of Out. Zero may be null.
+ ******************************************************************************/
+rocblaslt_status launchWeightDequantize(hipDataType typeIn,
+                                        const void* in,
+                                        int64_t     ld,
+                                        int64_t     batchStride,
+                                        hipDataType typeOut,
+                                        void*       out,
+                                        int64_t     rows,
+                                        int64_t     cols,
+                                        bool        kAlongRows,
+                                        const void* scale,
+                                        const void* zero,
+                                        int64_t     groupSize,
+                                        int32_t     batchCount,
+                                        hipStream_t stream);
+
+/*******************************************************************************
+ * \brief Out = saturate(In * scale), or In / scale when divideByScale, over
+ * column major m x n matrices, where scale is a device float or 1 when null.
+ * The amax of In goes to the device float amax when it is not null.
+ ******************************************************************************/
+rocblaslt_status launchAuxConvert(hipDataType  typeIn,
+                                  const void*  in,
+                                  int64_t      ldIn,
+                                  int64_t      batchStrideIn,
+                                  hipDataType  typeOut,
+                                  void*        out,
+                                  int64_t      ldOut,
+                                  int64_t      batchStrideOut,
+                                  const float* scale,
+                                  bool         divideByScale,
+                                  float*       amax,
+                                  int64_t      m,
+                                  int64_t      n,
+                                  int32_t      batchCount,
+                                  hipStream_t  stream);
+
+/*******************************************************************************
+ * \brief bias = the sums of the column major rows x cols In along its rows,
+ * one per column, or along its columns, one per row. The order of the sums is
+ * fixed by the sizes, so the result is deterministic, and no workspace is used.
+ ******************************************************************************/
+rocblaslt_status launchBiasGradient(hipDataType typeIn,
+                                    const void* in,
+                                    int64_t     ld,
+                                    int64_t     rows,
+                                    int64_t     cols,
+                                    bool        alongRows,
+                                    hipDataType typeBias,
+                                    void*       bias,
+                                    hipStream_t stream);
+
+/*******************************************************************************
+ * \brief Writes beta * C of the column major m x n C into the packed gemmC of
+ * its type, and zeros without reading C when beta is zero. alpha and beta are
+ * device floats; alphaVec, when not null, is filled with m copies of alpha.
+ ******************************************************************************/
+rocblaslt_status launchDeviceScalars(hipDataType  typeC,
+                                     const void*  C,
+                                     int64_t      ldc,
+                                     int64_t      batchStrideC,
+                                     void*        gemmC,
+                                     const float* alpha,
+                                     const float* beta,
+                                     float*       alphaVec,
+                                     int64_t      m,
+                                     int64_t      n,
+                                     int32_t      batchCount,
+                                     hipStream_t  stream);
+
+/*******************************************************************************
+ * \brief Atomically increments the device counter flag once the work before it
+ * on the stream is done, after a system scope fence that makes that work
+ * visible to kernels on other streams and devices that poll the counter.
+ ******************************************************************************/
+rocblaslt_status launchChunkSignal(uint32_t* flag, hipStream_t stream);
+
+/*******************************************************************************
+ * \brief Copies the column major rows x cols elements of elementBytes bytes of
+ * each batch from In to Out. Each side is either a device array of batch
+ * pointers, when batchIn or batchOut is not null, or a strided buffer.
+ ******************************************************************************/
+rocblaslt_status launchBatchCopy(size_t             elementBytes,
+                                 const void* const* batchIn,
+                                 const void*        in,
+                                 int64_t            ldIn,
+                                 int64_t            batchStrideIn,
+                                 void* const*       batchOut,
+                                 void*              out,
+                                 int64_t            ldOut,
+                                 int64_t            batchStrideOut,
+                                 int64_t            rows,
+                                 int64_t            cols,
+                                 int32_t            batchCount,
+                                 hipStream_t        stream);
+
+#endif // ROCBLASLT_EPILOGUE_HPP
@@ -29,6 +29,7 @@
 #define ROCBLASLT_UTILS_HPP
 #include "auxiliary.hpp"
 #include "handle.h"
+#include "tensile_host.hpp"
 #include "utility.hpp"
 
 inline rocblaslt_status getOriginalSizes(hipblasOperation_t opA,
@@ -137,6 +138,891 @@ inline rocblaslt_status validateMatmulDescrArgs(rocblaslt_handle       handle,
     return rocblaslt_status_success;
 }
 
+/*******************************************************************************
+ * Row-major A and B are the transposes of the column-major matrices that the
+ * kernels read, so their order folds into the operation and the transpose
+ * happens in the global-read stage instead of in a separate transform pass.
+ ******************************************************************************/
+inline hipblasOperation_t matmulKernelOp(hipblasOperation_t op, rocblaslt_matrix_layout mat)
+{
+    if(mat->order != HIPBLASLT_ORDER_ROW)
+        return op;
+    return op == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+}
+
+/*******************************************************************************
+ * A deterministic bias gradient runs the GEMM without the bias and reduces A,
+ * B or the DGELU result in D into the bias afterwards.
+ ******************************************************************************/
+inline bool is_bgrad_deterministic(const _rocblaslt_matmul_desc& desc)
+{
+    return desc.bgrad_deterministic && desc.bias && is_grad_enabled(desc.epilogue)
+           && desc.epilogue != ROCBLASLT_EPILOGUE_DGELU;
+}
+
+inline void bgradGemmProblem(const _rocblaslt_matmul_desc& desc, _rocblaslt_matmul_desc& gemmDesc)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data   = desc.m_data;
+    gemmDesc.bias     = nullptr;
+    gemmDesc.epilogue = ROCBLASLT_EPILOGUE_DEFAULT;
+    if(desc.epilogue == ROCBLASLT_EPILOGUE_DGELU_BGRAD)
+        gemmDesc.epilogue = ROCBLASLT_EPILOGUE_DGELU;
+}
+
+/*******************************************************************************
+ * A second output runs the GEMM with everything else into D and converts D into
+ * D2 afterwards.
+ ******************************************************************************/
+inline void dualOutputGemmProblem(const _rocblaslt_matmul_desc& desc,
+                                  _rocblaslt_matmul_desc&       gemmDesc)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data = desc.m_data;
+    gemmDesc.d2     = nullptr;
+}
+
+/*******************************************************************************
+ * An AUX of its own type, or with an amax, is stored by the GEMM in the type of
+ * D into a packed column major buffer that a pass converts into E afterwards.
+ * A DGELU epilogue reads a buffer that a pass converted from E before the GEMM.
+ ******************************************************************************/
+inline bool is_aux_convert_enabled(const _rocblaslt_matmul_desc&   desc,
+                                   const _rocblaslt_matrix_layout& matD)
+{
+    if(!is_e_enabled(desc.epilogue))
+        return false;
+    return (desc.aux_type != HIPBLASLT_DATATYPE_INVALID && desc.aux_type != matD.type)
+           || (desc.aux_amax && !is_grad_enabled(desc.epilogue));
+}
+
+inline void auxConvertGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                  const _rocblaslt_matrix_layout& matD,
+                                  _rocblaslt_matmul_desc&         gemmDesc)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data   = desc.m_data;
+    gemmDesc.aux_type = HIPBLASLT_DATATYPE_INVALID;
+    gemmDesc.aux_amax = nullptr;
+    gemmDesc.scaleE   = nullptr;
+    gemmDesc.lde      = matD.m;
+    gemmDesc.stride_e = matD.m * matD.n;
+}
+
+/*******************************************************************************
+ * A gated epilogue runs the GEMM without its activation into a packed column
+ * major buffer of the 2 * m x n gate/up rows, for a D of m x n, and gates the
+ * pairs of rows into D afterwards. Bias, C and the algo belong to that GEMM.
+ ******************************************************************************/
+inline void gatedGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                             const _rocblaslt_matrix_layout& matD,
+                             _rocblaslt_matmul_desc&         gemmDesc,
+                             _rocblaslt_matrix_layout&       gemmD)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data    = desc.m_data;
+    gemmDesc.epilogue  = is_bias_enabled(desc.epilogue) ? ROCBLASLT_EPILOGUE_BIAS
+                                                        : ROCBLASLT_EPILOGUE_DEFAULT;
+    gemmD              = matD;
+    gemmD.m            = 2 * matD.m;
+    gemmD.ld           = gemmD.m;
+    gemmD.batch_stride = gemmD.ld * gemmD.n;
+    gemmD.order        = HIPBLASLT_ORDER_COL;
+}
+
+/*******************************************************************************
+ * A residual runs the GEMM into D and adds R to it afterwards. When R goes
+ * before the activation, the GEMM keeps only the bias and the pass activates.
+ ******************************************************************************/
+inline void residualGemmProblem(const _rocblaslt_matmul_desc& desc,
+                                _rocblaslt_matmul_desc&       gemmDesc)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data   = desc.m_data;
+    gemmDesc.residual = nullptr;
+    if(desc.residual_position == rocblaslt_residual_before_activation)
+        gemmDesc.epilogue = is_bias_enabled(desc.epilogue) ? ROCBLASLT_EPILOGUE_BIAS
+                                                           : ROCBLASLT_EPILOGUE_DEFAULT;
+}
+
+/*******************************************************************************
+ * A dropout runs the GEMM with its whole epilogue into D and drops elements of
+ * D afterwards. The AUX pointer, when set, receives the mask instead.
+ ******************************************************************************/
+inline void dropoutGemmProblem(const _rocblaslt_matmul_desc& desc,
+                               _rocblaslt_matmul_desc&       gemmDesc)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data   = desc.m_data;
+    gemmDesc.dropout  = 0.f;
+    gemmDesc.e        = nullptr;
+    gemmDesc.lde      = 0;
+    gemmDesc.stride_e = 0;
+}
+
+/*******************************************************************************
+ * A vector scale of D runs the GEMM unscaled into a packed column major fp32
+ * (int32 for integer compute) buffer that is also its C, and scales and
+ * converts that buffer into D afterwards.
+ ******************************************************************************/
+inline void scaleDVecGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                 const _rocblaslt_matrix_layout& matD,
+                                 _rocblaslt_matmul_desc&         gemmDesc,
+                                 _rocblaslt_matrix_layout&       gemmCD)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data          = desc.m_data;
+    gemmDesc.scaleD          = nullptr;
+    gemmDesc.isScaleDVec     = false;
+    gemmDesc.scaleDVecAlongN = false;
+    gemmCD                   = matD;
+    gemmCD.type         = desc.compute_type == rocblaslt_compute_i32 ? HIP_R_32I : HIP_R_32F;
+    gemmCD.ld           = gemmCD.m;
+    gemmCD.batch_stride = gemmCD.ld * gemmCD.n;
+    gemmCD.order        = HIPBLASLT_ORDER_COL;
+}
+
+/*******************************************************************************
+ * An amax history runs the GEMM with its amaxD and rolls the amax into the
+ * history afterwards.
+ ******************************************************************************/
+inline void amaxHistoryGemmProblem(const _rocblaslt_matmul_desc& desc,
+                                   _rocblaslt_matmul_desc&       gemmDesc)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data       = desc.m_data;
+    gemmDesc.amax_history = nullptr;
+}
+
+/*******************************************************************************
+ * Block scaled A or B are dequantized into packed bf16 copies of their layouts,
+ * which is exact for FP8 elements and power of two scales, and the GEMM runs on
+ * those in fp32 without the A and B scales.
+ ******************************************************************************/
+inline void blockScaledGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                   const _rocblaslt_matrix_layout& matA,
+                                   const _rocblaslt_matrix_layout& matB,
+                                   _rocblaslt_matmul_desc&         gemmDesc,
+                                   _rocblaslt_matrix_layout&       gemmA,
+                                   _rocblaslt_matrix_layout&       gemmB)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data              = desc.m_data;
+    gemmDesc.scaleA              = nullptr;
+    gemmDesc.scaleB              = nullptr;
+    gemmDesc.isScaleAVec         = false;
+    gemmDesc.isScaleBVec         = false;
+    gemmDesc.isScaleABlock       = false;
+    gemmDesc.isScaleBBlock       = false;
+    gemmDesc.compute_input_typeA = HIP_R_16BF;
+    gemmDesc.compute_input_typeB = HIP_R_16BF;
+    gemmDesc.compute_type        = desc.compute_type_original;
+    gemmA                        = matA;
+    gemmA.type                   = HIP_R_16BF;
+    gemmA.ld                     = gemmA.m;
+    gemmA.batch_stride           = gemmA.ld * gemmA.n;
+    gemmB                        = matB;
+    gemmB.type                   = HIP_R_16BF;
+    gemmB.ld                     = gemmB.m;
+    gemmB.batch_stride           = gemmB.ld * gemmB.n;
+}
+
+/*******************************************************************************
+ * The f32 A and B of the 3xBF16 compute type are split into hi and lo bf16
+ * parts, packed as op(A) = [hi hi lo] and op(B) = [hi lo hi] along k in their
+ * own orientation, and the GEMM over three times k runs on those in fp32.
+ ******************************************************************************/
+inline void splitBf16GemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                 const _rocblaslt_matrix_layout& matA,
+                                 const _rocblaslt_matrix_layout& matB,
+                                 _rocblaslt_matmul_desc&         gemmDesc,
+                                 _rocblaslt_matrix_layout&       gemmA,
+                                 _rocblaslt_matrix_layout&       gemmB)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data                = desc.m_data;
+    gemmDesc.compute_input_typeA   = HIP_R_16BF;
+    gemmDesc.compute_input_typeB   = HIP_R_16BF;
+    gemmDesc.compute_type          = rocblaslt_compute_f32;
+    gemmDesc.compute_type_original = rocblaslt_compute_f32;
+    gemmA                          = matA;
+    gemmA.type                     = HIP_R_16BF;
+    (desc.op_A == HIPBLAS_OP_N ? gemmA.n : gemmA.m) *= 3;
+    gemmA.ld           = gemmA.m;
+    gemmA.batch_stride = gemmA.ld * gemmA.n;
+    gemmB              = matB;
+    gemmB.type         = HIP_R_16BF;
+    (desc.op_B == HIPBLAS_OP_N ? gemmB.m : gemmB.n) *= 3;
+    gemmB.ld           = gemmB.m;
+    gemmB.batch_stride = gemmB.ld * gemmB.n;
+}
+
+/*******************************************************************************
+ * A weight-only quantized B is dequantized into a packed copy of its layout in
+ * the type of A, and the GEMM runs on that without the group scales.
+ ******************************************************************************/
+inline void weightOnlyGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                  const _rocblaslt_matrix_layout& matA,
+                                  const _rocblaslt_matrix_layout& matB,
+                                  _rocblaslt_matmul_desc&         gemmDesc,
+                                  _rocblaslt_matrix_layout&       gemmB)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data             = desc.m_data;
+    gemmDesc.b_quant_scale      = nullptr;
+    gemmDesc.b_quant_zero       = nullptr;
+    gemmDesc.b_quant_group_size = 0;
+    gemmB                       = matB;
+    gemmB.type                  = matA.type;
+    gemmB.ld                    = gemmB.m;
+    gemmB.batch_stride          = gemmB.ld * gemmB.n;
+}
+
+/*******************************************************************************
+ * Pointer array batches are gathered into packed strided copies of their
+ * matrices before the GEMM, and a pointer array D is scattered from its copy
+ * afterwards. The strided matrices are used as they are.
+ ******************************************************************************/
+inline bool is_pointer_array(const _rocblaslt_matrix_layout& mat)
+{
+    return mat.batch_mode == HIPBLASLT_BATCH_MODE_POINTER_ARRAY;
+}
+
+inline void pointerArrayLayout(const _rocblaslt_matrix_layout& mat,
+                               _rocblaslt_matrix_layout&       gemmMat)
+{
+    gemmMat = mat;
+    if(!is_pointer_array(mat))
+        return;
+    gemmMat.batch_mode   = HIPBLASLT_BATCH_MODE_STRIDED;
+    gemmMat.ld           = mat.order == HIPBLASLT_ORDER_ROW ? mat.n : mat.m;
+    gemmMat.batch_stride = mat.m * mat.n;
+}
+
+inline void pointerArrayGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                    const _rocblaslt_matrix_layout& matA,
+                                    const _rocblaslt_matrix_layout& matB,
+                                    const _rocblaslt_matrix_layout& matC,
+                                    const _rocblaslt_matrix_layout& matD,
+                                    _rocblaslt_matmul_desc&         gemmDesc,
+                                    _rocblaslt_matrix_layout&       gemmA,
+                                    _rocblaslt_matrix_layout&       gemmB,
+                                    _rocblaslt_matrix_layout&       gemmC,
+                                    _rocblaslt_matrix_layout&       gemmD)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data = desc.m_data;
+    pointerArrayLayout(matA, gemmA);
+    pointerArrayLayout(matB, gemmB);
+    pointerArrayLayout(matC, gemmC);
+    pointerArrayLayout(matD, gemmD);
+}
+
+/*******************************************************************************
+ * A two-level batch of outer_batch_count batches of batch_count matrices is a
+ * single level of outer * inner batches when every matrix steps through its
+ * inner batches and on to the next outer batch with one stride, or likewise
+ * through the outer batches first. Otherwise the GEMM runs once per batch of
+ * the smaller level, batched over the other level at an offset into each
+ * matrix, which is the GEMM set up here.
+ ******************************************************************************/
+inline bool is_nested_batch(const _rocblaslt_matrix_layout& mat)
+{
+    return mat.outer_batch_count != 1;
+}
+
+enum class NestedBatch
+{
+    InnerFirst,
+    OuterFirst,
+    LoopOuter,
+    LoopInner
+};
+
+inline NestedBatch nestedBatchPlan(const _rocblaslt_matrix_layout& matA,
+                                   const _rocblaslt_matrix_layout& matB,
+                                   const _rocblaslt_matrix_layout& matC,
+                                   const _rocblaslt_matrix_layout& matD)
+{
+    const int64_t outer = matD.outer_batch_count;
+    const int64_t inner = matD.batch_count;
+    auto          flat  = [&](bool innerFirst) {
+        if(outer * inner > INT32_MAX)
+            return false;
+        for(auto* mat : {&matA, &matB, &matC, &matD})
+        {
+            if(innerFirst ? inner > 1 && mat->outer_batch_stride != mat->batch_stride * inner
+                          : mat->batch_stride != mat->outer_batch_stride * outer)
+                return false;
+        }
+        return true;
+    };
+
+    if(flat(true))
+        return NestedBatch::InnerFirst;
+    if(flat(false))
+        return NestedBatch::OuterFirst;
+    return outer <= inner ? NestedBatch::LoopOuter : NestedBatch::LoopInner;
+}
+
+inline void nestedBatchLayout(const _rocblaslt_matrix_layout& mat,
+                              NestedBatch                     plan,
+                              _rocblaslt_matrix_layout&       gemmMat)
+{
+    gemmMat = mat;
+    switch(plan)
+    {
+    case NestedBatch::InnerFirst:
+        gemmMat.batch_count *= mat.outer_batch_count;
+        if(mat.batch_count == 1)
+            gemmMat.batch_stride = mat.outer_batch_stride;
+        break;
+    case NestedBatch::OuterFirst:
+        gemmMat.batch_count *= mat.outer_batch_count;
+        gemmMat.batch_stride = mat.outer_batch_stride;
+        break;
+    case NestedBatch::LoopOuter:
+        break;
+    case NestedBatch::LoopInner:
+        gemmMat.batch_count  = mat.outer_batch_count;
+        gemmMat.batch_stride = mat.outer_batch_stride;
+        break;
+    }
+    gemmMat.outer_batch_count  = 1;
+    gemmMat.outer_batch_stride = 0;
+}
+
+inline void nestedBatchGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                   const _rocblaslt_matrix_layout& matA,
+                                   const _rocblaslt_matrix_layout& matB,
+                                   const _rocblaslt_matrix_layout& matC,
+                                   const _rocblaslt_matrix_layout& matD,
+                                   _rocblaslt_matmul_desc&         gemmDesc,
+                                   _rocblaslt_matrix_layout&       gemmA,
+                                   _rocblaslt_matrix_layout&       gemmB,
+                                   _rocblaslt_matrix_layout&       gemmC,
+                                   _rocblaslt_matrix_layout&       gemmD)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data = desc.m_data;
+    const auto plan = nestedBatchPlan(matA, matB, matC, matD);
+    nestedBatchLayout(matA, plan, gemmA);
+    nestedBatchLayout(matB, plan, gemmB);
+    nestedBatchLayout(matC, plan, gemmC);
+    nestedBatchLayout(matD, plan, gemmD);
+}
+
+/*******************************************************************************
+ * The outer level is strided and shared by all matrices. The work before and
+ * after a looped GEMM that spans all batches or that writes to buffers of its
+ * own, the aux, residual, second output, amax and dropout, is not repeated.
+ ******************************************************************************/
+inline rocblaslt_status validateNestedBatch(const _rocblaslt_matmul_desc&   desc,
+                                            const _rocblaslt_matrix_layout& matA,
+                                            const _rocblaslt_matrix_layout& matB,
+                                            const _rocblaslt_matrix_layout& matC,
+                                            const _rocblaslt_matrix_layout& matD)
+{
+    for(auto* mat : {&matA, &matB, &matC, &matD})
+    {
+        if(mat->outer_batch_count < 1 || mat->outer_batch_count != matD.outer_batch_count)
+        {
+            log_error(__func__, "invalid args", "outer batch counts", mat->outer_batch_count);
+            return rocblaslt_status_invalid_size;
+        }
+        if(is_pointer_array(*mat) || mat->type == HIP_R_4I)
+        {
+            log_error(__func__, "invalid args", "outer batches of pointer arrays or int4");
+            return rocblaslt_status_not_implemented;
+        }
+    }
+
+    const auto plan = nestedBatchPlan(matA, matB, matC, matD);
+    if((plan == NestedBatch::LoopOuter || plan == NestedBatch::LoopInner)
+       && (desc.e || desc.residual || desc.d2 || desc.amaxD || desc.aux_amax || desc.amax_history
+           || desc.dropout > 0.f || desc.completion_flags || is_grad_enabled(desc.epilogue)))
+    {
+        log_error(__func__,
+                  "invalid args",
+                  "outer batches that do not flatten with aux, residual, D2, amax, dropout, "
+                  "completion flags or gradients");
+        return rocblaslt_status_not_implemented;
+    }
+    return rocblaslt_status_continue;
+}
+
+inline bool isFp8DataType(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8F_E4M3_FNUZ:
+    case HIP_R_8F_E5M2_FNUZ:
+#ifdef ROCM_USE_FLOAT8
+    case HIP_R_8F_E4M3:
+    case HIP_R_8F_E5M2:
+#endif
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*******************************************************************************
+ * Device alpha and beta are never read on the host. A pass before the GEMM
+ * writes beta * C into a packed copy of C, zeros without reading C when beta is
+ * zero, and the GEMM adds the copy with a host beta of one. Alpha becomes the
+ * scale of an FP8 A or B that has none, as FP8 problems carry those scales
+ * anyway, and otherwise an alpha vector of m copies that the pass fills. Both
+ * are float, which limits this to the f32 compute types.
+ ******************************************************************************/
+inline bool deviceScalarsSupported(const _rocblaslt_matmul_desc&   desc,
+                                   const _rocblaslt_matrix_layout& matC)
+{
+    switch(desc.compute_type)
+    {
+    case rocblaslt_compute_f16:
+    case rocblaslt_compute_f16_pedantic:
+    case rocblaslt_compute_f64:
+    case rocblaslt_compute_f64_pedantic:
+    case rocblaslt_compute_i32:
+    case rocblaslt_compute_i32_pedantic:
+        return false;
+    default:
+        break;
+    }
+    return !is_pointer_array(matC) && !is_nested_batch(matC);
+}
+
+inline void deviceScalarGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                    const _rocblaslt_matrix_layout& matA,
+                                    const _rocblaslt_matrix_layout& matB,
+                                    const _rocblaslt_matrix_layout& matC,
+                                    const void*                     alpha,
+                                    _rocblaslt_matmul_desc&         gemmDesc,
+                                    _rocblaslt_matrix_layout&       gemmC)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data      = desc.m_data;
+    gemmDesc.pointermode = rocblaslt_pointer_mode_host;
+    if(isFp8DataType(matA.type) && !desc.scaleA && !desc.isScaleAVec && !desc.isScaleABlock)
+        gemmDesc.scaleA = const_cast<void*>(alpha);
+    else if(isFp8DataType(matB.type) && !desc.scaleB && !desc.isScaleBVec && !desc.isScaleBBlock)
+        gemmDesc.scaleB = const_cast<void*>(alpha);
+    else
+        gemmDesc.pointermode = rocblaslt_pointer_mode_alpha_device_vector_beta_host;
+    gemmC              = matC;
+    gemmC.ld           = gemmC.m;
+    gemmC.batch_stride = gemmC.ld * gemmC.n;
+}
+
+/*******************************************************************************
+ * Completion flags run the GEMM in chunks of columns of D, one chunk after the
+ * other, and bump the counter of a chunk once it is stored. Every chunk but the
+ * last has the width of the first, which is the GEMM set up here.
+ ******************************************************************************/
+inline int64_t completionChunkCols(const _rocblaslt_matmul_desc&   desc,
+                                   const _rocblaslt_matrix_layout& matD)
+{
+    const int64_t n = matD.n;
+    return desc.completion_cols > 0 ? std::min<int64_t>(desc.completion_cols, n) : n;
+}
+
+inline void completionGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                  const _rocblaslt_matrix_layout& matB,
+                                  const _rocblaslt_matrix_layout& matC,
+                                  const _rocblaslt_matrix_layout& matD,
+                                  int64_t                         cols,
+                                  _rocblaslt_matmul_desc&         gemmDesc,
+                                  _rocblaslt_matrix_layout&       gemmB,
+                                  _rocblaslt_matrix_layout&       gemmC,
+                                  _rocblaslt_matrix_layout&       gemmD)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data           = desc.m_data;
+    gemmDesc.completion_flags = nullptr;
+    gemmDesc.completion_cols  = 0;
+    gemmB                     = matB;
+    gemmC                     = matC;
+    gemmD                     = matD;
+    if(desc.op_B == HIPBLAS_OP_N)
+        gemmB.n = cols;
+    else
+        gemmB.m = cols;
+    gemmC.n = cols;
+    gemmD.n = cols;
+}
+
+/*******************************************************************************
+ * A batched GEMM whose A is broadcast, with a batch stride of 0, is one GEMM
+ * with the batches side by side along n when B, C and D store the columns of
+ * each batch right after those of the previous one. Likewise along m for a
+ * broadcast B when A, C and D store the rows of the batches one after the
+ * other. The single GEMM reads each tile of the shared operand once per row or
+ * column of tiles instead of once per batch.
+ ******************************************************************************/
+enum class BatchFold
+{
+    None,
+    AlongM,
+    AlongN
+};
+
+inline BatchFold broadcastBatchFold(const _rocblaslt_matmul_desc&   desc,
+                                    const _rocblaslt_matrix_layout& matA,
+                                    const _rocblaslt_matrix_layout& matB,
+                                    const _rocblaslt_matrix_layout& matC,
+                                    const _rocblaslt_matrix_layout& matD)
+{
+    const int64_t batch = matD.batch_count;
+    const int64_t m     = matD.m;
+    const int64_t n     = matD.n;
+    if(batch <= 1 || is_grad_enabled(desc.epilogue) || is_e_enabled(desc.epilogue)
+       || matA.sparsity != HIPBLASLT_SPARSITY_DENSE)
+        return BatchFold::None;
+
+    // The batches of an operand follow each other along its m or n when that
+    // dimension strides by ld and the batch stride is ld times its size, or when it
+    // is contiguous, the batch stride is its size and ld leaves room for them all
+    auto followOn = [batch](int64_t size, bool alongLd, int64_t ld, int64_t batchStride) {
+        return alongLd ? batchStride == ld * size : batchStride == size && ld >= size * batch;
+    };
+
+    if(matA.batch_stride == 0 && !desc.isScaleBVec && !desc.scaleDVecAlongN
+       && followOn(n, (desc.op_B == HIPBLAS_OP_N) == (matB.order == HIPBLASLT_ORDER_COL),
+                   matB.ld, matB.batch_stride)
+       && followOn(n, true, matC.ld, matC.batch_stride)
+       && followOn(n, true, matD.ld, matD.batch_stride))
+        return BatchFold::AlongN;
+
+    if(matB.batch_stride == 0 && !desc.isScaleAVec && !desc.isScaleDVec
+       && !is_bias_enabled(desc.epilogue)
+       && desc.pointermode != rocblaslt_pointer_mode_alpha_device_vector_beta_host
+       && followOn(m, (desc.op_A == HIPBLAS_OP_N) == (matA.order == HIPBLASLT_ORDER_ROW),
+                   matA.ld, matA.batch_stride)
+       && followOn(m, false, matC.ld, matC.batch_stride)
+       && followOn(m, false, matD.ld, matD.batch_stride))
+        return BatchFold::AlongM;
+
+    return BatchFold::None;
+}
+
+inline void broadcastGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                                 const _rocblaslt_matrix_layout& matA,
+                                 const _rocblaslt_matrix_layout& matB,
+                                 const _rocblaslt_matrix_layout& matC,
+                                 const _rocblaslt_matrix_layout& matD,
+                                 BatchFold                       fold,
+                                 _rocblaslt_matmul_desc&         gemmDesc,
+                                 _rocblaslt_matrix_layout&       gemmA,
+                                 _rocblaslt_matrix_layout&       gemmB,
+                                 _rocblaslt_matrix_layout&       gemmC,
+                                 _rocblaslt_matrix_layout&       gemmD)
+{
+    gemmDesc.copy(desc);
+    gemmDesc.m_data = desc.m_data;
+    gemmA           = matA;
+    gemmB           = matB;
+    gemmC           = matC;
+    gemmD           = matD;
+
+    const int32_t batch = matD.batch_count;
+    if(fold == BatchFold::AlongN)
+    {
+        (desc.op_B == HIPBLAS_OP_N ? gemmB.n : gemmB.m) *= batch;
+        gemmC.n *= batch;
+        gemmD.n *= batch;
+    }
+    else
+    {
+        (desc.op_A == HIPBLAS_OP_N ? gemmA.m : gemmA.n) *= batch;
+        gemmC.m *= batch;
+        gemmD.m *= batch;
+    }
+    for(auto* mat : {&gemmA, &gemmB, &gemmC, &gemmD})
+    {
+        mat->batch_count  = 1;
+        mat->batch_stride = 0;
+    }
+}
+
+/*******************************************************************************
+ * The buffers of work before or after the GEMM are taken from the front of the
+ * workspace, each at a multiple of 256 bytes as the kernels expect, and the
+ * GEMM gets the rest of the workspace.
+ ******************************************************************************/
+inline size_t alignedWorkspaceBytes(size_t bytes)
+{
+    return (bytes + 255) / 256 * 256;
+}
+
+inline size_t hipDataTypeBytes(hipDataType type)
+{
+    return TensileLite::DataTypeInfo::Get(hipDataType_to_tensile_type(type)).elementSize;
+}
+
+inline size_t layoutWorkspaceBytes(const _rocblaslt_matrix_layout& mat, size_t elementBytes)
+{
+    return alignedWorkspaceBytes(size_t(mat.batch_stride) * mat.batch_count * elementBytes);
+}
+
+// The alpha vector, when alpha needs one, of alphaBytes followed by the copy of C
+inline size_t deviceScalarWorkspaceBytes(const _rocblaslt_matmul_desc&   gemmDesc,
+                                         const _rocblaslt_matrix_layout& gemmC,
+                                         size_t*                         alphaBytes = nullptr)
+{
+    const size_t vecBytes
+        = gemmDesc.pointermode == rocblaslt_pointer_mode_alpha_device_vector_beta_host
+              ? alignedWorkspaceBytes(size_t(gemmC.m) * sizeof(float))
+              : 0;
+    if(alphaBytes)
+        *alphaBytes = vecBytes;
+    return vecBytes + layoutWorkspaceBytes(gemmC, hipDataTypeBytes(gemmC.type));
+}
+
+// Sized for an fp32 D, the widest type the GEMM stores E in
+inline size_t auxConvertWorkspaceBytes(const _rocblaslt_matmul_desc&   gemmDesc,
+                                       const _rocblaslt_matrix_layout& matD)
+{
+    return alignedWorkspaceBytes(size_t(gemmDesc.stride_e) * matD.batch_count * 4);
+}
+
+/*******************************************************************************
+ * The packed buffers of the pointer array batches, at offsets into the bytes
+ * returned. C has none when it is the pointer array of D, and int4 has none as
+ * it is not gathered.
+ ******************************************************************************/
+inline size_t pointerArrayWorkspaceBytes(const _rocblaslt_matrix_layout* const mats[4],
+                                         const _rocblaslt_matrix_layout        gemm[4],
+                                         bool                                  sharedCD,
+                                         size_t                                elementBytes[4],
+                                         size_t                                offsets[4])
+{
+    size_t bytes = 0;
+    for(int i = 0; i < 4; i++)
+    {
+        elementBytes[i] = 0;
+        offsets[i]      = bytes;
+        if(!is_pointer_array(*mats[i]) || (i == 2 && sharedCD) || mats[i]->type == HIP_R_4I)
+            continue;
+        elementBytes[i] = hipDataTypeBytes(mats[i]->type);
+        bytes += layoutWorkspaceBytes(gemm[i], elementBytes[i]);
+    }
+    return bytes;
+}
+
+/*******************************************************************************
+ * The GEMM of a descriptor with work before or after the GEMM, which is what
+ * heuristics and algo checks see. Returns false if there is none. Each step
+ * removes one kind of work, so callers repeat until it returns false.
+ * workspaceBytes, when set, receives the workspace the step takes in front of
+ * the workspace of its GEMM.
+ ******************************************************************************/
+inline bool innerGemmProblem(const _rocblaslt_matmul_desc&   desc,
+                             const _rocblaslt_matrix_layout& matA,
+                             const _rocblaslt_matrix_layout& matB,
+                             const _rocblaslt_matrix_layout& matC,
+                             const _rocblaslt_matrix_layout& matD,
+                             _rocblaslt_matmul_desc&         gemmDesc,
+                             _rocblaslt_matrix_layout&       gemmA,
+                             _rocblaslt_matrix_layout&       gemmB,
+                             _rocblaslt_matrix_layout&       gemmC,
+                             _rocblaslt_matrix_layout&       gemmD,
+                             size_t*                         workspaceBytes = nullptr)
+{
+    size_t bytes = 0;
+    gemmA        = matA;
+    gemmB        = matB;
+    gemmC        = matC;
+    gemmD        = matD;
+    // Only whether the scales are set shapes the problem, not where they point
+    if(desc.pointermode == rocblaslt_pointer_mode_device)
+    {
+        deviceScalarGemmProblem(desc, matA, matB, matC, &desc, gemmDesc, gemmC);
+        bytes = deviceScalarWorkspaceBytes(gemmDesc, gemmC);
+    }
+    else if(is_nested_batch(matD))
+        nestedBatchGemmProblem(desc, matA, matB, matC, matD, gemmDesc, gemmA, gemmB, gemmC, gemmD);
+    else if(is_pointer_array(matA) || is_pointer_array(matB) || is_pointer_array(matC)
+            || is_pointer_array(matD))
+    {
+        pointerArrayGemmProblem(desc, matA, matB, matC, matD, gemmDesc, gemmA, gemmB, gemmC, gemmD);
+        // C may turn out to be the pointer array of D, which takes less
+        const _rocblaslt_matrix_layout* mats[4] = {&matA, &matB, &matC, &matD};
+        const _rocblaslt_matrix_layout  gemm[4] = {gemmA, gemmB, gemmC, gemmD};
+        size_t                          elementBytes[4], offsets[4];
+        bytes = pointerArrayWorkspaceBytes(mats, gemm, false, elementBytes, offsets);
+    }
+    else if(desc.completion_flags)
+        completionGemmProblem(
+            desc, matB, matC, matD, completionChunkCols(desc, matD), gemmDesc, gemmB, gemmC, gemmD);
+    else if(desc.compute_type == rocblaslt_compute_f32_fast_3xbf16)
+    {
+        splitBf16GemmProblem(desc, matA, matB, gemmDesc, gemmA, gemmB);
+        bytes = layoutWorkspaceBytes(gemmA, 2) + layoutWorkspaceBytes(gemmB, 2);
+    }
+    else if(desc.isScaleABlock || desc.isScaleBBlock)
+    {
+        blockScaledGemmProblem(desc, matA, matB, gemmDesc, gemmA, gemmB);
+        bytes = layoutWorkspaceBytes(gemmA, 2) + layoutWorkspaceBytes(gemmB, 2);
+    }
+    else if(desc.b_quant_scale)
+    {
+        weightOnlyGemmProblem(desc, matA, matB, gemmDesc, gemmB);
+        bytes = layoutWorkspaceBytes(gemmB, 2);
+    }
+    else if(is_bgrad_deterministic(desc))
+        bgradGemmProblem(desc, gemmDesc);
+    else if(desc.d2)
+        dualOutputGemmProblem(desc, gemmDesc);
+    else if(is_aux_convert_enabled(desc, matD))
+    {
+        auxConvertGemmProblem(desc, matD, gemmDesc);
+        bytes = auxConvertWorkspaceBytes(gemmDesc, matD);
+    }
+    else if(is_gated_enabled(desc.epilogue))
+    {
+        gatedGemmProblem(desc, matD, gemmDesc, gemmD);
+        bytes = layoutWorkspaceBytes(gemmD, hipDataTypeBytes(gemmD.type));
+    }
+    else if(desc.dropout > 0.f)
+        dropoutGemmProblem(desc, gemmDesc);
+    else if(desc.isScaleDVec && desc.scaleD)
+    {
+        scaleDVecGemmProblem(desc, matD, gemmDesc, gemmD);
+        gemmC = gemmD;
+        bytes = layoutWorkspaceBytes(gemmD, 4);
+    }
+    else if(desc.residual)
+        residualGemmProblem(desc, gemmDesc);
+    else if(desc.amax_history)
+        amaxHistoryGemmProblem(desc, gemmDesc);
+    else if(auto fold = broadcastBatchFold(desc, matA, matB, matC, matD); fold != BatchFold::None)
+        broadcastGemmProblem(
+            desc, matA, matB, matC, matD, fold, gemmDesc, gemmA, gemmB, gemmC, gemmD);
+    else
+        return false;
+    if(workspaceBytes)
+        *workspaceBytes = bytes;
+    return true;
+}
+
+/*******************************************************************************
+ * The workspace all the work before or after the GEMM of a descriptor takes in
+ * front of the workspace of the GEMM.
+ ******************************************************************************/
+inline size_t passWorkspaceBytes(const _rocblaslt_matmul_desc&   desc,
+                                 const _rocblaslt_matrix_layout& matA,
+                                 const _rocblaslt_matrix_layout& matB,
+                                 const _rocblaslt_matrix_layout& matC,
+                                 const _rocblaslt_matrix_layout& matD)
+{
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmA, gemmB, gemmC, gemmD;
+    size_t                   bytes = 0;
+    if(!innerGemmProblem(
+           desc, matA, matB, matC, matD, gemmDesc, gemmA, gemmB, gemmC, gemmD, &bytes))
+        return 0;
+    return bytes + passWorkspaceBytes(gemmDesc, gemmA, gemmB, gemmC, gemmD);
+}
+
+/*******************************************************************************
+ * A and B may be column or row major. The kernels write column-major C and D,
+ * and the tiled orders are produced and consumed by matrix transform only.
+ ******************************************************************************/
+inline rocblaslt_status validateMatmulOrders(rocblaslt_matrix_layout matA,
+                                             rocblaslt_matrix_layout matB,
+                                             rocblaslt_matrix_layout matC,
+                                             rocblaslt_matrix_layout matD)
+{
+    for(auto mat : {matA, matB})
+    {
+        if(mat->order != HIPBLASLT_ORDER_COL && mat->order != HIPBLASLT_ORDER_ROW)
+        {
+            log_error(__func__, "invalid args", "unsupported order of A or B", mat->order);
+            return rocblaslt_status_not_implemented;
+        }
+    }
+
+    for(auto mat : {matC, matD})
+    {
+        if(mat->order != HIPBLASLT_ORDER_COL)
+        {
+            log_error(__func__, "invalid args", "unsupported order of C or D", mat->order);
+            return rocblaslt_status_not_implemented;
+        }
+    }
+
+    return rocblaslt_status_continue;
+}
+
+/*******************************************************************************
+ * A 2:4 compressed A is read by the sparse solutions as it is, so none of the
+ * passes that rewrite or reduce A apply to it. The metadata holds one byte per 8
+ * elements along k and is only needed to run the GEMM.
+ ******************************************************************************/
+inline rocblaslt_status validateSparseA(const _rocblaslt_matmul_desc&   desc,
+                                        const _rocblaslt_matrix_layout& matA,
+                                        bool                            needMetadata)
+{
+    if(matA.sparsity == HIPBLASLT_SPARSITY_DENSE)
+        return rocblaslt_status_continue;
+
+    if(matA.sparsity != HIPBLASLT_SPARSITY_2_4_COMPRESSED)
+    {
+        log_error(__func__, "invalid args", "unknown sparsity of A", matA.sparsity);
+        return rocblaslt_status_invalid_value;
+    }
+    if(matA.order != HIPBLASLT_ORDER_COL || is_pointer_array(matA) || desc.isScaleABlock
+       || desc.isScaleBBlock || desc.epilogue == ROCBLASLT_EPILOGUE_BGRADA)
+    {
+        log_error(__func__, "invalid args", "compressed A needs a plain column-major A");
+        return rocblaslt_status_not_implemented;
+    }
+    if(matA.type != HIP_R_16F && matA.type != HIP_R_16BF && matA.type != HIP_R_8I
+       && matA.type != HIP_R_8F_E4M3_FNUZ && matA.type != HIP_R_8F_E5M2_FNUZ)
+    {
+        log_error(__func__, "invalid args", "unsupported type of compressed A", matA.type);
+        return rocblaslt_status_not_implemented;
+    }
+
+    int64_t k = desc.op_A == HIPBLAS_OP_N ? matA.n : matA.m;
+    if(k % 8 != 0)
+    {
+        log_error(__func__, "invalid args", "k of compressed A must be a multiple of 8", k);
+        return rocblaslt_status_invalid_value;
+    }
+    if(needMetadata && !desc.sparse_metadata_a)
+    {
+        log_error(__func__, "invalid args", "compressed A without metadata");
+        return rocblaslt_status_invalid_pointer;
+    }
+
+    return rocblaslt_status_continue;
+}
+
+// The types hip_datatype_to_string() names, without the round trip through a string
+constexpr bool isMatmulDataType(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+    case HIP_R_64F:
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_R_8I:
+    case HIP_R_32I:
+    case HIP_R_8F_E4M3_FNUZ:
+    case HIP_R_8F_E5M2_FNUZ:
+#ifdef ROCM_USE_FLOAT8
+    case HIP_R_8F_E4M3:
+    case HIP_R_8F_E5M2:
+#endif
+        return true;
+    default:
+        return false;
+    }
+}
+
 /*******************************************************************************
  * Validate Matmul Arguments
  ******************************************************************************/
@@ -172,14 +1058,15 @@ inline rocblaslt_status validateMatmulArgs(int64_t                       m,
     if(!(type_a == HIP_R_32F && type_b == HIP_R_32F && type_c == HIP_R_32F && type_d == HIP_R_32F)
        && compute_type == rocblaslt_compute_f32_fast_xf32)
         status = rocblaslt_status_not_implemented;
+    // Only rocblaslt_matmul splits the operands of the 3xBF16 compute type
+    if(compute_type == rocblaslt_compute_f32_fast_3xbf16)
+        status = rocblaslt_status_not_implemented;
     if(!((type_a == HIP_R_8I && type_b == HIP_R_8I && type_c == HIP_R_32I && type_d == HIP_R_32I)
          || (type_a == HIP_R_8I && type_b == HIP_R_8I && type_c == HIP_R_8I && type_d == HIP_R_8I))
        && compute_type == rocblaslt_compute_i32)
         status = rocblaslt_status_not_implemented;
-    if(string_to_hip_datatype(hip_datatype_to_string(type_a)) == HIPBLASLT_DATATYPE_INVALID
-       || string_to_hip_datatype(hip_datatype_to_string(type_b)) == HIPBLASLT_DATATYPE_INVALID
-       || string_to_hip_datatype(hip_datatype_to_string(type_c)) == HIPBLASLT_DATATYPE_INVALID
-       || string_to_hip_datatype(hip_datatype_to_string(type_d)) == HIPBLASLT_DATATYPE_INVALID
+    if(!isMatmulDataType(type_a) || !isMatmulDataType(type_b) || !isMatmulDataType(type_c)
+       || !isMatmulDataType(type_d)
        || !strcmp(rocblaslt_compute_type_string(compute_type),
                   rocblaslt_compute_type_string(ROCBLASLT_COMPUTE_TYPE_INVALID)))
         status = rocblaslt_status_not_implemented;
@@ -218,6 +1105,13 @@ inline rocblaslt_status validateMatmulArgs(int64_t                       m,
         return status;
     }
 
+    // Device alpha and beta reach the GEMM through the pass of deviceScalarGemmProblem
+    if(pointermode == rocblaslt_pointer_mode_device)
+    {
+        log_error(__func__, "invalid args", "device alpha and beta are not taken by this call");
+        return rocblaslt_status_not_implemented;
+    }
+
     // sizes must not be negative
     if(batch_stride_a < 0 || batch_stride_b < 0 || batch_stride_c < 0 || batch_stride_d < 0)
     {
@@ -274,6 +1168,12 @@ inline rocblaslt_status rocblaslt_epilogue_valid_args(const rocblaslt_epilogue&
                                                       void*&       scaleAlphaVec,
                                                       bool&        gradient)
 {
+    if(is_gated_enabled(epilogue))
+    {
+        log_error(__func__, "Gated epilogues are only supported by hipblasLtMatmul");
+        return rocblaslt_status_not_implemented;
+    }
+
     // Set status
     rocblaslt_status status = rocblaslt_status_continue;
     // External update args
@@ -348,6 +1248,25 @@ inline rocblaslt_status rocblaslt_matmul_valid_args(const rocblaslt_matmul_desc
                                                     bool&                       gradient,
                                                     rocblaslt_compute_type&     compute_type)
 {
+    auto orderStatus = validateMatmulOrders(matA, matB, matC, matD);
+    if(orderStatus != rocblaslt_status_continue)
+        return orderStatus;
+    auto sparseStatus = validateSparseA(*matmul_descr, *matA, false);
+    if(sparseStatus != rocblaslt_status_continue)
+        return sparseStatus;
+    if(is_pointer_array(*matA) || is_pointer_array(*matB) || is_pointer_array(*matC)
+       || is_pointer_array(*matD))
+    {
+        log_error(__func__, "invalid args", "pointer array batches need hipblasLtMatmul");
+        return rocblaslt_status_not_implemented;
+    }
+    if(is_nested_batch(*matA) || is_nested_batch(*matB) || is_nested_batch(*matC)
+       || is_nested_batch(*matD))
+    {
+        log_error(__func__, "invalid args", "outer batches need hipblasLtMatmul");
+        return rocblaslt_status_not_implemented;
+    }
+
     // Internal assign
     hipblasOperation_t opA = matmul_descr->op_A;
 
@@ -385,6 +1304,19 @@ inline rocblaslt_status rocblaslt_matmul_valid_args(const rocblaslt_matmul_desc
     n = num_cols_d;
     k = (opA == HIPBLAS_OP_N) ? num_cols_a : num_rows_a;
 
+    if(matmul_descr->residual || (matmul_descr->isScaleDVec && matmul_descr->scaleD)
+       || matmul_descr->dropout > 0.f || matmul_descr->amax_history || matmul_descr->isScaleABlock
+       || matmul_descr->isScaleBBlock || matmul_descr->b_quant_scale
+       || is_aux_convert_enabled(*matmul_descr, *matD) || matmul_descr->d2
+       || is_bgrad_deterministic(*matmul_descr))
+    {
+        log_error(__func__,
+                  "The residual, D scale vector, dropout, amax history, block scales, quantized B, "
+                  "AUX type and amax, D2 and deterministic bias gradients are only supported by "
+                  "hipblasLtMatmul");
+        return rocblaslt_status_not_implemented;
+    }
+
     auto status = validateMatmulArgs(m,
                                      n,
                                      k,
@@ -414,7 +1346,10 @@ inline rocblaslt_status rocblaslt_matmul_valid_args(const rocblaslt_matmul_desc
     if(status != rocblaslt_status_continue)
         return status;
 
-    const void* alphaVecPtr = matmul_descr->pointermode ? alpha : nullptr;
+    const void* alphaVecPtr
+        = matmul_descr->pointermode == rocblaslt_pointer_mode_alpha_device_vector_beta_host
+              ? alpha
+              : nullptr;
     status                  = rocblaslt_epilogue_valid_args(matmul_descr->epilogue,
                                            num_rows_d,
                                            num_cols_d,
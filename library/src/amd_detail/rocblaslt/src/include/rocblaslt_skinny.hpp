@@ -0,0 +1,95 @@
+/*! \file */
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCBLASLT_SKINNY_HPP
+#define ROCBLASLT_SKINNY_HPP
+
+#include "handle.h"
+#include "rocblaslt.h"
+
+#include <hip/hip_runtime_api.h>
+
+/*******************************************************************************
+ * The skinny GEMM serves the decode shapes of LLM inference, where m or n is
+ * at most 16 and the GEMM is a batch of GEMVs bound by the reads of the large
+ * operand. Each wave reduces one column of the large operand along k with wide
+ * loads, and k is split over the workgroups when the columns alone do not fill
+ * the CUs. It is not a TensileLite solution, so its algo carries the reserved
+ * solution index SKINNY_GEMM_SOLUTION_INDEX.
+ ******************************************************************************/
+
+constexpr int SKINNY_GEMM_SOLUTION_INDEX = -2;
+
+inline bool isSkinnyGemmAlgo(const rocblaslt_matmul_algo& algo)
+{
+    return *(const int*)algo.data == SKINNY_GEMM_SOLUTION_INDEX;
+}
+
+/*******************************************************************************
+ * \brief Whether the skinny GEMM runs the problem: f32 compute, f32, f16 or
+ * bf16 inputs, D of the input type or f32, host scalars, no epilogue or scale,
+ * column major strided operands, and either m <= 16 with B not transposed or
+ * n <= 16 with A transposed, so that the large operand is contiguous along k.
+ ******************************************************************************/
+bool skinnyGemmSupported(const _rocblaslt_matmul_desc&   desc,
+                         const _rocblaslt_matrix_layout& matA,
+                         const _rocblaslt_matrix_layout& matB,
+                         const _rocblaslt_matrix_layout& matC,
+                         const _rocblaslt_matrix_layout& matD);
+
+/*******************************************************************************
+ * \brief Bytes of the split-k partials of a supported problem within
+ * maxWorkspaceBytes, 0 when k is not split.
+ ******************************************************************************/
+size_t skinnyGemmWorkspaceSize(rocblaslt_handle                handle,
+                               const _rocblaslt_matmul_desc&   desc,
+                               const _rocblaslt_matrix_layout& matA,
+                               const _rocblaslt_matrix_layout& matB,
+                               const _rocblaslt_matrix_layout& matD,
+                               size_t                          maxWorkspaceBytes);
+
+/*******************************************************************************
+ * \brief D = alpha * op(A) op(B) + beta * C of a supported problem with host
+ * alpha and beta, splitting k within workspaceSizeInBytes.
+ ******************************************************************************/
+rocblaslt_status launchSkinnyGemm(rocblaslt_handle                handle,
+                                  const _rocblaslt_matmul_desc&   desc,
+                                  const void*                     A,
+                                  const void*                     B,
+                                  const void*                     C,
+                                  void*                           D,
+                                  const _rocblaslt_matrix_layout& matA,
+                                  const _rocblaslt_matrix_layout& matB,
+                                  const _rocblaslt_matrix_layout& matC,
+                                  const _rocblaslt_matrix_layout& matD,
+                                  float                           alpha,
+                                  float                           beta,
+                                  void*                           workspace,
+                                  size_t                          workspaceSizeInBytes,
+                                  hipStream_t                     stream);
+
+#endif
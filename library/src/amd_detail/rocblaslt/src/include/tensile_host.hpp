@@ -137,6 +137,17 @@ struct RocblasltContractionProblem
     hipStream_t stream;
     void*       Synchronizer;
 
+    // Only solutions that reduce split-k partials in a fixed order are allowed
+    bool deterministicReduction = false;
+    // CUs that persistent and StreamK grids are sized to, 0 for all of them
+    uint32_t cuBudget = 0;
+    // A is 2:4 compressed, A and lda are those of the values and metadataA indexes them
+    bool        sparseA   = false;
+    const void* metadataA = nullptr;
+    // Temporal hints asked for the stores of D and the loads of B
+    rocblaslt_cache_policy cachePolicyD = rocblaslt_cache_policy_default;
+    rocblaslt_cache_policy cachePolicyB = rocblaslt_cache_policy_default;
+
     // gemm_ex
     // gemm_strided_batched_ex
     RocblasltContractionProblem(hipblasOperation_t     trans_a,
@@ -302,6 +313,77 @@ void initTensileGemmData(rocblaslt_handle       handle,
                          size_t                 maxWorkspaceBytes,
                          std::shared_ptr<void>& gemmData);
 
+/*******************************************************************************
+ * initTensilePreloadManifest() starts loading the code objects and resolving  *
+ * the kernels of HIPBLASLT_PRELOAD_MANIFEST in the background, once for the   *
+ * device of the handle                                                        *
+ *******************************************************************************/
+void initTensilePreloadManifest(rocblaslt_handle handle);
+
+/*******************************************************************************
+ * initTensileExecCache() attaches the resolved matmul execution cache to a    *
+ * handle, so repeated runContractionProblem() calls can skip solution lookup  *
+ *******************************************************************************/
+void initTensileExecCache(rocblaslt_handle handle);
+
+/*******************************************************************************
+ * initTensileSynchronizerPool() attaches the per-stream Synchronizer buffers  *
+ * of solutions that need one to a handle                                      *
+ *******************************************************************************/
+void initTensileSynchronizerPool(rocblaslt_handle handle);
+
+/*******************************************************************************
+ * initTensileHostStagingRing() attaches the pinned host ring that stages the  *
+ * grouped gemm kernel arguments of makeArgument() to a handle                 *
+ *******************************************************************************/
+void initTensileHostStagingRing(rocblaslt_handle handle);
+
+/*******************************************************************************
+ * clearTensileExecCache() drops the cached executions and heuristic results   *
+ *******************************************************************************/
+void clearTensileExecCache(rocblaslt_handle handle);
+
+/*******************************************************************************
+ * invalidateTensileHeuristics() drops the heuristic results of every handle,  *
+ * for changes of the solution overrides or the online tuning results          *
+ *******************************************************************************/
+void invalidateTensileHeuristics();
+
+/*******************************************************************************
+ * setTensileWorkspacePool() enables a stream-ordered workspace pool of up to  *
+ * maxBytes on the handle, used when the caller's workspace is too small.      *
+ * maxBytes of 0 disables it.                                                  *
+ *******************************************************************************/
+void setTensileWorkspacePool(rocblaslt_handle handle, size_t maxBytes);
+
+/*******************************************************************************
+ * setTensilePriorityStream() makes the launches of the handle run on a stream *
+ * of the greatest priority of its device, forked from and joined back to the  *
+ * caller's stream with events, and drops the cached heuristic results.        *
+ *******************************************************************************/
+void setTensilePriorityStream(rocblaslt_handle handle, bool enable);
+
+/*******************************************************************************
+ * setTensileReproducible() restricts the selection and the launches of the    *
+ * handle to solutions whose reductions have an order that the problem fixes,  *
+ * and drops the resolved executions.                                          *
+ *******************************************************************************/
+void setTensileReproducible(rocblaslt_handle handle, bool enable);
+
+/*******************************************************************************
+ * getTensileSolutionCacheStats() reads the counters of the solution caches of *
+ * the Tensile library of the handle's device                                  *
+ *******************************************************************************/
+rocblaslt_status getTensileSolutionCacheStats(rocblaslt_handle                handle,
+                                              rocblaslt_solution_cache_stats* stats);
+
+/*******************************************************************************
+ * getTensileStatistics() reads the execution cache counters of the handle,    *
+ * the cache, code object and kernel counters of the Tensile library of its    *
+ * device, and the lazy loading, staging and workspace counters of the process *
+ *******************************************************************************/
+rocblaslt_status getTensileStatistics(rocblaslt_handle handle, rocblaslt_statistics* stats);
+
 /*******************************************************************************
  * runContractionProblem() solves a RocblasltContractionProblem *
  *******************************************************************************/
@@ -336,17 +418,54 @@ rocblaslt_status runKernelFromInvocation(rocblaslt_handle       handle,
                                          hipEvent_t             start = nullptr,
                                          hipEvent_t             stop  = nullptr);
 
+// Run the gemms of gemmData back to back after checking all of them
+rocblaslt_status runKernelsFromInvocations(const std::vector<rocblaslt_handle>&       handles,
+                                           const std::vector<rocblaslt::RocGemmType>& gemmTypes,
+                                           const std::vector<void*>&                  gemmData,
+                                           hipStream_t                                stream);
+
 rocblaslt_status getDeviceUserArgumentsValuesFromContractionProblem(rocblaslt_handle       handle,
                                                                     rocblaslt::RocGemmType gemmType,
                                                                     std::shared_ptr<void>  gemmData,
                                                                     void* hostDeviceUserArgs);
 
+// Add the kernels of gemmData to graph as one node after the dependencies
+rocblaslt_status addKernelGraphNode(rocblaslt_handle       handle,
+                                    rocblaslt::RocGemmType gemmType,
+                                    std::shared_ptr<void>  gemmData,
+                                    hipGraph_t             graph,
+                                    const hipGraphNode_t*  dependencies,
+                                    size_t                 numDependencies,
+                                    hipGraphNode_t*        node);
+
+// Patch the pointers of gemmData and set its kernels on the node of an instantiated graph
+rocblaslt_status updateKernelGraphNode(rocblaslt_handle                  handle,
+                                       rocblaslt::RocGemmType            gemmType,
+                                       std::shared_ptr<void>             gemmData,
+                                       const rocblaslt::RocGemmInputsV2& inputs,
+                                       hipGraphExec_t                    exec,
+                                       hipGraphNode_t                    node);
+
+// Patch the pointers of gemmData and run its kernels without building them again
+rocblaslt_status runKernelFromNewInputs(rocblaslt_handle                  handle,
+                                        rocblaslt::RocGemmType            gemmType,
+                                        std::shared_ptr<void>             gemmData,
+                                        const rocblaslt::RocGemmInputsV2& inputs,
+                                        hipStream_t                       stream);
+
 rocblaslt_status runKernelFromNewDeviceUserArguments(rocblaslt_handle       handle,
                                                      rocblaslt::RocGemmType gemmType,
                                                      std::shared_ptr<void>  gemmData,
                                                      void*                  deviceUserArgs,
                                                      hipStream_t            stream);
 
+// Uploads host DeviceUserArguments through a per-instance ring of pinned/device slots
+rocblaslt_status runKernelFromHostUserArguments(rocblaslt_handle       handle,
+                                                rocblaslt::RocGemmType gemmType,
+                                                std::shared_ptr<void>  gemmData,
+                                                const void*            hostDeviceUserArgs,
+                                                hipStream_t            stream);
+
 rocblaslt_status runKernelFromDeviceUserArguments(rocblaslt_handle             handle,
                                                   rocblaslt::RocGemmType       gemmType,
                                                   size_t                       gemmCount,
@@ -364,6 +483,16 @@ std::string getSolutionNameFromData(rocblaslt_handle             handle,
                                     const rocblaslt::RocGemmType gemmType,
                                     std::shared_ptr<void>        gemmData);
 
+/*******************************************************************************
+ * getAlgoNames() points kernelName and solutionName, either of which may be   *
+ * null, at the names of the solution of algo. The strings are cached per      *
+ * solution index and stay valid for the life of the process                   *
+ *******************************************************************************/
+rocblaslt_status getAlgoNames(rocblaslt_handle             handle,
+                              const rocblaslt_matmul_algo& algo,
+                              const char**                 kernelName,
+                              const char**                 solutionName);
+
 std::string getKernelNameFromAlgoIndex(rocblaslt_handle handle, const rocblaslt_matmul_algo& algo);
 
 std::string getSolutionNameFromAlgoIndex(rocblaslt_handle             handle,
@@ -400,6 +529,15 @@ rocblaslt_status getAllSolutions(std::shared_ptr<void>
                                  std::vector<rocblaslt_matmul_heuristic_result>& heuristicResults,
                                  size_t                                          maxWorkSpaceBytes);
 
+/*******************************************************************************
+ * getWorkspaceFrontier() returns the solutions on the Pareto frontier of the  *
+ * required workspace and the predicted time, by increasing workspace.         *
+ *******************************************************************************/
+rocblaslt_status getWorkspaceFrontier(rocblaslt_handle                                handle,
+                                      rocblaslt::RocGemmType                          gemmType,
+                                      std::shared_ptr<void>                           gemmData,
+                                      std::vector<rocblaslt_matmul_heuristic_result>& frontier);
+
 rocblaslt_status
     getSolutionsFromIndex(rocblaslt_handle                                handle,
                           std::vector<int>&                               solutionIndex,
@@ -427,6 +565,17 @@ std::vector<std::shared_ptr<TensileLite::ContractionSolution>>
                         int                                requestedAlgoCount,
                         size_t                             maxWorkSpaceBytes);
 
+/*******************************************************************************
+ * traceBestRawSolutions() repeats getBestRawSolutions() and records every     *
+ * solution the selection evaluated, with the rank of the returned ones        *
+ *******************************************************************************/
+std::vector<rocblaslt::RocSelectionCandidate>
+    traceBestRawSolutions(RocblasltContractionProblem const& prob,
+                          rocblaslt_handle                   handle,
+                          std::shared_ptr<void>              gemmData,
+                          int                                requestedAlgoCount,
+                          size_t                             maxWorkSpaceBytes);
+
 /*******************************************************************************
  * getBestSolutions() calls finTopSolutions from Tensile and converts to       *
  * rocblaslt_matmul_heuristic_result                                           *
@@ -439,12 +588,38 @@ rocblaslt_status getBestSolutions(RocblasltContractionProblem const& prob,
                                   int*                               returnAlgoCount,
                                   size_t                             maxWorkSpaceBytes);
 
+/*******************************************************************************
+ * getBestSolutionsBatched() is getBestSolutions() for many problems. The     *
+ * results of probs[i] are at heuristicResultsArray[i * requestedAlgoCount]   *
+ * and their count is returnAlgoCount[i]. The problems are selected together, *
+ * so the library nodes that problems of one type share are visited once      *
+ *******************************************************************************/
+rocblaslt_status
+    getBestSolutionsBatched(std::vector<RocblasltContractionProblem> const& probs,
+                            rocblaslt_handle                                handle,
+                            std::vector<std::shared_ptr<void>> const&       gemmData,
+                            int                                             requestedAlgoCount,
+                            rocblaslt_matmul_heuristic_result               heuristicResultsArray[],
+                            int                                             returnAlgoCount[],
+                            size_t                                          maxWorkSpaceBytes);
+
 rocblaslt_status getBestSolutions(rocblaslt_handle       handle,
                                   rocblaslt::RocGemmType gemmType,
                                   std::shared_ptr<void>  gemmData,
                                   const int              workspaceBytes,
                                   const int              requestedAlgoCount,
-                                  std::vector<rocblaslt_matmul_heuristic_result>& heuristicResults);
+                                  std::vector<rocblaslt_matmul_heuristic_result>& heuristicResults,
+                                  const rocblaslt::RocGemmPreference* pref = nullptr);
+
+/*******************************************************************************
+ * Whether a solution meets the hard constraints of a gemm preference, i.e.    *
+ * deterministic reduction and the CU occupancy of persistent grids            *
+ *******************************************************************************/
+bool solutionMeetsPreference(rocblaslt_handle                    handle,
+                             rocblaslt::RocGemmType              gemmType,
+                             std::shared_ptr<void>               gemmData,
+                             const rocblaslt_matmul_algo&        algo,
+                             const rocblaslt::RocGemmPreference& pref);
 
 /******************************************************
  * Map a hipblaslt data type to a corresponding Tensile type *
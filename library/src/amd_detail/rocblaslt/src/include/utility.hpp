@@ -29,6 +29,7 @@
 #ifndef UTILITY_HPP
 #define UTILITY_HPP
 
+#include "Debug.hpp"
 #include "handle.h"
 #include "logging.h"
 #include <algorithm>
@@ -80,6 +81,8 @@ constexpr const char* rocblaslt_compute_type_string(rocblaslt_compute_type type)
         return "f32_f16_r";
     case rocblaslt_compute_f32_fast_bf16:
         return "f32_bf16_r";
+    case rocblaslt_compute_f32_fast_3xbf16:
+        return "f32_3xbf16_r";
     case rocblaslt_compute_f32_fast_f8_ocp:
     case rocblaslt_compute_f32_fast_f8_fnuz:
         return "f32_f8_r";
@@ -158,6 +161,7 @@ template <>
 static constexpr char rocblaslt_precision_string<uint32_t>[] = "u32_r";
 
 std::string prefix(const char* layer, const char* caller);
+std::string prefix(const char* layer, const char* caller, time_t when);
 
 const char* hipDataType_to_string(hipDataType type);
 
@@ -192,13 +196,102 @@ static inline rocblaslt_int rocblaslt_clz(rocblaslt_int n)
 }
 #endif
 std::ostream* get_logger_os();
-uint32_t      get_logger_layer_mode();
+bool          get_logger_async();
+
+// The rocblaslt_layer_mode mask of HIPBLASLT_LOG_LEVEL or HIPBLASLT_LOG_MASK, always 0 in
+// builds with HIPBLASLT_DISABLE_INSTRUMENTATION
+__attribute__((always_inline)) inline uint32_t get_logger_layer_mode()
+{
+    return rocblaslt::instrumentationFlags() & rocblaslt::INSTRUMENTATION_LAYER_MODE;
+}
+
+/*******************************************************************************
+ * With HIPBLASLT_LOG_ASYNC=1 the log functions copy their arguments into a    *
+ * record rather than formatting them. The record goes to a lock-free ring of  *
+ * the calling thread, a background thread formats the rings into the log      *
+ * stream. Bench lines repeated by later calls are only counted, the counts    *
+ * are written when the library is unloaded. A full ring drops the record.     *
+ *******************************************************************************/
+class rocblaslt_log_record
+{
+public:
+    explicit rocblaslt_log_record(bool bench)
+        : bench(bench)
+    {
+    }
+    virtual ~rocblaslt_log_record() = default;
+
+    virtual void format(std::ostream& os) = 0;
+
+    const bool bench;
+};
+
+template <typename F>
+class rocblaslt_log_record_of : public rocblaslt_log_record
+{
+public:
+    rocblaslt_log_record_of(bool bench, F&& format)
+        : rocblaslt_log_record(bench)
+        , m_format(std::move(format))
+    {
+    }
+    void format(std::ostream& os) override
+    {
+        m_format(os);
+    }
+
+private:
+    F m_format;
+};
+
+void log_enqueue(std::unique_ptr<rocblaslt_log_record> record);
+
+// Copies a log argument for the background thread, C strings may not outlive the call
+template <typename T>
+auto log_capture(T&& x)
+{
+    if constexpr(std::is_convertible_v<T, const char*>)
+        return x ? std::string(x) : std::string();
+    else
+        return std::decay_t<T>(std::forward<T>(x));
+}
+
+template <typename... Ts>
+auto log_capture_all(Ts&&... xs)
+{
+    return std::make_tuple(log_capture(std::forward<Ts>(xs))...);
+}
+
+template <typename F>
+void log_enqueue(bool bench, F&& format)
+{
+    log_enqueue(std::make_unique<rocblaslt_log_record_of<std::decay_t<F>>>(
+        bench, std::forward<F>(format)));
+}
 
 template <typename H, typename... Ts>
 void log_base(rocblaslt_layer_mode layer_mode, const char* func, H head, Ts&&... xs)
 {
     if(get_logger_layer_mode() & layer_mode)
     {
+        if(get_logger_async())
+        {
+            const char* layer = rocblaslt_layer_mode2string(layer_mode);
+            time_t      now   = time(0);
+            log_enqueue(false,
+                        [layer, func, now, args = log_capture_all(head, std::forward<Ts>(xs)...)](
+                            std::ostream& os) mutable {
+                            std::string comma_separator = " ";
+                            std::string prefix_str      = prefix(layer, func, now);
+                            std::apply(
+                                [&](auto&... x) {
+                                    log_arguments(os, comma_separator, prefix_str, x...);
+                                },
+                                args);
+                        });
+            return;
+        }
+
         std::lock_guard<std::mutex> lock(log_mutex);
         std::string comma_separator = " ";
 
@@ -268,6 +361,16 @@ void log_api(const char* func, H head, Ts&&... xs)
 template <typename... Ts>
 void log_bench(const char* func, Ts&&... xs)
 {
+    if(get_logger_async())
+    {
+        log_enqueue(true,
+                    [args = log_capture_all(std::forward<Ts>(xs)...)](std::ostream& os) mutable {
+                        os << "hipblaslt-bench ";
+                        std::apply([&](auto&... x) { log_arguments_bench(os, x...); }, args);
+                    });
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(log_mutex);
     std::ostream* os = get_logger_os();
     *os << "hipblaslt-bench ";
@@ -423,6 +526,23 @@ inline bool is_bias_enabled(rocblaslt_epilogue value_)
     case ROCBLASLT_EPILOGUE_DGELU_BGRAD:
     case ROCBLASLT_EPILOGUE_BGRADA:
     case ROCBLASLT_EPILOGUE_BGRADB:
+    case ROCBLASLT_EPILOGUE_SWIGLU_BIAS:
+    case ROCBLASLT_EPILOGUE_GEGLU_BIAS:
+        return true;
+    default:
+        return false;
+    }
+};
+
+// Gated epilogues halve the rows of D and run after the GEMM, see rocblaslt_matmul_gated
+inline bool is_gated_enabled(rocblaslt_epilogue value_)
+{
+    switch(value_)
+    {
+    case ROCBLASLT_EPILOGUE_SWIGLU:
+    case ROCBLASLT_EPILOGUE_SWIGLU_BIAS:
+    case ROCBLASLT_EPILOGUE_GEGLU:
+    case ROCBLASLT_EPILOGUE_GEGLU_BIAS:
         return true;
     default:
         return false;
@@ -31,6 +31,7 @@ function(CompileSourceKernel source archs buildIdKind outputFolder)
                       DEPENDS ${outputFolder}/hipblasltTransform.hsaco
                       VERBATIM)
     add_custom_command(OUTPUT ${outputFolder}/hipblasltTransform.hsaco
-                       COMMAND bash  ${CMAKE_CURRENT_SOURCE_DIR}/src/amd_detail/rocblaslt/src/kernels/compile_code_object.sh ${source} ${archs} ${CMAKE_BUILD_TYPE} ${buildIdKind} ${outputFolder}/hipblasltTransform.hsaco
+                       COMMAND bash  ${CMAKE_CURRENT_SOURCE_DIR}/src/amd_detail/rocblaslt/src/kernels/compile_code_object.sh ${source} ${archs} ${CMAKE_BUILD_TYPE} ${buildIdKind} ${outputFolder}/hipblasltTransform.hsaco ${CMAKE_CURRENT_SOURCE_DIR}/include
+                       DEPENDS ${source}
                        COMMENT "Compiling source kernels")
 endfunction()
\ No newline at end of file
@@ -25,6 +25,7 @@ archs=$2
 build_type=$3
 build_id_kind=$4
 dest=$5
+include_dir=$6
 additional_options="-O3"
 
 if [ "$build_type" = "RelWithDebInfo" ]; then
@@ -35,4 +36,4 @@ fi
 
 rocm_path="${ROCM_PATH:-/opt/rocm}"
 clang_path="${rocm_path}/bin/amdclang++"
-$clang_path -x hip "$sources" --offload-arch="${archs}" -c --offload-device-only -Xoffload-linker --build-id=$build_id_kind $additional_options -o "$dest"
\ No newline at end of file
+$clang_path -x hip "$sources" -I "$include_dir" --offload-arch="${archs}" -c --offload-device-only -Xoffload-linker --build-id=$build_id_kind $additional_options -o "$dest"
\ No newline at end of file
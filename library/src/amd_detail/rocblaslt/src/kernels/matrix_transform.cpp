@@ -25,10 +25,16 @@
  * ************************************************************************ */
 #include "matrix_transform.h"
 #include <cstdint>
+#include <type_traits>
 #include <hip/hip_bfloat16.h>
 #include <hip/hip_fp16.h>
 #include <hip/hip_runtime.h>
 
+#ifndef HIP_HOST_DEVICE
+#define HIP_HOST_DEVICE __host__ __device__
+#endif
+#include "hipblaslt_hip_f8_impl.h"
+
 namespace amd_detail
 {
     template <typename DType, size_t VectorWidth>
@@ -286,8 +292,1269 @@ namespace amd_detail
             }
         }
     }
+
+    template <typename DType, uint32_t VectorWidth>
+    struct alignas(sizeof(DType) * VectorWidth) TileVector
+    {
+        DType data[VectorWidth];
+    };
+
+    // Number of elements of DType in a 128-bit vector
+    template <typename DType>
+    constexpr uint32_t vector128Width()
+    {
+        return 16 / sizeof(DType);
+    }
+
+    // Maps the idx-th vector of a TileM x TileN tile to its first element. Vectors run along
+    // the columns (row-major storage) or along the rows (column-major storage).
+    template <uint32_t TileM, uint32_t TileN, uint32_t VectorWidth>
+    __device__ void
+        getTileVectorCoord(uint32_t idx, bool alongCols, uint32_t& tRow, uint32_t& tCol)
+    {
+        if(alongCols)
+        {
+            tRow = idx / (TileN / VectorWidth);
+            tCol = (idx % (TileN / VectorWidth)) * VectorWidth;
+        }
+        else
+        {
+            tCol = idx / (TileM / VectorWidth);
+            tRow = (idx % (TileM / VectorWidth)) * VectorWidth;
+        }
+    }
+
+    // Stages scale * src of the tile at (blockRow, blockCol) into LDS, or adds it to the
+    // staged values when Accumulate is set. src is read VectorWidth elements at a time along
+    // its contiguous dimension; a null src reads as zero.
+    template <typename DType,
+              typename ScaleType,
+              uint32_t TileM,
+              uint32_t TileN,
+              uint32_t VectorWidth,
+              bool     Accumulate>
+    __device__ void loadTileToLds(ScaleType (*tile)[TileN + 1],
+                                  const DType* src,
+                                  ScaleType    scale,
+                                  bool         alongCols,
+                                  uint32_t     ld,
+                                  uint32_t     blockRow,
+                                  uint32_t     blockCol,
+                                  uint32_t     numRows,
+                                  uint32_t     numCols)
+    {
+        using VectorType          = TileVector<DType, VectorWidth>;
+        constexpr auto NumVectors = TileM * TileN / VectorWidth;
+
+        for(uint32_t idx = threadIdx.x; idx < NumVectors; idx += blockDim.x)
+        {
+            uint32_t tRow, tCol;
+            getTileVectorCoord<TileM, TileN, VectorWidth>(idx, alongCols, tRow, tCol);
+            const auto vecPos   = alongCols ? blockCol + tCol : blockRow + tRow;
+            const auto vecEnd   = alongCols ? numCols : numRows;
+            const auto crossPos = alongCols ? blockRow + tRow : blockCol + tCol;
+            const auto crossEnd = alongCols ? numRows : numCols;
+            ScaleType  values[VectorWidth] = {};
+
+            if(src && crossPos < crossEnd)
+            {
+                const auto offset = size_t(crossPos) * ld + vecPos;
+
+                if(vecPos + VectorWidth <= vecEnd)
+                {
+                    const auto v = *reinterpret_cast<const VectorType*>(src + offset);
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; ++i)
+                    {
+                        values[i] = static_cast<ScaleType>(v.data[i]);
+                    }
+                }
+                else
+                {
+                    for(uint32_t i = 0; vecPos + i < vecEnd; ++i)
+                    {
+                        values[i] = static_cast<ScaleType>(src[offset + i]);
+                    }
+                }
+            }
+
+#pragma unroll
+            for(uint32_t i = 0; i < VectorWidth; ++i)
+            {
+                auto& staged = alongCols ? tile[tRow][tCol + i] : tile[tRow + i][tCol];
+
+                if constexpr(Accumulate)
+                {
+                    staged += scale * values[i];
+                }
+                else
+                {
+                    staged = scale * values[i];
+                }
+            }
+        }
+    }
+
+    // Writes the staged tile to dst VectorWidth elements at a time along its contiguous
+    // dimension. convert(value, row, col) turns a staged value into a DType.
+    template <typename DType,
+              typename ScaleType,
+              uint32_t TileM,
+              uint32_t TileN,
+              uint32_t VectorWidth,
+              typename Convert>
+    __device__ void storeTileFromLds(DType*          dst,
+                                     const ScaleType (*tile)[TileN + 1],
+                                     bool            alongCols,
+                                     uint32_t        ld,
+                                     uint32_t        blockRow,
+                                     uint32_t        blockCol,
+                                     uint32_t        numRows,
+                                     uint32_t        numCols,
+                                     Convert         convert)
+    {
+        using VectorType          = TileVector<DType, VectorWidth>;
+        constexpr auto NumVectors = TileM * TileN / VectorWidth;
+
+        for(uint32_t idx = threadIdx.x; idx < NumVectors; idx += blockDim.x)
+        {
+            uint32_t tRow, tCol;
+            getTileVectorCoord<TileM, TileN, VectorWidth>(idx, alongCols, tRow, tCol);
+            const auto vecPos   = alongCols ? blockCol + tCol : blockRow + tRow;
+            const auto vecEnd   = alongCols ? numCols : numRows;
+            const auto crossPos = alongCols ? blockRow + tRow : blockCol + tCol;
+            const auto crossEnd = alongCols ? numRows : numCols;
+
+            if(crossPos >= crossEnd || vecPos >= vecEnd)
+            {
+                continue;
+            }
+
+            VectorType v;
+#pragma unroll
+            for(uint32_t i = 0; i < VectorWidth; ++i)
+            {
+                v.data[i] = alongCols ? convert(tile[tRow][tCol + i], crossPos, vecPos + i)
+                                      : convert(tile[tRow + i][tCol], vecPos + i, crossPos);
+            }
+
+            const auto offset = size_t(crossPos) * ld + vecPos;
+
+            if(vecPos + VectorWidth <= vecEnd)
+            {
+                *reinterpret_cast<VectorType*>(dst + offset) = v;
+            }
+            else
+            {
+                for(uint32_t i = 0; vecPos + i < vecEnd; ++i)
+                {
+                    dst[offset + i] = v.data[i];
+                }
+            }
+        }
+    }
+
+    // C = convert(alpha * A + beta * B) for the TileM x TileN tile at (blockRow, blockCol) of a
+    // single matrix. The tile is staged in LDS so that A, B and C are all accessed with vectors
+    // along their own contiguous dimension regardless of order and transpose.
+    template <typename InType,
+              typename OutType,
+              typename ScaleType,
+              uint32_t TileM,
+              uint32_t TileN,
+              uint32_t InVectorWidth,
+              uint32_t OutVectorWidth,
+              typename Convert>
+    __device__ void transformTileThroughLds(ScaleType (*tile)[TileN + 1],
+                                            OutType*       c,
+                                            const InType*  a,
+                                            const InType*  b,
+                                            ScaleType      alpha,
+                                            ScaleType      beta,
+                                            uint32_t       blockRow,
+                                            uint32_t       blockCol,
+                                            uint32_t       numRows,
+                                            uint32_t       numCols,
+                                            uint32_t       ldA,
+                                            uint32_t       ldB,
+                                            uint32_t       ldC,
+                                            bool           alongColsA,
+                                            bool           alongColsB,
+                                            bool           alongColsC,
+                                            Convert        convert)
+    {
+        loadTileToLds<InType, ScaleType, TileM, TileN, InVectorWidth, false>(
+            tile, a, alpha, alongColsA, ldA, blockRow, blockCol, numRows, numCols);
+        __syncthreads();
+
+        if(b)
+        {
+            loadTileToLds<InType, ScaleType, TileM, TileN, InVectorWidth, true>(
+                tile, b, beta, alongColsB, ldB, blockRow, blockCol, numRows, numCols);
+            __syncthreads();
+        }
+
+        storeTileFromLds<OutType, ScaleType, TileM, TileN, OutVectorWidth>(
+            c, tile, alongColsC, ldC, blockRow, blockCol, numRows, numCols, convert);
+    }
+
+    // Tile of this workgroup for the kernels launched with one workgroup per tile in x and
+    // one batch per z.
+    template <uint32_t TileM, uint32_t TileN>
+    __device__ void getWorkgroupTile(uint32_t numRows, uint32_t& blockRow, uint32_t& blockCol)
+    {
+        const auto numTilesM = numRows / TileM + !!(numRows % TileM);
+        blockRow             = (blockIdx.x % numTilesM) * TileM;
+        blockCol             = (blockIdx.x / numTilesM) * TileN;
+    }
+
+    // Same computation as transform() with 128-bit loads and stores through an LDS tile.
+    // Requires 16-byte aligned pointers, leading dimensions and batch stride.
+    template <typename DType,
+              typename ScaleType,
+              bool     RowMajA,
+              bool     RowMajB,
+              bool     RowMajC,
+              uint32_t TileM,
+              uint32_t TileN>
+    __device__ void transformLds(DType*           c,
+                                 const DType*     a,
+                                 const DType*     b,
+                                 ScaleType        alpha,
+                                 const ScaleType* alphaPtr,
+                                 ScaleType        beta,
+                                 const ScaleType* betaPtr,
+                                 uint32_t         numRows,
+                                 uint32_t         numCols,
+                                 uint32_t         ldA,
+                                 uint32_t         ldB,
+                                 uint32_t         ldC,
+                                 uint32_t         batchStride,
+                                 bool             transA,
+                                 bool             transB)
+    {
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        if(betaPtr)
+        {
+            beta = *betaPtr;
+        }
+
+        __shared__ ScaleType tile[TileM][TileN + 1];
+        constexpr auto       VectorWidth = vector128Width<DType>();
+        const auto           batchOffset = size_t(blockIdx.z) * batchStride;
+        uint32_t             blockRow, blockCol;
+        getWorkgroupTile<TileM, TileN>(numRows, blockRow, blockCol);
+
+        transformTileThroughLds<DType, DType, ScaleType, TileM, TileN, VectorWidth, VectorWidth>(
+            tile,
+            c + batchOffset,
+            a ? a + batchOffset : nullptr,
+            b ? b + batchOffset : nullptr,
+            alpha,
+            beta,
+            blockRow,
+            blockCol,
+            numRows,
+            numCols,
+            ldA,
+            ldB,
+            ldC,
+            RowMajA != transA,
+            RowMajB != transB,
+            RowMajC,
+            [](ScaleType v, uint32_t, uint32_t) { return static_cast<DType>(v); });
+    }
+
+    // Calls f with std::integral_constant<uint32_t, vectorWidth>, for vector widths of 16, 8 or
+    // 4 bytes of DType and 1. Other widths are treated as 1.
+    template <typename DType, typename F>
+    __device__ void dispatchVectorWidth(uint32_t vectorWidth, F&& f)
+    {
+        constexpr uint32_t Width16 = 16 / sizeof(DType);
+        constexpr uint32_t Width8  = 8 / sizeof(DType);
+        constexpr uint32_t Width4  = 4 / sizeof(DType);
+
+        if(Width16 > 1 && vectorWidth == Width16)
+        {
+            f(std::integral_constant<uint32_t, Width16>{});
+        }
+        else if(Width8 > 1 && vectorWidth == Width8)
+        {
+            f(std::integral_constant<uint32_t, Width8>{});
+        }
+        else if(Width4 > 1 && vectorWidth == Width4)
+        {
+            f(std::integral_constant<uint32_t, Width4>{});
+        }
+        else
+        {
+            f(std::integral_constant<uint32_t, 1>{});
+        }
+    }
+
+    // transformLds with runtime orders and the widest input and output vectors the host found
+    // safe for the alignment of the operands. The widths must divide the tile along the
+    // contiguous dimension of every operand they apply to.
+    template <typename DType, typename ScaleType, uint32_t TileM, uint32_t TileN>
+    __device__ void transformVariant(DType*           c,
+                                     const DType*     a,
+                                     const DType*     b,
+                                     ScaleType        alpha,
+                                     const ScaleType* alphaPtr,
+                                     ScaleType        beta,
+                                     const ScaleType* betaPtr,
+                                     uint32_t         numRows,
+                                     uint32_t         numCols,
+                                     uint32_t         ldA,
+                                     uint32_t         ldB,
+                                     uint32_t         ldC,
+                                     uint32_t         batchStride,
+                                     bool             rowMajA,
+                                     bool             rowMajB,
+                                     bool             rowMajC,
+                                     bool             transA,
+                                     bool             transB,
+                                     uint32_t         inVectorWidth,
+                                     uint32_t         outVectorWidth)
+    {
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        if(betaPtr)
+        {
+            beta = *betaPtr;
+        }
+
+        __shared__ ScaleType tile[TileM][TileN + 1];
+        const auto           batchOffset = size_t(blockIdx.z) * batchStride;
+        uint32_t             blockRow, blockCol;
+        getWorkgroupTile<TileM, TileN>(numRows, blockRow, blockCol);
+
+        dispatchVectorWidth<DType>(inVectorWidth, [&](auto inVW) {
+            dispatchVectorWidth<DType>(outVectorWidth, [&](auto outVW) {
+                transformTileThroughLds<DType,
+                                        DType,
+                                        ScaleType,
+                                        TileM,
+                                        TileN,
+                                        decltype(inVW)::value,
+                                        decltype(outVW)::value>(
+                    tile,
+                    c + batchOffset,
+                    a ? a + batchOffset : nullptr,
+                    b ? b + batchOffset : nullptr,
+                    alpha,
+                    beta,
+                    blockRow,
+                    blockCol,
+                    numRows,
+                    numCols,
+                    ldA,
+                    ldB,
+                    ldC,
+                    rowMajA != transA,
+                    rowMajB != transB,
+                    rowMajC,
+                    [](ScaleType v, uint32_t, uint32_t) { return static_cast<DType>(v); });
+            });
+        });
+    }
+
+    template <typename DType>
+    constexpr bool isFloat8()
+    {
+        return std::is_same<DType, DTypeF8>::value || std::is_same<DType, DTypeBF8>::value;
+    }
+
+    // Hash of the element position and seed for stochastic rounding
+    __device__ inline uint32_t roundingRandom(uint32_t seed, uint32_t batch, uint32_t row, uint32_t col)
+    {
+        uint32_t x = seed ^ (batch * 0x9E3779B9u) ^ (row * 0x85EBCA6Bu) ^ (col * 0xC2B2AE35u);
+        x ^= x >> 16;
+        x *= 0x7FEB352Du;
+        x ^= x >> 15;
+        x *= 0x846CA68Bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    // Converts a scaled fp32 value to FP8/BF8 (fnuz). Finite values beyond the largest
+    // representable magnitude are clipped to it when saturating and become NaN otherwise.
+    template <typename DType>
+    __device__ DType castToFloat8(float v, bool saturate, bool stochasticRounding, uint32_t rng)
+    {
+        constexpr bool  IsF8     = std::is_same<DType, DTypeF8>::value;
+        constexpr float MaxValue = IsF8 ? 240.0f : 57344.0f;
+        constexpr uint8_t NaN    = 0x80;
+
+        if(!isfinite(v))
+        {
+            return DType{NaN};
+        }
+
+        if(fabsf(v) > MaxValue)
+        {
+            if(!saturate)
+            {
+                return DType{NaN};
+            }
+            v = v > 0 ? MaxValue : -MaxValue;
+        }
+
+#if defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__)
+        uint32_t ival = 0;
+
+        if(stochasticRounding)
+        {
+            ival = IsF8 ? __builtin_amdgcn_cvt_sr_fp8_f32(v, rng, ival, 0)
+                        : __builtin_amdgcn_cvt_sr_bf8_f32(v, rng, ival, 0);
+        }
+        else
+        {
+            ival = IsF8 ? __builtin_amdgcn_cvt_pk_fp8_f32(v, v, ival, false)
+                        : __builtin_amdgcn_cvt_pk_bf8_f32(v, v, ival, false);
+        }
+
+        return DType{static_cast<uint8_t>(ival & 0xff)};
+#else
+        return DType{hipblaslt_hip_f8_impl::cast_to_f8<IsF8 ? 3 : 2, IsF8 ? 4 : 5, float, true, true>(
+            v, stochasticRounding, rng)};
+#endif
+    }
+
+    // Converts a scaled fp32 result to OutType, rounding FP8/BF8 stochastically when requested
+    template <typename OutType>
+    __device__ OutType convertScaled(float    v,
+                                     bool     saturate,
+                                     bool     stochasticRounding,
+                                     uint32_t seed,
+                                     uint32_t batch,
+                                     uint32_t row,
+                                     uint32_t col)
+    {
+        if constexpr(isFloat8<OutType>())
+        {
+            const auto rng = stochasticRounding ? roundingRandom(seed, batch, row, col) : 0;
+            return castToFloat8<OutType>(v, saturate, stochasticRounding, rng);
+        }
+        else
+        {
+            return static_cast<OutType>(v);
+        }
+    }
+
+    // C = cast(scaleC * (alpha * A + beta * B)) where C may have a different type than A and
+    // B, e.g. to transpose and quantize weights to FP8 in one pass. scaleCPtr, when not null,
+    // points to a per-tensor scale in device memory. Orders are runtime arguments; Vectorized
+    // kernels use 128-bit accesses and require 16-byte aligned pointers, leading dimensions and
+    // batch stride.
+    template <typename InType, typename OutType, bool Vectorized>
+    __device__ void transformConvert(OutType*       c,
+                                     const InType*  a,
+                                     const InType*  b,
+                                     float          alpha,
+                                     const float*   alphaPtr,
+                                     float          beta,
+                                     const float*   betaPtr,
+                                     const float*   scaleCPtr,
+                                     uint32_t       numRows,
+                                     uint32_t       numCols,
+                                     uint32_t       ldA,
+                                     uint32_t       ldB,
+                                     uint32_t       ldC,
+                                     uint32_t       batchStride,
+                                     bool           rowMajA,
+                                     bool           rowMajB,
+                                     bool           rowMajC,
+                                     bool           transA,
+                                     bool           transB,
+                                     bool           saturate,
+                                     bool           stochasticRounding,
+                                     uint32_t       seed)
+    {
+        constexpr uint32_t TileM          = 64;
+        constexpr uint32_t TileN          = 64;
+        constexpr uint32_t InVectorWidth  = Vectorized ? vector128Width<InType>() : 1;
+        constexpr uint32_t OutVectorWidth = Vectorized ? vector128Width<OutType>() : 1;
+
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        if(betaPtr)
+        {
+            beta = *betaPtr;
+        }
+
+        __shared__ float tile[TileM][TileN + 1];
+        const float      scaleC      = scaleCPtr ? *scaleCPtr : 1.0f;
+        const auto       batch       = blockIdx.z;
+        const auto       batchOffset = size_t(batch) * batchStride;
+        uint32_t         blockRow, blockCol;
+        getWorkgroupTile<TileM, TileN>(numRows, blockRow, blockCol);
+
+        transformTileThroughLds<InType, OutType, float, TileM, TileN, InVectorWidth, OutVectorWidth>(
+            tile,
+            c + batchOffset,
+            a ? a + batchOffset : nullptr,
+            b ? b + batchOffset : nullptr,
+            alpha,
+            beta,
+            blockRow,
+            blockCol,
+            numRows,
+            numCols,
+            ldA,
+            ldB,
+            ldC,
+            rowMajA != transA,
+            rowMajB != transB,
+            rowMajC,
+            [=](float v, uint32_t row, uint32_t col) {
+                return convertScaled<OutType>(
+                    v * scaleC, saturate, stochasticRounding, seed, batch, row, col);
+            });
+    }
+
+    // Matrix batch of a strided batch or of a device array of matrix pointers
+    template <typename DType>
+    __device__ DType* batchPointer(DType* base, bool pointerArray, uint32_t batch, size_t stride)
+    {
+        if(!base)
+        {
+            return nullptr;
+        }
+
+        return pointerArray ? reinterpret_cast<DType* const*>(base)[batch]
+                            : base + size_t(batch) * stride;
+    }
+
+    template <typename DType>
+    __device__ bool isVector128Aligned(const DType* ptr, uint32_t ld)
+    {
+        return !ptr
+               || (reinterpret_cast<uintptr_t>(ptr) % 16 == 0
+                   && (size_t(ld) * sizeof(DType)) % 16 == 0);
+    }
+
+    // transformTileThroughLds with 128-bit input and/or output accesses where the matrices of
+    // the current batch allow it. The choice is uniform across the workgroup.
+    template <typename DType, typename ScaleType, uint32_t TileM, uint32_t TileN>
+    __device__ void transformTileAnyAlignment(ScaleType (*tile)[TileN + 1],
+                                              DType*       c,
+                                              const DType* a,
+                                              const DType* b,
+                                              ScaleType    alpha,
+                                              ScaleType    beta,
+                                              uint32_t     blockRow,
+                                              uint32_t     blockCol,
+                                              uint32_t     numRows,
+                                              uint32_t     numCols,
+                                              uint32_t     ldA,
+                                              uint32_t     ldB,
+                                              uint32_t     ldC,
+                                              bool         alongColsA,
+                                              bool         alongColsB,
+                                              bool         alongColsC)
+    {
+        constexpr auto VW        = vector128Width<DType>();
+        const bool     vectorIn  = isVector128Aligned(a, ldA) && isVector128Aligned(b, ldB);
+        const bool     vectorOut = isVector128Aligned(c, ldC);
+        const auto     convert   = [](ScaleType v, uint32_t, uint32_t) { return static_cast<DType>(v); };
+
+        const auto     run       = [&](auto inVW, auto outVW) {
+            transformTileThroughLds<DType,
+                                    DType,
+                                    ScaleType,
+                                    TileM,
+                                    TileN,
+                                    decltype(inVW)::value,
+                                    decltype(outVW)::value>(tile,
+                                                            c,
+                                                            a,
+                                                            b,
+                                                            alpha,
+                                                            beta,
+                                                            blockRow,
+                                                            blockCol,
+                                                            numRows,
+                                                            numCols,
+                                                            ldA,
+                                                            ldB,
+                                                            ldC,
+                                                            alongColsA,
+                                                            alongColsB,
+                                                            alongColsC,
+                                                            convert);
+        };
+        using Vector = std::integral_constant<uint32_t, VW>;
+        using Scalar = std::integral_constant<uint32_t, 1>;
+
+        if(vectorIn && vectorOut)
+        {
+            run(Vector{}, Vector{});
+        }
+        else if(vectorIn)
+        {
+            run(Vector{}, Scalar{});
+        }
+        else if(vectorOut)
+        {
+            run(Scalar{}, Vector{});
+        }
+        else
+        {
+            run(Scalar{}, Scalar{});
+        }
+    }
+
+    // Persistent strided or pointer-array batched transform. Each workgroup strides over the
+    // flattened (batch, tile) space so that many small matrices need a single launch and no
+    // workgroup is left idle by a per-matrix grid.
+    template <typename DType, typename ScaleType>
+    __device__ void transformBatched(void*            c,
+                                     const void*      a,
+                                     const void*      b,
+                                     ScaleType        alpha,
+                                     const ScaleType* alphaPtr,
+                                     ScaleType        beta,
+                                     const ScaleType* betaPtr,
+                                     uint32_t         numRows,
+                                     uint32_t         numCols,
+                                     uint32_t         ldA,
+                                     uint32_t         ldB,
+                                     uint32_t         ldC,
+                                     uint32_t         batchStride,
+                                     uint32_t         batchCount,
+                                     bool             rowMajA,
+                                     bool             rowMajB,
+                                     bool             rowMajC,
+                                     bool             transA,
+                                     bool             transB,
+                                     bool             pointerArray)
+    {
+        constexpr uint32_t TileM = 32;
+        constexpr uint32_t TileN = 32;
+        __shared__ ScaleType tile[TileM][TileN + 1];
+
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        if(betaPtr)
+        {
+            beta = *betaPtr;
+        }
+
+        const auto numTilesM = numRows / TileM + !!(numRows % TileM);
+        const auto numTilesN = numCols / TileN + !!(numCols % TileN);
+        const auto numTiles  = numTilesM * numTilesN;
+        const auto numWork   = size_t(numTiles) * batchCount;
+
+        for(size_t work = blockIdx.x; work < numWork; work += gridDim.x)
+        {
+            const auto batch    = uint32_t(work / numTiles);
+            const auto tileIdx  = uint32_t(work % numTiles);
+            const auto blockRow = (tileIdx % numTilesM) * TileM;
+            const auto blockCol = (tileIdx / numTilesM) * TileN;
+
+            transformTileAnyAlignment<DType, ScaleType, TileM, TileN>(
+                tile,
+                batchPointer(static_cast<DType*>(c), pointerArray, batch, batchStride),
+                batchPointer(static_cast<const DType*>(a), pointerArray, batch, batchStride),
+                batchPointer(static_cast<const DType*>(b), pointerArray, batch, batchStride),
+                alpha,
+                beta,
+                blockRow,
+                blockCol,
+                numRows,
+                numCols,
+                ldA,
+                ldB,
+                ldC,
+                rowMajA != transA,
+                rowMajB != transB,
+                rowMajC);
+            // The next tile overwrites LDS that is still being read by the store
+            __syncthreads();
+        }
+    }
+
+    // Persistent transform of many matrices of different shapes. The tiles of all jobs form one
+    // flattened space that the workgroups stride over, so every workgroup gets the same number
+    // of equally sized tiles whatever the mix of shapes. The job of a tile is found by a binary
+    // search over the tile starts of the jobs, which is uniform across the workgroup.
+    template <typename DType, typename ScaleType>
+    __device__ void transformGrouped(const TransformGroupedJob* jobs,
+                                     uint32_t                   numJobs,
+                                     uint64_t                   numWork,
+                                     ScaleType                  alpha,
+                                     const ScaleType*           alphaPtr,
+                                     ScaleType                  beta,
+                                     const ScaleType*           betaPtr)
+    {
+        constexpr uint32_t TileM = 32;
+        constexpr uint32_t TileN = 32;
+        __shared__ ScaleType tile[TileM][TileN + 1];
+
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        if(betaPtr)
+        {
+            beta = *betaPtr;
+        }
+
+        for(uint64_t work = blockIdx.x; work < numWork; work += gridDim.x)
+        {
+            uint32_t first = 0;
+            uint32_t last  = numJobs - 1;
+
+            while(first < last)
+            {
+                const auto mid = (first + last + 1) / 2;
+
+                if(jobs[mid].tileStart <= work)
+                {
+                    first = mid;
+                }
+                else
+                {
+                    last = mid - 1;
+                }
+            }
+
+            const auto job       = jobs[first];
+            const auto numTilesM = job.numRows / TileM + !!(job.numRows % TileM);
+            const auto numTilesN = job.numCols / TileN + !!(job.numCols % TileN);
+            const auto numTiles  = numTilesM * numTilesN;
+            const auto jobWork   = work - job.tileStart;
+            const auto batch     = uint32_t(jobWork / numTiles);
+            const auto tileIdx   = uint32_t(jobWork % numTiles);
+            const auto blockRow  = (tileIdx % numTilesM) * TileM;
+            const auto blockCol  = (tileIdx / numTilesM) * TileN;
+
+            transformTileAnyAlignment<DType, ScaleType, TileM, TileN>(
+                tile,
+                batchPointer(static_cast<DType*>(job.c), false, batch, job.batchStrideC),
+                batchPointer(static_cast<const DType*>(job.a), false, batch, job.batchStrideA),
+                batchPointer(static_cast<const DType*>(job.b), false, batch, job.batchStrideB),
+                alpha,
+                beta,
+                blockRow,
+                blockCol,
+                job.numRows,
+                job.numCols,
+                job.ldA,
+                job.ldB,
+                job.ldC,
+                job.alongColsA,
+                job.alongColsB,
+                job.alongColsC);
+            // The next tile overwrites LDS that is still being read by the store
+            __syncthreads();
+        }
+    }
+
+    // Swaps and transposes the 32x32 tiles (tileRow, tileCol) and (tileCol, tileRow) of a
+    // square matrix in place. Each workgroup owns one pair of the upper triangle, so no tile
+    // is read after another workgroup has written it.
+    template <typename DType, typename ScaleType>
+    __device__ void transformInPlaceSquare(DType*           c,
+                                           ScaleType        alpha,
+                                           const ScaleType* alphaPtr,
+                                           uint32_t         numRows,
+                                           uint32_t         ld,
+                                           uint32_t         batchStride)
+    {
+        constexpr uint32_t TileSize = 32;
+        __shared__ ScaleType upper[TileSize][TileSize + 1];
+        __shared__ ScaleType lower[TileSize][TileSize + 1];
+
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        // blockIdx.x enumerates tileRow <= tileCol as tileCol * (tileCol + 1) / 2 + tileRow
+        const uint32_t pair    = blockIdx.x;
+        uint32_t       tileCol = uint32_t((sqrtf(8.0f * pair + 1.0f) - 1.0f) * 0.5f);
+
+        while(tileCol * (tileCol + 1) / 2 > pair)
+        {
+            --tileCol;
+        }
+
+        while((tileCol + 1) * (tileCol + 2) / 2 <= pair)
+        {
+            ++tileCol;
+        }
+
+        const uint32_t tileRow  = pair - tileCol * (tileCol + 1) / 2;
+        const bool     diagonal = tileRow == tileCol;
+        const uint32_t rowU     = tileRow * TileSize;
+        const uint32_t colU     = tileCol * TileSize;
+        DType*         mat      = c + size_t(blockIdx.z) * batchStride;
+
+        for(uint32_t idx = threadIdx.x; idx < TileSize * TileSize; idx += blockDim.x)
+        {
+            const uint32_t r = idx / TileSize;
+            const uint32_t q = idx % TileSize;
+
+            if(rowU + r < numRows && colU + q < numRows)
+            {
+                upper[r][q] = static_cast<ScaleType>(mat[size_t(rowU + r) * ld + colU + q]);
+            }
+
+            if(!diagonal && colU + r < numRows && rowU + q < numRows)
+            {
+                lower[r][q] = static_cast<ScaleType>(mat[size_t(colU + r) * ld + rowU + q]);
+            }
+        }
+        __syncthreads();
+
+        for(uint32_t idx = threadIdx.x; idx < TileSize * TileSize; idx += blockDim.x)
+        {
+            const uint32_t r = idx / TileSize;
+            const uint32_t q = idx % TileSize;
+
+            if(rowU + r < numRows && colU + q < numRows)
+            {
+                const auto v = diagonal ? upper[q][r] : lower[q][r];
+                mat[size_t(rowU + r) * ld + colU + q] = static_cast<DType>(alpha * v);
+            }
+
+            if(!diagonal && colU + r < numRows && rowU + q < numRows)
+            {
+                mat[size_t(colU + r) * ld + rowU + q] = static_cast<DType>(alpha * upper[q][r]);
+            }
+        }
+    }
+
+    // Position of element k of a packed numRows x numCols matrix after transposing it to
+    // numCols x numRows: k * numRows mod (size - 1), with the last element fixed.
+    __device__ inline uint64_t inPlaceTransposeTarget(uint64_t k, uint32_t numRows, uint64_t size)
+    {
+        return k == size - 1 ? k : (k * numRows) % (size - 1);
+    }
+
+    // Cycle-following in-place transpose of packed rectangular matrices. Every thread walks
+    // the cycle of its start index until it finds a smaller index; only the thread that starts
+    // at the smallest index of a cycle moves it, so each cycle is moved exactly once.
+    template <typename DType, typename ScaleType>
+    __device__ void transformInPlaceCycle(DType*           c,
+                                          ScaleType        alpha,
+                                          const ScaleType* alphaPtr,
+                                          uint32_t         numRows,
+                                          uint32_t         numCols,
+                                          uint32_t         batchStride)
+    {
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        const uint64_t size   = uint64_t(numRows) * numCols;
+        DType*         mat    = c + size_t(blockIdx.z) * batchStride;
+        const uint64_t stride = uint64_t(gridDim.x) * blockDim.x;
+
+        for(uint64_t start = uint64_t(blockIdx.x) * blockDim.x + threadIdx.x; start < size;
+            start += stride)
+        {
+            auto next = inPlaceTransposeTarget(start, numRows, size);
+
+            while(next > start)
+            {
+                next = inPlaceTransposeTarget(next, numRows, size);
+            }
+
+            if(next != start)
+            {
+                continue;
+            }
+
+            auto carry = static_cast<ScaleType>(mat[start]);
+            auto pos   = start;
+
+            do
+            {
+                pos              = inPlaceTransposeTarget(pos, numRows, size);
+                const auto moved = static_cast<ScaleType>(mat[pos]);
+                mat[pos]         = static_cast<DType>(alpha * carry);
+                carry            = moved;
+            } while(pos != start);
+        }
+    }
+
+    template <typename InType>
+    __device__ float loadAsFloat(const InType& v)
+    {
+        if constexpr(std::is_same<InType, DTypeF8>::value)
+        {
+            return hipblaslt_hip_f8_impl::cast_from_f8<3, 4, float, true>(v.data);
+        }
+        else if constexpr(std::is_same<InType, DTypeBF8>::value)
+        {
+            return hipblaslt_hip_f8_impl::cast_from_f8<2, 5, float, true>(v.data);
+        }
+        else
+        {
+            return static_cast<float>(v);
+        }
+    }
+
+    // Offset of element (row, col) in the given TransformOrder
+    __device__ inline size_t orderOffset(uint32_t order, uint32_t row, uint32_t col, uint32_t ld)
+    {
+        switch(order)
+        {
+        case TransformOrderRow:
+            return size_t(row) * ld + col;
+        case TransformOrderCol32:
+            return size_t(col / 32) * ld + row * 32 + col % 32;
+        case TransformOrderCol16_4R8:
+            return size_t(col / 16) * ld + (row / 32) * 512 + (row % 32 / 8) * 128 + (col % 16) * 8
+                   + row % 8;
+        default:
+            return size_t(col) * ld + row;
+        }
+    }
+
+    // Number of elements that the workitems walk to cover a matrix in the given order,
+    // including the padding of the last tiles of the tiled orders
+    __device__ inline size_t orderNumElements(uint32_t order, uint32_t numRows, uint32_t numCols)
+    {
+        switch(order)
+        {
+        case TransformOrderCol32:
+            return size_t(numRows) * ((numCols + 31) / 32 * 32);
+        case TransformOrderCol16_4R8:
+            return size_t((numRows + 31) / 32 * 32) * ((numCols + 15) / 16 * 16);
+        default:
+            return size_t(numRows) * numCols;
+        }
+    }
+
+    // (row, col) of the idx-th element of a matrix in the given order, so that consecutive
+    // workitems write consecutive addresses within a tile or row/column
+    __device__ inline void orderCoord(
+        uint32_t order, uint32_t numRows, uint32_t numCols, size_t idx, uint32_t& row, uint32_t& col)
+    {
+        switch(order)
+        {
+        case TransformOrderRow:
+            row = idx / numCols;
+            col = idx % numCols;
+            break;
+        case TransformOrderCol32:
+        {
+            const auto panel = idx / (size_t(numRows) * 32);
+            const auto rest  = idx % (size_t(numRows) * 32);
+            row              = rest / 32;
+            col              = panel * 32 + rest % 32;
+            break;
+        }
+        case TransformOrderCol16_4R8:
+        {
+            const auto paddedRows = (numRows + 31) / 32 * 32;
+            const auto panel      = idx / (size_t(paddedRows) * 16);
+            const auto rest       = idx % (size_t(paddedRows) * 16);
+            const auto rowTile    = rest / 512;
+            const auto inTile     = rest % 512;
+            row                   = rowTile * 32 + inTile / 128 * 8 + inTile % 8;
+            col                   = panel * 16 + inTile % 128 / 8;
+            break;
+        }
+        default:
+            row = idx % numRows;
+            col = idx / numRows;
+            break;
+        }
+    }
+
+    // C = cast(scaleC * (alpha * A + beta * B)) for any memory orders of A, B and C. Meant for
+    // reordering weights into or out of tiled orders once, so it favors generality over the
+    // vectorized access of the other kernels: only the writes to C are coalesced.
+    template <typename InType, typename OutType>
+    __device__ void transformTiled(OutType*       c,
+                                   const InType*  a,
+                                   const InType*  b,
+                                   float          alpha,
+                                   const float*   alphaPtr,
+                                   float          beta,
+                                   const float*   betaPtr,
+                                   const float*   scaleCPtr,
+                                   uint32_t       numRows,
+                                   uint32_t       numCols,
+                                   uint32_t       ldA,
+                                   uint32_t       ldB,
+                                   uint32_t       ldC,
+                                   uint32_t       batchStride,
+                                   uint32_t       orderA,
+                                   uint32_t       orderB,
+                                   uint32_t       orderC,
+                                   bool           transA,
+                                   bool           transB,
+                                   bool           saturate,
+                                   bool           stochasticRounding,
+                                   uint32_t       seed)
+    {
+        if(alphaPtr)
+        {
+            alpha = *alphaPtr;
+        }
+
+        if(betaPtr)
+        {
+            beta = *betaPtr;
+        }
+
+        const float scaleC      = scaleCPtr ? *scaleCPtr : 1.0f;
+        const auto  batch       = blockIdx.z;
+        const auto  batchOffset = size_t(batch) * batchStride;
+        const auto  numElements = orderNumElements(orderC, numRows, numCols);
+        const auto  stride      = size_t(gridDim.x) * blockDim.x;
+
+        for(size_t idx = size_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < numElements;
+            idx += stride)
+        {
+            uint32_t row, col;
+            orderCoord(orderC, numRows, numCols, idx, row, col);
+            float v = 0;
+
+            if(row < numRows && col < numCols)
+            {
+                if(a)
+                {
+                    const auto offset = transA ? orderOffset(orderA, col, row, ldA)
+                                               : orderOffset(orderA, row, col, ldA);
+                    v += alpha * loadAsFloat(a[batchOffset + offset]);
+                }
+
+                if(b)
+                {
+                    const auto offset = transB ? orderOffset(orderB, col, row, ldB)
+                                               : orderOffset(orderB, row, col, ldB);
+                    v += beta * loadAsFloat(b[batchOffset + offset]);
+                }
+
+                v *= scaleC;
+            }
+
+            c[batchOffset + orderOffset(orderC, row, col, ldC)]
+                = convertScaled<OutType>(v, saturate, stochasticRounding, seed, batch, row, col);
+        }
+    }
 } // namespace amd_detail
 
+#define DEFINE_TRANSFORM_LDS_KERNEL(DTypeStr, STypeStr, RowMajA, RowMajB, RowMajC, TileM, TileN) \
+    TRANSFORM_LDS_KERNEL_SIGNATURE(DTypeStr, STypeStr, RowMajA, RowMajB, RowMajC, TileM, TileN)  \
+    {                                                                                            \
+        using DT = DTYPE(DTypeStr);                                                              \
+        using ST = DTYPE(STypeStr);                                                              \
+        amd_detail::transformLds<DT, ST, RowMajA, RowMajB, RowMajC, TileM, TileN>(c,             \
+                                                                                  a,             \
+                                                                                  b,             \
+                                                                                  alpha,         \
+                                                                                  alphaPtr,      \
+                                                                                  beta,          \
+                                                                                  betaPtr,       \
+                                                                                  numRows,       \
+                                                                                  numCols,       \
+                                                                                  ldA,           \
+                                                                                  ldB,           \
+                                                                                  ldC,           \
+                                                                                  batchStride,   \
+                                                                                  transA,        \
+                                                                                  transB);       \
+    }
+
+#define DEFINE_TRANSFORM_VARIANT_KERNEL(DTypeStr, STypeStr, TileM, TileN)          \
+    TRANSFORM_VARIANT_KERNEL_SIGNATURE(DTypeStr, STypeStr, TileM, TileN)             \
+    {                                                                                \
+        using DT = DTYPE(DTypeStr);                                                  \
+        using ST = DTYPE(STypeStr);                                                  \
+        amd_detail::transformVariant<DT, ST, TileM, TileN>(c,                        \
+                                                           a,                        \
+                                                           b,                        \
+                                                           alpha,                    \
+                                                           alphaPtr,                 \
+                                                           beta,                     \
+                                                           betaPtr,                  \
+                                                           numRows,                  \
+                                                           numCols,                  \
+                                                           ldA,                      \
+                                                           ldB,                      \
+                                                           ldC,                      \
+                                                           batchStride,              \
+                                                           rowMajA,                  \
+                                                           rowMajB,                  \
+                                                           rowMajC,                  \
+                                                           transA,                   \
+                                                           transB,                   \
+                                                           inVectorWidth,            \
+                                                           outVectorWidth);          \
+    }
+
+#define DEFINE_TRANSFORM_BATCHED_KERNEL(DTypeStr, STypeStr)                          \
+    TRANSFORM_BATCHED_KERNEL_SIGNATURE(DTypeStr, STypeStr)                             \
+    {                                                                                  \
+        using DT = DTYPE(DTypeStr);                                                    \
+        using ST = DTYPE(STypeStr);                                                    \
+        amd_detail::transformBatched<DT, ST>(c,                                        \
+                                             a,                                        \
+                                             b,                                        \
+                                             alpha,                                    \
+                                             alphaPtr,                                 \
+                                             beta,                                     \
+                                             betaPtr,                                  \
+                                             numRows,                                  \
+                                             numCols,                                  \
+                                             ldA,                                      \
+                                             ldB,                                      \
+                                             ldC,                                      \
+                                             batchStride,                              \
+                                             batchCount,                               \
+                                             rowMajA,                                  \
+                                             rowMajB,                                  \
+                                             rowMajC,                                  \
+                                             transA,                                   \
+                                             transB,                                   \
+                                             pointerArray);                            \
+    }
+
+#define DEFINE_TRANSFORM_GROUPED_KERNEL(DTypeStr, STypeStr)                  \
+    TRANSFORM_GROUPED_KERNEL_SIGNATURE(DTypeStr, STypeStr)                     \
+    {                                                                          \
+        using DT = DTYPE(DTypeStr);                                            \
+        using ST = DTYPE(STypeStr);                                            \
+        amd_detail::transformGrouped<DT, ST>(                                  \
+            jobs, numJobs, numWork, alpha, alphaPtr, beta, betaPtr);           \
+    }
+
+#define DEFINE_TRANSFORM_INPLACE_KERNELS(DTypeStr, STypeStr)                          \
+    TRANSFORM_INPLACE_KERNEL_SIGNATURE(DTypeStr, STypeStr, Square)                      \
+    {                                                                                   \
+        amd_detail::transformInPlaceSquare<DTYPE(DTypeStr), DTYPE(STypeStr)>(           \
+            c, alpha, alphaPtr, numRows, ld, batchStride);                              \
+    }                                                                                   \
+    TRANSFORM_INPLACE_KERNEL_SIGNATURE(DTypeStr, STypeStr, Cycle)                       \
+    {                                                                                   \
+        amd_detail::transformInPlaceCycle<DTYPE(DTypeStr), DTYPE(STypeStr)>(            \
+            c, alpha, alphaPtr, numRows, numCols, batchStride);                         \
+    }
+
+#define DEFINE_TRANSFORM_TILED_KERNEL(InTypeStr, OutTypeStr)   \
+    TRANSFORM_TILED_KERNEL_SIGNATURE(InTypeStr, OutTypeStr)    \
+    {                                                          \
+        using IT = DTYPE(InTypeStr);                           \
+        using OT = DTYPE(OutTypeStr);                          \
+        amd_detail::transformTiled<IT, OT>(c,                  \
+                                           a,                  \
+                                           b,                  \
+                                           alpha,              \
+                                           alphaPtr,           \
+                                           beta,               \
+                                           betaPtr,            \
+                                           scaleCPtr,          \
+                                           numRows,            \
+                                           numCols,            \
+                                           ldA,                \
+                                           ldB,                \
+                                           ldC,                \
+                                           batchStride,        \
+                                           orderA,             \
+                                           orderB,             \
+                                           orderC,             \
+                                           transA,             \
+                                           transB,             \
+                                           saturate,           \
+                                           stochasticRounding, \
+                                           seed);              \
+    }
+
+#define DEFINE_TRANSFORM_CVT_KERNEL(InTypeStr, OutTypeStr, Vectorized)                      \
+    TRANSFORM_CVT_KERNEL_SIGNATURE(InTypeStr, OutTypeStr, Vectorized)                         \
+    {                                                                                         \
+        using IT = DTYPE(InTypeStr);                                                          \
+        using OT = DTYPE(OutTypeStr);                                                         \
+        amd_detail::transformConvert<IT, OT, Vectorized>(c,                                   \
+                                                         a,                                   \
+                                                         b,                                   \
+                                                         alpha,                               \
+                                                         alphaPtr,                            \
+                                                         beta,                                \
+                                                         betaPtr,                             \
+                                                         scaleCPtr,                           \
+                                                         numRows,                             \
+                                                         numCols,                             \
+                                                         ldA,                                 \
+                                                         ldB,                                 \
+                                                         ldC,                                 \
+                                                         batchStride,                         \
+                                                         rowMajA,                             \
+                                                         rowMajB,                             \
+                                                         rowMajC,                             \
+                                                         transA,                              \
+                                                         transB,                              \
+                                                         saturate,                            \
+                                                         stochasticRounding,                  \
+                                                         seed);                               \
+    }
+
+extern "C" {
+DEFINE_TRANSFORM_BATCHED_KERNEL(S, S)
+DEFINE_TRANSFORM_BATCHED_KERNEL(H, H)
+DEFINE_TRANSFORM_BATCHED_KERNEL(H, S)
+DEFINE_TRANSFORM_BATCHED_KERNEL(BF16, S)
+DEFINE_TRANSFORM_BATCHED_KERNEL(I8, S)
+DEFINE_TRANSFORM_BATCHED_KERNEL(I32, S)
+DEFINE_TRANSFORM_GROUPED_KERNEL(S, S)
+DEFINE_TRANSFORM_GROUPED_KERNEL(H, H)
+DEFINE_TRANSFORM_GROUPED_KERNEL(H, S)
+DEFINE_TRANSFORM_GROUPED_KERNEL(BF16, S)
+DEFINE_TRANSFORM_GROUPED_KERNEL(I8, S)
+DEFINE_TRANSFORM_GROUPED_KERNEL(I32, S)
+FOR_EACH_TRANSFORM_TILED_KERNEL(DEFINE_TRANSFORM_TILED_KERNEL)
+DEFINE_TRANSFORM_INPLACE_KERNELS(S, S)
+DEFINE_TRANSFORM_INPLACE_KERNELS(H, H)
+DEFINE_TRANSFORM_INPLACE_KERNELS(H, S)
+DEFINE_TRANSFORM_INPLACE_KERNELS(BF16, S)
+DEFINE_TRANSFORM_INPLACE_KERNELS(I8, S)
+DEFINE_TRANSFORM_INPLACE_KERNELS(I32, S)
+FOR_EACH_TRANSFORM_CVT_OUTPUT(DEFINE_TRANSFORM_CVT_KERNEL, S)
+FOR_EACH_TRANSFORM_CVT_OUTPUT(DEFINE_TRANSFORM_CVT_KERNEL, H)
+FOR_EACH_TRANSFORM_CVT_OUTPUT(DEFINE_TRANSFORM_CVT_KERNEL, BF16)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, S, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, S, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, H, H, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, H, H, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, H, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, H, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, BF16, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, BF16, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, I8, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, I8, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, I32, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DEFINE_TRANSFORM_LDS_KERNEL, I32, S, 128, 32)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DEFINE_TRANSFORM_VARIANT_KERNEL, S, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DEFINE_TRANSFORM_VARIANT_KERNEL, H, H)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DEFINE_TRANSFORM_VARIANT_KERNEL, H, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DEFINE_TRANSFORM_VARIANT_KERNEL, BF16, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DEFINE_TRANSFORM_VARIANT_KERNEL, I8, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DEFINE_TRANSFORM_VARIANT_KERNEL, I32, S)
+}
+
 extern "C" {
 __global__ void TRANSFORM_FUNC_NAME(S, S, 1, 1, 1, 16, 16, 1)(DTYPE(S) * c,
                                                               const DTYPE(S) * a,
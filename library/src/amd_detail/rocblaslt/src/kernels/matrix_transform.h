@@ -33,6 +33,27 @@
     Transform_##DType##_##SType##_##RowMajA##RowMajB##RowMajC##_##ThreadsM##_##ThreadsN##_VW_##VectorWidth
 #define TRANSFORM_FUNC_NAME(DType, SType, RowMajA, RowMajB, RowMajC, ThreadsM, ThreadsN, VW) \
     TRANSFORM_FUNC_NAME_HELPER(DType, SType, RowMajA, RowMajB, RowMajC, ThreadsM, ThreadsN, VW)
+#define TRANSFORM_LDS_FUNC_NAME_HELPER(DType, SType, RowMajA, RowMajB, RowMajC, TileM, TileN) \
+    TransformLds_##DType##_##SType##_##RowMajA##RowMajB##RowMajC##_##TileM##_##TileN
+#define TRANSFORM_LDS_FUNC_NAME(DType, SType, RowMajA, RowMajB, RowMajC, TileM, TileN) \
+    TRANSFORM_LDS_FUNC_NAME_HELPER(DType, SType, RowMajA, RowMajB, RowMajC, TileM, TileN)
+#define TRANSFORM_VARIANT_FUNC_NAME_HELPER(DType, SType, TileM, TileN) \
+    TransformVariant_##DType##_##SType##_##TileM##_##TileN
+#define TRANSFORM_VARIANT_FUNC_NAME(DType, SType, TileM, TileN) \
+    TRANSFORM_VARIANT_FUNC_NAME_HELPER(DType, SType, TileM, TileN)
+#define TRANSFORM_CVT_FUNC_NAME_HELPER(InType, OutType, Vectorized) \
+    TransformCvt_##InType##_##OutType##_V##Vectorized
+#define TRANSFORM_CVT_FUNC_NAME(InType, OutType, Vectorized) \
+    TRANSFORM_CVT_FUNC_NAME_HELPER(InType, OutType, Vectorized)
+#define TRANSFORM_BATCHED_FUNC_NAME_HELPER(DType, SType) TransformBatched_##DType##_##SType
+#define TRANSFORM_BATCHED_FUNC_NAME(DType, SType) TRANSFORM_BATCHED_FUNC_NAME_HELPER(DType, SType)
+#define TRANSFORM_GROUPED_FUNC_NAME_HELPER(DType, SType) TransformGrouped_##DType##_##SType
+#define TRANSFORM_GROUPED_FUNC_NAME(DType, SType) TRANSFORM_GROUPED_FUNC_NAME_HELPER(DType, SType)
+#define TRANSFORM_TILED_FUNC_NAME_HELPER(InType, OutType) TransformTiled_##InType##_##OutType
+#define TRANSFORM_TILED_FUNC_NAME(InType, OutType) TRANSFORM_TILED_FUNC_NAME_HELPER(InType, OutType)
+#define TRANSFORM_INPLACE_FUNC_NAME_HELPER(DType, SType, Algo) TransformInPlace##Algo##_##DType##_##SType
+#define TRANSFORM_INPLACE_FUNC_NAME(DType, SType, Algo) \
+    TRANSFORM_INPLACE_FUNC_NAME_HELPER(DType, SType, Algo)
 #define DTYPE_HELPER(DTypeStr) DType##DTypeStr
 #define DTYPE(DTypeStr) DTYPE_HELPER(DTypeStr)
 #define STRINGIFY(x) #x
@@ -44,6 +65,268 @@ typedef hip_bfloat16 DTypeBF16;
 typedef int32_t      DTypeI32;
 typedef int8_t       DTypeI8;
 
+// FP8 (E4M3) and BF8 (E5M2) fnuz storage, converted to with castToFloat8
+struct Float8Fnuz
+{
+    uint8_t data;
+};
+
+struct BFloat8Fnuz
+{
+    uint8_t data;
+};
+
+typedef Float8Fnuz  DTypeF8;
+typedef BFloat8Fnuz DTypeBF8;
+
+// Memory orders, with the values of hipblasLtOrder_t. Element (row, col) of a matrix with
+// leading dimension ld is at
+//   Col:       col * ld + row
+//   Row:       row * ld + col
+//   Col32:     (col / 32) * ld + row * 32 + col % 32
+//   Col16_4R8: (col / 16) * ld + (row / 32) * 512 + (row % 32 / 8) * 128 + (col % 16) * 8
+//              + row % 8
+enum TransformOrder : uint32_t
+{
+    TransformOrderCol       = 0,
+    TransformOrderRow       = 1,
+    TransformOrderCol32     = 2,
+    TransformOrderCol16_4R8 = 100,
+};
+
+// LDS-staged kernels share the argument list of the 16x16 kernels. They are instantiated for
+// every RowMaj{A/B/C} combination with FOR_EACH_TRANSFORM_ORDER.
+#define TRANSFORM_LDS_KERNEL_SIGNATURE(                                                     \
+    DTypeStr, STypeStr, RowMajA, RowMajB, RowMajC, TileM, TileN)                            \
+    __global__ void TRANSFORM_LDS_FUNC_NAME(                                                \
+        DTypeStr, STypeStr, RowMajA, RowMajB, RowMajC, TileM, TileN)(                       \
+        DTYPE(DTypeStr) * c,                                                                \
+        const DTYPE(DTypeStr) * a,                                                          \
+        const DTYPE(DTypeStr) * b,                                                          \
+        DTYPE(STypeStr) alpha,                                                              \
+        const DTYPE(STypeStr) * alphaPtr,                                                   \
+        DTYPE(STypeStr) beta,                                                               \
+        const DTYPE(STypeStr) * betaPtr,                                                    \
+        uint32_t numRows,                                                                   \
+        uint32_t numCols,                                                                   \
+        uint32_t ldA,                                                                       \
+        uint32_t ldB,                                                                       \
+        uint32_t ldC,                                                                       \
+        uint32_t batchStride,                                                               \
+        bool     transA,                                                                    \
+        bool     transB)
+#define DECLARE_TRANSFORM_LDS_KERNEL(DTypeStr, STypeStr, RowMajA, RowMajB, RowMajC, TileM, TileN) \
+    TRANSFORM_LDS_KERNEL_SIGNATURE(DTypeStr, STypeStr, RowMajA, RowMajB, RowMajC, TileM, TileN);
+#define FOR_EACH_TRANSFORM_ORDER(MACRO, DTypeStr, STypeStr, TileM, TileN) \
+    MACRO(DTypeStr, STypeStr, 1, 1, 1, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 1, 1, 0, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 1, 0, 1, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 1, 0, 0, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 0, 1, 1, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 0, 1, 0, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 0, 0, 1, TileM, TileN)                      \
+    MACRO(DTypeStr, STypeStr, 0, 0, 0, TileM, TileN)
+
+// LDS-staged kernels with the orders and the vector widths of the input and output accesses as
+// arguments, for the operands whose alignment rules out the 128-bit kernels and for skinny
+// matrices. Vector widths are in elements and are 16, 8 or 4 bytes wide, or 1.
+#define TRANSFORM_VARIANT_KERNEL_SIGNATURE(DTypeStr, STypeStr, TileM, TileN)             \
+    __global__ void TRANSFORM_VARIANT_FUNC_NAME(DTypeStr, STypeStr, TileM, TileN)(       \
+        DTYPE(DTypeStr) * c,                                                             \
+        const DTYPE(DTypeStr) * a,                                                       \
+        const DTYPE(DTypeStr) * b,                                                       \
+        DTYPE(STypeStr) alpha,                                                           \
+        const DTYPE(STypeStr) * alphaPtr,                                                \
+        DTYPE(STypeStr) beta,                                                            \
+        const DTYPE(STypeStr) * betaPtr,                                                 \
+        uint32_t numRows,                                                                \
+        uint32_t numCols,                                                                \
+        uint32_t ldA,                                                                    \
+        uint32_t ldB,                                                                    \
+        uint32_t ldC,                                                                    \
+        uint32_t batchStride,                                                            \
+        bool     rowMajA,                                                                \
+        bool     rowMajB,                                                                \
+        bool     rowMajC,                                                                \
+        bool     transA,                                                                 \
+        bool     transB,                                                                 \
+        uint32_t inVectorWidth,                                                          \
+        uint32_t outVectorWidth)
+#define DECLARE_TRANSFORM_VARIANT_KERNEL(DTypeStr, STypeStr, TileM, TileN) \
+    TRANSFORM_VARIANT_KERNEL_SIGNATURE(DTypeStr, STypeStr, TileM, TileN);
+#define FOR_EACH_TRANSFORM_VARIANT_TILE(MACRO, DTypeStr, STypeStr) \
+    MACRO(DTypeStr, STypeStr, 64, 64)                              \
+    MACRO(DTypeStr, STypeStr, 128, 32)                             \
+    MACRO(DTypeStr, STypeStr, 32, 128)                             \
+    MACRO(DTypeStr, STypeStr, 256, 4)                              \
+    MACRO(DTypeStr, STypeStr, 4, 256)
+
+// Type converting kernels take the orders as arguments, so there is one kernel per input type,
+// output type and vectorization.
+#define TRANSFORM_CVT_KERNEL_SIGNATURE(InTypeStr, OutTypeStr, Vectorized)                   \
+    __global__ void TRANSFORM_CVT_FUNC_NAME(InTypeStr, OutTypeStr, Vectorized)(             \
+        DTYPE(OutTypeStr) * c,                                                              \
+        const DTYPE(InTypeStr) * a,                                                         \
+        const DTYPE(InTypeStr) * b,                                                         \
+        float        alpha,                                                                 \
+        const float* alphaPtr,                                                              \
+        float        beta,                                                                  \
+        const float* betaPtr,                                                               \
+        const float* scaleCPtr,                                                             \
+        uint32_t     numRows,                                                               \
+        uint32_t     numCols,                                                               \
+        uint32_t     ldA,                                                                   \
+        uint32_t     ldB,                                                                   \
+        uint32_t     ldC,                                                                   \
+        uint32_t     batchStride,                                                           \
+        bool         rowMajA,                                                               \
+        bool         rowMajB,                                                               \
+        bool         rowMajC,                                                               \
+        bool         transA,                                                                \
+        bool         transB,                                                                \
+        bool         saturate,                                                              \
+        bool         stochasticRounding,                                                    \
+        uint32_t     seed)
+#define DECLARE_TRANSFORM_CVT_KERNEL(InTypeStr, OutTypeStr, Vectorized) \
+    TRANSFORM_CVT_KERNEL_SIGNATURE(InTypeStr, OutTypeStr, Vectorized);
+#define FOR_EACH_TRANSFORM_CVT_OUTPUT(MACRO, InTypeStr) \
+    MACRO(InTypeStr, S, 0)                              \
+    MACRO(InTypeStr, S, 1)                              \
+    MACRO(InTypeStr, H, 0)                              \
+    MACRO(InTypeStr, H, 1)                              \
+    MACRO(InTypeStr, BF16, 0)                           \
+    MACRO(InTypeStr, BF16, 1)                           \
+    MACRO(InTypeStr, F8, 0)                             \
+    MACRO(InTypeStr, F8, 1)                             \
+    MACRO(InTypeStr, BF8, 0)                            \
+    MACRO(InTypeStr, BF8, 1)
+
+// Persistent kernel that walks all tiles of all batches with a grid sized to the device. c, a
+// and b point to the first matrix of a strided batch, or to device arrays of batchCount
+// matrix pointers when pointerArray is set. Orders are runtime arguments and 128-bit accesses
+// are chosen per matrix from the alignment of its pointers and leading dimensions.
+#define TRANSFORM_BATCHED_KERNEL_SIGNATURE(DTypeStr, STypeStr)                   \
+    __global__ void TRANSFORM_BATCHED_FUNC_NAME(DTypeStr, STypeStr)(             \
+        void*       c,                                                           \
+        const void* a,                                                           \
+        const void* b,                                                           \
+        DTYPE(STypeStr) alpha,                                                   \
+        const DTYPE(STypeStr) * alphaPtr,                                        \
+        DTYPE(STypeStr) beta,                                                    \
+        const DTYPE(STypeStr) * betaPtr,                                         \
+        uint32_t numRows,                                                        \
+        uint32_t numCols,                                                        \
+        uint32_t ldA,                                                            \
+        uint32_t ldB,                                                            \
+        uint32_t ldC,                                                            \
+        uint32_t batchStride,                                                    \
+        uint32_t batchCount,                                                     \
+        bool     rowMajA,                                                        \
+        bool     rowMajB,                                                        \
+        bool     rowMajC,                                                        \
+        bool     transA,                                                         \
+        bool     transB,                                                         \
+        bool     pointerArray)
+#define DECLARE_TRANSFORM_BATCHED_KERNEL(DTypeStr, STypeStr) \
+    TRANSFORM_BATCHED_KERNEL_SIGNATURE(DTypeStr, STypeStr);
+
+// One matrix of the grouped kernel. tileStart is the first tile of the job in the flattened
+// (job, batch, tile) space of the group, and jobs are sorted by it. The alongCols flags are set
+// when consecutive columns of op(A), op(B) and C are contiguous in memory.
+struct TransformGroupedJob
+{
+    void*       c;
+    const void* a;
+    const void* b;
+    size_t      batchStrideA;
+    size_t      batchStrideB;
+    size_t      batchStrideC;
+    uint64_t    tileStart;
+    uint32_t    numRows;
+    uint32_t    numCols;
+    uint32_t    ldA;
+    uint32_t    ldB;
+    uint32_t    ldC;
+    uint32_t    batchCount;
+    bool        alongColsA;
+    bool        alongColsB;
+    bool        alongColsC;
+};
+
+// Persistent kernel that walks the numWork tiles of numJobs matrices of different shapes in
+// one launch. jobs is a device array of TransformGroupedJob.
+#define TRANSFORM_GROUPED_KERNEL_SIGNATURE(DTypeStr, STypeStr)       \
+    __global__ void TRANSFORM_GROUPED_FUNC_NAME(DTypeStr, STypeStr)( \
+        const TransformGroupedJob* jobs,                             \
+        uint32_t                   numJobs,                          \
+        uint64_t                   numWork,                          \
+        DTYPE(STypeStr) alpha,                                       \
+        const DTYPE(STypeStr) * alphaPtr,                            \
+        DTYPE(STypeStr) beta,                                        \
+        const DTYPE(STypeStr) * betaPtr)
+#define DECLARE_TRANSFORM_GROUPED_KERNEL(DTypeStr, STypeStr) \
+    TRANSFORM_GROUPED_KERNEL_SIGNATURE(DTypeStr, STypeStr);
+
+// Element-wise kernels for any TransformOrder of A, B and C, including the tiled orders. The
+// workitems walk C in its memory order, and elements of a tiled C that lie in the padding of
+// its last tiles are zeroed. Otherwise the arguments are those of the converting kernels.
+#define TRANSFORM_TILED_KERNEL_SIGNATURE(InTypeStr, OutTypeStr)                   \
+    __global__ void TRANSFORM_TILED_FUNC_NAME(InTypeStr, OutTypeStr)(             \
+        DTYPE(OutTypeStr) * c,                                                    \
+        const DTYPE(InTypeStr) * a,                                               \
+        const DTYPE(InTypeStr) * b,                                               \
+        float        alpha,                                                       \
+        const float* alphaPtr,                                                    \
+        float        beta,                                                        \
+        const float* betaPtr,                                                     \
+        const float* scaleCPtr,                                                   \
+        uint32_t     numRows,                                                     \
+        uint32_t     numCols,                                                     \
+        uint32_t     ldA,                                                         \
+        uint32_t     ldB,                                                         \
+        uint32_t     ldC,                                                         \
+        uint32_t     batchStride,                                                 \
+        uint32_t     orderA,                                                      \
+        uint32_t     orderB,                                                      \
+        uint32_t     orderC,                                                      \
+        bool         transA,                                                      \
+        bool         transB,                                                      \
+        bool         saturate,                                                    \
+        bool         stochasticRounding,                                          \
+        uint32_t     seed)
+#define DECLARE_TRANSFORM_TILED_KERNEL(InTypeStr, OutTypeStr) \
+    TRANSFORM_TILED_KERNEL_SIGNATURE(InTypeStr, OutTypeStr);
+#define FOR_EACH_TRANSFORM_TILED_KERNEL(MACRO) \
+    MACRO(S, S)                                \
+    MACRO(H, H)                                \
+    MACRO(BF16, BF16)                          \
+    MACRO(I8, I8)                              \
+    MACRO(F8, F8)                              \
+    MACRO(BF8, BF8)                            \
+    MACRO(S, F8)                               \
+    MACRO(H, F8)                               \
+    MACRO(BF16, F8)                            \
+    MACRO(S, BF8)                              \
+    MACRO(H, BF8)                              \
+    MACRO(BF16, BF8)
+
+// In-place transposes of c, which holds numRows x numCols matrices with contiguous columns,
+// into numCols x numRows matrices scaled by alpha. Algo Square swaps pairs of tiles of square
+// matrices with leading dimension ld; Cycle follows the permutation cycles of packed
+// rectangular matrices.
+#define TRANSFORM_INPLACE_KERNEL_SIGNATURE(DTypeStr, STypeStr, Algo) \
+    __global__ void TRANSFORM_INPLACE_FUNC_NAME(DTypeStr, STypeStr, Algo)( \
+        DTYPE(DTypeStr) * c,                                         \
+        DTYPE(STypeStr) alpha,                                       \
+        const DTYPE(STypeStr) * alphaPtr,                            \
+        uint32_t numRows,                                            \
+        uint32_t numCols,                                            \
+        uint32_t ld,                                                 \
+        uint32_t batchStride)
+#define DECLARE_TRANSFORM_INPLACE_KERNELS(DTypeStr, STypeStr)          \
+    TRANSFORM_INPLACE_KERNEL_SIGNATURE(DTypeStr, STypeStr, Square); \
+    TRANSFORM_INPLACE_KERNEL_SIGNATURE(DTypeStr, STypeStr, Cycle);
+
 extern "C" {
 __global__ void TRANSFORM_FUNC_NAME(S, S, 1, 1, 1, 16, 16, 1)(DTYPE(S) * c,
                                                               const DTYPE(S) * a,
@@ -1485,4 +1768,45 @@ __global__ void TRANSFORM_FUNC_NAME(I32, S, 0, 0, 0, 16, 16, 4)(DTYPE(I32) * c,
                                                                 uint32_t batchStride,
                                                                 bool     transA,
                                                                 bool     transB);
+
+DECLARE_TRANSFORM_BATCHED_KERNEL(S, S)
+DECLARE_TRANSFORM_BATCHED_KERNEL(H, H)
+DECLARE_TRANSFORM_BATCHED_KERNEL(H, S)
+DECLARE_TRANSFORM_BATCHED_KERNEL(BF16, S)
+DECLARE_TRANSFORM_BATCHED_KERNEL(I8, S)
+DECLARE_TRANSFORM_BATCHED_KERNEL(I32, S)
+DECLARE_TRANSFORM_GROUPED_KERNEL(S, S)
+DECLARE_TRANSFORM_GROUPED_KERNEL(H, H)
+DECLARE_TRANSFORM_GROUPED_KERNEL(H, S)
+DECLARE_TRANSFORM_GROUPED_KERNEL(BF16, S)
+DECLARE_TRANSFORM_GROUPED_KERNEL(I8, S)
+DECLARE_TRANSFORM_GROUPED_KERNEL(I32, S)
+FOR_EACH_TRANSFORM_TILED_KERNEL(DECLARE_TRANSFORM_TILED_KERNEL)
+DECLARE_TRANSFORM_INPLACE_KERNELS(S, S)
+DECLARE_TRANSFORM_INPLACE_KERNELS(H, H)
+DECLARE_TRANSFORM_INPLACE_KERNELS(H, S)
+DECLARE_TRANSFORM_INPLACE_KERNELS(BF16, S)
+DECLARE_TRANSFORM_INPLACE_KERNELS(I8, S)
+DECLARE_TRANSFORM_INPLACE_KERNELS(I32, S)
+FOR_EACH_TRANSFORM_CVT_OUTPUT(DECLARE_TRANSFORM_CVT_KERNEL, S)
+FOR_EACH_TRANSFORM_CVT_OUTPUT(DECLARE_TRANSFORM_CVT_KERNEL, H)
+FOR_EACH_TRANSFORM_CVT_OUTPUT(DECLARE_TRANSFORM_CVT_KERNEL, BF16)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, S, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, S, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, H, H, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, H, H, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, H, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, H, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, BF16, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, BF16, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, I8, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, I8, S, 128, 32)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, I32, S, 64, 64)
+FOR_EACH_TRANSFORM_ORDER(DECLARE_TRANSFORM_LDS_KERNEL, I32, S, 128, 32)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DECLARE_TRANSFORM_VARIANT_KERNEL, S, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DECLARE_TRANSFORM_VARIANT_KERNEL, H, H)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DECLARE_TRANSFORM_VARIANT_KERNEL, H, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DECLARE_TRANSFORM_VARIANT_KERNEL, BF16, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DECLARE_TRANSFORM_VARIANT_KERNEL, I8, S)
+FOR_EACH_TRANSFORM_VARIANT_TILE(DECLARE_TRANSFORM_VARIANT_KERNEL, I32, S)
 }
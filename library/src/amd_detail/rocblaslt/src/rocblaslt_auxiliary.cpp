@@ -24,11 +24,15 @@
  *
  * ************************************************************************ */
 
+#include "CallTiming.hpp"
+#include "Debug.hpp"
+#include "OnlineTuning.hpp"
 #include "UserDrivenTuningParser.hpp"
 #include "definitions.h"
 #include "handle.h"
 #include "rocblaslt.h"
 #include "rocblaslt_mat_utils.hpp"
+#include "rocblaslt_skinny.hpp"
 #include "tensile_host.hpp"
 #include "utility.hpp"
 
@@ -36,6 +40,9 @@
 #include <link.h>
 #endif
 
+#include <Tensile/hip/HipHardware.hpp>
+#include <algorithm>
+#include <array>
 #include <hip/hip_runtime_api.h>
 #include <map>
 #include <unistd.h>
@@ -104,59 +111,68 @@ inline bool
     return (index == -1) ? false : true;
 }
 
+// Puts the solution of the index first if it supports the problem
+bool problem_override_from_index(rocblaslt_handle&                 handle,
+                                 rocblaslt_matmul_preference&      pref,
+                                 RocblasltContractionProblem&      problem,
+                                 rocblaslt_matmul_desc&            matmul_desc,
+                                 rocblaslt_matmul_heuristic_result heuristicResultsArray[],
+                                 int                               index)
+{
+    std::vector<rocblaslt_matmul_heuristic_result> overrideResults;
+    std::vector<int>                               solutionIndex(1, index);
+
+    if(rocblaslt_status_success
+       == getSolutionsFromIndex(handle, solutionIndex, overrideResults, pref->max_workspace_bytes))
+    {
+
+        size_t required_workspace_size = 0;
+        auto&  tensile_data            = matmul_desc->m_data;
+
+        if(rocblaslt_status_success
+           == isSolutionSupported(handle,
+                                  problem,
+                                  tensile_data,
+                                  &overrideResults[0].algo,
+                                  &required_workspace_size))
+        {
+
+            heuristicResult_copy(&heuristicResultsArray[0],
+                                 &overrideResults[0],
+                                 pref->max_workspace_bytes,
+                                 required_workspace_size);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // Preload problem/solution mappings
 bool problem_override_from_file(rocblaslt_handle&                 handle,
                                 rocblaslt_matmul_preference&      pref,
                                 RocblasltContractionProblem&      problem,
                                 rocblaslt_matmul_desc&            matmul_desc,
                                 rocblaslt_matmul_heuristic_result heuristicResultsArray[],
-                                const std::string&                file_path)
+                                const OverrideSingleton&          override)
 {
 
-    bool success = false;
-    TensileLite::getContractionProblemsFromFile(file_path);
-    TensileLite::OverrideMap& m_override = TensileLite::OverrideMap::getMap();
+    bool                         success = false;
+    std::vector<int>             solutionIndex(1);
+    TensileLite::ProblemOverride prob_key(RocblasltContractionProblem2ProblemOverride(problem));
+    auto indices = TensileLite::overrideSolutionIndices(prob_key, override);
 
-    if(m_override.size() == 0)
+    if(indices.empty())
     {
         log_info(__func__, "No valid entries found in override file.");
     }
     else
     {
-        std::vector<rocblaslt_matmul_heuristic_result> overrideResults;
-        std::vector<int>                               solutionIndex(1);
-        TensileLite::ProblemOverride prob_key(RocblasltContractionProblem2ProblemOverride(problem));
-        auto                         sol_iter = m_override.find(prob_key);
-
-        for(auto sol_idx = std::make_reverse_iterator(sol_iter.second);
-            !success && sol_idx != std::make_reverse_iterator(sol_iter.first);
-            sol_idx++)
+        for(size_t i = 0; !success && i < indices.size(); i++)
         {
-            solutionIndex[0] = sol_idx->second;
-
-            if(rocblaslt_status_success
-               == getSolutionsFromIndex(
-                   handle, solutionIndex, overrideResults, pref->max_workspace_bytes))
-            {
-
-                size_t required_workspace_size = 0;
-                auto&  tensile_data            = matmul_desc->m_data;
-
-                if(rocblaslt_status_success
-                   == isSolutionSupported(handle,
-                                          problem,
-                                          tensile_data,
-                                          &overrideResults[0].algo,
-                                          &required_workspace_size))
-                {
-
-                    heuristicResult_copy(&heuristicResultsArray[0],
-                                         &overrideResults[0],
-                                         pref->max_workspace_bytes,
-                                         required_workspace_size);
-                    success = true;
-                }
-            }
+            solutionIndex[0] = indices[i];
+            success          = problem_override_from_index(
+                handle, pref, problem, matmul_desc, heuristicResultsArray, solutionIndex[0]);
         }
 
         if(!success)
@@ -174,20 +190,52 @@ bool problem_override_from_file(rocblaslt_handle&                 handle,
     return success;
 }
 
+// Uses the solution that online tuning found fastest for the problem
+bool problem_override_from_online_tuning(rocblaslt_handle&                 handle,
+                                         rocblaslt_matmul_preference&      pref,
+                                         RocblasltContractionProblem&      problem,
+                                         rocblaslt_matmul_desc&            matmul_desc,
+                                         rocblaslt_matmul_heuristic_result heuristicResultsArray[])
+{
+    int  index   = OnlineTuning::getInstance().winner(
+        RocblasltContractionProblem2ProblemOverride(problem));
+    bool success = index >= 0
+                   && problem_override_from_index(
+                       handle, pref, problem, matmul_desc, heuristicResultsArray, index);
+
+    if(success)
+    {
+        std::string mapping_result = "Find tuned solution with index: ";
+        mapping_result += std::to_string(index);
+        log_info(__func__, mapping_result);
+    }
+
+    return success;
+}
+
 bool problem_override_from_file_cpp(
     rocblaslt_handle&                               handle,
     rocblaslt::RocGemmType&                         gemmType,
     std::shared_ptr<void>                           gemmData,
     size_t                                          workspaceSizeInBytes,
     std::vector<rocblaslt_matmul_heuristic_result>& heuristicResultsArray,
-    const std::string&                              file_path)
+    const OverrideSingleton&                        override,
+    float                                           energyLatencyBound)
 {
 
-    bool success = false;
-    TensileLite::getContractionProblemsFromFile(file_path);
-    TensileLite::OverrideMap& m_override = TensileLite::OverrideMap::getMap();
+    bool                         success = false;
+    TensileLite::ProblemOverride prob_key(TensileDataGemm2ProblemOverride(gemmData));
+    auto indices = TensileLite::overrideSolutionIndices(prob_key, override);
+
+    // The least energy entries within the latency bound go before the file order
+    auto efficient
+        = TensileLite::energyEfficientSolutionIndices(prob_key, override, energyLatencyBound);
+    for(auto index : indices)
+        if(std::find(efficient.begin(), efficient.end(), index) == efficient.end())
+            efficient.push_back(index);
+    indices = std::move(efficient);
 
-    if(m_override.size() == 0)
+    if(indices.empty())
     {
         log_info(__func__, "No valid entries found in override file.");
     }
@@ -195,14 +243,10 @@ bool problem_override_from_file_cpp(
     {
         std::vector<rocblaslt_matmul_heuristic_result> overrideResults;
         std::vector<int>                               solutionIndex(1);
-        TensileLite::ProblemOverride prob_key(TensileDataGemm2ProblemOverride(gemmData));
-        auto                         sol_iter = m_override.find(prob_key);
 
-        for(auto sol_idx = std::make_reverse_iterator(sol_iter.second);
-            !success && sol_idx != std::make_reverse_iterator(sol_iter.first);
-            sol_idx++)
+        for(size_t i = 0; !success && i < indices.size(); i++)
         {
-            solutionIndex[0]        = sol_idx->second;
+            solutionIndex[0]        = indices[i];
             size_t maxWorkspaceSize = std::numeric_limits<size_t>::max();
             if(rocblaslt_status_success
                == getSolutionsFromIndex(handle, solutionIndex, overrideResults, maxWorkspaceSize))
@@ -252,6 +296,26 @@ RocblasltContractionProblem construct_rocblaslt_problem(rocblaslt_handle
                                                         const void*                 beta,
                                                         size_t maxWorkSpaceBytes)
 {
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmA, gemmB, gemmC, gemmD;
+    size_t                   passBytes = 0;
+    if(innerGemmProblem(*matmul_descr,
+                        *matA,
+                        *matB,
+                        *matC,
+                        *matD,
+                        gemmDesc,
+                        gemmA,
+                        gemmB,
+                        gemmC,
+                        gemmD,
+                        &passBytes))
+    {
+        size_t gemmWorkSpaceBytes = maxWorkSpaceBytes - std::min(maxWorkSpaceBytes, passBytes);
+        return construct_rocblaslt_problem(
+            handle, &gemmDesc, &gemmA, &gemmB, &gemmC, &gemmD, alpha, beta, gemmWorkSpaceBytes);
+    }
+
     int8_t      dummy;
     const void* dummy_ptr = &dummy;
     int64_t     m, n, k, lda, ldb, ldc, ldd, lde, batch_stride_a, batch_stride_b, batch_stride_c,
@@ -303,8 +367,8 @@ RocblasltContractionProblem construct_rocblaslt_problem(rocblaslt_handle
     }
 
     // Internal assign
-    hipblasOperation_t opA           = matmul_descr->op_A;
-    hipblasOperation_t opB           = matmul_descr->op_B;
+    hipblasOperation_t opA           = matmulKernelOp(matmul_descr->op_A, matA);
+    hipblasOperation_t opB           = matmulKernelOp(matmul_descr->op_B, matB);
     int                num_batches_a = matA->batch_count;
     rocblaslt_epilogue epilogue      = matmul_descr->epilogue;
     void*              scaleA        = matmul_descr->scaleA;
@@ -376,6 +440,11 @@ RocblasltContractionProblem construct_rocblaslt_problem(rocblaslt_handle
                                         maxWorkSpaceBytes,
                                         nullptr,
                                         handle->Synchronizer};
+    problem.deterministicReduction = matmul_descr->reduce_deterministic != 0;
+    problem.cuBudget               = std::max(matmul_descr->cu_budget, 0);
+    problem.sparseA                = matA->sparsity != HIPBLASLT_SPARSITY_DENSE;
+    problem.cachePolicyD           = rocblaslt_cache_policy(matmul_descr->cache_policy_d);
+    problem.cachePolicyB           = rocblaslt_cache_policy(matmul_descr->cache_policy_b);
 
     return problem;
 }
@@ -406,11 +475,15 @@ rocblaslt_status rocblaslt_create(rocblaslt_handle* handle)
         try
         {
             *handle = new _rocblaslt_handle();
+            initTensileExecCache(*handle);
+            initTensileSynchronizerPool(*handle);
+            initTensileHostStagingRing(*handle);
+            initTensilePreloadManifest(*handle);
             log_api(__func__, "handle[out]", *handle);
         }
-        catch(const rocblaslt_status& status)
+        catch(...)
         {
-            return status;
+            return exception_to_rocblaslt_status();
         }
         return rocblaslt_status_success;
     }
@@ -607,6 +680,42 @@ rocblaslt_status rocblaslt_matrix_layout_set_attribute(rocblaslt_matrix_layout
                     return rocblaslt_status_invalid_value;
                 }
                 break;
+            case ROCBLASLT_MATRIX_LAYOUT_BATCH_MODE:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matLayout->batch_mode, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATRIX_LAYOUT_SPARSITY:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matLayout->sparsity, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matLayout->outer_batch_count, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE:
+                if(sizeof(int64_t) <= sizeInBytes)
+                    memcpy(&matLayout->outer_batch_stride, buf, sizeof(int64_t));
+                else
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
             default:
                 log_error(__func__, "invalid attribute", attr);
                 return rocblaslt_status_invalid_value;
@@ -683,6 +792,46 @@ rocblaslt_status rocblaslt_matrix_layout_get_attribute(rocblaslt_matrix_layout
                 }
                 memcpy(buf, &matLayout->batch_stride, sizeof(int64_t));
                 break;
+            case ROCBLASLT_MATRIX_LAYOUT_BATCH_MODE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matLayout->batch_mode, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATRIX_LAYOUT_SPARSITY:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matLayout->sparsity, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matLayout->outer_batch_count, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int64_t);
+                if(sizeInBytes < sizeof(int64_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matLayout->outer_batch_stride, sizeof(int64_t));
+                break;
             default:
                 log_error(__func__, "invalid attribute", attr);
                 return rocblaslt_status_invalid_value;
@@ -730,6 +879,7 @@ rocblaslt_status rocblaslt_matmul_desc_create(rocblaslt_matmul_desc* matmulDesc,
             {
             case rocblaslt_compute_f32:
             case rocblaslt_compute_f32_fast_xf32:
+            case rocblaslt_compute_f32_fast_3xbf16:
             case rocblaslt_compute_f64:
             case rocblaslt_compute_i32:
             case rocblaslt_compute_f32_fast_f16:
@@ -756,14 +906,16 @@ rocblaslt_status rocblaslt_matmul_desc_create(rocblaslt_matmul_desc* matmulDesc,
                 throw rocblaslt_status_invalid_value;
             }
 
+            // The xf32 and 3xbf16 compute types run f32 GEMMs
+            const bool fastF32 = computeType == rocblaslt_compute_f32_fast_xf32
+                                 || computeType == rocblaslt_compute_f32_fast_3xbf16;
+
             *matmulDesc = new _rocblaslt_matmul_desc();
 
             (*matmulDesc)->compute_type          = computeType;
             (*matmulDesc)->compute_type_original = computeType;
             (*matmulDesc)->scale_type            = scaleType;
-            auto computeTypeInit                 = computeType == rocblaslt_compute_f32_fast_xf32
-                                                       ? rocblaslt_compute_f32
-                                                       : computeType;
+            auto computeTypeInit                 = fastF32 ? rocblaslt_compute_f32 : computeType;
             auto dataType                        = HIP_R_32F;
             if(computeTypeInit == rocblaslt_compute_f64)
                 dataType = HIP_R_64F;
@@ -958,7 +1110,11 @@ rocblaslt_status rocblaslt_matmul_desc_set_attribute(rocblaslt_matmul_desc
                     return rocblaslt_status_invalid_value;
                 }
                 break;
+            case ROCBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT:
+                matmulDesc->isScaleDVec = true;
             case ROCBLASLT_MATMUL_DESC_D_SCALE_POINTER:
+                if(matmulAttr == ROCBLASLT_MATMUL_DESC_D_SCALE_POINTER)
+                    matmulDesc->isScaleDVec = false;
                 if(sizeof(void*) <= sizeInBytes)
                     memcpy(&matmulDesc->scaleD, buf, sizeof(void*));
                 else
@@ -967,6 +1123,19 @@ rocblaslt_status rocblaslt_matmul_desc_set_attribute(rocblaslt_matmul_desc
                     return rocblaslt_status_invalid_value;
                 }
                 break;
+            case ROCBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT:
+                if(sizeof(int32_t) <= sizeInBytes)
+                {
+                    int32_t alongN;
+                    memcpy(&alongN, buf, sizeof(int32_t));
+                    matmulDesc->scaleDVecAlongN = alongN != 0;
+                }
+                else
+                {
+                    log_error(__func__, "invalid scaleD along N buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
             case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_SCALE_POINTER:
                 if(sizeof(void*) <= sizeInBytes)
                     memcpy(&matmulDesc->scaleE, buf, sizeof(void*));
@@ -1030,179 +1199,870 @@ rocblaslt_status rocblaslt_matmul_desc_set_attribute(rocblaslt_matmul_desc
                     return rocblaslt_status_invalid_value;
                 }
                 break;
-            case ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_A_EXT:
-                if(sizeof(int32_t) <= sizeInBytes)
-                {
-                    memcpy(&matmulDesc->compute_input_typeA, buf, sizeof(int32_t));
-                    matmulDesc->compute_type = _matmul_desc_determine_compute_type(matmulDesc);
-                }
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->residual, buf, sizeof(void*));
                 else
                 {
-                    log_error(__func__, "invalid compute_input_typeA buf size", sizeInBytes);
+                    log_error(__func__, "invalid residual buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
                 break;
-            case ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_B_EXT:
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_DATA_TYPE:
                 if(sizeof(int32_t) <= sizeInBytes)
-                {
-                    memcpy(&matmulDesc->compute_input_typeB, buf, sizeof(int32_t));
-                    matmulDesc->compute_type = _matmul_desc_determine_compute_type(matmulDesc);
-                }
+                    memcpy(&matmulDesc->residual_type, buf, sizeof(int32_t));
                 else
                 {
-                    log_error(__func__, "invalid compute_input_typeB buf size", sizeInBytes);
+                    log_error(__func__, "invalid residual type buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
                 break;
-            default:
-                log_error(__func__, "invalid attribute", matmulAttr);
-                return rocblaslt_status_invalid_value;
-            }
-            log_api(__func__,
-                    "matmulDesc",
-                    matmulDesc,
-                    "attr",
-                    rocblaslt_matmul_desc_attributes_to_string(matmulAttr),
-                    "buf",
-                    buf,
-                    "sizeInBytes",
-                    sizeInBytes,
-                    "bufData",
-                    (void*)(uintptr_t)(*(uint32_t*)buf));
-        }
-        catch(const rocblaslt_status& status)
-        {
-            return status;
-        }
-        return rocblaslt_status_success;
-    }
-}
-
-/********************************************************************************
- * \brief sets the value of the specified attribute belonging to matrix
- *descriptor such as number of batches and their stride.
- *******************************************************************************/
-rocblaslt_status rocblaslt_matmul_desc_get_attribute(rocblaslt_matmul_desc            matmulDesc,
-                                                     rocblaslt_matmul_desc_attributes matmulAttr,
-                                                     void*                            buf,
-                                                     size_t                           sizeInBytes,
-                                                     size_t*                          sizeWritten)
-
-{
-    // Check if matmulDesc is valid
-    if(matmulDesc == nullptr)
-    {
-        log_error(__func__, "invalid matmulDescr pointer", matmulDesc);
-        return rocblaslt_status_invalid_handle;
-    }
-    else if(sizeInBytes == 0 && sizeWritten == nullptr)
-    {
-        log_error(__func__, "invalid pointer: sizeWritten can't be nullptr if sizeInBytes is 0");
-        return rocblaslt_status_invalid_pointer;
-    }
-    else if(sizeInBytes != 0 && buf == nullptr)
-    {
-        log_error(__func__, "invalid pointer: buf can't be nullptr if sizeInBytes isn't 0");
-        return rocblaslt_status_invalid_pointer;
-    }
-    else
-    {
-        try
-        {
-            switch(matmulAttr)
-            {
-            case ROCBLASLT_MATMUL_DESC_TRANSA:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(int32_t);
-                if(sizeInBytes < sizeof(int32_t))
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_LD:
+                if(sizeof(int64_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->ldr, buf, sizeof(int64_t));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid ldr buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->op_A, sizeof(int32_t));
                 break;
-            case ROCBLASLT_MATMUL_DESC_TRANSB:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(int32_t);
-                if(sizeInBytes < sizeof(int32_t))
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_BATCH_STRIDE:
+                if(sizeof(int64_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->stride_r, buf, sizeof(int64_t));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid stride_r buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->op_B, sizeof(int32_t));
                 break;
-            case ROCBLASLT_MATMUL_DESC_EPILOGUE:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(int32_t);
-                if(sizeInBytes < sizeof(int32_t))
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_POSITION:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->residual_position, buf, sizeof(int32_t));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid residual position buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->epilogue, sizeof(int32_t));
                 break;
-            case ROCBLASLT_MATMUL_DESC_BIAS_POINTER:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(void*);
-                if(sizeInBytes < sizeof(void*))
+            case ROCBLASLT_MATMUL_DESC_DROPOUT_PROBABILITY:
+                if(sizeof(float) <= sizeInBytes)
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    float dropout;
+                    memcpy(&dropout, buf, sizeof(float));
+                    if(!(dropout >= 0.f && dropout < 1.f))
+                    {
+                        log_error(__func__, "invalid dropout probability", dropout);
+                        return rocblaslt_status_invalid_value;
+                    }
+                    matmulDesc->dropout = dropout;
+                }
+                else
+                {
+                    log_error(__func__, "invalid dropout buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->bias, sizeof(void*));
                 break;
-            case ROCBLASLT_MATMUL_DESC_A_SCALE_POINTER:
-            case ROCBLASLT_MATMUL_DESC_A_SCALE_POINTER_VEC_EXT:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(void*);
-                if(sizeInBytes < sizeof(void*))
+            case ROCBLASLT_MATMUL_DESC_DROPOUT_SEED_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->dropout_seed, buf, sizeof(void*));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid dropout seed buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->scaleA, sizeof(void*));
                 break;
-            case ROCBLASLT_MATMUL_DESC_B_SCALE_POINTER:
-            case ROCBLASLT_MATMUL_DESC_B_SCALE_POINTER_VEC_EXT:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(void*);
-                if(sizeInBytes < sizeof(void*))
+            case ROCBLASLT_MATMUL_DESC_DROPOUT_OFFSET_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->dropout_offset, buf, sizeof(void*));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid dropout offset buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->scaleB, sizeof(void*));
                 break;
-            case ROCBLASLT_MATMUL_DESC_POINTER_MODE:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(int32_t);
-                if(sizeInBytes < sizeof(int32_t))
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->amax_history, buf, sizeof(void*));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid amax history buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->pointermode, sizeof(int32_t));
                 break;
-            case ROCBLASLT_MATMUL_DESC_BIAS_DATA_TYPE:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(int32_t);
-                if(sizeInBytes < sizeof(int32_t))
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->amax_history_length, buf, sizeof(int32_t));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid amax history length buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
-                memcpy(buf, &matmulDesc->bias_type, sizeof(int32_t));
                 break;
-            case ROCBLASLT_MATMUL_DESC_AMAX_D_POINTER:
-                if(sizeWritten)
-                    *sizeWritten = sizeof(void*);
-                if(sizeInBytes < sizeof(void*))
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->amax_history_index, buf, sizeof(void*));
+                else
                 {
-                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    log_error(__func__, "invalid amax history index buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->amax_history_scale, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid amax history scale buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_MARGIN:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->amax_history_margin, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid amax history margin buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_A_SCALE_MODE:
+                if(sizeof(int32_t) <= sizeInBytes)
+                {
+                    int32_t mode;
+                    memcpy(&mode, buf, sizeof(int32_t));
+                    if(mode != rocblaslt_matrix_scale_scalar_32f
+                       && mode != rocblaslt_matrix_scale_vec32_ue8m0)
+                    {
+                        log_error(__func__, "invalid A scale mode", mode);
+                        return rocblaslt_status_invalid_value;
+                    }
+                    matmulDesc->isScaleABlock = mode == rocblaslt_matrix_scale_vec32_ue8m0;
+                }
+                else
+                {
+                    log_error(__func__, "invalid A scale mode buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_SCALE_MODE:
+                if(sizeof(int32_t) <= sizeInBytes)
+                {
+                    int32_t mode;
+                    memcpy(&mode, buf, sizeof(int32_t));
+                    if(mode != rocblaslt_matrix_scale_scalar_32f
+                       && mode != rocblaslt_matrix_scale_vec32_ue8m0)
+                    {
+                        log_error(__func__, "invalid B scale mode", mode);
+                        return rocblaslt_status_invalid_value;
+                    }
+                    matmulDesc->isScaleBBlock = mode == rocblaslt_matrix_scale_vec32_ue8m0;
+                }
+                else
+                {
+                    log_error(__func__, "invalid B scale mode buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_QUANT_SCALE_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->b_quant_scale, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid B quant scale buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_QUANT_ZERO_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->b_quant_zero, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid B quant zero buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_QUANT_GROUP_SIZE:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->b_quant_group_size, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid B quant group size buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->aux_type, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid aux data type buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->aux_amax, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid aux amax buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->d2, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid D2 buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_DATA_TYPE:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->d2_type, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid D2 data type buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_LD:
+                if(sizeof(int64_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->ldd2, buf, sizeof(int64_t));
+                else
+                {
+                    log_error(__func__, "invalid D2 ld buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_BATCH_STRIDE:
+                if(sizeof(int64_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->stride_d2, buf, sizeof(int64_t));
+                else
+                {
+                    log_error(__func__, "invalid D2 batch stride buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_SCALE_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->scaleD2, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid D2 scale buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_BGRAD_DETERMINISTIC:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->bgrad_deterministic, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid bgrad deterministic buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_DETERMINISTIC_REDUCTION:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->reduce_deterministic, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid deterministic reduction buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_CU_BUDGET:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->cu_budget, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid CU budget buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_COMPLETION_FLAGS_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->completion_flags, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid completion flags buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_COMPLETION_CHUNK_COLS:
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&matmulDesc->completion_cols, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid completion chunk cols buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER:
+                if(sizeof(void*) <= sizeInBytes)
+                    memcpy(&matmulDesc->sparse_metadata_a, buf, sizeof(void*));
+                else
+                {
+                    log_error(__func__, "invalid sparse metadata buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_D_CACHE_POLICY:
+            case ROCBLASLT_MATMUL_DESC_B_CACHE_POLICY:
+            {
+                int32_t policy;
+                if(sizeof(int32_t) <= sizeInBytes)
+                    memcpy(&policy, buf, sizeof(int32_t));
+                else
+                {
+                    log_error(__func__, "invalid cache policy buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                if(policy < rocblaslt_cache_policy_default
+                   || policy > rocblaslt_cache_policy_persisting)
+                {
+                    log_error(__func__, "invalid cache policy", policy);
+                    return rocblaslt_status_invalid_value;
+                }
+                (matmulAttr == ROCBLASLT_MATMUL_DESC_D_CACHE_POLICY ? matmulDesc->cache_policy_d
+                                                                   : matmulDesc->cache_policy_b)
+                    = policy;
+                break;
+            }
+            case ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_A_EXT:
+                if(sizeof(int32_t) <= sizeInBytes)
+                {
+                    memcpy(&matmulDesc->compute_input_typeA, buf, sizeof(int32_t));
+                    matmulDesc->compute_type = _matmul_desc_determine_compute_type(matmulDesc);
+                }
+                else
+                {
+                    log_error(__func__, "invalid compute_input_typeA buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            case ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_B_EXT:
+                if(sizeof(int32_t) <= sizeInBytes)
+                {
+                    memcpy(&matmulDesc->compute_input_typeB, buf, sizeof(int32_t));
+                    matmulDesc->compute_type = _matmul_desc_determine_compute_type(matmulDesc);
+                }
+                else
+                {
+                    log_error(__func__, "invalid compute_input_typeB buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                break;
+            default:
+                log_error(__func__, "invalid attribute", matmulAttr);
+                return rocblaslt_status_invalid_value;
+            }
+            log_api(__func__,
+                    "matmulDesc",
+                    matmulDesc,
+                    "attr",
+                    rocblaslt_matmul_desc_attributes_to_string(matmulAttr),
+                    "buf",
+                    buf,
+                    "sizeInBytes",
+                    sizeInBytes,
+                    "bufData",
+                    (void*)(uintptr_t)(*(uint32_t*)buf));
+        }
+        catch(const rocblaslt_status& status)
+        {
+            return status;
+        }
+        return rocblaslt_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief sets the value of the specified attribute belonging to matrix
+ *descriptor such as number of batches and their stride.
+ *******************************************************************************/
+rocblaslt_status rocblaslt_matmul_desc_get_attribute(rocblaslt_matmul_desc            matmulDesc,
+                                                     rocblaslt_matmul_desc_attributes matmulAttr,
+                                                     void*                            buf,
+                                                     size_t                           sizeInBytes,
+                                                     size_t*                          sizeWritten)
+
+{
+    // Check if matmulDesc is valid
+    if(matmulDesc == nullptr)
+    {
+        log_error(__func__, "invalid matmulDescr pointer", matmulDesc);
+        return rocblaslt_status_invalid_handle;
+    }
+    else if(sizeInBytes == 0 && sizeWritten == nullptr)
+    {
+        log_error(__func__, "invalid pointer: sizeWritten can't be nullptr if sizeInBytes is 0");
+        return rocblaslt_status_invalid_pointer;
+    }
+    else if(sizeInBytes != 0 && buf == nullptr)
+    {
+        log_error(__func__, "invalid pointer: buf can't be nullptr if sizeInBytes isn't 0");
+        return rocblaslt_status_invalid_pointer;
+    }
+    else
+    {
+        try
+        {
+            switch(matmulAttr)
+            {
+            case ROCBLASLT_MATMUL_DESC_TRANSA:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->op_A, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_TRANSB:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->op_B, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_EPILOGUE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->epilogue, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_BIAS_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->bias, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_A_SCALE_POINTER:
+            case ROCBLASLT_MATMUL_DESC_A_SCALE_POINTER_VEC_EXT:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->scaleA, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_SCALE_POINTER:
+            case ROCBLASLT_MATMUL_DESC_B_SCALE_POINTER_VEC_EXT:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->scaleB, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->scaleD, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT:
+            {
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                int32_t alongN = matmulDesc->scaleDVecAlongN;
+                memcpy(buf, &alongN, sizeof(int32_t));
+                break;
+            }
+            case ROCBLASLT_MATMUL_DESC_POINTER_MODE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->pointermode, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_BIAS_DATA_TYPE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->bias_type, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_D_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
                     return rocblaslt_status_invalid_value;
                 }
                 memcpy(buf, &matmulDesc->amaxD, sizeof(void*));
                 break;
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->residual, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_DATA_TYPE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->residual_type, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_LD:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int64_t);
+                if(sizeInBytes < sizeof(int64_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->ldr, sizeof(int64_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_BATCH_STRIDE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int64_t);
+                if(sizeInBytes < sizeof(int64_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->stride_r, sizeof(int64_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_RESIDUAL_POSITION:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->residual_position, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_DROPOUT_PROBABILITY:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(float);
+                if(sizeInBytes < sizeof(float))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->dropout, sizeof(float));
+                break;
+            case ROCBLASLT_MATMUL_DESC_DROPOUT_SEED_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->dropout_seed, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_DROPOUT_OFFSET_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->dropout_offset, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->amax_history, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->amax_history_length, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->amax_history_index, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->amax_history_scale, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_MARGIN:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->amax_history_margin, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_A_SCALE_MODE:
+            {
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                int32_t mode = matmulDesc->isScaleABlock ? rocblaslt_matrix_scale_vec32_ue8m0
+                                                          : rocblaslt_matrix_scale_scalar_32f;
+                memcpy(buf, &mode, sizeof(int32_t));
+                break;
+            }
+            case ROCBLASLT_MATMUL_DESC_B_SCALE_MODE:
+            {
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                int32_t mode = matmulDesc->isScaleBBlock ? rocblaslt_matrix_scale_vec32_ue8m0
+                                                          : rocblaslt_matrix_scale_scalar_32f;
+                memcpy(buf, &mode, sizeof(int32_t));
+                break;
+            }
+            case ROCBLASLT_MATMUL_DESC_B_QUANT_SCALE_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->b_quant_scale, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_QUANT_ZERO_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->b_quant_zero, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_QUANT_GROUP_SIZE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->b_quant_group_size, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->aux_type, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->aux_amax, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->d2, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_DATA_TYPE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->d2_type, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_LD:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int64_t);
+                if(sizeInBytes < sizeof(int64_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->ldd2, sizeof(int64_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_BATCH_STRIDE:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int64_t);
+                if(sizeInBytes < sizeof(int64_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->stride_d2, sizeof(int64_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D2_SCALE_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->scaleD2, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_BGRAD_DETERMINISTIC:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->bgrad_deterministic, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_DETERMINISTIC_REDUCTION:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->reduce_deterministic, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_CU_BUDGET:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->cu_budget, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_COMPLETION_FLAGS_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->completion_flags, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_COMPLETION_CHUNK_COLS:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->completion_cols, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(void*);
+                if(sizeInBytes < sizeof(void*))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->sparse_metadata_a, sizeof(void*));
+                break;
+            case ROCBLASLT_MATMUL_DESC_D_CACHE_POLICY:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->cache_policy_d, sizeof(int32_t));
+                break;
+            case ROCBLASLT_MATMUL_DESC_B_CACHE_POLICY:
+                if(sizeWritten)
+                    *sizeWritten = sizeof(int32_t);
+                if(sizeInBytes < sizeof(int32_t))
+                {
+                    log_error(__func__, "invalid buf size", sizeInBytes);
+                    return rocblaslt_status_invalid_value;
+                }
+                memcpy(buf, &matmulDesc->cache_policy_b, sizeof(int32_t));
+                break;
             case ROCBLASLT_MATMUL_DESC_COMPUTE_INPUT_TYPE_A_EXT:
                 if(sizeWritten)
                     *sizeWritten = sizeof(int32_t);
@@ -1450,6 +2310,15 @@ rocblaslt_status rocblaslt_matmul_is_algo_supported(rocblaslt_handle        hand
         return rocblaslt_status_invalid_pointer;
     }
 
+    if(isSkinnyGemmAlgo(*algo))
+    {
+        if(!skinnyGemmSupported(*matmul_descr, *matA, *matB, *matC, *matD))
+            return rocblaslt_status_invalid_value;
+        *workspaceSizeInBytes = skinnyGemmWorkspaceSize(
+            handle, *matmul_descr, *matA, *matB, *matD, algo->max_workspace_bytes);
+        return rocblaslt_status_success;
+    }
+
     rocblaslt_status status = rocblaslt_status_success;
     try
     {
@@ -1470,6 +2339,8 @@ rocblaslt_status rocblaslt_matmul_is_algo_supported(rocblaslt_handle        hand
         {
             throw status;
         }
+        // Work before or after the GEMM takes its buffers in front of the workspace of the GEMM
+        *workspaceSizeInBytes += passWorkspaceBytes(*matmul_descr, *matA, *matB, *matC, *matD);
     }
     catch(const rocblaslt_status& status)
     {
@@ -1506,6 +2377,50 @@ rocblaslt_status
         log_error(__func__, "invalid requested count", requestedAlgoCount);
         return rocblaslt_status_invalid_value;
     }
+
+    // Solutions of work before or after the GEMM are those of the GEMM, which gets the
+    // workspace the work leaves
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmA, gemmB, gemmC, gemmD;
+    size_t                   passBytes = 0;
+    if(innerGemmProblem(*matmul_desc,
+                        *matA,
+                        *matB,
+                        *matC,
+                        *matD,
+                        gemmDesc,
+                        gemmA,
+                        gemmB,
+                        gemmC,
+                        gemmD,
+                        &passBytes))
+    {
+        if(passBytes > pref->max_workspace_bytes)
+        {
+            log_api(__func__, "workspace too small", passBytes, pref->max_workspace_bytes);
+            *returnAlgoCount = 0;
+            return rocblaslt_status_success;
+        }
+        _rocblaslt_matmul_preference gemmPref = *pref;
+        gemmPref.max_workspace_bytes -= passBytes;
+        rocblaslt_status status = rocblaslt_matmul_algo_get_heuristic(handle,
+                                                                      &gemmDesc,
+                                                                      &gemmA,
+                                                                      &gemmB,
+                                                                      &gemmC,
+                                                                      &gemmD,
+                                                                      &gemmPref,
+                                                                      requestedAlgoCount,
+                                                                      heuristicResultsArray,
+                                                                      returnAlgoCount);
+        for(int i = 0; status == rocblaslt_status_success && i < *returnAlgoCount; i++)
+        {
+            heuristicResultsArray[i].workspaceSize += passBytes;
+            heuristicResultsArray[i].algo.max_workspace_bytes += passBytes;
+        }
+        return status;
+    }
+
     rocblaslt_status status = rocblaslt_status_success;
     try
     {
@@ -1533,13 +2448,26 @@ rocblaslt_status
         if(override.env_mode)
         {
             override_success = problem_override_from_file(
-                handle, pref, prob, matmul_desc, heuristicResultsArray, override.file_path);
+                handle, pref, prob, matmul_desc, heuristicResultsArray, override);
             if(override_success)
                 requestedAlgoCount--;
 
             log_api(__func__, "returnAlogCount", override_success ? 1 : 0);
         }
 
+        // Problems without a tuned solution keep the heuristic pick until tuning finishes.
+        // The winners depend on the timings of the process, which reproducible handles skip.
+        OnlineTuning& tuning = OnlineTuning::getInstance();
+        if(tuning.env_mode && !override_success && !handle->reproducible)
+        {
+            override_success = problem_override_from_online_tuning(
+                handle, pref, prob, matmul_desc, heuristicResultsArray);
+            if(override_success)
+                requestedAlgoCount--;
+            else
+                tuning.submit(handle, prob, pref->max_workspace_bytes);
+        }
+
         if(requestedAlgoCount > 0)
         {
             status = getBestSolutions(prob,
@@ -1606,6 +2534,27 @@ rocblaslt_status
             }
         }
 
+        // The skinny GEMM ranks first for the decode shapes it serves, ahead of the solutions
+        // of the library that tile the small side
+        if(rocblaslt::Debug::Instance().skinnyGemm()
+           && skinnyGemmSupported(*matmul_desc, *matA, *matB, *matC, *matD))
+        {
+            int count = std::min(*returnAlgoCount, requestedAlgoCount - 1);
+            std::move_backward(heuristicResultsArray,
+                               heuristicResultsArray + count,
+                               heuristicResultsArray + count + 1);
+            auto& skinny = heuristicResultsArray[0];
+            skinny       = rocblaslt_matmul_heuristic_result{};
+            memset(skinny.algo.data, 0, sizeof(skinny.algo.data));
+            *(int*)skinny.algo.data         = SKINNY_GEMM_SOLUTION_INDEX;
+            skinny.algo.max_workspace_bytes = pref->max_workspace_bytes;
+            skinny.algo.fallback            = false;
+            skinny.workspaceSize            = skinnyGemmWorkspaceSize(
+                handle, *matmul_desc, *matA, *matB, *matD, pref->max_workspace_bytes);
+            *returnAlgoCount = count + 1;
+            status           = rocblaslt_status_success;
+        }
+
         if(status != rocblaslt_status_success)
         {
             throw status;
@@ -1770,6 +2719,20 @@ rocblaslt_status
                                      const int              workspaceBytes,
                                      const int              requestedAlgoCount,
                                      std::vector<rocblaslt_matmul_heuristic_result>& results)
+{
+    rocblaslt::RocGemmPreference pref;
+    pref.workspaceBytes = workspaceBytes;
+    return rocblaslt_algo_get_heuristic_cpp(
+        handle, gemmType, gemmData, pref, requestedAlgoCount, results);
+}
+
+rocblaslt_status
+    rocblaslt_algo_get_heuristic_cpp(rocblaslt_handle                    handle,
+                                     rocblaslt::RocGemmType              gemmType,
+                                     std::shared_ptr<void>               gemmData,
+                                     const rocblaslt::RocGemmPreference& pref,
+                                     const int                           requestedAlgoCount,
+                                     std::vector<rocblaslt_matmul_heuristic_result>& results)
 {
     if(requestedAlgoCount < 1)
     {
@@ -1791,8 +2754,13 @@ rocblaslt_status
 
         if(override.env_mode)
         {
-            override_success = problem_override_from_file_cpp(
-                handle, gemmType, gemmData, workspaceBytes, override_result, override.file_path);
+            override_success = problem_override_from_file_cpp(handle,
+                                                              gemmType,
+                                                              gemmData,
+                                                              pref.workspaceBytes,
+                                                              override_result,
+                                                              override,
+                                                              pref.energyLatencyBound);
 
             log_api(__func__, "returnAlogCount", override_success ? 1 : 0);
         }
@@ -1802,9 +2770,10 @@ rocblaslt_status
                 = getBestSolutions(handle,
                                    gemmType,
                                    gemmData,
-                                   workspaceBytes,
+                                   pref.workspaceBytes,
                                    override_success ? requestedAlgoCount - 1 : requestedAlgoCount,
-                                   results);
+                                   results,
+                                   &pref);
 
         if(override_success)
         {
@@ -1821,7 +2790,8 @@ rocblaslt_status
         if(requestedAlgoCount > results.size())
         {
             std::vector<rocblaslt_matmul_heuristic_result> allSolutionsResults;
-            size_t                                         workspaceSizeInBytes = workspaceBytes;
+            size_t                                         workspaceSizeInBytes
+                = pref.workspaceBytes;
             if(rocblaslt_status_success
                == getAllSolutions(
                    gemmData, handle, gemmType, allSolutionsResults, workspaceSizeInBytes))
@@ -1838,6 +2808,8 @@ rocblaslt_status
                             duplicated_sol = true;
                     rocblaslt::RocTuningV2* tuning = nullptr;
                     if(duplicated_sol == true
+                       || !solutionMeetsPreference(
+                           handle, gemmType, gemmData, allSolutionsResults[i].algo, pref)
                        || rocblaslt_status_success
                               != isSolutionSupported(
                                   handle,
@@ -1862,6 +2834,154 @@ rocblaslt_status
     return rocblaslt_status_success;
 }
 
+rocblaslt_status rocblaslt_algo_get_workspace_frontier_cpp(
+    rocblaslt_handle                                handle,
+    rocblaslt::RocGemmType                          gemmType,
+    std::shared_ptr<void>                           gemmData,
+    std::vector<rocblaslt_matmul_heuristic_result>& results)
+{
+    return getWorkspaceFrontier(handle, gemmType, gemmData, results);
+}
+
+rocblaslt_status rocblaslt_matmul_algo_get_heuristic_batched(
+    rocblaslt_handle                                handle,
+    const std::vector<rocblaslt::RocMatmulProblem>& problems,
+    rocblaslt_matmul_preference                     pref,
+    int                                             requestedAlgoCount,
+    rocblaslt_matmul_heuristic_result               heuristicResultsArray[],
+    int                                             returnAlgoCount[])
+{
+    if(handle == nullptr || pref == nullptr)
+    {
+        log_error(__func__, "invalid pointer");
+        return rocblaslt_status_invalid_handle;
+    }
+
+    for(auto const& problem : problems)
+    {
+        if(problem.matmulDesc == nullptr || problem.matA == nullptr || problem.matB == nullptr
+           || problem.matC == nullptr || problem.matD == nullptr)
+        {
+            log_error(__func__, "invalid pointer");
+            return rocblaslt_status_invalid_handle;
+        }
+    }
+
+    if(requestedAlgoCount < 1)
+    {
+        log_error(__func__, "invalid requested count", requestedAlgoCount);
+        return rocblaslt_status_invalid_value;
+    }
+
+    log_api(__func__, "problems", problems.size(), "requestedAlgoCount", requestedAlgoCount);
+
+    // Tuned overrides and online tuning look each problem up on their own
+    bool selectOnly = !OverrideSingleton::getInstance().env_mode
+                      && !(OnlineTuning::getInstance().env_mode && !handle->reproducible);
+
+    try
+    {
+        // The problems that only need the selection of the library are selected together.
+        // Their alpha, beta and bias placeholder are read until the selection returns.
+        std::vector<size_t>                      batched;
+        std::vector<RocblasltContractionProblem> probs;
+        std::vector<std::shared_ptr<void>>       gemmData;
+        std::vector<std::array<int8_t, 16>>      alphas(problems.size()), betas(problems.size());
+        bool                                     dummy_bias_address = false;
+        for(size_t i = 0; i < problems.size() && selectOnly; i++)
+        {
+            auto                     matmul_desc = problems[i].matmulDesc;
+            auto                     matA        = problems[i].matA;
+            auto                     matB        = problems[i].matB;
+            auto                     matC        = problems[i].matC;
+            auto                     matD        = problems[i].matD;
+            _rocblaslt_matmul_desc   gemmDesc;
+            _rocblaslt_matrix_layout gemmA, gemmB, gemmC, gemmD;
+            if(innerGemmProblem(
+                   *matmul_desc, *matA, *matB, *matC, *matD, gemmDesc, gemmA, gemmB, gemmC, gemmD)
+               || (rocblaslt::Debug::Instance().skinnyGemm()
+                   && skinnyGemmSupported(*matmul_desc, *matA, *matB, *matC, *matD)))
+                continue;
+
+            assignAlphaBeta1(matmul_desc->compute_type, alphas[i].data(), betas[i].data());
+            bool dummy_bias
+                = matmul_desc->bias == nullptr && is_bias_enabled(matmul_desc->epilogue);
+            if(dummy_bias)
+                matmul_desc->bias = &dummy_bias_address;
+            probs.push_back(construct_rocblaslt_problem(handle,
+                                                        matmul_desc,
+                                                        matA,
+                                                        matB,
+                                                        matC,
+                                                        matD,
+                                                        alphas[i].data(),
+                                                        betas[i].data(),
+                                                        pref->max_workspace_bytes));
+            if(dummy_bias)
+                matmul_desc->bias = nullptr;
+            gemmData.push_back(matmul_desc->m_data);
+            batched.push_back(i);
+        }
+
+        std::vector<rocblaslt_matmul_heuristic_result> results(probs.size() * requestedAlgoCount);
+        std::vector<int>                               counts(probs.size(), 0);
+        if(!probs.empty())
+        {
+            auto status = getBestSolutionsBatched(probs,
+                                                  handle,
+                                                  gemmData,
+                                                  requestedAlgoCount,
+                                                  results.data(),
+                                                  counts.data(),
+                                                  pref->max_workspace_bytes);
+            if(status != rocblaslt_status_success)
+                throw status;
+        }
+
+        std::vector<bool> done(problems.size(), false);
+        for(size_t j = 0; j < batched.size(); j++)
+        {
+            // Fewer solutions than requested are completed with the size independent ones below
+            if(counts[j] < requestedAlgoCount)
+                continue;
+
+            auto i = batched[j];
+            std::copy_n(&results[j * requestedAlgoCount],
+                        requestedAlgoCount,
+                        &heuristicResultsArray[i * requestedAlgoCount]);
+            returnAlgoCount[i] = counts[j];
+            done[i]            = true;
+        }
+
+        // The remaining problems take the path of a single query, which finds the solutions
+        // selected above in the selection cache of the library
+        for(size_t i = 0; i < problems.size(); i++)
+        {
+            if(done[i])
+                continue;
+
+            auto heuristicResults = &heuristicResultsArray[i * requestedAlgoCount];
+            auto status           = rocblaslt_matmul_algo_get_heuristic(handle,
+                                                              problems[i].matmulDesc,
+                                                              problems[i].matA,
+                                                              problems[i].matB,
+                                                              problems[i].matC,
+                                                              problems[i].matD,
+                                                              pref,
+                                                              requestedAlgoCount,
+                                                              heuristicResults,
+                                                              &returnAlgoCount[i]);
+            if(status != rocblaslt_status_success)
+                throw status;
+        }
+    }
+    catch(const rocblaslt_status& status)
+    {
+        return status;
+    }
+    return rocblaslt_status_success;
+}
+
 rocblaslt_status rocblaslt_copy_matmul(rocblaslt_matmul_desc src, rocblaslt_matmul_desc dst)
 {
     if(src == nullptr)
@@ -1878,6 +2998,160 @@ rocblaslt_status rocblaslt_copy_matmul(rocblaslt_matmul_desc src, rocblaslt_matm
     return rocblaslt_status_success;
 }
 
+rocblaslt_status rocblaslt_clear_matmul_cache(rocblaslt_handle handle)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    log_api(__func__, "handle", handle);
+    clearTensileExecCache(handle);
+    return rocblaslt_status_success;
+}
+
+rocblaslt_status rocblaslt_set_workspace_pool(rocblaslt_handle handle, size_t maxBytes)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    log_api(__func__, "handle", handle, "maxBytes", maxBytes);
+    try
+    {
+        setTensileWorkspacePool(handle, maxBytes);
+        return rocblaslt_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
+rocblaslt_status rocblaslt_set_priority_stream(rocblaslt_handle handle, bool enable)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    log_api(__func__, "handle", handle, "enable", enable);
+    try
+    {
+        setTensilePriorityStream(handle, enable);
+        return rocblaslt_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
+rocblaslt_status rocblaslt_set_reproducible(rocblaslt_handle handle, bool enable)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    log_api(__func__, "handle", handle, "enable", enable);
+    try
+    {
+        setTensileReproducible(handle, enable);
+        return rocblaslt_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
+rocblaslt_status rocblaslt_get_solution_cache_stats(rocblaslt_handle                handle,
+                                                    rocblaslt_solution_cache_stats* stats)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    if(stats == nullptr)
+    {
+        log_error(__func__, "invalid stats pointer", stats);
+        return rocblaslt_status_invalid_pointer;
+    }
+    log_api(__func__, "handle", handle);
+    try
+    {
+        return getTensileSolutionCacheStats(handle, stats);
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
+rocblaslt_status rocblaslt_get_statistics(rocblaslt_handle handle, rocblaslt_statistics* stats)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    if(stats == nullptr)
+    {
+        log_error(__func__, "invalid stats pointer", stats);
+        return rocblaslt_status_invalid_pointer;
+    }
+    log_api(__func__, "handle", handle);
+    try
+    {
+        return getTensileStatistics(handle, stats);
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
+rocblaslt_status rocblaslt_matmul_algo_get_name(rocblaslt_handle             handle,
+                                               const rocblaslt_matmul_algo* algo,
+                                               const char**                 kernelName,
+                                               const char**                 solutionName)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    if(algo == nullptr || (kernelName == nullptr && solutionName == nullptr))
+    {
+        log_error(__func__, "invalid algo or name pointers", algo);
+        return rocblaslt_status_invalid_pointer;
+    }
+    try
+    {
+        return getAlgoNames(handle, *algo, kernelName, solutionName);
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
+rocblaslt_status rocblaslt_get_call_timings(std::vector<rocblaslt::RocCallTiming>& timings)
+{
+    try
+    {
+        timings = CallTiming::collect();
+        return rocblaslt_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
+
 /*******************************************************************************
  * GPU architecture-related functions
  ******************************************************************************/
@@ -1896,11 +3170,7 @@ struct ArchName
 // exported. Get architecture name
 std::string rocblaslt_internal_get_arch_name()
 {
-    int deviceId;
-    static_cast<void>(hipGetDevice(&deviceId));
-    hipDeviceProp_t deviceProperties;
-    static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
-    return ArchName{}(deviceProperties);
+    return ArchName{}(TensileLite::hip::GetCurrentDeviceProperties());
 }
 
 bool rocblaslt_internal_test_path(const std::string& path)
@@ -1977,3 +3247,59 @@ extern "C" int rocblaslt_matmul_is_tuned(rocblaslt_handle        handle,
 
     return 0;
 }
+
+rocblaslt_status
+    rocblaslt_matmul_trace_selection(rocblaslt_handle                               handle,
+                                     rocblaslt_matmul_desc                          matmul_descr,
+                                     rocblaslt_matrix_layout                        matA,
+                                     rocblaslt_matrix_layout                        matB,
+                                     rocblaslt_matrix_layout                        matC,
+                                     rocblaslt_matrix_layout                        matD,
+                                     size_t                                         workspaceBytes,
+                                     int                                            algoCount,
+                                     std::vector<rocblaslt::RocSelectionCandidate>& candidates)
+{
+    if(handle == nullptr)
+    {
+        log_error(__func__, "invalid handle pointer", handle);
+        return rocblaslt_status_invalid_handle;
+    }
+    if(matmul_descr == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || matD == nullptr)
+    {
+        log_error(__func__, "invalid matrix descriptor pointer");
+        return rocblaslt_status_invalid_pointer;
+    }
+    if(algoCount < 1)
+    {
+        log_error(__func__, "invalid requested count", algoCount);
+        return rocblaslt_status_invalid_value;
+    }
+    log_api(__func__, "handle", handle, "workspaceBytes", workspaceBytes, "algoCount", algoCount);
+
+    try
+    {
+        int8_t alpha[16] = {0};
+        int8_t beta[16]  = {0};
+        assignAlphaBeta1(matmul_descr->compute_type, (void*)alpha, (void*)beta);
+        // The same placeholder bias as the heuristic, so the epilogue predicates match
+        bool dummy_bias_address = false;
+        if(matmul_descr->bias == nullptr && is_bias_enabled(matmul_descr->epilogue))
+        {
+            dummy_bias_address = true;
+            matmul_descr->bias = &dummy_bias_address;
+        }
+        auto prob = construct_rocblaslt_problem(
+            handle, matmul_descr, matA, matB, matC, matD, &alpha, &beta, workspaceBytes);
+        if(dummy_bias_address)
+            matmul_descr->bias = nullptr;
+
+        candidates = traceBestRawSolutions(
+            prob, handle, matmul_descr->m_data, algoCount, workspaceBytes);
+        return rocblaslt_status_success;
+    }
+    catch(...)
+    {
+        return exception_to_rocblaslt_status();
+    }
+}
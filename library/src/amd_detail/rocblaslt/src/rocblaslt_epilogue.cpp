@@ -0,0 +1,1257 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblaslt_epilogue.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_runtime.h>
+#include <hipblaslt/hipblaslt_float8.h>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    constexpr uint32_t EPILOGUE_NUM_WORKITEMS = 256;
+    constexpr uint32_t EPILOGUE_MAX_NUM_WG    = 65536;
+    constexpr uint32_t EPILOGUE_MAX_NUM_BATCH = 65535;
+
+    enum class PassActivation
+    {
+        None,
+        Relu,
+        Gelu,
+        Silu
+    };
+
+    template <PassActivation Act>
+    __device__ float activate(float x)
+    {
+        if constexpr(Act == PassActivation::Relu)
+        {
+            return fmaxf(x, 0.f);
+        }
+        else if constexpr(Act == PassActivation::Gelu)
+        {
+            // The tanh approximation of the GELU epilogue
+            return 0.5f * x * (1.f + tanhf(0.7978845608028654f * x * (1.f + 0.044715f * x * x)));
+        }
+        else if constexpr(Act == PassActivation::Silu)
+        {
+            return x / (1.f + __expf(-x));
+        }
+        else
+        {
+            return x;
+        }
+    }
+
+    dim3 passGrid(int64_t m, int64_t n, int32_t batchCount)
+    {
+        const int64_t numWg
+            = std::min<int64_t>((m * n + EPILOGUE_NUM_WORKITEMS - 1) / EPILOGUE_NUM_WORKITEMS,
+                                EPILOGUE_MAX_NUM_WG);
+        return dim3(uint32_t(numWg), std::min<uint32_t>(batchCount, EPILOGUE_MAX_NUM_BATCH));
+    }
+
+    // Calls f with a null pointer of the element type of the float types the passes support
+    template <typename F>
+    rocblaslt_status dispatchFloatType(hipDataType type, F&& f)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return f(static_cast<float*>(nullptr));
+        case HIP_R_16F:
+            return f(static_cast<_Float16*>(nullptr));
+        case HIP_R_16BF:
+            return f(static_cast<hip_bfloat16*>(nullptr));
+        default:
+            return rocblaslt_status_not_implemented;
+        }
+    }
+
+    // Calls f with a null pointer of the element type of the types a converted D may have
+    template <typename F>
+    rocblaslt_status dispatchConvertType(hipDataType type, F&& f)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+            return f(static_cast<int8_t*>(nullptr));
+        case HIP_R_32I:
+            return f(static_cast<int32_t*>(nullptr));
+        case HIP_R_8F_E4M3_FNUZ:
+            return f(static_cast<hipblaslt_f8_fnuz*>(nullptr));
+        case HIP_R_8F_E5M2_FNUZ:
+            return f(static_cast<hipblaslt_bf8_fnuz*>(nullptr));
+#ifdef ROCM_USE_FLOAT8
+        case HIP_R_8F_E4M3:
+            return f(static_cast<hipblaslt_f8*>(nullptr));
+        case HIP_R_8F_E5M2:
+            return f(static_cast<hipblaslt_bf8*>(nullptr));
+#endif
+        default:
+            return dispatchFloatType(type, std::forward<F>(f));
+        }
+    }
+
+    // Rounds to nearest and clips to the range of integer types. The FP8 constructors clip to
+    // the largest finite magnitude.
+    template <typename T>
+    __device__ T saturateCast(float v)
+    {
+        if constexpr(std::is_integral<T>::value)
+        {
+            constexpr float lo = float(std::numeric_limits<T>::lowest());
+            // The largest float below 2^31 for int32
+            constexpr float hi
+                = sizeof(T) < 4 ? float(std::numeric_limits<T>::max()) : 2147483520.f;
+            return v != v ? T(0) : T(fminf(fmaxf(rintf(v), lo), hi));
+        }
+        else
+        {
+            return T(v);
+        }
+    }
+
+    // Philox4x32-10 of Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"
+    struct PhiloxBlock
+    {
+        uint32_t x[4];
+    };
+
+    __device__ inline PhiloxBlock philox4x32(uint64_t counter, uint64_t subsequence, uint64_t key)
+    {
+        uint32_t c0 = uint32_t(counter), c1 = uint32_t(counter >> 32);
+        uint32_t c2 = uint32_t(subsequence), c3 = uint32_t(subsequence >> 32);
+        uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32);
+
+        for(int round = 0; round < 10; ++round)
+        {
+            const uint64_t p0 = uint64_t(0xD2511F53u) * c0;
+            const uint64_t p1 = uint64_t(0xCD9E8D57u) * c2;
+
+            c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+            c1 = uint32_t(p1);
+            c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+            c3 = uint32_t(p0);
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        return PhiloxBlock{{c0, c1, c2, c3}};
+    }
+
+    // The workitems walk D in memory order. Each reads the adjacent gate and up values of its
+    // row pair, so a wavefront reads one contiguous run of gemmD.
+    template <typename T, PassActivation Act>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void gatedActivation(
+        T*       D,
+        const T* gemmD,
+        int64_t  m,
+        int64_t  n,
+        int64_t  ldd,
+        int64_t  batchStrideD,
+        int64_t  ldGemm,
+        int64_t  batchStrideGemm,
+        int32_t  batchCount)
+    {
+        const int64_t numElements = m * n;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row  = idx % m;
+                const int64_t col  = idx / m;
+                const T*      pair = gemmD + batch * batchStrideGemm + col * ldGemm + 2 * row;
+                const float   gate = float(pair[0]);
+                const float   up   = float(pair[1]);
+
+                D[batch * batchStrideD + col * ldd + row] = T(activate<Act>(gate) * up);
+            }
+        }
+    }
+
+    template <typename TD, typename TR, PassActivation Act>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void residualAdd(
+        TD*       D,
+        int64_t   ldd,
+        int64_t   batchStrideD,
+        const TR* R,
+        int64_t   ldr,
+        int64_t   batchStrideR,
+        int64_t   m,
+        int64_t   n,
+        int32_t   batchCount)
+    {
+        const int64_t numElements = m * n;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row = idx % m;
+                const int64_t col = idx / m;
+                TD*           d   = D + batch * batchStrideD + col * ldd + row;
+                const float   r   = float(R[batch * batchStrideR + col * ldr + row]);
+
+                *d = TD(activate<Act>(float(*d) + r));
+            }
+        }
+    }
+
+    template <typename TIn, typename TOut>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void scaleConvert(
+        const TIn*   in,
+        int64_t      ldIn,
+        int64_t      batchStrideIn,
+        TOut*        out,
+        int64_t      ldOut,
+        int64_t      batchStrideOut,
+        const float* scale,
+        bool         scaleAlongN,
+        int64_t      m,
+        int64_t      n,
+        int32_t      batchCount)
+    {
+        const int64_t numElements = m * n;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row = idx % m;
+                const int64_t col = idx / m;
+                float         v   = float(in[batch * batchStrideIn + col * ldIn + row]);
+
+                if(scale)
+                    v *= scale[scaleAlongN ? col : row];
+                out[batch * batchStrideOut + col * ldOut + row] = saturateCast<TOut>(v);
+            }
+        }
+    }
+
+    // 2^(e - 127) of an E8M0 scale, NaN for 255
+    __device__ float decodeE8M0(uint8_t e)
+    {
+        return e == 255 ? std::numeric_limits<float>::quiet_NaN() : ldexpf(1.f, int(e) - 127);
+    }
+
+    template <typename TIn>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void blockDequantize(
+        const TIn*     in,
+        int64_t        ld,
+        int64_t        batchStride,
+        hip_bfloat16*  out,
+        int64_t        rows,
+        int64_t        cols,
+        bool           kAlongRows,
+        const uint8_t* blockScale,
+        int64_t        scaleStrideK,
+        int64_t        scaleStrideMN,
+        int64_t        scaleBatchStride,
+        const float*   scale,
+        int32_t        batchCount)
+    {
+        const int64_t numElements = rows * cols;
+        const float   scalar      = scale ? *scale : 1.f;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row = idx % rows;
+                const int64_t col = idx / rows;
+                float         v   = float(in[batch * batchStride + col * ld + row]);
+
+                if(blockScale)
+                {
+                    const int64_t kBlock = (kAlongRows ? row : col) / 32;
+                    const int64_t mn     = kAlongRows ? col : row;
+                    v *= decodeE8M0(blockScale[batch * scaleBatchStride + kBlock * scaleStrideK
+                                               + mn * scaleStrideMN]);
+                }
+                else
+                {
+                    v *= scalar;
+                }
+                out[batch * numElements + idx] = hip_bfloat16(v);
+            }
+        }
+    }
+
+    // The amax of the input is reduced per workgroup and merged through the bits of the
+    // float, which order like the float for the nonnegative values of an amax
+    template <typename TIn, typename TOut>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void auxConvert(
+        const TIn*   in,
+        int64_t      ldIn,
+        int64_t      batchStrideIn,
+        TOut*        out,
+        int64_t      ldOut,
+        int64_t      batchStrideOut,
+        const float* scale,
+        bool         divideByScale,
+        float*       amax,
+        int64_t      m,
+        int64_t      n,
+        int32_t      batchCount)
+    {
+        __shared__ float partial[EPILOGUE_NUM_WORKITEMS];
+
+        const int64_t numElements = m * n;
+        const float   s           = !scale ? 1.f : divideByScale ? 1.f / *scale : *scale;
+        float         localMax    = 0.f;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row = idx % m;
+                const int64_t col = idx / m;
+                const float   v   = float(in[batch * batchStrideIn + col * ldIn + row]);
+
+                localMax = fmaxf(localMax, fabsf(v));
+                out[batch * batchStrideOut + col * ldOut + row] = saturateCast<TOut>(v * s);
+            }
+        }
+
+        if(!amax)
+            return;
+
+        partial[threadIdx.x] = localMax;
+        __syncthreads();
+
+        for(uint32_t offset = EPILOGUE_NUM_WORKITEMS / 2; offset > 0; offset /= 2)
+        {
+            if(threadIdx.x < offset)
+                partial[threadIdx.x] = fmaxf(partial[threadIdx.x], partial[threadIdx.x + offset]);
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0)
+            atomicMax(reinterpret_cast<unsigned int*>(amax), __float_as_uint(partial[0]));
+    }
+
+    // Each output is summed by NumSlices workitems over fixed strided parts and combined by
+    // a fixed tree, so the order of the additions depends on the sizes only
+    template <uint32_t OutPerWg, typename TIn, typename TBias>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void biasGradient(
+        const TIn* in,
+        int64_t    outStride,
+        int64_t    reduceStride,
+        TBias*     bias,
+        int64_t    numOut,
+        int64_t    length)
+    {
+        constexpr uint32_t NumSlices = EPILOGUE_NUM_WORKITEMS / OutPerWg;
+        __shared__ float   partial[EPILOGUE_NUM_WORKITEMS];
+
+        const uint32_t lane  = threadIdx.x % OutPerWg;
+        const uint32_t slice = threadIdx.x / OutPerWg;
+
+        for(int64_t base = int64_t(blockIdx.x) * OutPerWg; base < numOut;
+            base += int64_t(gridDim.x) * OutPerWg)
+        {
+            const int64_t out = base + lane;
+            float         sum = 0.f;
+            if(out < numOut)
+            {
+                for(int64_t r = slice; r < length; r += NumSlices)
+                    sum += float(in[out * outStride + r * reduceStride]);
+            }
+            partial[threadIdx.x] = sum;
+            __syncthreads();
+
+            for(uint32_t offset = NumSlices / 2; offset > 0; offset /= 2)
+            {
+                if(slice < offset)
+                    partial[threadIdx.x] += partial[threadIdx.x + offset * OutPerWg];
+                __syncthreads();
+            }
+
+            if(slice == 0 && out < numOut)
+                bias[out] = TBias(partial[threadIdx.x]);
+            __syncthreads();
+        }
+    }
+
+    // Int4 elements are packed two per byte, the even element in the low nibble
+    template <typename T, bool Int4>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void weightDequantize(
+        const void* in,
+        int64_t     ld,
+        int64_t     batchStride,
+        T*          out,
+        int64_t     rows,
+        int64_t     cols,
+        bool        kAlongRows,
+        const T*    scale,
+        const T*    zero,
+        int64_t     groupSize,
+        int64_t     groups,
+        int32_t     batchCount)
+    {
+        const int64_t numElements = rows * cols;
+        const int64_t numScales   = groups * (kAlongRows ? cols : rows);
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row = idx % rows;
+                const int64_t col = idx / rows;
+                const int64_t e   = batch * batchStride + col * ld + row;
+                float         q;
+                if constexpr(Int4)
+                {
+                    const uint8_t packed = static_cast<const uint8_t*>(in)[e / 2];
+                    const int     nibble = (e & 1) ? packed >> 4 : packed & 15;
+                    q                    = float(nibble >= 8 ? nibble - 16 : nibble);
+                }
+                else
+                {
+                    q = float(static_cast<const int8_t*>(in)[e]);
+                }
+
+                const int64_t k = kAlongRows ? row : col;
+                const int64_t s
+                    = batch * numScales + (kAlongRows ? col : row) * groups + k / groupSize;
+                const float z = zero ? float(zero[s]) : 0.f;
+                out[batch * numElements + idx] = T((q - z) * float(scale[s]));
+            }
+        }
+    }
+
+    // out holds the three blocks of k of each batch, so x = hi + lo + O(2^-16 x) gives
+    // op(A) op(B) = hi hi + hi lo + lo hi up to the dropped lo lo product
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void splitBf16(
+        const float*  in,
+        int64_t       ld,
+        int64_t       batchStride,
+        hip_bfloat16* out,
+        int64_t       rows,
+        int64_t       cols,
+        bool          kAlongRows,
+        int           loBlock,
+        int32_t       batchCount)
+    {
+        const int64_t numElements = rows * cols;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t      row = idx % rows;
+                const int64_t      col = idx / rows;
+                const float        v   = in[batch * batchStride + col * ld + row];
+                const hip_bfloat16 hi(v);
+                const hip_bfloat16 lo(v - float(hi));
+
+                hip_bfloat16* batchOut = out + batch * 3 * numElements;
+                for(int block = 0; block < 3; block++)
+                {
+                    const int64_t e = kAlongRows ? block * rows + row + col * 3 * rows
+                                                 : row + (block * cols + col) * rows;
+                    batchOut[e]     = block == loBlock ? lo : hi;
+                }
+            }
+        }
+    }
+
+    // Each workitem owns the 32 rows of a column behind one mask word, and draws the Philox
+    // blocks of its elements once for every four of them.
+    template <typename T>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void dropoutKeep(
+        T*              D,
+        int64_t         ldd,
+        int64_t         batchStrideD,
+        uint32_t*       mask,
+        int64_t         ldMask,
+        int64_t         batchStrideMask,
+        float           dropout,
+        const uint64_t* seedPtr,
+        const uint64_t* offsetPtr,
+        int64_t         m,
+        int64_t         n,
+        int32_t         batchCount)
+    {
+        const uint64_t seed     = *seedPtr;
+        const uint64_t offset   = offsetPtr ? *offsetPtr : 0;
+        const float    scale    = 1.f / (1.f - dropout);
+        const int64_t  rowWords = (m + 31) / 32;
+        const int64_t  numWords = rowWords * n;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numWords;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t  word  = idx % rowWords;
+                const int64_t  col   = idx / rowWords;
+                const int64_t  row0  = word * 32;
+                const int64_t  rows  = m - row0 < 32 ? m - row0 : 32;
+                const uint64_t first = uint64_t((batch * n + col) * m + row0);
+                T*             d     = D + batch * batchStrideD + col * ldd + row0;
+                uint32_t       bits  = 0;
+                PhiloxBlock    block = philox4x32(first / 4, offset, seed);
+
+                for(int64_t r = 0; r < rows; ++r)
+                {
+                    const uint64_t e = first + r;
+                    if(r && e % 4 == 0)
+                        block = philox4x32(e / 4, offset, seed);
+
+                    // 24 random bits give a uniform float in [0, 1)
+                    const bool keep = float(block.x[e % 4] >> 8) * (1.f / 16777216.f) >= dropout;
+                    d[r]            = keep ? T(float(d[r]) * scale) : T(0.f);
+                    bits |= uint32_t(keep) << r;
+                }
+                if(mask)
+                    mask[batch * batchStrideMask + col * ldMask + word] = bits;
+            }
+        }
+    }
+
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void amaxHistoryUpdate(
+        const float* amax,
+        float*       history,
+        int32_t      length,
+        int32_t*     index,
+        float*       scale,
+        float        maxOverMargin)
+    {
+        __shared__ float partial[EPILOGUE_NUM_WORKITEMS];
+
+        const int32_t slot    = ((*index % length) + length) % length;
+        const float   current = *amax;
+        float         maxAmax = current;
+
+        for(int32_t i = threadIdx.x; i < length; i += EPILOGUE_NUM_WORKITEMS)
+        {
+            if(i != slot)
+                maxAmax = fmaxf(maxAmax, history[i]);
+        }
+        partial[threadIdx.x] = maxAmax;
+        __syncthreads();
+
+        for(uint32_t offset = EPILOGUE_NUM_WORKITEMS / 2; offset > 0; offset /= 2)
+        {
+            if(threadIdx.x < offset)
+                partial[threadIdx.x] = fmaxf(partial[threadIdx.x], partial[threadIdx.x + offset]);
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0)
+        {
+            history[slot] = current;
+            *index        = (slot + 1) % length;
+            if(partial[0] > 0.f && isfinite(partial[0]))
+                *scale = maxOverMargin / partial[0];
+        }
+    }
+
+    // Copies the rows x cols elements of each batch from the batch pointers or the strided
+    // buffer in to the batch pointers or the strided buffer out, one of each
+    template <typename TWord>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void batchCopy(
+        const void* const* batchIn,
+        const TWord*       in,
+        int64_t            ldIn,
+        int64_t            batchStrideIn,
+        void* const*       batchOut,
+        TWord*             out,
+        int64_t            ldOut,
+        int64_t            batchStrideOut,
+        int64_t            rows,
+        int64_t            cols,
+        int32_t            batchCount)
+    {
+        const int64_t numElements = rows * cols;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            const TWord* src = batchIn ? static_cast<const TWord*>(batchIn[batch])
+                                       : in + batch * batchStrideIn;
+            TWord*       dst = batchOut ? static_cast<TWord*>(batchOut[batch])
+                                        : out + batch * batchStrideOut;
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row      = idx % rows;
+                const int64_t col      = idx / rows;
+                dst[col * ldOut + row] = src[col * ldIn + row];
+            }
+        }
+    }
+
+    // Writes beta * C packed, zeros without reading C when beta is zero, and fills the alpha
+    // vector with alpha
+    template <typename T>
+    __global__ __launch_bounds__(EPILOGUE_NUM_WORKITEMS) void deviceScalars(
+        const T*     c,
+        int64_t      ldc,
+        int64_t      batchStrideC,
+        T*           gemmC,
+        const float* alpha,
+        const float* beta,
+        float*       alphaVec,
+        int64_t      m,
+        int64_t      n,
+        int32_t      batchCount)
+    {
+        const int64_t numElements = m * n;
+        const float   scalar      = *beta;
+
+        for(int64_t batch = blockIdx.y; batch < batchCount; batch += gridDim.y)
+        {
+            for(int64_t idx = int64_t(blockIdx.x) * EPILOGUE_NUM_WORKITEMS + threadIdx.x;
+                idx < numElements;
+                idx += int64_t(gridDim.x) * EPILOGUE_NUM_WORKITEMS)
+            {
+                const int64_t row = idx % m;
+                const int64_t col = idx / m;
+                if(alphaVec && batch == 0 && idx < m)
+                    alphaVec[idx] = *alpha;
+
+                float v = 0.f;
+                if(scalar != 0.f)
+                    v = scalar * float(c[batch * batchStrideC + col * ldc + row]);
+                gemmC[batch * numElements + idx] = saturateCast<T>(v);
+            }
+        }
+    }
+
+    __global__ void chunkSignal(uint32_t* flag)
+    {
+        __threadfence_system();
+        atomicAdd(flag, 1u);
+    }
+
+    template <typename TD, typename TR>
+    rocblaslt_status launchResidualAddKernel(PassActivation act,
+                                             TD*            D,
+                                             int64_t        ldd,
+                                             int64_t        batchStrideD,
+                                             const TR*      R,
+                                             int64_t        ldr,
+                                             int64_t        batchStrideR,
+                                             int64_t        m,
+                                             int64_t        n,
+                                             int32_t        batchCount,
+                                             hipStream_t    stream)
+    {
+        auto kernel = residualAdd<TD, TR, PassActivation::None>;
+        if(act == PassActivation::Relu)
+            kernel = residualAdd<TD, TR, PassActivation::Relu>;
+        else if(act == PassActivation::Gelu)
+            kernel = residualAdd<TD, TR, PassActivation::Gelu>;
+
+        hipLaunchKernelGGL(kernel,
+                           passGrid(m, n, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           D,
+                           ldd,
+                           batchStrideD,
+                           R,
+                           ldr,
+                           batchStrideR,
+                           m,
+                           n,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    }
+}
+
+rocblaslt_status launchGatedActivation(rocblaslt_epilogue epilogue,
+                                       hipDataType        type,
+                                       void*              D,
+                                       const void*        gemmD,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            ldd,
+                                       int64_t            batchStrideD,
+                                       int64_t            ldGemm,
+                                       int64_t            batchStrideGemm,
+                                       int32_t            batchCount,
+                                       hipStream_t        stream)
+{
+    if(!m || !n || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    const bool geglu
+        = epilogue == ROCBLASLT_EPILOGUE_GEGLU || epilogue == ROCBLASLT_EPILOGUE_GEGLU_BIAS;
+
+    return dispatchFloatType(type, [&](auto* typed) {
+        using T           = std::remove_pointer_t<decltype(typed)>;
+        const auto kernel = geglu ? gatedActivation<T, PassActivation::Gelu>
+                                  : gatedActivation<T, PassActivation::Silu>;
+
+        hipLaunchKernelGGL(kernel,
+                           passGrid(m, n, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           static_cast<T*>(D),
+                           static_cast<const T*>(gemmD),
+                           m,
+                           n,
+                           ldd,
+                           batchStrideD,
+                           ldGemm,
+                           batchStrideGemm,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    });
+}
+
+rocblaslt_status launchResidualAdd(rocblaslt_epilogue activation,
+                                   hipDataType        typeD,
+                                   void*              D,
+                                   int64_t            ldd,
+                                   int64_t            batchStrideD,
+                                   hipDataType        typeR,
+                                   const void*        R,
+                                   int64_t            ldr,
+                                   int64_t            batchStrideR,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   int32_t            batchCount,
+                                   hipStream_t        stream)
+{
+    if(!m || !n || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    PassActivation act = PassActivation::None;
+    switch(activation)
+    {
+    case ROCBLASLT_EPILOGUE_DEFAULT:
+    case ROCBLASLT_EPILOGUE_BIAS:
+        break;
+    case ROCBLASLT_EPILOGUE_RELU:
+    case ROCBLASLT_EPILOGUE_RELU_BIAS:
+        act = PassActivation::Relu;
+        break;
+    case ROCBLASLT_EPILOGUE_GELU:
+    case ROCBLASLT_EPILOGUE_GELU_BIAS:
+        act = PassActivation::Gelu;
+        break;
+    default:
+        return rocblaslt_status_not_implemented;
+    }
+
+    return dispatchFloatType(typeD, [&](auto* typedD) {
+        using TD = std::remove_pointer_t<decltype(typedD)>;
+        return dispatchFloatType(typeR, [&](auto* typedR) {
+            using TR = std::remove_pointer_t<decltype(typedR)>;
+            return launchResidualAddKernel(act,
+                                           static_cast<TD*>(D),
+                                           ldd,
+                                           batchStrideD,
+                                           static_cast<const TR*>(R),
+                                           ldr,
+                                           batchStrideR,
+                                           m,
+                                           n,
+                                           batchCount,
+                                           stream);
+        });
+    });
+}
+
+rocblaslt_status launchScaleConvert(hipDataType  typeIn,
+                                    const void*  in,
+                                    int64_t      ldIn,
+                                    int64_t      batchStrideIn,
+                                    hipDataType  typeOut,
+                                    void*        out,
+                                    int64_t      ldOut,
+                                    int64_t      batchStrideOut,
+                                    const float* scale,
+                                    bool         scaleAlongN,
+                                    int64_t      m,
+                                    int64_t      n,
+                                    int32_t      batchCount,
+                                    hipStream_t  stream)
+{
+    if(!m || !n || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    return dispatchConvertType(typeIn, [&](auto* typedIn) {
+        using TIn = std::remove_pointer_t<decltype(typedIn)>;
+        return dispatchConvertType(typeOut, [&](auto* typedOut) {
+            using TOut = std::remove_pointer_t<decltype(typedOut)>;
+
+            hipLaunchKernelGGL(scaleConvert<TIn, TOut>,
+                               passGrid(m, n, batchCount),
+                               dim3(EPILOGUE_NUM_WORKITEMS),
+                               0,
+                               stream,
+                               static_cast<const TIn*>(in),
+                               ldIn,
+                               batchStrideIn,
+                               static_cast<TOut*>(out),
+                               ldOut,
+                               batchStrideOut,
+                               scale,
+                               scaleAlongN,
+                               m,
+                               n,
+                               batchCount);
+            return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                                   : rocblaslt_status_internal_error;
+        });
+    });
+}
+
+rocblaslt_status launchDropout(hipDataType     type,
+                               void*           D,
+                               int64_t         ldd,
+                               int64_t         batchStrideD,
+                               uint32_t*       mask,
+                               int64_t         ldMask,
+                               int64_t         batchStrideMask,
+                               float           dropout,
+                               const uint64_t* seed,
+                               const uint64_t* offset,
+                               int64_t         m,
+                               int64_t         n,
+                               int32_t         batchCount,
+                               hipStream_t     stream)
+{
+    if(!m || !n || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    return dispatchFloatType(type, [&](auto* typed) {
+        using T = std::remove_pointer_t<decltype(typed)>;
+
+        hipLaunchKernelGGL(dropoutKeep<T>,
+                           passGrid((m + 31) / 32, n, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           static_cast<T*>(D),
+                           ldd,
+                           batchStrideD,
+                           mask,
+                           ldMask,
+                           batchStrideMask,
+                           dropout,
+                           seed,
+                           offset,
+                           m,
+                           n,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    });
+}
+
+rocblaslt_status launchAmaxHistoryUpdate(const float* amax,
+                                         float*       history,
+                                         int32_t      length,
+                                         int32_t*     index,
+                                         float*       scale,
+                                         float        maxOverMargin,
+                                         hipStream_t  stream)
+{
+    hipLaunchKernelGGL(amaxHistoryUpdate,
+                       dim3(1),
+                       dim3(EPILOGUE_NUM_WORKITEMS),
+                       0,
+                       stream,
+                       amax,
+                       history,
+                       length,
+                       index,
+                       scale,
+                       maxOverMargin);
+    return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                           : rocblaslt_status_internal_error;
+}
+
+rocblaslt_status launchBlockDequantize(hipDataType    typeIn,
+                                       const void*    in,
+                                       int64_t        ld,
+                                       int64_t        batchStride,
+                                       void*          out,
+                                       int64_t        rows,
+                                       int64_t        cols,
+                                       bool           kAlongRows,
+                                       const uint8_t* blockScale,
+                                       int64_t        scaleStrideK,
+                                       int64_t        scaleStrideMN,
+                                       int64_t        scaleBatchStride,
+                                       const float*   scale,
+                                       int32_t        batchCount,
+                                       hipStream_t    stream)
+{
+    if(!rows || !cols || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    return dispatchConvertType(typeIn, [&](auto* typedIn) {
+        using TIn = std::remove_pointer_t<decltype(typedIn)>;
+
+        hipLaunchKernelGGL(blockDequantize<TIn>,
+                           passGrid(rows, cols, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           static_cast<const TIn*>(in),
+                           ld,
+                           batchStride,
+                           static_cast<hip_bfloat16*>(out),
+                           rows,
+                           cols,
+                           kAlongRows,
+                           blockScale,
+                           scaleStrideK,
+                           scaleStrideMN,
+                           scaleBatchStride,
+                           scale,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    });
+}
+
+rocblaslt_status launchSplitBf16(const float* in,
+                                 int64_t      ld,
+                                 int64_t      batchStride,
+                                 void*        out,
+                                 int64_t      rows,
+                                 int64_t      cols,
+                                 bool         kAlongRows,
+                                 int          loBlock,
+                                 int32_t      batchCount,
+                                 hipStream_t  stream)
+{
+    if(!rows || !cols || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    hipLaunchKernelGGL(splitBf16,
+                       passGrid(rows, cols, batchCount),
+                       dim3(EPILOGUE_NUM_WORKITEMS),
+                       0,
+                       stream,
+                       in,
+                       ld,
+                       batchStride,
+                       static_cast<hip_bfloat16*>(out),
+                       rows,
+                       cols,
+                       kAlongRows,
+                       loBlock,
+                       batchCount);
+    return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                           : rocblaslt_status_internal_error;
+}
+
+rocblaslt_status launchWeightDequantize(hipDataType typeIn,
+                                        const void* in,
+                                        int64_t     ld,
+                                        int64_t     batchStride,
+                                        hipDataType typeOut,
+                                        void*       out,
+                                        int64_t     rows,
+                                        int64_t     cols,
+                                        bool        kAlongRows,
+                                        const void* scale,
+                                        const void* zero,
+                                        int64_t     groupSize,
+                                        int32_t     batchCount,
+                                        hipStream_t stream)
+{
+    if(!rows || !cols || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+    if(typeIn != HIP_R_8I && typeIn != HIP_R_4I)
+    {
+        return rocblaslt_status_not_implemented;
+    }
+
+    const int64_t groups = ((kAlongRows ? rows : cols) + groupSize - 1) / groupSize;
+    return dispatchFloatType(typeOut, [&](auto* typedOut) {
+        using T = std::remove_pointer_t<decltype(typedOut)>;
+
+        auto kernel = typeIn == HIP_R_4I ? weightDequantize<T, true> : weightDequantize<T, false>;
+        hipLaunchKernelGGL(kernel,
+                           passGrid(rows, cols, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           in,
+                           ld,
+                           batchStride,
+                           static_cast<T*>(out),
+                           rows,
+                           cols,
+                           kAlongRows,
+                           static_cast<const T*>(scale),
+                           static_cast<const T*>(zero),
+                           groupSize,
+                           groups,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    });
+}
+
+rocblaslt_status launchAuxConvert(hipDataType  typeIn,
+                                  const void*  in,
+                                  int64_t      ldIn,
+                                  int64_t      batchStrideIn,
+                                  hipDataType  typeOut,
+                                  void*        out,
+                                  int64_t      ldOut,
+                                  int64_t      batchStrideOut,
+                                  const float* scale,
+                                  bool         divideByScale,
+                                  float*       amax,
+                                  int64_t      m,
+                                  int64_t      n,
+                                  int32_t      batchCount,
+                                  hipStream_t  stream)
+{
+    if(amax && hipMemsetAsync(amax, 0, sizeof(float), stream) != hipSuccess)
+    {
+        return rocblaslt_status_internal_error;
+    }
+    if(!m || !n || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    return dispatchConvertType(typeIn, [&](auto* typedIn) {
+        using TIn = std::remove_pointer_t<decltype(typedIn)>;
+        return dispatchConvertType(typeOut, [&](auto* typedOut) {
+            using TOut = std::remove_pointer_t<decltype(typedOut)>;
+
+            hipLaunchKernelGGL(auxConvert<TIn, TOut>,
+                               passGrid(m, n, batchCount),
+                               dim3(EPILOGUE_NUM_WORKITEMS),
+                               0,
+                               stream,
+                               static_cast<const TIn*>(in),
+                               ldIn,
+                               batchStrideIn,
+                               static_cast<TOut*>(out),
+                               ldOut,
+                               batchStrideOut,
+                               scale,
+                               divideByScale,
+                               amax,
+                               m,
+                               n,
+                               batchCount);
+            return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                                   : rocblaslt_status_internal_error;
+        });
+    });
+}
+
+rocblaslt_status launchBiasGradient(hipDataType typeIn,
+                                    const void* in,
+                                    int64_t     ld,
+                                    int64_t     rows,
+                                    int64_t     cols,
+                                    bool        alongRows,
+                                    hipDataType typeBias,
+                                    void*       bias,
+                                    hipStream_t stream)
+{
+    const int64_t numOut = alongRows ? cols : rows;
+    if(!numOut)
+    {
+        return rocblaslt_status_success;
+    }
+
+    return dispatchConvertType(typeIn, [&](auto* typedIn) {
+        using TIn = std::remove_pointer_t<decltype(typedIn)>;
+        return dispatchFloatType(typeBias, [&](auto* typedBias) {
+            using TBias = std::remove_pointer_t<decltype(typedBias)>;
+
+            // Sums along the rows read contiguous elements of one output per workgroup,
+            // sums along the columns contiguous outputs
+            constexpr uint32_t outPerWgCols = 64;
+            const int64_t      outPerWg     = alongRows ? 1 : outPerWgCols;
+            const dim3         grid(uint32_t(std::min<int64_t>((numOut + outPerWg - 1) / outPerWg,
+                                                       EPILOGUE_MAX_NUM_WG)));
+            auto kernel = alongRows ? biasGradient<1, TIn, TBias>
+                                    : biasGradient<outPerWgCols, TIn, TBias>;
+            hipLaunchKernelGGL(kernel,
+                               grid,
+                               dim3(EPILOGUE_NUM_WORKITEMS),
+                               0,
+                               stream,
+                               static_cast<const TIn*>(in),
+                               alongRows ? ld : 1,
+                               alongRows ? 1 : ld,
+                               static_cast<TBias*>(bias),
+                               numOut,
+                               alongRows ? rows : cols);
+            return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                                   : rocblaslt_status_internal_error;
+        });
+    });
+}
+
+rocblaslt_status launchDeviceScalars(hipDataType  typeC,
+                                     const void*  C,
+                                     int64_t      ldc,
+                                     int64_t      batchStrideC,
+                                     void*        gemmC,
+                                     const float* alpha,
+                                     const float* beta,
+                                     float*       alphaVec,
+                                     int64_t      m,
+                                     int64_t      n,
+                                     int32_t      batchCount,
+                                     hipStream_t  stream)
+{
+    if(!m || !n || batchCount <= 0)
+    {
+        return rocblaslt_status_success;
+    }
+
+    return dispatchConvertType(typeC, [&](auto* typedC) {
+        using T = std::remove_pointer_t<decltype(typedC)>;
+
+        hipLaunchKernelGGL(deviceScalars<T>,
+                           passGrid(m, n, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           static_cast<const T*>(C),
+                           ldc,
+                           batchStrideC,
+                           static_cast<T*>(gemmC),
+                           alpha,
+                           beta,
+                           alphaVec,
+                           m,
+                           n,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    });
+}
+
+rocblaslt_status launchChunkSignal(uint32_t* flag, hipStream_t stream)
+{
+    hipLaunchKernelGGL(chunkSignal, dim3(1), dim3(1), 0, stream, flag);
+    return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                           : rocblaslt_status_internal_error;
+}
+
+rocblaslt_status launchBatchCopy(size_t             elementBytes,
+                                 const void* const* batchIn,
+                                 const void*        in,
+                                 int64_t            ldIn,
+                                 int64_t            batchStrideIn,
+                                 void* const*       batchOut,
+                                 void*              out,
+                                 int64_t            ldOut,
+                                 int64_t            batchStrideOut,
+                                 int64_t            rows,
+                                 int64_t            cols,
+                                 int32_t            batchCount,
+                                 hipStream_t        stream)
+{
+    auto launch = [&](auto* word) {
+        using TWord = std::remove_pointer_t<decltype(word)>;
+        hipLaunchKernelGGL(batchCopy<TWord>,
+                           passGrid(rows, cols, batchCount),
+                           dim3(EPILOGUE_NUM_WORKITEMS),
+                           0,
+                           stream,
+                           batchIn,
+                           static_cast<const TWord*>(in),
+                           ldIn,
+                           batchStrideIn,
+                           batchOut,
+                           static_cast<TWord*>(out),
+                           ldOut,
+                           batchStrideOut,
+                           rows,
+                           cols,
+                           batchCount);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    };
+
+    if(rows == 0 || cols == 0 || batchCount == 0)
+        return rocblaslt_status_success;
+    switch(elementBytes)
+    {
+    case 1:
+        return launch(static_cast<uint8_t*>(nullptr));
+    case 2:
+        return launch(static_cast<uint16_t*>(nullptr));
+    case 4:
+        return launch(static_cast<uint32_t*>(nullptr));
+    case 8:
+        return launch(static_cast<uint64_t*>(nullptr));
+    default:
+        return rocblaslt_status_not_implemented;
+    }
+}
@@ -24,12 +24,17 @@
  *
  * ************************************************************************ */
 
+#include "CallTiming.hpp"
 #include "definitions.h"
 #include "handle.h"
+#include "rocblaslt_epilogue.hpp"
 #include "rocblaslt_mat_utils.hpp"
+#include "rocblaslt_skinny.hpp"
 #include "tensile_host.hpp"
 
+#include <cmath>
 #include <hip/hip_runtime_api.h>
+#include <sstream>
 
 #ifdef __cplusplus
 extern "C" {
@@ -56,6 +61,7 @@ rocblaslt_status rocblaslt_matmul_impl(const rocblaslt_handle       handle,
                                        size_t                       workspaceSizeInBytes,
                                        hipStream_t                  stream)
 {
+    CallTiming::Scope validationTiming(CallTiming::Validation);
     int64_t m, n, k, lda, ldb, ldc, ldd, lde, batch_stride_a, batch_stride_b, batch_stride_c,
         batch_stride_d, batch_stride_e;
     hipDataType            bias_type;
@@ -97,12 +103,13 @@ rocblaslt_status rocblaslt_matmul_impl(const rocblaslt_handle       handle,
                                                            E,
                                                            gradient,
                                                            compute_type);
+    validationTiming.stop();
     if(isValid != rocblaslt_status_continue)
         return isValid;
 
     // Internal assign
-    hipblasOperation_t opA           = matmul_descr->op_A;
-    hipblasOperation_t opB           = matmul_descr->op_B;
+    hipblasOperation_t opA           = matmulKernelOp(matmul_descr->op_A, matA);
+    hipblasOperation_t opB           = matmulKernelOp(matmul_descr->op_B, matB);
     int                num_batches_a = matA->batch_count;
     rocblaslt_epilogue epilogue      = matmul_descr->epilogue;
     void*              scaleA        = matmul_descr->scaleA;
@@ -150,6 +157,22 @@ rocblaslt_status rocblaslt_matmul_impl(const rocblaslt_handle       handle,
 
     if(algo)
         workspaceSizeInBytes = min(workspaceSizeInBytes, algo->max_workspace_bytes);
+    if(algo && isSkinnyGemmAlgo(*algo))
+        return launchSkinnyGemm(handle,
+                                *matmul_descr,
+                                A,
+                                B,
+                                C,
+                                D,
+                                *matA,
+                                *matB,
+                                *matC,
+                                *matD,
+                                *(const float*)alpha,
+                                *(const float*)beta,
+                                workspace,
+                                workspaceSizeInBytes,
+                                stream);
     RocblasltContractionProblem problem{opA,
                                         opB,
                                         m,
@@ -202,10 +225,1523 @@ rocblaslt_status rocblaslt_matmul_impl(const rocblaslt_handle       handle,
                                         workspaceSizeInBytes,
                                         stream,
                                         handle->Synchronizer};
+    problem.deterministicReduction = matmul_descr->reduce_deterministic != 0;
+    problem.cuBudget               = std::max(matmul_descr->cu_budget, 0);
+    problem.sparseA                = matA->sparsity != HIPBLASLT_SPARSITY_DENSE;
+    problem.metadataA              = matmul_descr->sparse_metadata_a;
+    problem.cachePolicyD           = rocblaslt_cache_policy(matmul_descr->cache_policy_d);
+    problem.cachePolicyB           = rocblaslt_cache_policy(matmul_descr->cache_policy_b);
 
     return runContractionProblem(handle, algo, problem, gemmData);
 }
 
+/********************************************************************************
+ * \brief A deterministic bias gradient runs the GEMM of rocblaslt_matmul
+ * without it and reduces op(A) along k for BGRADA, op(B) along k for BGRADB or
+ * the DGELU result in D along n for DGELU_BGRAD into the bias.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_bgrad(const rocblaslt_handle       handle,
+                                               const rocblaslt_matmul_desc  matmul_descr,
+                                               const void*                  A,
+                                               const void*                  B,
+                                               const void*                  C,
+                                               void*                        D,
+                                               rocblaslt_matrix_layout      matA,
+                                               rocblaslt_matrix_layout      matB,
+                                               rocblaslt_matrix_layout      matC,
+                                               rocblaslt_matrix_layout      matD,
+                                               const void*                  alpha,
+                                               const void*                  beta,
+                                               const rocblaslt_matmul_algo* algo,
+                                               void*                        workspace,
+                                               size_t                       workspaceSizeInBytes,
+                                               hipStream_t                  stream)
+{
+    if(matA->order != HIPBLASLT_ORDER_COL || matB->order != HIPBLASLT_ORDER_COL
+       || matD->order != HIPBLASLT_ORDER_COL || matD->batch_count != 1)
+    {
+        log_error(__func__,
+                  "invalid args",
+                  "a deterministic bias gradient needs column major matrices and one batch");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc gemmDesc;
+    bgradGemmProblem(*matmul_descr, gemmDesc);
+
+    rocblaslt_status status = rocblaslt_matmul(handle,
+                                               &gemmDesc,
+                                               alpha,
+                                               A,
+                                               matA,
+                                               B,
+                                               matB,
+                                               beta,
+                                               C,
+                                               matC,
+                                               D,
+                                               matD,
+                                               algo,
+                                               workspace,
+                                               workspaceSizeInBytes,
+                                               stream);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    const hipDataType biasType = matmul_descr->bias_type == HIPBLASLT_DATATYPE_INVALID
+                                     ? matD->type
+                                     : matmul_descr->bias_type;
+    switch(matmul_descr->epilogue)
+    {
+    case ROCBLASLT_EPILOGUE_BGRADA:
+        return launchBiasGradient(matA->type,
+                                  A,
+                                  matA->ld,
+                                  matA->m,
+                                  matA->n,
+                                  matmul_descr->op_A != HIPBLAS_OP_N,
+                                  biasType,
+                                  matmul_descr->bias,
+                                  stream);
+    case ROCBLASLT_EPILOGUE_BGRADB:
+        return launchBiasGradient(matB->type,
+                                  B,
+                                  matB->ld,
+                                  matB->m,
+                                  matB->n,
+                                  matmul_descr->op_B == HIPBLAS_OP_N,
+                                  biasType,
+                                  matmul_descr->bias,
+                                  stream);
+    default:
+        return launchBiasGradient(matD->type,
+                                  D,
+                                  matD->ld,
+                                  matD->m,
+                                  matD->n,
+                                  false,
+                                  biasType,
+                                  matmul_descr->bias,
+                                  stream);
+    }
+}
+
+/********************************************************************************
+ * \brief A second output converts the D of rocblaslt_matmul, with all its
+ * other work done, into D2 with the D2 scale. Unfused functional fallback, the
+ * conversion reads D back after the GEMM has written it.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_dual_output(const rocblaslt_handle       handle,
+                                 const rocblaslt_matmul_desc  matmul_descr,
+                                 const void*                  A,
+                                 const void*                  B,
+                                 const void*                  C,
+                                 void*                        D,
+                                 rocblaslt_matrix_layout      matA,
+                                 rocblaslt_matrix_layout      matB,
+                                 rocblaslt_matrix_layout      matC,
+                                 rocblaslt_matrix_layout      matD,
+                                 const void*                  alpha,
+                                 const void*                  beta,
+                                 const rocblaslt_matmul_algo* algo,
+                                 void*                        workspace,
+                                 size_t                       workspaceSizeInBytes,
+                                 hipStream_t                  stream)
+{
+    if(matD->order != HIPBLASLT_ORDER_COL)
+    {
+        log_error(__func__, "invalid args", "D2 needs a column major D");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc gemmDesc;
+    dualOutputGemmProblem(*matmul_descr, gemmDesc);
+
+    const int64_t ldd2     = matmul_descr->ldd2 > 0 ? matmul_descr->ldd2 : matD->m;
+    const int64_t strideD2 = matmul_descr->stride_d2 > 0 ? matmul_descr->stride_d2 : ldd2 * matD->n;
+    if(ldd2 < matD->m || strideD2 < ldd2 * matD->n)
+    {
+        log_error(__func__, "invalid D2 ld or batch stride", ldd2);
+        return rocblaslt_status_invalid_size;
+    }
+
+    rocblaslt_status status = rocblaslt_matmul(handle,
+                                               &gemmDesc,
+                                               alpha,
+                                               A,
+                                               matA,
+                                               B,
+                                               matB,
+                                               beta,
+                                               C,
+                                               matC,
+                                               D,
+                                               matD,
+                                               algo,
+                                               workspace,
+                                               workspaceSizeInBytes,
+                                               stream);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    return launchAuxConvert(matD->type,
+                            D,
+                            matD->ld,
+                            matD->batch_stride,
+                            matmul_descr->d2_type == HIPBLASLT_DATATYPE_INVALID
+                                ? matD->type
+                                : matmul_descr->d2_type,
+                            matmul_descr->d2,
+                            ldd2,
+                            strideD2,
+                            static_cast<const float*>(matmul_descr->scaleD2),
+                            false,
+                            nullptr,
+                            matD->m,
+                            matD->n,
+                            matD->batch_count,
+                            stream);
+}
+
+/********************************************************************************
+ * \brief Takes a buffer of a pass from the front of the workspace, see
+ * alignedWorkspaceBytes, and leaves the rest of the workspace to the GEMM.
+ *******************************************************************************/
+static rocblaslt_status
+    takeWorkspace(size_t bytes, void*& workspace, size_t& workspaceSizeInBytes, void*& buffer)
+{
+    bytes = alignedWorkspaceBytes(bytes);
+    if(bytes > workspaceSizeInBytes)
+    {
+        log_error(__func__, "workspace too small", bytes, workspaceSizeInBytes);
+        return rocblaslt_status_invalid_value;
+    }
+    buffer    = workspace;
+    workspace = static_cast<char*>(workspace) + bytes;
+    workspaceSizeInBytes -= bytes;
+    return rocblaslt_status_success;
+}
+
+/********************************************************************************
+ * \brief An AUX of its own type goes through a buffer of the type of D. The
+ * pass after a GELU_AUX GEMM scales, converts and takes the amax of it, and
+ * the pass before a DGELU GEMM converts E into it and divides by the scale.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_aux(const rocblaslt_handle       handle,
+                                             const rocblaslt_matmul_desc  matmul_descr,
+                                             const void*                  A,
+                                             const void*                  B,
+                                             const void*                  C,
+                                             void*                        D,
+                                             rocblaslt_matrix_layout      matA,
+                                             rocblaslt_matrix_layout      matB,
+                                             rocblaslt_matrix_layout      matC,
+                                             rocblaslt_matrix_layout      matD,
+                                             const void*                  alpha,
+                                             const void*                  beta,
+                                             const rocblaslt_matmul_algo* algo,
+                                             void*                        workspace,
+                                             size_t                       workspaceSizeInBytes,
+                                             hipStream_t                  stream)
+{
+    if(!matmul_descr->e)
+    {
+        log_error(__func__, "invalid data pointer", "an AUX type or amax needs an AUX pointer");
+        return rocblaslt_status_invalid_pointer;
+    }
+
+    _rocblaslt_matmul_desc gemmDesc;
+    auxConvertGemmProblem(*matmul_descr, *matD, gemmDesc);
+
+    const hipDataType auxType  = matmul_descr->aux_type == HIPBLASLT_DATATYPE_INVALID
+                                     ? matD->type
+                                     : matmul_descr->aux_type;
+    const int64_t     m        = matD->m;
+    const int64_t     n        = matD->n;
+    const int64_t     lde      = matmul_descr->lde > 0 ? matmul_descr->lde : m;
+    const int64_t     strideE  = matmul_descr->stride_e > 0 ? matmul_descr->stride_e : lde * n;
+    const bool        gradient = is_grad_enabled(matmul_descr->epilogue);
+    const float*      scaleE   = static_cast<const float*>(matmul_descr->scaleE);
+    const size_t      bytes    = auxConvertWorkspaceBytes(gemmDesc, *matD);
+    if(!bytes)
+        return rocblaslt_matmul_impl(handle,
+                                     &gemmDesc,
+                                     A,
+                                     B,
+                                     C,
+                                     D,
+                                     matA,
+                                     matB,
+                                     matC,
+                                     matD,
+                                     alpha,
+                                     beta,
+                                     algo,
+                                     workspace,
+                                     workspaceSizeInBytes,
+                                     stream);
+
+    void*            gemmE  = nullptr;
+    rocblaslt_status status = takeWorkspace(bytes, workspace, workspaceSizeInBytes, gemmE);
+    if(status != rocblaslt_status_success)
+        return status;
+    gemmDesc.e = gemmE;
+
+    if(gradient)
+        status = launchAuxConvert(auxType,
+                                  matmul_descr->e,
+                                  lde,
+                                  strideE,
+                                  matD->type,
+                                  gemmE,
+                                  gemmDesc.lde,
+                                  gemmDesc.stride_e,
+                                  scaleE,
+                                  true,
+                                  nullptr,
+                                  m,
+                                  n,
+                                  matD->batch_count,
+                                  stream);
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul_impl(handle,
+                                       &gemmDesc,
+                                       A,
+                                       B,
+                                       C,
+                                       D,
+                                       matA,
+                                       matB,
+                                       matC,
+                                       matD,
+                                       alpha,
+                                       beta,
+                                       algo,
+                                       workspace,
+                                       workspaceSizeInBytes,
+                                       stream);
+    if(status == rocblaslt_status_success && !gradient)
+        status = launchAuxConvert(matD->type,
+                                  gemmE,
+                                  gemmDesc.lde,
+                                  gemmDesc.stride_e,
+                                  auxType,
+                                  matmul_descr->e,
+                                  lde,
+                                  strideE,
+                                  scaleE,
+                                  false,
+                                  static_cast<float*>(matmul_descr->aux_amax),
+                                  m,
+                                  n,
+                                  matD->batch_count,
+                                  stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief The GEMM of a gated epilogue writes the 2m x n gate/up result to the
+ * front of the workspace, and the gate pass reduces it into the m x n D.
+ * Unfused functional fallback, the gate/up result makes a round trip through
+ * memory.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_gated(const rocblaslt_handle       handle,
+                                               const rocblaslt_matmul_desc  matmul_descr,
+                                               const void*                  A,
+                                               const void*                  B,
+                                               const void*                  C,
+                                               void*                        D,
+                                               rocblaslt_matrix_layout      matA,
+                                               rocblaslt_matrix_layout      matB,
+                                               rocblaslt_matrix_layout      matC,
+                                               rocblaslt_matrix_layout      matD,
+                                               const void*                  alpha,
+                                               const void*                  beta,
+                                               const rocblaslt_matmul_algo* algo,
+                                               void*                        workspace,
+                                               size_t                       workspaceSizeInBytes,
+                                               hipStream_t                  stream)
+{
+    if(matmul_descr->scaleD || matmul_descr->amaxD || matmul_descr->e || matmul_descr->residual
+       || matmul_descr->dropout > 0.f || matD->order != HIPBLASLT_ORDER_COL)
+    {
+        log_error(__func__,
+                  "invalid args",
+                  "gated epilogues take no scaleD, amaxD, E, residual, dropout or order");
+        return rocblaslt_status_not_implemented;
+    }
+    if(matD->ld < int64_t(matD->m))
+    {
+        log_error(__func__, "invalid args", "ld of D is less than its rows");
+        return rocblaslt_status_invalid_size;
+    }
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmD;
+    gatedGemmProblem(*matmul_descr, *matD, gemmDesc, gemmD);
+
+    const size_t bytes = layoutWorkspaceBytes(gemmD, hipDataTypeBytes(gemmD.type));
+    if(!bytes)
+        return rocblaslt_status_success;
+
+    void*            gemmResult = nullptr;
+    rocblaslt_status status = takeWorkspace(bytes, workspace, workspaceSizeInBytes, gemmResult);
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul_impl(handle,
+                                       &gemmDesc,
+                                       A,
+                                       B,
+                                       C,
+                                       gemmResult,
+                                       matA,
+                                       matB,
+                                       matC,
+                                       &gemmD,
+                                       alpha,
+                                       beta,
+                                       algo,
+                                       workspace,
+                                       workspaceSizeInBytes,
+                                       stream);
+    if(status == rocblaslt_status_success)
+        status = launchGatedActivation(matmul_descr->epilogue,
+                                       matD->type,
+                                       D,
+                                       gemmResult,
+                                       matD->m,
+                                       matD->n,
+                                       matD->ld,
+                                       matD->batch_stride,
+                                       gemmD.ld,
+                                       gemmD.batch_stride,
+                                       matD->batch_count,
+                                       stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief A residual adds R to the D written by the GEMM, activating the sum
+ * when R goes before the activation of the epilogue.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_residual(const rocblaslt_handle       handle,
+                                                  const rocblaslt_matmul_desc  matmul_descr,
+                                                  const void*                  A,
+                                                  const void*                  B,
+                                                  const void*                  C,
+                                                  void*                        D,
+                                                  rocblaslt_matrix_layout      matA,
+                                                  rocblaslt_matrix_layout      matB,
+                                                  rocblaslt_matrix_layout      matC,
+                                                  rocblaslt_matrix_layout      matD,
+                                                  const void*                  alpha,
+                                                  const void*                  beta,
+                                                  const rocblaslt_matmul_algo* algo,
+                                                  void*                        workspace,
+                                                  size_t                       workspaceSizeInBytes,
+                                                  hipStream_t                  stream)
+{
+    switch(matmul_descr->epilogue)
+    {
+    case ROCBLASLT_EPILOGUE_DEFAULT:
+    case ROCBLASLT_EPILOGUE_BIAS:
+    case ROCBLASLT_EPILOGUE_RELU:
+    case ROCBLASLT_EPILOGUE_RELU_BIAS:
+    case ROCBLASLT_EPILOGUE_GELU:
+    case ROCBLASLT_EPILOGUE_GELU_BIAS:
+        break;
+    default:
+        log_error(__func__, "invalid args", "unsupported epilogue with a residual");
+        return rocblaslt_status_not_implemented;
+    }
+    if(matmul_descr->scaleD || matmul_descr->amaxD)
+    {
+        log_error(__func__, "invalid args", "a residual takes no scaleD or amaxD");
+        return rocblaslt_status_not_implemented;
+    }
+
+    const hipDataType typeR = matmul_descr->residual_type == HIPBLASLT_DATATYPE_INVALID
+                                  ? matD->type
+                                  : matmul_descr->residual_type;
+    const int64_t ldr      = matmul_descr->ldr ? matmul_descr->ldr : int64_t(matD->m);
+    const int64_t strideR  = matmul_descr->stride_r ? matmul_descr->stride_r : ldr * matD->n;
+    if(ldr < int64_t(matD->m))
+    {
+        log_error(__func__, "invalid args", "ld of the residual is less than the rows of D");
+        return rocblaslt_status_invalid_size;
+    }
+
+    _rocblaslt_matmul_desc gemmDesc;
+    residualGemmProblem(*matmul_descr, gemmDesc);
+
+    rocblaslt_status status = rocblaslt_matmul_impl(handle,
+                                                    &gemmDesc,
+                                                    A,
+                                                    B,
+                                                    C,
+                                                    D,
+                                                    matA,
+                                                    matB,
+                                                    matC,
+                                                    matD,
+                                                    alpha,
+                                                    beta,
+                                                    algo,
+                                                    workspace,
+                                                    workspaceSizeInBytes,
+                                                    stream);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    const bool before = matmul_descr->residual_position == rocblaslt_residual_before_activation;
+    return launchResidualAdd(before ? matmul_descr->epilogue : ROCBLASLT_EPILOGUE_DEFAULT,
+                             matD->type,
+                             D,
+                             matD->ld,
+                             matD->batch_stride,
+                             typeR,
+                             matmul_descr->residual,
+                             ldr,
+                             strideR,
+                             matD->m,
+                             matD->n,
+                             matD->batch_count,
+                             stream);
+}
+
+/********************************************************************************
+ * \brief A vector scale of D converts the unscaled GEMM result into D per row
+ * or column. C joins the GEMM through the result buffer unless beta is zero.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_scaled_d(const rocblaslt_handle       handle,
+                                                  const rocblaslt_matmul_desc  matmul_descr,
+                                                  const void*                  A,
+                                                  const void*                  B,
+                                                  const void*                  C,
+                                                  void*                        D,
+                                                  rocblaslt_matrix_layout      matA,
+                                                  rocblaslt_matrix_layout      matB,
+                                                  rocblaslt_matrix_layout      matC,
+                                                  rocblaslt_matrix_layout      matD,
+                                                  const void*                  alpha,
+                                                  const void*                  beta,
+                                                  const rocblaslt_matmul_algo* algo,
+                                                  void*                        workspace,
+                                                  size_t                       workspaceSizeInBytes,
+                                                  hipStream_t                  stream)
+{
+    if(matmul_descr->amaxD || matmul_descr->compute_type == rocblaslt_compute_f64
+       || matC->order != HIPBLASLT_ORDER_COL || matD->order != HIPBLASLT_ORDER_COL)
+    {
+        log_error(__func__, "invalid args", "a D scale vector takes no amaxD, f64 or order");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmCD;
+    scaleDVecGemmProblem(*matmul_descr, *matD, gemmDesc, gemmCD);
+
+    const size_t bytes = layoutWorkspaceBytes(gemmCD, 4);
+    if(!bytes)
+        return rocblaslt_status_success;
+
+    void*            gemmResult = nullptr;
+    rocblaslt_status status = takeWorkspace(bytes, workspace, workspaceSizeInBytes, gemmResult);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    const bool betaZero
+        = matmul_descr->pointermode == rocblaslt_pointer_mode_host
+          && (gemmCD.type == HIP_R_32I ? *static_cast<const int32_t*>(beta) == 0
+                                       : *static_cast<const float*>(beta) == 0.f);
+
+    if(!betaZero)
+        status = launchScaleConvert(matC->type,
+                                    C,
+                                    matC->ld,
+                                    matC->batch_stride,
+                                    gemmCD.type,
+                                    gemmResult,
+                                    gemmCD.ld,
+                                    gemmCD.batch_stride,
+                                    nullptr,
+                                    false,
+                                    matD->m,
+                                    matD->n,
+                                    matD->batch_count,
+                                    stream);
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul_impl(handle,
+                                       &gemmDesc,
+                                       A,
+                                       B,
+                                       gemmResult,
+                                       gemmResult,
+                                       matA,
+                                       matB,
+                                       &gemmCD,
+                                       &gemmCD,
+                                       alpha,
+                                       beta,
+                                       algo,
+                                       workspace,
+                                       workspaceSizeInBytes,
+                                       stream);
+    if(status == rocblaslt_status_success)
+        status = launchScaleConvert(gemmCD.type,
+                                    gemmResult,
+                                    gemmCD.ld,
+                                    gemmCD.batch_stride,
+                                    matD->type,
+                                    D,
+                                    matD->ld,
+                                    matD->batch_stride,
+                                    static_cast<const float*>(matmul_descr->scaleD),
+                                    matmul_descr->scaleDVecAlongN,
+                                    matD->m,
+                                    matD->n,
+                                    matD->batch_count,
+                                    stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief A dropout drops elements of the D written by the GEMM with its
+ * activation, and writes the keep mask to the AUX pointer when it is set.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_dropout(const rocblaslt_handle       handle,
+                                                 const rocblaslt_matmul_desc  matmul_descr,
+                                                 const void*                  A,
+                                                 const void*                  B,
+                                                 const void*                  C,
+                                                 void*                        D,
+                                                 rocblaslt_matrix_layout      matA,
+                                                 rocblaslt_matrix_layout      matB,
+                                                 rocblaslt_matrix_layout      matC,
+                                                 rocblaslt_matrix_layout      matD,
+                                                 const void*                  alpha,
+                                                 const void*                  beta,
+                                                 const rocblaslt_matmul_algo* algo,
+                                                 void*                        workspace,
+                                                 size_t                       workspaceSizeInBytes,
+                                                 hipStream_t                  stream)
+{
+    switch(matmul_descr->epilogue)
+    {
+    case ROCBLASLT_EPILOGUE_DEFAULT:
+    case ROCBLASLT_EPILOGUE_BIAS:
+    case ROCBLASLT_EPILOGUE_RELU:
+    case ROCBLASLT_EPILOGUE_RELU_BIAS:
+    case ROCBLASLT_EPILOGUE_GELU:
+    case ROCBLASLT_EPILOGUE_GELU_BIAS:
+        break;
+    default:
+        log_error(__func__, "invalid args", "unsupported epilogue with a dropout");
+        return rocblaslt_status_not_implemented;
+    }
+    if(matmul_descr->amaxD || matmul_descr->residual
+       || (matmul_descr->isScaleDVec && matmul_descr->scaleD)
+       || (matD->type != HIP_R_32F && matD->type != HIP_R_16F && matD->type != HIP_R_16BF))
+    {
+        log_error(__func__, "invalid args", "a dropout takes no amaxD, residual or D scale vector");
+        return rocblaslt_status_not_implemented;
+    }
+    if(!matmul_descr->dropout_seed)
+    {
+        log_error(__func__, "invalid args", "a dropout needs a seed pointer");
+        return rocblaslt_status_invalid_pointer;
+    }
+
+    const int64_t paddedRows = (int64_t(matD->m) + 31) / 32 * 32;
+    const int64_t ldMask     = matmul_descr->lde ? matmul_descr->lde : paddedRows;
+    const int64_t strideMask = matmul_descr->stride_e ? matmul_descr->stride_e : ldMask * matD->n;
+    if(matmul_descr->e && (ldMask < paddedRows || ldMask % 32 || strideMask % 32))
+    {
+        log_error(__func__, "invalid args", "the mask ld and stride are not multiples of 32 rows");
+        return rocblaslt_status_invalid_size;
+    }
+
+    _rocblaslt_matmul_desc gemmDesc;
+    dropoutGemmProblem(*matmul_descr, gemmDesc);
+
+    rocblaslt_status status = rocblaslt_matmul_impl(handle,
+                                                    &gemmDesc,
+                                                    A,
+                                                    B,
+                                                    C,
+                                                    D,
+                                                    matA,
+                                                    matB,
+                                                    matC,
+                                                    matD,
+                                                    alpha,
+                                                    beta,
+                                                    algo,
+                                                    workspace,
+                                                    workspaceSizeInBytes,
+                                                    stream);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    return launchDropout(matD->type,
+                         D,
+                         matD->ld,
+                         matD->batch_stride,
+                         static_cast<uint32_t*>(matmul_descr->e),
+                         ldMask / 32,
+                         strideMask / 32,
+                         matmul_descr->dropout,
+                         static_cast<const uint64_t*>(matmul_descr->dropout_seed),
+                         static_cast<const uint64_t*>(matmul_descr->dropout_offset),
+                         matD->m,
+                         matD->n,
+                         matD->batch_count,
+                         stream);
+}
+
+/********************************************************************************
+ * \brief An amax history rolls the amaxD of the GEMM into the history and
+ * derives the D scale of the next step from it, for FP8 delayed scaling.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_amax_history(const rocblaslt_handle       handle,
+                                  const rocblaslt_matmul_desc  matmul_descr,
+                                  const void*                  A,
+                                  const void*                  B,
+                                  const void*                  C,
+                                  void*                        D,
+                                  rocblaslt_matrix_layout      matA,
+                                  rocblaslt_matrix_layout      matB,
+                                  rocblaslt_matrix_layout      matC,
+                                  rocblaslt_matrix_layout      matD,
+                                  const void*                  alpha,
+                                  const void*                  beta,
+                                  const rocblaslt_matmul_algo* algo,
+                                  void*                        workspace,
+                                  size_t                       workspaceSizeInBytes,
+                                  hipStream_t                  stream)
+{
+    if(!matmul_descr->amaxD || !matmul_descr->amax_history_index
+       || !matmul_descr->amax_history_scale)
+    {
+        log_error(__func__, "invalid args", "an amax history needs amaxD, index and scale");
+        return rocblaslt_status_invalid_pointer;
+    }
+    if(matmul_descr->amax_history_length <= 0)
+    {
+        log_error(__func__, "invalid args", "invalid amax history length");
+        return rocblaslt_status_invalid_value;
+    }
+
+    float maxValue = 0.f;
+    switch(matD->type)
+    {
+    case HIP_R_8F_E4M3_FNUZ:
+        maxValue = 240.f;
+        break;
+    case HIP_R_8F_E5M2_FNUZ:
+        maxValue = 57344.f;
+        break;
+#ifdef ROCM_USE_FLOAT8
+    case HIP_R_8F_E4M3:
+        maxValue = 448.f;
+        break;
+    case HIP_R_8F_E5M2:
+        maxValue = 57344.f;
+        break;
+#endif
+    default:
+        log_error(__func__, "invalid args", "an amax history needs an FP8 D");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc gemmDesc;
+    amaxHistoryGemmProblem(*matmul_descr, gemmDesc);
+
+    rocblaslt_status status = rocblaslt_matmul_impl(handle,
+                                                    &gemmDesc,
+                                                    A,
+                                                    B,
+                                                    C,
+                                                    D,
+                                                    matA,
+                                                    matB,
+                                                    matC,
+                                                    matD,
+                                                    alpha,
+                                                    beta,
+                                                    algo,
+                                                    workspace,
+                                                    workspaceSizeInBytes,
+                                                    stream);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    return launchAmaxHistoryUpdate(static_cast<const float*>(matmul_descr->amaxD),
+                                   static_cast<float*>(matmul_descr->amax_history),
+                                   matmul_descr->amax_history_length,
+                                   static_cast<int32_t*>(matmul_descr->amax_history_index),
+                                   static_cast<float*>(matmul_descr->amax_history_scale),
+                                   std::ldexp(maxValue, -matmul_descr->amax_history_margin),
+                                   stream);
+}
+
+/********************************************************************************
+ * \brief The 3xBF16 compute type splits A and B into hi and lo bf16 parts
+ * before the GEMM, see splitBf16GemmProblem, which runs through
+ * rocblaslt_matmul like a block scaled one.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_split_bf16(const rocblaslt_handle       handle,
+                                const rocblaslt_matmul_desc  matmul_descr,
+                                const void*                  A,
+                                const void*                  B,
+                                const void*                  C,
+                                void*                        D,
+                                rocblaslt_matrix_layout      matA,
+                                rocblaslt_matrix_layout      matB,
+                                rocblaslt_matrix_layout      matC,
+                                rocblaslt_matrix_layout      matD,
+                                const void*                  alpha,
+                                const void*                  beta,
+                                const rocblaslt_matmul_algo* algo,
+                                void*                        workspace,
+                                size_t                       workspaceSizeInBytes,
+                                hipStream_t                  stream)
+{
+    if(matA->type != HIP_R_32F || matB->type != HIP_R_32F || matA->order != HIPBLASLT_ORDER_COL
+       || matB->order != HIPBLASLT_ORDER_COL || matA->sparsity != HIPBLASLT_SPARSITY_DENSE
+       || matmul_descr->isScaleABlock || matmul_descr->isScaleBBlock || matmul_descr->b_quant_scale
+       || matmul_descr->epilogue == ROCBLASLT_EPILOGUE_BGRADA
+       || matmul_descr->epilogue == ROCBLASLT_EPILOGUE_BGRADB)
+    {
+        // The bias gradients of A and B would sum the split operands along k
+        log_error(__func__,
+                  "invalid args",
+                  "3xBF16 compute needs dense column major f32 A and B without block scales "
+                  "or their bias gradients");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmA, gemmB;
+    splitBf16GemmProblem(*matmul_descr, *matA, *matB, gemmDesc, gemmA, gemmB);
+
+    const size_t bytesA = layoutWorkspaceBytes(gemmA, 2);
+    const size_t bytesB = layoutWorkspaceBytes(gemmB, 2);
+    if(!bytesA || !bytesB)
+        return rocblaslt_matmul(handle,
+                                &gemmDesc,
+                                alpha,
+                                A,
+                                &gemmA,
+                                B,
+                                &gemmB,
+                                beta,
+                                C,
+                                matC,
+                                D,
+                                matD,
+                                algo,
+                                workspace,
+                                workspaceSizeInBytes,
+                                stream);
+
+    void*            operands = nullptr;
+    rocblaslt_status status
+        = takeWorkspace(bytesA + bytesB, workspace, workspaceSizeInBytes, operands);
+    if(status != rocblaslt_status_success)
+        return status;
+    void* gemmAData = operands;
+    void* gemmBData = static_cast<char*>(operands) + bytesA;
+
+    // lo is the third block of k of A and the second of B, so hi lo and lo hi both appear
+    status = launchSplitBf16(static_cast<const float*>(A),
+                             matA->ld,
+                             matA->batch_stride,
+                             gemmAData,
+                             matA->m,
+                             matA->n,
+                             matmul_descr->op_A != HIPBLAS_OP_N,
+                             2,
+                             matA->batch_count,
+                             stream);
+    if(status == rocblaslt_status_success)
+        status = launchSplitBf16(static_cast<const float*>(B),
+                                 matB->ld,
+                                 matB->batch_stride,
+                                 gemmBData,
+                                 matB->m,
+                                 matB->n,
+                                 matmul_descr->op_B == HIPBLAS_OP_N,
+                                 1,
+                                 matB->batch_count,
+                                 stream);
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul(handle,
+                                  &gemmDesc,
+                                  alpha,
+                                  gemmAData,
+                                  &gemmA,
+                                  gemmBData,
+                                  &gemmB,
+                                  beta,
+                                  C,
+                                  matC,
+                                  D,
+                                  matD,
+                                  algo,
+                                  workspace,
+                                  workspaceSizeInBytes,
+                                  stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief Block scaled A or B are dequantized into bf16 before the GEMM, which
+ * runs through rocblaslt_matmul so that work after the GEMM still applies.
+ * An operand without block scales is converted with its scalar scale.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_block_scaled(const rocblaslt_handle       handle,
+                                  const rocblaslt_matmul_desc  matmul_descr,
+                                  const void*                  A,
+                                  const void*                  B,
+                                  const void*                  C,
+                                  void*                        D,
+                                  rocblaslt_matrix_layout      matA,
+                                  rocblaslt_matrix_layout      matB,
+                                  rocblaslt_matrix_layout      matC,
+                                  rocblaslt_matrix_layout      matD,
+                                  const void*                  alpha,
+                                  const void*                  beta,
+                                  const rocblaslt_matmul_algo* algo,
+                                  void*                        workspace,
+                                  size_t                       workspaceSizeInBytes,
+                                  hipStream_t                  stream)
+{
+    if((matmul_descr->isScaleABlock && !matmul_descr->scaleA)
+       || (matmul_descr->isScaleBBlock && !matmul_descr->scaleB))
+    {
+        log_error(__func__, "invalid data pointer", "block scales need a scale pointer");
+        return rocblaslt_status_invalid_pointer;
+    }
+    if(matA->order != HIPBLASLT_ORDER_COL || matB->order != HIPBLASLT_ORDER_COL
+       || (matmul_descr->isScaleABlock && !isFp8DataType(matA->type))
+       || (matmul_descr->isScaleBBlock && !isFp8DataType(matB->type)) || matmul_descr->isScaleAVec
+       || matmul_descr->isScaleBVec || matmul_descr->compute_type_original != rocblaslt_compute_f32)
+    {
+        log_error(__func__,
+                  "invalid args",
+                  "block scales need column major FP8 operands, f32 compute and no scale vectors");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmA, gemmB;
+    blockScaledGemmProblem(*matmul_descr, *matA, *matB, gemmDesc, gemmA, gemmB);
+
+    const int64_t k       = matmul_descr->op_A == HIPBLAS_OP_N ? matA->n : matA->m;
+    const int64_t kBlocks = (k + 31) / 32;
+    const int64_t m       = matD->m;
+    const int64_t n       = matD->n;
+    const size_t  bytesA  = layoutWorkspaceBytes(gemmA, 2);
+    const size_t  bytesB  = layoutWorkspaceBytes(gemmB, 2);
+    if(!bytesA || !bytesB)
+        return rocblaslt_matmul(handle,
+                                &gemmDesc,
+                                alpha,
+                                A,
+                                &gemmA,
+                                B,
+                                &gemmB,
+                                beta,
+                                C,
+                                matC,
+                                D,
+                                matD,
+                                algo,
+                                workspace,
+                                workspaceSizeInBytes,
+                                stream);
+
+    void*            operands = nullptr;
+    rocblaslt_status status
+        = takeWorkspace(bytesA + bytesB, workspace, workspaceSizeInBytes, operands);
+    if(status != rocblaslt_status_success)
+        return status;
+    void* gemmAData = operands;
+    void* gemmBData = static_cast<char*>(operands) + bytesA;
+
+    // The scale pointer of each operand holds either its block scales or its scalar scale
+    const uint8_t* blockScaleA = nullptr;
+    const uint8_t* blockScaleB = nullptr;
+    const float*   scaleA      = static_cast<const float*>(matmul_descr->scaleA);
+    const float*   scaleB      = static_cast<const float*>(matmul_descr->scaleB);
+    if(matmul_descr->isScaleABlock)
+    {
+        blockScaleA = static_cast<const uint8_t*>(matmul_descr->scaleA);
+        scaleA      = nullptr;
+    }
+    if(matmul_descr->isScaleBBlock)
+    {
+        blockScaleB = static_cast<const uint8_t*>(matmul_descr->scaleB);
+        scaleB      = nullptr;
+    }
+
+    status = launchBlockDequantize(matA->type,
+                                   A,
+                                   matA->ld,
+                                   matA->batch_stride,
+                                   gemmAData,
+                                   matA->m,
+                                   matA->n,
+                                   matmul_descr->op_A != HIPBLAS_OP_N,
+                                   blockScaleA,
+                                   m,
+                                   1,
+                                   m * kBlocks,
+                                   scaleA,
+                                   matA->batch_count,
+                                   stream);
+    if(status == rocblaslt_status_success)
+        status = launchBlockDequantize(matB->type,
+                                       B,
+                                       matB->ld,
+                                       matB->batch_stride,
+                                       gemmBData,
+                                       matB->m,
+                                       matB->n,
+                                       matmul_descr->op_B == HIPBLAS_OP_N,
+                                       blockScaleB,
+                                       1,
+                                       kBlocks,
+                                       kBlocks * n,
+                                       scaleB,
+                                       matB->batch_count,
+                                       stream);
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul(handle,
+                                  &gemmDesc,
+                                  alpha,
+                                  gemmAData,
+                                  &gemmA,
+                                  gemmBData,
+                                  &gemmB,
+                                  beta,
+                                  C,
+                                  matC,
+                                  D,
+                                  matD,
+                                  algo,
+                                  workspace,
+                                  workspaceSizeInBytes,
+                                  stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief A weight-only quantized B is dequantized into the type of A before
+ * the GEMM, which runs through rocblaslt_matmul like a block scaled one.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_weight_only(const rocblaslt_handle       handle,
+                                 const rocblaslt_matmul_desc  matmul_descr,
+                                 const void*                  A,
+                                 const void*                  B,
+                                 const void*                  C,
+                                 void*                        D,
+                                 rocblaslt_matrix_layout      matA,
+                                 rocblaslt_matrix_layout      matB,
+                                 rocblaslt_matrix_layout      matC,
+                                 rocblaslt_matrix_layout      matD,
+                                 const void*                  alpha,
+                                 const void*                  beta,
+                                 const rocblaslt_matmul_algo* algo,
+                                 void*                        workspace,
+                                 size_t                       workspaceSizeInBytes,
+                                 hipStream_t                  stream)
+{
+    if(matmul_descr->b_quant_group_size < 0)
+    {
+        log_error(__func__, "invalid group size", matmul_descr->b_quant_group_size);
+        return rocblaslt_status_invalid_value;
+    }
+    if((matB->type != HIP_R_8I && matB->type != HIP_R_4I)
+       || (matA->type != HIP_R_16F && matA->type != HIP_R_16BF)
+       || matB->order != HIPBLASLT_ORDER_COL || matmul_descr->scaleB)
+    {
+        log_error(__func__,
+                  "invalid args",
+                  "a quantized B needs a column major int8 or int4 B, an f16 or bf16 A and no "
+                  "B scale");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmB;
+    weightOnlyGemmProblem(*matmul_descr, *matA, *matB, gemmDesc, gemmB);
+
+    const int64_t k     = matmul_descr->op_B == HIPBLAS_OP_N ? matB->m : matB->n;
+    const size_t  bytes = layoutWorkspaceBytes(gemmB, 2);
+    if(!bytes)
+        return rocblaslt_matmul(handle,
+                                &gemmDesc,
+                                alpha,
+                                A,
+                                matA,
+                                B,
+                                &gemmB,
+                                beta,
+                                C,
+                                matC,
+                                D,
+                                matD,
+                                algo,
+                                workspace,
+                                workspaceSizeInBytes,
+                                stream);
+
+    void*            gemmBData = nullptr;
+    rocblaslt_status status = takeWorkspace(bytes, workspace, workspaceSizeInBytes, gemmBData);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    status = launchWeightDequantize(matB->type,
+                                    B,
+                                    matB->ld,
+                                    matB->batch_stride,
+                                    gemmB.type,
+                                    gemmBData,
+                                    matB->m,
+                                    matB->n,
+                                    matmul_descr->op_B == HIPBLAS_OP_N,
+                                    matmul_descr->b_quant_scale,
+                                    matmul_descr->b_quant_zero,
+                                    matmul_descr->b_quant_group_size
+                                        ? matmul_descr->b_quant_group_size
+                                        : k,
+                                    matB->batch_count,
+                                    stream);
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul(handle,
+                                  &gemmDesc,
+                                  alpha,
+                                  A,
+                                  matA,
+                                  gemmBData,
+                                  &gemmB,
+                                  beta,
+                                  C,
+                                  matC,
+                                  D,
+                                  matD,
+                                  algo,
+                                  workspace,
+                                  workspaceSizeInBytes,
+                                  stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief A two-level batch runs as one strided batched GEMM when its levels
+ * flatten into one, and otherwise as one rocblaslt_matmul per batch of the
+ * smaller level, each batched over the other level and offset into the
+ * matrices by its stride.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_nested_batch(const rocblaslt_handle       handle,
+                                  const rocblaslt_matmul_desc  matmul_descr,
+                                  const void*                  A,
+                                  const void*                  B,
+                                  const void*                  C,
+                                  void*                        D,
+                                  rocblaslt_matrix_layout      matA,
+                                  rocblaslt_matrix_layout      matB,
+                                  rocblaslt_matrix_layout      matC,
+                                  rocblaslt_matrix_layout      matD,
+                                  const void*                  alpha,
+                                  const void*                  beta,
+                                  const rocblaslt_matmul_algo* algo,
+                                  void*                        workspace,
+                                  size_t                       workspaceSizeInBytes,
+                                  hipStream_t                  stream)
+{
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemm[4];
+    nestedBatchGemmProblem(
+        *matmul_descr, *matA, *matB, *matC, *matD, gemmDesc, gemm[0], gemm[1], gemm[2], gemm[3]);
+
+    const auto plan  = nestedBatchPlan(*matA, *matB, *matC, *matD);
+    int32_t    loops = 1;
+    if(plan == NestedBatch::LoopOuter)
+        loops = matD->outer_batch_count;
+    else if(plan == NestedBatch::LoopInner)
+        loops = matD->batch_count;
+
+    const rocblaslt_matrix_layout mats[4] = {matA, matB, matC, matD};
+    // Bytes from one batch of the looped level to the next
+    int64_t loopBytes[4] = {0};
+    for(int i = 0; i < 4 && loops > 1; i++)
+    {
+        auto tensileType = hipDataType_to_tensile_type(mats[i]->type);
+        auto stride
+            = plan == NestedBatch::LoopOuter ? mats[i]->outer_batch_stride : mats[i]->batch_stride;
+        loopBytes[i] = stride * int64_t(TensileLite::DataTypeInfo::Get(tensileType).elementSize);
+    }
+
+    rocblaslt_status status = rocblaslt_status_success;
+    for(int32_t l = 0; l < loops && status == rocblaslt_status_success; l++)
+        status = rocblaslt_matmul(handle,
+                                  &gemmDesc,
+                                  alpha,
+                                  static_cast<const char*>(A) + l * loopBytes[0],
+                                  &gemm[0],
+                                  static_cast<const char*>(B) + l * loopBytes[1],
+                                  &gemm[1],
+                                  beta,
+                                  static_cast<const char*>(C) + l * loopBytes[2],
+                                  &gemm[2],
+                                  static_cast<char*>(D) + l * loopBytes[3],
+                                  &gemm[3],
+                                  algo,
+                                  workspace,
+                                  workspaceSizeInBytes,
+                                  stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief Pointer array A, B and C are gathered into packed buffers that the
+ * GEMM reads through rocblaslt_matmul, and a pointer array D is scattered from
+ * the packed buffer the GEMM writes. A pointer array C that is the pointer
+ * array of D is gathered into the buffer of D.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_pointer_array(const rocblaslt_handle       handle,
+                                   const rocblaslt_matmul_desc  matmul_descr,
+                                   const void*                  A,
+                                   const void*                  B,
+                                   const void*                  C,
+                                   void*                        D,
+                                   rocblaslt_matrix_layout      matA,
+                                   rocblaslt_matrix_layout      matB,
+                                   rocblaslt_matrix_layout      matC,
+                                   rocblaslt_matrix_layout      matD,
+                                   const void*                  alpha,
+                                   const void*                  beta,
+                                   const rocblaslt_matmul_algo* algo,
+                                   void*                        workspace,
+                                   size_t                       workspaceSizeInBytes,
+                                   hipStream_t                  stream)
+{
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemm[4];
+    pointerArrayGemmProblem(
+        *matmul_descr, *matA, *matB, *matC, *matD, gemmDesc, gemm[0], gemm[1], gemm[2], gemm[3]);
+
+    const rocblaslt_matrix_layout mats[4] = {matA, matB, matC, matD};
+    const void*                   data[4] = {A, B, C, D};
+    for(auto mat : mats)
+    {
+        if(is_pointer_array(*mat) && mat->type == HIP_R_4I)
+        {
+            log_error(__func__, "invalid args", "pointer array batches of int4");
+            return rocblaslt_status_not_implemented;
+        }
+    }
+
+    const bool sharedCD = is_pointer_array(*matC) && is_pointer_array(*matD) && C == D;
+
+    size_t elementBytes[4], offsets[4];
+    size_t bytes = pointerArrayWorkspaceBytes(mats, gemm, sharedCD, elementBytes, offsets);
+
+    void*            packed = nullptr;
+    rocblaslt_status status = rocblaslt_status_success;
+    if(bytes)
+        status = takeWorkspace(bytes, workspace, workspaceSizeInBytes, packed);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    void* gemmData[4];
+    for(int i = 0; i < 4; i++)
+        gemmData[i] = elementBytes[i] ? static_cast<char*>(packed) + offsets[i]
+                                      : const_cast<void*>(data[i]);
+    if(sharedCD)
+    {
+        gemmData[2]     = gemmData[3];
+        elementBytes[2] = elementBytes[3];
+    }
+
+    for(int i = 0; i < 3 && status == rocblaslt_status_success; i++)
+    {
+        if(!is_pointer_array(*mats[i]))
+            continue;
+        const bool rowOrder = mats[i]->order == HIPBLASLT_ORDER_ROW;
+        status = launchBatchCopy(elementBytes[i],
+                                 static_cast<const void* const*>(data[i]),
+                                 nullptr,
+                                 mats[i]->ld,
+                                 0,
+                                 nullptr,
+                                 gemmData[i],
+                                 gemm[i].ld,
+                                 gemm[i].batch_stride,
+                                 rowOrder ? mats[i]->n : mats[i]->m,
+                                 rowOrder ? mats[i]->m : mats[i]->n,
+                                 mats[i]->batch_count,
+                                 stream);
+    }
+
+    if(status == rocblaslt_status_success)
+        status = rocblaslt_matmul(handle,
+                                  &gemmDesc,
+                                  alpha,
+                                  gemmData[0],
+                                  &gemm[0],
+                                  gemmData[1],
+                                  &gemm[1],
+                                  beta,
+                                  gemmData[2],
+                                  &gemm[2],
+                                  gemmData[3],
+                                  &gemm[3],
+                                  algo,
+                                  workspace,
+                                  workspaceSizeInBytes,
+                                  stream);
+
+    if(status == rocblaslt_status_success && is_pointer_array(*matD))
+        status = launchBatchCopy(elementBytes[3],
+                                 nullptr,
+                                 gemmData[3],
+                                 gemm[3].ld,
+                                 gemm[3].batch_stride,
+                                 static_cast<void* const*>(D),
+                                 nullptr,
+                                 matD->ld,
+                                 0,
+                                 matD->m,
+                                 matD->n,
+                                 matD->batch_count,
+                                 stream);
+    return status;
+}
+
+/********************************************************************************
+ * \brief Completion flags run rocblaslt_matmul chunk by chunk over the columns
+ * of D and bump the counter of each chunk once it is stored, so that a kernel
+ * on another stream can start on finished chunks of D.
+ *******************************************************************************/
+static rocblaslt_status rocblaslt_matmul_chunked(const rocblaslt_handle       handle,
+                                                 const rocblaslt_matmul_desc  matmul_descr,
+                                                 const void*                  A,
+                                                 const void*                  B,
+                                                 const void*                  C,
+                                                 void*                        D,
+                                                 rocblaslt_matrix_layout      matA,
+                                                 rocblaslt_matrix_layout      matB,
+                                                 rocblaslt_matrix_layout      matC,
+                                                 rocblaslt_matrix_layout      matD,
+                                                 const void*                  alpha,
+                                                 const void*                  beta,
+                                                 const rocblaslt_matmul_algo* algo,
+                                                 void*                        workspace,
+                                                 size_t                       workspaceSizeInBytes,
+                                                 hipStream_t                  stream)
+{
+    if(matmul_descr->completion_cols < 0)
+    {
+        log_error(__func__, "invalid completion chunk cols", matmul_descr->completion_cols);
+        return rocblaslt_status_invalid_value;
+    }
+    if(is_grad_enabled(matmul_descr->epilogue) || is_e_enabled(matmul_descr->epilogue)
+       || matmul_descr->amaxD || matmul_descr->amax_history || matmul_descr->d2
+       || matmul_descr->residual || matmul_descr->dropout > 0.f || matmul_descr->isScaleBVec
+       || (matmul_descr->isScaleDVec && matmul_descr->scaleDVecAlongN)
+       || matmul_descr->isScaleABlock || matmul_descr->isScaleBBlock
+       || matmul_descr->b_quant_scale)
+    {
+        log_error(__func__,
+                  "invalid args",
+                  "completion flags need work that is independent across the columns of D");
+        return rocblaslt_status_not_implemented;
+    }
+
+    const auto    sizeB   = TensileLite::DataTypeInfo::Get(hipDataType_to_tensile_type(matB->type));
+    const auto    sizeCD  = TensileLite::DataTypeInfo::Get(hipDataType_to_tensile_type(matD->type));
+    const int64_t n       = matD->n;
+    const int64_t cols    = completionChunkCols(*matmul_descr, *matD);
+    const bool    bColsLd
+        = (matmul_descr->op_B == HIPBLAS_OP_N) == (matB->order == HIPBLASLT_ORDER_COL);
+    const size_t  strideB = (bColsLd ? matB->ld : 1) * sizeB.elementSize;
+    const size_t  strideC = matC->ld * sizeCD.elementSize;
+    const size_t  strideD = matD->ld * sizeCD.elementSize;
+    auto*         flags   = static_cast<uint32_t*>(matmul_descr->completion_flags);
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmB, gemmC, gemmD;
+    for(int64_t c0 = 0; c0 < n; c0 += cols)
+    {
+        completionGemmProblem(*matmul_descr,
+                              *matB,
+                              *matC,
+                              *matD,
+                              std::min(cols, n - c0),
+                              gemmDesc,
+                              gemmB,
+                              gemmC,
+                              gemmD);
+
+        rocblaslt_status status
+            = rocblaslt_matmul(handle,
+                               &gemmDesc,
+                               alpha,
+                               A,
+                               matA,
+                               static_cast<const char*>(B) + c0 * strideB,
+                               &gemmB,
+                               beta,
+                               static_cast<const char*>(C) + c0 * strideC,
+                               &gemmC,
+                               static_cast<char*>(D) + c0 * strideD,
+                               &gemmD,
+                               algo,
+                               workspace,
+                               workspaceSizeInBytes,
+                               stream);
+        if(status == rocblaslt_status_success)
+            status = launchChunkSignal(flags + c0 / cols, stream);
+        if(status != rocblaslt_status_success)
+            return status;
+    }
+    return rocblaslt_status_success;
+}
+
+/********************************************************************************
+ * \brief Device alpha and beta reach the GEMM through the pass in front of it,
+ * so neither is read on the host, see deviceScalarGemmProblem.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_device_scalars(const rocblaslt_handle       handle,
+                                    const rocblaslt_matmul_desc  matmul_descr,
+                                    const void*                  A,
+                                    const void*                  B,
+                                    const void*                  C,
+                                    void*                        D,
+                                    rocblaslt_matrix_layout      matA,
+                                    rocblaslt_matrix_layout      matB,
+                                    rocblaslt_matrix_layout      matC,
+                                    rocblaslt_matrix_layout      matD,
+                                    const void*                  alpha,
+                                    const void*                  beta,
+                                    const rocblaslt_matmul_algo* algo,
+                                    void*                        workspace,
+                                    size_t                       workspaceSizeInBytes,
+                                    hipStream_t                  stream)
+{
+    if(!deviceScalarsSupported(*matmul_descr, *matC))
+    {
+        log_error(
+            __func__, "invalid args", "device alpha and beta need f32 compute and a strided C");
+        return rocblaslt_status_not_implemented;
+    }
+
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmC;
+    deviceScalarGemmProblem(*matmul_descr, *matA, *matB, *matC, alpha, gemmDesc, gemmC);
+
+    size_t           alphaBytes = 0;
+    const size_t     bytes      = deviceScalarWorkspaceBytes(gemmDesc, gemmC, &alphaBytes);
+    void*            buffer     = nullptr;
+    rocblaslt_status status     = takeWorkspace(bytes, workspace, workspaceSizeInBytes, buffer);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    float* alphaVec  = alphaBytes ? static_cast<float*>(buffer) : nullptr;
+    void*  gemmCData = static_cast<char*>(buffer) + alphaBytes;
+
+    status = launchDeviceScalars(matC->type,
+                                 C,
+                                 matC->ld,
+                                 matC->batch_stride,
+                                 gemmCData,
+                                 static_cast<const float*>(alpha),
+                                 static_cast<const float*>(beta),
+                                 alphaVec,
+                                 matC->m,
+                                 matC->n,
+                                 matC->batch_count,
+                                 stream);
+    if(status != rocblaslt_status_success)
+        return status;
+
+    int8_t      one[16] = {0};
+    const void* hostOne = nullptr;
+    setTo1(gemmDesc.compute_type, (void*)one, &hostOne);
+    return rocblaslt_matmul(handle,
+                            &gemmDesc,
+                            alphaVec ? alphaVec : hostOne,
+                            A,
+                            matA,
+                            B,
+                            matB,
+                            hostOne,
+                            gemmCData,
+                            &gemmC,
+                            D,
+                            matD,
+                            algo,
+                            workspace,
+                            workspaceSizeInBytes,
+                            stream);
+}
+
+/********************************************************************************
+ * \brief A batched GEMM with a broadcast operand runs as one GEMM with the
+ * batches folded into m or n, see broadcastBatchFold.
+ *******************************************************************************/
+static rocblaslt_status
+    rocblaslt_matmul_broadcast(const rocblaslt_handle       handle,
+                               const rocblaslt_matmul_desc  matmul_descr,
+                               BatchFold                    fold,
+                               const void*                  A,
+                               const void*                  B,
+                               const void*                  C,
+                               void*                        D,
+                               rocblaslt_matrix_layout      matA,
+                               rocblaslt_matrix_layout      matB,
+                               rocblaslt_matrix_layout      matC,
+                               rocblaslt_matrix_layout      matD,
+                               const void*                  alpha,
+                               const void*                  beta,
+                               const rocblaslt_matmul_algo* algo,
+                               void*                        workspace,
+                               size_t                       workspaceSizeInBytes,
+                               hipStream_t                  stream)
+{
+    _rocblaslt_matmul_desc   gemmDesc;
+    _rocblaslt_matrix_layout gemmA, gemmB, gemmC, gemmD;
+    broadcastGemmProblem(
+        *matmul_descr, *matA, *matB, *matC, *matD, fold, gemmDesc, gemmA, gemmB, gemmC, gemmD);
+    return rocblaslt_matmul(handle,
+                            &gemmDesc,
+                            alpha,
+                            A,
+                            &gemmA,
+                            B,
+                            &gemmB,
+                            beta,
+                            C,
+                            &gemmC,
+                            D,
+                            &gemmD,
+                            algo,
+                            workspace,
+                            workspaceSizeInBytes,
+                            stream);
+}
+
 rocblaslt_status rocblaslt_gemm_create_cpp_impl(const rocblaslt_handle         handle,
                                                 rocblaslt_matmul_desc          matmul_descr,
                                                 const void*                    A,
@@ -222,6 +1758,13 @@ rocblaslt_status rocblaslt_gemm_create_cpp_impl(const rocblaslt_handle         h
                                                 std::shared_ptr<void>&         gemmData,
                                                 size_t&                        gemmCount)
 {
+    // The pass that takes device alpha and beta runs in hipblasLtMatmul only
+    if(matmul_descr->pointermode == rocblaslt_pointer_mode_device)
+    {
+        log_error(__func__, "invalid args", "device alpha and beta need hipblasLtMatmul");
+        return rocblaslt_status_not_implemented;
+    }
+
     int64_t m, n, k, lda, ldb, ldc, ldd, lde, batch_stride_a, batch_stride_b, batch_stride_c,
         batch_stride_d, batch_stride_e;
     hipDataType            bias_type;
@@ -267,8 +1810,8 @@ rocblaslt_status rocblaslt_gemm_create_cpp_impl(const rocblaslt_handle         h
         return isValid;
 
     // Internal assign
-    hipblasOperation_t opA           = matmul_descr->op_A;
-    hipblasOperation_t opB           = matmul_descr->op_B;
+    hipblasOperation_t opA           = matmulKernelOp(matmul_descr->op_A, matA);
+    hipblasOperation_t opB           = matmulKernelOp(matmul_descr->op_B, matB);
     int                num_batches_a = matA->batch_count;
     rocblaslt_epilogue epilogue      = matmul_descr->epilogue;
     void*              scaleA        = matmul_descr->scaleA;
@@ -428,6 +1971,22 @@ rocblaslt_status
         int64_t batch_stride_d = matD[i]->batch_stride;
         int     num_batches_d  = matD[i]->batch_count;
 
+        // All groups run with the operations of the first one
+        auto orderStatus = validateMatmulOrders(matA[i], matB[i], matC[i], matD[i]);
+        if(orderStatus != rocblaslt_status_continue)
+            return orderStatus;
+        if(matA[i]->order != matA[0]->order || matB[i]->order != matB[0]->order
+           || is_pointer_array(*matA[i]) || is_pointer_array(*matB[i])
+           || is_pointer_array(*matC[i]) || is_pointer_array(*matD[i]))
+            return rocblaslt_status_not_implemented;
+        if(matmul_descr[i]->residual || (matmul_descr[i]->isScaleDVec && matmul_descr[i]->scaleD)
+           || matmul_descr[i]->dropout > 0.f || matmul_descr[i]->amax_history
+           || matmul_descr[i]->isScaleABlock || matmul_descr[i]->isScaleBBlock
+           || matmul_descr[i]->b_quant_scale || is_aux_convert_enabled(*matmul_descr[i], *matD[i])
+           || matmul_descr[i]->d2 || is_bgrad_deterministic(*matmul_descr[i])
+           || matmul_descr[i]->completion_flags)
+            return rocblaslt_status_not_implemented;
+
         int64_t m = num_rows_d;
         int64_t n = num_cols_d;
         int64_t k = (opA == HIPBLAS_OP_N) ? num_cols_a : num_rows_a;
@@ -467,7 +2026,10 @@ rocblaslt_status
         int64_t            lde, batch_stride_e;
         bool               gradient;
         rocblaslt_epilogue epilogue    = matmul_descr[i]->epilogue;
-        const void*        alphaVecPtr = matmul_descr[i]->pointermode ? alpha[i] : nullptr;
+        const void*        alphaVecPtr
+            = matmul_descr[i]->pointermode == rocblaslt_pointer_mode_alpha_device_vector_beta_host
+                  ? alpha[i]
+                  : nullptr;
         if(validArgs == rocblaslt_status_continue)
             validArgs = rocblaslt_epilogue_valid_args(epilogue, // add alpha
                                                       num_rows_d,
@@ -503,8 +2065,8 @@ rocblaslt_status
             alphaTmp = alpha[i];
         }
 
-        tempprobemtype.push_back({matmul_descr[i]->op_A,
-                                  matmul_descr[i]->op_B,
+        tempprobemtype.push_back({matmulKernelOp(matmul_descr[i]->op_A, matA[i]),
+                                  matmulKernelOp(matmul_descr[i]->op_B, matB[i]),
                                   matA[i]->type,
                                   matB[i]->type,
                                   matC[i]->type,
@@ -573,8 +2135,8 @@ rocblaslt_status
     std::vector<RocblasltContractionProblem> problems;
     for(int i = 0; i < m_vec.size(); i++)
     {
-        problems.push_back(RocblasltContractionProblem{opA,
-                                                       opB,
+        problems.push_back(RocblasltContractionProblem{matmulKernelOp(opA, matA[0]),
+                                                       matmulKernelOp(opB, matB[0]),
                                                        m_vec[i],
                                                        n_vec[i],
                                                        k_vec[i],
@@ -658,6 +2220,21 @@ rocblaslt_status rocblaslt_matmul(rocblaslt_handle             handle,
         return rocblaslt_status_invalid_handle;
     }
 
+    CallTiming::Call timing([&] {
+        std::ostringstream signature;
+        signature << "m=" << matD->m << " n=" << matD->n
+                  << " k=" << (matmul_descr->op_A == HIPBLAS_OP_N ? matA->n : matA->m)
+                  << " batch=" << matD->batch_count
+                  << " opA=" << hipblasOperation_to_string(matmul_descr->op_A)
+                  << " opB=" << hipblasOperation_to_string(matmul_descr->op_B)
+                  << " a=" << hipDataType_to_string(matA->type)
+                  << " b=" << hipDataType_to_string(matB->type)
+                  << " d=" << hipDataType_to_string(matD->type)
+                  << " compute=" << rocblaslt_compute_type_to_string(matmul_descr->compute_type)
+                  << " epilogue=" << rocblaslt_epilogue_to_string(matmul_descr->epilogue);
+        return signature.str();
+    });
+
     // Update for the valid case: ((alpha_in_host && alpha=0) && (A=NULL || B=NULL))
     bool alpha_A_B_violation
         = (!alpha || ((matmul_descr->pointermode || (*((float*)alpha))) && (!A || !B)));
@@ -679,6 +2256,17 @@ rocblaslt_status rocblaslt_matmul(rocblaslt_handle             handle,
         return rocblaslt_status_type_mismatch;
     }
 
+    auto sparseStatus = validateSparseA(*matmul_descr, *matA, true);
+    if(sparseStatus != rocblaslt_status_continue)
+        return sparseStatus;
+    if(is_nested_batch(*matA) || is_nested_batch(*matB) || is_nested_batch(*matC)
+       || is_nested_batch(*matD))
+    {
+        auto nestedStatus = validateNestedBatch(*matmul_descr, *matA, *matB, *matC, *matD);
+        if(nestedStatus != rocblaslt_status_continue)
+            return nestedStatus;
+    }
+
     if(get_logger_layer_mode() != rocblaslt_layer_mode_none)
     {
         log_api(__func__,
@@ -712,6 +2300,15 @@ rocblaslt_status rocblaslt_matmul(rocblaslt_handle             handle,
 
     if(get_logger_layer_mode() != rocblaslt_layer_mode_none)
     {
+        // Scalars in device memory are logged by address, reading them would sync the stream
+        auto scalar = [](const void* ptr, bool onHost) {
+            std::ostringstream os;
+            if(onHost)
+                os << *(reinterpret_cast<const float*>(ptr));
+            else
+                os << ptr;
+            return os.str();
+        };
         log_trace(__func__,
                   "A",
                   A,
@@ -735,13 +2332,290 @@ rocblaslt_status rocblaslt_matmul(rocblaslt_handle             handle,
                   workspace,
                   "workSpaceSizeInBytes",
                   workspaceSizeInBytes,
-                  (matmul_descr->pointermode) ? "alphaVector" : "alpha",
-                  *(reinterpret_cast<const float*>(alpha)),
+                  matmul_descr->pointermode == rocblaslt_pointer_mode_alpha_device_vector_beta_host
+                      ? "alphaVector"
+                      : "alpha",
+                  scalar(alpha, matmul_descr->pointermode == rocblaslt_pointer_mode_host),
                   "beta",
-                  *(reinterpret_cast<const float*>(beta)),
+                  scalar(beta, matmul_descr->pointermode != rocblaslt_pointer_mode_device),
                   "stream",
                   stream);
     }
+    if(matmul_descr->pointermode == rocblaslt_pointer_mode_device)
+        return rocblaslt_matmul_device_scalars(handle,
+                                               matmul_descr,
+                                               A,
+                                               B,
+                                               C,
+                                               D,
+                                               matA,
+                                               matB,
+                                               matC,
+                                               matD,
+                                               alpha,
+                                               beta,
+                                               algo,
+                                               workspace,
+                                               workspaceSizeInBytes,
+                                               stream);
+    if(is_nested_batch(*matD))
+        return rocblaslt_matmul_nested_batch(handle,
+                                             matmul_descr,
+                                             A,
+                                             B,
+                                             C,
+                                             D,
+                                             matA,
+                                             matB,
+                                             matC,
+                                             matD,
+                                             alpha,
+                                             beta,
+                                             algo,
+                                             workspace,
+                                             workspaceSizeInBytes,
+                                             stream);
+    if(is_pointer_array(*matA) || is_pointer_array(*matB) || is_pointer_array(*matC)
+       || is_pointer_array(*matD))
+        return rocblaslt_matmul_pointer_array(handle,
+                                              matmul_descr,
+                                              A,
+                                              B,
+                                              C,
+                                              D,
+                                              matA,
+                                              matB,
+                                              matC,
+                                              matD,
+                                              alpha,
+                                              beta,
+                                              algo,
+                                              workspace,
+                                              workspaceSizeInBytes,
+                                              stream);
+    if(matmul_descr->completion_flags)
+        return rocblaslt_matmul_chunked(handle,
+                                        matmul_descr,
+                                        A,
+                                        B,
+                                        C,
+                                        D,
+                                        matA,
+                                        matB,
+                                        matC,
+                                        matD,
+                                        alpha,
+                                        beta,
+                                        algo,
+                                        workspace,
+                                        workspaceSizeInBytes,
+                                        stream);
+    if(matmul_descr->compute_type == rocblaslt_compute_f32_fast_3xbf16)
+        return rocblaslt_matmul_split_bf16(handle,
+                                           matmul_descr,
+                                           A,
+                                           B,
+                                           C,
+                                           D,
+                                           matA,
+                                           matB,
+                                           matC,
+                                           matD,
+                                           alpha,
+                                           beta,
+                                           algo,
+                                           workspace,
+                                           workspaceSizeInBytes,
+                                           stream);
+    if(matmul_descr->isScaleABlock || matmul_descr->isScaleBBlock)
+        return rocblaslt_matmul_block_scaled(handle,
+                                             matmul_descr,
+                                             A,
+                                             B,
+                                             C,
+                                             D,
+                                             matA,
+                                             matB,
+                                             matC,
+                                             matD,
+                                             alpha,
+                                             beta,
+                                             algo,
+                                             workspace,
+                                             workspaceSizeInBytes,
+                                             stream);
+    if(matmul_descr->b_quant_scale)
+        return rocblaslt_matmul_weight_only(handle,
+                                            matmul_descr,
+                                            A,
+                                            B,
+                                            C,
+                                            D,
+                                            matA,
+                                            matB,
+                                            matC,
+                                            matD,
+                                            alpha,
+                                            beta,
+                                            algo,
+                                            workspace,
+                                            workspaceSizeInBytes,
+                                            stream);
+    if(is_bgrad_deterministic(*matmul_descr))
+        return rocblaslt_matmul_bgrad(handle,
+                                      matmul_descr,
+                                      A,
+                                      B,
+                                      C,
+                                      D,
+                                      matA,
+                                      matB,
+                                      matC,
+                                      matD,
+                                      alpha,
+                                      beta,
+                                      algo,
+                                      workspace,
+                                      workspaceSizeInBytes,
+                                      stream);
+    if(matmul_descr->d2)
+        return rocblaslt_matmul_dual_output(handle,
+                                            matmul_descr,
+                                            A,
+                                            B,
+                                            C,
+                                            D,
+                                            matA,
+                                            matB,
+                                            matC,
+                                            matD,
+                                            alpha,
+                                            beta,
+                                            algo,
+                                            workspace,
+                                            workspaceSizeInBytes,
+                                            stream);
+    if(is_aux_convert_enabled(*matmul_descr, *matD))
+        return rocblaslt_matmul_aux(handle,
+                                    matmul_descr,
+                                    A,
+                                    B,
+                                    C,
+                                    D,
+                                    matA,
+                                    matB,
+                                    matC,
+                                    matD,
+                                    alpha,
+                                    beta,
+                                    algo,
+                                    workspace,
+                                    workspaceSizeInBytes,
+                                    stream);
+    if(is_gated_enabled(matmul_descr->epilogue))
+        return rocblaslt_matmul_gated(handle,
+                                      matmul_descr,
+                                      A,
+                                      B,
+                                      C,
+                                      D,
+                                      matA,
+                                      matB,
+                                      matC,
+                                      matD,
+                                      alpha,
+                                      beta,
+                                      algo,
+                                      workspace,
+                                      workspaceSizeInBytes,
+                                      stream);
+    if(matmul_descr->dropout > 0.f)
+        return rocblaslt_matmul_dropout(handle,
+                                        matmul_descr,
+                                        A,
+                                        B,
+                                        C,
+                                        D,
+                                        matA,
+                                        matB,
+                                        matC,
+                                        matD,
+                                        alpha,
+                                        beta,
+                                        algo,
+                                        workspace,
+                                        workspaceSizeInBytes,
+                                        stream);
+    if(matmul_descr->isScaleDVec && matmul_descr->scaleD)
+        return rocblaslt_matmul_scaled_d(handle,
+                                         matmul_descr,
+                                         A,
+                                         B,
+                                         C,
+                                         D,
+                                         matA,
+                                         matB,
+                                         matC,
+                                         matD,
+                                         alpha,
+                                         beta,
+                                         algo,
+                                         workspace,
+                                         workspaceSizeInBytes,
+                                         stream);
+    if(matmul_descr->residual)
+        return rocblaslt_matmul_residual(handle,
+                                         matmul_descr,
+                                         A,
+                                         B,
+                                         C,
+                                         D,
+                                         matA,
+                                         matB,
+                                         matC,
+                                         matD,
+                                         alpha,
+                                         beta,
+                                         algo,
+                                         workspace,
+                                         workspaceSizeInBytes,
+                                         stream);
+    if(matmul_descr->amax_history)
+        return rocblaslt_matmul_amax_history(handle,
+                                             matmul_descr,
+                                             A,
+                                             B,
+                                             C,
+                                             D,
+                                             matA,
+                                             matB,
+                                             matC,
+                                             matD,
+                                             alpha,
+                                             beta,
+                                             algo,
+                                             workspace,
+                                             workspaceSizeInBytes,
+                                             stream);
+    if(auto fold = broadcastBatchFold(*matmul_descr, *matA, *matB, *matC, *matD);
+       fold != BatchFold::None)
+        return rocblaslt_matmul_broadcast(handle,
+                                          matmul_descr,
+                                          fold,
+                                          A,
+                                          B,
+                                          C,
+                                          D,
+                                          matA,
+                                          matB,
+                                          matC,
+                                          matD,
+                                          alpha,
+                                          beta,
+                                          algo,
+                                          workspace,
+                                          workspaceSizeInBytes,
+                                          stream);
     return rocblaslt_matmul_impl(handle,
                                  matmul_descr,
                                  A,
@@ -1178,20 +3052,12 @@ rocblaslt_status rocblaslt_groupedgemm_create_cpp_impl_2(const rocblaslt_handle
     hipDataType            type_c       = problemtype[0].type_c;
     hipDataType            type_d       = problemtype[0].type_d;
 
-    std::vector<const void*>        A_vec, B_vec, C_vec, alpha_vec, beta_vec;
-    std::vector<void*>              D_vec, E_vec, amaxD_vec;
-    std::vector<const void*>        bias_vec;
-    std::vector<const void*>        scaleA_vec;
-    std::vector<const void*>        scaleB_vec;
-    std::vector<const void*>        scaleC_vec;
-    std::vector<const void*>        scaleD_vec;
-    std::vector<const void*>        scaleE_vec;
-    std::vector<const void*>        scaleAlpha_vec;
-    std::vector<hipDataType>        bias_type_vec;
-    std::vector<rocblaslt_epilogue> epilogue_vec;
+    bool strided_batch = true;
+    bool grouped_gemm  = true;
 
-    std::vector<int64_t> lde_vec, batch_stride_e_vec, num_batches_e_vec;
-    std::vector<bool>    gradient_vec;
+    // The problems are built straight from the groups, without a vector per field in between
+    std::vector<RocblasltContractionProblem> problems;
+    problems.reserve(m.size());
 
     std::vector<int8_t[16]> alpha_1(m.size());
 
@@ -1297,153 +3163,70 @@ rocblaslt_status rocblaslt_groupedgemm_create_cpp_impl_2(const rocblaslt_handle
             alphaTmp = inputs[i].alpha;
         }
 
-        bias_type_vec.push_back(bias_type);
-        epilogue_vec.push_back(epilogue);
-        bias_vec.push_back(bias);
-        scaleA_vec.push_back(inputs[i].scaleA);
-        scaleB_vec.push_back(inputs[i].scaleB);
-        scaleC_vec.push_back(inputs[i].scaleC);
-        scaleD_vec.push_back(inputs[i].scaleD);
-        scaleE_vec.push_back(inputs[i].scaleE);
-        scaleAlpha_vec.push_back(scaleAlphaVec);
-
+        bool isScaleAVec = false, isScaleBVec = false;
+        if constexpr(!std::is_same<Epilogue, rocblaslt::RocGemmEpilogue>::value)
+        {
+            isScaleAVec = static_cast<bool>(rocEpilogue[iIdx].scaling_a_type);
+            isScaleBVec = static_cast<bool>(rocEpilogue[iIdx].scaling_b_type);
+        }
+        void* amaxD = nullptr;
         if constexpr(std::is_same<Inputs, rocblaslt::RocGemmInputsV2>::value)
-            amaxD_vec.push_back(inputs[i].amaxD);
-        else
-            amaxD_vec.push_back(nullptr);
-
-        A_vec.push_back(inputs[i].a);
-        B_vec.push_back(inputs[i].b);
-        C_vec.push_back(inputs[i].c);
-        D_vec.push_back(inputs[i].d);
-        E_vec.push_back(E);
-        alpha_vec.push_back(alphaTmp);
-        beta_vec.push_back(inputs[i].beta);
+            amaxD = inputs[i].amaxD;
 
-        lde_vec.push_back(lde);
-        batch_stride_e_vec.push_back(batch_stride_e);
-        gradient_vec.push_back(gradient);
+        problems.push_back(RocblasltContractionProblem{opA,
+                                                       opB,
+                                                       m[i],
+                                                       n[i],
+                                                       k[i],
+                                                       alphaTmp,
+                                                       type_a,
+                                                       inputs[i].a,
+                                                       nullptr,
+                                                       lda[i],
+                                                       strideA[i],
+                                                       type_b,
+                                                       inputs[i].b,
+                                                       nullptr,
+                                                       ldb[i],
+                                                       strideB[i],
+                                                       inputs[i].beta,
+                                                       type_c,
+                                                       inputs[i].c,
+                                                       nullptr,
+                                                       ldc[i],
+                                                       strideC[i],
+                                                       type_d,
+                                                       inputs[i].d,
+                                                       nullptr,
+                                                       ldd[i],
+                                                       strideD[i],
+                                                       E,
+                                                       nullptr,
+                                                       lde,
+                                                       batch_stride_e,
+                                                       b[i],
+                                                       strided_batch,
+                                                       grouped_gemm,
+                                                       gradient,
+                                                       compute_type,
+                                                       bias,
+                                                       inputs[i].scaleA,
+                                                       inputs[i].scaleB,
+                                                       inputs[i].scaleC,
+                                                       inputs[i].scaleD,
+                                                       inputs[i].scaleE,
+                                                       scaleAlphaVec,
+                                                       isScaleAVec,
+                                                       isScaleBVec,
+                                                       bias_type,
+                                                       epilogue,
+                                                       amaxD,
+                                                       nullptr,
+                                                       0,
+                                                       0,
+                                                       handle->Synchronizer});
     }
 
-    bool strided_batch = true;
-    bool grouped_gemm  = true;
-
-    std::vector<RocblasltContractionProblem> problems;
-    for(int i = 0; i < m.size(); i++)
-    {
-        int iIdx = (rocEpilogue.size() <= i) ? rocEpilogue.size() - 1 : i;
-        if constexpr(std::is_same<Epilogue, rocblaslt::RocGemmEpilogue>::value)
-        {
-            problems.push_back(RocblasltContractionProblem{opA,
-                                                           opB,
-                                                           m[i],
-                                                           n[i],
-                                                           k[i],
-                                                           alpha_vec[i],
-                                                           type_a,
-                                                           A_vec[i],
-                                                           nullptr,
-                                                           lda[i],
-                                                           strideA[i],
-                                                           type_b,
-                                                           B_vec[i],
-                                                           nullptr,
-                                                           ldb[i],
-                                                           strideB[i],
-                                                           beta_vec[i],
-                                                           type_c,
-                                                           C_vec[i],
-                                                           nullptr,
-                                                           ldc[i],
-                                                           strideC[i],
-                                                           type_d,
-                                                           D_vec[i],
-                                                           nullptr,
-                                                           ldd[i],
-                                                           strideD[i],
-                                                           E_vec[i],
-                                                           nullptr,
-                                                           lde_vec[i],
-                                                           batch_stride_e_vec[i],
-                                                           b[i],
-                                                           strided_batch,
-                                                           grouped_gemm,
-                                                           gradient_vec[i],
-                                                           compute_type,
-                                                           bias_vec[i],
-                                                           scaleA_vec[i],
-                                                           scaleB_vec[i],
-                                                           scaleC_vec[i],
-                                                           scaleD_vec[i],
-                                                           scaleE_vec[i],
-                                                           scaleAlpha_vec[i],
-                                                           false,
-                                                           false,
-                                                           bias_type_vec[i],
-                                                           epilogue_vec[i],
-                                                           amaxD_vec[i],
-                                                           nullptr,
-                                                           0,
-                                                           0,
-                                                           handle->Synchronizer});
-        }
-        else
-        {
-            problems.push_back(
-                RocblasltContractionProblem{opA,
-                                            opB,
-                                            m[i],
-                                            n[i],
-                                            k[i],
-                                            alpha_vec[i],
-                                            type_a,
-                                            A_vec[i],
-                                            nullptr,
-                                            lda[i],
-                                            strideA[i],
-                                            type_b,
-                                            B_vec[i],
-                                            nullptr,
-                                            ldb[i],
-                                            strideB[i],
-                                            beta_vec[i],
-                                            type_c,
-                                            C_vec[i],
-                                            nullptr,
-                                            ldc[i],
-                                            strideC[i],
-                                            type_d,
-                                            D_vec[i],
-                                            nullptr,
-                                            ldd[i],
-                                            strideD[i],
-                                            E_vec[i],
-                                            nullptr,
-                                            lde_vec[i],
-                                            batch_stride_e_vec[i],
-                                            b[i],
-                                            strided_batch,
-                                            grouped_gemm,
-                                            gradient_vec[i],
-                                            compute_type,
-                                            bias_vec[i],
-                                            scaleA_vec[i],
-                                            scaleB_vec[i],
-                                            scaleC_vec[i],
-                                            scaleD_vec[i],
-                                            scaleE_vec[i],
-                                            scaleAlpha_vec[i],
-                                            static_cast<bool>(rocEpilogue[iIdx].scaling_a_type),
-                                            static_cast<bool>(rocEpilogue[iIdx].scaling_b_type),
-                                            bias_type_vec[i],
-                                            epilogue_vec[i],
-                                            amaxD_vec[i],
-                                            nullptr,
-                                            0,
-                                            0,
-                                            handle->Synchronizer});
-        }
-    }
     return groupedGemmCreate(problems, gemmData, gemmCount);
 }
 
@@ -1599,6 +3382,45 @@ rocblaslt_status rocblaslt_run_cpp(rocblaslt_handle       handle,
     return runKernelFromInvocation(handle, gemmType, gemmData, stream, start, stop);
 }
 
+rocblaslt_status rocblaslt_run_inputs_cpp(rocblaslt_handle                  handle,
+                                          rocblaslt::RocGemmType            gemmType,
+                                          std::shared_ptr<void>             gemmData,
+                                          const rocblaslt::RocGemmInputsV2& inputs,
+                                          hipStream_t                       stream)
+{
+    return runKernelFromNewInputs(handle, gemmType, gemmData, inputs, stream);
+}
+
+rocblaslt_status rocblaslt_run_batch_cpp(const std::vector<rocblaslt_handle>&       handles,
+                                         const std::vector<rocblaslt::RocGemmType>& gemmTypes,
+                                         const std::vector<void*>&                  gemmData,
+                                         hipStream_t                                stream)
+{
+    return runKernelsFromInvocations(handles, gemmTypes, gemmData, stream);
+}
+
+rocblaslt_status rocblaslt_graph_node_create_cpp(rocblaslt_handle       handle,
+                                                 rocblaslt::RocGemmType gemmType,
+                                                 std::shared_ptr<void>  gemmData,
+                                                 hipGraph_t             graph,
+                                                 const hipGraphNode_t*  dependencies,
+                                                 size_t                 numDependencies,
+                                                 hipGraphNode_t*        node)
+{
+    return addKernelGraphNode(
+        handle, gemmType, gemmData, graph, dependencies, numDependencies, node);
+}
+
+rocblaslt_status rocblaslt_graph_node_update_cpp(rocblaslt_handle                  handle,
+                                                 rocblaslt::RocGemmType            gemmType,
+                                                 std::shared_ptr<void>             gemmData,
+                                                 const rocblaslt::RocGemmInputsV2& inputs,
+                                                 hipGraphExec_t                    exec,
+                                                 hipGraphNode_t                    node)
+{
+    return updateKernelGraphNode(handle, gemmType, gemmData, inputs, exec, node);
+}
+
 rocblaslt_status rocblaslt_run_user_args_cpp(rocblaslt_handle       handle,
                                              rocblaslt::RocGemmType gemmType,
                                              std::shared_ptr<void>  gemmData,
@@ -1608,6 +3430,15 @@ rocblaslt_status rocblaslt_run_user_args_cpp(rocblaslt_handle       handle,
     return runKernelFromNewDeviceUserArguments(handle, gemmType, gemmData, deviceUserArgs, stream);
 }
 
+rocblaslt_status rocblaslt_run_host_user_args_cpp(rocblaslt_handle       handle,
+                                                  rocblaslt::RocGemmType gemmType,
+                                                  std::shared_ptr<void>  gemmData,
+                                                  const void*            hostDeviceUserArgs,
+                                                  hipStream_t            stream)
+{
+    return runKernelFromHostUserArguments(handle, gemmType, gemmData, hostDeviceUserArgs, stream);
+}
+
 rocblaslt_status rocblaslt_run_user_args_cpp(rocblaslt_handle             handle,
                                              rocblaslt::RocGemmType       gemmType,
                                              size_t                       gemmCount,
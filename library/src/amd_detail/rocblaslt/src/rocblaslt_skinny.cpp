@@ -0,0 +1,487 @@
+/* ************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblaslt_skinny.hpp"
+#include "rocblaslt_mat_utils.hpp"
+
+#include <algorithm>
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+namespace
+{
+    constexpr int64_t  SKINNY_MAX_SMALL        = 16;
+    constexpr uint32_t SKINNY_WAVES            = 4;
+    constexpr uint32_t SKINNY_MAX_WAVE_SIZE    = 64;
+    constexpr uint32_t SKINNY_REDUCE_WORKITEMS = 256;
+    constexpr int64_t  SKINNY_MAX_SPLITS       = 16;
+    constexpr int64_t  SKINNY_MIN_SPLIT_K      = 512;
+    constexpr int64_t  SKINNY_SPLIT_K_ALIGN    = 8;
+    constexpr int32_t  SKINNY_MAX_BATCH        = 65535;
+
+    // A GEMM as D(s, l) = sum_k W(k, l) X(s, k), with W the large operand, contiguous along
+    // k, and s < small <= 16
+    struct SkinnyProblem
+    {
+        int64_t small, large, k;
+        int32_t batchCount;
+
+        const void* W;
+        int64_t     ldw, batchStrideW;
+        const void* X;
+        int64_t     xs, xk, batchStrideX;
+        const void* C;
+        int64_t     cs, cl, batchStrideC;
+        void*       D;
+        int64_t     ds, dl, batchStrideD;
+        bool        streamD;
+    };
+
+    // m <= 16 runs with W = B, n <= 16 with W = A^T, see skinnyGemmSupported
+    SkinnyProblem skinnyProblemOf(const _rocblaslt_matmul_desc&   desc,
+                                  const _rocblaslt_matrix_layout& matA,
+                                  const _rocblaslt_matrix_layout& matB,
+                                  const _rocblaslt_matrix_layout& matC,
+                                  const _rocblaslt_matrix_layout& matD,
+                                  const void*                     A = nullptr,
+                                  const void*                     B = nullptr,
+                                  const void*                     C = nullptr,
+                                  void*                           D = nullptr)
+    {
+        const int64_t m      = matD.m;
+        const int64_t n      = matD.n;
+        const bool    transA = desc.op_A != HIPBLAS_OP_N;
+        const bool    transB = desc.op_B != HIPBLAS_OP_N;
+
+        SkinnyProblem p;
+        p.k          = transA ? matA.m : matA.n;
+        p.batchCount = matD.batch_count;
+        p.C          = C;
+        p.D          = D;
+        if(m <= SKINNY_MAX_SMALL && !transB)
+        {
+            p.small        = m;
+            p.large        = n;
+            p.W            = B;
+            p.ldw          = matB.ld;
+            p.batchStrideW = matB.batch_stride;
+            p.X            = A;
+            p.xs           = transA ? matA.ld : 1;
+            p.xk           = transA ? 1 : matA.ld;
+            p.batchStrideX = matA.batch_stride;
+            p.cs           = 1;
+            p.cl           = matC.ld;
+            p.ds           = 1;
+            p.dl           = matD.ld;
+        }
+        else
+        {
+            p.small        = n;
+            p.large        = m;
+            p.W            = A;
+            p.ldw          = matA.ld;
+            p.batchStrideW = matA.batch_stride;
+            p.X            = B;
+            p.xs           = transB ? 1 : matB.ld;
+            p.xk           = transB ? matB.ld : 1;
+            p.batchStrideX = matB.batch_stride;
+            p.cs           = matC.ld;
+            p.cl           = 1;
+            p.ds           = matD.ld;
+            p.dl           = 1;
+        }
+        p.batchStrideC = matC.batch_stride;
+        p.batchStrideD = matD.batch_stride;
+        p.streamD      = desc.cache_policy_d == rocblaslt_cache_policy_streaming;
+        return p;
+    }
+
+    size_t skinnyPartialsBytes(const SkinnyProblem& p, int64_t splits)
+    {
+        return sizeof(float) * p.small * p.large * p.batchCount * splits;
+    }
+
+    // The k of each split, so that the workgroups fill twice the CUs with splits of at least
+    // SKINNY_MIN_SPLIT_K and partials within maxWorkspaceBytes, or k when it is not split
+    int64_t skinnySplitK(const SkinnyProblem& p, int cus, size_t maxWorkspaceBytes)
+    {
+        const int64_t wgs    = (p.large + SKINNY_WAVES - 1) / SKINNY_WAVES * p.batchCount;
+        int64_t       splits = 1;
+        while(splits < SKINNY_MAX_SPLITS && wgs * splits < 2 * int64_t(cus)
+              && p.k >= 2 * splits * SKINNY_MIN_SPLIT_K
+              && skinnyPartialsBytes(p, 2 * splits) <= maxWorkspaceBytes)
+            splits *= 2;
+        if(splits == 1)
+            return p.k;
+        const int64_t kSplit = (p.k + splits - 1) / splits;
+        return (kSplit + SKINNY_SPLIT_K_ALIGN - 1) / SKINNY_SPLIT_K_ALIGN * SKINNY_SPLIT_K_ALIGN;
+    }
+
+    template <typename T, int V>
+    struct alignas(sizeof(T) * V) SkinnyPack
+    {
+        T v[V];
+    };
+
+    // Nontemporal stores of a streaming D leave the lines of other data in L2 and MALL
+    template <typename T>
+    __device__ inline void skinnyStore(T* p, T v, bool nontemporal)
+    {
+        using Bits = std::conditional_t<sizeof(T) == 2, uint16_t, uint32_t>;
+        if(nontemporal)
+        {
+            Bits bits;
+            __builtin_memcpy(&bits, &v, sizeof(T));
+            __builtin_nontemporal_store(bits, reinterpret_cast<Bits*>(p));
+        }
+        else
+            *p = v;
+    }
+
+    // One wave per column l of W, each lane reading V elements of it at a time. Without
+    // partials D = alpha * acc + beta * C, with them the acc of split blockIdx.y is stored
+    // at partials[batch][split][s][l].
+    template <typename Ti, typename To, int S, int V>
+    __global__ __launch_bounds__(SKINNY_WAVES * SKINNY_MAX_WAVE_SIZE) void skinnyGemm(
+        const Ti* W,
+        int64_t   ldw,
+        int64_t   batchStrideW,
+        const Ti* X,
+        int64_t   xs,
+        int64_t   xk,
+        int64_t   batchStrideX,
+        const To* C,
+        int64_t   cs,
+        int64_t   cl,
+        int64_t   batchStrideC,
+        To*       D,
+        int64_t   ds,
+        int64_t   dl,
+        int64_t   batchStrideD,
+        float*    partials,
+        int64_t   small,
+        int64_t   large,
+        int64_t   k,
+        int64_t   kSplit,
+        float     alpha,
+        float     beta,
+        bool      streamD)
+    {
+        const int64_t l    = int64_t(blockIdx.x) * SKINNY_WAVES + threadIdx.x / warpSize;
+        const int     lane = threadIdx.x % warpSize;
+        if(l >= large)
+            return;
+
+        const int64_t batch = blockIdx.z;
+        const int64_t k0    = int64_t(blockIdx.y) * kSplit;
+        const int64_t k1    = k0 + kSplit < k ? k0 + kSplit : k;
+        W += batch * batchStrideW + l * ldw;
+        X += batch * batchStrideX;
+
+        float acc[S]     = {};
+        auto  accumulate = [&](float w, int64_t i) {
+            for(int s = 0; s < S; s++)
+                if(s < small)
+                    acc[s] += w * float(X[s * xs + i * xk]);
+        };
+
+        const int64_t kVec = k0 + (k1 - k0) / V * V;
+        for(int64_t i = k0 + lane * V; i < kVec; i += int64_t(warpSize) * V)
+        {
+            const auto w = *reinterpret_cast<const SkinnyPack<Ti, V>*>(W + i);
+            for(int v = 0; v < V; v++)
+                accumulate(float(w.v[v]), i + v);
+        }
+        for(int64_t i = kVec + lane; i < k1; i += warpSize)
+            accumulate(float(W[i]), i);
+
+        for(int s = 0; s < S; s++)
+            for(int offset = warpSize / 2; offset > 0; offset /= 2)
+                acc[s] += __shfl_xor(acc[s], offset);
+
+        if(lane != 0)
+            return;
+        if(partials)
+        {
+            partials += ((batch * gridDim.y + blockIdx.y) * small) * large + l;
+            for(int s = 0; s < S; s++)
+                if(s < small)
+                    partials[s * large] = acc[s];
+        }
+        else
+        {
+            C += batch * batchStrideC + l * cl;
+            D += batch * batchStrideD + l * dl;
+            for(int s = 0; s < S; s++)
+                if(s < small)
+                    skinnyStore(D + s * ds,
+                                To(alpha * acc[s] + (beta == 0.f ? 0.f : beta * float(C[s * cs]))),
+                                streamD);
+        }
+    }
+
+    // D = alpha * the sum of the split-k partials + beta * C
+    template <typename To>
+    __global__ __launch_bounds__(SKINNY_REDUCE_WORKITEMS) void skinnyGemmReduce(
+        const float* partials,
+        int64_t      splits,
+        const To*    C,
+        int64_t      cs,
+        int64_t      cl,
+        int64_t      batchStrideC,
+        To*          D,
+        int64_t      ds,
+        int64_t      dl,
+        int64_t      batchStrideD,
+        int64_t      small,
+        int64_t      large,
+        float        alpha,
+        float        beta,
+        bool         streamD)
+    {
+        const int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(idx >= small * large)
+            return;
+
+        const int64_t batch = blockIdx.y;
+        const int64_t s     = idx / large;
+        const int64_t l     = idx % large;
+        partials += batch * splits * small * large + idx;
+
+        float sum = 0.f;
+        for(int64_t split = 0; split < splits; split++)
+            sum += partials[split * small * large];
+
+        const float c = beta == 0.f ? 0.f : beta * float(C[batch * batchStrideC + s * cs + l * cl]);
+        skinnyStore(D + batch * batchStrideD + s * ds + l * dl, To(alpha * sum + c), streamD);
+    }
+
+    template <typename Ti, typename To, int S, int V>
+    rocblaslt_status launchSkinny(const SkinnyProblem& p,
+                                  int64_t              kSplit,
+                                  float*               partials,
+                                  float                alpha,
+                                  float                beta,
+                                  int                  waveSize,
+                                  hipStream_t          stream)
+    {
+        const int64_t splits = (p.k + kSplit - 1) / kSplit;
+        hipLaunchKernelGGL((skinnyGemm<Ti, To, S, V>),
+                           dim3((p.large + SKINNY_WAVES - 1) / SKINNY_WAVES,
+                                uint32_t(std::max<int64_t>(splits, 1)),
+                                p.batchCount),
+                           dim3(SKINNY_WAVES * waveSize),
+                           0,
+                           stream,
+                           static_cast<const Ti*>(p.W),
+                           p.ldw,
+                           p.batchStrideW,
+                           static_cast<const Ti*>(p.X),
+                           p.xs,
+                           p.xk,
+                           p.batchStrideX,
+                           static_cast<const To*>(p.C),
+                           p.cs,
+                           p.cl,
+                           p.batchStrideC,
+                           static_cast<To*>(p.D),
+                           p.ds,
+                           p.dl,
+                           p.batchStrideD,
+                           splits > 1 ? partials : nullptr,
+                           p.small,
+                           p.large,
+                           p.k,
+                           kSplit,
+                           alpha,
+                           beta,
+                           p.streamD);
+        if(splits > 1)
+            hipLaunchKernelGGL(skinnyGemmReduce<To>,
+                               dim3((p.small * p.large + SKINNY_REDUCE_WORKITEMS - 1)
+                                        / SKINNY_REDUCE_WORKITEMS,
+                                    p.batchCount),
+                               dim3(SKINNY_REDUCE_WORKITEMS),
+                               0,
+                               stream,
+                               partials,
+                               splits,
+                               static_cast<const To*>(p.C),
+                               p.cs,
+                               p.cl,
+                               p.batchStrideC,
+                               static_cast<To*>(p.D),
+                               p.ds,
+                               p.dl,
+                               p.batchStrideD,
+                               p.small,
+                               p.large,
+                               alpha,
+                               beta,
+                               p.streamD);
+        return hipGetLastError() == hipSuccess ? rocblaslt_status_success
+                                               : rocblaslt_status_internal_error;
+    }
+
+    // Picks the accumulators from small and the 16-byte loads of W when its columns and
+    // splits are aligned to them
+    template <typename Ti, typename To>
+    rocblaslt_status launchSkinnyTyped(const SkinnyProblem& p,
+                                       int64_t              kSplit,
+                                       float*               partials,
+                                       float                alpha,
+                                       float                beta,
+                                       int                  waveSize,
+                                       hipStream_t          stream)
+    {
+        constexpr int V   = 16 / sizeof(Ti);
+        const bool    vec = reinterpret_cast<uintptr_t>(p.W) % 16 == 0 && p.ldw % V == 0
+                         && (p.batchCount == 1 || p.batchStrideW % V == 0)
+                         && (kSplit >= p.k || kSplit % V == 0);
+        auto withS = [&](auto s) {
+            constexpr int S = decltype(s)::value;
+            return vec ? launchSkinny<Ti, To, S, V>(
+                       p, kSplit, partials, alpha, beta, waveSize, stream)
+                       : launchSkinny<Ti, To, S, 1>(
+                           p, kSplit, partials, alpha, beta, waveSize, stream);
+        };
+        if(p.small <= 1)
+            return withS(std::integral_constant<int, 1>{});
+        else if(p.small <= 2)
+            return withS(std::integral_constant<int, 2>{});
+        else if(p.small <= 4)
+            return withS(std::integral_constant<int, 4>{});
+        else if(p.small <= 8)
+            return withS(std::integral_constant<int, 8>{});
+        return withS(std::integral_constant<int, 16>{});
+    }
+}
+
+bool skinnyGemmSupported(const _rocblaslt_matmul_desc&   desc,
+                         const _rocblaslt_matrix_layout& matA,
+                         const _rocblaslt_matrix_layout& matB,
+                         const _rocblaslt_matrix_layout& matC,
+                         const _rocblaslt_matrix_layout& matD)
+{
+    if(desc.epilogue != ROCBLASLT_EPILOGUE_DEFAULT
+       || desc.pointermode != rocblaslt_pointer_mode_host
+       || desc.compute_type != rocblaslt_compute_f32)
+        return false;
+    if(desc.bias || desc.scaleA || desc.scaleB || desc.scaleC || desc.scaleD || desc.scaleE
+       || desc.amaxD || desc.e || desc.cu_budget > 0 || desc.completion_flags
+       || desc.sparse_metadata_a || desc.aux_amax || desc.residual || desc.dropout > 0.f
+       || desc.amax_history || desc.d2 || desc.b_quant_scale || desc.isScaleABlock
+       || desc.isScaleBBlock)
+        return false;
+
+    for(auto* mat : {&matA, &matB, &matC, &matD})
+        if(mat->order != HIPBLASLT_ORDER_COL || is_pointer_array(*mat)
+           || mat->sparsity != HIPBLASLT_SPARSITY_DENSE || mat->batch_count != matD.batch_count)
+            return false;
+    if(matD.batch_count < 1 || matD.batch_count > SKINNY_MAX_BATCH)
+        return false;
+
+    if(matA.type != matB.type || matC.type != matD.type
+       || (matD.type != matA.type && matD.type != HIP_R_32F))
+        return false;
+    if(matA.type != HIP_R_32F && matA.type != HIP_R_16F && matA.type != HIP_R_16BF)
+        return false;
+
+    const int64_t m = matD.m;
+    const int64_t n = matD.n;
+    if(m < 1 || n < 1)
+        return false;
+    return (m <= SKINNY_MAX_SMALL && desc.op_B == HIPBLAS_OP_N)
+           || (n <= SKINNY_MAX_SMALL && desc.op_A == HIPBLAS_OP_T);
+}
+
+size_t skinnyGemmWorkspaceSize(rocblaslt_handle                handle,
+                               const _rocblaslt_matmul_desc&   desc,
+                               const _rocblaslt_matrix_layout& matA,
+                               const _rocblaslt_matrix_layout& matB,
+                               const _rocblaslt_matrix_layout& matD,
+                               size_t                          maxWorkspaceBytes)
+{
+    const auto    p = skinnyProblemOf(desc, matA, matB, matD, matD);
+    const int64_t kSplit
+        = skinnySplitK(p, handle->properties.multiProcessorCount, maxWorkspaceBytes);
+    const int64_t splits = p.k > 0 ? (p.k + kSplit - 1) / kSplit : 1;
+    return splits > 1 ? skinnyPartialsBytes(p, splits) : 0;
+}
+
+rocblaslt_status launchSkinnyGemm(rocblaslt_handle                handle,
+                                  const _rocblaslt_matmul_desc&   desc,
+                                  const void*                     A,
+                                  const void*                     B,
+                                  const void*                     C,
+                                  void*                           D,
+                                  const _rocblaslt_matrix_layout& matA,
+                                  const _rocblaslt_matrix_layout& matB,
+                                  const _rocblaslt_matrix_layout& matC,
+                                  const _rocblaslt_matrix_layout& matD,
+                                  float                           alpha,
+                                  float                           beta,
+                                  void*                           workspace,
+                                  size_t                          workspaceSizeInBytes,
+                                  hipStream_t                     stream)
+{
+    if(!skinnyGemmSupported(desc, matA, matB, matC, matD))
+        return rocblaslt_status_not_implemented;
+
+    auto p = skinnyProblemOf(desc, matA, matB, matC, matD, A, B, C, D);
+    // A and B may be null when alpha is 0, then D is beta * C
+    if(alpha == 0.f)
+        p.k = 0;
+    const int64_t kSplit
+        = p.k > 0 ? skinnySplitK(
+              p, handle->properties.multiProcessorCount, workspace ? workspaceSizeInBytes : 0)
+                  : 1;
+    float* partials = static_cast<float*>(workspace);
+
+    auto launch = [&](auto* ti, auto* to) {
+        using Ti = std::remove_pointer_t<decltype(ti)>;
+        using To = std::remove_pointer_t<decltype(to)>;
+        return launchSkinnyTyped<Ti, To>(
+            p, kSplit, partials, alpha, beta, handle->wavefront_size, stream);
+    };
+    const bool floatD = matD.type == HIP_R_32F;
+    switch(matA.type)
+    {
+    case HIP_R_32F:
+        return launch(static_cast<float*>(nullptr), static_cast<float*>(nullptr));
+    case HIP_R_16F:
+        return floatD ? launch(static_cast<_Float16*>(nullptr), static_cast<float*>(nullptr))
+                      : launch(static_cast<_Float16*>(nullptr), static_cast<_Float16*>(nullptr));
+    case HIP_R_16BF:
+        return floatD
+                   ? launch(static_cast<hip_bfloat16*>(nullptr), static_cast<float*>(nullptr))
+                   : launch(static_cast<hip_bfloat16*>(nullptr),
+                            static_cast<hip_bfloat16*>(nullptr));
+    default:
+        return rocblaslt_status_not_implemented;
+    }
+}
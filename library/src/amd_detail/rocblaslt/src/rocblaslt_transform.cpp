@@ -23,12 +23,14 @@
  * THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "JitTransform.hpp"
 #include "handle.h"
 #include "kernels/matrix_transform.h"
 #include "rocblaslt-auxiliary.h"
 #include "rocblaslt-types.h"
 #include "rocblaslt.h"
 #include <Tensile/hip/HipSolutionAdapter.hpp>
+#include <algorithm>
 #include <functional>
 #include <hipblaslt/hipblaslt-types.h>
 #include <libgen.h>
@@ -36,6 +38,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace
 {
@@ -97,6 +100,94 @@ namespace
         return &scalar;
     }
 
+    // Appends a scalar and its pointer. Host scalars are passed by value, device scalars by
+    // pointer.
+    template <typename ScaleType>
+    void appendScalarArg(TensileLite::KernelArguments& kArgs,
+                         const char*                   name,
+                         const char*                   ptrName,
+                         const ScaleType*              scalarPtr,
+                         bool                          scalarInDevice)
+    {
+        if(scalarInDevice)
+        {
+            kArgs.appendAligned(name, ScaleType(1));
+            kArgs.appendAligned(ptrName, scalarPtr);
+        }
+        else
+        {
+            if(!scalarPtr)
+            {
+                scalarPtr = dummyScalarPtr<ScaleType>();
+            }
+
+            const ScaleType* nullScalePtr = nullptr;
+
+            kArgs.appendAligned(name, *scalarPtr);
+            kArgs.appendAligned(ptrName, nullScalePtr);
+        }
+    }
+
+    // Appends alpha, alphaPtr, beta and betaPtr
+    template <typename ScaleType>
+    void appendScalarArgs(TensileLite::KernelArguments& kArgs,
+                          const ScaleType*              alphaPtr,
+                          const ScaleType*              betaPtr,
+                          bool                          scalarInDevice)
+    {
+        appendScalarArg(kArgs, "alpha", "alphaPtr", alphaPtr, scalarInDevice);
+        appendScalarArg(kArgs, "beta", "betaPtr", betaPtr, scalarInDevice);
+    }
+
+    template <typename DType, typename ScaleType>
+    hipError_t launchTransformTiles(DType*             c,
+                                    const DType*       a,
+                                    const DType*       b,
+                                    const ScaleType*   alphaPtr,
+                                    const ScaleType*   betaPtr,
+                                    bool               scalarInDevice,
+                                    uint32_t           m,
+                                    uint32_t           n,
+                                    uint32_t           ldA,
+                                    uint32_t           ldB,
+                                    uint32_t           ldC,
+                                    uint32_t           batchSize,
+                                    uint32_t           batchStride,
+                                    bool               transA,
+                                    bool               transB,
+                                    hipStream_t        stream,
+                                    const std::string& kernelName,
+                                    uint32_t           tileM,
+                                    uint32_t           tileN,
+                                    uint32_t           numWorkitems)
+    {
+        const auto numWg = (m / tileM + !!(m % tileM)) * (n / tileN + !!(n % tileN));
+        TensileLite::KernelArguments kArgs(false);
+        kArgs.appendAligned("c", c);
+        kArgs.appendAligned("a", a);
+        kArgs.appendAligned("b", b);
+        appendScalarArgs(kArgs, alphaPtr, betaPtr, scalarInDevice);
+        kArgs.appendAligned("m", m);
+        kArgs.appendAligned("n", n);
+        kArgs.appendAligned("ldA", ldA);
+        kArgs.appendAligned("ldB", ldB);
+        kArgs.appendAligned("ldC", ldC);
+        kArgs.appendAligned("batchStride", batchStride);
+        kArgs.appendAligned("transA", transA);
+        kArgs.appendAligned("transB", transB);
+
+        TensileLite::KernelInvocation invocation{kernelName,
+                                             "hipblasltTransform.hsaco",
+                                             false,
+                                             {numWorkitems, 1, 1},
+                                             {numWg, 1, batchSize},
+                                             {numWg * numWorkitems, 1, batchSize},
+                                             0,
+                                             kArgs};
+        auto&                     adapter = transformAdapter();
+        return adapter.launchKernel(invocation, stream, nullptr, nullptr);
+    }
+
     template <typename DType,
               typename ScaleType,
               bool     RowMajA,
@@ -123,72 +214,77 @@ namespace
                                      hipStream_t        stream,
                                      const std::string& kernelName)
     {
-        constexpr auto           TileM = RowMajC ? NumThreadsM : NumThreadsM * VectorWidth;
-        constexpr auto           TileN = RowMajC ? NumThreadsN * VectorWidth : NumThreadsN;
-        const auto               numWg = (m / TileM + !!(m % TileM)) * (n / TileN + !!(n % TileN));
-        constexpr auto           numWorkitems = NumThreadsM * NumThreadsN;
-        TensileLite::KernelArguments kArgs(false);
-
-        if(scalarInDevice)
-        {
-            kArgs.appendAligned("c", c);
-            kArgs.appendAligned("a", a);
-            kArgs.appendAligned("b", b);
-            kArgs.appendAligned("alpha", ScaleType(1));
-            kArgs.appendAligned("alphaPtr", alphaPtr);
-            kArgs.appendAligned("beta", ScaleType(1));
-            kArgs.appendAligned("betaPtr", betaPtr);
-            kArgs.appendAligned("m", m);
-            kArgs.appendAligned("n", n);
-            kArgs.appendAligned("ldA", ldA);
-            kArgs.appendAligned("ldB", ldB);
-            kArgs.appendAligned("ldC", ldC);
-            kArgs.appendAligned("batchStride", batchStride);
-            kArgs.appendAligned("transA", transA);
-            kArgs.appendAligned("transB", transB);
-        }
-        else
-        {
-            if(!alphaPtr)
-            {
-                alphaPtr = dummyScalarPtr<ScaleType>();
-            }
+        constexpr auto TileM = RowMajC ? NumThreadsM : NumThreadsM * VectorWidth;
+        constexpr auto TileN = RowMajC ? NumThreadsN * VectorWidth : NumThreadsN;
+        return launchTransformTiles(c,
+                                    a,
+                                    b,
+                                    alphaPtr,
+                                    betaPtr,
+                                    scalarInDevice,
+                                    m,
+                                    n,
+                                    ldA,
+                                    ldB,
+                                    ldC,
+                                    batchSize,
+                                    batchStride,
+                                    transA,
+                                    transB,
+                                    stream,
+                                    kernelName,
+                                    TileM,
+                                    TileN,
+                                    NumThreadsM * NumThreadsN);
+    }
 
-            if(!betaPtr)
-            {
-                betaPtr = dummyScalarPtr<ScaleType>();
-            }
+    constexpr uint32_t LDS_TRANSFORM_NUM_WORKITEMS = 256;
 
-            const ScaleType *nullScalePtr = nullptr;
-
-            kArgs.appendAligned("c", c);
-            kArgs.appendAligned("a", a);
-            kArgs.appendAligned("b", b);
-            kArgs.appendAligned("alpha", *alphaPtr);
-            kArgs.appendAligned("alphaPtr", nullScalePtr);
-            kArgs.appendAligned("beta", *betaPtr);
-            kArgs.appendAligned("betaPtr", nullScalePtr);
-            kArgs.appendAligned("m", m);
-            kArgs.appendAligned("n", n);
-            kArgs.appendAligned("ldA", ldA);
-            kArgs.appendAligned("ldB", ldB);
-            kArgs.appendAligned("ldC", ldC);
-            kArgs.appendAligned("batchStride", batchStride);
-            kArgs.appendAligned("transA", transA);
-            kArgs.appendAligned("transB", transB);
-        }
-
-        constexpr auto            NUM_WORKITEMS{NumThreadsM * NumThreadsN};
-        TensileLite::KernelInvocation invocation{kernelName,
-                                             "hipblasltTransform.hsaco",
-                                             false,
-                                             {NUM_WORKITEMS, 1, 1},
-                                             {numWg, 1, batchSize},
-                                             {numWg * NUM_WORKITEMS, 1, batchSize},
-                                             0,
-                                             kArgs};
-        auto&                     adapter = transformAdapter();
-        return adapter.launchKernel(invocation, stream, nullptr, nullptr);
+    template <typename DType,
+              typename ScaleType,
+              bool     RowMajA,
+              bool     RowMajB,
+              bool     RowMajC,
+              uint32_t TileM,
+              uint32_t TileN>
+    hipError_t launchLdsTransformKernel(void*              c,
+                                        const void*        a,
+                                        const void*        b,
+                                        const void*        alpha,
+                                        const void*        beta,
+                                        bool               scalarInDevice,
+                                        uint32_t           m,
+                                        uint32_t           n,
+                                        uint32_t           ldA,
+                                        uint32_t           ldB,
+                                        uint32_t           ldC,
+                                        uint32_t           batchSize,
+                                        uint32_t           batchStride,
+                                        bool               transA,
+                                        bool               transB,
+                                        hipStream_t        stream,
+                                        const std::string& kernelName)
+    {
+        return launchTransformTiles(static_cast<DType*>(c),
+                                    static_cast<const DType*>(a),
+                                    static_cast<const DType*>(b),
+                                    reinterpret_cast<const ScaleType*>(alpha),
+                                    reinterpret_cast<const ScaleType*>(beta),
+                                    scalarInDevice,
+                                    m,
+                                    n,
+                                    ldA,
+                                    ldB,
+                                    ldC,
+                                    batchSize,
+                                    batchStride,
+                                    transA,
+                                    transB,
+                                    stream,
+                                    kernelName,
+                                    TileM,
+                                    TileN,
+                                    LDS_TRANSFORM_NUM_WORKITEMS);
     }
 
 // Generate combination of MEMORY ORDER and RowMaj{A/B/C} = true/false
@@ -730,6 +826,1078 @@ namespace
          GEN_COMBINATION(HIP_R_16BF, HIP_R_32F, hipblasLtBfloat16, hipblasLtFloat, 16, 16, 1),
          GEN_COMBINATION(HIP_R_8I, HIP_R_32F, hipblasLtInt8, hipblasLtFloat, 16, 16, 1),
          GEN_COMBINATION(HIP_R_32I, HIP_R_32F, hipblasLtInt32, hipblasLtFloat, 16, 16, 1)}};
+
+#define GEN_LDS_ORDER(                                                                      \
+    _DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, _A, _B, _C, _TileM, _TileN) \
+    {std::make_tuple(_DTYPE,                                                                \
+                     _SCALETYPE,                                                            \
+                     _A ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL,                        \
+                     _B ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL,                        \
+                     _C ? HIPBLASLT_ORDER_ROW : HIPBLASLT_ORDER_COL,                        \
+                     _TileM,                                                                \
+                     _TileN),                                                               \
+     std::make_pair(                                                                        \
+         std::string(                                                                       \
+             TO_STRING(TRANSFORM_LDS_FUNC_NAME(_DTypeStr, _STypeStr, _A, _B, _C, _TileM, _TileN))), \
+         MatrixTransformFunction(                                                           \
+             launchLdsTransformKernel<_DType, _ScaleType, _A, _B, _C, _TileM, _TileN>))}
+
+// Generate combination of RowMaj{A/B/C} = true/false for an LDS tile shape
+#define GEN_LDS_COMBINATION(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, _TileM, _TileN) \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 1, 1, 1, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 1, 1, 0, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 1, 0, 1, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 1, 0, 0, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 0, 1, 1, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 0, 1, 0, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 0, 0, 1, _TileM, _TileN), \
+    GEN_LDS_ORDER(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _DType, _ScaleType, 0, 0, 0, _TileM, _TileN)
+
+    using MatrixTransformLdsKernelKey = std::tuple<hipDataType,
+                                                   hipDataType,
+                                                   hipblasLtOrder_t,
+                                                   hipblasLtOrder_t,
+                                                   hipblasLtOrder_t,
+                                                   uint32_t,
+                                                   uint32_t>;
+
+    // clang-format off
+    std::map<MatrixTransformLdsKernelKey, std::pair<MatrixTransformFunctionName, MatrixTransformFunction>> ldsTransformKernels{
+        {GEN_LDS_COMBINATION(HIP_R_32F, HIP_R_32F, S, S, hipblasLtFloat, hipblasLtFloat, 64, 64),
+         GEN_LDS_COMBINATION(HIP_R_32F, HIP_R_32F, S, S, hipblasLtFloat, hipblasLtFloat, 128, 32),
+         GEN_LDS_COMBINATION(HIP_R_16F, HIP_R_16F, H, H, hipblasLtHalf, hipblasLtHalf, 64, 64),
+         GEN_LDS_COMBINATION(HIP_R_16F, HIP_R_16F, H, H, hipblasLtHalf, hipblasLtHalf, 128, 32),
+         GEN_LDS_COMBINATION(HIP_R_16F, HIP_R_32F, H, S, hipblasLtHalf, hipblasLtFloat, 64, 64),
+         GEN_LDS_COMBINATION(HIP_R_16F, HIP_R_32F, H, S, hipblasLtHalf, hipblasLtFloat, 128, 32),
+         GEN_LDS_COMBINATION(HIP_R_16BF, HIP_R_32F, BF16, S, hipblasLtBfloat16, hipblasLtFloat, 64, 64),
+         GEN_LDS_COMBINATION(HIP_R_16BF, HIP_R_32F, BF16, S, hipblasLtBfloat16, hipblasLtFloat, 128, 32),
+         GEN_LDS_COMBINATION(HIP_R_8I, HIP_R_32F, I8, S, hipblasLtInt8, hipblasLtFloat, 64, 64),
+         GEN_LDS_COMBINATION(HIP_R_8I, HIP_R_32F, I8, S, hipblasLtInt8, hipblasLtFloat, 128, 32),
+         GEN_LDS_COMBINATION(HIP_R_32I, HIP_R_32F, I32, S, hipblasLtInt32, hipblasLtFloat, 64, 64),
+         GEN_LDS_COMBINATION(HIP_R_32I, HIP_R_32F, I32, S, hipblasLtInt32, hipblasLtFloat, 128, 32)}};
+    // clang-format on
+
+    size_t transformElemNumBytes(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+        case HIP_R_32I:
+            return 4;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_8I:
+        case HIP_R_8F_E4M3_FNUZ:
+        case HIP_R_8F_E5M2_FNUZ:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    bool isVector128Aligned(const void* ptr, size_t ld, size_t elemNumBytes)
+    {
+        constexpr size_t alignment = 16;
+        return !ptr
+               || (reinterpret_cast<uintptr_t>(ptr) % alignment == 0
+                   && (ld * elemNumBytes) % alignment == 0);
+    }
+
+    // Tile and input/output vector widths, in elements, of an LDS-staged transform. tileM is 0
+    // when the matrix is too small for the staged kernels.
+    struct TransformVariant
+    {
+        uint32_t tileM{};
+        uint32_t tileN{};
+        uint32_t inVectorWidth{1};
+        uint32_t outVectorWidth{1};
+    };
+
+    // Widest vector of 16, 8 or 4 bytes, at most maxWidth elements, that every line of every
+    // batch of the matrix at ptr starts aligned to. 1 when none is. A missing matrix does not
+    // constrain the width and gets the 16-byte one.
+    uint32_t maxVectorWidth(const void* ptr,
+                            size_t      ld,
+                            size_t      batchStride,
+                            uint32_t    batchSize,
+                            size_t      elemNumBytes,
+                            uint32_t    maxWidth)
+    {
+        if(!ptr)
+        {
+            return static_cast<uint32_t>(std::max<size_t>(16 / elemNumBytes, 1));
+        }
+
+        for(size_t numBytes = 16; numBytes >= 4; numBytes /= 2)
+        {
+            const auto width = numBytes / elemNumBytes;
+
+            if(width <= 1 || width > maxWidth)
+            {
+                continue;
+            }
+
+            if(reinterpret_cast<uintptr_t>(ptr) % numBytes == 0 && (ld * elemNumBytes) % numBytes == 0
+               && (batchSize <= 1 || (batchStride * elemNumBytes) % numBytes == 0))
+            {
+                return static_cast<uint32_t>(width);
+            }
+        }
+
+        return 1;
+    }
+
+    // Picks the tile from the aspect ratio of C: 64x64 for large matrices, 128x32 or 32x128 when
+    // one side is short and 256x4 or 4x256 for skinny ones down to a single row or column.
+    // Each operand then gets the widest vector its alignment allows, capped by the tile extent
+    // along its contiguous dimension; A and B share the input width. Matrices with both sides
+    // under 32 stay on the 16x16 kernels, which launch more workgroups for them.
+    TransformVariant selectTransformVariant(hipDataType type,
+                                            const void* a,
+                                            const void* b,
+                                            const void* c,
+                                            uint32_t    m,
+                                            uint32_t    n,
+                                            uint32_t    ldA,
+                                            uint32_t    ldB,
+                                            uint32_t    ldC,
+                                            uint32_t    batchSize,
+                                            uint32_t    batchStride,
+                                            bool        alongColsA,
+                                            bool        alongColsB,
+                                            bool        alongColsC)
+    {
+        const auto       elemNumBytes = transformElemNumBytes(type);
+        TransformVariant variant;
+
+        if(!elemNumBytes || (m < 32 && n < 32))
+        {
+            return variant;
+        }
+
+        if(m <= 4)
+        {
+            variant.tileM = 4;
+            variant.tileN = 256;
+        }
+        else if(n <= 4)
+        {
+            variant.tileM = 256;
+            variant.tileN = 4;
+        }
+        else if(m < 64 || n < 64)
+        {
+            variant.tileM = m < n ? 32 : 128;
+            variant.tileN = m < n ? 128 : 32;
+        }
+        else
+        {
+            variant.tileM = 64;
+            variant.tileN = 64;
+        }
+
+        const auto extent = [&](bool alongCols) { return alongCols ? variant.tileN : variant.tileM; };
+        variant.inVectorWidth
+            = std::min(maxVectorWidth(a, ldA, batchStride, batchSize, elemNumBytes, extent(alongColsA)),
+                       maxVectorWidth(b, ldB, batchStride, batchSize, elemNumBytes, extent(alongColsB)));
+        variant.outVectorWidth
+            = maxVectorWidth(c, ldC, batchStride, batchSize, elemNumBytes, extent(alongColsC));
+        return variant;
+    }
+
+    // clang-format off
+#define GEN_VARIANT_NAME(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, _TileM, _TileN) \
+    {std::make_tuple(_DTYPE, _SCALETYPE, _TileM, _TileN), TO_STRING(TRANSFORM_VARIANT_FUNC_NAME(_DTypeStr, _STypeStr, _TileM, _TileN))}
+#define GEN_VARIANT_TILES(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr)           \
+    GEN_VARIANT_NAME(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, 64u, 64u),   \
+    GEN_VARIANT_NAME(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, 128u, 32u),  \
+    GEN_VARIANT_NAME(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, 32u, 128u),  \
+    GEN_VARIANT_NAME(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, 256u, 4u),   \
+    GEN_VARIANT_NAME(_DTYPE, _SCALETYPE, _DTypeStr, _STypeStr, 4u, 256u)
+
+    // (type, scale type, tile m, tile n)
+    std::map<std::tuple<hipDataType, hipDataType, uint32_t, uint32_t>, MatrixTransformFunctionName> variantTransformKernelNames{
+        GEN_VARIANT_TILES(HIP_R_32F, HIP_R_32F, S, S),
+        GEN_VARIANT_TILES(HIP_R_16F, HIP_R_16F, H, H),
+        GEN_VARIANT_TILES(HIP_R_16F, HIP_R_32F, H, S),
+        GEN_VARIANT_TILES(HIP_R_16BF, HIP_R_32F, BF16, S),
+        GEN_VARIANT_TILES(HIP_R_8I, HIP_R_32F, I8, S),
+        GEN_VARIANT_TILES(HIP_R_32I, HIP_R_32F, I32, S)};
+    // clang-format on
+
+    template <typename ScaleType>
+    rocblaslt_status launchVariantTransform(rocblaslt_matrix_transform_desc* desc,
+                                            const std::string&               kernelName,
+                                            const TransformVariant&          variant,
+                                            const void*                      alpha,
+                                            const void*                      a,
+                                            rocblaslt_matrix_layout          layoutA,
+                                            const void*                      beta,
+                                            const void*                      b,
+                                            rocblaslt_matrix_layout          layoutB,
+                                            void*                            c,
+                                            rocblaslt_matrix_layout          layoutC,
+                                            hipStream_t                      stream)
+    {
+        const auto m         = static_cast<uint32_t>(layoutC->m);
+        const auto n         = static_cast<uint32_t>(layoutC->n);
+        const auto batchSize = static_cast<uint32_t>(layoutA->batch_count);
+        const auto numWg     = (m / variant.tileM + !!(m % variant.tileM))
+                           * (n / variant.tileN + !!(n % variant.tileN));
+
+        TensileLite::KernelArguments kArgs(false);
+        kArgs.appendAligned("c", c);
+        kArgs.appendAligned("a", a);
+        kArgs.appendAligned("b", b);
+        appendScalarArgs(kArgs,
+                         static_cast<const ScaleType*>(alpha),
+                         static_cast<const ScaleType*>(beta),
+                         desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE);
+        kArgs.appendAligned("m", m);
+        kArgs.appendAligned("n", n);
+        kArgs.appendAligned("ldA", static_cast<uint32_t>(layoutA->ld));
+        kArgs.appendAligned("ldB", static_cast<uint32_t>(layoutB->ld));
+        kArgs.appendAligned("ldC", static_cast<uint32_t>(layoutC->ld));
+        kArgs.appendAligned("batchStride", static_cast<uint32_t>(layoutA->batch_stride));
+        kArgs.appendAligned("rowMajA", layoutA->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("rowMajB", layoutB->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("rowMajC", layoutC->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("transA", desc->opA == HIPBLAS_OP_T);
+        kArgs.appendAligned("transB", desc->opB == HIPBLAS_OP_T);
+        kArgs.appendAligned("inVectorWidth", variant.inVectorWidth);
+        kArgs.appendAligned("outVectorWidth", variant.outVectorWidth);
+
+        TensileLite::KernelInvocation invocation{kernelName,
+                                             "hipblasltTransform.hsaco",
+                                             false,
+                                             {LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                             {numWg, 1, batchSize},
+                                             {numWg * LDS_TRANSFORM_NUM_WORKITEMS, 1, batchSize},
+                                             0,
+                                             kArgs};
+        auto&                     adapter = transformAdapter();
+        const auto err = adapter.launchKernel(invocation, stream, nullptr, nullptr);
+        return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
+    }
+
+    constexpr uint32_t CVT_TRANSFORM_TILE_SIZE = 64;
+
+    // clang-format off
+#define GEN_CVT_NAME(_INTYPE, _OUTTYPE, _InTypeStr, _OutTypeStr)                                                     \
+    {std::make_tuple(_INTYPE, _OUTTYPE, false), TO_STRING(TRANSFORM_CVT_FUNC_NAME(_InTypeStr, _OutTypeStr, 0))}, \
+    {std::make_tuple(_INTYPE, _OUTTYPE, true), TO_STRING(TRANSFORM_CVT_FUNC_NAME(_InTypeStr, _OutTypeStr, 1))}
+#define GEN_CVT_OUTPUTS(_INTYPE, _InTypeStr)                           \
+    GEN_CVT_NAME(_INTYPE, HIP_R_32F, _InTypeStr, S),                   \
+    GEN_CVT_NAME(_INTYPE, HIP_R_16F, _InTypeStr, H),                   \
+    GEN_CVT_NAME(_INTYPE, HIP_R_16BF, _InTypeStr, BF16),               \
+    GEN_CVT_NAME(_INTYPE, HIP_R_8F_E4M3_FNUZ, _InTypeStr, F8),         \
+    GEN_CVT_NAME(_INTYPE, HIP_R_8F_E5M2_FNUZ, _InTypeStr, BF8)
+
+    // (input type, output type, vectorized)
+    std::map<std::tuple<hipDataType, hipDataType, bool>, MatrixTransformFunctionName> cvtTransformKernelNames{
+        GEN_CVT_OUTPUTS(HIP_R_32F, S),
+        GEN_CVT_OUTPUTS(HIP_R_16F, H),
+        GEN_CVT_OUTPUTS(HIP_R_16BF, BF16)};
+    // clang-format on
+
+    // C = cast(scaleC * (alpha * A + beta * B)) with the type converting kernels, which take
+    // float alpha and beta and the orders as arguments.
+    rocblaslt_status launchConvertTransform(rocblaslt_matrix_transform_desc* desc,
+                                            const void*                      alpha,
+                                            const void*                      a,
+                                            rocblaslt_matrix_layout          layoutA,
+                                            const void*                      beta,
+                                            const void*                      b,
+                                            rocblaslt_matrix_layout          layoutB,
+                                            void*                            c,
+                                            rocblaslt_matrix_layout          layoutC,
+                                            hipStream_t                      stream)
+    {
+        const auto inType      = a ? layoutA->type : layoutB->type;
+        const auto inNumBytes  = transformElemNumBytes(inType);
+        const auto outNumBytes = transformElemNumBytes(layoutC->type);
+        const auto m           = static_cast<uint32_t>(layoutC->m);
+        const auto n           = static_cast<uint32_t>(layoutC->n);
+        const auto batchSize   = static_cast<uint32_t>(layoutA->batch_count);
+        const auto batchStride = static_cast<uint32_t>(layoutA->batch_stride);
+        const bool vectorized
+            = inNumBytes && outNumBytes && isVector128Aligned(a, layoutA->ld, inNumBytes)
+              && isVector128Aligned(b, layoutB->ld, inNumBytes)
+              && isVector128Aligned(c, layoutC->ld, outNumBytes)
+              && (batchSize <= 1
+                  || ((size_t(batchStride) * inNumBytes) % 16 == 0
+                      && (size_t(batchStride) * outNumBytes) % 16 == 0));
+        const auto key = std::make_tuple(inType, layoutC->type, vectorized);
+
+        if(desc->scaleType != HIP_R_32F || (a && b && layoutA->type != layoutB->type)
+           || !cvtTransformKernelNames.count(key))
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        const bool scalarInDevice = desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE;
+        const auto numWg          = (m / CVT_TRANSFORM_TILE_SIZE + !!(m % CVT_TRANSFORM_TILE_SIZE))
+                           * (n / CVT_TRANSFORM_TILE_SIZE + !!(n % CVT_TRANSFORM_TILE_SIZE));
+        const auto scaleCPtr = static_cast<const float*>(desc->scaleCPointer);
+        TensileLite::KernelArguments kArgs(false);
+        kArgs.appendAligned("c", c);
+        kArgs.appendAligned("a", a);
+        kArgs.appendAligned("b", b);
+        appendScalarArgs(kArgs,
+                         static_cast<const float*>(alpha),
+                         static_cast<const float*>(beta),
+                         scalarInDevice);
+        kArgs.appendAligned("scaleCPtr", scaleCPtr);
+        kArgs.appendAligned("m", m);
+        kArgs.appendAligned("n", n);
+        kArgs.appendAligned("ldA", static_cast<uint32_t>(layoutA->ld));
+        kArgs.appendAligned("ldB", static_cast<uint32_t>(layoutB->ld));
+        kArgs.appendAligned("ldC", static_cast<uint32_t>(layoutC->ld));
+        kArgs.appendAligned("batchStride", batchStride);
+        kArgs.appendAligned("rowMajA", layoutA->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("rowMajB", layoutB->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("rowMajC", layoutC->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("transA", desc->opA == HIPBLAS_OP_T);
+        kArgs.appendAligned("transB", desc->opB == HIPBLAS_OP_T);
+        kArgs.appendAligned("saturate", desc->saturate != 0);
+        kArgs.appendAligned("stochasticRounding", desc->stochasticRounding != 0);
+        kArgs.appendAligned("seed", desc->roundingSeed);
+
+        TensileLite::KernelInvocation invocation{cvtTransformKernelNames.at(key),
+                                             "hipblasltTransform.hsaco",
+                                             false,
+                                             {LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                             {numWg, 1, batchSize},
+                                             {numWg * LDS_TRANSFORM_NUM_WORKITEMS, 1, batchSize},
+                                             0,
+                                             kArgs};
+        auto&                     adapter = transformAdapter();
+        const auto err = adapter.launchKernel(invocation, stream, nullptr, nullptr);
+        return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
+    }
+
+    constexpr uint32_t BATCHED_TRANSFORM_TILE_SIZE = 32;
+    constexpr uint32_t BATCHED_TRANSFORM_WG_PER_CU = 8;
+
+    // (type, scale type)
+    std::map<std::pair<hipDataType, hipDataType>, MatrixTransformFunctionName>
+        batchedTransformKernelNames{
+            {{HIP_R_32F, HIP_R_32F}, TO_STRING(TRANSFORM_BATCHED_FUNC_NAME(S, S))},
+            {{HIP_R_16F, HIP_R_16F}, TO_STRING(TRANSFORM_BATCHED_FUNC_NAME(H, H))},
+            {{HIP_R_16F, HIP_R_32F}, TO_STRING(TRANSFORM_BATCHED_FUNC_NAME(H, S))},
+            {{HIP_R_16BF, HIP_R_32F}, TO_STRING(TRANSFORM_BATCHED_FUNC_NAME(BF16, S))},
+            {{HIP_R_8I, HIP_R_32F}, TO_STRING(TRANSFORM_BATCHED_FUNC_NAME(I8, S))},
+            {{HIP_R_32I, HIP_R_32F}, TO_STRING(TRANSFORM_BATCHED_FUNC_NAME(I32, S))}};
+
+    uint32_t numBatchedTransformTiles(uint32_t m, uint32_t n)
+    {
+        return (m / BATCHED_TRANSFORM_TILE_SIZE + !!(m % BATCHED_TRANSFORM_TILE_SIZE))
+               * (n / BATCHED_TRANSFORM_TILE_SIZE + !!(n % BATCHED_TRANSFORM_TILE_SIZE));
+    }
+
+    // A batch of matrices that each need fewer workgroups than there are CUs leaves most of
+    // the device idle with one workgroup per tile, and pointer arrays cannot be expressed as a
+    // strided launch at all. Both go to the persistent kernel.
+    bool useBatchedTransform(rocblaslt_handle                 handle,
+                             rocblaslt_matrix_transform_desc* desc,
+                             rocblaslt_matrix_layout          layoutA,
+                             rocblaslt_matrix_layout          layoutC)
+    {
+        if(desc->batchPointerArray)
+        {
+            return true;
+        }
+
+        return layoutA->batch_count > 1
+               && numBatchedTransformTiles(layoutC->m, layoutC->n)
+                      < uint32_t(handle->properties.multiProcessorCount);
+    }
+
+    template <typename ScaleType>
+    rocblaslt_status launchBatchedTransform(rocblaslt_handle                 handle,
+                                            rocblaslt_matrix_transform_desc* desc,
+                                            const std::string&               kernelName,
+                                            const void*                      alpha,
+                                            const void*                      a,
+                                            rocblaslt_matrix_layout          layoutA,
+                                            const void*                      beta,
+                                            const void*                      b,
+                                            rocblaslt_matrix_layout          layoutB,
+                                            void*                            c,
+                                            rocblaslt_matrix_layout          layoutC,
+                                            hipStream_t                      stream)
+    {
+        const auto m         = static_cast<uint32_t>(layoutC->m);
+        const auto n         = static_cast<uint32_t>(layoutC->n);
+        const auto batchSize = static_cast<uint32_t>(layoutA->batch_count);
+        const auto numWork   = size_t(numBatchedTransformTiles(m, n)) * batchSize;
+        const auto maxNumWg  = size_t(std::max(handle->properties.multiProcessorCount, 1))
+                              * BATCHED_TRANSFORM_WG_PER_CU;
+        const auto numWg     = static_cast<uint32_t>(std::min(numWork, maxNumWg));
+
+        if(!numWg)
+        {
+            return rocblaslt_status_success;
+        }
+
+        TensileLite::KernelArguments kArgs(false);
+        kArgs.appendAligned("c", c);
+        kArgs.appendAligned("a", a);
+        kArgs.appendAligned("b", b);
+        appendScalarArgs(kArgs,
+                         static_cast<const ScaleType*>(alpha),
+                         static_cast<const ScaleType*>(beta),
+                         desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE);
+        kArgs.appendAligned("m", m);
+        kArgs.appendAligned("n", n);
+        kArgs.appendAligned("ldA", static_cast<uint32_t>(layoutA->ld));
+        kArgs.appendAligned("ldB", static_cast<uint32_t>(layoutB->ld));
+        kArgs.appendAligned("ldC", static_cast<uint32_t>(layoutC->ld));
+        kArgs.appendAligned("batchStride", static_cast<uint32_t>(layoutA->batch_stride));
+        kArgs.appendAligned("batchCount", batchSize);
+        kArgs.appendAligned("rowMajA", layoutA->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("rowMajB", layoutB->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("rowMajC", layoutC->order == HIPBLASLT_ORDER_ROW);
+        kArgs.appendAligned("transA", desc->opA == HIPBLAS_OP_T);
+        kArgs.appendAligned("transB", desc->opB == HIPBLAS_OP_T);
+        kArgs.appendAligned("pointerArray", desc->batchPointerArray != 0);
+
+        TensileLite::KernelInvocation invocation{kernelName,
+                                             "hipblasltTransform.hsaco",
+                                             false,
+                                             {LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                             {numWg, 1, 1},
+                                             {numWg * LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                             0,
+                                             kArgs};
+        auto&                     adapter = transformAdapter();
+        const auto err = adapter.launchKernel(invocation, stream, nullptr, nullptr);
+        return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
+    }
+
+    // (type, scale type)
+    std::map<std::pair<hipDataType, hipDataType>, MatrixTransformFunctionName>
+        groupedTransformKernelNames{
+            {{HIP_R_32F, HIP_R_32F}, TO_STRING(TRANSFORM_GROUPED_FUNC_NAME(S, S))},
+            {{HIP_R_16F, HIP_R_16F}, TO_STRING(TRANSFORM_GROUPED_FUNC_NAME(H, H))},
+            {{HIP_R_16F, HIP_R_32F}, TO_STRING(TRANSFORM_GROUPED_FUNC_NAME(H, S))},
+            {{HIP_R_16BF, HIP_R_32F}, TO_STRING(TRANSFORM_GROUPED_FUNC_NAME(BF16, S))},
+            {{HIP_R_8I, HIP_R_32F}, TO_STRING(TRANSFORM_GROUPED_FUNC_NAME(I8, S))},
+            {{HIP_R_32I, HIP_R_32F}, TO_STRING(TRANSFORM_GROUPED_FUNC_NAME(I32, S))}};
+
+    // Copies the job table to the device and launches the persistent grouped kernel over the
+    // numWork tiles of all jobs. The table is allocated and freed on stream, and the copy from
+    // pageable memory has staged jobs by the time it returns.
+    template <typename ScaleType>
+    rocblaslt_status launchGroupedTransform(rocblaslt_handle                        handle,
+                                            rocblaslt_matrix_transform_desc*        desc,
+                                            const std::string&                      kernelName,
+                                            const void*                             alpha,
+                                            const void*                             beta,
+                                            const std::vector<TransformGroupedJob>& jobs,
+                                            uint64_t                                numWork,
+                                            hipStream_t                             stream)
+    {
+        const auto maxNumWg = uint64_t(std::max(handle->properties.multiProcessorCount, 1))
+                              * BATCHED_TRANSFORM_WG_PER_CU;
+        const auto numWg       = static_cast<uint32_t>(std::min(numWork, maxNumWg));
+        const auto numJobBytes = jobs.size() * sizeof(TransformGroupedJob);
+        TransformGroupedJob* deviceJobs{};
+
+        if(hipMallocAsync(reinterpret_cast<void**>(&deviceJobs), numJobBytes, stream)
+           != hipSuccess)
+        {
+            return rocblaslt_status_memory_error;
+        }
+
+        auto err = hipMemcpyAsync(
+            deviceJobs, jobs.data(), numJobBytes, hipMemcpyHostToDevice, stream);
+
+        if(err == hipSuccess)
+        {
+            TensileLite::KernelArguments kArgs(false);
+            kArgs.appendAligned("jobs", static_cast<const TransformGroupedJob*>(deviceJobs));
+            kArgs.appendAligned("numJobs", static_cast<uint32_t>(jobs.size()));
+            kArgs.appendAligned("numWork", numWork);
+            appendScalarArgs(kArgs,
+                             static_cast<const ScaleType*>(alpha),
+                             static_cast<const ScaleType*>(beta),
+                             desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE);
+
+            TensileLite::KernelInvocation invocation{kernelName,
+                                                     "hipblasltTransform.hsaco",
+                                                     false,
+                                                     {LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                                     {numWg, 1, 1},
+                                                     {numWg * LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                                     0,
+                                                     kArgs};
+            err = transformAdapter().launchKernel(invocation, stream, nullptr, nullptr);
+        }
+
+        const auto freeErr = hipFreeAsync(deviceJobs, stream);
+        return (err == hipSuccess && freeErr == hipSuccess) ? rocblaslt_status_success
+                                                            : rocblaslt_status_internal_error;
+    }
+
+    static_assert(TransformOrderCol == HIPBLASLT_ORDER_COL && TransformOrderRow == HIPBLASLT_ORDER_ROW
+                      && TransformOrderCol32 == HIPBLASLT_ORDER_COL32
+                      && TransformOrderCol16_4R8 == HIPBLASLT_ORDER_COL16_4R8,
+                  "TransformOrder must match hipblasLtOrder_t");
+
+    constexpr uint32_t TILED_TRANSFORM_MAX_NUM_WG = 65536;
+
+    // clang-format off
+#define GEN_TILED_NAME(_INTYPE, _OUTTYPE, _InTypeStr, _OutTypeStr) \
+    {std::make_pair(_INTYPE, _OUTTYPE), TO_STRING(TRANSFORM_TILED_FUNC_NAME(_InTypeStr, _OutTypeStr))}
+
+    // (input type, output type)
+    std::map<std::pair<hipDataType, hipDataType>, MatrixTransformFunctionName> tiledTransformKernelNames{
+        GEN_TILED_NAME(HIP_R_32F, HIP_R_32F, S, S),
+        GEN_TILED_NAME(HIP_R_16F, HIP_R_16F, H, H),
+        GEN_TILED_NAME(HIP_R_16BF, HIP_R_16BF, BF16, BF16),
+        GEN_TILED_NAME(HIP_R_8I, HIP_R_8I, I8, I8),
+        GEN_TILED_NAME(HIP_R_8F_E4M3_FNUZ, HIP_R_8F_E4M3_FNUZ, F8, F8),
+        GEN_TILED_NAME(HIP_R_8F_E5M2_FNUZ, HIP_R_8F_E5M2_FNUZ, BF8, BF8),
+        GEN_TILED_NAME(HIP_R_32F, HIP_R_8F_E4M3_FNUZ, S, F8),
+        GEN_TILED_NAME(HIP_R_16F, HIP_R_8F_E4M3_FNUZ, H, F8),
+        GEN_TILED_NAME(HIP_R_16BF, HIP_R_8F_E4M3_FNUZ, BF16, F8),
+        GEN_TILED_NAME(HIP_R_32F, HIP_R_8F_E5M2_FNUZ, S, BF8),
+        GEN_TILED_NAME(HIP_R_16F, HIP_R_8F_E5M2_FNUZ, H, BF8),
+        GEN_TILED_NAME(HIP_R_16BF, HIP_R_8F_E5M2_FNUZ, BF16, BF8)};
+    // clang-format on
+
+    bool isTiledOrder(hipblasLtOrder_t order)
+    {
+        return order != HIPBLASLT_ORDER_COL && order != HIPBLASLT_ORDER_ROW;
+    }
+
+    uint64_t tiledOrderNumElements(hipblasLtOrder_t order, uint64_t m, uint64_t n)
+    {
+        switch(order)
+        {
+        case HIPBLASLT_ORDER_COL32:
+            return m * ((n + 31) / 32 * 32);
+        case HIPBLASLT_ORDER_COL16_4R8:
+            return ((m + 31) / 32 * 32) * ((n + 15) / 16 * 16);
+        default:
+            return m * n;
+        }
+    }
+
+    // C = cast(scaleC * (alpha * A + beta * B)) with the element-wise kernels that address any
+    // memory order, used when A, B or C is in a tiled order
+    rocblaslt_status launchTiledTransform(rocblaslt_matrix_transform_desc* desc,
+                                          const void*                      alpha,
+                                          const void*                      a,
+                                          rocblaslt_matrix_layout          layoutA,
+                                          const void*                      beta,
+                                          const void*                      b,
+                                          rocblaslt_matrix_layout          layoutB,
+                                          void*                            c,
+                                          rocblaslt_matrix_layout          layoutC,
+                                          hipStream_t                      stream)
+    {
+        const auto inType = a ? layoutA->type : layoutB->type;
+        const auto key    = std::make_pair(inType, layoutC->type);
+
+        if(desc->scaleType != HIP_R_32F || (a && b && layoutA->type != layoutB->type)
+           || (a && a == c) || (b && b == c) || desc->batchPointerArray
+           || !tiledTransformKernelNames.count(key))
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        const auto numElements = tiledOrderNumElements(layoutC->order, layoutC->m, layoutC->n);
+        const auto numWg       = static_cast<uint32_t>(
+            std::min<uint64_t>(numElements / LDS_TRANSFORM_NUM_WORKITEMS
+                                   + !!(numElements % LDS_TRANSFORM_NUM_WORKITEMS),
+                               TILED_TRANSFORM_MAX_NUM_WG));
+        const auto batchSize = static_cast<uint32_t>(layoutA->batch_count);
+
+        if(!numWg)
+        {
+            return rocblaslt_status_success;
+        }
+
+        TensileLite::KernelArguments kArgs(false);
+        kArgs.appendAligned("c", c);
+        kArgs.appendAligned("a", a);
+        kArgs.appendAligned("b", b);
+        appendScalarArgs(kArgs,
+                         static_cast<const float*>(alpha),
+                         static_cast<const float*>(beta),
+                         desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE);
+        kArgs.appendAligned("scaleCPtr", static_cast<const float*>(desc->scaleCPointer));
+        kArgs.appendAligned("m", static_cast<uint32_t>(layoutC->m));
+        kArgs.appendAligned("n", static_cast<uint32_t>(layoutC->n));
+        kArgs.appendAligned("ldA", static_cast<uint32_t>(layoutA->ld));
+        kArgs.appendAligned("ldB", static_cast<uint32_t>(layoutB->ld));
+        kArgs.appendAligned("ldC", static_cast<uint32_t>(layoutC->ld));
+        kArgs.appendAligned("batchStride", static_cast<uint32_t>(layoutA->batch_stride));
+        kArgs.appendAligned("orderA", static_cast<uint32_t>(layoutA->order));
+        kArgs.appendAligned("orderB", static_cast<uint32_t>(layoutB->order));
+        kArgs.appendAligned("orderC", static_cast<uint32_t>(layoutC->order));
+        kArgs.appendAligned("transA", desc->opA == HIPBLAS_OP_T);
+        kArgs.appendAligned("transB", desc->opB == HIPBLAS_OP_T);
+        kArgs.appendAligned("saturate", desc->saturate != 0);
+        kArgs.appendAligned("stochasticRounding", desc->stochasticRounding != 0);
+        kArgs.appendAligned("seed", desc->roundingSeed);
+
+        TensileLite::KernelInvocation invocation{tiledTransformKernelNames.at(key),
+                                             "hipblasltTransform.hsaco",
+                                             false,
+                                             {LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+                                             {numWg, 1, batchSize},
+                                             {numWg * LDS_TRANSFORM_NUM_WORKITEMS, 1, batchSize},
+                                             0,
+                                             kArgs};
+        auto&                     adapter = transformAdapter();
+        const auto err = adapter.launchKernel(invocation, stream, nullptr, nullptr);
+        return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
+    }
+
+    constexpr uint32_t INPLACE_TRANSFORM_TILE_SIZE  = 32;
+    constexpr uint32_t INPLACE_TRANSFORM_MAX_NUM_WG = 65536;
+
+    // (type, scale type) -> (square, cycle)
+    std::map<std::pair<hipDataType, hipDataType>,
+             std::pair<MatrixTransformFunctionName, MatrixTransformFunctionName>>
+        inPlaceTransformKernelNames{
+            {{HIP_R_32F, HIP_R_32F},
+             {TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(S, S, Square)),
+              TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(S, S, Cycle))}},
+            {{HIP_R_16F, HIP_R_16F},
+             {TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(H, H, Square)),
+              TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(H, H, Cycle))}},
+            {{HIP_R_16F, HIP_R_32F},
+             {TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(H, S, Square)),
+              TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(H, S, Cycle))}},
+            {{HIP_R_16BF, HIP_R_32F},
+             {TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(BF16, S, Square)),
+              TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(BF16, S, Cycle))}},
+            {{HIP_R_8I, HIP_R_32F},
+             {TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(I8, S, Square)),
+              TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(I8, S, Cycle))}},
+            {{HIP_R_32I, HIP_R_32F},
+             {TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(I32, S, Square)),
+              TO_STRING(TRANSFORM_INPLACE_FUNC_NAME(I32, S, Cycle))}}};
+
+    template <typename ScaleType>
+    hipError_t launchInPlaceTransformKernel(const std::string& kernelName,
+                                            void*              c,
+                                            const void*        scalar,
+                                            bool               scalarInDevice,
+                                            uint32_t           numRows,
+                                            uint32_t           numCols,
+                                            uint32_t           ld,
+                                            uint32_t           batchStride,
+                                            dim3               numWg,
+                                            hipStream_t        stream)
+    {
+        TensileLite::KernelArguments kArgs(false);
+        kArgs.appendAligned("c", c);
+        appendScalarArg(
+            kArgs, "alpha", "alphaPtr", static_cast<const ScaleType*>(scalar), scalarInDevice);
+        kArgs.appendAligned("m", numRows);
+        kArgs.appendAligned("n", numCols);
+        kArgs.appendAligned("ld", ld);
+        kArgs.appendAligned("batchStride", batchStride);
+
+        TensileLite::KernelInvocation invocation{
+            kernelName,
+            "hipblasltTransform.hsaco",
+            false,
+            {LDS_TRANSFORM_NUM_WORKITEMS, 1, 1},
+            numWg,
+            {numWg.x * LDS_TRANSFORM_NUM_WORKITEMS, numWg.y, numWg.z},
+            0,
+            kArgs};
+        auto& adapter = transformAdapter();
+        return adapter.launchKernel(invocation, stream, nullptr, nullptr);
+    }
+
+    // C = scalar * op(X) where C and X are the same buffer and op(X) is stored in the other
+    // memory order than C, so the matrix has to be transposed in place. Square matrices whose
+    // leading dimensions match swap tiles; packed rectangular matrices follow the permutation
+    // cycles. Anything else cannot be transposed in place.
+    rocblaslt_status launchInPlaceTranspose(rocblaslt_matrix_transform_desc* desc,
+                                            const void*                      scalar,
+                                            void*                            c,
+                                            rocblaslt_matrix_layout          layoutX,
+                                            bool                             transX,
+                                            rocblaslt_matrix_layout          layoutC,
+                                            hipStream_t                      stream)
+    {
+        const auto key = std::make_pair(layoutX->type, desc->scaleType);
+
+        if(layoutX->type != layoutC->type || desc->scaleCPointer || desc->batchPointerArray
+           || !inPlaceTransformKernelNames.count(key))
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        // X holds numRows x numCols matrices with contiguous columns, C their transposes
+        const auto  m              = static_cast<uint32_t>(layoutC->m);
+        const auto  n              = static_cast<uint32_t>(layoutC->n);
+        const bool  alongColsX     = (layoutX->order == HIPBLASLT_ORDER_ROW) != transX;
+        const auto  numRows        = alongColsX ? m : n;
+        const auto  numCols        = alongColsX ? n : m;
+        const auto  ld             = static_cast<uint32_t>(layoutX->ld);
+        const auto  batchSize      = static_cast<uint32_t>(layoutX->batch_count);
+        const auto  batchStride    = static_cast<uint32_t>(layoutX->batch_stride);
+        const bool  scalarInDevice = desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE;
+        const auto& names          = inPlaceTransformKernelNames.at(key);
+        std::string kernelName;
+        dim3        numWg;
+
+        if(m == n && layoutX->ld == layoutC->ld)
+        {
+            const auto numTiles
+                = n / INPLACE_TRANSFORM_TILE_SIZE + !!(n % INPLACE_TRANSFORM_TILE_SIZE);
+            kernelName = names.first;
+            numWg      = dim3(numTiles * (numTiles + 1) / 2, 1, batchSize);
+        }
+        else if(layoutX->ld == numCols && layoutC->ld == numRows)
+        {
+            const auto size      = uint64_t(numRows) * numCols;
+            const auto numBlocks = size / LDS_TRANSFORM_NUM_WORKITEMS
+                                   + !!(size % LDS_TRANSFORM_NUM_WORKITEMS);
+            kernelName = names.second;
+            numWg      = dim3(
+                static_cast<uint32_t>(std::min<uint64_t>(numBlocks, INPLACE_TRANSFORM_MAX_NUM_WG)),
+                1,
+                batchSize);
+        }
+        else
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        if(!numWg.x)
+        {
+            return rocblaslt_status_success;
+        }
+
+        const auto err
+            = desc->scaleType == HIP_R_16F
+                  ? launchInPlaceTransformKernel<hipblasLtHalf>(kernelName,
+                                                                c,
+                                                                scalar,
+                                                                scalarInDevice,
+                                                                numRows,
+                                                                numCols,
+                                                                ld,
+                                                                batchStride,
+                                                                numWg,
+                                                                stream)
+                  : launchInPlaceTransformKernel<hipblasLtFloat>(kernelName,
+                                                                 c,
+                                                                 scalar,
+                                                                 scalarInDevice,
+                                                                 numRows,
+                                                                 numCols,
+                                                                 ld,
+                                                                 batchStride,
+                                                                 numWg,
+                                                                 stream);
+        return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
+    }
+
+    // Chunks a streaming transform keeps in flight: one is copied to the device, one is
+    // transformed and one is copied back at the same time, so both copy directions stay busy.
+    constexpr int STREAMING_TRANSFORM_NUM_STREAMS = 3;
+
+    // Rows [row, row + numRows) and columns [col, col + numCols) of a matrix stored with layout,
+    // as the element offset of their first contiguous line, the elements per line and the
+    // number of lines.
+    struct MatrixRegion
+    {
+        int64_t offset;
+        int64_t width;
+        int64_t height;
+    };
+
+    MatrixRegion matrixRegion(rocblaslt_matrix_layout layout,
+                              int64_t                 row,
+                              int64_t                 numRows,
+                              int64_t                 col,
+                              int64_t                 numCols)
+    {
+        if(layout->order == HIPBLASLT_ORDER_ROW)
+        {
+            return {row * layout->ld + col, numCols, numRows};
+        }
+
+        return {col * layout->ld + row, numRows, numCols};
+    }
+
+    // Copies one operand of a chunk between its host matrix and the packed device buffer the
+    // chunk is transformed in, and describes the packed buffer in chunkLayout.
+    hipError_t copyChunkRegion(void*                     dst,
+                               const void*               src,
+                               rocblaslt_matrix_layout   layout,
+                               _rocblaslt_matrix_layout& chunkLayout,
+                               int64_t                   batchIdx,
+                               int64_t                   row,
+                               int64_t                   numRows,
+                               int64_t                   col,
+                               int64_t                   numCols,
+                               hipMemcpyKind             kind,
+                               hipStream_t               stream)
+    {
+        const auto region       = matrixRegion(layout, row, numRows, col, numCols);
+        const auto elemNumBytes = transformElemNumBytes(layout->type);
+        const auto hostOffset   = (batchIdx * layout->batch_stride + region.offset) * elemNumBytes;
+        const auto widthBytes   = region.width * elemNumBytes;
+
+        chunkLayout              = *layout;
+        chunkLayout.m            = numRows;
+        chunkLayout.n            = numCols;
+        chunkLayout.ld           = region.width;
+        chunkLayout.batch_count  = 1;
+        chunkLayout.batch_stride = 0;
+
+        if(kind == hipMemcpyHostToDevice)
+        {
+            return hipMemcpy2DAsync(dst,
+                                    widthBytes,
+                                    static_cast<const char*>(src) + hostOffset,
+                                    layout->ld * elemNumBytes,
+                                    widthBytes,
+                                    region.height,
+                                    kind,
+                                    stream);
+        }
+
+        return hipMemcpy2DAsync(static_cast<char*>(dst) + hostOffset,
+                                layout->ld * elemNumBytes,
+                                src,
+                                widthBytes,
+                                widthBytes,
+                                region.height,
+                                kind,
+                                stream);
+    }
+
+    // C = alpha * op(A) + beta * op(B) with A, B and C in host memory, for matrices that do not
+    // fit on the device. C is split into chunks of desc->streamingChunkSize columns, or rows for
+    // a row major C, which are copied in, transformed and copied back round-robin on
+    // STREAMING_TRANSFORM_NUM_STREAMS streams that each own the device buffers of one chunk.
+    // The host matrices must be pinned for the copies to overlap the transforms.
+    rocblaslt_status launchStreamingTransform(rocblaslt_handle                 handle,
+                                              rocblaslt_matrix_transform_desc* desc,
+                                              const void*                      alpha,
+                                              const void*                      A,
+                                              rocblaslt_matrix_layout          layoutA,
+                                              const void*                      beta,
+                                              const void*                      B,
+                                              rocblaslt_matrix_layout          layoutB,
+                                              void*                            C,
+                                              rocblaslt_matrix_layout          layoutC,
+                                              hipStream_t                      stream)
+    {
+        if(desc->batchPointerArray || A == C || B == C)
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        const bool    alongCols = layoutC->order != HIPBLASLT_ORDER_ROW;
+        const int64_t numLines  = alongCols ? layoutC->n : layoutC->m;
+        const int64_t lineSize  = alongCols ? layoutC->m : layoutC->n;
+        const int64_t chunkSize = std::min<int64_t>(desc->streamingChunkSize, numLines);
+
+        if(!numLines || !lineSize || !layoutC->batch_count)
+        {
+            return rocblaslt_status_success;
+        }
+
+        // Keep every device buffer 256-byte aligned so the chunks can use the vector kernels
+        const auto bufferNumBytes = [&](const void* ptr, rocblaslt_matrix_layout layout) {
+            const size_t numBytes = ptr ? chunkSize * lineSize * transformElemNumBytes(layout->type)
+                                        : 0;
+            return (numBytes + 255) / 256 * 256;
+        };
+        const size_t numBytesA = bufferNumBytes(A, layoutA);
+        const size_t numBytesB = bufferNumBytes(B, layoutB);
+        const size_t numBytesC = bufferNumBytes(C, layoutC);
+
+        if((A && !numBytesA) || (B && !numBytesB) || !numBytesC)
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        const size_t numSlotBytes = numBytesA + numBytesB + numBytesC;
+        char*        workspace{};
+
+        if(hipMallocAsync(reinterpret_cast<void**>(&workspace),
+                          numSlotBytes * STREAMING_TRANSFORM_NUM_STREAMS,
+                          stream)
+           != hipSuccess)
+        {
+            return rocblaslt_status_memory_error;
+        }
+
+        hipStream_t streams[STREAMING_TRANSFORM_NUM_STREAMS]{};
+        hipEvent_t  events[STREAMING_TRANSFORM_NUM_STREAMS + 1]{};
+        hipError_t  err = hipSuccess;
+
+        for(int i = 0; i <= STREAMING_TRANSFORM_NUM_STREAMS && err == hipSuccess; ++i)
+        {
+            err = hipEventCreateWithFlags(&events[i], hipEventDisableTiming);
+        }
+
+        for(int i = 0; i < STREAMING_TRANSFORM_NUM_STREAMS && err == hipSuccess; ++i)
+        {
+            err = hipStreamCreateWithFlags(&streams[i], hipStreamNonBlocking);
+        }
+
+        // The chunk streams start once the workspace is allocated and earlier work on stream
+        // is done
+        if(err == hipSuccess)
+        {
+            err = hipEventRecord(events[STREAMING_TRANSFORM_NUM_STREAMS], stream);
+        }
+
+        for(int i = 0; i < STREAMING_TRANSFORM_NUM_STREAMS && err == hipSuccess; ++i)
+        {
+            err = hipStreamWaitEvent(streams[i], events[STREAMING_TRANSFORM_NUM_STREAMS], 0);
+        }
+
+        rocblaslt_status status = err == hipSuccess ? rocblaslt_status_success
+                                                    : rocblaslt_status_internal_error;
+        rocblaslt_matrix_transform_desc chunkDesc = *desc;
+        chunkDesc.streamingChunkSize              = 0;
+        int64_t chunkIdx                          = 0;
+
+        for(int64_t batchIdx = 0;
+            batchIdx < layoutC->batch_count && status == rocblaslt_status_success;
+            ++batchIdx)
+        {
+            for(int64_t line = 0; line < numLines && status == rocblaslt_status_success;
+                line += chunkSize, ++chunkIdx)
+            {
+                const int64_t numChunkLines = std::min(chunkSize, numLines - line);
+                const int64_t row           = alongCols ? 0 : line;
+                const int64_t numRows       = alongCols ? lineSize : numChunkLines;
+                const int64_t col           = alongCols ? line : 0;
+                const int64_t numCols       = alongCols ? numChunkLines : lineSize;
+                const auto    slot          = chunkIdx % STREAMING_TRANSFORM_NUM_STREAMS;
+                const auto    chunkStream   = streams[slot];
+                char*         chunkA        = workspace + slot * numSlotBytes;
+                char*         chunkB        = chunkA + numBytesA;
+                char*         chunkC        = chunkB + numBytesB;
+                _rocblaslt_matrix_layout chunkLayoutA, chunkLayoutB, chunkLayoutC;
+
+                // op(A) and op(B) cover the same region as C, which is transposed in storage
+                // for a transposed operand
+                if(A)
+                {
+                    const bool transA = desc->opA == HIPBLAS_OP_T;
+                    err               = copyChunkRegion(chunkA,
+                                          A,
+                                          layoutA,
+                                          chunkLayoutA,
+                                          batchIdx,
+                                          transA ? col : row,
+                                          transA ? numCols : numRows,
+                                          transA ? row : col,
+                                          transA ? numRows : numCols,
+                                          hipMemcpyHostToDevice,
+                                          chunkStream);
+                }
+
+                if(B && err == hipSuccess)
+                {
+                    const bool transB = desc->opB == HIPBLAS_OP_T;
+                    err               = copyChunkRegion(chunkB,
+                                          B,
+                                          layoutB,
+                                          chunkLayoutB,
+                                          batchIdx,
+                                          transB ? col : row,
+                                          transB ? numCols : numRows,
+                                          transB ? row : col,
+                                          transB ? numRows : numCols,
+                                          hipMemcpyHostToDevice,
+                                          chunkStream);
+                }
+
+                if(err != hipSuccess)
+                {
+                    status = rocblaslt_status_memory_error;
+                    break;
+                }
+
+                chunkLayoutC              = *layoutC;
+                chunkLayoutC.m            = numRows;
+                chunkLayoutC.n            = numCols;
+                chunkLayoutC.ld           = alongCols ? numRows : numCols;
+                chunkLayoutC.batch_count  = 1;
+                chunkLayoutC.batch_stride = 0;
+                status                    = rocblaslt_matrix_transform(handle,
+                                                    &chunkDesc,
+                                                    alpha,
+                                                    A ? chunkA : nullptr,
+                                                    A ? &chunkLayoutA : nullptr,
+                                                    beta,
+                                                    B ? chunkB : nullptr,
+                                                    B ? &chunkLayoutB : nullptr,
+                                                    chunkC,
+                                                    &chunkLayoutC,
+                                                    chunkStream);
+
+                if(status == rocblaslt_status_success
+                   && copyChunkRegion(C,
+                                      chunkC,
+                                      layoutC,
+                                      chunkLayoutC,
+                                      batchIdx,
+                                      row,
+                                      numRows,
+                                      col,
+                                      numCols,
+                                      hipMemcpyDeviceToHost,
+                                      chunkStream)
+                          != hipSuccess)
+                {
+                    status = rocblaslt_status_memory_error;
+                }
+            }
+        }
+
+        // stream continues once all chunks are back on the host. Streams and events are
+        // released by the runtime when their work completes.
+        for(int i = 0; i < STREAMING_TRANSFORM_NUM_STREAMS; ++i)
+        {
+            if(streams[i])
+            {
+                if(hipEventRecord(events[i], streams[i]) != hipSuccess
+                   || hipStreamWaitEvent(stream, events[i], 0) != hipSuccess)
+                {
+                    status = rocblaslt_status_internal_error;
+                }
+
+                static_cast<void>(hipStreamDestroy(streams[i]));
+            }
+        }
+
+        for(auto event : events)
+        {
+            if(event)
+            {
+                static_cast<void>(hipEventDestroy(event));
+            }
+        }
+
+        if(hipFreeAsync(workspace, stream) != hipSuccess && status == rocblaslt_status_success)
+        {
+            status = rocblaslt_status_memory_error;
+        }
+
+        return status;
+    }
 }
 
 rocblaslt_status rocblaslt_matrix_transform(rocblaslt_handle                 handle,
@@ -764,6 +1932,178 @@ rocblaslt_status rocblaslt_matrix_transform(rocblaslt_handle                 han
         layoutB = dummyMatrixLayout();
     }
 
+    if(desc->streamingChunkSize > 0)
+    {
+        if((A && isTiledOrder(layoutA->order)) || (B && isTiledOrder(layoutB->order))
+           || isTiledOrder(layoutC->order))
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        return launchStreamingTransform(
+            handle, desc, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+    }
+
+    if((A && isTiledOrder(layoutA->order)) || (B && isTiledOrder(layoutB->order))
+       || isTiledOrder(layoutC->order))
+    {
+        return launchTiledTransform(desc, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+    }
+
+    // With C aliasing A or B in the same memory order, every tile is read before it is written
+    // by the same workgroup and the out-of-place kernels are safe. In the other order C needs
+    // an in-place transpose.
+    if((A && A == C && !B) || (B && B == C && !A))
+    {
+        const bool fromA   = A == C;
+        const auto layoutX = fromA ? layoutA : layoutB;
+        const bool transX  = (fromA ? desc->opA : desc->opB) == HIPBLAS_OP_T;
+
+        if(((layoutX->order == HIPBLASLT_ORDER_ROW) != transX)
+           != (layoutC->order == HIPBLASLT_ORDER_ROW))
+        {
+            return launchInPlaceTranspose(
+                desc, fromA ? alpha : beta, C, layoutX, transX, layoutC, stream);
+        }
+    }
+
+    const auto inType = A ? layoutA->type : layoutB->type;
+
+    if(layoutC->type != inType || desc->scaleCPointer)
+    {
+        if(desc->batchPointerArray)
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        return launchConvertTransform(
+            desc, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+    }
+
+    // Shape specialized kernels serve the strided batches of the same type transforms
+    if(!desc->batchPointerArray && JitTransform::enabled())
+    {
+        const bool                    transA = desc->opA == HIPBLAS_OP_T;
+        const bool                    transB = desc->opB == HIPBLAS_OP_T;
+        const JitTransform::Signature signature{
+            inType,
+            desc->scaleType,
+            layoutC->m,
+            layoutC->n,
+            layoutA->ld,
+            layoutB->ld,
+            layoutC->ld,
+            (layoutA->order == HIPBLASLT_ORDER_ROW) != transA,
+            (layoutB->order == HIPBLASLT_ORDER_ROW) != transB,
+            layoutC->order == HIPBLASLT_ORDER_ROW,
+            A != nullptr,
+            B != nullptr,
+            layoutA->batch_stride};
+        const auto err = JitTransform::launch(signature,
+                                              C,
+                                              A,
+                                              B,
+                                              alpha,
+                                              beta,
+                                              desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE,
+                                              layoutA->batch_count,
+                                              stream);
+        if(err != hipErrorNotSupported)
+        {
+            return (err == hipSuccess) ? rocblaslt_status_success
+                                       : rocblaslt_status_internal_error;
+        }
+    }
+
+    const auto batchedKey = std::make_pair(inType, desc->scaleType);
+
+    if(useBatchedTransform(handle, desc, layoutA, layoutC)
+       && batchedTransformKernelNames.count(batchedKey))
+    {
+        const auto& kernelName = batchedTransformKernelNames.at(batchedKey);
+
+        if(desc->scaleType == HIP_R_16F)
+        {
+            return launchBatchedTransform<hipblasLtHalf>(
+                handle, desc, kernelName, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+        }
+
+        return launchBatchedTransform<hipblasLtFloat>(
+            handle, desc, kernelName, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+    }
+
+    if(desc->batchPointerArray)
+    {
+        return rocblaslt_status_not_implemented;
+    }
+
+    bool transA         = desc->opA == HIPBLAS_OP_T;
+    bool transB         = desc->opB == HIPBLAS_OP_T;
+    bool scalarInDevice = desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE;
+
+    const auto variant = selectTransformVariant(inType,
+                                                A,
+                                                B,
+                                                C,
+                                                layoutC->m,
+                                                layoutC->n,
+                                                layoutA->ld,
+                                                layoutB->ld,
+                                                layoutC->ld,
+                                                layoutA->batch_count,
+                                                layoutA->batch_stride,
+                                                (layoutA->order == HIPBLASLT_ORDER_ROW) != transA,
+                                                (layoutB->order == HIPBLASLT_ORDER_ROW) != transB,
+                                                layoutC->order == HIPBLASLT_ORDER_ROW);
+    const auto vector128Width = 16 / std::max<size_t>(transformElemNumBytes(inType), 1);
+    const auto ldsKey         = std::make_tuple(inType,
+                                        desc->scaleType,
+                                        layoutA->order,
+                                        layoutB->order,
+                                        layoutC->order,
+                                        variant.tileM,
+                                        variant.tileN);
+    const auto variantKey = std::make_tuple(inType, desc->scaleType, variant.tileM, variant.tileN);
+
+    // Fully 128-bit aligned operands use the kernels specialized for their orders
+    if(variant.inVectorWidth == vector128Width && variant.outVectorWidth == vector128Width
+       && ldsTransformKernels.count(ldsKey))
+    {
+        const auto& kernel = ldsTransformKernels.at(ldsKey);
+        const auto  err    = kernel.second(C,
+                                       A,
+                                       B,
+                                       alpha,
+                                       beta,
+                                       scalarInDevice,
+                                       layoutC->m,
+                                       layoutC->n,
+                                       layoutA->ld,
+                                       layoutB->ld,
+                                       layoutC->ld,
+                                       layoutA->batch_count,
+                                       layoutA->batch_stride,
+                                       transA,
+                                       transB,
+                                       stream,
+                                       kernel.first);
+        return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
+    }
+
+    if(variantTransformKernelNames.count(variantKey))
+    {
+        const auto& kernelName = variantTransformKernelNames.at(variantKey);
+
+        if(desc->scaleType == HIP_R_16F)
+        {
+            return launchVariantTransform<hipblasLtHalf>(
+                desc, kernelName, variant, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+        }
+
+        return launchVariantTransform<hipblasLtFloat>(
+            desc, kernelName, variant, alpha, A, layoutA, beta, B, layoutB, C, layoutC, stream);
+    }
+
     size_t vw  = layoutC->m < 4 || layoutC->n < 4 ? 1 : 4;
     auto   key = std::make_tuple(
         layoutA->type, desc->scaleType, layoutA->order, layoutB->order, layoutC->order, vw);
@@ -773,10 +2113,7 @@ rocblaslt_status rocblaslt_matrix_transform(rocblaslt_handle                 han
         return rocblaslt_status_internal_error;
     }
 
-    bool       transA         = desc->opA == HIPBLAS_OP_T;
-    bool       transB         = desc->opB == HIPBLAS_OP_T;
-    bool       scalarInDevice = desc->pointerMode == HIPBLASLT_POINTER_MODE_DEVICE;
-    const auto kernelName     = transformKernelNames.at(key);
+    const auto kernelName = transformKernelNames.at(key);
 
     const auto err = transformKernels.at(key)(C,
                                               A,
@@ -798,3 +2135,127 @@ rocblaslt_status rocblaslt_matrix_transform(rocblaslt_handle                 han
 
     return (err == hipSuccess) ? rocblaslt_status_success : rocblaslt_status_internal_error;
 }
+
+rocblaslt_status rocblaslt_matrix_transform_grouped(rocblaslt_handle                 handle,
+                                                    rocblaslt_matrix_transform_desc* desc,
+                                                    const void* alpha, /* host or device pointer */
+                                                    const void* beta, /* host or device pointer */
+                                                    const rocblaslt_matrix_transform_job* jobs,
+                                                    uint32_t                              numJobs,
+                                                    hipStream_t                           stream)
+{
+    if(!handle)
+    {
+        return rocblaslt_status_invalid_handle;
+    }
+
+    if(!desc || (!jobs && numJobs))
+    {
+        return rocblaslt_status_invalid_value;
+    }
+
+    if(desc->batchPointerArray || desc->streamingChunkSize > 0 || desc->scaleCPointer)
+    {
+        return rocblaslt_status_not_implemented;
+    }
+
+    std::vector<TransformGroupedJob> groupedJobs;
+    uint64_t                         numWork = 0;
+    hipDataType                      type    = HIP_R_32F;
+
+    groupedJobs.reserve(numJobs);
+
+    for(uint32_t i = 0; i < numJobs; ++i)
+    {
+        const auto& job     = jobs[i];
+        auto        layoutA = job.Adesc;
+        auto        layoutB = job.Bdesc;
+        const auto  layoutC = job.Cdesc;
+
+        if((job.A && !layoutA) || (job.B && !layoutB) || (!layoutA && !layoutB) || !job.C
+           || !layoutC || (job.A && job.A == job.C) || (job.B && job.B == job.C))
+        {
+            return rocblaslt_status_invalid_value;
+        }
+
+        if(!job.A && !layoutA)
+        {
+            layoutA = dummyMatrixLayout();
+        }
+
+        if(!job.B && !layoutB)
+        {
+            layoutB = dummyMatrixLayout();
+        }
+
+        if((job.A && isTiledOrder(layoutA->order)) || (job.B && isTiledOrder(layoutB->order))
+           || isTiledOrder(layoutC->order))
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        const auto inType = job.A ? layoutA->type : layoutB->type;
+
+        if(layoutC->type != inType || (job.A && job.B && layoutA->type != layoutB->type)
+           || (i && inType != type))
+        {
+            return rocblaslt_status_not_implemented;
+        }
+
+        type = inType;
+
+        const auto m        = static_cast<uint32_t>(layoutC->m);
+        const auto n        = static_cast<uint32_t>(layoutC->n);
+        const auto numTiles = uint64_t(numBatchedTransformTiles(m, n))
+                              * uint64_t(std::max(layoutC->batch_count, 0));
+
+        if(!numTiles)
+        {
+            continue;
+        }
+
+        const bool transA = desc->opA == HIPBLAS_OP_T;
+        const bool transB = desc->opB == HIPBLAS_OP_T;
+
+        groupedJobs.push_back({job.C,
+                               job.A,
+                               job.B,
+                               size_t(layoutA->batch_stride),
+                               size_t(layoutB->batch_stride),
+                               size_t(layoutC->batch_stride),
+                               numWork,
+                               m,
+                               n,
+                               static_cast<uint32_t>(layoutA->ld),
+                               static_cast<uint32_t>(layoutB->ld),
+                               static_cast<uint32_t>(layoutC->ld),
+                               static_cast<uint32_t>(layoutC->batch_count),
+                               (layoutA->order == HIPBLASLT_ORDER_ROW) != transA,
+                               (layoutB->order == HIPBLASLT_ORDER_ROW) != transB,
+                               layoutC->order == HIPBLASLT_ORDER_ROW});
+        numWork += numTiles;
+    }
+
+    if(groupedJobs.empty())
+    {
+        return rocblaslt_status_success;
+    }
+
+    const auto key = std::make_pair(type, desc->scaleType);
+
+    if(!groupedTransformKernelNames.count(key))
+    {
+        return rocblaslt_status_not_implemented;
+    }
+
+    const auto& kernelName = groupedTransformKernelNames.at(key);
+
+    if(desc->scaleType == HIP_R_16F)
+    {
+        return launchGroupedTransform<hipblasLtHalf>(
+            handle, desc, kernelName, alpha, beta, groupedJobs, numWork, stream);
+    }
+
+    return launchGroupedTransform<hipblasLtFloat>(
+        handle, desc, kernelName, alpha, beta, groupedJobs, numWork, stream);
+}
@@ -33,31 +33,51 @@
  * or reference Tensile identifiers. tensile_host.hpp defines the interface. *
  *****************************************************************************/
 
+#include "CallTiming.hpp"
 #include "Debug.hpp"
 #include "rocblaslt-types.h"
 #include "rocblaslt_mat_utils.hpp"
+#include "rocblaslt_skinny.hpp"
 #include "tensile_host.hpp"
 
 //#include <Tensile/AMDGPU.hpp>
+#include <Tensile/CachingLibrary.hpp>
+#include <Tensile/ContractionProblemPredicates.hpp>
 #include <Tensile/Contractions.hpp>
+#include <Tensile/Debug.hpp>
 #include <Tensile/EmbeddedLibrary.hpp>
 #include <Tensile/MasterSolutionLibrary.hpp>
 #include <Tensile/PlaceholderLibrary.hpp>
+#include <Tensile/SelectionTrace.hpp>
 #include <Tensile/Tensile.hpp>
 #include <Tensile/TensorDescriptor.hpp>
 #include <Tensile/Utils.hpp>
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <algorithm>
+#include <bitset>
 #include <atomic>
+#include <chrono>
 #include <complex>
 #include <exception>
+#include <fstream>
+#include <future>
 #include <iomanip>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <glob.h>
@@ -124,10 +144,7 @@ namespace
 
     inline bool IsOCPSupported()
     {
-        int             deviceId;
-        hipDeviceProp_t deviceProperties;
-        static_cast<void>(hipGetDevice(&deviceId));
-        static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
+        auto const& deviceProperties = TensileLite::hip::GetCurrentDeviceProperties();
         if(gpu_arch_match(deviceProperties.gcnArchName, "12\\d{2}"))
             return true;
         return false;
@@ -155,6 +172,12 @@ namespace
         case ROCBLASLT_EPILOGUE_BGRADA:
         case ROCBLASLT_EPILOGUE_BGRADB:
             break;
+        // Gated activations are applied to the GEMM result by rocblaslt_matmul_gated
+        case ROCBLASLT_EPILOGUE_SWIGLU:
+        case ROCBLASLT_EPILOGUE_SWIGLU_BIAS:
+        case ROCBLASLT_EPILOGUE_GEGLU:
+        case ROCBLASLT_EPILOGUE_GEGLU_BIAS:
+            break;
         }
         return TensileLite::ActivationType::None;
     }
@@ -267,6 +290,7 @@ namespace
         {
         case rocblaslt_compute_f32:
         case rocblaslt_compute_f32_fast_xf32:
+        case rocblaslt_compute_f32_fast_3xbf16:
         case rocblaslt_compute_f32_fast_f16:
         case rocblaslt_compute_f32_fast_bf16:
         case rocblaslt_compute_f32_fast_f8_fnuz:
@@ -493,11 +517,28 @@ namespace
         }
     }
 
+    // Stream and time of a logged call for hipblaslt-bench --replay. Streams are numbered in the
+    // order the process first launched on them, times are microseconds since the first log.
+    inline std::pair<int, int64_t> benchReplayPoint(hipStream_t stream)
+    {
+        static std::mutex                           mutex;
+        static std::unordered_map<hipStream_t, int> streamIds;
+        static const auto                           start = std::chrono::steady_clock::now();
+
+        auto now = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        int id = streamIds.emplace(stream, int(streamIds.size())).first->second;
+        return {id, std::chrono::duration_cast<std::chrono::microseconds>(now - start).count()};
+    }
+
     inline void logBenchFromTensileDataGemm(const TensileLite::ContractionProblemGemm& problem,
                                             const TensileLite::ContractionInputs&      inputs,
-                                            const int& solutionIndex,
-                                            bool       isCpp)
+                                            const int&  solutionIndex,
+                                            bool        isCpp,
+                                            hipStream_t stream)
     {
+        auto replayPoint = benchReplayPoint(stream);
         log_bench(
             __func__,
             "--api_method",
@@ -587,7 +628,11 @@ namespace
             "--solution_index",
             solutionIndex,
             "--activation_type",
-            tensileActivationtType_to_bench_string(problem.getParams().activationEnum()));
+            tensileActivationtType_to_bench_string(problem.getParams().activationEnum()),
+            "--stream_id",
+            replayPoint.first,
+            "--time_us",
+            replayPoint.second);
     }
 
     inline void logProfileFromTensileDataGemm(const TensileLite::ContractionProblemGemm& problem,
@@ -663,13 +708,110 @@ namespace
                     tensileActivationtType_to_bench_string(problem.getParams().activationEnum()));
     }
 
+    // Counts the distinct problems run and the solution used for each one, the entries are
+    // written to HIPBLASLT_CAPTURE_FILE at exit in the format of the profile log, with the
+    // solution index so that hipblaslt_gentest.py replays the captured selection
+    inline void captureFromTensileDataGemm(const TensileLite::ContractionProblemGemm& problem,
+                                           const TensileLite::ContractionInputs&      inputs,
+                                           const int&                                 solutionIndex,
+                                           bool                                       isCpp)
+    {
+        static const std::string path = rocblaslt::Debug::Instance().captureFile();
+        if(path.empty())
+            return;
+
+        auto tup = std::make_tuple(
+            "function",
+            "matmul",
+            "M",
+            problem.c().sizes()[0],
+            "N",
+            problem.c().sizes()[1],
+            "K",
+            problem.a().sizes()[problem.boundIndices()[0].a],
+            "lda",
+            problem.a().strides()[1],
+            "ldb",
+            problem.b().strides()[1],
+            "ldc",
+            problem.c().strides()[1],
+            "ldd",
+            problem.d().strides()[1],
+            "stride_a",
+            problem.a().strides()[2],
+            "stride_b",
+            problem.b().strides()[2],
+            "stride_c",
+            problem.c().strides()[2],
+            "stride_d",
+            problem.d().strides()[2],
+            "alpha",
+            ToString(inputs.alpha),
+            "beta",
+            ToString(inputs.beta),
+            "transA",
+            problem.transA() ? "T" : "N",
+            "transB",
+            problem.transB() ? "T" : "N",
+            "batch_count",
+            problem.batchSize(0),
+            "scaleA",
+            problem.useScaleAB().empty() ? 0 : (problem.useScaleAB() == "Vector" ? 2 : 1),
+            "scaleB",
+            problem.useScaleAB().empty() ? 0 : (problem.useScaleAB() == "Vector" ? 2 : 1),
+            "scaleAlpha_vector",
+            problem.useScaleAlphaVec() ? "true" : "false",
+            "gradient",
+            problem.useGradient() ? "true" : "false",
+            "use_e",
+            problem.useE() ? "true" : "false",
+            "bias_vector",
+            problem.useBias() ? "true" : "false",
+            "bias_source",
+            problem.useBias() ? problem.tensor(problem.biasSrc()).getName() : "d",
+            "a_type",
+            hipDataType_to_bench_string(tensile2HipType(problem.a().dataType())),
+            "b_type",
+            hipDataType_to_bench_string(tensile2HipType(problem.b().dataType())),
+            "c_type",
+            hipDataType_to_bench_string(tensile2HipType(problem.c().dataType())),
+            "d_type",
+            hipDataType_to_bench_string(tensile2HipType(problem.d().dataType())),
+            "scale_type",
+            hipDataType_to_bench_string(tensile2HipType(problem.alphaType())),
+            "bias_type",
+            hipDataType_to_bench_string(tensile2HipType(problem.bias().dataType())),
+            "compute_type",
+            tensileComputeInputType_to_profile_string(problem.computeType(),
+                                                      problem.f32XdlMathOp(),
+                                                      problem.computeInputType(),
+                                                      problem.a().dataType(),
+                                                      problem.b().dataType()),
+            "activation_type",
+            tensileActivationtType_to_bench_string(problem.getParams().activationEnum()),
+            "api_method",
+            isCpp ? 2 : 0,
+            "algo_method",
+            2,
+            "solution_index",
+            solutionIndex);
+
+        static std::ofstream                   out(path);
+        static argument_profile<decltype(tup)> capture(&out);
+        static int aqe = at_quick_exit([] { capture.~argument_profile(); });
+
+        capture(std::move(tup));
+    }
+
     inline void
         logBenchFromTensileDataGemm(const TensileLite::ContractionProblemGroupedGemm& problem,
                                     const TensileLite::ContractionGroupedInputs&      inputs,
                                     const int&                                        solutionIndex,
-                                    bool                                              isCpp)
+                                    bool                                              isCpp,
+                                    hipStream_t                                       stream)
     {
-        size_t            gemmCount = problem.gemms.size();
+        auto              replayPoint = benchReplayPoint(stream);
+        size_t            gemmCount   = problem.gemms.size();
         std::stringstream grouped_gemm_bench_string;
         for(int i = 0; i < gemmCount; ++i)
         {
@@ -767,7 +909,11 @@ namespace
             "--solution_index",
             solutionIndex,
             "--activation_type",
-            tensileActivationtType_to_bench_string(problem.gemms[0].getParams().activationEnum()));
+            tensileActivationtType_to_bench_string(problem.gemms[0].getParams().activationEnum()),
+            "--stream_id",
+            replayPoint.first,
+            "--time_us",
+            replayPoint.second);
     }
 
     inline void
@@ -890,6 +1036,21 @@ namespace
     }
 #undef GEN_BENCH_ARG
 
+    /*******************************************************************
+ * C is updated in place when it is the same matrix as D, not merely *
+ * at the same address, so a CEqualsD solution can read-modify-write *
+ * each tile of D through the strides of D.                          *
+ *******************************************************************/
+    bool cAliasesD(const RocblasltContractionProblem& prob)
+    {
+        if(prob.C != prob.D || prob.c_type != prob.d_type)
+            return false;
+        if(!prob.strided_batch)
+            return prob.batch_C == prob.batch_D && prob.col_stride_c == prob.col_stride_d;
+        return prob.col_stride_c == prob.col_stride_d
+               && (prob.batch_count <= 1 || prob.batch_stride_c == prob.batch_stride_d);
+    }
+
     /****************************************************************
  * Construct a Tensile Problem from a RocblasltContractionProblem *
  ****************************************************************/
@@ -1043,7 +1204,7 @@ namespace
         tensileProblem.setAlphaRestriction(TensileLite::toScalarValueEnum(alphaRestriction));
 
         // Add problem predicates for CEqualsD
-        tensileProblem.setCEqualsD(prob.C == prob.D);
+        tensileProblem.setCEqualsD(cAliasesD(prob));
 
         if(is_e_enabled(prob.epilogue))
         {
@@ -1092,6 +1253,9 @@ namespace
         if(prob.compute_type == rocblaslt_compute_f32_fast_xf32)
             tensileProblem.setF32XdlMathOp(TensileLite::DataType::XFloat32);
 
+        // After A is set, the compressed and metadata tensors are derived from it
+        tensileProblem.setSparse(prob.sparseA ? 1 : 0);
+
         return tensileProblem;
     }
 
@@ -1210,7 +1374,7 @@ namespace
         tensileProblem.setAlphaRestriction(TensileLite::toScalarValueEnum(alphaRestriction));
 
         // Add problem predicates for CEqualsD
-        tensileProblem.setCEqualsD(prob.C == prob.D);
+        tensileProblem.setCEqualsD(cAliasesD(prob));
 
         auto tensileAct = getTensileActivationType(prob.epilogue);
 
@@ -1264,6 +1428,8 @@ namespace
 
         if(prob.compute_type == rocblaslt_compute_f32_fast_xf32)
             tensileProblem.setF32XdlMathOp(TensileLite::DataType::XFloat32);
+
+        tensileProblem.setSparse(prob.sparseA ? 1 : 0);
     }
 
     /***************************************************************
@@ -1283,6 +1449,8 @@ namespace
         inputs.d = reinterpret_cast<void*>(prob.D);
         inputs.e = reinterpret_cast<void*>(prob.E);
 
+        inputs.metadata = static_cast<unsigned char const*>(prob.metadataA);
+
         inputs.batchA = reinterpret_cast<void const* const*>(prob.batch_A);
         inputs.batchB = reinterpret_cast<void const* const*>(prob.batch_B);
         inputs.batchC = reinterpret_cast<void const* const*>(prob.batch_C);
@@ -1348,8 +1516,7 @@ namespace
 
     TensileLite::LazyLoadingInit getLazyLoadingArch(int deviceID)
     {
-        hipDeviceProp_t deviceProperties;
-        HIP_CHECK_EXC(hipGetDeviceProperties(&deviceProperties, deviceID));
+        auto const& deviceProperties = TensileLite::hip::GetDeviceProperties(deviceID);
         // strip out xnack/ecc from name
         std::string deviceFullString(deviceProperties.gcnArchName);
         std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
@@ -1434,12 +1601,23 @@ namespace
         std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
             m_library;
 #if ROCBLASLT_TENSILE_LAZY_LOAD
-        std::unordered_set<TensileLite::LazyLoadingInit>                  m_deviceSet;
-        std::unordered_map<std::string, std::shared_ptr<hipDeviceProp_t>> m_devicePropMap;
-#else
-        std::shared_ptr<hipDeviceProp_t> m_deviceProp;
+        std::unordered_set<TensileLite::LazyLoadingInit> m_deviceSet;
 #endif
         std::string m_tensileLibPath;
+        // Bumped whenever m_library is replaced, so that per thread copies are refreshed
+        std::atomic<uint32_t> m_libraryGeneration{0};
+
+        // The properties and Hardware of the devices of one architecture and CU count.
+        // The library is shared by all devices and its caches are keyed by the hardware,
+        // so only the adapters below hold per-device state
+        struct device_class_s
+        {
+            std::shared_ptr<hipDeviceProp_t>       prop;
+            std::shared_ptr<TensileLite::Hardware> hardware;
+        };
+
+        // Each device refers to the class it belongs to
+        std::vector<std::shared_ptr<device_class_s const>> m_deviceClasses;
 
         // The adapter object. mutable is used to allow adapters to be modified
         // even when they are stored in a const vector which is immutable in size
@@ -1456,6 +1634,31 @@ namespace
         TensileHost()
             : m_adapters(GetDeviceCount())
         {
+            std::vector<std::shared_ptr<device_class_s const>> classes;
+            for(size_t devId = 0; devId < m_adapters.size(); devId++)
+            {
+                auto const& prop = TensileLite::hip::GetDeviceProperties(devId);
+
+                // strip out xnack/ecc from name
+                std::string deviceFullString(prop.gcnArchName);
+                std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
+
+                auto match = std::find_if(classes.begin(), classes.end(), [&](auto const& c) {
+                    std::string name(c->prop->gcnArchName);
+                    return name.substr(0, name.find(":")) == deviceString
+                           && c->prop->multiProcessorCount == prop.multiProcessorCount;
+                });
+                if(match == classes.end())
+                {
+                    auto deviceClass      = std::make_shared<device_class_s>();
+                    deviceClass->prop     = std::make_shared<hipDeviceProp_t>(prop);
+                    deviceClass->hardware = TensileLite::hip::GetDevice(prop);
+                    classes.push_back(deviceClass);
+                    match = classes.end() - 1;
+                }
+                m_deviceClasses.push_back(*match);
+            }
+
             // We mark TensileHost as initialized. This is so that CI tests can
             // verify that the initialization occurs in the "multiheaded" tests
             rocblaslt_internal_tensile_is_initialized() = true;
@@ -1489,17 +1692,20 @@ namespace
         {
             return m_library;
         }
-#if ROCBLASLT_TENSILE_LAZY_LOAD
-        auto& get_device_property(const std::string& deviceName) const
+        uint32_t get_library_generation() const
         {
-            return m_devicePropMap.at(deviceName);
+            return m_libraryGeneration.load(std::memory_order_acquire);
         }
-#else
-        auto&                            get_device_property() const
+        auto& get_device_property(int deviceId) const
         {
-            return m_deviceProp;
+            return m_deviceClasses.at(deviceId)->prop;
         }
-#endif
+
+        auto& get_hardware(int deviceId) const
+        {
+            return m_deviceClasses.at(deviceId)->hardware;
+        }
+
         auto& get_adapters() const
         {
             return m_adapters;
@@ -1519,6 +1725,9 @@ namespace
    *********************************************************************/
         void initialize(TensileLite::hip::SolutionAdapter& adapter, int32_t deviceId)
         {
+            auto const& debug = TensileLite::Debug::Instance();
+            debug.markerStart("TensileHost::initialize");
+
             std::string path;
 #ifndef WIN32
             path.reserve(PATH_MAX);
@@ -1527,6 +1736,8 @@ namespace
             // The name of the current GPU platform
             std::string processor = rocblaslt_internal_get_arch_name();
 
+            debug.markerStart("FindLibraryPath");
+
             const char* env = getenv("HIPBLASLT_TENSILE_LIBPATH");
             if(env)
             {
@@ -1557,10 +1768,12 @@ namespace
                 if(TestPath(path + "/" + processor))
                     path += "/" + processor;
             }
+            debug.markerStop();
 
             // only load modules for the current architecture
             auto dir = path + "/*" + processor + "*co";
 #if ROCBLASLT_TENSILE_LAZY_LOAD == 0
+            debug.markerStart("LoadCodeObjectFiles");
             bool no_match = false;
 #ifdef WIN32
             std::replace(dir.begin(), dir.end(), '/', '\\');
@@ -1614,6 +1827,7 @@ namespace
                           << ". Make sure that HIPBLASLT_TENSILE_LIBPATH is set correctly."
                           << std::endl;
             }
+            debug.markerStop();
 #endif
             // We initialize a local static variable with a lambda function call to
             // avoid race conditions when multiple threads with different device IDs try
@@ -1643,37 +1857,21 @@ namespace
                     // rocblaslt_abort();
                 }
 
+                debug.markerStart("LoadTensileLibrary", tensileLibPath);
 #if ROCBLASLT_TENSILE_LAZY_LOAD
-                // Get devices
-                hipDeviceProp_t prop;
-                int             count;
-                HIP_CHECK_EXC(hipGetDeviceCount(&count));
-                for(int devId = 0; devId < count; devId++)
-                {
-                    auto deviceArch = getLazyLoadingArch(devId);
-                    if(m_deviceSet.find(deviceArch) == m_deviceSet.end())
-                    {
-                        // populate the arch list for lazy loading
-                        m_deviceSet.insert(deviceArch);
-                        // populate device property map, used in finding solutions based on arch
-                        HIP_CHECK_EXC(hipGetDeviceProperties(&prop, devId));
-                        // strip out xnack/ecc from name
-                        std::string deviceFullString(prop.gcnArchName);
-                        std::string deviceString
-                            = deviceFullString.substr(0, deviceFullString.find(":"));
-                        m_devicePropMap[deviceString] = std::make_shared<hipDeviceProp_t>(prop);
-                    }
-                }
+                // populate the arch list for lazy loading
+                for(size_t devId = 0; devId < m_adapters.size(); devId++)
+                    m_deviceSet.insert(getLazyLoadingArch(devId));
+
+                // Load library, optionally loading the children of the device architectures
+                // in the background
+                std::vector<TensileLite::LazyLoadingInit> prefetch;
+                if(TensileLite::Debug::Instance().lazyPrefetchThreads() > 0)
+                    prefetch.assign(m_deviceSet.begin(), m_deviceSet.end());
 
-                // Load library
                 auto lib = TensileLite::LoadLibraryFilePreload<TensileLite::ContractionProblemGemm>(
-                    tensileLibPath, std::vector<TensileLite::LazyLoadingInit>{});
+                    tensileLibPath, std::vector<TensileLite::LazyLoadingInit>{}, prefetch);
 #else
-                // Get device prop
-                hipDeviceProp_t prop;
-                HIP_CHECK_EXC(hipGetDeviceProperties(&prop, deviceId));
-                m_deviceProp = std::make_shared<hipDeviceProp_t>(prop);
-
                 // Load library
                 auto lib = TensileLite::LoadLibraryFile<TensileLite::ContractionProblemGemm>(
                     tensileLibPath);
@@ -1687,7 +1885,15 @@ namespace
                         = TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>;
                     m_library        = std::dynamic_pointer_cast<MSL>(lib);
                     m_tensileLibPath = tensileLibPath;
+#if ROCBLASLT_TENSILE_LAZY_LOAD
+                    // Written offline by tensile_solution_index, lets lookups by solution
+                    // index load only the file of that solution
+                    if(m_library)
+                        m_library->solutionIndex = TensileLite::SolutionIndexFile::Open(
+                            path + "/TensileLibrary_lazy_" + processor + ".idx");
+#endif
                 }
+                debug.markerStop();
                 return 0;
             }();
 
@@ -1698,6 +1904,7 @@ namespace
                 std::cerr << "\nrocblaslt error: Could not initialize Tensile library" << std::endl;
                 // rocblaslt_abort();
             }
+            debug.markerStop();
         }
 
 #if ROCBLASLT_TENSILE_LAZY_LOAD
@@ -1705,15 +1912,27 @@ namespace
         // preload() shouldn't be called more than once.
         void preload()
         {
+            // Solutions are found through the index without loading every file
+            if(m_library && m_library->solutionIndex)
+                return;
+
             auto lib = TensileLite::LoadLibraryFilePreload<TensileLite::ContractionProblemGemm>(
                 m_tensileLibPath,
                 std::vector<TensileLite::LazyLoadingInit>{m_deviceSet.begin(), m_deviceSet.end()});
             using MSL = TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>;
             m_library = std::dynamic_pointer_cast<MSL>(lib);
+            m_libraryGeneration.fetch_add(1, std::memory_order_release);
         }
 #endif
     };
 
+    // TensileHost is initialized on the first call
+    TensileHost& get_tensile_host()
+    {
+        static TensileHost host;
+        return host;
+    }
+
     // Return the library and adapter for the current HIP device
     TensileLite::hip::SolutionAdapter* get_library_and_adapter(
         std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>*
@@ -1728,8 +1947,7 @@ namespace
     )
     try
     {
-        // TensileHost is initialized on the first call
-        static TensileHost host;
+        auto& host = get_tensile_host();
 
         if(device == -1)
             static_cast<void>(hipGetDevice(&device));
@@ -1772,11 +1990,7 @@ namespace
         if(library)
             *library = host.get_library();
         if(deviceProp)
-#if ROCBLASLT_TENSILE_LAZY_LOAD
-            *deviceProp = host.get_device_property(rocblaslt_internal_get_arch_name());
-#else
-            *deviceProp = host.get_device_property();
-#endif
+            *deviceProp = host.get_device_property(device);
 
         return adapter;
     }
@@ -1794,6 +2008,56 @@ namespace
         return nullptr;
     }
 
+    // Return the Hardware of a device, the same object for every device of its architecture
+    // and CU count. Only valid once get_library_and_adapter has succeeded
+    std::shared_ptr<TensileLite::Hardware> get_device_hardware(int device = -1)
+    {
+        if(device == -1)
+            static_cast<void>(hipGetDevice(&device));
+        return get_tensile_host().get_hardware(device);
+    }
+
+    // What get_library_and_adapter and get_device_hardware resolve for a device, copied once
+    // per thread. Launch paths read it instead, so that threads running on their own streams
+    // do not contend on the adapter table or on the reference counts of the shared objects.
+    struct TensileThreadState
+    {
+        TensileLite::hip::SolutionAdapter* adapter = nullptr;
+        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+                                               library;
+        std::shared_ptr<hipDeviceProp_t>       deviceProp;
+        std::shared_ptr<TensileLite::Hardware> hardware;
+        uint32_t                               generation = 0;
+    };
+
+    // Returns nullptr when the library could not be initialized for the device
+    TensileThreadState const* get_thread_state(int device = -1)
+    {
+        thread_local std::vector<TensileThreadState> states;
+
+        if(device == -1)
+            static_cast<void>(hipGetDevice(&device));
+        if(device < 0)
+            return nullptr;
+        if(size_t(device) >= states.size())
+            states.resize(device + 1);
+
+        auto&    state      = states[device];
+        uint32_t generation = get_tensile_host().get_library_generation();
+        if(!state.adapter || state.generation != generation)
+        {
+            state.adapter = get_library_and_adapter(&state.library, &state.deviceProp, device);
+            if(!state.adapter || !state.library)
+            {
+                state.adapter = nullptr;
+                return nullptr;
+            }
+            state.hardware   = get_device_hardware(device);
+            state.generation = generation;
+        }
+        return &state;
+    }
+
 #if 0
     /**************************************************************************
     * We normally print error messages only once, to avoid excessive logging *
@@ -1824,8 +2088,14 @@ struct TensileDataGemm
     TensileLite::ContractionInputs             inputs;
     std::vector<TensileLite::KernelInvocation> kernels;
     int                                        algoIndex = std::numeric_limits<int>::max();
+    // Solution of algoIndex, looked up when the kernels are first patched
+    std::shared_ptr<TensileLite::ContractionSolution> solution;
+    // roctx range of the launches, see launchRangeName()
+    std::string rangeName;
 };
 
+class TensileHostStagingRing;
+
 struct TensileDataGroupedGemm
 {
     bool                                       enableEpilogue = true;
@@ -1833,170 +2103,1579 @@ struct TensileDataGroupedGemm
     TensileLite::ContractionGroupedInputs      inputs;
     std::vector<TensileLite::KernelInvocation> kernels;
     int                                        algoIndex = std::numeric_limits<int>::max();
-    std::shared_ptr<void>                      hipHostMemory;
-    size_t                                     hipHostMemorySize;
     bool                                       useUserArgs = false;
+    // Upload slots of runKernelFromHostUserArguments(), created on first use
+    std::shared_ptr<TensileHostStagingRing> userArgsRing;
+    // Zero bias and unit scales of groups lifted by unifyGroupedEpilogues()
+    std::shared_ptr<void> epilogueConstants;
+    size_t                epilogueConstantsLength = 0;
+    // roctx range of the launches, see launchRangeName()
+    std::string rangeName;
 };
 
-TensileLite::ProblemOverride
-    RocblasltContractionProblem2ProblemOverride(const RocblasltContractionProblem& problem)
+/******************************************************************************
+ * TensileExecKey captures every RocblasltContractionProblem field that feeds *
+ * updateTensileProblem() and getSolutionByIndex(). Pointers only contribute  *
+ * through their null-ness, and alpha/beta through their value category, so   *
+ * two calls with equal keys resolve to the same problem and solution.        *
+ ******************************************************************************/
+struct TensileExecKey
 {
-    return TensileLite::ProblemOverride(problem.trans_a == HIPBLAS_OP_N ? false : true,
-                                        problem.trans_b == HIPBLAS_OP_N ? false : true,
-                                        hipDataType_to_tensile_type(problem.a_type),
-                                        roc2TensileType(problem.compute_type),
-                                        hipDataType_to_tensile_type(problem.c_type),
-                                        problem.m,
-                                        problem.n,
-                                        problem.k,
-                                        problem.batch_count);
-}
+    int                    device;
+    int                    algoIndex;
+    hipblasOperation_t     trans_a;
+    hipblasOperation_t     trans_b;
+    size_t                 m;
+    size_t                 n;
+    size_t                 k;
+    size_t                 batch_count;
+    size_t                 strides[15];
+    hipDataType            a_type;
+    hipDataType            b_type;
+    hipDataType            c_type;
+    hipDataType            d_type;
+    hipDataType            bias_type;
+    rocblaslt_compute_type compute_type;
+    rocblaslt_epilogue     epilogue;
+    size_t                 workspaceSize;
+    double                 alpha;
+    double                 beta;
+    uint32_t               flags;
+    uint32_t               cuBudget;
+
+    bool operator==(const TensileExecKey& rhs) const
+    {
+        return device == rhs.device && algoIndex == rhs.algoIndex && trans_a == rhs.trans_a
+               && trans_b == rhs.trans_b && m == rhs.m && n == rhs.n && k == rhs.k
+               && batch_count == rhs.batch_count
+               && std::equal(std::begin(strides), std::end(strides), std::begin(rhs.strides))
+               && a_type == rhs.a_type && b_type == rhs.b_type && c_type == rhs.c_type
+               && d_type == rhs.d_type && bias_type == rhs.bias_type
+               && compute_type == rhs.compute_type && epilogue == rhs.epilogue
+               && workspaceSize == rhs.workspaceSize && alpha == rhs.alpha && beta == rhs.beta
+               && flags == rhs.flags && cuBudget == rhs.cuBudget;
+    }
+};
 
-TensileLite::ProblemOverride TensileDataGemm2ProblemOverride(std::shared_ptr<void> gemmData)
+struct TensileExecKeyHash
 {
-    std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
-
-    return TensileLite::ProblemOverride(data->problem.transA(),
-                                        data->problem.transB(),
-                                        data->problem.a().dataType(),
-                                        data->problem.computeInputType(),
-                                        data->problem.c().dataType(),
-                                        data->problem.freeSizeA(0),
-                                        data->problem.freeSizeB(0),
-                                        data->problem.boundSize(0),
-                                        data->problem.batchSize(0));
-}
+    size_t operator()(const TensileExecKey& key) const
+    {
+        return TensileLite::hash_combine(
+            key.device,
+            key.algoIndex,
+            static_cast<int>(key.trans_a),
+            static_cast<int>(key.trans_b),
+            key.m,
+            key.n,
+            key.k,
+            key.batch_count,
+            TensileLite::hash_combine_iter(std::begin(key.strides), std::end(key.strides)),
+            static_cast<int>(key.a_type),
+            static_cast<int>(key.b_type),
+            static_cast<int>(key.c_type),
+            static_cast<int>(key.d_type),
+            static_cast<int>(key.compute_type),
+            static_cast<int>(key.epilogue),
+            key.workspaceSize,
+            key.flags,
+            key.cuBudget);
+    }
+};
 
-void initTensileGemmData(rocblaslt_handle       handle,
-                         rocblaslt::RocGemmType gemmType,
-                         hipblasOperation_t     opA,
-                         hipblasOperation_t     opB,
-                         hipDataType            typeA,
-                         hipDataType            typeB,
-                         hipDataType            typeC,
-                         hipDataType            typeD,
-                         rocblaslt_compute_type typeCompute,
-                         size_t                 maxWorkspaceBytes,
-                         std::shared_ptr<void>& gemmData)
+/******************************************************************************
+ * TensileSynchronizerPool owns the Synchronizer memory of GSU, StreamK and    *
+ * amax kernels of a handle. Buffers are allocated on first use per stream,  *
+ * as the kernels leave them zeroed and launches on one stream are ordered.   *
+ * The memset at allocation is the only one, steady-state launches skip it.   *
+ * Buffers of streams that hipStreamQuery no longer accepts are freed when a  *
+ * buffer is allocated, so destroyed streams don't pin device memory.         *
+ ******************************************************************************/
+class TensileSynchronizerPool
 {
-    float alpha = 1.0;
-    float beta  = 1.0;
-    if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+public:
+    ~TensileSynchronizerPool()
     {
-        TensileDataGemm data;
-        data.problem = CreateTensileProblem(opA,
-                                            opB,
-                                            typeA,
-                                            typeB,
-                                            typeC,
-                                            typeD,
-                                            typeCompute,
-                                            alpha,
-                                            beta,
-                                            false,
-                                            maxWorkspaceBytes);
-        gemmData     = std::static_pointer_cast<void>(std::make_shared<TensileDataGemm>(data));
-        return;
+        for(auto& buffer : m_buffers)
+            static_cast<void>(hipFree(buffer.second.ptr));
+        for(auto ptr : m_retired)
+            static_cast<void>(hipFree(ptr));
     }
-    else if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
+
+    void* acquire(hipStream_t stream, size_t bytes)
     {
-        TensileDataGroupedGemm                      data;
-        TensileLite::ContractionProblemGroupedGemm& tensile_probs = data.problem;
-        TensileLite::ContractionGroupedInputs&      groupedInputs = data.inputs;
+        std::lock_guard<std::mutex> lock(m_mutex);
 
-        tensile_probs.gemms.push_back(CreateTensileProblem(opA,
-                                                           opB,
-                                                           typeA,
-                                                           typeB,
-                                                           typeC,
-                                                           typeD,
-                                                           typeCompute,
-                                                           alpha,
-                                                           beta,
-                                                           true,
-                                                           maxWorkspaceBytes));
-        groupedInputs.grouped.resize(1);
+        auto it = m_buffers.find(stream);
+        if(it != m_buffers.end() && it->second.bytes >= bytes)
+            return it->second.ptr;
+
+        // hipFree waits for the device, so pending launches are done with the buffers
+        for(auto buffer = m_buffers.begin(); buffer != m_buffers.end();)
+        {
+            hipError_t err = buffer->first == stream ? hipSuccess : hipStreamQuery(buffer->first);
+            if(err == hipSuccess || err == hipErrorNotReady)
+            {
+                buffer++;
+                continue;
+            }
+            static_cast<void>(hipFree(buffer->second.ptr));
+            buffer = m_buffers.erase(buffer);
+        }
 
-        void* tmp = nullptr;
-        static_cast<void>(hipHostMalloc(&tmp, INTERNAL_HIPHOSTMEM_SIZE, 0));
-        data.hipHostMemory
-            = std::shared_ptr<void>(tmp, [](auto p) { static_cast<void>(hipFree(p)); });
-        data.hipHostMemorySize = INTERNAL_HIPHOSTMEM_SIZE;
+        void* ptr = nullptr;
+        if(hipMalloc(&ptr, bytes) != hipSuccess)
+            throw std::runtime_error("Synchronizer allocation failed");
+        if(hipMemsetAsync(ptr, 0, bytes, stream) != hipSuccess)
+        {
+            static_cast<void>(hipFree(ptr));
+            throw std::runtime_error("Synchronizer initialization failed");
+        }
 
-        gemmData = std::static_pointer_cast<void>(std::make_shared<TensileDataGroupedGemm>(data));
-        return;
+        // Outgrown buffers are kept, kernel arguments of makeArgument() may still point there
+        auto& buffer = m_buffers[stream];
+        if(buffer.ptr)
+            m_retired.push_back(buffer.ptr);
+        buffer.ptr   = ptr;
+        buffer.bytes = bytes;
+        return ptr;
     }
 
-    throw std::runtime_error("Gemm problem type initialization not implemented.");
-}
+private:
+    struct Buffer
+    {
+        void*  ptr   = nullptr;
+        size_t bytes = 0;
+    };
+
+    std::mutex                              m_mutex;
+    std::unordered_map<hipStream_t, Buffer> m_buffers;
+    std::vector<void*>                      m_retired;
+};
 
 /******************************************************************************
- * runContractionProblem calls Tensile to run a contraction problem described *
- * by RocblasltContractionProblem *
+ * TensileWorkspacePool backs the opt-in handle workspace with a HIP memory   *
+ * pool. Allocations are stream ordered and up to maxBytes stay cached in the *
+ * pool after release, so steady-state launches don't reach the driver.      *
  ******************************************************************************/
-rocblaslt_status runContractionProblem(rocblaslt_handle                   handle,
-                                       const rocblaslt_matmul_algo*       algo,
-                                       const RocblasltContractionProblem& prob,
-                                       std::shared_ptr<void>              gemmData)
+struct TensileWorkspacePool
 {
-    rocblaslt_status status = rocblaslt_status_internal_error;
-    try
+    TensileWorkspacePool(int device, size_t maxBytes)
+        : maxBytes(maxBytes)
     {
-        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                               library;
-        std::shared_ptr<hipDeviceProp_t>       deviceProp;
-        std::shared_ptr<TensileLite::Hardware> hardware;
+        hipMemPoolProps props = {};
+        props.allocType       = hipMemAllocationTypePinned;
+        props.handleTypes     = hipMemHandleTypeNone;
+        props.location.type   = hipMemLocationTypeDevice;
+        props.location.id     = device;
+        if(hipMemPoolCreate(&pool, &props) != hipSuccess)
+            throw std::runtime_error("Workspace pool creation failed");
+
+        uint64_t threshold = maxBytes;
+        static_cast<void>(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold));
+    }
 
-        auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
+    ~TensileWorkspacePool()
+    {
+        static_cast<void>(hipMemPoolDestroy(pool));
+    }
 
-        if(!library)
-        {
-            return rocblaslt_status_invalid_pointer;
-        }
+    void* allocate(size_t bytes, hipStream_t stream)
+    {
+        void* ptr = nullptr;
+        if(hipMallocFromPoolAsync(&ptr, bytes, pool, stream) != hipSuccess)
+            return nullptr;
+        return ptr;
+    }
 
-        hardware = TensileLite::hip::GetDevice(*deviceProp);
+    void release(void* ptr, hipStream_t stream)
+    {
+        static_cast<void>(hipFreeAsync(ptr, stream));
+    }
 
-        std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
-        rocblaslt_matmul_heuristic_result heuristicResult;
-        if(algo == nullptr)
-        {
-            int returnAlgoCount;
-            status = getBestSolutions(
-                prob, handle, gemmData, 1, &heuristicResult, &returnAlgoCount, prob.workspaceSize);
-            if(returnAlgoCount == 0)
-                return rocblaslt_status_not_implemented;
-            algo = &heuristicResult.algo;
-        }
-        updateTensileProblem(prob, data->problem);
+    const size_t maxBytes;
+    hipMemPool_t pool = nullptr;
+};
 
-        int* solutionIndex = (int*)algo->data;
-        data->algoIndex    = *solutionIndex;
-        data->inputs       = GetTensileInputs(prob);
-        if(get_logger_layer_mode() & rocblaslt_layer_mode_log_bench)
+/******************************************************************************
+ * TensilePriorityStream launches the kernels of a handle on a stream of the  *
+ * greatest priority of its device. The stream waits for the caller's stream *
+ * and the caller's stream waits for the launch through events, so work stays *
+ * ordered as on the caller's stream while the hardware queue of the priority *
+ * stream is scheduled ahead of the others.                                   *
+ ******************************************************************************/
+class TensilePriorityStream
+{
+public:
+    explicit TensilePriorityStream(int device)
+    {
+        int current = device;
+        static_cast<void>(hipGetDevice(&current));
+        static_cast<void>(hipSetDevice(device));
+
+        int        least = 0, greatest = 0;
+        hipError_t err = hipDeviceGetStreamPriorityRange(&least, &greatest);
+        if(err == hipSuccess)
+            err = hipStreamCreateWithPriority(&m_stream, hipStreamNonBlocking, greatest);
+        if(err == hipSuccess)
+            err = hipEventCreateWithFlags(&m_fork, hipEventDisableTiming);
+        if(err == hipSuccess)
+            err = hipEventCreateWithFlags(&m_join, hipEventDisableTiming);
+
+        static_cast<void>(hipSetDevice(current));
+        if(err != hipSuccess)
         {
-            logBenchFromTensileDataGemm(data->problem, data->inputs, data->algoIndex, false);
+            destroy();
+            throw std::runtime_error("Priority stream creation failed");
         }
+    }
 
-        if(get_logger_layer_mode() & rocblaslt_layer_mode_log_profile)
+    ~TensilePriorityStream()
+    {
+        destroy();
+    }
+
+    // Launch takes the stream to launch on and returns its hipError_t
+    template <typename Launch>
+    hipError_t launch(hipStream_t stream, Launch&& launchOn)
+    {
+        // The events are only read by the waits queued right after their records
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        hipError_t err = hipEventRecord(m_fork, stream);
+        if(err == hipSuccess)
+            err = hipStreamWaitEvent(m_stream, m_fork, 0);
+        if(err != hipSuccess)
+            return err;
+
+        hipError_t status = launchOn(m_stream);
+        err               = hipEventRecord(m_join, m_stream);
+        if(err == hipSuccess)
+            err = hipStreamWaitEvent(stream, m_join, 0);
+        return status != hipSuccess ? status : err;
+    }
+
+private:
+    void destroy()
+    {
+        if(m_join)
+            static_cast<void>(hipEventDestroy(m_join));
+        if(m_fork)
+            static_cast<void>(hipEventDestroy(m_fork));
+        // Work still queued on the stream completes after it is destroyed
+        if(m_stream)
+            static_cast<void>(hipStreamDestroy(m_stream));
+    }
+
+    std::mutex  m_mutex;
+    hipStream_t m_stream = nullptr;
+    hipEvent_t  m_fork   = nullptr;
+    hipEvent_t  m_join   = nullptr;
+};
+
+// Runs launchOn on the priority stream of the handle when it has one
+template <typename Launch>
+static hipError_t
+    launchOnHandleStream(rocblaslt_handle handle, hipStream_t stream, Launch&& launchOn)
+{
+    if(auto priority = std::static_pointer_cast<TensilePriorityStream>(handle->m_priorityStream))
+        return priority->launch(stream, launchOn);
+    return launchOn(stream);
+}
+
+/******************************************************************************
+ * hostSyncAllowed reports a host wait on the GPU when HIPBLASLT_NO_HOST_SYNC *
+ * is set, in which case the caller fails instead of waiting.                 *
+ ******************************************************************************/
+static bool hostSyncAllowed(const char* site)
+{
+    if(!rocblaslt::Debug::Instance().noHostSync())
+        return true;
+    log_error(site, "host synchronization with HIPBLASLT_NO_HOST_SYNC set");
+    std::cerr << "\nrocblaslt error: " << site
+              << " would synchronize the host, which HIPBLASLT_NO_HOST_SYNC forbids" << std::endl;
+    return false;
+}
+
+/******************************************************************************
+ * TensileHostStagingRing hands out pinned host slots for the grouped gemm    *
+ * kernel arguments, optionally paired with a device buffer of the same size. *
+ * A slot is reused only after the event recorded behind the work that reads *
+ * it has completed, so back to back calls never overwrite arguments that are *
+ * still being copied or consumed by a kernel.                                *
+ ******************************************************************************/
+class TensileHostStagingRing
+{
+public:
+    // Slots beyond this count wait for a busy one instead of growing
+    static constexpr size_t maxSlots = 8;
+
+    // Pinned slots allocated by all rings, to grow a ring or to resize a slot
+    inline static std::atomic<uint64_t> allocations{0};
+
+    struct Slot
+    {
+        void*  ptr       = nullptr;
+        void*  devicePtr = nullptr;
+        size_t bytes     = 0;
+        size_t index     = 0;
+    };
+
+    // The pinned slots are placed on the NUMA node closest to device
+    explicit TensileHostStagingRing(int device, bool withDevice = false)
+        : m_device(device)
+        , m_withDevice(withDevice)
+    {
+    }
+
+    ~TensileHostStagingRing()
+    {
+        for(auto& slot : m_slots)
         {
-            logProfileFromTensileDataGemm(data->problem, data->inputs, false);
+            if(slot.event)
+            {
+                static_cast<void>(hipEventSynchronize(slot.event));
+                static_cast<void>(hipEventDestroy(slot.event));
+            }
+            deallocate(slot);
         }
-        auto solution = library->getSolutionByIndex(data->problem, *hardware, *solutionIndex);
-        if(!solution)
+    }
+
+    Slot acquire(size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Prefer the smallest idle slot that fits
+        size_t best = m_slots.size();
+        for(size_t i = 0; i < m_slots.size(); i++)
+        {
+            auto& slot = m_slots[i];
+            if(slot.inUse || slot.bytes < bytes || !isIdle(slot))
+                continue;
+            if(best == m_slots.size() || slot.bytes < m_slots[best].bytes)
+                best = i;
+        }
+
+        if(best == m_slots.size())
+            best = m_slots.size() < maxSlots ? grow(bytes) : reclaim(bytes);
+
+        auto& slot = m_slots[best];
+        slot.inUse = true;
+        return {slot.ptr, slot.devicePtr, slot.bytes, best};
+    }
+
+    // Keeps the slot reserved until the work queued on stream so far has completed
+    void release(Slot const& handout, hipStream_t stream)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto& slot = m_slots[handout.index];
+        slot.inUse = false;
+        if(!slot.event
+           && hipEventCreateWithFlags(&slot.event, hipEventDisableTiming) != hipSuccess)
+            slot.event = nullptr;
+
+        // Without an event the copy has to finish before the slot is handed out again, or
+        // the slot stays reserved when the host may not wait for it
+        if(!slot.event || hipEventRecord(slot.event, stream) != hipSuccess)
+        {
+            if(!hostSyncAllowed(__func__))
+            {
+                slot.inUse = true;
+                throw std::runtime_error("Host staging slot needs a host synchronization");
+            }
+            static_cast<void>(hipStreamSynchronize(stream));
+        }
+    }
+
+    // Returns the slot without recording an event, for when nothing was queued
+    void cancel(Slot const& handout)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_slots[handout.index].inUse = false;
+    }
+
+private:
+    struct Entry
+    {
+        void*      ptr       = nullptr;
+        void*      devicePtr = nullptr;
+        size_t     bytes     = 0;
+        hipEvent_t event     = nullptr;
+        bool       inUse     = false;
+    };
+
+    static bool isIdle(Entry const& slot)
+    {
+        return !slot.event || hipEventQuery(slot.event) != hipErrorNotReady;
+    }
+
+    static size_t slotSize(size_t bytes)
+    {
+        size_t size = INTERNAL_HIPHOSTMEM_SIZE;
+        while(size < bytes)
+            size *= 2;
+        return size;
+    }
+
+    void allocate(Entry& slot, size_t bytes)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        slot.bytes = slotSize(bytes);
+        if(TensileLite::hip::HostMallocNearDevice(&slot.ptr, slot.bytes, m_device) != hipSuccess
+           || (m_withDevice && hipMalloc(&slot.devicePtr, slot.bytes) != hipSuccess))
+        {
+            deallocate(slot);
+            throw std::runtime_error("Host staging allocation failed");
+        }
+    }
+
+    static void deallocate(Entry& slot)
+    {
+        if(slot.ptr)
+            static_cast<void>(hipHostFree(slot.ptr));
+        if(slot.devicePtr)
+            static_cast<void>(hipFree(slot.devicePtr));
+        slot.ptr       = nullptr;
+        slot.devicePtr = nullptr;
+        slot.bytes     = 0;
+    }
+
+    size_t grow(size_t bytes)
+    {
+        Entry slot;
+        allocate(slot, bytes);
+        m_slots.push_back(slot);
+        return m_slots.size() - 1;
+    }
+
+    // Waits for the smallest free slot and resizes it when it's too small
+    size_t reclaim(size_t bytes)
+    {
+        size_t best = m_slots.size();
+        for(size_t i = 0; i < m_slots.size(); i++)
+        {
+            if(m_slots[i].inUse)
+                continue;
+            if(best == m_slots.size() || m_slots[i].bytes < m_slots[best].bytes)
+                best = i;
+        }
+        if(best == m_slots.size())
+            throw std::runtime_error("Host staging slots exhausted");
+
+        auto& slot = m_slots[best];
+        if(!isIdle(slot) && !hostSyncAllowed(__func__))
+            throw std::runtime_error("Host staging slots are busy");
+        if(slot.event)
+            static_cast<void>(hipEventSynchronize(slot.event));
+        if(slot.bytes < bytes)
+        {
+            deallocate(slot);
+            allocate(slot, bytes);
+        }
+        return best;
+    }
+
+    const int          m_device;
+    const bool         m_withDevice;
+    std::mutex         m_mutex;
+    std::vector<Entry> m_slots;
+};
+
+/******************************************************************************
+ * TensileExecEntry holds everything resolved for one TensileExecKey, plus the *
+ * kernel invocations built for the inputs of the most recent launch.         *
+ ******************************************************************************/
+struct TensileExecEntry
+{
+    TensileLite::hip::SolutionAdapter*                adapter = nullptr;
+    std::shared_ptr<TensileLite::Hardware>            hardware;
+    std::shared_ptr<TensileLite::ContractionSolution> solution;
+    TensileLite::ContractionProblemGemm               problem;
+    TensileLite::ContractionInputs                    inputs;
+    std::vector<TensileLite::KernelInvocation>        kernels;
+    // roctx range of the launches, see launchRangeName()
+    std::string rangeName;
+    // requiredWorkspaceSize() of the solution
+    size_t workspaceSize = 0;
+    // requiredSynchronizerSize() of the solution, see resolveSynchronizer()
+    size_t synchronizerSize = 0;
+    // Serializes rebuilding and launching the cached kernels
+    std::mutex mutex;
+};
+
+namespace
+{
+    // Sizes, operations and types of a problem
+    std::string gemmShapeName(const TensileLite::ContractionProblemGemm& problem)
+    {
+        std::ostringstream name;
+        name << "m=" << problem.c().sizes()[0] << " n=" << problem.c().sizes()[1]
+             << " k=" << problem.a().sizes()[problem.boundIndices()[0].a]
+             << " batch=" << problem.batchSize(0) << " op=" << (problem.transA() ? "T" : "N")
+             << (problem.transB() ? "T" : "N")
+             << " a=" << hipDataType_to_string(tensile2HipType(problem.a().dataType()))
+             << " b=" << hipDataType_to_string(tensile2HipType(problem.b().dataType()))
+             << " d=" << hipDataType_to_string(tensile2HipType(problem.d().dataType()))
+             << " compute=" << TensileLite::ToString(problem.computeType());
+        return name.str();
+    }
+
+    /*
+     * Name of the roctx range around the launches of a solved problem: the sizes, types,
+     * solution and split of the launch. It is formatted once when the kernels are solved,
+     * and only when markers are enabled, so launches don't allocate for it.
+     */
+    std::string launchRangeName(const TensileLite::ContractionProblemGemm& problem,
+                                const TensileLite::ContractionSolution&    solution,
+                                size_t                                     groups = 0)
+    {
+        if(!rocblaslt::Debug::markerEnabled())
+            return {};
+
+        size_t gsu = problem.getParams().gsu() ? problem.getParams().gsu()
+                                               : solution.sizeMapping.globalSplitU;
+        std::ostringstream name;
+        name << "hipblaslt gemm";
+        if(groups)
+            name << " groups=" << groups;
+        name << " " << gemmShapeName(problem) << " solution=" << solution.index << " gsu=" << gsu;
+        if(solution.sizeMapping.streamK)
+            name << " streamk=" << solution.sizeMapping.streamK;
+        return name.str();
+    }
+
+    /*
+     * FLOPs per clock of a CU for the matrix instructions of the compute input type, from
+     * the published peaks of the architectures. Other architectures get the FP32 FMA rate
+     * of a CU, so their efficiency reads high rather than low.
+     */
+    double flopsPerCUClock(const char* arch, const TensileLite::ContractionProblemGemm& problem)
+    {
+        using TensileLite::DataType;
+        struct Rate
+        {
+            const char* arch;
+            double      fp8, fp16, xf32, fp32, fp64;
+        };
+        static const Rate rates[] = {{"gfx90a", 1024, 1024, 256, 256, 256},
+                                     {"gfx94", 4096, 2048, 1024, 256, 256},
+                                     {"gfx950", 8192, 4096, 256, 256, 128},
+                                     {"gfx11", 512, 512, 256, 256, 8},
+                                     {"gfx12", 2048, 1024, 256, 256, 8}};
+
+        DataType input = problem.f32XdlMathOp() == DataType::XFloat32 ? DataType::XFloat32
+                                                                       : problem.computeInputType();
+        for(auto& rate : rates)
+        {
+            if(strncmp(arch, rate.arch, strlen(rate.arch)))
+                continue;
+            switch(input)
+            {
+            case DataType::Int8:
+            case DataType::Float8:
+            case DataType::BFloat8:
+            case DataType::Float8BFloat8:
+            case DataType::BFloat8Float8:
+                return rate.fp8;
+            case DataType::Half:
+            case DataType::BFloat16:
+                return rate.fp16;
+            case DataType::XFloat32:
+                return rate.xf32;
+            case DataType::Double:
+                return rate.fp64;
+            default:
+                return rate.fp32;
+            }
+        }
+        return 128;
+    }
+
+    /*
+     * HIPBLASLT_PROFILE_EFFICIENCY=N with the profile log layer times the kernels of every
+     * distinct problem N times on its first call, and compares the time to the roofline of
+     * the device: the peak FLOP rate of the compute type over the CUs and the DDR bandwidth
+     * of the memory bus. The problems furthest from their roofline are logged at exit.
+     */
+    class EfficiencyProfile
+    {
+    public:
+        static constexpr size_t worstLogged = 20;
+
+        static EfficiencyProfile& instance()
+        {
+            // The log stream is opened first, so it outlives the summary
+            static std::ostream*     os = get_logger_os();
+            static EfficiencyProfile profile(os);
+            return profile;
+        }
+
+        ~EfficiencyProfile()
+        {
+            if(!m_os || m_records.empty())
+                return;
+            std::sort(m_records.begin(), m_records.end(), [](auto& a, auto& b) {
+                return a.efficiency < b.efficiency;
+            });
+            *m_os << "hipblaslt efficiency: the " << std::min(worstLogged, m_records.size())
+                  << " furthest from the roofline of " << m_records.size() << " problems\n";
+            for(size_t i = 0; i < m_records.size() && i < worstLogged; i++)
+            {
+                auto& record = m_records[i];
+                *m_os << std::fixed << std::setprecision(1) << "  " << 100 * record.efficiency
+                      << "% of " << (record.memoryBound ? "memory" : "compute")
+                      << " bound, us=" << record.us << " TFLOP/s=" << record.tflops
+                      << " GB/s=" << record.gbps << " " << record.shape
+                      << " solution=" << record.solutionIndex << "\n";
+            }
+            m_os->flush();
+        }
+
+        void profile(const TensileLite::ContractionProblemGemm&         problem,
+                     const TensileLite::ContractionInputs&              inputs,
+                     const std::vector<TensileLite::KernelInvocation>& kernels,
+                     TensileLite::hip::SolutionAdapter&                 adapter,
+                     int                                                solutionIndex,
+                     int                                                device,
+                     hipStream_t                                        stream)
+        {
+            static const int runs = rocblaslt::Debug::Instance().profileEfficiency();
+            if(runs <= 0 || rocblaslt::Debug::Instance().noHostSync())
+                return;
+
+            std::string shape = gemmShapeName(problem);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(!m_seen.insert(shape + " solution=" + std::to_string(solutionIndex)).second)
+                    return;
+            }
+
+            // Relaunching in place would accumulate into D, and a capture can't be waited on
+            bool useC = !TensileLite::CompareValue(inputs.beta, 0.0);
+            hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+            if((useC && inputs.c == inputs.d)
+               || hipStreamIsCapturing(stream, &capture) != hipSuccess
+               || capture != hipStreamCaptureStatusNone)
+                return;
+
+            hipEvent_t start, stop;
+            if(hipEventCreate(&start) != hipSuccess)
+                return;
+            if(hipEventCreate(&stop) != hipSuccess)
+            {
+                static_cast<void>(hipEventDestroy(start));
+                return;
+            }
+            float ms = 0.0f;
+            bool  ok = hipEventRecord(start, stream) == hipSuccess;
+            for(int i = 0; ok && i < runs; i++)
+                ok = adapter.launchKernels(kernels, stream) == hipSuccess;
+            ok = ok && hipEventRecord(stop, stream) == hipSuccess
+                 && hipEventSynchronize(stop) == hipSuccess
+                 && hipEventElapsedTime(&ms, start, stop) == hipSuccess;
+            static_cast<void>(hipEventDestroy(start));
+            static_cast<void>(hipEventDestroy(stop));
+            if(!ok || ms <= 0.0f)
+                return;
+
+            auto const& prop = TensileLite::hip::GetDeviceProperties(device);
+            double peakFlops = prop.multiProcessorCount * (prop.clockRate * 1.0e3)
+                               * flopsPerCUClock(prop.gcnArchName, problem);
+            double peakBytes = 2.0 * (prop.memoryClockRate * 1.0e3) * (prop.memoryBusWidth / 8);
+
+            auto bytesOf = [](const TensileLite::TensorDescriptor& tensor) {
+                return double(tensor.totalLogicalElements() * tensor.elementBytes());
+            };
+            double flops = double(problem.flopCount());
+            double bytes = bytesOf(problem.a()) + bytesOf(problem.b()) + bytesOf(problem.d())
+                           + (useC ? bytesOf(problem.c()) : 0.0);
+            double seconds        = ms * 1.0e-3 / runs;
+            double computeSeconds = flops / peakFlops;
+            double memorySeconds  = peakBytes > 0 ? bytes / peakBytes : 0.0;
+
+            Record record;
+            record.shape         = std::move(shape);
+            record.solutionIndex = solutionIndex;
+            record.us            = seconds * 1.0e6;
+            record.tflops        = flops / seconds * 1.0e-12;
+            record.gbps          = bytes / seconds * 1.0e-9;
+            record.memoryBound   = memorySeconds > computeSeconds;
+            record.efficiency    = std::max(computeSeconds, memorySeconds) / seconds;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_records.push_back(std::move(record));
+        }
+
+    private:
+        struct Record
+        {
+            std::string shape;
+            int         solutionIndex;
+            double      us;
+            double      tflops;
+            double      gbps;
+            double      efficiency;
+            bool        memoryBound;
+        };
+
+        explicit EfficiencyProfile(std::ostream* os)
+            : m_os(os)
+        {
+        }
+
+        std::ostream*                   m_os;
+        std::mutex                      m_mutex;
+        std::unordered_set<std::string> m_seen;
+        std::vector<Record>             m_records;
+    };
+}
+
+/******************************************************************************
+ * TensileExecClock is a map bounded to maxEntries with CLOCK eviction, as in *
+ * TensileLite's CacheMap. A hit sets the reference bit of its entry and an   *
+ * insert into a full map evicts the first unreferenced entry after the hand. *
+ * Callers hold TensileExecCache::mutex.                                      *
+ ******************************************************************************/
+template <typename Value>
+struct TensileExecClock
+{
+    static constexpr size_t maxEntries = 1024;
+
+    uint64_t evictions = 0;
+
+    Value* find(const TensileExecKey& key)
+    {
+        auto it = map.find(key);
+        if(it == map.end())
+            return nullptr;
+        referenced[it->second.clock] = 1;
+        return &it->second.value;
+    }
+
+    void insert(const TensileExecKey& key, Value value)
+    {
+        auto it = map.find(key);
+        if(it != map.end())
+        {
+            it->second.value             = std::move(value);
+            referenced[it->second.clock] = 1;
+            return;
+        }
+
+        size_t clock = keys.size();
+        if(clock < maxEntries)
+        {
+            keys.push_back(key);
+            referenced.push_back(0);
+        }
+        else
+        {
+            clock       = evict();
+            keys[clock] = key;
+        }
+        map.emplace(key, Entry{std::move(value), clock});
+    }
+
+    void clear()
+    {
+        map.clear();
+        keys.clear();
+        referenced.clear();
+        hand = 0;
+    }
+
+    size_t size() const
+    {
+        return map.size();
+    }
+
+private:
+    struct Entry
+    {
+        Value  value;
+        size_t clock;
+    };
+
+    // Removes the entry under the hand, or the first unreferenced one after it, and
+    // returns its clock slot
+    size_t evict()
+    {
+        while(referenced[hand])
+        {
+            referenced[hand] = 0;
+            hand             = (hand + 1) % keys.size();
+        }
+
+        size_t victim = hand;
+        hand          = (hand + 1) % keys.size();
+        map.erase(keys[victim]);
+        evictions++;
+        return victim;
+    }
+
+    std::unordered_map<TensileExecKey, Entry, TensileExecKeyHash> map;
+    std::vector<TensileExecKey>                                   keys;
+    std::vector<uint8_t>                                          referenced;
+    size_t                                                        hand = 0;
+};
+
+namespace
+{
+    // Bumped by invalidateTensileHeuristics(), the heuristic results of a cache are only
+    // valid for the generation they were stored under
+    std::atomic<uint64_t> tuningGeneration{0};
+}
+
+struct TensileExecCache
+{
+    std::mutex                                          mutex;
+    TensileExecClock<std::shared_ptr<TensileExecEntry>> entries;
+    // Top heuristic result for calls made without an algo, keyed with algoIndex -1
+    TensileExecClock<rocblaslt_matmul_algo> heuristics;
+    uint64_t                                heuristicsGeneration = 0;
+    // Lookups of both maps, kept across clear()
+    uint64_t hits   = 0;
+    uint64_t misses = 0;
+
+    std::shared_ptr<TensileExecEntry> find(const TensileExecKey& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto*                       entry = entries.find(key);
+        (entry ? hits : misses)++;
+        return entry ? *entry : nullptr;
+    }
+
+    void insert(const TensileExecKey& key, std::shared_ptr<TensileExecEntry> entry)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.insert(key, std::move(entry));
+    }
+
+    bool findHeuristic(const TensileExecKey& key, uint64_t generation, rocblaslt_matmul_algo& algo)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(generation != heuristicsGeneration)
+        {
+            heuristics.clear();
+            heuristicsGeneration = generation;
+        }
+        auto* cached = heuristics.find(key);
+        if(!cached)
+        {
+            misses++;
+            return false;
+        }
+        hits++;
+        algo = *cached;
+        return true;
+    }
+
+    // Results of a superseded generation are dropped
+    void insertHeuristic(const TensileExecKey&        key,
+                         uint64_t                     generation,
+                         const rocblaslt_matmul_algo& algo)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(generation == heuristicsGeneration)
+            heuristics.insert(key, algo);
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        heuristics.clear();
+    }
+};
+
+namespace
+{
+    // CUs enabled in the CU mask of stream, 0 if it has none. Masks are fixed at stream
+    // creation, so each stream is queried once.
+    uint32_t streamCUCount(hipStream_t stream)
+    {
+        static std::mutex                                mutex;
+        static std::unordered_map<hipStream_t, uint32_t> counts;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = counts.find(stream);
+        if(it != counts.end())
+            return it->second;
+
+        uint32_t count = 0;
+        uint32_t mask[32];
+        if(stream && hipExtStreamGetCUMask(stream, std::size(mask), mask) == hipSuccess)
+            for(auto word : mask)
+                count += std::bitset<32>(word).count();
+        return counts[stream] = count;
+    }
+
+    // The tighter of the CU budget of the problem and the CU mask of its stream, 0 if neither
+    uint32_t effectiveCUBudget(const RocblasltContractionProblem& prob)
+    {
+        uint32_t streamCUs = streamCUCount(prob.stream);
+        if(!prob.cuBudget || !streamCUs)
+            return prob.cuBudget ? prob.cuBudget : streamCUs;
+        return std::min(prob.cuBudget, streamCUs);
+    }
+
+    TensileExecKey makeTensileExecKey(int                                device,
+                                      int                                algoIndex,
+                                      const RocblasltContractionProblem& prob,
+                                      uint32_t                           cuBudget)
+    {
+        TensileExecKey key;
+        key.device        = device;
+        key.algoIndex     = algoIndex;
+        key.trans_a       = prob.trans_a;
+        key.trans_b       = prob.trans_b;
+        key.m             = prob.m;
+        key.n             = prob.n;
+        key.k             = prob.k;
+        key.batch_count   = prob.batch_count;
+        key.strides[0]    = prob.row_stride_a;
+        key.strides[1]    = prob.col_stride_a;
+        key.strides[2]    = prob.batch_stride_a;
+        key.strides[3]    = prob.row_stride_b;
+        key.strides[4]    = prob.col_stride_b;
+        key.strides[5]    = prob.batch_stride_b;
+        key.strides[6]    = prob.row_stride_c;
+        key.strides[7]    = prob.col_stride_c;
+        key.strides[8]    = prob.batch_stride_c;
+        key.strides[9]    = prob.row_stride_d;
+        key.strides[10]   = prob.col_stride_d;
+        key.strides[11]   = prob.batch_stride_d;
+        key.strides[12]   = prob.row_stride_e;
+        key.strides[13]   = prob.col_stride_e;
+        key.strides[14]   = prob.batch_stride_e;
+        key.a_type        = prob.a_type;
+        key.b_type        = prob.b_type;
+        key.c_type        = prob.c_type;
+        key.d_type        = prob.d_type;
+        key.bias_type     = prob.bias_type;
+        key.compute_type  = prob.compute_type;
+        key.epilogue      = prob.epilogue;
+        key.workspaceSize = prob.workspaceSize;
+
+        // Only the scalar restriction of alpha and beta is part of the problem
+        double alpha = 0, beta = 0;
+        assignAlphaBeta(roc2TensileType(prob.compute_type), prob.alpha, prob.beta, &alpha, &beta);
+        key.alpha = prob.k ? value_category(alpha) : 0.0;
+        key.beta  = value_category(beta);
+
+        key.flags = (prob.bias != nullptr) | (prob.scaleA != nullptr) << 1
+                    | (prob.scaleB != nullptr) << 2 | (prob.scaleC != nullptr) << 3
+                    | (prob.scaleD != nullptr) << 4 | (prob.scaleAlphaVec != nullptr) << 5
+                    | (prob.amaxD != nullptr) << 6 | prob.isScaleAVec << 7
+                    | prob.isScaleBVec << 8 | prob.gradient << 9 | prob.strided_batch << 10
+                    | cAliasesD(prob) << 11 | prob.deterministicReduction << 12
+                    | prob.sparseA << 13 | prob.cachePolicyD << 14 | prob.cachePolicyB << 16
+                    | (prob.scaleE != nullptr) << 18 | (prob.batch_A != nullptr) << 19
+                    | (prob.batch_B != nullptr) << 20 | (prob.batch_C != nullptr) << 21
+                    | (prob.batch_D != nullptr) << 22;
+        key.cuBudget = cuBudget;
+        return key;
+    }
+
+    // Returns true if the kernel arguments built from lhs are also valid for rhs
+    bool sameTensileInputs(const TensileLite::ContractionInputs& lhs,
+                           const TensileLite::ContractionInputs& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c && lhs.d == rhs.d
+               && lhs.e == rhs.e && lhs.amaxD == rhs.amaxD && lhs.batchA == rhs.batchA
+               && lhs.batchB == rhs.batchB && lhs.batchC == rhs.batchC
+               && lhs.batchD == rhs.batchD && lhs.batchBias == rhs.batchBias
+               && lhs.bias == rhs.bias && lhs.scaleA == rhs.scaleA && lhs.scaleB == rhs.scaleB
+               && lhs.scaleC == rhs.scaleC && lhs.scaleD == rhs.scaleD
+               && lhs.scaleAlphaVec == rhs.scaleAlphaVec && lhs.alpha == rhs.alpha
+               && lhs.beta == rhs.beta && lhs.activationArgs == rhs.activationArgs
+               && lhs.ws == rhs.ws && lhs.Synchronizer == rhs.Synchronizer
+               && lhs.metadata == rhs.metadata;
+    }
+
+    // Points inputs at the pooled Synchronizer of the handle and stream when the
+    // solution needs one and the caller did not provide it
+    void resolveSynchronizer(const TensileExecEntry&         entry,
+                             TensileLite::ContractionInputs& inputs,
+                             rocblaslt_handle                handle,
+                             hipStream_t                     stream)
+    {
+        if(inputs.Synchronizer || !entry.synchronizerSize)
+            return;
+
+        // Not cached on the entry, the pool frees the buffers of destroyed streams
+        auto pool = std::static_pointer_cast<TensileSynchronizerPool>(handle->m_synchronizerPool);
+        inputs.Synchronizer = pool->acquire(stream, entry.synchronizerSize);
+    }
+} // namespace
+
+TensileLite::ProblemOverride
+    RocblasltContractionProblem2ProblemOverride(const RocblasltContractionProblem& problem)
+{
+    return TensileLite::ProblemOverride(problem.trans_a == HIPBLAS_OP_N ? false : true,
+                                        problem.trans_b == HIPBLAS_OP_N ? false : true,
+                                        hipDataType_to_tensile_type(problem.a_type),
+                                        roc2TensileType(problem.compute_type),
+                                        hipDataType_to_tensile_type(problem.c_type),
+                                        problem.m,
+                                        problem.n,
+                                        problem.k,
+                                        problem.batch_count);
+}
+
+TensileLite::ProblemOverride TensileDataGemm2ProblemOverride(std::shared_ptr<void> gemmData)
+{
+    std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
+
+    return TensileLite::ProblemOverride(data->problem.transA(),
+                                        data->problem.transB(),
+                                        data->problem.a().dataType(),
+                                        data->problem.computeInputType(),
+                                        data->problem.c().dataType(),
+                                        data->problem.freeSizeA(0),
+                                        data->problem.freeSizeB(0),
+                                        data->problem.boundSize(0),
+                                        data->problem.batchSize(0));
+}
+
+void initTensileGemmData(rocblaslt_handle       handle,
+                         rocblaslt::RocGemmType gemmType,
+                         hipblasOperation_t     opA,
+                         hipblasOperation_t     opB,
+                         hipDataType            typeA,
+                         hipDataType            typeB,
+                         hipDataType            typeC,
+                         hipDataType            typeD,
+                         rocblaslt_compute_type typeCompute,
+                         size_t                 maxWorkspaceBytes,
+                         std::shared_ptr<void>& gemmData)
+{
+    float alpha = 1.0;
+    float beta  = 1.0;
+    if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+    {
+        TensileDataGemm data;
+        data.problem = CreateTensileProblem(opA,
+                                            opB,
+                                            typeA,
+                                            typeB,
+                                            typeC,
+                                            typeD,
+                                            typeCompute,
+                                            alpha,
+                                            beta,
+                                            false,
+                                            maxWorkspaceBytes);
+        gemmData     = std::static_pointer_cast<void>(std::make_shared<TensileDataGemm>(data));
+        return;
+    }
+    else if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
+    {
+        TensileDataGroupedGemm                      data;
+        TensileLite::ContractionProblemGroupedGemm& tensile_probs = data.problem;
+        TensileLite::ContractionGroupedInputs&      groupedInputs = data.inputs;
+
+        tensile_probs.gemms.push_back(CreateTensileProblem(opA,
+                                                           opB,
+                                                           typeA,
+                                                           typeB,
+                                                           typeC,
+                                                           typeD,
+                                                           typeCompute,
+                                                           alpha,
+                                                           beta,
+                                                           true,
+                                                           maxWorkspaceBytes));
+        groupedInputs.grouped.resize(1);
+
+        gemmData = std::static_pointer_cast<void>(std::make_shared<TensileDataGroupedGemm>(data));
+        return;
+    }
+
+    throw std::runtime_error("Gemm problem type initialization not implemented.");
+}
+
+namespace
+{
+    // A line of a preload manifest, "<code object file> <kernel name>"; '#' starts a comment
+    struct PreloadManifestEntry
+    {
+        std::string codeObjectFile;
+        std::string kernelName;
+    };
+
+    // Kernels listed in HIPBLASLT_PRELOAD_MANIFEST, read once
+    std::vector<PreloadManifestEntry> const& preloadManifest()
+    {
+        static const std::vector<PreloadManifestEntry> entries = [] {
+            std::vector<PreloadManifestEntry> rv;
+
+            auto path = rocblaslt::Debug::Instance().preloadManifest();
+            if(path.empty())
+                return rv;
+
+            std::ifstream in(path);
+            if(!in.is_open())
+            {
+                std::cerr << "\nrocblaslt warning: Cannot read preload manifest " << path
+                          << std::endl;
+                return rv;
+            }
+
+            std::string line;
+            while(std::getline(in, line))
+            {
+                std::istringstream   fields(line.substr(0, line.find('#')));
+                PreloadManifestEntry entry;
+                if(fields >> entry.codeObjectFile >> entry.kernelName)
+                    rv.push_back(std::move(entry));
+            }
+            return rv;
+        }();
+
+        return entries;
+    }
+
+    // Appends the kernels that are not recorded yet to HIPBLASLT_PRELOAD_MANIFEST_RECORD,
+    // the file can be passed as HIPBLASLT_PRELOAD_MANIFEST to a later run
+    void recordPreloadManifest(std::vector<TensileLite::KernelInvocation> const& kernels)
+    {
+        static const std::string path = rocblaslt::Debug::Instance().preloadManifestRecord();
+        if(path.empty())
+            return;
+
+        static std::mutex            mutex;
+        static std::set<std::string> recorded;
+        std::lock_guard<std::mutex>  lock(mutex);
+
+        std::ofstream out;
+        for(auto const& kernel : kernels)
+        {
+            if(kernel.codeObjectFile.empty())
+                continue;
+
+            std::string line = kernel.codeObjectFile + " " + kernel.kernelName;
+            if(!recorded.insert(line).second)
+                continue;
+
+            if(!out.is_open())
+                out.open(path, std::ios::out | std::ios::app);
+            out << line << '\n';
+        }
+    }
+} // namespace
+
+void initTensilePreloadManifest(rocblaslt_handle handle)
+{
+    auto const& manifest = preloadManifest();
+    if(manifest.empty())
+        return;
+
+    // Initializes the library before the statics below, so that they are destroyed, and
+    // the loads joined, before the adapters
+    auto adapter = get_library_and_adapter(nullptr, nullptr, handle->device);
+    if(!adapter)
+        return;
+
+    static std::mutex                     mutex;
+    static std::set<int>                  started;
+    static std::vector<std::future<void>> pending;
+    std::lock_guard<std::mutex>           lock(mutex);
+
+    if(!started.insert(handle->device).second)
+        return;
+
+    int device = handle->device;
+    pending.push_back(std::async(std::launch::async, [adapter, device, &manifest]() {
+        // Modules are loaded into the current device of the loading thread
+        if(hipSetDevice(device) != hipSuccess)
+            return;
+
+        for(auto const& entry : manifest)
+        {
+            static_cast<void>(adapter->FindCodeObject(entry.codeObjectFile));
+            static_cast<void>(adapter->initKernel(entry.kernelName));
+        }
+    }));
+}
+
+void initTensileExecCache(rocblaslt_handle handle)
+{
+    handle->m_execCache = std::static_pointer_cast<void>(std::make_shared<TensileExecCache>());
+}
+
+void initTensileSynchronizerPool(rocblaslt_handle handle)
+{
+    handle->m_synchronizerPool
+        = std::static_pointer_cast<void>(std::make_shared<TensileSynchronizerPool>());
+}
+
+void initTensileHostStagingRing(rocblaslt_handle handle)
+{
+    handle->m_hostStagingRing
+        = std::static_pointer_cast<void>(std::make_shared<TensileHostStagingRing>(handle->device));
+}
+
+void clearTensileExecCache(rocblaslt_handle handle)
+{
+    if(auto execCache = std::static_pointer_cast<TensileExecCache>(handle->m_execCache))
+        execCache->clear();
+}
+
+void setTensileWorkspacePool(rocblaslt_handle handle, size_t maxBytes)
+{
+    handle->m_workspacePool
+        = maxBytes ? std::static_pointer_cast<void>(
+              std::make_shared<TensileWorkspacePool>(handle->device, maxBytes))
+                   : nullptr;
+}
+
+void invalidateTensileHeuristics()
+{
+    tuningGeneration++;
+}
+
+void setTensileReproducible(rocblaslt_handle handle, bool enable)
+{
+    handle->reproducible = enable;
+    // Resolved executions may split k with atomics
+    clearTensileExecCache(handle);
+}
+
+void setTensilePriorityStream(rocblaslt_handle handle, bool enable)
+{
+    handle->m_priorityStream
+        = enable ? std::static_pointer_cast<void>(
+              std::make_shared<TensilePriorityStream>(handle->device))
+                 : nullptr;
+    // The heuristic ranks solutions by the stream they launch on
+    clearTensileExecCache(handle);
+}
+
+rocblaslt_status getTensileSolutionCacheStats(rocblaslt_handle                handle,
+                                              rocblaslt_solution_cache_stats* stats)
+{
+    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+        library;
+    static_cast<void>(get_library_and_adapter(&library, nullptr, handle->device));
+    if(!library)
+        return rocblaslt_status_invalid_pointer;
+
+    auto cache = std::dynamic_pointer_cast<
+        TensileLite::CachingLibrary<TensileLite::ContractionProblemGemm>>(library->library);
+    if(!cache)
+        return rocblaslt_status_not_implemented;
+
+    auto cacheStats  = cache->cacheStats();
+    stats->hits      = cacheStats.hits;
+    stats->misses    = cacheStats.misses;
+    stats->evictions = cacheStats.evictions;
+    stats->size      = cacheStats.size;
+    stats->capacity  = cacheStats.capacity;
+    return rocblaslt_status_success;
+}
+
+rocblaslt_status getTensileStatistics(rocblaslt_handle handle, rocblaslt_statistics* stats)
+{
+    *stats = {};
+
+    if(auto execCache = std::static_pointer_cast<TensileExecCache>(handle->m_execCache))
+    {
+        std::lock_guard<std::mutex> lock(execCache->mutex);
+        stats->handleCacheHits   = execCache->hits;
+        stats->handleCacheMisses = execCache->misses;
+    }
+
+    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+        library;
+    auto adapter = get_library_and_adapter(&library, nullptr, handle->device);
+    if(!library)
+        return rocblaslt_status_invalid_pointer;
+
+    if(auto cache = std::dynamic_pointer_cast<
+           TensileLite::CachingLibrary<TensileLite::ContractionProblemGemm>>(library->library))
+    {
+        auto cacheStats           = cache->cacheStats();
+        stats->libraryCacheHits   = cacheStats.hits;
+        stats->libraryCacheMisses = cacheStats.misses;
+    }
+    if(adapter)
+    {
+        auto adapterStats        = adapter->stats();
+        stats->codeObjectsLoaded = adapterStats.codeObjectsLoaded;
+        stats->kernelsResolved   = adapterStats.kernelsResolved;
+    }
+
+    using TensileLite::Predicates::Contraction::WorkspaceCheck;
+    auto& shared             = TensileLite::SharedSelectionCache::Instance();
+    stats->sharedCacheHits   = shared.hits();
+    stats->sharedCacheMisses = shared.misses();
+    stats->lazyLibraryLoads  = TensileLite::LazyLibraryLoads().load(std::memory_order_relaxed);
+    stats->stagingReallocations
+        = TensileHostStagingRing::allocations.load(std::memory_order_relaxed);
+    stats->workspaceShortfalls = WorkspaceCheck::Shortfalls().load(std::memory_order_relaxed);
+    return rocblaslt_status_success;
+}
+
+namespace
+{
+    // Candidates fetched per requested algo when a preference may drop or reorder them
+    constexpr int preferenceCandidateFactor = 4;
+
+    bool hasRankingPreference(const rocblaslt::RocGemmPreference& pref)
+    {
+        return pref.preferNoWorkspace || pref.maxCUOccupancy < 1.0f || pref.deterministicReduction
+               || pref.preferPersistent || pref.preferNonPersistent
+               || pref.cachePolicyB != rocblaslt_cache_policy_default
+               || pref.cachePolicyD != rocblaslt_cache_policy_default;
+    }
+
+    // What a matmul desc with ROCBLASLT_MATMUL_DESC_DETERMINISTIC_REDUCTION asks for
+    rocblaslt::RocGemmPreference deterministicPreference()
+    {
+        rocblaslt::RocGemmPreference pref;
+        pref.deterministicReduction = true;
+        return pref;
+    }
+
+    bool isPersistentSolution(const TensileLite::ContractionSolution& solution)
+    {
+        return solution.sizeMapping.streamK != 0 || solution.sizeMapping.persistentKernel != 0;
+    }
+
+    bool meetsPreference(const TensileLite::ContractionSolution&    solution,
+                         const TensileLite::ContractionProblemGemm& problem,
+                         const TensileLite::Hardware&               hardware,
+                         const rocblaslt::RocGemmPreference&        pref)
+    {
+        auto const& sizeMapping = solution.sizeMapping;
+
+        // Atomic accumulation of split-K partials depends on the arrival order
+        if(pref.deterministicReduction)
+        {
+            if(sizeMapping.streamK != 0 && sizeMapping.streamKAtomic != 0)
+                return false;
+            if(sizeMapping.streamK == 0 && sizeMapping.globalSplitU > 1
+               && sizeMapping.globalAccumulation == 0)
+                return false;
+        }
+
+        // Persistent grids hold their CUs until the whole problem is done, unlike regular
+        // grids that hand CUs back to other streams workgroup by workgroup
+        if(pref.maxCUOccupancy < 1.0f && isPersistentSolution(solution))
+        {
+            auto pAMDGPU = dynamic_cast<const TensileLite::AMDGPU*>(&hardware);
+            if(pAMDGPU && pAMDGPU->computeUnitCount > 0)
+            {
+                size_t grid = pAMDGPU->computeUnitCount;
+                if(sizeMapping.streamK != 0)
+                {
+                    size_t mt0   = sizeMapping.macroTile.x;
+                    size_t mt1   = sizeMapping.macroTile.y;
+                    size_t tiles = TensileLite::CeilDivide(problem.freeSizeA(0), mt0)
+                                   * TensileLite::CeilDivide(problem.freeSizeB(0), mt1);
+                    for(size_t i = 0; i < problem.batchIndices().size(); i++)
+                        tiles *= problem.batchSize(i);
+                    grid = solution.getSKGrid(problem, hardware, tiles);
+                }
+                if(grid > pref.maxCUOccupancy * pAMDGPU->computeUnitCount)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Whether a reproducible handle may run the solution, whose reductions must have an order
+    // that the problem fixes. gsu is the split that tuning asks for, 0 if none.
+    bool reducesReproducibly(const TensileLite::ContractionSolution&    solution,
+                             const TensileLite::ContractionProblemGemm& problem,
+                             const TensileLite::Hardware&               hardware,
+                             int                                        gsu)
+    {
+        if(!meetsPreference(solution, problem, hardware, deterministicPreference()))
+            return false;
+
+        // A tuned split of a kernel that accumulates in place reduces with atomics
+        auto const& sizeMapping = solution.sizeMapping;
+        return gsu <= 1 || sizeMapping.streamK != 0 || sizeMapping.globalAccumulation != 0;
+    }
+
+    void applyPreference(std::vector<std::shared_ptr<TensileLite::ContractionSolution>>& solutions,
+                         const TensileLite::ContractionProblemGemm&                      problem,
+                         const TensileLite::Hardware&                                    hardware,
+                         const rocblaslt::RocGemmPreference&                             pref)
+    {
+        solutions.erase(std::remove_if(solutions.begin(),
+                                       solutions.end(),
+                                       [&](auto const& solution) {
+                                           return !meetsPreference(
+                                               *solution, problem, hardware, pref);
+                                       }),
+                        solutions.end());
+
+        // The last partition is the primary key: no workspace ranks above persistence, which
+        // ranks above the cache hints that only move traffic between the caches
+        if(pref.cachePolicyB != rocblaslt_cache_policy_default
+           || pref.cachePolicyD != rocblaslt_cache_policy_default)
+            std::stable_partition(solutions.begin(), solutions.end(), [&](auto const& solution) {
+                return (pref.cachePolicyB == rocblaslt_cache_policy_default
+                        || solution->sizeMapping.temporalHintB == pref.cachePolicyB)
+                       && (pref.cachePolicyD == rocblaslt_cache_policy_default
+                           || solution->sizeMapping.temporalHintD == pref.cachePolicyD);
+            });
+        if(pref.preferPersistent || pref.preferNonPersistent)
+            std::stable_partition(solutions.begin(), solutions.end(), [&](auto const& solution) {
+                return isPersistentSolution(*solution) == pref.preferPersistent;
+            });
+        if(pref.preferNoWorkspace)
+            std::stable_partition(solutions.begin(), solutions.end(), [&](auto const& solution) {
+                return solution->requiredWorkspaceSize(problem, hardware) == 0;
+            });
+    }
+} // namespace
+
+/******************************************************************************
+ * runContractionProblem calls Tensile to run a contraction problem described *
+ * by RocblasltContractionProblem *
+ ******************************************************************************/
+rocblaslt_status runContractionProblem(rocblaslt_handle                   handle,
+                                       const rocblaslt_matmul_algo*       algo,
+                                       const RocblasltContractionProblem& callerProb,
+                                       std::shared_ptr<void>              gemmData)
+{
+    rocblaslt_status status = rocblaslt_status_internal_error;
+    try
+    {
+        // With the workspace pool enabled the solution may use up to the pool limit, and
+        // gets pooled memory when the caller's workspace is too small
+        auto workspacePool
+            = std::static_pointer_cast<TensileWorkspacePool>(handle->m_workspacePool);
+        if(workspacePool && callerProb.workspaceSize >= workspacePool->maxBytes)
+            workspacePool = nullptr;
+
+        std::optional<RocblasltContractionProblem> pooledProb;
+        if(workspacePool)
+        {
+            pooledProb.emplace(callerProb);
+            pooledProb->workspaceSize = workspacePool->maxBytes;
+        }
+        const RocblasltContractionProblem& prob = pooledProb ? *pooledProb : callerProb;
+
+        std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
+        auto execCache = std::static_pointer_cast<TensileExecCache>(handle->m_execCache);
+        uint32_t                          cuBudget = effectiveCUBudget(prob);
+        rocblaslt_matmul_heuristic_result heuristicResult;
+        if(algo == nullptr)
+        {
+            CallTiming::Scope heuristicTiming(CallTiming::Heuristic);
+            // Only the first call of a problem signature pays for the heuristic
+            TensileExecKey heuristicKey;
+            uint64_t       generation = tuningGeneration.load();
+            if(execCache)
+                heuristicKey = makeTensileExecKey(handle->device, -1, prob, cuBudget);
+            if(!execCache
+               || !execCache->findHeuristic(heuristicKey, generation, heuristicResult.algo))
+            {
+                int returnAlgoCount;
+                status = getBestSolutions(prob,
+                                          handle,
+                                          gemmData,
+                                          1,
+                                          &heuristicResult,
+                                          &returnAlgoCount,
+                                          prob.workspaceSize);
+                if(returnAlgoCount == 0)
+                    return rocblaslt_status_not_implemented;
+                if(execCache)
+                    execCache->insertHeuristic(heuristicKey, generation, heuristicResult.algo);
+            }
+            algo = &heuristicResult.algo;
+        }
+
+        int* solutionIndex = (int*)algo->data;
+        data->algoIndex    = *solutionIndex;
+
+        // Look up the resolved execution of this problem shape on the handle
+        CallTiming::Scope                 solveTiming(CallTiming::Solve);
+        std::shared_ptr<TensileExecEntry> entry;
+        TensileExecKey                    key;
+        if(execCache)
+        {
+            key   = makeTensileExecKey(handle->device, *solutionIndex, prob, cuBudget);
+            entry = execCache->find(key);
+        }
+
+        if(!entry)
         {
+            std::shared_ptr<
+                TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+                                             library;
+            std::shared_ptr<hipDeviceProp_t> deviceProp;
+
+            auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
+
+            if(!library)
+            {
+                return rocblaslt_status_invalid_pointer;
+            }
+
+            auto hardware = get_device_hardware(handle->device);
+
+            updateTensileProblem(prob, data->problem);
+
+            auto solution = library->getSolutionByIndex(data->problem, *hardware, *solutionIndex);
+            if(!solution)
+            {
 #if 0
-            std::ostream msg;
-            print_once(msg << "\nrocblaslt error: No Tensile solution found for " << prob);
+                std::ostream msg;
+                print_once(msg << "\nrocblaslt error: No Tensile solution found for " << prob);
 #endif
-            status = rocblaslt_status_not_implemented;
-        }
-        else
-        {
-            auto kernels = solution->solve(data->problem, GetTensileInputs(prob), *hardware);
+                return rocblaslt_status_not_implemented;
+            }
+            bool deterministic = prob.deterministicReduction || handle->reproducible;
+            if(deterministic
+               && !meetsPreference(*solution, data->problem, *hardware, deterministicPreference()))
+            {
+                log_error(__func__, "The algo does not reduce split-k partials deterministically");
+                return rocblaslt_status_invalid_value;
+            }
+
+            entry           = std::make_shared<TensileExecEntry>();
+            entry->adapter  = adapter;
+            entry->hardware = hardware;
+            entry->solution = solution;
+            entry->problem  = data->problem;
+            entry->inputs   = GetTensileInputs(prob);
+            entry->problem.setParams().setCUBudget(cuBudget);
+
+            // Atomic split-k is not deterministic, workspace and Synchronizer reductions are
+            if(rocblaslt::Debug::Instance().autoSplitK()
+               && !(deterministic && solution->sizeMapping.globalAccumulation == 0))
+            {
+                if(auto gsu = solution->autoGSU(entry->problem, *hardware))
+                    entry->problem.setParams().setGSU(gsu);
+            }
+
+            // A tuned wgm of the problem wins over the chosen one
+            if(rocblaslt::Debug::Instance().autoWGM() && entry->problem.getParams().wgm() == 0)
+            {
+                if(auto wgm = solution->autoWGM(entry->problem, *hardware))
+                    entry->problem.setParams().setWgm(wgm);
+            }
+
+            entry->workspaceSize    = solution->requiredWorkspaceSize(entry->problem, *hardware);
+            entry->synchronizerSize = solution->requiredSynchronizerSize(entry->problem);
+            resolveSynchronizer(*entry, entry->inputs, handle, prob.stream);
+            entry->kernels = solution->solve(entry->problem, entry->inputs, *hardware);
+            recordPreloadManifest(entry->kernels);
+            entry->rangeName = launchRangeName(entry->problem, *solution);
+
             // Remove this after supports getting comgr buffers from hip.
-            bool isPreloaded = false;
             if(rocblaslt::Debug::Instance().preload())
             {
+                auto& kernels = entry->kernels;
                 for(size_t i = 0; i < kernels.size(); i++)
                 {
                     if(!kernels[i].codeObjectFile.empty())
@@ -2022,11 +3701,82 @@ rocblaslt_status runContractionProblem(rocblaslt_handle                   handle
                         }
                     }
                 }
-                isPreloaded = true;
             }
-            status = hip2RocStatus(
-                adapter->launchKernels(kernels, prob.stream, nullptr, nullptr, isPreloaded));
+
+            if(execCache)
+                execCache->insert(key, entry);
+        }
+
+        std::lock_guard<std::mutex> lock(entry->mutex);
+
+        // A hit skips updateTensileProblem, so data->problem still describes the previous call
+        data->problem = entry->problem;
+        data->inputs  = GetTensileInputs(prob);
+        resolveSynchronizer(*entry, data->inputs, handle, prob.stream);
+
+        void* pooledWorkspace = nullptr;
+        if(workspacePool && entry->workspaceSize > callerProb.workspaceSize)
+        {
+            pooledWorkspace = workspacePool->allocate(entry->workspaceSize, prob.stream);
+            if(!pooledWorkspace)
+                return rocblaslt_status_memory_error;
+            data->inputs.ws = pooledWorkspace;
+        }
+        if(get_logger_layer_mode() & rocblaslt_layer_mode_log_bench)
+        {
+            logBenchFromTensileDataGemm(
+                entry->problem, data->inputs, data->algoIndex, false, prob.stream);
+        }
+
+        if(get_logger_layer_mode() & rocblaslt_layer_mode_log_profile)
+        {
+            logProfileFromTensileDataGemm(entry->problem, data->inputs, false);
+        }
+
+        captureFromTensileDataGemm(entry->problem, data->inputs, data->algoIndex, false);
+        if(TensileLite::DebugInstrumentation)
+            TensileLite::Debug::Instance().printPhaseProfile("first matmul");
+
+        // The cached kernels can be relaunched as-is when none of the pointers or
+        // scalars changed, otherwise their argument layout is patched in place.
+        // Stochastic rounding draws a new seed on every solve.
+        if(!sameTensileInputs(entry->inputs, data->inputs)
+           || entry->solution->problemType.stochasticRounding)
+        {
+            bool patched = entry->inputs.activationArgs == data->inputs.activationArgs
+                           && entry->solution->patchKernelArguments(
+                               entry->kernels, entry->problem, data->inputs);
+            entry->inputs = data->inputs;
+            if(!patched)
+                entry->kernels
+                    = entry->solution->solve(entry->problem, entry->inputs, *entry->hardware);
+        }
+
+        solveTiming.stop();
+        {
+            CallTiming::Scope       launchTiming(CallTiming::Launch);
+            CallTiming::DeviceScope deviceTiming(prob.stream);
+            rocblaslt::Debug::markerStart(entry->rangeName.c_str());
+            status = hip2RocStatus(launchOnHandleStream(handle, prob.stream, [&](hipStream_t s) {
+                return entry->adapter->launchKernels(entry->kernels, s);
+            }));
+            rocblaslt::Debug::markerStop();
+        }
+        if(status == rocblaslt_status_success
+           && (get_logger_layer_mode() & rocblaslt_layer_mode_log_profile))
+        {
+            EfficiencyProfile::instance().profile(entry->problem,
+                                                  data->inputs,
+                                                  entry->kernels,
+                                                  *entry->adapter,
+                                                  data->algoIndex,
+                                                  handle->device,
+                                                  prob.stream);
         }
+
+        // Returned to the pool once the kernels on the stream are done with it
+        if(pooledWorkspace)
+            workspacePool->release(pooledWorkspace, prob.stream);
     }
     catch(const std::exception& e)
     {
@@ -2105,6 +3855,118 @@ rocblaslt_status gemmCreate(RocblasltContractionProblem const& problem,
     return status;
 }
 
+/******************************************************************************
+ * unifyGroupedEpilogues lets one launch cover groups with different         *
+ * epilogues. Solutions are selected and launched with a single problem      *
+ * type, so groups without bias get a zero bias and groups without scaleA/B  *
+ * get unit scales, and all groups use the runtime activation kernel with    *
+ * their own activation type, None being a plain store. Groups must agree on *
+ * aux output, gradient and the bias type and source.                        *
+ ******************************************************************************/
+rocblaslt_status unifyGroupedEpilogues(TensileDataGroupedGemm& data)
+{
+    auto& gemms  = data.problem.gemms;
+    auto& inputs = data.inputs.grouped;
+
+    const TensileLite::ContractionProblemGemm* biasRef   = nullptr;
+    const TensileLite::ContractionProblemGemm* scaleRef  = nullptr;
+    bool                                       mixedBias = false, mixedScale = false;
+    bool                                       mixedAct = false;
+    size_t                                     length   = 1;
+    for(auto& gemm : gemms)
+    {
+        if(gemm.useE() != gemms[0].useE() || gemm.useGradient() != gemms[0].useGradient())
+        {
+            log_error(__func__, "grouped gemm groups differ in aux or gradient epilogue");
+            return rocblaslt_status_not_implemented;
+        }
+        if(gemm.useBias())
+        {
+            if(biasRef
+               && (gemm.bias().dataType() != biasRef->bias().dataType()
+                   || gemm.biasSrc() != biasRef->biasSrc()))
+            {
+                log_error(__func__, "grouped gemm groups differ in bias type or source");
+                return rocblaslt_status_not_implemented;
+            }
+            biasRef = biasRef ? biasRef : &gemm;
+        }
+        if(!gemm.useScaleAB().empty())
+        {
+            if(scaleRef && gemm.useScaleAB() != scaleRef->useScaleAB())
+            {
+                log_error(__func__, "grouped gemm groups mix scalar and vector scaleA/B");
+                return rocblaslt_status_not_implemented;
+            }
+            scaleRef = scaleRef ? scaleRef : &gemm;
+        }
+        mixedBias |= gemm.useBias() != gemms[0].useBias();
+        mixedScale |= gemm.useScaleAB() != gemms[0].useScaleAB();
+        mixedAct |= gemm.activationType() != gemms[0].activationType();
+        length = std::max({length, gemm.d().sizes()[0], gemm.d().sizes()[1]});
+    }
+    if(!mixedBias && !mixedScale && !mixedAct)
+        return rocblaslt_status_success;
+
+    if(scaleRef
+       && scaleRef->tensor(TensileLite::ContractionProblemGemm::TENSOR::SCALEA).dataType()
+              != TensileLite::DataType::Float)
+    {
+        log_error(__func__, "unit scales of grouped gemm are only available for float");
+        return rocblaslt_status_not_implemented;
+    }
+
+    // {length} zero bias elements followed by {length} float ones
+    if((mixedBias || mixedScale) && data.epilogueConstantsLength < length)
+    {
+        if(!hostSyncAllowed(__func__))
+            return rocblaslt_status_not_implemented;
+
+        const size_t       biasBytes = length * sizeof(double);
+        std::vector<float> host(biasBytes / sizeof(float) + length, 0.f);
+        std::fill(host.begin() + biasBytes / sizeof(float), host.end(), 1.f);
+
+        void* ptr = nullptr;
+        if(hipMalloc(&ptr, host.size() * sizeof(float)) != hipSuccess)
+            return rocblaslt_status_memory_error;
+        data.epilogueConstants       = std::shared_ptr<void>(ptr, [](void* p) {
+            static_cast<void>(hipFree(p));
+        });
+        data.epilogueConstantsLength = length;
+        if(hipMemcpy(ptr, host.data(), host.size() * sizeof(float), hipMemcpyHostToDevice)
+           != hipSuccess)
+            return rocblaslt_status_internal_error;
+    }
+    auto zeros = static_cast<const uint8_t*>(data.epilogueConstants.get());
+    auto ones  = zeros + data.epilogueConstantsLength * sizeof(double);
+
+    for(size_t i = 0; i < gemms.size(); i++)
+    {
+        auto& gemm = gemms[i];
+        if(mixedBias && !gemm.useBias())
+        {
+            auto biasSrc = biasRef->biasSrc();
+            auto biasLength
+                = gemm.d().sizes()[biasSrc == TensileLite::ContractionProblemGemm::TENSOR::B];
+            gemm.setUseBias(biasRef->useBias());
+            gemm.setBias(biasRef->bias().dataType(), biasLength, 0, false, biasSrc);
+            inputs[i].bias = zeros;
+        }
+        if(mixedScale && gemm.useScaleAB().empty())
+        {
+            gemm.setUseScaleAB(scaleRef->useScaleAB());
+            gemm.setScaleA(TensileLite::DataType::Float, 1);
+            gemm.setScaleB(TensileLite::DataType::Float, 1);
+            inputs[i].scaleA = ones;
+            inputs[i].scaleB = ones;
+        }
+        // The activation enum of the group is kept, so None stays a plain store
+        if(mixedAct)
+            gemm.setActivationType(TensileLite::ActivationType::Hipblaslt_all);
+    }
+    return rocblaslt_status_success;
+}
+
 rocblaslt_status groupedGemmCreate(std::vector<RocblasltContractionProblem>& probs,
                                    std::shared_ptr<void>&                    gemmData,
                                    size_t&                                   gemmCount)
@@ -2115,71 +3977,49 @@ rocblaslt_status groupedGemmCreate(std::vector<RocblasltContractionProblem>& pro
     rocblaslt_status status = rocblaslt_status_internal_error;
     try
     {
+        // The problems of an earlier call are updated in place, only the groups past its count
+        // are constructed, so re-setting the sizes every step does not rebuild the descriptors
+        std::shared_ptr<TensileDataGroupedGemm> data
+            = gemmData ? std::static_pointer_cast<TensileDataGroupedGemm>(gemmData)
+                       : std::make_shared<TensileDataGroupedGemm>();
+        TensileLite::ContractionProblemGroupedGemm& tensile_probs = data->problem;
+        TensileLite::ContractionGroupedInputs&      groupedInputs = data->inputs;
+
+        groupedInputs.grouped.clear();
+        groupedInputs.grouped.reserve(probs.size());
+        if(tensile_probs.gemms.size() > probs.size())
+            tensile_probs.gemms.erase(tensile_probs.gemms.begin() + probs.size(),
+                                      tensile_probs.gemms.end());
+        tensile_probs.gemms.reserve(probs.size());
+
         bool enableEpilogue = false;
-        if(gemmData)
+        for(int i = 0; i < probs.size(); i++)
         {
-            // Need to check if is same type?
-            std::shared_ptr<TensileDataGroupedGemm> data
-                = std::static_pointer_cast<TensileDataGroupedGemm>(gemmData);
-            TensileLite::ContractionProblemGroupedGemm& tensile_probs = data->problem;
-            TensileLite::ContractionGroupedInputs&      groupedInputs = data->inputs;
-
-            groupedInputs.grouped.clear();
-            if(tensile_probs.gemms.size() != probs.size())
-                tensile_probs.gemms.clear();
-
-            for(int i = 0; i < probs.size(); i++)
+            // Check if pointer is valid for n != 0
+            if(probs[i].n)
             {
-                // Check if pointer is valid for n != 0
-                if(probs[i].n)
+                if(probs[i].alpha == nullptr || probs[i].beta == nullptr || probs[i].A == nullptr
+                   || probs[i].B == nullptr || probs[i].C == nullptr || probs[i].D == nullptr)
                 {
-                    if(probs[i].alpha == nullptr || probs[i].beta == nullptr
-                       || probs[i].A == nullptr || probs[i].B == nullptr || probs[i].C == nullptr
-                       || probs[i].D == nullptr)
-                    {
-                        log_error(__func__, "invalid data pointer");
-                        return rocblaslt_status_invalid_pointer;
-                    }
+                    log_error(__func__, "invalid data pointer");
+                    return rocblaslt_status_invalid_pointer;
                 }
-                if(tensile_probs.gemms.size() != probs.size())
-                    tensile_probs.gemms.push_back(ConstructTensileProblem(probs[i]));
-                else
-                    updateTensileProblem(probs[i], tensile_probs.gemms[i]);
-                groupedInputs.grouped.push_back(GetTensileInputs(probs[i]));
-                if(probs[i].epilogue != ROCBLASLT_EPILOGUE_DEFAULT)
-                    enableEpilogue = true;
             }
-            data->enableEpilogue = enableEpilogue;
-        }
-        else
-        {
-            TensileDataGroupedGemm                      data;
-            TensileLite::ContractionProblemGroupedGemm& tensile_probs = data.problem;
-            TensileLite::ContractionGroupedInputs&      groupedInputs = data.inputs;
-
-            for(int i = 0; i < probs.size(); i++)
-            {
-                // Check if pointer is valid for n != 0
-                if(probs[i].n)
-                {
-                    if(probs[i].alpha == nullptr || probs[i].beta == nullptr
-                       || probs[i].A == nullptr || probs[i].B == nullptr || probs[i].C == nullptr
-                       || probs[i].D == nullptr)
-                    {
-                        log_error(__func__, "invalid data pointer");
-                        return rocblaslt_status_invalid_pointer;
-                    }
-                }
+            if(i < tensile_probs.gemms.size())
+                updateTensileProblem(probs[i], tensile_probs.gemms[i]);
+            else
                 tensile_probs.gemms.push_back(ConstructTensileProblem(probs[i]));
-                groupedInputs.grouped.push_back(GetTensileInputs(probs[i]));
-                if(probs[i].epilogue != ROCBLASLT_EPILOGUE_DEFAULT)
-                    enableEpilogue = true;
-            }
-            data.enableEpilogue = enableEpilogue;
-
-            gemmData
-                = std::static_pointer_cast<void>(std::make_shared<TensileDataGroupedGemm>(data));
+            groupedInputs.grouped.push_back(GetTensileInputs(probs[i]));
+            if(probs[i].epilogue != ROCBLASLT_EPILOGUE_DEFAULT)
+                enableEpilogue = true;
         }
+        data->enableEpilogue = enableEpilogue;
+        status               = unifyGroupedEpilogues(*data);
+        if(status != rocblaslt_status_success)
+            return status;
+
+        if(!gemmData)
+            gemmData = std::static_pointer_cast<void>(data);
         status = rocblaslt_status_success;
     }
     catch(const std::exception& e)
@@ -2215,19 +4055,14 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
     rocblaslt_status status = rocblaslt_status_internal_error;
     try
     {
-        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                               library;
-        std::shared_ptr<hipDeviceProp_t>       deviceProp;
-        std::shared_ptr<TensileLite::Hardware> hardware;
-
-        auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-
-        if(!library)
+        auto state = get_thread_state(handle->device);
+        if(!state)
         {
             return rocblaslt_status_invalid_pointer;
         }
 
-        hardware = TensileLite::hip::GetDevice(*deviceProp);
+        auto& library  = state->library;
+        auto& hardware = state->hardware;
 
         int* solutionIndex = (int*)algo.data;
         if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
@@ -2242,6 +4077,8 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
             {
                 data->problem.setParams().setGSU(tuning->gsu);
                 data->problem.setParams().setWgm(tuning->wgm);
+                data->problem.setParams().setStreamK(tuning->streamK);
+                data->problem.setParams().setSKGridFraction(tuning->skGridFraction);
                 std::stringstream ss;
                 if(!solution->checkInternalArgumentsSupport(data->problem, ss, true))
                 {
@@ -2255,9 +4092,21 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
                 data->problem.setParams().resetInternalArgs();
             }
 
+            data->problem.setParams().setCUBudget(streamCUCount(stream));
+
             data->inputs.ws = workspace;
+            if(!handle->Synchronizer)
+            {
+                size_t synchronizerSize = solution->requiredSynchronizerSize(data->problem);
+                auto   pool             = std::static_pointer_cast<TensileSynchronizerPool>(
+                    handle->m_synchronizerPool);
+                data->inputs.Synchronizer
+                    = synchronizerSize ? pool->acquire(stream, synchronizerSize) : nullptr;
+            }
 
             data->kernels = solution->solve(data->problem, data->inputs, *hardware);
+            recordPreloadManifest(data->kernels);
+            data->rangeName = launchRangeName(data->problem, *solution);
         }
         else if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
         {
@@ -2272,6 +4121,8 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
             {
                 data->problem.gemms[0].setParams().setGSU(tuning->gsu);
                 data->problem.gemms[0].setParams().setWgm(tuning->wgm);
+                data->problem.gemms[0].setParams().setStreamK(tuning->streamK);
+                data->problem.gemms[0].setParams().setSKGridFraction(tuning->skGridFraction);
                 std::stringstream ss;
                 if(!solution->checkInternalArgumentsSupport(data->problem.gemms[0], ss, true))
                 {
@@ -2283,6 +4134,9 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
                 {
                     data->problem.gemms[i].setParams().setGSU(tuning->gsu);
                     data->problem.gemms[i].setParams().setWgm(tuning->wgm);
+                    data->problem.gemms[i].setParams().setStreamK(tuning->streamK);
+                    data->problem.gemms[i].setParams().setSKGridFraction(
+                        tuning->skGridFraction);
                 }
             }
             else
@@ -2293,13 +4147,27 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
                 }
             }
 
+            void* synchronizer = handle->Synchronizer;
+            if(!synchronizer)
+            {
+                size_t synchronizerSize
+                    = solution->requiredSynchronizerSize(data->problem.gemms[0]);
+                if(synchronizerSize)
+                    synchronizer = std::static_pointer_cast<TensileSynchronizerPool>(
+                                       handle->m_synchronizerPool)
+                                       ->acquire(stream, synchronizerSize);
+            }
+
             for(int i = 0; i < data->inputs.grouped.size(); i++)
             {
-                data->inputs.grouped[i].ws = workspace;
+                data->inputs.grouped[i].ws           = workspace;
+                data->inputs.grouped[i].Synchronizer = synchronizer;
             }
             data->inputs.ws = workspace;
 
             data->useUserArgs = useUserArgs;
+            data->rangeName
+                = launchRangeName(data->problem.gemms[0], *solution, data->problem.gemms.size());
             if(useUserArgs)
             {
                 data->kernels = solution->solveGroupedGemmGPU(
@@ -2308,23 +4176,26 @@ rocblaslt_status makeArgument(rocblaslt_handle             handle,
             else
             {
                 size_t requiedHostSize
-                    = solution->requiredHostWorkspaceSizePerProblem * data->problem.gemms.size();
-                if(requiedHostSize > data->hipHostMemorySize)
+                    = *solution->requiredHostWorkspaceSizePerProblem * data->problem.gemms.size();
+
+                // The arguments are staged in a pinned slot that stays reserved until the
+                // copy queued on the stream has consumed it
+                auto ring
+                    = std::static_pointer_cast<TensileHostStagingRing>(handle->m_hostStagingRing);
+                auto slot = ring->acquire(requiedHostSize);
+                try
                 {
-                    void* tmp = nullptr;
-                    static_cast<void>(hipHostMalloc(&tmp, requiedHostSize, 0));
-                    data->hipHostMemory
-                        = std::shared_ptr<void>(tmp, [](auto p) { static_cast<void>(hipFree(p)); });
-                    data->hipHostMemorySize = requiedHostSize;
+                    data->kernels = solution->solveGroupedGemm(
+                        data->problem.gemms, data->inputs, *hardware, slot.ptr, slot.bytes, stream);
                 }
-
-                data->kernels = solution->solveGroupedGemm(data->problem.gemms,
-                                                           data->inputs,
-                                                           *hardware,
-                                                           data->hipHostMemory.get(),
-                                                           data->hipHostMemorySize,
-                                                           stream);
+                catch(...)
+                {
+                    ring->cancel(slot);
+                    throw;
+                }
+                ring->release(slot, stream);
             }
+            recordPreloadManifest(data->kernels);
         }
         status = rocblaslt_status_success;
     }
@@ -2358,31 +4229,47 @@ rocblaslt_status runKernelFromInvocation(rocblaslt_handle       handle,
     rocblaslt_status status = rocblaslt_status_internal_error;
     try
     {
-        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                               library;
-        std::shared_ptr<hipDeviceProp_t>       deviceProp;
-        std::shared_ptr<TensileLite::Hardware> hardware;
-
-        auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-
-        if(!library)
+        auto state = get_thread_state(handle->device);
+        if(!state)
         {
             return rocblaslt_status_invalid_pointer;
         }
 
+        auto adapter = state->adapter;
+
         if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
         {
             std::shared_ptr<TensileDataGemm> data
                 = std::static_pointer_cast<TensileDataGemm>(gemmData);
             if(get_logger_layer_mode() & rocblaslt_layer_mode_log_bench)
             {
-                logBenchFromTensileDataGemm(data->problem, data->inputs, data->algoIndex, true);
+                logBenchFromTensileDataGemm(
+                    data->problem, data->inputs, data->algoIndex, true, stream);
             }
             if(get_logger_layer_mode() & rocblaslt_layer_mode_log_profile)
             {
                 logProfileFromTensileDataGemm(data->problem, data->inputs, true);
             }
-            status = hip2RocStatus(adapter->launchKernels(data->kernels, stream, start, stop));
+            captureFromTensileDataGemm(data->problem, data->inputs, data->algoIndex, true);
+            if(TensileLite::DebugInstrumentation)
+                TensileLite::Debug::Instance().printPhaseProfile("first matmul");
+            rocblaslt::Debug::markerStart(data->rangeName.c_str());
+            status = hip2RocStatus(launchOnHandleStream(handle, stream, [&](hipStream_t s) {
+                return start || stop ? adapter->launchKernels(data->kernels, s, start, stop)
+                                     : adapter->launchKernels(data->kernels, s);
+            }));
+            rocblaslt::Debug::markerStop();
+            if(status == rocblaslt_status_success
+               && (get_logger_layer_mode() & rocblaslt_layer_mode_log_profile))
+            {
+                EfficiencyProfile::instance().profile(data->problem,
+                                                      data->inputs,
+                                                      data->kernels,
+                                                      *adapter,
+                                                      data->algoIndex,
+                                                      handle->device,
+                                                      stream);
+            }
         }
         else if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
         {
@@ -2396,14 +4283,20 @@ rocblaslt_status runKernelFromInvocation(rocblaslt_handle       handle,
             }
             if(get_logger_layer_mode() & rocblaslt_layer_mode_log_bench)
             {
-                logBenchFromTensileDataGemm(data->problem, data->inputs, data->algoIndex, true);
+                logBenchFromTensileDataGemm(
+                    data->problem, data->inputs, data->algoIndex, true, stream);
             }
             //TODO: add profile logging for grouped gemm
             /*if(get_logger_layer_mode() & rocblaslt_layer_mode_log_profile)
             {
                 logProfileFromTensileDataGemm(data->problem, data->inputs, true);
             }*/
-            status = hip2RocStatus(adapter->launchKernels(data->kernels, stream, start, stop));
+            rocblaslt::Debug::markerStart(data->rangeName.c_str());
+            status = hip2RocStatus(launchOnHandleStream(handle, stream, [&](hipStream_t s) {
+                return start || stop ? adapter->launchKernels(data->kernels, s, start, stop)
+                                     : adapter->launchKernels(data->kernels, s);
+            }));
+            rocblaslt::Debug::markerStop();
         }
         else
         {
@@ -2430,6 +4323,225 @@ rocblaslt_status runKernelFromInvocation(rocblaslt_handle       handle,
     return status;
 }
 
+rocblaslt_status runKernelsFromInvocations(const std::vector<rocblaslt_handle>&       handles,
+                                           const std::vector<rocblaslt::RocGemmType>& gemmTypes,
+                                           const std::vector<void*>&                  gemmData,
+                                           hipStream_t                                stream)
+{
+    rocblaslt_status status = rocblaslt_status_internal_error;
+    try
+    {
+        if(handles.empty())
+            return rocblaslt_status_success;
+
+        auto state = get_thread_state(handles[0]->device);
+        if(!state)
+            return rocblaslt_status_invalid_pointer;
+        auto adapter = state->adapter;
+
+        // Nothing is launched unless every gemm can be
+        std::vector<std::vector<TensileLite::KernelInvocation> const*> kernels(gemmData.size());
+        for(size_t i = 0; i < gemmData.size(); i++)
+        {
+            if(handles[i]->device != handles[0]->device)
+                return rocblaslt_status_invalid_value;
+            if(gemmTypes[i] == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+            {
+                kernels[i] = &static_cast<TensileDataGemm*>(gemmData[i])->kernels;
+            }
+            else if(gemmTypes[i] == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
+            {
+                auto data = static_cast<TensileDataGroupedGemm*>(gemmData[i]);
+                if(data->useUserArgs)
+                {
+                    log_error(__func__,
+                              "GG is initialized with useUserArgs = true, workspace has no "
+                              "arguments.");
+                    return rocblaslt_status_invalid_value;
+                }
+                kernels[i] = &data->kernels;
+            }
+            else
+            {
+                return rocblaslt_status_invalid_value;
+            }
+            if(kernels[i]->empty())
+                return rocblaslt_status_invalid_value;
+        }
+
+        const bool logBench   = get_logger_layer_mode() & rocblaslt_layer_mode_log_bench;
+        const bool logProfile = get_logger_layer_mode() & rocblaslt_layer_mode_log_profile;
+        for(size_t i = 0; i < gemmData.size(); i++)
+        {
+            if(gemmTypes[i] == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+            {
+                auto data = static_cast<TensileDataGemm*>(gemmData[i]);
+                if(logBench)
+                    logBenchFromTensileDataGemm(
+                        data->problem, data->inputs, data->algoIndex, true, stream);
+                if(logProfile)
+                    logProfileFromTensileDataGemm(data->problem, data->inputs, true);
+                captureFromTensileDataGemm(data->problem, data->inputs, data->algoIndex, true);
+            }
+            else if(logBench)
+            {
+                auto data = static_cast<TensileDataGroupedGemm*>(gemmData[i]);
+                logBenchFromTensileDataGemm(
+                    data->problem, data->inputs, data->algoIndex, true, stream);
+            }
+
+            const std::string& rangeName
+                = gemmTypes[i] == rocblaslt::RocGemmType::ROCBLASLT_GEMM
+                      ? static_cast<TensileDataGemm*>(gemmData[i])->rangeName
+                      : static_cast<TensileDataGroupedGemm*>(gemmData[i])->rangeName;
+            rocblaslt::Debug::markerStart(rangeName.c_str());
+            status = hip2RocStatus(launchOnHandleStream(handles[i], stream, [&](hipStream_t s) {
+                return adapter->launchKernels(*kernels[i], s);
+            }));
+            rocblaslt::Debug::markerStop();
+            if(status != rocblaslt_status_success)
+                break;
+        }
+    }
+    catch(...)
+    {
+    }
+
+    return status;
+}
+
+rocblaslt_status addKernelGraphNode(rocblaslt_handle       handle,
+                                    rocblaslt::RocGemmType gemmType,
+                                    std::shared_ptr<void>  gemmData,
+                                    hipGraph_t             graph,
+                                    const hipGraphNode_t*  dependencies,
+                                    size_t                 numDependencies,
+                                    hipGraphNode_t*        node)
+{
+    rocblaslt_status status = rocblaslt_status_internal_error;
+    try
+    {
+        // Grouped gemms read their arguments from the workspace, which is filled on the host
+        if(gemmType != rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+            return rocblaslt_status_not_implemented;
+
+        auto state = get_thread_state(handle->device);
+        if(!state)
+            return rocblaslt_status_invalid_pointer;
+        auto adapter = state->adapter;
+
+        std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
+        if(data->kernels.empty())
+            return rocblaslt_status_invalid_value;
+        status = hip2RocStatus(
+            adapter->addGraphNode(data->kernels, graph, dependencies, numDependencies, *node));
+    }
+    catch(...)
+    {
+    }
+
+    return status;
+}
+
+/******************************************************************************
+ * patchTensileDataGemm points the kernels of a gemm to the pointers of       *
+ * inputs. a, b, c and d always move, optional inputs only when the kernels   *
+ * were made with them, and alpha and beta keep their values.                 *
+ ******************************************************************************/
+static rocblaslt_status patchTensileDataGemm(TensileThreadState const&         state,
+                                             TensileDataGemm&                  data,
+                                             const rocblaslt::RocGemmInputsV2& inputs)
+{
+    if(data.kernels.empty())
+        return rocblaslt_status_invalid_value;
+
+    if(!data.solution || data.solution->index != data.algoIndex)
+        data.solution
+            = state.library->getSolutionByIndex(data.problem, *state.hardware, data.algoIndex);
+    if(!data.solution)
+        return rocblaslt_status_not_implemented;
+
+    auto& tensileInputs = data.inputs;
+    auto  replace       = [](auto& current, void* next) {
+        using Pointer = std::remove_reference_t<decltype(current)>;
+        if(current)
+            current = static_cast<Pointer>(next);
+    };
+    tensileInputs.a = inputs.a;
+    tensileInputs.b = inputs.b;
+    tensileInputs.c = inputs.c;
+    tensileInputs.d = inputs.d;
+    replace(tensileInputs.bias, inputs.bias);
+    replace(tensileInputs.scaleA, inputs.scaleA);
+    replace(tensileInputs.scaleB, inputs.scaleB);
+    replace(tensileInputs.scaleC, inputs.scaleC);
+    replace(tensileInputs.scaleD, inputs.scaleD);
+    replace(tensileInputs.scaleAlphaVec, inputs.scaleAlphaVec);
+    replace(tensileInputs.amaxD, inputs.amaxD);
+
+    // The kernels and their launch sizes stay the same, only their arguments change
+    if(!data.solution->patchKernelArguments(data.kernels, data.problem, tensileInputs))
+        data.kernels = data.solution->solve(data.problem, tensileInputs, *state.hardware);
+    return rocblaslt_status_success;
+}
+
+rocblaslt_status updateKernelGraphNode(rocblaslt_handle                  handle,
+                                       rocblaslt::RocGemmType            gemmType,
+                                       std::shared_ptr<void>             gemmData,
+                                       const rocblaslt::RocGemmInputsV2& inputs,
+                                       hipGraphExec_t                    exec,
+                                       hipGraphNode_t                    node)
+{
+    rocblaslt_status status = rocblaslt_status_internal_error;
+    try
+    {
+        if(gemmType != rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+            return rocblaslt_status_not_implemented;
+
+        auto state = get_thread_state(handle->device);
+        if(!state)
+            return rocblaslt_status_invalid_pointer;
+
+        auto data = std::static_pointer_cast<TensileDataGemm>(gemmData);
+        status    = patchTensileDataGemm(*state, *data, inputs);
+        if(status == rocblaslt_status_success)
+            status = hip2RocStatus(state->adapter->setGraphNode(data->kernels, exec, node));
+    }
+    catch(...)
+    {
+    }
+
+    return status;
+}
+
+rocblaslt_status runKernelFromNewInputs(rocblaslt_handle                  handle,
+                                        rocblaslt::RocGemmType            gemmType,
+                                        std::shared_ptr<void>             gemmData,
+                                        const rocblaslt::RocGemmInputsV2& inputs,
+                                        hipStream_t                       stream)
+{
+    rocblaslt_status status = rocblaslt_status_internal_error;
+    try
+    {
+        if(gemmType != rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+            return rocblaslt_status_not_implemented;
+
+        auto state = get_thread_state(handle->device);
+        if(!state)
+            return rocblaslt_status_invalid_pointer;
+
+        status = patchTensileDataGemm(
+            *state, *std::static_pointer_cast<TensileDataGemm>(gemmData), inputs);
+        if(status == rocblaslt_status_success)
+            status = runKernelFromInvocation(handle, gemmType, gemmData, stream);
+    }
+    catch(...)
+    {
+    }
+
+    return status;
+}
+
 rocblaslt_status getDeviceUserArgumentsValuesFromContractionProblem(rocblaslt_handle       handle,
                                                                     rocblaslt::RocGemmType gemmType,
                                                                     std::shared_ptr<void>  gemmData,
@@ -2438,18 +4550,15 @@ rocblaslt_status getDeviceUserArgumentsValuesFromContractionProblem(rocblaslt_ha
     rocblaslt_status status = rocblaslt_status_internal_error;
     try
     {
-        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                               library;
-        std::shared_ptr<hipDeviceProp_t>       deviceProp;
-        std::shared_ptr<TensileLite::Hardware> hardware;
-
-        auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-
-        if(!library)
+        auto state = get_thread_state(handle->device);
+        if(!state)
         {
             return rocblaslt_status_invalid_pointer;
         }
 
+        auto& library  = state->library;
+        auto& hardware = state->hardware;
+
         if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
         {
             std::shared_ptr<TensileDataGroupedGemm> data
@@ -2502,18 +4611,16 @@ rocblaslt_status runKernelFromNewDeviceUserArguments(rocblaslt_handle       hand
     rocblaslt_status status = rocblaslt_status_internal_error;
     try
     {
-        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                               library;
-        std::shared_ptr<hipDeviceProp_t>       deviceProp;
-        std::shared_ptr<TensileLite::Hardware> hardware;
-
-        auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-
-        if(!library)
+        auto state = get_thread_state(handle->device);
+        if(!state)
         {
             return rocblaslt_status_invalid_pointer;
         }
 
+        auto& library  = state->library;
+        auto& hardware = state->hardware;
+        auto  adapter  = state->adapter;
+
         if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
         {
             std::shared_ptr<TensileDataGroupedGemm> data
@@ -2539,27 +4646,89 @@ rocblaslt_status runKernelFromNewDeviceUserArguments(rocblaslt_handle       hand
                     memcpy(arg + 4, &deviceUserArgs, sizeof(void*));
                 }
             }
-            status = hip2RocStatus(adapter->launchKernels(data->kernels, stream, nullptr, nullptr));
+            rocblaslt::Debug::markerStart(data->rangeName.c_str());
+            status = hip2RocStatus(launchOnHandleStream(handle, stream, [&](hipStream_t s) {
+                return adapter->launchKernels(data->kernels, s);
+            }));
+            rocblaslt::Debug::markerStop();
         }
         else
         {
-            return rocblaslt_status_not_implemented;
+            return rocblaslt_status_not_implemented;
+        }
+    }
+    catch(const std::exception& e)
+    {
+#if 0
+        std::ostream msg;
+        print_once(msg << "\nrocblaslt error: " << (solution ? "" : "No ")
+                       << "Tensile solution found, but exception thrown for " << prob << e.what());
+#endif
+    }
+    catch(...)
+    {
+#if 0
+        std::ostream msg;
+        print_once(msg << "\nrocblaslt error: " << (solution ? "" : "No ")
+                       << "Tensile solution found, but unknown exception thrown for " << prob);
+#endif
+    }
+
+    return status;
+}
+
+rocblaslt_status runKernelFromHostUserArguments(rocblaslt_handle       handle,
+                                                rocblaslt::RocGemmType gemmType,
+                                                std::shared_ptr<void>  gemmData,
+                                                const void*            hostDeviceUserArgs,
+                                                hipStream_t            stream)
+{
+    if(gemmType != rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
+        return rocblaslt_status_not_implemented;
+
+    rocblaslt_status status = rocblaslt_status_internal_error;
+    try
+    {
+        std::shared_ptr<TensileDataGroupedGemm> data
+            = std::static_pointer_cast<TensileDataGroupedGemm>(gemmData);
+        if(data->problem.gemms[0].activationComputeType() != TensileLite::DataType::Float)
+            throw std::runtime_error("Currently only supports DeviceUserArguments<float>");
+
+        size_t bytes
+            = sizeof(TensileLite::DeviceUserArguments<float>) * data->problem.gemms.size();
+
+        if(!data->userArgsRing)
+            data->userArgsRing = std::make_shared<TensileHostStagingRing>(handle->device, true);
+
+        // The slot, host and device side, stays reserved until the kernels reading it are
+        // done, so the next run() can upload while this one still executes
+        auto slot = data->userArgsRing->acquire(bytes);
+        memcpy(slot.ptr, hostDeviceUserArgs, bytes);
+        if(hipMemcpyAsync(slot.devicePtr, slot.ptr, bytes, hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+        {
+            data->userArgsRing->cancel(slot);
+            return rocblaslt_status_internal_error;
         }
+
+        status = runKernelFromNewDeviceUserArguments(
+            handle, gemmType, gemmData, slot.devicePtr, stream);
+        data->userArgsRing->release(slot, stream);
     }
     catch(const std::exception& e)
     {
 #if 0
         std::ostream msg;
-        print_once(msg << "\nrocblaslt error: " << (solution ? "" : "No ")
-                       << "Tensile solution found, but exception thrown for " << prob << e.what());
+        print_once(msg << "\nrocblaslt error: "
+                       << "Is hostDeviceUserArgs not match the size of the problem type? " << e.what());
 #endif
     }
     catch(...)
     {
 #if 0
         std::ostream msg;
-        print_once(msg << "\nrocblaslt error: " << (solution ? "" : "No ")
-                       << "Tensile solution found, but unknown exception thrown for " << prob);
+        print_once(msg << "\nrocblaslt error: "
+                       << "Is hostDeviceUserArgs not match the size of the problem type? ");
 #endif
     }
 
@@ -2578,18 +4747,16 @@ rocblaslt_status runKernelFromDeviceUserArguments(rocblaslt_handle             h
     rocblaslt_status status = rocblaslt_status_internal_error;
     try
     {
-        std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                               library;
-        std::shared_ptr<hipDeviceProp_t>       deviceProp;
-        std::shared_ptr<TensileLite::Hardware> hardware;
-
-        auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-
-        if(!library)
+        auto state = get_thread_state(handle->device);
+        if(!state)
         {
             return rocblaslt_status_invalid_pointer;
         }
 
+        auto& library  = state->library;
+        auto& hardware = state->hardware;
+        auto  adapter  = state->adapter;
+
         int* solutionIndex = (int*)algo.data;
         // don't overwrite data->algoIndex = *solutionIndex; here
         if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
@@ -2599,7 +4766,11 @@ rocblaslt_status runKernelFromDeviceUserArguments(rocblaslt_handle             h
                 = std::static_pointer_cast<TensileDataGroupedGemm>(gemmData);
             auto kernel = solution->solveGroupedGemmGPU(
                 data->problem.gemms, data->inputs, *hardware, deviceUserArgs, workspace, stream);
-            status = hip2RocStatus(adapter->launchKernels(kernel, stream, nullptr, nullptr));
+            rocblaslt::Debug::markerStart(data->rangeName.c_str());
+            status = hip2RocStatus(launchOnHandleStream(handle, stream, [&](hipStream_t s) {
+                return adapter->launchKernels(kernel, s);
+            }));
+            rocblaslt::Debug::markerStop();
         }
         else
         {
@@ -2641,6 +4812,10 @@ void _convertToHeuristicResultArray(
     const TensileLite::Hardware&                                    hardware)
 {
     *returnAlgoCount = std::min((int)solutions.size(), requestedAlgoCount);
+
+    // The fastest result that needs no workspace is the baseline of the predicted speedups
+    std::vector<double> predictedTimes(*returnAlgoCount);
+    double              baseline = 0.0;
     for(size_t i = 0; i < *returnAlgoCount; i++)
     {
         auto solution = solutions[i];
@@ -2651,6 +4826,16 @@ void _convertToHeuristicResultArray(
         heuristicResultsArray[i].algo.fallback            = false;
         heuristicResultsArray[i].state                    = rocblaslt_status_success;
         heuristicResultsArray[i].workspaceSize = solution->requiredWorkspaceSize(problem, hardware);
+
+        predictedTimes[i] = solution->predictedTime(problem, hardware);
+        if(heuristicResultsArray[i].workspaceSize == 0 && predictedTimes[i] > 0.0
+           && (baseline == 0.0 || predictedTimes[i] < baseline))
+            baseline = predictedTimes[i];
+    }
+    for(size_t i = 0; i < *returnAlgoCount; i++)
+    {
+        heuristicResultsArray[i].predictedSpeedup
+            = predictedTimes[i] > 0.0 ? baseline / predictedTimes[i] : 0.0;
     }
     for(size_t i = *returnAlgoCount; i < requestedAlgoCount; i++)
     {
@@ -2691,7 +4876,7 @@ std::vector<std::shared_ptr<TensileLite::ContractionSolution>>
         return {};
     }
 
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    hardware = get_device_hardware(handle->device);
 
     std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
     updateTensileProblem(prob, data->problem);
@@ -2713,6 +4898,46 @@ std::vector<std::shared_ptr<TensileLite::ContractionSolution>>
     return solutions;
 }
 
+std::vector<rocblaslt::RocSelectionCandidate>
+    traceBestRawSolutions(RocblasltContractionProblem const& prob,
+                          rocblaslt_handle                   handle,
+                          std::shared_ptr<void>              gemmData,
+                          int                                requestedAlgoCount,
+                          size_t                             maxWorkSpaceBytes)
+{
+    TensileLite::SelectionTrace trace;
+
+    auto solutions
+        = getBestRawSolutions(prob, handle, gemmData, requestedAlgoCount, maxWorkSpaceBytes);
+
+    // A solution reached through several table entries is ranked at its first evaluation
+    std::vector<bool>                             ranked(solutions.size(), false);
+    std::vector<rocblaslt::RocSelectionCandidate> candidates;
+    for(auto const& traced : trace.candidates())
+    {
+        rocblaslt::RocSelectionCandidate candidate;
+        candidate.solutionIndex     = traced.solutionIndex;
+        candidate.solutionName      = traced.solutionName;
+        candidate.accepted          = traced.accepted;
+        candidate.failedPredicate   = traced.failedPredicate;
+        candidate.requiredWorkspace = traced.requiredWorkspace;
+        candidate.providedWorkspace = traced.providedWorkspace;
+        candidate.score             = traced.score;
+        for(size_t rank = 0; rank < solutions.size(); rank++)
+        {
+            if(traced.accepted && !ranked[rank]
+               && solutions[rank]->index == traced.solutionIndex)
+            {
+                candidate.rank = static_cast<int>(rank);
+                ranked[rank]   = true;
+                break;
+            }
+        }
+        candidates.push_back(std::move(candidate));
+    }
+    return candidates;
+}
+
 rocblaslt_status getBestSolutions(RocblasltContractionProblem const& prob,
                                   rocblaslt_handle                   handle,
                                   std::shared_ptr<void>              gemmData,
@@ -2734,15 +4959,25 @@ rocblaslt_status getBestSolutions(RocblasltContractionProblem const& prob,
         return rocblaslt_status_invalid_pointer;
     }
 
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    hardware = get_device_hardware(handle->device);
 
     std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
     updateTensileProblem(prob, data->problem);
 
+    // Launches on the priority stream rank regular grids first
+    rocblaslt::RocGemmPreference pref;
+    pref.deterministicReduction = prob.deterministicReduction || handle->reproducible;
+    pref.preferNonPersistent    = handle->m_priorityStream != nullptr;
+    pref.cachePolicyB           = prob.cachePolicyB;
+    pref.cachePolicyD           = prob.cachePolicyD;
+
     bool enableEpilogue = prob.epilogue == ROCBLASLT_EPILOGUE_DEFAULT ? false : true;
+    int  candidateCount = hasRankingPreference(pref)
+                              ? requestedAlgoCount * preferenceCandidateFactor
+                              : requestedAlgoCount;
 
     auto solutions
-        = getSolutions(prob, library, hardware, data->problem, enableEpilogue, requestedAlgoCount);
+        = getSolutions(prob, library, hardware, data->problem, enableEpilogue, candidateCount);
 
     // when there is no solution for xfloat32, fallback comput_type to fp32
     if(solutions.size() == 0 && prob.compute_type == rocblaslt_compute_f32_fast_xf32)
@@ -2750,9 +4985,14 @@ rocblaslt_status getBestSolutions(RocblasltContractionProblem const& prob,
         log_api(__func__, "no xf32 solutions found, try to fallback fp32");
         data->problem.setF32XdlMathOp(TensileLite::DataType::Float);
         solutions = getSolutions(
-            prob, library, hardware, data->problem, enableEpilogue, requestedAlgoCount);
+            prob, library, hardware, data->problem, enableEpilogue, candidateCount);
     }
 
+    // The library ranking already includes the conversion kernel or the synchronization
+    // that reduces the partials of the remaining solutions
+    if(hasRankingPreference(pref))
+        applyPreference(solutions, data->problem, *hardware, pref);
+
     memset(
         heuristicResultsArray, 0, sizeof(rocblaslt_matmul_heuristic_result) * requestedAlgoCount);
     _convertToHeuristicResultArray(solutions,
@@ -2766,6 +5006,131 @@ rocblaslt_status getBestSolutions(RocblasltContractionProblem const& prob,
     return rocblaslt_status_success;
 }
 
+rocblaslt_status
+    getBestSolutionsBatched(std::vector<RocblasltContractionProblem> const& probs,
+                            rocblaslt_handle                                handle,
+                            std::vector<std::shared_ptr<void>> const&       gemmData,
+                            int                                             requestedAlgoCount,
+                            rocblaslt_matmul_heuristic_result               heuristicResultsArray[],
+                            int                                             returnAlgoCount[],
+                            size_t                                          maxWorkSpaceBytes)
+{
+    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+                                           library;
+    std::shared_ptr<hipDeviceProp_t>       deviceProp;
+    std::shared_ptr<TensileLite::Hardware> hardware;
+
+    static_cast<void>(get_library_and_adapter(&library, &deviceProp, handle->device));
+
+    if(!library)
+    {
+        return rocblaslt_status_invalid_pointer;
+    }
+
+    hardware = get_device_hardware(handle->device);
+
+    // Problems may share a matmul descriptor, so each one is set up in a copy of its problem.
+    // The problems are grouped by the candidate count getBestSolutions() would request.
+    std::vector<TensileLite::ContractionProblemGemm> problems;
+    std::vector<rocblaslt::RocGemmPreference>        prefs(probs.size());
+    std::map<int, std::vector<size_t>>               groups;
+    problems.reserve(probs.size());
+    for(size_t i = 0; i < probs.size(); i++)
+    {
+        problems.push_back(std::static_pointer_cast<TensileDataGemm>(gemmData[i])->problem);
+        updateTensileProblem(probs[i], problems.back());
+
+        prefs[i].deterministicReduction = probs[i].deterministicReduction || handle->reproducible;
+        prefs[i].preferNonPersistent    = handle->m_priorityStream != nullptr;
+        prefs[i].cachePolicyB           = probs[i].cachePolicyB;
+        prefs[i].cachePolicyD           = probs[i].cachePolicyD;
+        int candidateCount              = hasRankingPreference(prefs[i])
+                                              ? requestedAlgoCount * preferenceCandidateFactor
+                                              : requestedAlgoCount;
+        groups[candidateCount].push_back(i);
+    }
+
+    // Each group is selected in one walk of the library, which visits the nodes that the
+    // problems of one type share once
+    std::vector<TensileLite::SolutionVector<TensileLite::ContractionSolution>> solutions(
+        probs.size());
+    for(auto const& group : groups)
+    {
+        std::vector<TensileLite::ContractionProblemGemm const*> batch;
+        batch.reserve(group.second.size());
+        for(auto i : group.second)
+            batch.push_back(&problems[i]);
+
+        auto found = library->findTopSolutionsBatch(batch, *hardware, group.first);
+        for(size_t j = 0; j < group.second.size(); j++)
+        {
+            auto i       = group.second[j];
+            solutions[i] = std::move(found[j]);
+
+            // when there is no solution for xfloat32, fallback comput_type to fp32
+            if(solutions[i].size() == 0
+               && probs[i].compute_type == rocblaslt_compute_f32_fast_xf32)
+            {
+                problems[i].setF32XdlMathOp(TensileLite::DataType::Float);
+                solutions[i] = library->findTopSolutions(problems[i], *hardware, group.first);
+            }
+        }
+    }
+
+    for(size_t i = 0; i < probs.size(); i++)
+    {
+        if(hasRankingPreference(prefs[i]))
+            applyPreference(solutions[i], problems[i], *hardware, prefs[i]);
+
+        auto results = heuristicResultsArray + i * requestedAlgoCount;
+        memset(results, 0, sizeof(rocblaslt_matmul_heuristic_result) * requestedAlgoCount);
+        _convertToHeuristicResultArray(solutions[i],
+                                       requestedAlgoCount,
+                                       results,
+                                       &returnAlgoCount[i],
+                                       maxWorkSpaceBytes,
+                                       problems[i],
+                                       *hardware);
+    }
+
+    return rocblaslt_status_success;
+}
+
+// Candidate count from which getAllSolutions spreads their evaluation over threads
+constexpr size_t   PARALLEL_CANDIDATE_THRESHOLD = 256;
+constexpr unsigned MAX_CANDIDATE_THREADS        = 8;
+
+// Calls evaluate(i) once for every i in [0, count). Large counts are split into contiguous
+// ranges that run concurrently, so evaluate must only write to the slots of its own index,
+// which keeps the results in the same order as the serial loop.
+template <typename Evaluate>
+void forEachCandidate(size_t count, Evaluate&& evaluate)
+{
+    unsigned threads
+        = std::min<unsigned>(std::thread::hardware_concurrency(), MAX_CANDIDATE_THREADS);
+    if(count < PARALLEL_CANDIDATE_THRESHOLD || threads < 2)
+    {
+        for(size_t i = 0; i < count; i++)
+            evaluate(i);
+        return;
+    }
+
+    size_t                         chunk = (count + threads - 1) / threads;
+    std::vector<std::future<void>> pending;
+    for(size_t begin = chunk; begin < count; begin += chunk)
+    {
+        size_t end = std::min(begin + chunk, count);
+        pending.push_back(std::async(std::launch::async, [&evaluate, begin, end]() {
+            for(size_t i = begin; i < end; i++)
+                evaluate(i);
+        }));
+    }
+    for(size_t i = 0; i < chunk; i++)
+        evaluate(i);
+    for(auto& task : pending)
+        task.get();
+}
+
 template <typename MyProblem>
 rocblaslt_status getAllSolutions(MyProblem&                                      prob,
                                  rocblaslt_handle                                handle,
@@ -2785,7 +5150,7 @@ rocblaslt_status getAllSolutions(MyProblem&
         return rocblaslt_status_invalid_pointer;
     }
 
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    hardware = get_device_hardware(handle->device);
 
     std::set<std::shared_ptr<TensileLite::ContractionSolution>> solutions;
     std::shared_ptr<void>                                       tensile_prob;
@@ -2819,18 +5184,21 @@ rocblaslt_status getAllSolutions(MyProblem&
         }
     }
 
-    heuristicResults.resize(solutions.size());
+    bool rankByModel = TensileLite::Debug::Instance().analyticRanking();
 
-    int i = 0;
-    for(auto solution : solutions)
-    {
-        //workaround: findAllSolutions should get all solutions without duplications
-        bool duplicated_sol = false;
-        for(int j = 0; j < i; j++)
-            if(*(int*)(heuristicResults[j].algo.data) == solution->index)
-                duplicated_sol = true;
-        if(duplicated_sol)
-            continue;
+    //workaround: findAllSolutions should get all solutions without duplications
+    std::vector<std::shared_ptr<TensileLite::ContractionSolution>> candidates;
+    std::unordered_set<int>                                        indices;
+    candidates.reserve(solutions.size());
+    for(auto const& solution : solutions)
+        if(indices.insert(solution->index).second)
+            candidates.push_back(solution);
+
+    heuristicResults.resize(candidates.size());
+    std::vector<double> predictedTimes(rankByModel ? candidates.size() : 0);
+
+    forEachCandidate(candidates.size(), [&](size_t i) {
+        auto const& solution = candidates[i];
         memset(&heuristicResults[i], 0, sizeof(rocblaslt_matmul_heuristic_result));
         memset(heuristicResults[i].algo.data, 0, sizeof(heuristicResults[i].algo.data));
         int* solutionIndex                           = (int*)(heuristicResults[i].algo.data);
@@ -2842,9 +5210,37 @@ rocblaslt_status getAllSolutions(MyProblem&
             heuristicResults[i].workspaceSize = solution->requiredWorkspaceSize(prob, *hardware);
         else
             heuristicResults[i].workspaceSize = 0;
-        i++;
+        if(rankByModel)
+        {
+            double time = 0.0;
+            if constexpr(std::is_same<MyProblem, TensileLite::ContractionProblemGemm>::value)
+                time = solution->predictedTime(prob, *hardware);
+            else
+                for(auto& gemm : prob.gemms)
+                    time += solution->predictedTime(gemm, *hardware);
+            predictedTimes[i] = time;
+        }
+    });
+
+    // Most promising kernels first, so that benchmarking a prefix of the list is enough
+    if(rankByModel)
+    {
+        auto index = [&](size_t r) { return *(int*)(heuristicResults[r].algo.data); };
+
+        std::vector<size_t> order(heuristicResults.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if(predictedTimes[a] != predictedTimes[b])
+                return predictedTimes[a] < predictedTimes[b];
+            return index(a) < index(b);
+        });
+
+        std::vector<rocblaslt_matmul_heuristic_result> ranked;
+        ranked.reserve(order.size());
+        for(auto r : order)
+            ranked.push_back(heuristicResults[r]);
+        heuristicResults.swap(ranked);
     }
-    heuristicResults.resize(i);
     log_api(__func__, "Final hardware solutions: ", heuristicResults.size());
 
     return rocblaslt_status_success;
@@ -2900,6 +5296,94 @@ rocblaslt_status getAllSolutions(std::shared_ptr<void>
     return status;
 }
 
+rocblaslt_status getWorkspaceFrontier(rocblaslt_handle                                handle,
+                                      rocblaslt::RocGemmType                          gemmType,
+                                      std::shared_ptr<void>                           gemmData,
+                                      std::vector<rocblaslt_matmul_heuristic_result>& frontier)
+{
+    if(gemmType != rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+    {
+        log_api(__func__, "Invalid gemm type", static_cast<int>(gemmType));
+        return rocblaslt_status_not_implemented;
+    }
+
+    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+                                           library;
+    std::shared_ptr<hipDeviceProp_t>       deviceProp;
+    std::shared_ptr<TensileLite::Hardware> hardware;
+
+    static_cast<void>(get_library_and_adapter(&library, &deviceProp, handle->device));
+
+    if(!library)
+    {
+        return rocblaslt_status_invalid_pointer;
+    }
+
+    hardware = get_device_hardware(handle->device);
+
+    // Every solution of the problem type that solves the problem with unlimited workspace
+    std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
+    auto                             prob = data->problem;
+    prob.setWorkspaceSize(std::numeric_limits<size_t>::max());
+    prob.setParams().resetInternalArgs();
+
+    auto solutions = library->findAllSolutions(
+        prob, *hardware, TensileLite::SolutionLibrarySearchType::GEMM_TYPE_ONLY);
+    if(solutions.empty() && prob.f32XdlMathOp() == TensileLite::DataType::XFloat32)
+    {
+        prob.setF32XdlMathOp(TensileLite::DataType::Float);
+        solutions = library->findAllSolutions(
+            prob, *hardware, TensileLite::SolutionLibrarySearchType::GEMM_TYPE_ONLY);
+    }
+
+    struct Point
+    {
+        size_t workspace;
+        double time;
+        int    index;
+    };
+    std::vector<Point> points;
+    for(auto const& solution : solutions)
+    {
+        if(!(*solution->hardwarePredicate)(*hardware) || !(*solution->problemPredicate)(prob))
+            continue;
+        points.push_back({solution->requiredWorkspaceSize(prob, *hardware),
+                          solution->predictedTime(prob, *hardware),
+                          solution->index});
+    }
+    std::sort(points.begin(), points.end(), [](Point const& a, Point const& b) {
+        if(a.workspace != b.workspace)
+            return a.workspace < b.workspace;
+        if(a.time != b.time)
+            return a.time < b.time;
+        return a.index < b.index;
+    });
+
+    // A point is on the frontier when it is faster than every point that needs less workspace
+    double baseline = !points.empty() && points[0].workspace == 0 ? points[0].time : 0.0;
+    double fastest  = std::numeric_limits<double>::infinity();
+    frontier.clear();
+    for(auto const& point : points)
+    {
+        if(point.time >= fastest)
+            continue;
+        fastest = point.time;
+
+        rocblaslt_matmul_heuristic_result result;
+        memset(&result, 0, sizeof(rocblaslt_matmul_heuristic_result));
+        *(int*)(result.algo.data)       = point.index;
+        result.algo.max_workspace_bytes = point.workspace;
+        result.algo.fallback            = false;
+        result.state                    = rocblaslt_status_success;
+        result.workspaceSize            = point.workspace;
+        result.predictedSpeedup         = point.time > 0.0 ? baseline / point.time : 0.0;
+        frontier.push_back(result);
+    }
+    log_api(__func__, "Frontier solutions: ", frontier.size());
+
+    return rocblaslt_status_success;
+}
+
 rocblaslt_status
     getSolutionsFromIndex(rocblaslt_handle                                handle,
                           std::vector<int>&                               solutionIndex,
@@ -2923,11 +5407,14 @@ rocblaslt_status
         return rocblaslt_status_invalid_pointer;
     }
 
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    hardware = get_device_hardware(handle->device);
 
     int  lastSolutionIndex = library->solutions.rbegin()->first;
     bool isOutOfBound      = true;
     int  i                 = 0;
+    // Solutions of files that are not loaded yet are only listed in the index
+    if(library->solutionIndex)
+        lastSolutionIndex = std::max(lastSolutionIndex, library->solutionIndex->lastIndex());
     for(auto index : solutionIndex)
     {
         isOutOfBound  = isOutOfBound && (index > lastSolutionIndex);
@@ -2976,7 +5463,7 @@ rocblaslt_status isSolutionSupported(rocblaslt_handle       handle,
         return rocblaslt_status_invalid_pointer;
     }
 
-    hardware              = TensileLite::hip::GetDevice(*deviceProp);
+    hardware              = get_device_hardware(handle->device);
     *workspaceSizeInBytes = 0;
 
     int* solutionIndex = (int*)algo->data;
@@ -2985,10 +5472,19 @@ rocblaslt_status isSolutionSupported(rocblaslt_handle       handle,
     {
         auto solution = library->getSolutionByIndex(tensile_prob, *hardware, *solutionIndex);
 
+        if(handle->reproducible
+           && !reducesReproducibly(*solution, tensile_prob, *hardware, tuning ? tuning->gsu : 0))
+        {
+            log_error(__func__, "Solution does not reduce reproducibly");
+            return rocblaslt_status_invalid_value;
+        }
+
         if(tuning)
         {
             tensile_prob.setParams().setGSU(tuning->gsu);
             tensile_prob.setParams().setWgm(tuning->wgm);
+            tensile_prob.setParams().setStreamK(tuning->streamK);
+            tensile_prob.setParams().setSKGridFraction(tuning->skGridFraction);
             std::stringstream ss;
             if(!solution->checkInternalArgumentsSupport(tensile_prob, ss, true))
             {
@@ -3040,10 +5536,20 @@ rocblaslt_status isSolutionSupported(rocblaslt_handle       handle,
         auto solution
             = library->getSolutionByIndex(tensile_prob.gemms[0], *hardware, *solutionIndex);
 
+        if(handle->reproducible
+           && !reducesReproducibly(
+               *solution, tensile_prob.gemms[0], *hardware, tuning ? tuning->gsu : 0))
+        {
+            log_error(__func__, "Solution does not reduce reproducibly");
+            return rocblaslt_status_invalid_value;
+        }
+
         if(tuning)
         {
             tensile_prob.gemms[0].setParams().setGSU(tuning->gsu);
             tensile_prob.gemms[0].setParams().setWgm(tuning->wgm);
+            tensile_prob.gemms[0].setParams().setStreamK(tuning->streamK);
+            tensile_prob.gemms[0].setParams().setSKGridFraction(tuning->skGridFraction);
             std::stringstream ss;
             if(!solution->checkInternalArgumentsSupport(tensile_prob.gemms[0], ss, true))
             {
@@ -3055,6 +5561,8 @@ rocblaslt_status isSolutionSupported(rocblaslt_handle       handle,
             {
                 tensile_prob.gemms[i].setParams().setGSU(tuning->gsu);
                 tensile_prob.gemms[i].setParams().setWgm(tuning->wgm);
+                tensile_prob.gemms[i].setParams().setStreamK(tuning->streamK);
+                tensile_prob.gemms[i].setParams().setSKGridFraction(tuning->skGridFraction);
             }
         }
         else
@@ -3110,7 +5618,19 @@ rocblaslt_status isSolutionSupported(rocblaslt_handle             handle,
     std::shared_ptr<TensileDataGemm> data = std::static_pointer_cast<TensileDataGemm>(gemmData);
     updateTensileProblem(prob, data->problem);
     rocblaslt::RocTuningV2* tuning = nullptr;
-    return isSolutionSupported(handle, data->problem, prob, algo, tuning, workspaceSizeInBytes);
+    auto                    status
+        = isSolutionSupported(handle, data->problem, prob, algo, tuning, workspaceSizeInBytes);
+    if(status == rocblaslt_status_success && prob.deterministicReduction
+       && !solutionMeetsPreference(handle,
+                                   rocblaslt::RocGemmType::ROCBLASLT_GEMM,
+                                   gemmData,
+                                   *algo,
+                                   deterministicPreference()))
+    {
+        log_error(__func__, "Solution does not reduce split-k partials deterministically");
+        return rocblaslt_status_invalid_value;
+    }
+    return status;
 }
 
 template <typename T>
@@ -3170,12 +5690,50 @@ rocblaslt_status isSolutionSupported(rocblaslt_handle              handle,
     return rocblaslt_status_not_implemented;
 }
 
+bool solutionMeetsPreference(rocblaslt_handle                    handle,
+                             rocblaslt::RocGemmType              gemmType,
+                             std::shared_ptr<void>               gemmData,
+                             const rocblaslt_matmul_algo&        algo,
+                             const rocblaslt::RocGemmPreference& pref)
+{
+    if(!hasRankingPreference(pref))
+        return true;
+
+    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
+                                     library;
+    std::shared_ptr<hipDeviceProp_t> deviceProp;
+
+    static_cast<void>(get_library_and_adapter(&library, &deviceProp, handle->device));
+
+    if(!library)
+        return false;
+
+    auto hardware = get_device_hardware(handle->device);
+    auto solution = library->getSolutionByIndex(*hardware, *(const int*)algo.data);
+    if(!solution)
+        return false;
+
+    if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
+    {
+        auto data = std::static_pointer_cast<TensileDataGemm>(gemmData);
+        return meetsPreference(*solution, data->problem, *hardware, pref);
+    }
+    else if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
+    {
+        auto data = std::static_pointer_cast<TensileDataGroupedGemm>(gemmData);
+        return !data->problem.gemms.empty()
+               && meetsPreference(*solution, data->problem.gemms[0], *hardware, pref);
+    }
+    return false;
+}
+
 rocblaslt_status getBestSolutions(rocblaslt_handle       handle,
                                   rocblaslt::RocGemmType gemmType,
                                   std::shared_ptr<void>  gemmData,
                                   const int              workspaceBytes,
                                   const int              requestedAlgoCount,
-                                  std::vector<rocblaslt_matmul_heuristic_result>& heuristicResults)
+                                  std::vector<rocblaslt_matmul_heuristic_result>& heuristicResults,
+                                  const rocblaslt::RocGemmPreference*             pref)
 {
     std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
                                            library;
@@ -3190,7 +5748,21 @@ rocblaslt_status getBestSolutions(rocblaslt_handle       handle,
         return rocblaslt_status_invalid_pointer;
     }
 
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    hardware = get_device_hardware(handle->device);
+
+    // A reproducible handle ranks among the solutions with fixed reduction orders
+    rocblaslt::RocGemmPreference reproduciblePref;
+    if(handle->reproducible)
+    {
+        if(pref)
+            reproduciblePref = *pref;
+        reproduciblePref.deterministicReduction = true;
+        pref                                    = &reproduciblePref;
+    }
+
+    bool ranked         = pref && hasRankingPreference(*pref);
+    int  candidateCount = ranked ? requestedAlgoCount * preferenceCandidateFactor
+                                 : requestedAlgoCount;
 
     if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
     {
@@ -3201,7 +5773,7 @@ rocblaslt_status getBestSolutions(rocblaslt_handle       handle,
                                       hardware,
                                       data->problem,
                                       data->enableEpilogue,
-                                      requestedAlgoCount);
+                                      candidateCount);
 
         // when there is no solution for xfloat32, fallback comput_type to fp32
         if(solutions.size() == 0 && data->problem.f32XdlMathOp() == TensileLite::DataType::XFloat32)
@@ -3212,9 +5784,12 @@ rocblaslt_status getBestSolutions(rocblaslt_handle       handle,
                                      hardware,
                                      data->problem,
                                      data->enableEpilogue,
-                                     requestedAlgoCount);
+                                     candidateCount);
         }
 
+        if(ranked)
+            applyPreference(solutions, data->problem, *hardware, *pref);
+
         auto algoCount       = min(static_cast<size_t>(requestedAlgoCount), solutions.size());
         int  returnAlgoCount = 0;
         heuristicResults.clear();
@@ -3238,7 +5813,10 @@ rocblaslt_status getBestSolutions(rocblaslt_handle       handle,
         }
 
         auto solutions = library->findTopSolutionsGroupedGemm(
-            data->problem.gemms, *hardware, requestedAlgoCount);
+            data->problem.gemms, *hardware, candidateCount);
+
+        if(ranked && !data->problem.gemms.empty())
+            applyPreference(solutions, data->problem.gemms[0], *hardware, *pref);
 
         auto algoCount       = min(static_cast<size_t>(requestedAlgoCount), solutions.size());
         int  returnAlgoCount = 0;
@@ -3317,13 +5895,14 @@ std::string getSolutionNameFromData(rocblaslt_handle             handle,
         return std::string();
     }
 
-    int gsu           = 0;
-    int wgm           = 0;
-    int solutionIndex = -1;
+    int   gsu            = 0;
+    int   wgm            = 0;
+    float skGridFraction = 0.0f;
+    int   solutionIndex  = -1;
 
     std::shared_ptr<TensileLite::Hardware> hardware;
 
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    hardware = get_device_hardware(handle->device);
 
     if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GEMM)
     {
@@ -3331,14 +5910,16 @@ std::string getSolutionNameFromData(rocblaslt_handle             handle,
         solutionIndex                         = data->algoIndex;
         gsu                                   = data->problem.getParams().gsu();
         wgm                                   = data->problem.getParams().wgm();
+        skGridFraction                        = data->problem.getParams().skGridFraction();
     }
     else if(gemmType == rocblaslt::RocGemmType::ROCBLASLT_GROUPED_GEMM)
     {
         std::shared_ptr<TensileDataGroupedGemm> data
             = std::static_pointer_cast<TensileDataGroupedGemm>(gemmData);
-        solutionIndex = data->algoIndex;
-        gsu           = data->problem.gemms[0].getParams().gsu();
-        wgm           = data->problem.gemms[0].getParams().wgm();
+        solutionIndex  = data->algoIndex;
+        gsu            = data->problem.gemms[0].getParams().gsu();
+        wgm            = data->problem.gemms[0].getParams().wgm();
+        skGridFraction = data->problem.gemms[0].getParams().skGridFraction();
     }
     if(solutionIndex == -1)
         return "";
@@ -3355,50 +5936,126 @@ std::string getSolutionNameFromData(rocblaslt_handle             handle,
             modifiedString += ", ";
         modifiedString += "WGM: " + std::to_string(wgm);
     }
+
+    if(skGridFraction > 0.0f)
+    {
+        if(modifiedString != "")
+            modifiedString += ", ";
+        modifiedString += "SK grid: " + std::to_string(skGridFraction) + " x CUs";
+    }
     auto solutionName = solution->solutionName;
     if(modifiedString != "")
         solutionName += " (Custom tuning: " + modifiedString + ")";
     return solutionName;
 }
 
-std::string getKernelNameFromAlgoIndex(rocblaslt_handle handle, const rocblaslt_matmul_algo& algo)
+namespace
 {
-    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                     library;
-    std::shared_ptr<hipDeviceProp_t> deviceProp;
-
-    auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-    std::shared_ptr<TensileLite::Hardware> hardware;
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    struct TensileSolutionNames
+    {
+        std::string_view kernel;
+        std::string_view solution;
+    };
 
-    if(!library)
+    /**************************************************************************
+     * TensileNameCache keeps the kernel and solution names of the solutions  *
+     * of every device by solution index, as views into strings interned for  *
+     * the life of the process. Name queries after the first one of an index  *
+     * neither walk the library nor allocate, and the views stay valid when   *
+     * the library is reloaded, which only invalidates the entries.           *
+     **************************************************************************/
+    class TensileNameCache
     {
-        return std::string();
-    }
+    public:
+        static TensileNameCache& instance()
+        {
+            static TensileNameCache cache;
+            return cache;
+        }
 
-    int* solutionIndex = (int*)algo.data;
-    auto solution      = library->getSolutionByIndex(*hardware, *solutionIndex);
-    return solution->kernelName;
-}
+        // False when the library of the device has no solution of that index
+        bool find(int device, int index, TensileSolutionNames& names)
+        {
+            uint32_t generation = get_tensile_host().get_library_generation();
+            uint64_t key        = (uint64_t(uint32_t(device)) << 32) | uint32_t(index);
+            {
+                std::shared_lock<std::shared_mutex> lock(m_mutex);
+                auto                                it = m_entries.find(key);
+                if(it != m_entries.end() && it->second.generation == generation)
+                {
+                    names = it->second.names;
+                    return true;
+                }
+            }
 
-std::string getSolutionNameFromAlgoIndex(rocblaslt_handle handle, const rocblaslt_matmul_algo& algo)
+            auto state = get_thread_state(device);
+            if(!state)
+                return false;
+            auto solution = state->library->getSolutionByIndex(*state->hardware, index);
+            if(!solution)
+                return false;
+
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            auto&                               entry = m_entries[key];
+            entry.names      = {intern(solution->kernelName), intern(solution->solutionName)};
+            entry.generation = generation;
+            names            = entry.names;
+            return true;
+        }
+
+    private:
+        struct Entry
+        {
+            TensileSolutionNames names;
+            uint32_t             generation = 0;
+        };
+
+        // The nodes of the set never move, so views into them stay valid
+        std::string_view intern(std::string const& name)
+        {
+            return *m_strings.insert(name).first;
+        }
+
+        std::shared_mutex                   m_mutex;
+        std::unordered_map<uint64_t, Entry> m_entries;
+        std::unordered_set<std::string>     m_strings;
+    };
+
+    constexpr std::string_view SKINNY_GEMM_NAME = "SkinnyGemm";
+} // namespace
+
+rocblaslt_status getAlgoNames(rocblaslt_handle             handle,
+                              const rocblaslt_matmul_algo& algo,
+                              const char**                 kernelName,
+                              const char**                 solutionName)
 {
-    std::shared_ptr<TensileLite::MasterSolutionLibrary<TensileLite::ContractionProblemGemm>>
-                                     library;
-    std::shared_ptr<hipDeviceProp_t> deviceProp;
+    TensileSolutionNames names{SKINNY_GEMM_NAME, SKINNY_GEMM_NAME};
+    if(!isSkinnyGemmAlgo(algo)
+       && !TensileNameCache::instance().find(handle->device, *(const int*)algo.data, names))
+        return rocblaslt_status_invalid_value;
 
-    auto adapter = get_library_and_adapter(&library, &deviceProp, handle->device);
-    std::shared_ptr<TensileLite::Hardware> hardware;
-    hardware = TensileLite::hip::GetDevice(*deviceProp);
+    // Views of whole std::strings, so they are null terminated
+    if(kernelName)
+        *kernelName = names.kernel.data();
+    if(solutionName)
+        *solutionName = names.solution.data();
+    return rocblaslt_status_success;
+}
 
-    if(!library)
-    {
+std::string getKernelNameFromAlgoIndex(rocblaslt_handle handle, const rocblaslt_matmul_algo& algo)
+{
+    const char* name = nullptr;
+    if(getAlgoNames(handle, algo, &name, nullptr) != rocblaslt_status_success)
         return std::string();
-    }
+    return name;
+}
 
-    int* solutionIndex = (int*)algo.data;
-    auto solution      = library->getSolutionByIndex(*hardware, *solutionIndex);
-    return solution->solutionName;
+std::string getSolutionNameFromAlgoIndex(rocblaslt_handle handle, const rocblaslt_matmul_algo& algo)
+{
+    const char* name = nullptr;
+    if(getAlgoNames(handle, algo, nullptr, &name) != rocblaslt_status_success)
+        return std::string();
+    return name;
 }
 
 /***************************************************************
@@ -24,24 +24,211 @@
  *
  *******************************************************************************/
 #include "utility.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <sstream>
 #include <sys/types.h>
+#include <thread>
 #include <unistd.h>
+#include <vector>
 std::ostream* get_logger_os()
 {
     LoggerSingleton& s = LoggerSingleton::getInstance();
     return s.log_os;
 }
 
-uint32_t get_logger_layer_mode()
+namespace rocblaslt
 {
-    LoggerSingleton& s = LoggerSingleton::getInstance();
-    return s.env_layer_mode;
+    std::atomic<uint32_t> instrumentationWord{INSTRUMENTATION_UNSET};
+
+    // The settings only come from the environment, so concurrent first calls store the
+    // same word
+    uint32_t loadInstrumentationFlags()
+    {
+        auto const& debug  = Debug::Instance();
+        uint32_t    flags  = LoggerSingleton::getInstance().env_layer_mode;
+        uint32_t    timing = std::clamp(debug.m_callTiming, 0, 3);
+        flags &= INSTRUMENTATION_LAYER_MODE;
+        flags |= timing << INSTRUMENTATION_CALL_TIMING_SHIFT;
+        if(debug.m_printMarker)
+            flags |= INSTRUMENTATION_MARKER;
+        instrumentationWord.store(flags, std::memory_order_relaxed);
+        return flags;
+    }
+} // namespace rocblaslt
+
+bool get_logger_async()
+{
+    thread_local const bool async = LoggerSingleton::getInstance().env_async;
+    return async;
+}
+
+namespace
+{
+    class AsyncLogger
+    {
+    public:
+        static AsyncLogger& instance()
+        {
+            static AsyncLogger logger;
+            return logger;
+        }
+
+        void push(std::unique_ptr<rocblaslt_log_record> record)
+        {
+            Ring&  ring = threadRing();
+            size_t tail = ring.tail.load(std::memory_order_relaxed);
+            if(tail - ring.head.load(std::memory_order_acquire) >= ringSize)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            ring.slots[tail % ringSize] = std::move(record);
+            ring.tail.store(tail + 1, std::memory_order_release);
+        }
+
+    private:
+        static constexpr size_t ringSize = 4096;
+
+        // Single producer, the owning thread, and single consumer, the drain thread
+        struct Ring
+        {
+            std::unique_ptr<rocblaslt_log_record> slots[ringSize];
+            std::atomic<size_t>                   head{0};
+            std::atomic<size_t>                   tail{0};
+            std::atomic<bool>                     orphaned{false};
+        };
+
+        // The ring of an exited thread is dropped once it is drained
+        struct RingHolder
+        {
+            std::shared_ptr<Ring> ring = std::make_shared<Ring>();
+
+            explicit RingHolder(AsyncLogger& logger)
+            {
+                std::lock_guard<std::mutex> lock(logger.m_ringsMutex);
+                logger.m_rings.push_back(ring);
+            }
+            ~RingHolder()
+            {
+                ring->orphaned.store(true, std::memory_order_release);
+            }
+        };
+
+        // Constructed after the logger singleton, so the stream outlives the drain thread
+        AsyncLogger()
+            : m_os(get_logger_os())
+            , m_thread([this] { run(); })
+        {
+        }
+
+        ~AsyncLogger()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_stopMutex);
+                m_stop = true;
+            }
+            m_wake.notify_one();
+            m_thread.join();
+            drain();
+
+            std::lock_guard<std::mutex> lock(log_mutex);
+            for(auto& [line, count] : m_bench)
+            {
+                if(count > 1)
+                    *m_os << "# repeated " << count << " times: " << line << "\n";
+            }
+            if(size_t dropped = m_dropped.load(std::memory_order_relaxed))
+                *m_os << "# dropped " << dropped << " log records, the rings were full\n";
+            m_os->flush();
+        }
+
+        Ring& threadRing()
+        {
+            thread_local RingHolder holder(*this);
+            return *holder.ring;
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(m_stopMutex);
+            while(!m_stop)
+            {
+                m_wake.wait_for(lock, std::chrono::milliseconds(10));
+                lock.unlock();
+                drain();
+                lock.lock();
+            }
+        }
+
+        // Formats the records of every ring, one ring after the other
+        void drain()
+        {
+            std::vector<std::shared_ptr<Ring>> rings;
+            {
+                std::lock_guard<std::mutex> lock(m_ringsMutex);
+                rings = m_rings;
+            }
+
+            std::ostringstream out;
+            for(auto& ring : rings)
+            {
+                bool   orphaned = ring->orphaned.load(std::memory_order_acquire);
+                size_t head     = ring->head.load(std::memory_order_relaxed);
+                size_t tail     = ring->tail.load(std::memory_order_acquire);
+                for(; head != tail; head++)
+                {
+                    auto               record = std::move(ring->slots[head % ringSize]);
+                    std::ostringstream line;
+                    record->format(line);
+                    if(!record->bench)
+                        out << line.str();
+                    else if(m_bench[line.str()]++ == 0)
+                        out << line.str() << "\n";
+                }
+                ring->head.store(head, std::memory_order_release);
+
+                if(orphaned)
+                {
+                    std::lock_guard<std::mutex> lock(m_ringsMutex);
+                    m_rings.erase(std::find(m_rings.begin(), m_rings.end(), ring));
+                }
+            }
+
+            if(out.tellp() > 0)
+            {
+                std::lock_guard<std::mutex> lock(log_mutex);
+                *m_os << out.str();
+                m_os->flush();
+            }
+        }
+
+        std::ostream*                           m_os;
+        std::mutex                              m_ringsMutex;
+        std::vector<std::shared_ptr<Ring>>      m_rings;
+        std::atomic<size_t>                     m_dropped{0};
+        std::unordered_map<std::string, size_t> m_bench;
+        std::mutex                              m_stopMutex;
+        std::condition_variable                 m_wake;
+        bool                                    m_stop = false;
+        std::thread                             m_thread;
+    };
+}
+
+void log_enqueue(std::unique_ptr<rocblaslt_log_record> record)
+{
+    AsyncLogger::instance().push(std::move(record));
 }
 
 std::string prefix(const char* layer, const char* caller)
 {
-    time_t now   = time(0);
-    tm*    local = localtime(&now);
+    return prefix(layer, caller, time(0));
+}
+
+std::string prefix(const char* layer, const char* caller, time_t when)
+{
+    tm* local = localtime(&when);
 
     std::string             format = "[%d-%02d-%02d %02d:%02d:%02d][HIPBLASLT][%lu][%s][%s]\0";
     std::unique_ptr<char[]> buf(new char[255]);
@@ -135,6 +322,8 @@ const char* rocblaslt_compute_type_to_string(rocblaslt_compute_type type)
         return "COMPUTE_32F_16F";
     case rocblaslt_compute_f32_fast_bf16:
         return "COMPUTE_32F_16BF";
+    case rocblaslt_compute_f32_fast_3xbf16:
+        return "COMPUTE_32F_3XBF16";
     default:
         return "Invalid";
     }
@@ -158,6 +347,14 @@ const char* rocblaslt_matrix_layout_attributes_to_string(rocblaslt_matrix_layout
         return "ROCBLASLT_MATRIX_LAYOUT_COLS";
     case ROCBLASLT_MATRIX_LAYOUT_LD:
         return "ROCBLASLT_MATRIX_LAYOUT_LD";
+    case ROCBLASLT_MATRIX_LAYOUT_BATCH_MODE:
+        return "ROCBLASLT_MATRIX_LAYOUT_BATCH_MODE";
+    case ROCBLASLT_MATRIX_LAYOUT_SPARSITY:
+        return "ROCBLASLT_MATRIX_LAYOUT_SPARSITY";
+    case ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT:
+        return "ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_COUNT";
+    case ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE:
+        return "ROCBLASLT_MATRIX_LAYOUT_OUTER_BATCH_STRIDE";
     case ROCBLASLT_MATRIX_LAYOUT_MAX:
         return "ROCBLASLT_MATRIX_LAYOUT_MAX";
     default:
@@ -197,10 +394,80 @@ const char* rocblaslt_matmul_desc_attributes_to_string(rocblaslt_matmul_desc_att
         return "MATMUL_DESC_POINTER_MODE";
     case ROCBLASLT_MATMUL_DESC_AMAX_D_POINTER:
         return "MATMUL_DESC_AMAX_D_POINTER";
+    case ROCBLASLT_MATMUL_DESC_RESIDUAL_POINTER:
+        return "MATMUL_DESC_RESIDUAL_POINTER";
+    case ROCBLASLT_MATMUL_DESC_RESIDUAL_DATA_TYPE:
+        return "MATMUL_DESC_RESIDUAL_DATA_TYPE";
+    case ROCBLASLT_MATMUL_DESC_RESIDUAL_LD:
+        return "MATMUL_DESC_RESIDUAL_LD";
+    case ROCBLASLT_MATMUL_DESC_RESIDUAL_BATCH_STRIDE:
+        return "MATMUL_DESC_RESIDUAL_BATCH_STRIDE";
+    case ROCBLASLT_MATMUL_DESC_RESIDUAL_POSITION:
+        return "MATMUL_DESC_RESIDUAL_POSITION";
+    case ROCBLASLT_MATMUL_DESC_DROPOUT_PROBABILITY:
+        return "MATMUL_DESC_DROPOUT_PROBABILITY";
+    case ROCBLASLT_MATMUL_DESC_DROPOUT_SEED_POINTER:
+        return "MATMUL_DESC_DROPOUT_SEED_POINTER";
+    case ROCBLASLT_MATMUL_DESC_DROPOUT_OFFSET_POINTER:
+        return "MATMUL_DESC_DROPOUT_OFFSET_POINTER";
+    case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_POINTER:
+        return "MATMUL_DESC_AMAX_HISTORY_POINTER";
+    case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_LENGTH:
+        return "MATMUL_DESC_AMAX_HISTORY_LENGTH";
+    case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER:
+        return "MATMUL_DESC_AMAX_HISTORY_INDEX_POINTER";
+    case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER:
+        return "MATMUL_DESC_AMAX_HISTORY_SCALE_POINTER";
+    case ROCBLASLT_MATMUL_DESC_AMAX_HISTORY_MARGIN:
+        return "MATMUL_DESC_AMAX_HISTORY_MARGIN";
+    case ROCBLASLT_MATMUL_DESC_A_SCALE_MODE:
+        return "MATMUL_DESC_A_SCALE_MODE";
+    case ROCBLASLT_MATMUL_DESC_B_SCALE_MODE:
+        return "MATMUL_DESC_B_SCALE_MODE";
+    case ROCBLASLT_MATMUL_DESC_B_QUANT_SCALE_POINTER:
+        return "MATMUL_DESC_B_QUANT_SCALE_POINTER";
+    case ROCBLASLT_MATMUL_DESC_B_QUANT_ZERO_POINTER:
+        return "MATMUL_DESC_B_QUANT_ZERO_POINTER";
+    case ROCBLASLT_MATMUL_DESC_B_QUANT_GROUP_SIZE:
+        return "MATMUL_DESC_B_QUANT_GROUP_SIZE";
+    case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE:
+        return "MATMUL_DESC_EPILOGUE_AUX_DATA_TYPE";
+    case ROCBLASLT_MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER:
+        return "MATMUL_DESC_EPILOGUE_AUX_AMAX_POINTER";
+    case ROCBLASLT_MATMUL_DESC_D2_POINTER:
+        return "MATMUL_DESC_D2_POINTER";
+    case ROCBLASLT_MATMUL_DESC_D2_DATA_TYPE:
+        return "MATMUL_DESC_D2_DATA_TYPE";
+    case ROCBLASLT_MATMUL_DESC_D2_LD:
+        return "MATMUL_DESC_D2_LD";
+    case ROCBLASLT_MATMUL_DESC_D2_BATCH_STRIDE:
+        return "MATMUL_DESC_D2_BATCH_STRIDE";
+    case ROCBLASLT_MATMUL_DESC_D2_SCALE_POINTER:
+        return "MATMUL_DESC_D2_SCALE_POINTER";
+    case ROCBLASLT_MATMUL_DESC_BGRAD_DETERMINISTIC:
+        return "MATMUL_DESC_BGRAD_DETERMINISTIC";
+    case ROCBLASLT_MATMUL_DESC_DETERMINISTIC_REDUCTION:
+        return "MATMUL_DESC_DETERMINISTIC_REDUCTION";
+    case ROCBLASLT_MATMUL_DESC_CU_BUDGET:
+        return "MATMUL_DESC_CU_BUDGET";
+    case ROCBLASLT_MATMUL_DESC_COMPLETION_FLAGS_POINTER:
+        return "MATMUL_DESC_COMPLETION_FLAGS_POINTER";
+    case ROCBLASLT_MATMUL_DESC_COMPLETION_CHUNK_COLS:
+        return "MATMUL_DESC_COMPLETION_CHUNK_COLS";
+    case ROCBLASLT_MATMUL_DESC_A_SPARSE_METADATA_POINTER:
+        return "MATMUL_DESC_A_SPARSE_METADATA_POINTER";
+    case ROCBLASLT_MATMUL_DESC_D_CACHE_POLICY:
+        return "MATMUL_DESC_D_CACHE_POLICY";
+    case ROCBLASLT_MATMUL_DESC_B_CACHE_POLICY:
+        return "MATMUL_DESC_B_CACHE_POLICY";
     case ROCBLASLT_MATMUL_DESC_A_SCALE_POINTER_VEC_EXT:
         return "MATMUL_DESC_A_SCALE_POINTER_VEC";
     case ROCBLASLT_MATMUL_DESC_B_SCALE_POINTER_VEC_EXT:
         return "MATMUL_DESC_B_SCALE_POINTER_VEC";
+    case ROCBLASLT_MATMUL_DESC_D_SCALE_POINTER_VEC_EXT:
+        return "MATMUL_DESC_D_SCALE_POINTER_VEC";
+    case ROCBLASLT_MATMUL_DESC_D_SCALE_VEC_ALONG_N_EXT:
+        return "MATMUL_DESC_D_SCALE_VEC_ALONG_N";
     default:
         return "Invalid";
     }
@@ -273,6 +540,14 @@ const char* rocblaslt_epilogue_to_string(rocblaslt_epilogue epilogue)
         return "EPILOGUE_DGELU_BGRADA";
     case ROCBLASLT_EPILOGUE_BGRADB:
         return "EPILOGUE_DGELU_BGRADB";
+    case ROCBLASLT_EPILOGUE_SWIGLU:
+        return "EPILOGUE_SWIGLU";
+    case ROCBLASLT_EPILOGUE_SWIGLU_BIAS:
+        return "EPILOGUE_SWIGLU_BIAS";
+    case ROCBLASLT_EPILOGUE_GEGLU:
+        return "EPILOGUE_GEGLU";
+    case ROCBLASLT_EPILOGUE_GEGLU_BIAS:
+        return "EPILOGUE_GEGLU_BIAS";
     default:
         return "Invalid epilogue";
     }
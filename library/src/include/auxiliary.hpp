@@ -172,6 +172,8 @@ constexpr const char* hipblas_computetype_to_string(hipblasComputeType_t type)
         return "f32_f16_r";
     case HIPBLAS_COMPUTE_32F_FAST_16BF:
         return "f32_bf16_r";
+    case HIPBLASLT_COMPUTE_32F_FAST_3XBF16_EXT:
+        return "f32_3xbf16_r";
     default:
         return "non-supported compute type";
     }
@@ -231,6 +233,7 @@ constexpr hipblasComputeType_t string_to_hipblas_computetype(const std::string&
         value == "i32_r" || value == "i" ? HIPBLAS_COMPUTE_32I :
         value == "f32_f16_r" ? HIPBLAS_COMPUTE_32F_FAST_16F :
         value == "f32_bf16_r" ? HIPBLAS_COMPUTE_32F_FAST_16BF :
+        value == "f32_3xbf16_r" ? HIPBLASLT_COMPUTE_32F_FAST_3XBF16_EXT :
         HIPBLASLT_COMPUTE_TYPE_INVALID;
 }
 
@@ -261,6 +264,10 @@ constexpr hipblasLtEpilogue_t string_to_epilogue_type(const std::string& value)
         value == "HIPBLASLT_EPILOGUE_DGELU_BGRAD" ? HIPBLASLT_EPILOGUE_DGELU_BGRAD :
         value == "HIPBLASLT_EPILOGUE_BGRADA" ? HIPBLASLT_EPILOGUE_BGRADA :
         value == "HIPBLASLT_EPILOGUE_BGRADB" ? HIPBLASLT_EPILOGUE_BGRADB :
+        value == "HIPBLASLT_EPILOGUE_SWIGLU" ? HIPBLASLT_EPILOGUE_SWIGLU :
+        value == "HIPBLASLT_EPILOGUE_SWIGLU_BIAS" ? HIPBLASLT_EPILOGUE_SWIGLU_BIAS :
+        value == "HIPBLASLT_EPILOGUE_GEGLU" ? HIPBLASLT_EPILOGUE_GEGLU :
+        value == "HIPBLASLT_EPILOGUE_GEGLU_BIAS" ? HIPBLASLT_EPILOGUE_GEGLU_BIAS :
         value == "HIPBLASLT_EPILOGUE_DEFAULT" || value == "" ? HIPBLASLT_EPILOGUE_DEFAULT :
         static_cast<hipblasLtEpilogue_t>(0);
 }
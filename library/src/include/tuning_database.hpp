@@ -0,0 +1,372 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include "auxiliary.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tuple>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * Binary tuning database
+ *
+ * A compact form of the HIPBLASLT_TUNING_OVERRIDE_FILE text format that is used
+ * in place, without parsing, from a read-only memory mapping. Processes mapping
+ * the same file share its pages.
+ *
+ * Layout: TuningDatabaseHeader, bucketCount + 1 bucket offsets and entryCount
+ * TuningDatabaseEntry. The entries are sorted by hash bucket and key, and the
+ * entries of a key are ordered by preference. The entries of bucket b are
+ * [offsets[b], offsets[b + 1]).
+ ******************************************************************************/
+struct TuningDatabaseHeader
+{
+    char     magic[8];
+    char     gitVersion[64];
+    uint64_t entryCount;
+    uint64_t bucketCount;
+};
+
+struct TuningDatabaseEntry
+{
+    uint64_t m;
+    uint64_t n;
+    uint64_t k;
+    uint64_t batchSize;
+    int32_t  inputType; // hipDataType
+    int32_t  outputType; // hipDataType
+    int32_t  computeType; // hipDataType
+    uint8_t  transA;
+    uint8_t  transB;
+    uint8_t  reserved[2];
+    int32_t  solutionIndex;
+    int32_t  reserved2;
+};
+
+static_assert(sizeof(TuningDatabaseHeader) == 88, "TuningDatabaseHeader layout changed");
+static_assert(sizeof(TuningDatabaseEntry) == 56, "TuningDatabaseEntry layout changed");
+
+constexpr char tuningDatabaseMagic[8] = {'H', 'B', 'L', 'T', 'T', 'D', 'B', '1'};
+
+// FP8 types of the same format are tuned alike, whether OCP or FNUZ
+inline int32_t tuningDatabaseType(hipDataType type)
+{
+#ifdef ROCM_USE_FLOAT8
+    if(type == HIP_R_8F_E4M3)
+        return HIP_R_8F_E4M3_FNUZ;
+    if(type == HIP_R_8F_E5M2)
+        return HIP_R_8F_E5M2_FNUZ;
+#endif
+    return type;
+}
+
+inline auto tuningDatabaseKey(const TuningDatabaseEntry& entry)
+{
+    return std::make_tuple(entry.transA,
+                           entry.transB,
+                           entry.inputType,
+                           entry.computeType,
+                           entry.outputType,
+                           entry.m,
+                           entry.n,
+                           entry.k,
+                           entry.batchSize);
+}
+
+// FNV-1a over the key fields, so that the hash does not depend on the build
+inline uint64_t tuningDatabaseHash(const TuningDatabaseEntry& entry)
+{
+    uint64_t hash = 14695981039346656037ull;
+    auto     mix  = [&](uint64_t value) {
+        for(int i = 0; i < 8; i++)
+        {
+            hash ^= (value >> (8 * i)) & 0xff;
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(entry.transA);
+    mix(entry.transB);
+    mix(uint32_t(entry.inputType));
+    mix(uint32_t(entry.computeType));
+    mix(uint32_t(entry.outputType));
+    mix(entry.m);
+    mix(entry.n);
+    mix(entry.k);
+    mix(entry.batchSize);
+    return hash;
+}
+
+// Parses a line of the text format, the columns match problemFromEntries() of hipBLASLt
+inline bool tuningDatabaseEntryFromLine(std::string line, TuningDatabaseEntry& entry)
+{
+    line.erase(0, line.find_first_not_of(" \t\n\r\f\v"));
+    if(line.find(',') == std::string::npos || line.find("Git Version") != std::string::npos)
+        return false;
+
+    std::vector<std::string> entries;
+    std::stringstream        line_ss(line);
+    std::string              field;
+    while(getline(line_ss, field, ','))
+        entries.push_back(field);
+    // The time and energy columns of measured lines are not stored
+    if(entries.size() != 37 && entries.size() != 39)
+        return false;
+
+    // Range and bucket sizes only apply to text override files
+    for(int i = 3; i <= 6; i++)
+        if(entries[i].find_first_of(":~") != std::string::npos)
+            return false;
+
+    entry        = TuningDatabaseEntry{};
+    entry.transA = entries[0] != "N";
+    entry.transB = entries[1] != "N";
+    try
+    {
+        entry.batchSize     = std::stol(entries[3]);
+        entry.m             = std::stol(entries[4]);
+        entry.n             = std::stol(entries[5]);
+        entry.k             = std::stol(entries[6]);
+        entry.solutionIndex = std::stoi(entries[34]);
+    }
+    catch(std::logic_error const&)
+    {
+        return false;
+    }
+
+    hipDataType inputType   = string_to_hip_datatype(entries[17]);
+    hipDataType outputType  = string_to_hip_datatype(entries[19]);
+    hipDataType computeType = string_to_hip_datatype(entries[21]);
+    if(inputType == HIPBLASLT_DATATYPE_INVALID || outputType == HIPBLASLT_DATATYPE_INVALID
+       || computeType == HIPBLASLT_DATATYPE_INVALID)
+        return false;
+
+    entry.inputType   = tuningDatabaseType(inputType);
+    entry.outputType  = tuningDatabaseType(outputType);
+    entry.computeType = tuningDatabaseType(computeType);
+    return entry.solutionIndex > 0;
+}
+
+/*******************************************************************************
+ * Converts a text override file to a binary tuning database. As with the text
+ * file, a later line of a problem takes precedence over the earlier ones.
+ * Returns the number of entries written, or -1 on failure.
+ ******************************************************************************/
+inline int64_t writeTuningDatabase(const std::string& textPath, const std::string& binaryPath)
+{
+    std::ifstream file_read(textPath);
+    if(!file_read)
+        return -1;
+
+    TuningDatabaseHeader header{};
+    memcpy(header.magic, tuningDatabaseMagic, sizeof(header.magic));
+
+    using Key = decltype(tuningDatabaseKey(TuningDatabaseEntry{}));
+    std::map<Key, std::vector<TuningDatabaseEntry>> problems;
+
+    std::string line;
+    std::string prefix = "Git Version: ";
+    while(std::getline(file_read, line))
+    {
+        size_t pos = line.find(prefix);
+        if(pos != std::string::npos)
+        {
+            line.substr(pos + prefix.length())
+                .copy(header.gitVersion, sizeof(header.gitVersion) - 1);
+            continue;
+        }
+
+        TuningDatabaseEntry entry;
+        if(!tuningDatabaseEntryFromLine(line, entry))
+            continue;
+
+        auto& solutions = problems[tuningDatabaseKey(entry)];
+        solutions.erase(std::remove_if(solutions.begin(),
+                                       solutions.end(),
+                                       [&](const TuningDatabaseEntry& e) {
+                                           return e.solutionIndex == entry.solutionIndex;
+                                       }),
+                        solutions.end());
+        solutions.insert(solutions.begin(), entry);
+    }
+
+    std::vector<TuningDatabaseEntry> entries;
+    for(auto const& problem : problems)
+        entries.insert(entries.end(), problem.second.begin(), problem.second.end());
+
+    header.entryCount  = entries.size();
+    header.bucketCount = 1;
+    while(header.bucketCount < header.entryCount)
+        header.bucketCount *= 2;
+
+    // Keeps the key order, and so the preference order, inside a bucket
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [&](const TuningDatabaseEntry& a, const TuningDatabaseEntry& b) {
+                         return tuningDatabaseHash(a) % header.bucketCount
+                                < tuningDatabaseHash(b) % header.bucketCount;
+                     });
+
+    std::vector<uint64_t> offsets(header.bucketCount + 1, 0);
+    for(auto const& entry : entries)
+        offsets[tuningDatabaseHash(entry) % header.bucketCount + 1]++;
+    for(size_t b = 0; b < header.bucketCount; b++)
+        offsets[b + 1] += offsets[b];
+
+    std::ofstream file_write(binaryPath, std::ios::binary | std::ios::trunc);
+    file_write.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_write.write(reinterpret_cast<const char*>(offsets.data()),
+                     offsets.size() * sizeof(uint64_t));
+    file_write.write(reinterpret_cast<const char*>(entries.data()),
+                     entries.size() * sizeof(TuningDatabaseEntry));
+    return file_write ? int64_t(entries.size()) : -1;
+}
+
+/*******************************************************************************
+ * Read-only view of a binary tuning database mapped into memory
+ ******************************************************************************/
+class TuningDatabase
+{
+public:
+    TuningDatabase() = default;
+    ~TuningDatabase()
+    {
+        if(m_data)
+            munmap(m_data, m_size);
+    }
+
+    // copy contructor
+    TuningDatabase(const TuningDatabase&) = delete;
+    // assignment operator
+    TuningDatabase& operator=(const TuningDatabase&) = delete;
+
+    static bool isDatabase(const std::string& path)
+    {
+        char          magic[sizeof(tuningDatabaseMagic)] = {};
+        std::ifstream file_read(path, std::ios::binary);
+        file_read.read(magic, sizeof(magic));
+        return file_read && memcmp(magic, tuningDatabaseMagic, sizeof(magic)) == 0;
+    }
+
+    // Reads the version from the header only, without mapping the file
+    static std::string gitVersion(const std::string& path)
+    {
+        TuningDatabaseHeader header{};
+        std::ifstream        file_read(path, std::ios::binary);
+        file_read.read(reinterpret_cast<char*>(&header), sizeof(header));
+        return std::string(header.gitVersion,
+                           strnlen(header.gitVersion, sizeof(header.gitVersion)));
+    }
+
+    bool open(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+
+        struct stat st;
+        if(fstat(fd, &st) == 0 && size_t(st.st_size) >= sizeof(TuningDatabaseHeader))
+        {
+            void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if(data != MAP_FAILED)
+            {
+                m_data = data;
+                m_size = st.st_size;
+            }
+        }
+        close(fd);
+
+        if(!m_data)
+            return false;
+
+        auto header = static_cast<const TuningDatabaseHeader*>(m_data);
+        if(memcmp(header->magic, tuningDatabaseMagic, sizeof(header->magic)) != 0
+           || header->bucketCount == 0
+           || m_size
+                  != sizeof(TuningDatabaseHeader) + (header->bucketCount + 1) * sizeof(uint64_t)
+                         + header->entryCount * sizeof(TuningDatabaseEntry))
+        {
+            munmap(m_data, m_size);
+            m_data = nullptr;
+            return false;
+        }
+
+        m_header  = header;
+        m_offsets = reinterpret_cast<const uint64_t*>(header + 1);
+        m_entries
+            = reinterpret_cast<const TuningDatabaseEntry*>(m_offsets + header->bucketCount + 1);
+        return true;
+    }
+
+    std::string gitVersion() const
+    {
+        return m_header ? std::string(m_header->gitVersion,
+                                      strnlen(m_header->gitVersion, sizeof(m_header->gitVersion)))
+                        : std::string();
+    }
+
+    size_t size() const
+    {
+        return m_header ? m_header->entryCount : 0;
+    }
+
+    // Returns the entries of the key in order of preference
+    std::pair<const TuningDatabaseEntry*, const TuningDatabaseEntry*>
+        find(const TuningDatabaseEntry& key) const
+    {
+        if(!m_header)
+            return {nullptr, nullptr};
+
+        uint64_t bucket = tuningDatabaseHash(key) % m_header->bucketCount;
+        auto     first  = m_entries + m_offsets[bucket];
+        auto     last   = m_entries + m_offsets[bucket + 1];
+        auto     match  = tuningDatabaseKey(key);
+
+        auto same = [&](const TuningDatabaseEntry& e) { return tuningDatabaseKey(e) == match; };
+        first     = std::find_if(first, last, same);
+        last      = std::find_if_not(first, last, same);
+        return {first, last};
+    }
+
+private:
+    void*                       m_data    = nullptr;
+    size_t                      m_size    = 0;
+    const TuningDatabaseHeader* m_header  = nullptr;
+    const uint64_t*             m_offsets = nullptr;
+    const TuningDatabaseEntry*  m_entries = nullptr;
+};
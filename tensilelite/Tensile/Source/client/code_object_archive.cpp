@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+// Packs the code object files of one architecture into the CodeObjectArchive
+// that hip::SolutionAdapter maps instead of opening each file, and which it
+// looks for as TensileCodeObjects_<arch>.coa next to the files.
+//
+//   tensile_code_object_archive TensileCodeObjects_gfx942.coa *gfx942*.co *gfx942*.hsaco
+
+#include <Tensile/CodeObjectArchive.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output.coa> <code object file>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> files(argv + 2, argv + argc);
+    if(!TensileLite::WriteCodeObjectArchive(argv[1], files))
+    {
+        std::cerr << "Could not write " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto archive = TensileLite::CodeObjectArchive::Open(argv[1]);
+    if(!archive)
+    {
+        std::cerr << "Could not read back " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << archive->size() << " code objects packed in " << argv[1] << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -30,6 +30,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -108,6 +109,16 @@ namespace TensileLite
             const bool m_syncAfterWarmups = true;
             const int  m_sleepPercent;
 
+            // With per-iteration-timing every enqueue is timed on its own, the time reported
+            // is the median. With timing-ci-target the enqueues go on past the set number until
+            // the confidence interval of the median is narrow enough.
+            const bool          m_perIterationTiming;
+            const double        m_timingCiTarget;
+            const int           m_maxTimingEnqueues;
+            std::vector<double> m_enqueueTimesUs;
+            size_t              m_nextTimingCheck = 0;
+            bool                m_timingConverged = false;
+
             int m_numBenchmarksRun = 0;
 
             Hardware const&     m_hardware;
@@ -33,6 +33,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include "ColumnarResultsFile.hpp"
+
 namespace TensileLite
 {
     namespace Client
@@ -43,6 +45,8 @@ namespace TensileLite
             CSVStackFile(std::string const& filename, std::string const& separator = ", ");
             CSVStackFile(std::ostream& stream, std::string const& separator = ", ");
             CSVStackFile(std::shared_ptr<std::ostream> stream, std::string const& separator = ", ");
+            // Rows go to a ColumnarResultsWriter instead of CSV text
+            explicit CSVStackFile(std::shared_ptr<ColumnarResultsWriter> columnar);
 
             ~CSVStackFile();
 
@@ -71,9 +75,11 @@ namespace TensileLite
             std::string escape(std::string const& value);
             std::string escapeQuote(std::string const& value);
 
+            void writeHeader();
             void writeRow(std::unordered_map<std::string, std::string> const& row);
 
-            std::shared_ptr<std::ostream> m_stream;
+            std::shared_ptr<std::ostream>          m_stream;
+            std::shared_ptr<ColumnarResultsWriter> m_columnar;
 
             std::string m_separator;
 
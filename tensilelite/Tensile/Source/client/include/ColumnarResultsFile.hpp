@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace TensileLite
+{
+    namespace Client
+    {
+        /**
+         * Buffered binary results file, for sweeps whose CSV text is slow to write and to
+         * load. Rows are gathered in blocks of RowsPerBlock and a background thread writes
+         * each block column by column:
+         *
+         *   file:   "TLRC" magic, uint32 version, blocks until the end of the file
+         *   block:  uint32 rows, uint32 columns, columns
+         *   column: uint32 name size, name, uint32 value end offsets[rows], value bytes
+         *
+         * Integers are little endian. Columns only ever get appended, so the columns of a
+         * block extend the ones of the blocks before it.
+         */
+        class ColumnarResultsWriter
+        {
+        public:
+            static constexpr uint32_t RowsPerBlock  = 4096;
+            static constexpr size_t   MaxQueued     = 4;
+            static constexpr char     Magic[4]      = {'T', 'L', 'R', 'C'};
+            static constexpr uint32_t FormatVersion = 1;
+
+            explicit ColumnarResultsWriter(std::string const& filename);
+
+            // Writes the partial block and waits for the background thread
+            ~ColumnarResultsWriter();
+
+            void appendRow(std::vector<std::string> const& names,
+                           std::vector<std::string>&&      values);
+
+        private:
+            struct Block
+            {
+                uint32_t                              rows = 0;
+                std::vector<std::string>              names;
+                std::vector<std::vector<std::string>> columns;
+            };
+
+            void submit();
+            void writerLoop();
+            void writeBlock(Block const& block);
+
+            std::ofstream m_file;
+            Block         m_block;
+
+            std::mutex              m_mutex;
+            std::condition_variable m_cv;
+            std::deque<Block>       m_queue;
+            bool                    m_done = false;
+            std::thread             m_thread;
+        };
+
+        /**
+         * Writes a file of ColumnarResultsWriter as the CSV ResultFileReporter would have
+         * written. The header holds the columns of the last block, so unlike the CSV text
+         * it also names the columns that appeared after the first row.
+         */
+        bool ColumnarResultsToCsv(std::string const& filename, std::ostream& output);
+    } // namespace Client
+} // namespace TensileLite
@@ -38,6 +38,7 @@
 #include <random>
 
 #include "RunListener.hpp"
+#include "Utility.hpp"
 
 namespace po = boost::program_options;
 
@@ -156,7 +157,8 @@ namespace TensileLite
             std::shared_ptr<ProblemInputs>
                 prepareCPUInputs(ContractionProblemGroupedGemm const& problem)
             {
-                if(m_cpuInit && m_curBoundsCheck == BoundsCheckMode::Disable
+                bool typesChanged = inputTypesChanged(m_cpuTypes, problem.gemms[0]);
+                if(m_cpuInit && !typesChanged && m_curBoundsCheck == BoundsCheckMode::Disable
                    && !m_problemDependentData)
                 {
                     std::vector<void**> bPtr;
@@ -179,7 +181,7 @@ namespace TensileLite
                                m_groupedOffsets,
                                problem.gemms[0],
                                hipMemcpyHostToHost);
-                    m_cpuInit = false;
+                    m_cpuInit = true;
                 }
                 initializeConstantInputs(problem.gemms[0]);
 
@@ -188,7 +190,8 @@ namespace TensileLite
 
             std::shared_ptr<ProblemInputs> prepareCPUInputs(ContractionProblemGemm const& problem)
             {
-                if(m_cpuInit && m_curBoundsCheck == BoundsCheckMode::Disable
+                bool typesChanged = inputTypesChanged(m_cpuTypes, problem);
+                if(m_cpuInit && !typesChanged && m_curBoundsCheck == BoundsCheckMode::Disable
                    && !m_problemDependentData)
                 {
                     std::vector<void**> bPtr;
@@ -211,7 +214,7 @@ namespace TensileLite
                                m_groupedOffsets,
                                problem,
                                hipMemcpyHostToHost);
-                    m_cpuInit = false;
+                    m_cpuInit = true;
                 }
                 initializeConstantInputs(problem);
 
@@ -258,7 +261,8 @@ namespace TensileLite
                     kind = hipMemcpyHostToDevice;
                 }
 
-                if(m_gpuInit && m_curBoundsCheck == BoundsCheckMode::Disable
+                bool typesChanged = inputTypesChanged(m_gpuTypes, problem.gemms[0]);
+                if(m_gpuInit && !typesChanged && m_curBoundsCheck == BoundsCheckMode::Disable
                    && !m_problemDependentData)
                 {
                     if(m_elementsToValidate)
@@ -315,7 +319,8 @@ namespace TensileLite
                     kind = hipMemcpyHostToDevice;
                 }
 
-                if(m_gpuInit && m_curBoundsCheck == BoundsCheckMode::Disable
+                bool typesChanged = inputTypesChanged(m_gpuTypes, problem);
+                if(m_gpuInit && !typesChanged && m_curBoundsCheck == BoundsCheckMode::Disable
                    && !m_problemDependentData)
                 {
                     if(m_elementsToValidate)
@@ -954,6 +959,11 @@ namespace TensileLite
 
             void copyValidToGPUBuffer(ContractionProblemGemm const& problem);
 
+            /// Stores the tensor data types of the problem in types and returns whether
+            /// they changed, the inputs are copied again from the pristine of the new types.
+            bool inputTypesChanged(std::vector<DataType>&        types,
+                                   ContractionProblemGemm const& problem);
+
             void initializeGPUBatchedInputs(ContractionProblemGemm const& problem);
 
             void initializeCPUInputs(ContractionProblemGroupedGemm const& problem);
@@ -1005,8 +1015,12 @@ namespace TensileLite
             std::shared_ptr<void>                 m_workspacePristine;
             std::vector<ConstDataInitProperties>  m_cdata;
 
-            bool m_cpuInit = false;
-            bool m_gpuInit = false;
+            /// Once set, the working copies of the inputs are kept across problems and only
+            /// the outputs are reset, until the data types or the bounds check mode change.
+            bool                  m_cpuInit = false;
+            bool                  m_gpuInit = false;
+            std::vector<DataType> m_cpuTypes;
+            std::vector<DataType> m_gpuTypes;
 
             size_t m_maxBatch;
 
@@ -1052,6 +1066,10 @@ namespace TensileLite
             int64_t                         m_rotatingBuffer = 0;
             std::shared_ptr<RotatingMemory> m_rm;
             int32_t                         m_rotatingMode = 0;
+            /// rotating-buffer-size -1: sized per problem from the caches so
+            /// that every launch reads cold operands.
+            bool                            m_rotatingAuto = false;
+            DeviceCacheSizes                m_caches;
         };
 
         template <>
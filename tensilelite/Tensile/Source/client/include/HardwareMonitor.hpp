@@ -70,11 +70,14 @@ namespace TensileLite
                                 rsmi_temperature_metric_t metric     = RSMI_TEMP_CURRENT);
             void addClockMonitor(rsmi_clk_type_t clockType);
             void addFanSpeedMonitor(uint32_t sensorIndex = 0);
+            void addPowerMonitor(uint32_t sensorIndex = 0);
 
             double getAverageTemp(rsmi_temperature_type_t   sensorIndex = 0,
                                   rsmi_temperature_metric_t metric      = RSMI_TEMP_CURRENT);
             double getAverageClock(rsmi_clk_type_t clockType);
             double getAverageFanSpeed(uint32_t sensorIndex = 0);
+            // Average socket power in watts
+            double getAveragePower(uint32_t sensorIndex = 0);
             int    getDeviceIndex()
             {
                 return m_hipDeviceIndex;
@@ -154,6 +157,9 @@ namespace TensileLite
             std::vector<uint32_t> m_fanMetrics;
             std::vector<int64_t>  m_fanValues;
 
+            std::vector<uint32_t> m_powerMetrics;
+            std::vector<uint64_t> m_powerValues; // Microwatts
+
             uint64_t m_maxFreqValues; // The frequency is in Mhz
             bool     has_maxFreqValues         = false;
             bool     m_hasInvalidGpuFreqStatus = false;
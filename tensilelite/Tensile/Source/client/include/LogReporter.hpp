@@ -108,39 +108,54 @@ namespace TensileLite
                 const std::string perfUnit
                     = (metric == PerformanceMetric::CUEfficiency ? SpeedGFlopsPerCu : SpeedGFlops);
 
-                return std::shared_ptr<LogReporter>(new LogReporter(level,
-                                                                    {BenchmarkRunNumber,
-                                                                     ProblemProgress,
-                                                                     SolutionProgress,
-                                                                     OperationIdentifier,
-                                                                     ProblemSizes,
-                                                                     BiasType,
-                                                                     FactorDim,
-                                                                     ActivationType,
-                                                                     SolutionName,
-                                                                     Validation,
-                                                                     TimeUS,
-                                                                     perfUnit,
-                                                                     Empty,
-                                                                     TotalGranularity,
-                                                                     TilesPerCu,
-                                                                     NumCus,
-                                                                     Tile0Granularity,
-                                                                     Tile1Granularity,
-                                                                     CuGranularity,
-                                                                     WaveGranularity,
-                                                                     MemReadBytes,
-                                                                     MemWriteBytes,
-                                                                     TempEdge,
-                                                                     ClockRateSys,
-                                                                     ClockRateSOC,
-                                                                     ClockRateMem,
-                                                                     FanSpeedRPMs,
-                                                                     HardwareSampleCount,
-                                                                     EnqueueTime},
-                                                                    stream,
-                                                                    dumpTensors,
-                                                                    PrintWinnersOnly));
+                auto reporter = std::shared_ptr<LogReporter>(new LogReporter(level,
+                                                                             {BenchmarkRunNumber,
+                                                                              ProblemProgress,
+                                                                              SolutionProgress,
+                                                                              OperationIdentifier,
+                                                                              ProblemSizes,
+                                                                              BiasType,
+                                                                              FactorDim,
+                                                                              ActivationType,
+                                                                              SolutionName,
+                                                                              Validation,
+                                                                              TimeUS,
+                                                                              perfUnit,
+                                                                              Empty,
+                                                                              TotalGranularity,
+                                                                              TilesPerCu,
+                                                                              NumCus,
+                                                                              Tile0Granularity,
+                                                                              Tile1Granularity,
+                                                                              CuGranularity,
+                                                                              WaveGranularity,
+                                                                              MemReadBytes,
+                                                                              MemWriteBytes,
+                                                                              TempEdge,
+                                                                              ClockRateSys,
+                                                                              ClockRateSOC,
+                                                                              ClockRateMem,
+                                                                              FanSpeedRPMs,
+                                                                              PowerWatts,
+                                                                              EnergyPerCallUJ,
+                                                                              HardwareSampleCount,
+                                                                              EnqueueTime},
+                                                                             stream,
+                                                                             dumpTensors,
+                                                                             PrintWinnersOnly));
+                if(args["per-iteration-timing"].as<bool>()
+                   || args["timing-ci-target"].as<double>() > 0)
+                {
+                    // Spread of the per-call times, see BenchmarkTimer
+                    for(auto const& key : {TimeUSP90,
+                                           TimeUSP99,
+                                           TimeUSCILow,
+                                           TimeUSCIHigh,
+                                           TimedCalls,
+                                           TimingOutliers})
+                        reporter->m_csvOutput.setHeaderForKey(key, key);
+                }
+                return reporter;
             }
 
             static std::shared_ptr<LogReporter> Default(po::variables_map const& args)
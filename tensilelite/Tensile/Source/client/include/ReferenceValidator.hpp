@@ -36,6 +36,7 @@
 #include "DataInitialization.hpp"
 
 #include <cstddef>
+#include <map>
 
 namespace TensileLite
 {
@@ -115,6 +116,12 @@ namespace TensileLite
                                    bool                    isgpu,
                                    size_t                  validationStride);
 
+            template <typename ValidType>
+            bool deviceResultsMatch(TensorDescriptor const& tensor,
+                                    ValidType const*        reference,
+                                    ValidType const*        result,
+                                    size_t                  validationStride);
+
             void printTensors(ContractionProblemGemm const& problem,
                               ContractionInputs const&      reference,
                               ContractionInputs const&      result);
@@ -132,6 +139,19 @@ namespace TensileLite
             size_t                   m_cpuResultBufferSize = 0;
             std::shared_ptr<uint8_t> m_cpuResultBuffer;
 
+            /*
+             * Device copy of a reference output tensor, keyed by its CPU buffer. Uploaded on
+             * the first solution of a problem and dropped in preProblem, since the reference
+             * buffers are reused for the next problem.
+             */
+            struct DeviceReference
+            {
+                std::shared_ptr<void> data;
+                bool comparable = false; // every compared reference element is finite
+            };
+            std::map<void const*, DeviceReference> m_deviceReferences;
+            std::shared_ptr<unsigned long long>    m_deviceMismatches;
+
             ContractionProblem* m_problem;
 
             bool m_enabled;
@@ -47,7 +47,8 @@ namespace TensileLite
             ResultFileReporter(std::string const& filename,
                                bool               exportExtraCols,
                                bool               mergeSameProblems,
-                               PerformanceMetric  performanceMetric);
+                               PerformanceMetric  performanceMetric,
+                               bool               columnar = false);
 
             virtual void reportValue_string(std::string const& key,
                                             std::string const& value) override;
@@ -84,6 +85,9 @@ namespace TensileLite
             double      m_fasterTimeUS            = -1.0;
             double      m_fastestTilesPerCu       = -1.0;
             double      m_fastestTotalGranularity = -1.0;
+            // Hardware counters of the current and the fastest solution
+            std::map<std::string, std::string> m_solutionCounters;
+            std::map<std::string, std::string> m_winnerCounters;
             // for merge rows
             int64_t                                                         m_currProbID = -1;
             std::map<int64_t, std::unordered_map<std::string, std::string>> m_probMap;
@@ -97,6 +97,14 @@ namespace TensileLite
             const std::string EnqueueTime      = "enqueue-time";
             const std::string FastestGFlops    = "fastest-gflops";
 
+            // Spread of the per-call times with --per-iteration-timing, see BenchmarkTimer
+            const std::string TimeUSP90      = "time-us-p90";
+            const std::string TimeUSP99      = "time-us-p99";
+            const std::string TimeUSCILow    = "time-us-ci-low";
+            const std::string TimeUSCIHigh   = "time-us-ci-high";
+            const std::string TimedCalls     = "timed-calls";
+            const std::string TimingOutliers = "timing-outliers";
+
             // Performance estimation and granularity
             const std::string Tile0Granularity = "tile0-gran";
             const std::string Tile1Granularity = "tile1-gran";
@@ -127,8 +135,16 @@ namespace TensileLite
             const std::string ClockRateMem        = "clock-mem"; // Mem clock in Mhz
             const std::string DeviceIndex         = "device-idx";
             const std::string FanSpeedRPMs        = "fan-rpm";
+            const std::string PowerWatts          = "power-w";   // Average socket power
+            const std::string EnergyPerCallUJ     = "energy-uj"; // Microjoules per call
             const std::string HardwareSampleCount = "hardware-samples";
             const std::string GfxFrequency        = "gfx-frequency(maximum)"; // GPU freq in Mhz
+
+            // Hardware counters of a launch, see HardwareCounterListener
+            const std::string L2HitRate        = "l2-hit-rate"; // Percent
+            const std::string HbmBytes         = "hbm-bytes";
+            const std::string LdsBankConflicts = "lds-bank-conflict-cycles";
+            const std::string MfmaUtilization  = "mfma-utilization"; // Percent
         }; // namespace ResultKey
 
         class ResultReporter : public RunListener
@@ -54,6 +54,7 @@ namespace TensileLite
         std::shared_ptr<void> getData() const;
         size_t getDataSize() const;
         size_t getDataLargestUnitSize() const;
+        size_t getLargestTotalSize() const;
     private:
         size_t m_rotatingBufferNum;
         size_t m_rotatingSize;
@@ -31,6 +31,7 @@
 #include <boost/program_options.hpp>
 
 #include <functional>
+#include <limits>
 #include <vector>
 
 #include "RunListener.hpp"
@@ -164,7 +165,7 @@ namespace TensileLite
             virtual std::shared_ptr<ContractionSolution> getSolution() override;
             virtual bool                                 runCurrentSolution() override;
 
-        private:
+        protected:
             int m_firstSolutionIdx;
             int m_lastSolutionIdx;
 
@@ -173,6 +174,68 @@ namespace TensileLite
             RunCriteria m_runCriteria;
         };
 
+        /**
+ * Runs the solutions of AllSolutionsIterator in the order of their predicted time and
+ * prunes the slow ones early. A single warmup of every solution is timed, solutions more
+ * than pruneMargin behind the fastest warmup so far skip the timed runs, and solutions
+ * whose predicted time, scaled by the best ratio of warmup to predicted time seen so far,
+ * is already that far behind are not run at all.
+ */
+        class PruningSolutionIterator : public AllSolutionsIterator
+        {
+        public:
+            PruningSolutionIterator(
+                std::shared_ptr<MasterSolutionLibrary<ContractionProblemGemm>> library,
+                std::shared_ptr<Hardware>                                      hardware,
+                int                                                            firstSolutionIdx,
+                int                                                            numSolutions,
+                bool                                                           printWinnerOnly,
+                double                                                         pruneMargin,
+                RunCriteria runCriteria = RunCriteria());
+
+            virtual void preProblem(ContractionProblem* const problem) override;
+            virtual void postProblem() override;
+
+            virtual void preSolution(ContractionSolution const& solution) override;
+            virtual void postSolution() override;
+
+            virtual size_t numWarmupRuns() override
+            {
+                return 1;
+            }
+            virtual void postWarmup(TimingEvents const& startEvents,
+                                    TimingEvents const& stopEvents,
+                                    hipStream_t const&  stream) override;
+
+            virtual bool                                 moreSolutionsInProblem() const override;
+            virtual std::shared_ptr<ContractionSolution> getSolution() override;
+            virtual bool                                 runCurrentSolution() override;
+
+            // True once the warmup of the current solution is too slow to time it
+            bool pruneCurrentSolution() const
+            {
+                return m_pruneCurrent;
+            }
+
+        private:
+            struct Candidate
+            {
+                int    index;
+                double predicted;
+            };
+
+            double m_pruneMargin;
+
+            std::vector<Candidate> m_candidates;
+            size_t                 m_position = 0;
+
+            double m_bestWarmupUs     = std::numeric_limits<double>::infinity();
+            double m_bestUsPerPredict = std::numeric_limits<double>::infinity();
+            bool   m_pruneCurrent     = false;
+            size_t m_numPredictPruned = 0;
+            size_t m_numWarmupPruned  = 0;
+        };
+
         class BestSolutionIterator : public SolutionIterator
         {
         public:
@@ -27,7 +27,12 @@
 #pragma once
 #include <hip/hip_runtime.h>
 #include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
 #include <sstream>
+#include <string>
 #include <vector>
 
 namespace TensileLite
@@ -66,5 +71,127 @@ namespace TensileLite
             };
             return ptrs;
         }
+        struct DeviceCacheSizes
+        {
+            size_t l2   = 0;
+            size_t mall = 0;
+        };
+
+        // HIP reports the L2 only, the MALL (Infinity Cache) sizes are per architecture.
+        // Parts of an architecture with a smaller MALL are still covered by the larger size.
+        inline DeviceCacheSizes deviceCacheSizes(int device)
+        {
+            constexpr size_t MiB = 1024 * 1024;
+
+            DeviceCacheSizes sizes;
+            hipDeviceProp_t  hipProps;
+            if(hipGetDeviceProperties(&hipProps, device) != hipSuccess)
+                return sizes;
+            sizes.l2 = size_t(hipProps.l2CacheSize);
+
+            std::string arch(hipProps.gcnArchName);
+            arch = arch.substr(0, arch.find(':'));
+            if(arch == "gfx942" || arch == "gfx950")
+                sizes.mall = 256 * MiB;
+            else if(arch == "gfx1030")
+                sizes.mall = 128 * MiB;
+            else if(arch == "gfx1100" || arch == "gfx1031")
+                sizes.mall = 96 * MiB;
+            else if(arch == "gfx1101" || arch == "gfx1201")
+                sizes.mall = 64 * MiB;
+            else if(arch == "gfx1102" || arch == "gfx1032" || arch == "gfx1200")
+                sizes.mall = 32 * MiB;
+            return sizes;
+        }
+
+        // Rotating size, in bytes, after which the operands of a problem needing unitSize
+        // bytes are no longer cached when they are reused: twice the caches, as their
+        // replacement is not strictly LRU, plus the unit itself so at least two are rotated.
+        inline size_t coldCacheRotatingSize(DeviceCacheSizes const& caches, size_t unitSize)
+        {
+            return 2 * (caches.l2 + caches.mall) + unitSize;
+        }
+
+        struct TimingStatistics
+        {
+            size_t samples  = 0; // kept after the outlier rejection
+            size_t outliers = 0;
+            double mean     = 0.0;
+            double median   = 0.0;
+            double p90      = 0.0;
+            double p99      = 0.0;
+            double ciLow    = 0.0; // confidence interval of the median
+            double ciHigh   = 0.0;
+
+            // Width of the confidence interval relative to the median
+            double ciRelativeWidth() const
+            {
+                return median > 0.0 ? (ciHigh - ciLow) / median : 0.0;
+            }
+        };
+
+        // Linear interpolation between the closest ranks of sorted
+        inline double sortedPercentile(std::vector<double> const& sorted, double fraction)
+        {
+            if(sorted.empty())
+                return 0.0;
+            double rank  = fraction * (sorted.size() - 1);
+            size_t lower = size_t(rank);
+            size_t upper = std::min(lower + 1, sorted.size() - 1);
+            return sorted[lower] + (rank - lower) * (sorted[upper] - sorted[lower]);
+        }
+
+        // Statistics of per-call times. Times further than 5 scaled median absolute deviations
+        // from the median, such as calls preempted on a shared node, are dropped first. The
+        // interval is a percentile bootstrap of the median with a fixed seed, so the same
+        // times give the same interval.
+        inline TimingStatistics timingStatistics(std::vector<double> times,
+                                                 double              confidence = 0.95,
+                                                 size_t              resamples  = 1000)
+        {
+            TimingStatistics stats;
+            if(times.empty())
+                return stats;
+
+            std::sort(times.begin(), times.end());
+            double              median = sortedPercentile(times, 0.5);
+            std::vector<double> deviations(times.size());
+            for(size_t i = 0; i < times.size(); i++)
+                deviations[i] = std::abs(times[i] - median);
+            std::sort(deviations.begin(), deviations.end());
+            double mad = 1.4826 * sortedPercentile(deviations, 0.5);
+            if(mad > 0.0)
+            {
+                auto kept = std::remove_if(times.begin(), times.end(), [&](double time) {
+                    return std::abs(time - median) > 5.0 * mad;
+                });
+                stats.outliers = times.end() - kept;
+                times.erase(kept, times.end());
+            }
+
+            stats.samples = times.size();
+            stats.median  = sortedPercentile(times, 0.5);
+            stats.p90     = sortedPercentile(times, 0.9);
+            stats.p99     = sortedPercentile(times, 0.99);
+            for(double time : times)
+                stats.mean += time;
+            stats.mean /= times.size();
+
+            std::mt19937                          generator(times.size());
+            std::uniform_int_distribution<size_t> pick(0, times.size() - 1);
+            std::vector<double>                   medians(resamples);
+            std::vector<double>                   resample(times.size());
+            for(auto& resampled : medians)
+            {
+                for(auto& time : resample)
+                    time = times[pick(generator)];
+                std::sort(resample.begin(), resample.end());
+                resampled = sortedPercentile(resample, 0.5);
+            }
+            std::sort(medians.begin(), medians.end());
+            stats.ciLow  = sortedPercentile(medians, (1.0 - confidence) / 2);
+            stats.ciHigh = sortedPercentile(medians, (1.0 + confidence) / 2);
+            return stats;
+        }
     } // namespace Client
 } // namespace TensileLite
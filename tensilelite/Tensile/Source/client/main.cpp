@@ -35,6 +35,7 @@
 #include "BenchmarkTimer.hpp"
 #include "ClientProblemFactory.hpp"
 #include "DataInitialization.hpp"
+#include "HardwareCounterListener.hpp"
 #include "HardwareMonitorListener.hpp"
 #include "MetaRunListener.hpp"
 #include "ProgressListener.hpp"
@@ -267,7 +268,13 @@ namespace TensileLite
                 ("min-flops-per-sync",       po::value<size_t>()->default_value(0), "Minimum number of flops per sync to increase stability for small problems.")
                 ("use-gpu-timer",            po::value<bool>()->default_value(true), "Use GPU timer")
                 ("sleep-percent",            po::value<int>()->default_value(0), "Sleep percentage")
+                ("per-iteration-timing",     po::value<bool>()->default_value(false), "Time every enqueue with events of its own. time-us is then the median, "
+                                                                                      "with the p90, p99 and 95% confidence interval of the median, after dropping the outliers.")
+                ("timing-ci-target",         po::value<double>()->default_value(0.0), "Keep timing a solution until the confidence interval of its median is narrower than this "
+                                                                                      "percent of the median. Turns on per-iteration-timing. 0 runs the set number of enqueues.")
+                ("timing-max-enqueues",      po::value<int>()->default_value(1000), "Most enqueues of a solution with timing-ci-target")
                 ("hardware-monitor",         po::value<bool>()->default_value(true), "Use hardware monitor.")
+                ("hardware-counters",        po::value<bool>()->default_value(false), "Collect L2, HBM, LDS and MFMA counters of the warmups with rocprofiler.")
 
                 ("perf-l2-read-hits",        po::value<double>()->default_value(0.0), "L2 read hits")
                 ("perf-l2-write-hits",       po::value<double>()->default_value(0.5), "L2 write hits")
@@ -317,6 +324,8 @@ namespace TensileLite
                 ("best-solution",            po::value<bool>()->default_value(false), "Best solution benchmark mode")
 
                 ("results-file",             po::value<std::string>()->default_value("results.csv"), "File name to write results.")
+                ("results-file-format",      po::value<std::string>()->default_value("csv"),         "csv, or columnar for the buffered binary "
+                                                                                                      "format that tensile_results_to_csv converts.")
                 ("log-file",                 po::value<std::string>(),                               "File name for output log.")
                 ("log-file-append",          po::value<bool>()->default_value(false),                "Append to log file.")
                 ("log-level",                po::value<LogLevel>()->default_value(LogLevel::Debug),  "Log level")
@@ -333,6 +342,7 @@ namespace TensileLite
                 ("selection-only",           po::value<bool>()->default_value(false), "Don't run any solutions, only print kernel selections.")
                 ("max-workspace-size",       po::value<size_t>()->default_value(32*1024*1024), "Max workspace for training")
                 ("granularity-threshold",    po::value<double>()->default_value(0.0), "Don't run a solution if total granularity is below")
+                ("prune-solutions",          po::value<double>()->default_value(0.0), "Run solutions fastest predicted first, skip those more than this percent slower than the best warmup so far")
 
                 ("activation-type",           po::value<ActivationType>()->default_value(ActivationType::None), "An activation type")
                 ("activation-hpa",            po::value<bool>()->default_value(false), "Use the same data type as high precision accumulate.")
@@ -350,7 +360,7 @@ namespace TensileLite
                 ("use-e",                     po::value<bool>()->default_value(false), "Use E.")
                 ("use-gradient",              po::value<bool>()->default_value(false), "Use gradient.")
                 ("use-user-args",             po::value<bool>()->default_value(false), "Use user argument structure as kernel input.")
-                ("rotating-buffer-size",      po::value<int32_t>()->default_value(0), "Size of rotating buffer in the unit of MB.")
+                ("rotating-buffer-size",      po::value<int32_t>()->default_value(0), "Size of rotating buffer in the unit of MB. -1 sizes it per problem from the L2 and MALL so every launch reads cold operands.")
                 ("rotating-buffer-mode",      po::value<int32_t>()->default_value(0), "Rotating mode.")
                 ("output-amaxD",              po::value<bool>()->default_value(false), "Output AmaxD.")
                 ;
@@ -622,6 +632,8 @@ int main(int argc, const char* argv[])
     int         firstSolutionIdx = args["solution-start-idx"].as<int>();
     int         numSolutions     = args["num-solutions"].as<int>();
     bool        gpuTimer         = args["use-gpu-timer"].as<bool>();
+    bool        perIteration     = gpuTimer && (args["per-iteration-timing"].as<bool>()
+                                                || args["timing-ci-target"].as<double>() > 0);
     bool        runKernels       = !args["selection-only"].as<bool>();
     bool        exitOnError      = args["exit-on-error"].as<bool>();
     bool        groupedGemm      = args["grouped-gemm"].as<bool>();
@@ -648,6 +660,7 @@ int main(int argc, const char* argv[])
     auto  dataInit = std::shared_ptr<DataInitialization>(ptr);
 
     auto solutionIterator = SolutionIterator::Default(library, hardware, args);
+    auto pruningIterator  = std::dynamic_pointer_cast<PruningSolutionIterator>(solutionIterator);
 
     MetaRunListener listeners;
 
@@ -666,6 +679,7 @@ int main(int argc, const char* argv[])
         benchmarkTimer = std::make_shared<BenchmarkTimer>(args, *hardware, flushTimeMs * 1000);
         listeners.addListener(benchmarkTimer);
         listeners.addListener(std::make_shared<HardwareMonitorListener>(args));
+        listeners.addListener(std::make_shared<HardwareCounterListener>(args));
     }
 
     auto reporters = std::make_shared<MetaResultReporter>();
@@ -694,8 +708,8 @@ int main(int argc, const char* argv[])
     reporters->report(ResultKey::ProblemCount, problemFactory.problems().size());
 
     bool  useUserArgs = args["use-user-args"].as<bool>();
-    void* dUA         = nullptr;
-    void* dUAHost     = nullptr;
+    std::vector<void*> dUA;
+    std::vector<void*> dUAHost;
 
     if(Debug::Instance().getBenchmark())
     {
@@ -753,14 +767,19 @@ int main(int argc, const char* argv[])
                                 resetInput = true;
 
                                 std::vector<std::vector<KernelInvocation>> kernels;
+                                if(useUserArgs)
+                                {
+                                    dUA.assign(inputArr.size(), nullptr);
+                                    dUAHost.assign(inputArr.size(), nullptr);
+                                }
                                 for(size_t r = 0; r < inputArr.size(); r++)
                                 {
                                     auto kernel = useUserArgs
                                                       ? solution->solveTensileGPU((*problem),
                                                                                   *inputArr[r],
                                                                                   *hardware,
-                                                                                  &dUA,
-                                                                                  &dUAHost,
+                                                                                  &dUA[r],
+                                                                                  &dUAHost[r],
                                                                                   nullptr,
                                                                                   0,
                                                                                   stream)
@@ -792,8 +811,10 @@ int main(int argc, const char* argv[])
                                             inputs, warmupStartEvents, warmupStopEvents);
                                 }
                                 listeners.postWarmup(warmupStartEvents, warmupStopEvents, stream);
+                                bool pruned
+                                    = pruningIterator && pruningIterator->pruneCurrentSolution();
 
-                                size_t syncs      = listeners.numSyncs();
+                                size_t syncs      = pruned ? 0 : listeners.numSyncs();
                                 size_t enq        = listeners.numEnqueuesPerSync();
                                 size_t eventCount = gpuTimer ? kernels[0].size() : 0;
 
@@ -809,8 +830,14 @@ int main(int argc, const char* argv[])
                                         for(int j = 0; j < enq; j++)
                                         {
                                             size_t kIdx = ((i * enq) + j) % kernels.size();
-                                            HIP_CHECK_EXC(adapter.launchKernels(
-                                                kernels[kIdx], stream, nullptr, nullptr));
+                                            if(perIteration)
+                                                HIP_CHECK_EXC(adapter.launchKernels(kernels[kIdx],
+                                                                                    stream,
+                                                                                    startEvents[j],
+                                                                                    stopEvents[j]));
+                                            else
+                                                HIP_CHECK_EXC(adapter.launchKernels(
+                                                    kernels[kIdx], stream, nullptr, nullptr));
 
                                             if(icacheFlush)
                                             {
@@ -827,8 +854,14 @@ int main(int argc, const char* argv[])
 
                                 if(useUserArgs)
                                 {
-                                    solution->relaseDeviceUserArgs(dUA, dUAHost);
+                                    for(size_t r = 0; r < dUA.size(); r++)
+                                        solution->relaseDeviceUserArgs(
+                                            dUA[r], dUAHost[r], stream);
+                                    dUA.clear();
+                                    dUAHost.clear();
                                 }
+                                if(pruned)
+                                    break;
                             }
                         }
                         catch(std::runtime_error const& err)
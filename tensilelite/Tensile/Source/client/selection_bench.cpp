@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Times the uncached solution selection of a library through the tree of
+// selection libraries and through its FlatSelectionLibrary, and checks that both
+// select the same solutions. The problems have the problem types of the
+// solutions of the library and random sizes.
+//
+//   tensile_selection_bench TensileLibrary_gfx942.dat gfx942 304 [problems] [repeats]
+
+#include <Tensile/AMDGPU.hpp>
+#include <Tensile/CachingLibrary.hpp>
+#include <Tensile/ContractionProblem.hpp>
+#include <Tensile/ContractionSolution.hpp>
+#include <Tensile/FlatSelectionLibrary.hpp>
+#include <Tensile/MasterSolutionLibrary.hpp>
+#include <Tensile/Tensile.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+
+using Problem = TensileLite::ContractionProblemGemm;
+using Library = TensileLite::SolutionLibrary<Problem>;
+
+// A GEMM of the problem type of solution with column major, packed tensors
+static Problem problemOf(TensileLite::ContractionSolution const& solution,
+                         size_t                                  m,
+                         size_t                                  n,
+                         size_t                                  k)
+{
+    auto type    = solution.problemType;
+    auto problem = Problem::createDefaultProblem(type.transA,
+                                                 type.transB,
+                                                 type.aType,
+                                                 type.bType,
+                                                 type.cType,
+                                                 type.dType,
+                                                 type.computeType,
+                                                 type.computeType,
+                                                 type.computeInputType,
+                                                 type.computeType,
+                                                 1.0,
+                                                 0.0,
+                                                 type.useBias,
+                                                 type.useGradient,
+                                                 type.biasDataTypeWhiteList,
+                                                 type.biasSrcWhiteList,
+                                                 type.groupedGemm,
+                                                 std::numeric_limits<size_t>::max());
+
+    Problem::FreeIndices  freeIndex(2);
+    Problem::BoundIndices boundIndex(1);
+    Problem::BatchIndices batchIndex{{2, 2, 2, 2}};
+    freeIndex[0].isA = true;
+    freeIndex[1].isA = false;
+    freeIndex[0].c = freeIndex[0].d = 0;
+    freeIndex[1].c = freeIndex[1].d = 1;
+
+    if(type.transA)
+    {
+        problem.resetTensor(Problem::TENSOR::A, type.aType, {k, m, 1}, {1, k, k * m});
+        freeIndex[0].i  = 1;
+        boundIndex[0].a = 0;
+    }
+    else
+    {
+        problem.resetTensor(Problem::TENSOR::A, type.aType, {m, k, 1}, {1, m, m * k});
+        freeIndex[0].i  = 0;
+        boundIndex[0].a = 1;
+    }
+
+    if(type.transB)
+    {
+        problem.resetTensor(Problem::TENSOR::B, type.bType, {n, k, 1}, {1, n, n * k});
+        freeIndex[1].i  = 0;
+        boundIndex[0].b = 1;
+    }
+    else
+    {
+        problem.resetTensor(Problem::TENSOR::B, type.bType, {k, n, 1}, {1, k, k * n});
+        freeIndex[1].i  = 1;
+        boundIndex[0].b = 0;
+    }
+
+    problem.resetTensor(Problem::TENSOR::C, type.cType, {m, n, 1}, {1, m, m * n});
+    problem.resetTensor(Problem::TENSOR::D, type.dType, {m, n, 1}, {1, m, m * n});
+    problem.updateProblem(freeIndex, batchIndex, boundIndex, 0.0, problem.workspaceSize());
+
+    return problem;
+}
+
+// Seconds per selection of library over problems, and the selected indices
+static double timeSelection(Library const&              library,
+                            std::vector<Problem> const& problems,
+                            TensileLite::AMDGPU const&  hardware,
+                            int                         repeats,
+                            std::vector<int>&           selected)
+{
+    selected.assign(problems.size(), -1);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeats; r++)
+    {
+        for(size_t i = 0; i < problems.size(); i++)
+        {
+            TensileLite::Predicates::MemoScope<Problem> memo(problems[i]);
+
+            auto solution = library.findBestSolution(problems[i], hardware);
+            selected[i]   = solution ? solution->index : -1;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count() / (repeats * problems.size());
+}
+
+int main(int argc, char** argv)
+{
+    if(argc < 4 || argc > 6)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " <TensileLibrary> <arch> <compute units> [problems] [repeats]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    size_t numProblems = argc > 4 ? std::strtoul(argv[4], nullptr, 0) : 1000;
+    int    repeats     = argc > 5 ? std::atoi(argv[5]) : 10;
+
+    using MSL = TensileLite::MasterSolutionLibrary<Problem>;
+
+    // Loads every child so that lazily-loaded leaves do not count towards the first repeat
+    auto lib = std::dynamic_pointer_cast<MSL>(TensileLite::LoadLibraryFilePreload<Problem>(
+        argv[1], std::vector<TensileLite::LazyLoadingInit>{TensileLite::LazyLoadingInit::All}));
+    if(!lib || lib->solutions.empty())
+    {
+        std::cerr << "Could not load " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Below the CachingLibrary, which would answer all but the first repeat
+    std::shared_ptr<Library> tree = lib->library;
+    if(auto cache = std::dynamic_pointer_cast<TensileLite::CachingLibrary<Problem>>(tree))
+        tree = cache->library();
+    if(auto flat = std::dynamic_pointer_cast<TensileLite::FlatSelectionLibrary<Problem>>(tree))
+        tree = flat->library();
+    TensileLite::FlatSelectionLibrary<Problem> flat(tree);
+
+    TensileLite::AMDGPU hardware(
+        TensileLite::AMDGPU::toProcessor(argv[2]), std::atoi(argv[3]), argv[2]);
+
+    std::vector<std::shared_ptr<TensileLite::ContractionSolution>> solutions;
+    for(auto const& pair : lib->solutions)
+        solutions.push_back(pair.second);
+
+    std::mt19937                          rng(0);
+    std::uniform_int_distribution<size_t> pick(0, solutions.size() - 1);
+    std::uniform_int_distribution<size_t> size(1, 8192);
+
+    std::vector<Problem> problems;
+    problems.reserve(numProblems);
+    for(size_t i = 0; i < numProblems; i++)
+        problems.push_back(problemOf(*solutions[pick(rng)], size(rng), size(rng), size(rng)));
+
+    std::vector<int> treeSelected, flatSelected;
+    double           treeTime = timeSelection(*tree, problems, hardware, repeats, treeSelected);
+    double           flatTime = timeSelection(flat, problems, hardware, repeats, flatSelected);
+
+    size_t found = 0, mismatches = 0;
+    for(size_t i = 0; i < problems.size(); i++)
+    {
+        found += treeSelected[i] >= 0;
+        mismatches += treeSelected[i] != flatSelected[i];
+    }
+
+    std::cout << flat.description() << std::endl
+              << problems.size() << " problems, " << found << " with a solution, " << repeats
+              << " repeats" << std::endl
+              << "tree: " << treeTime * 1e6 << " us per selection" << std::endl
+              << "flat: " << flatTime * 1e6 << " us per selection" << std::endl;
+
+    if(mismatches)
+    {
+        std::cerr << mismatches << " problems selected different solutions" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
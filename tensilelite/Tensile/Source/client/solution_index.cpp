@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Writes the SolutionIndexFile of a lazily-loaded library: the file of every
+// solution of TensileLibrary_lazy_<arch>.dat, so that solutions looked up by
+// index at runtime load only their own file.
+//
+//   tensile_solution_index TensileLibrary_lazy_gfx942.dat TensileLibrary_lazy_gfx942.idx
+
+#include <Tensile/ContractionProblem.hpp>
+#include <Tensile/ContractionSolution.hpp>
+#include <Tensile/MasterSolutionLibrary.hpp>
+#include <Tensile/PlaceholderLibrary.hpp>
+#include <Tensile/SolutionIndex.hpp>
+#include <Tensile/Tensile.hpp>
+
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    if(argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <TensileLibrary_lazy_arch> <output.idx>"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    using Problem = TensileLite::ContractionProblemGemm;
+    using MSL     = TensileLite::MasterSolutionLibrary<Problem>;
+
+    // Loads every child so that the master library knows all solutions
+    auto lib = std::dynamic_pointer_cast<MSL>(TensileLite::LoadLibraryFilePreload<Problem>(
+        argv[1], std::vector<TensileLite::LazyLoadingInit>{TensileLite::LazyLoadingInit::All}));
+    if(!lib)
+    {
+        std::cerr << "Could not load " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Children name their solutions after their code object, the master library's own
+    // solutions have no file to load and are left out
+    const std::string          suffix = ".co";
+    std::map<int, std::string> files;
+    for(auto const& pair : lib->solutions)
+    {
+        std::string name = pair.second->codeObjectFilename.load();
+        if(name.size() > suffix.size()
+           && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+            files[pair.first] = name.substr(0, name.size() - suffix.size());
+    }
+
+    if(!TensileLite::WriteSolutionIndex(argv[2], files))
+    {
+        std::cerr << "Could not write " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << files.size() << " of " << lib->solutions.size() << " solutions indexed in "
+              << argv[2] << std::endl;
+    return EXIT_SUCCESS;
+}
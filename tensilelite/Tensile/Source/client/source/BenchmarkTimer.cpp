@@ -29,6 +29,7 @@
 #include "ResultReporter.hpp"
 
 #include "Reference.hpp"
+#include "Utility.hpp"
 
 #include <Tensile/hip/HipUtils.hpp>
 
@@ -55,6 +56,12 @@ namespace TensileLite
             , m_numEnqueuesPerSolution(m_numEnqueuesPerSync * m_numSyncsPerBenchmark)
             , m_useGPUTimer(args["use-gpu-timer"].as<bool>())
             , m_sleepPercent(args["sleep-percent"].as<int>())
+            , m_perIterationTiming(m_useGPUTimer
+                                   && (args["per-iteration-timing"].as<bool>()
+                                       || args["timing-ci-target"].as<double>() > 0))
+            , m_timingCiTarget(m_perIterationTiming ? args["timing-ci-target"].as<double>() / 100
+                                                    : 0.0)
+            , m_maxTimingEnqueues(args["timing-max-enqueues"].as<int>())
             , m_timeInSolution(0)
             , m_totalGPUTime(0)
             , m_currentBestWarmUpTime(std::numeric_limits<double>::max())
@@ -98,6 +105,9 @@ namespace TensileLite
             m_numEnqueuesInSolution = 0;
             m_timeInSolution        = double_millis::zero();
             m_skip_slow_solution    = false;
+            m_enqueueTimesUs.clear();
+            m_nextTimingCheck = m_numEnqueuesPerSolution;
+            m_timingConverged = false;
 
             ContractionSolution::ProjectedPerformance pp;
 
@@ -137,6 +147,13 @@ namespace TensileLite
                             - m_flushTimeUs
                       : std::numeric_limits<double>::quiet_NaN();
 
+            TimingStatistics stats;
+            if(m_perIterationTiming && !m_skip_slow_solution && !m_enqueueTimesUs.empty())
+            {
+                stats             = timingStatistics(m_enqueueTimesUs);
+                timePerEnqueue_us = stats.median - m_flushTimeUs;
+            }
+
             ContractionSolution::ProjectedPerformance pp;
             double                                    flopCount = 0;
             if(auto problem = dynamic_cast<ContractionProblemGroupedGemm*>(m_problem))
@@ -163,6 +180,16 @@ namespace TensileLite
             m_reporter->report(ResultKey::TimeUS, timePerEnqueue_us);
             m_reporter->report(ResultKey::SpeedGFlopsPerCu, gflopsPerCu);
             m_reporter->report(ResultKey::SpeedGFlops, gflops);
+            if(stats.samples)
+            {
+                m_reporter->report(ResultKey::TimeUSP90, stats.p90 - m_flushTimeUs);
+                m_reporter->report(ResultKey::TimeUSP99, stats.p99 - m_flushTimeUs);
+                m_reporter->report(ResultKey::TimeUSCILow, stats.ciLow - m_flushTimeUs);
+                m_reporter->report(ResultKey::TimeUSCIHigh, stats.ciHigh - m_flushTimeUs);
+                m_reporter->report(ResultKey::TimedCalls,
+                                   uint64_t(stats.samples + stats.outliers));
+                m_reporter->report(ResultKey::TimingOutliers, uint64_t(stats.outliers));
+            }
 
             m_timeInSolution        = double_millis::zero();
             m_numEnqueuesInSolution = 0;
@@ -170,7 +197,12 @@ namespace TensileLite
 
         bool BenchmarkTimer::needMoreRunsInSolution() const
         {
-            return m_numEnqueuesInSolution < m_numEnqueuesPerSolution && !m_skip_slow_solution;
+            if(m_skip_slow_solution)
+                return false;
+            if(m_numEnqueuesInSolution < m_numEnqueuesPerSolution)
+                return true;
+            return m_timingCiTarget > 0 && !m_timingConverged
+                   && m_numEnqueuesInSolution < m_maxTimingEnqueues;
         }
 
         size_t BenchmarkTimer::numWarmupRuns()
@@ -338,6 +370,26 @@ namespace TensileLite
                 totalTime = double_millis(m_endTime - m_startTime);
             }
 
+            if(m_perIterationTiming)
+            {
+                float enqTime = 0.0f;
+                HIP_CHECK_EXC(hipEventSynchronize(stopEvents->back().back()));
+                for(size_t i = 0; i < startEvents->size(); i++)
+                {
+                    HIP_CHECK_EXC(hipEventElapsedTime(
+                        &enqTime, startEvents->at(i).front(), stopEvents->at(i).back()));
+                    m_enqueueTimesUs.push_back(double_micros(double_millis(enqTime)).count());
+                }
+
+                // The bootstrap is redone as the enqueues grow by a quarter, not on every sync
+                if(m_timingCiTarget > 0 && m_enqueueTimesUs.size() >= m_nextTimingCheck)
+                {
+                    auto stats        = timingStatistics(m_enqueueTimesUs);
+                    m_timingConverged = stats.ciRelativeWidth() <= m_timingCiTarget;
+                    m_nextTimingCheck = m_enqueueTimesUs.size() + m_enqueueTimesUs.size() / 4;
+                }
+            }
+
             m_timeInSolution += totalTime;
             m_totalGPUTime += totalTime;
             m_numEnqueuesInSolution += startEvents->size();
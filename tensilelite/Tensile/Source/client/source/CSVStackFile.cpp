@@ -54,6 +54,11 @@ namespace TensileLite
         {
         }
 
+        CSVStackFile::CSVStackFile(std::shared_ptr<ColumnarResultsWriter> columnar)
+            : m_columnar(columnar)
+        {
+        }
+
         CSVStackFile::~CSVStackFile() {}
 
         void CSVStackFile::setHeaderForKey(std::string const& key, std::string const& header)
@@ -75,13 +80,18 @@ namespace TensileLite
             m_stack.pop_back();
         }
 
-        void CSVStackFile::writeCurrentRow()
+        // Columnar files keep the headers as column names instead
+        void CSVStackFile::writeHeader()
         {
-            if(m_firstRow && !m_headers.empty())
+            if(m_firstRow && !m_headers.empty() && !m_columnar)
                 writeRow(m_headers);
 
             m_firstRow = false;
+        }
 
+        void CSVStackFile::writeCurrentRow()
+        {
+            writeHeader();
             writeRow(m_currentRow);
 
             if(m_stack.empty())
@@ -93,10 +103,7 @@ namespace TensileLite
         void CSVStackFile::readCurrentRow(std::unordered_map<std::string, std::string>& outMap)
         {
             // we still write the header to csv first, then read the data to map
-            if(m_firstRow && !m_headers.empty())
-                writeRow(m_headers);
-
-            m_firstRow = false;
+            writeHeader();
 
             // only copy the fields that are in headers
             for(auto const& key : m_keyOrder)
@@ -117,6 +124,21 @@ namespace TensileLite
 
         void CSVStackFile::writeRow(std::unordered_map<std::string, std::string> const& row)
         {
+            if(m_columnar)
+            {
+                std::vector<std::string> names, values;
+                names.reserve(m_keyOrder.size());
+                values.reserve(m_keyOrder.size());
+                for(auto const& key : m_keyOrder)
+                {
+                    auto it = row.find(key);
+                    names.push_back(m_headers.at(key));
+                    values.push_back(it != row.end() ? it->second : "");
+                }
+                m_columnar->appendRow(names, std::move(values));
+                return;
+            }
+
             bool firstCol = true;
             for(auto const& key : m_keyOrder)
             {
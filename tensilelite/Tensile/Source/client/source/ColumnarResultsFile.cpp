@@ -0,0 +1,255 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <ColumnarResultsFile.hpp>
+
+#include <CSVStackFile.hpp>
+
+#include <cstring>
+
+namespace TensileLite
+{
+    namespace Client
+    {
+        namespace
+        {
+            void writeUInt32(std::ostream& stream, uint32_t value)
+            {
+                char bytes[4] = {char(value), char(value >> 8), char(value >> 16), char(value >> 24)};
+                stream.write(bytes, sizeof(bytes));
+            }
+
+            bool readUInt32(std::istream& stream, uint32_t& value)
+            {
+                unsigned char bytes[4];
+                if(!stream.read(reinterpret_cast<char*>(bytes), sizeof(bytes)))
+                    return false;
+                value = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | uint32_t(bytes[3]) << 24;
+                return true;
+            }
+
+            struct Column
+            {
+                std::string           name;
+                std::vector<uint32_t> ends;
+                std::string           bytes;
+
+                std::string value(uint32_t row) const
+                {
+                    uint32_t begin = row == 0 ? 0 : ends[row - 1];
+                    return bytes.substr(begin, ends[row] - begin);
+                }
+            };
+
+            // Reads the next block, with the values only when columns is not null
+            bool readBlock(std::istream&             stream,
+                           uint32_t&                 rows,
+                           std::vector<Column>*      columns,
+                           std::vector<std::string>& names)
+            {
+                uint32_t columnCount;
+                if(!readUInt32(stream, rows) || !readUInt32(stream, columnCount))
+                    return false;
+
+                names.resize(columnCount);
+                if(columns)
+                    columns->resize(columnCount);
+                for(uint32_t c = 0; c < columnCount; c++)
+                {
+                    uint32_t size;
+                    if(!readUInt32(stream, size))
+                        return false;
+                    names[c].resize(size);
+                    if(!stream.read(&names[c][0], size))
+                        return false;
+
+                    std::vector<uint32_t> ends(rows);
+                    for(auto& end : ends)
+                        if(!readUInt32(stream, end))
+                            return false;
+
+                    uint32_t byteCount = rows == 0 ? 0 : ends.back();
+                    if(!columns)
+                    {
+                        stream.seekg(byteCount, std::ios::cur);
+                        continue;
+                    }
+
+                    auto& column = (*columns)[c];
+                    column.name  = names[c];
+                    column.ends  = std::move(ends);
+                    column.bytes.resize(byteCount);
+                    if(!stream.read(&column.bytes[0], byteCount))
+                        return false;
+                }
+                return bool(stream);
+            }
+
+            bool readMagic(std::istream& stream)
+            {
+                char     magic[4];
+                uint32_t version;
+                return stream.read(magic, sizeof(magic))
+                       && std::memcmp(magic, ColumnarResultsWriter::Magic, sizeof(magic)) == 0
+                       && readUInt32(stream, version)
+                       && version == ColumnarResultsWriter::FormatVersion;
+            }
+        } // namespace
+
+        ColumnarResultsWriter::ColumnarResultsWriter(std::string const& filename)
+            : m_file(filename, std::ios::binary)
+        {
+            m_file.write(Magic, sizeof(Magic));
+            writeUInt32(m_file, FormatVersion);
+            m_thread = std::thread(&ColumnarResultsWriter::writerLoop, this);
+        }
+
+        ColumnarResultsWriter::~ColumnarResultsWriter()
+        {
+            if(m_block.rows)
+                submit();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done = true;
+            }
+            m_cv.notify_all();
+            m_thread.join();
+        }
+
+        void ColumnarResultsWriter::appendRow(std::vector<std::string> const& names,
+                                              std::vector<std::string>&&      values)
+        {
+            // New columns are empty for the rows of the block before them
+            if(names.size() != m_block.names.size())
+            {
+                m_block.names = names;
+                m_block.columns.resize(names.size());
+                for(auto& column : m_block.columns)
+                    column.resize(m_block.rows);
+            }
+
+            for(size_t c = 0; c < values.size() && c < m_block.columns.size(); c++)
+                m_block.columns[c].push_back(std::move(values[c]));
+            for(size_t c = values.size(); c < m_block.columns.size(); c++)
+                m_block.columns[c].emplace_back();
+
+            if(++m_block.rows == RowsPerBlock)
+                submit();
+        }
+
+        // Hands the block to the writer thread, waiting while MaxQueued blocks are pending
+        void ColumnarResultsWriter::submit()
+        {
+            // Later blocks start from the columns of this one
+            Block next;
+            next.names   = m_block.names;
+            next.columns = std::vector<std::vector<std::string>>(next.names.size());
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_queue.size() < MaxQueued; });
+            m_queue.push_back(std::move(m_block));
+            lock.unlock();
+            m_cv.notify_all();
+
+            m_block = std::move(next);
+        }
+
+        void ColumnarResultsWriter::writerLoop()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(true)
+            {
+                m_cv.wait(lock, [this]() { return m_done || !m_queue.empty(); });
+                if(m_queue.empty())
+                    break;
+
+                Block block = std::move(m_queue.front());
+                m_queue.pop_front();
+                lock.unlock();
+                m_cv.notify_all();
+                writeBlock(block);
+                lock.lock();
+            }
+            m_file.flush();
+        }
+
+        void ColumnarResultsWriter::writeBlock(Block const& block)
+        {
+            writeUInt32(m_file, block.rows);
+            writeUInt32(m_file, uint32_t(block.columns.size()));
+            for(size_t c = 0; c < block.columns.size(); c++)
+            {
+                writeUInt32(m_file, uint32_t(block.names[c].size()));
+                m_file.write(block.names[c].data(), block.names[c].size());
+
+                uint32_t end = 0;
+                for(auto const& value : block.columns[c])
+                    writeUInt32(m_file, end += uint32_t(value.size()));
+                for(auto const& value : block.columns[c])
+                    m_file.write(value.data(), value.size());
+            }
+        }
+
+        bool ColumnarResultsToCsv(std::string const& filename, std::ostream& output)
+        {
+            std::ifstream input(filename, std::ios::binary);
+            if(!readMagic(input))
+                return false;
+
+            // The first pass finds the header, the second writes the rows
+            uint32_t                 rows;
+            std::vector<std::string> names, header;
+            auto                     dataStart = input.tellg();
+            while(input.peek() != std::char_traits<char>::eof())
+            {
+                if(!readBlock(input, rows, nullptr, names))
+                    return false;
+                if(names.size() > header.size())
+                    header = names;
+            }
+
+            CSVStackFile csv(output);
+            for(size_t c = 0; c < header.size(); c++)
+                csv.setHeaderForKey(std::to_string(c), header[c]);
+
+            input.clear();
+            input.seekg(dataStart);
+            std::vector<Column> columns;
+            while(input.peek() != std::char_traits<char>::eof())
+            {
+                if(!readBlock(input, rows, &columns, names))
+                    return false;
+                for(uint32_t r = 0; r < rows; r++)
+                {
+                    for(size_t c = 0; c < columns.size(); c++)
+                        csv.setValueForKey(std::to_string(c), columns[c].value(r));
+                    csv.writeCurrentRow();
+                }
+            }
+            return true;
+        }
+    } // namespace Client
+} // namespace TensileLite
@@ -628,6 +628,16 @@ namespace TensileLite
             m_rotatingBuffer
                 = args["rotating-buffer-size"].as<int32_t>() * 1024 * 1024; // Change to bytes
             m_rotatingMode = args["rotating-buffer-mode"].as<int32_t>();
+            if(m_rotatingBuffer < 0)
+            {
+                int device;
+                HIP_CHECK_EXC(hipGetDevice(&device));
+                m_rotatingAuto   = true;
+                m_caches         = deviceCacheSizes(device);
+                m_rotatingBuffer = coldCacheRotatingSize(m_caches, 0);
+                std::cout << "Rotating buffer: auto (cold caches), L2 " << m_caches.l2
+                          << ", MALL " << m_caches.mall << std::endl;
+            }
             m_boundsCheck    = args["bounds-check"].as<BoundsCheckMode>();
             m_curBoundsCheck = m_boundsCheck;
 
@@ -1087,7 +1097,11 @@ namespace TensileLite
             std::shared_ptr<void> tmpPtr;
             if(m_rotatingBuffer > 0)
             {
-                m_rm->createRotatingMemory(m_rotatingMode, m_rotatingBuffer);
+                size_t rotatingSize
+                    = m_rotatingAuto
+                          ? coldCacheRotatingSize(m_caches, m_rm->getLargestTotalSize())
+                          : m_rotatingBuffer;
+                m_rm->createRotatingMemory(m_rotatingMode, rotatingSize);
             }
 
             size_t   offset    = 0;
@@ -1714,6 +1728,17 @@ namespace TensileLite
             }
         }
 
+        bool DataInitialization::inputTypesChanged(std::vector<DataType>&        types,
+                                                   ContractionProblemGemm const& problem)
+        {
+            std::vector<DataType> current;
+            for(auto const& tensor : problem.tensors())
+                current.push_back(tensor.dataType());
+            bool changed = current != types;
+            types        = std::move(current);
+            return changed;
+        }
+
         template <typename T>
         void DataInitialization::setContractionInputs(std::vector<T*>&     ptrs,
                                                       std::vector<void**>& batchPtrs,
@@ -2075,14 +2100,18 @@ namespace TensileLite
 
             if(auto gemmProblem = dynamic_cast<ContractionProblemGemm const*>(problem))
             {
-                auto    castInputs   = static_pointer_cast<ContractionInputs>(inputs);
-                size_t  rotatingSize = getRotatingSize(*gemmProblem, *castInputs);
+                auto    castInputs     = static_pointer_cast<ContractionInputs>(inputs);
+                size_t  rotatingSize   = getRotatingSize(*gemmProblem, *castInputs);
+                int64_t rotatingBuffer = m_rotatingAuto
+                                             ? coldCacheRotatingSize(m_caches, rotatingSize)
+                                             : m_rotatingBuffer;
                 int32_t rotatingNum
-                    = min(maxRotatingBufferNum, ceil((float)m_rotatingBuffer / rotatingSize))
+                    = min(maxRotatingBufferNum, ceil((float)rotatingBuffer / rotatingSize))
                       - 1; // Minus the original buffer.
                 int32_t totalRotatingSizeNeeded = rotatingNum * rotatingSize;
-                std::cout << "Rotating buffer set to: " << m_rotatingBuffer
-                          << ". Rotating num: " << rotatingNum << std::endl;
+                std::cout << "Rotating buffer set to: " << rotatingBuffer
+                          << (m_rotatingAuto ? " (auto)" : "") << ". Rotating num: " << rotatingNum
+                          << std::endl;
                 if(m_rotatingMode == 0)
                 {
                     auto rotatingAllocatedSize = m_rm->getDataSize() - m_rm->getDataLargestUnitSize();
@@ -2133,12 +2162,16 @@ namespace TensileLite
                     rotatingSize
                         += getRotatingSize(groupedProblem->gemms[i], castInputs->grouped[i]);
                 }
+                int64_t rotatingBuffer = m_rotatingAuto
+                                             ? coldCacheRotatingSize(m_caches, rotatingSize)
+                                             : m_rotatingBuffer;
                 int32_t rotatingNum
-                    = min(maxRotatingBufferNum, ceil((float)m_rotatingBuffer / rotatingSize))
+                    = min(maxRotatingBufferNum, ceil((float)rotatingBuffer / rotatingSize))
                       - 1; // Minus the original buffer.
                 int32_t totalRotatingSizeNeeded = rotatingNum * rotatingSize;
-                std::cout << "Rotating buffer set to: " << m_rotatingBuffer
-                          << ". Rotating num: " << rotatingNum << std::endl;
+                std::cout << "Rotating buffer set to: " << rotatingBuffer
+                          << (m_rotatingAuto ? " (auto)" : "") << ". Rotating num: " << rotatingNum
+                          << std::endl;
                 if(m_rotatingMode == 0)
                 {
                     auto rotatingAllocatedSize = m_rm->getDataSize() - m_rm->getDataLargestUnitSize();
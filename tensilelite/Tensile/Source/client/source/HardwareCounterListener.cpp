@@ -0,0 +1,312 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "HardwareCounterListener.hpp"
+
+#include <stdexcept>
+
+#include <hip/hip_runtime.h>
+
+#include <Tensile/hip/HipUtils.hpp>
+
+#include "ResultReporter.hpp"
+
+#ifdef Tensile_ENABLE_ROCPROFILER
+#include <rocprofiler-sdk/registration.h>
+#include <rocprofiler-sdk/rocprofiler.h>
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+#endif
+
+namespace TensileLite
+{
+    namespace Client
+    {
+#ifdef Tensile_ENABLE_ROCPROFILER
+        namespace
+        {
+            // Collected in one pass, the counters an agent can't add to the pass are left out
+            const char* const counterNames[] = {"TCC_HIT_sum",
+                                                "TCC_MISS_sum",
+                                                "FETCH_SIZE",
+                                                "WRITE_SIZE",
+                                                "SQ_LDS_BANK_CONFLICT",
+                                                "SQ_VALU_MFMA_BUSY_CYCLES",
+                                                "GRBM_GUI_ACTIVE"};
+
+            // State of the rocprofiler tool, set up when the HIP runtime loads it
+            struct CounterCollection
+            {
+                rocprofiler_context_id_t context    = {};
+                rocprofiler_buffer_id_t  buffer     = {};
+                bool                     configured = false;
+
+                std::mutex mutex;
+                // Profile of each agent, a null handle when none of the counters is available
+                std::map<uint64_t, rocprofiler_profile_config_id_t> configs;
+                std::map<uint64_t, std::string>                     names;
+                // Sums over the dispatches since the last reset
+                std::map<std::string, double> values;
+            };
+
+            CounterCollection& collection()
+            {
+                static CounterCollection instance;
+                return instance;
+            }
+
+            rocprofiler_profile_config_id_t makeConfig(CounterCollection&     c,
+                                                       rocprofiler_agent_id_t agent)
+            {
+                std::vector<rocprofiler_counter_id_t> supported;
+                rocprofiler_iterate_agent_supported_counters(
+                    agent,
+                    [](rocprofiler_agent_id_t,
+                       rocprofiler_counter_id_t* counters,
+                       size_t                    count,
+                       void*                     user) {
+                        static_cast<std::vector<rocprofiler_counter_id_t>*>(user)->assign(
+                            counters, counters + count);
+                        return ROCPROFILER_STATUS_SUCCESS;
+                    },
+                    &supported);
+
+                std::vector<rocprofiler_counter_id_t> chosen;
+                for(std::string name : counterNames)
+                {
+                    for(auto id : supported)
+                    {
+                        rocprofiler_counter_info_v0_t info;
+                        if(rocprofiler_query_counter_info(
+                               id, ROCPROFILER_COUNTER_INFO_VERSION_0, &info)
+                               != ROCPROFILER_STATUS_SUCCESS
+                           || name != info.name)
+                            continue;
+
+                        chosen.push_back(id);
+                        rocprofiler_profile_config_id_t trial = {};
+                        if(rocprofiler_create_profile_config(
+                               agent, chosen.data(), chosen.size(), &trial)
+                           == ROCPROFILER_STATUS_SUCCESS)
+                        {
+                            rocprofiler_destroy_profile_config(trial);
+                            c.names[id.handle] = name;
+                        }
+                        else
+                        {
+                            chosen.pop_back();
+                        }
+                        break;
+                    }
+                }
+
+                rocprofiler_profile_config_id_t config = {};
+                if(!chosen.empty()
+                   && rocprofiler_create_profile_config(
+                          agent, chosen.data(), chosen.size(), &config)
+                          != ROCPROFILER_STATUS_SUCCESS)
+                    config.handle = 0;
+                return config;
+            }
+
+            void dispatchCallback(rocprofiler_dispatch_counting_service_data_t dispatch,
+                                  rocprofiler_profile_config_id_t*             config,
+                                  rocprofiler_user_data_t*                     userData,
+                                  void*                                        callbackData)
+            {
+                auto&                       c = collection();
+                std::lock_guard<std::mutex> lock(c.mutex);
+
+                auto agent = dispatch.dispatch_info.agent_id;
+                auto it    = c.configs.find(agent.handle);
+                if(it == c.configs.end())
+                    it = c.configs.emplace(agent.handle, makeConfig(c, agent)).first;
+                if(it->second.handle)
+                    *config = it->second;
+            }
+
+            void bufferCallback(rocprofiler_context_id_t      context,
+                                rocprofiler_buffer_id_t       buffer,
+                                rocprofiler_record_header_t** headers,
+                                size_t                        count,
+                                void*                         userData,
+                                uint64_t                      dropCount)
+            {
+                auto&                       c = collection();
+                std::lock_guard<std::mutex> lock(c.mutex);
+
+                for(size_t i = 0; i < count; i++)
+                {
+                    if(headers[i]->category != ROCPROFILER_BUFFER_CATEGORY_COUNTERS
+                       || headers[i]->kind != ROCPROFILER_COUNTER_RECORD_VALUE)
+                        continue;
+
+                    auto* record = static_cast<rocprofiler_record_counter_t*>(headers[i]->payload);
+                    rocprofiler_counter_id_t id = {};
+                    if(rocprofiler_query_record_counter_id(record->id, &id)
+                       != ROCPROFILER_STATUS_SUCCESS)
+                        continue;
+
+                    auto name = c.names.find(id.handle);
+                    if(name == c.names.end())
+                        continue;
+                    c.values[name->second] += record->counter_value;
+                }
+            }
+
+            int toolInit(rocprofiler_client_finalize_t finalize, void* toolData)
+            {
+                auto& c = collection();
+                if(rocprofiler_create_context(&c.context) != ROCPROFILER_STATUS_SUCCESS
+                   || rocprofiler_create_buffer(c.context,
+                                                64 * 1024,
+                                                48 * 1024,
+                                                ROCPROFILER_BUFFER_POLICY_LOSSLESS,
+                                                bufferCallback,
+                                                nullptr,
+                                                &c.buffer)
+                          != ROCPROFILER_STATUS_SUCCESS
+                   || rocprofiler_configure_buffered_dispatch_counting_service(
+                          c.context, c.buffer, dispatchCallback, nullptr)
+                          != ROCPROFILER_STATUS_SUCCESS)
+                    return -1;
+
+                c.configured = true;
+                return 0;
+            }
+
+            void toolFini(void* toolData) {}
+        } // namespace
+#endif
+
+        HardwareCounterListener::HardwareCounterListener(po::variables_map const& args)
+            : m_active(args["hardware-counters"].as<bool>())
+        {
+            if(!m_active)
+                return;
+
+#ifndef Tensile_ENABLE_ROCPROFILER
+            throw std::runtime_error(
+                "--hardware-counters needs a client built with Tensile_ENABLE_ROCPROFILER.");
+#endif
+
+            hipDeviceProp_t props;
+            HIP_CHECK_EXC(hipGetDeviceProperties(&props, args["device-idx"].as<int>()));
+            m_cuCount = props.multiProcessorCount;
+        }
+
+        void HardwareCounterListener::preWarmup()
+        {
+#ifdef Tensile_ENABLE_ROCPROFILER
+            if(!m_active)
+                return;
+
+            auto& c = collection();
+            if(!c.configured)
+            {
+                std::cerr << "rocprofiler did not load the counter collection, "
+                             "--hardware-counters is ignored."
+                          << std::endl;
+                m_active = false;
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(c.mutex);
+                c.values.clear();
+            }
+            rocprofiler_start_context(c.context);
+#endif
+        }
+
+        void HardwareCounterListener::postWarmup(TimingEvents const& startEvents,
+                                                 TimingEvents const& stopEvents,
+                                                 hipStream_t const&  stream)
+        {
+#ifdef Tensile_ENABLE_ROCPROFILER
+            if(!m_active)
+                return;
+
+            auto& c = collection();
+            HIP_CHECK_EXC(hipStreamSynchronize(stream));
+            rocprofiler_stop_context(c.context);
+            rocprofiler_flush_buffer(c.buffer);
+
+            std::map<std::string, double> values;
+            {
+                std::lock_guard<std::mutex> lock(c.mutex);
+                values = c.values;
+            }
+            if(values.empty() || !m_numWarmups)
+                return;
+
+            // Per launch of the solution, which can be several dispatches
+            double launches = static_cast<double>(m_numWarmups);
+            auto   has      = [&](const char* name) { return values.count(name) != 0; };
+
+            if(has("TCC_HIT_sum") && has("TCC_MISS_sum")
+               && values["TCC_HIT_sum"] + values["TCC_MISS_sum"] > 0)
+                m_reporter->report(ResultKey::L2HitRate,
+                                   100.0 * values["TCC_HIT_sum"]
+                                       / (values["TCC_HIT_sum"] + values["TCC_MISS_sum"]));
+            if(has("FETCH_SIZE") || has("WRITE_SIZE"))
+                m_reporter->report(ResultKey::HbmBytes,
+                                   1024.0 * (values["FETCH_SIZE"] + values["WRITE_SIZE"])
+                                       / launches);
+            if(has("SQ_LDS_BANK_CONFLICT"))
+                m_reporter->report(ResultKey::LdsBankConflicts,
+                                   values["SQ_LDS_BANK_CONFLICT"] / launches);
+            // The busy cycles add up over the 4 SIMDs of each CU
+            if(has("SQ_VALU_MFMA_BUSY_CYCLES") && has("GRBM_GUI_ACTIVE")
+               && values["GRBM_GUI_ACTIVE"] > 0)
+                m_reporter->report(ResultKey::MfmaUtilization,
+                                   100.0 * values["SQ_VALU_MFMA_BUSY_CYCLES"]
+                                       / (values["GRBM_GUI_ACTIVE"] * m_cuCount * 4));
+#endif
+        }
+    } // namespace Client
+} // namespace TensileLite
+
+#ifdef Tensile_ENABLE_ROCPROFILER
+// Found by the HIP runtime when it loads rocprofiler-sdk, before the client runs any kernel
+extern "C" rocprofiler_tool_configure_result_t*
+    rocprofiler_configure(uint32_t                 version,
+                          const char*              runtimeVersion,
+                          uint32_t                 priority,
+                          rocprofiler_client_id_t* id)
+{
+    id->name = "tensile_client";
+    static rocprofiler_tool_configure_result_t result
+        = {sizeof(rocprofiler_tool_configure_result_t),
+           &TensileLite::Client::toolInit,
+           &TensileLite::Client::toolFini,
+           nullptr};
+    return &result;
+}
+#endif
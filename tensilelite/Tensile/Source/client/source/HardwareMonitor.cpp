@@ -203,6 +203,14 @@ namespace TensileLite
             m_fanValues.resize(m_fanMetrics.size());
         }
 
+        void HardwareMonitor::addPowerMonitor(uint32_t sensorIndex)
+        {
+            assertNotActive();
+
+            m_powerMetrics.push_back(sensorIndex);
+            m_powerValues.resize(m_powerMetrics.size());
+        }
+
         double HardwareMonitor::getAverageTemp(rsmi_temperature_type_t sensorType, rsmi_temperature_metric_t metric)
         {
             assertNotActive();
@@ -277,6 +285,28 @@ namespace TensileLite
             throw std::runtime_error(concatenate("Can't read fan value that wasn't requested: ", sensorIndex));
         }
 
+        double HardwareMonitor::getAveragePower(uint32_t sensorIndex)
+        {
+            assertNotActive();
+
+            if(m_dataPoints == 0)
+                throw std::runtime_error("No data points collected!");
+
+            for(size_t i = 0; i < m_powerMetrics.size(); i++)
+            {
+                if(m_powerMetrics[i] == sensorIndex)
+                {
+                    uint64_t rawValue = m_powerValues[i];
+                    if(rawValue == std::numeric_limits<uint64_t>::max())
+                        return std::numeric_limits<double>::quiet_NaN();
+
+                    return static_cast<double>(rawValue) / (1e6 * m_dataPoints);
+                }
+            }
+
+            throw std::runtime_error(concatenate("Can't read power value that wasn't requested: ", sensorIndex));
+        }
+
         void HardwareMonitor::start()
         {
             runBetweenEvents(nullptr, nullptr);
@@ -322,6 +352,8 @@ namespace TensileLite
                 v = 0;
             for(auto& v : m_fanValues)
                 v = 0;
+            for(auto& v : m_powerValues)
+                v = 0;
 
             m_lastCollection = clock::time_point();
             m_nextCollection = clock::time_point();
@@ -420,6 +452,20 @@ namespace TensileLite
                     m_fanValues[i] += newValue;
             }
 
+            for(int i = 0; i < m_powerMetrics.size(); i++)
+            {
+                // if an error occurred previously, don't overwrite it.
+                if(m_powerValues[i] == std::numeric_limits<uint64_t>::max())
+                    continue;
+
+                uint64_t newValue = 0;
+                auto     status   = rsmi_dev_power_ave_get(m_smiDeviceIndex, m_powerMetrics[i], &newValue);
+                if(status != RSMI_STATUS_SUCCESS)
+                    m_powerValues[i] = std::numeric_limits<uint64_t>::max();
+                else
+                    m_powerValues[i] += newValue;
+            }
+
             // Retrieves the maximum hardware supported frequency.
             rsmi_frequencies_t freqs;
             auto               status = rsmi_dev_gpu_clk_freq_get(m_smiDeviceIndex, RSMI_CLK_TYPE_SYS, &freqs);
@@ -54,6 +54,7 @@ namespace TensileLite
             m_monitor->addClockMonitor(RSMI_CLK_TYPE_MEM);
 
             m_monitor->addFanSpeedMonitor();
+            m_monitor->addPowerMonitor();
         }
 
         void HardwareMonitorListener::preEnqueues(hipStream_t const& stream)
@@ -96,6 +97,19 @@ namespace TensileLite
             m_reporter->report(ResultKey::ClockRateMem, m_monitor->getAverageClock(RSMI_CLK_TYPE_MEM));
 
             m_reporter->report(ResultKey::FanSpeedRPMs, m_monitor->getAverageFanSpeed());
+
+            // Energy per call from the average power over the GPU timed calls, which the
+            // wall clock of the CPU timer doesn't bracket
+            double power    = m_monitor->getAveragePower();
+            double energyUJ = std::numeric_limits<double>::quiet_NaN();
+            float  timeMs   = 0;
+            if(m_useGPUTimer && startEvents->size() > 0 && startEvents->front().size() > 0
+               && hipEventElapsedTime(&timeMs, startEvents->front().front(), stopEvents->back().back())
+                      == hipSuccess)
+                energyUJ = power * timeMs * 1000.0 / startEvents->size();
+
+            m_reporter->report(ResultKey::PowerWatts, power);
+            m_reporter->report(ResultKey::EnergyPerCallUJ, energyUJ);
             m_reporter->report(ResultKey::HardwareSampleCount, m_monitor->getSamples());
             m_reporter->report(ResultKey::GfxFrequency,
                                m_monitor->getMaxGfxFreqValues()); // Report the maximum frequency values
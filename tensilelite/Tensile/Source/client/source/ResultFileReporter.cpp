@@ -32,21 +32,38 @@ namespace TensileLite
 {
     namespace Client
     {
+        namespace
+        {
+            // Columns of the counters of the fastest solution, see HardwareCounterListener
+            const std::map<std::string, std::string> counterHeaders
+                = {{ResultKey::L2HitRate, "WinnerL2HitRate"},
+                   {ResultKey::HbmBytes, "WinnerHBMBytes"},
+                   {ResultKey::LdsBankConflicts, "WinnerLDSBankConflictCycles"},
+                   {ResultKey::MfmaUtilization, "WinnerMFMAUtilization"}};
+        }
+
         std::shared_ptr<ResultFileReporter>
             ResultFileReporter::Default(po::variables_map const& args)
         {
+            auto format = args["results-file-format"].as<std::string>();
+            if(format != "csv" && format != "columnar")
+                throw std::runtime_error(concatenate("Unknown results file format ", format));
+
             return std::make_shared<ResultFileReporter>(
                 args["results-file"].as<std::string>(),
                 args["csv-export-extra-cols"].as<bool>(),
                 args["csv-merge-same-problems"].as<bool>(),
-                args["performance-metric"].as<PerformanceMetric>());
+                args["performance-metric"].as<PerformanceMetric>(),
+                format == "columnar");
         }
 
         ResultFileReporter::ResultFileReporter(std::string const& filename,
                                                bool               exportExtraCols,
                                                bool               mergeSameProblems,
-                                               PerformanceMetric  performanceMetric)
-            : m_output(filename)
+                                               PerformanceMetric  performanceMetric,
+                                               bool               columnar)
+            : m_output(columnar ? CSVStackFile(std::make_shared<ColumnarResultsWriter>(filename))
+                                : CSVStackFile(filename))
             , m_extraCol(exportExtraCols)
             , m_mergeSameProblems(mergeSameProblems)
             , m_performanceMetric(performanceMetric)
@@ -111,9 +128,16 @@ namespace TensileLite
                         m_winnerSolution    = m_solutionName;
                         m_winnerSolutionIdx = m_currSolutionIdx;
                         m_fastestGflops     = gflops;
+                        m_winnerCounters    = m_solutionCounters;
                     }
                 }
             }
+            else if(counterHeaders.count(key))
+            {
+                // Reported by the warmups, before the speed tells whether the solution wins
+                m_output.setHeaderForKey(key, counterHeaders.at(key));
+                m_solutionCounters[key] = valueStr;
+            }
             else
             {
                 m_output.setValueForKey(key, value);
@@ -239,11 +263,14 @@ namespace TensileLite
                         oldRow[ResultKey::SolutionWinner]    = newRow[ResultKey::SolutionWinner];
                         oldRow[ResultKey::TilesPerCu]        = newRow[ResultKey::TilesPerCu];
                         oldRow[ResultKey::TotalGranularity]  = newRow[ResultKey::TotalGranularity];
+                        for(auto const& counter : counterHeaders)
+                            if(oldRow.count(counter.first))
+                                oldRow[counter.first] = newRow[counter.first];
                     }
                 }
                 else if(key.compare(ResultKey::TimeUS) == 0
                         || key.compare(ResultKey::SolutionWinnerIdx) == 0
-                        || key.compare(ResultKey::SolutionWinner) == 0)
+                        || key.compare(ResultKey::SolutionWinner) == 0 || counterHeaders.count(key))
                 {
                     // skip, we update these together with FastestGFlops
                     continue;
@@ -275,6 +302,8 @@ namespace TensileLite
                 m_output.setValueForKey(ResultKey::SolutionWinnerIdx, m_winnerSolutionIdx);
                 m_output.setValueForKey(ResultKey::SolutionWinner, m_winnerSolution);
             }
+            for(auto const& counter : m_winnerCounters)
+                m_output.setValueForKey(counter.first, counter.second);
             // reset
             m_winnerSolution          = "";
             m_currSolutionIdx         = -1;
@@ -283,6 +312,7 @@ namespace TensileLite
             m_fasterTimeUS            = -1.0;
             m_fastestTilesPerCu       = -1.0;
             m_fastestTotalGranularity = -1.0;
+            m_winnerCounters.clear();
 
             if(!m_mergeSameProblems)
             {
@@ -303,6 +333,7 @@ namespace TensileLite
         {
             m_solutionName    = "";
             m_invalidSolution = false;
+            m_solutionCounters.clear();
         }
 
         void ResultFileReporter::finalizeReport()
@@ -46,6 +46,16 @@ namespace TensileLite
         m_rotatingInfo.push_back(RotatingUnitInfo{sizes, totalSize, 0});
     }
 
+    size_t RotatingMemory::getLargestTotalSize() const
+    {
+        size_t largestTotalSize = 0;
+        for(auto& unit : m_rotatingInfo)
+        {
+            largestTotalSize = std::max(largestTotalSize, unit.totalSize);
+        }
+        return largestTotalSize;
+    }
+
     void RotatingMemory::createRotatingMemory(int32_t mode, size_t rotatingSize)
     {
         // Check how many rotating units are needed
@@ -28,6 +28,9 @@
 
 #include "ResultReporter.hpp"
 #include <Tensile/Debug.hpp>
+#include <Tensile/hip/HipUtils.hpp>
+
+#include <algorithm>
 
 namespace TensileLite
 {
@@ -49,8 +52,19 @@ namespace TensileLite
             }
             else
             {
-                int firstSolutionIdx = args["solution-start-idx"].as<int>();
-                int numSolutions     = args["num-solutions"].as<int>();
+                int    firstSolutionIdx = args["solution-start-idx"].as<int>();
+                int    numSolutions     = args["num-solutions"].as<int>();
+                double pruneMargin      = args["prune-solutions"].as<double>();
+
+                if(pruneMargin > 0.0)
+                    return std::make_shared<PruningSolutionIterator>(
+                        library,
+                        hardware,
+                        firstSolutionIdx,
+                        numSolutions,
+                        printWinnerOnly,
+                        pruneMargin / 100.0,
+                        AllSolutionsIterator::CreateCriteria(library, hardware, args));
 
                 return std::make_shared<AllSolutionsIterator>(
                     library,
@@ -110,11 +124,9 @@ namespace TensileLite
                 return false;
             }
 
-            if(solution.requiredHostWorkspaceSizePerProblem == static_cast<size_t>(-1))
-            {
-                solution.requiredHostWorkspaceSizePerProblem
-                    = solution.requiredHostSizeGroupedGemmSingle(problem, *m_hardware);
-            }
+            solution.requiredHostWorkspaceSizePerProblem.init([&]() {
+                return solution.requiredHostSizeGroupedGemmSingle(problem, *m_hardware);
+            });
             return true;
         }
 
@@ -263,6 +275,148 @@ namespace TensileLite
             return true;
         }
 
+        PruningSolutionIterator::PruningSolutionIterator(
+            std::shared_ptr<MasterSolutionLibrary<ContractionProblemGemm>> library,
+            std::shared_ptr<Hardware>                                      hardware,
+            int                                                            firstSolutionIdx,
+            int                                                            numSolutions,
+            bool                                                           printWinnerOnly,
+            double                                                         pruneMargin,
+            RunCriteria                                                    runCriteria)
+            : AllSolutionsIterator(
+                library, hardware, firstSolutionIdx, numSolutions, printWinnerOnly, runCriteria)
+            , m_pruneMargin(pruneMargin)
+        {
+        }
+
+        void PruningSolutionIterator::preProblem(ContractionProblem* const problem)
+        {
+            AllSolutionsIterator::preProblem(problem);
+
+            m_candidates.clear();
+            auto begin = m_library->solutions.lower_bound(m_firstSolutionIdx);
+            auto end   = m_library->solutions.upper_bound(m_lastSolutionIdx);
+            for(auto iter = begin; iter != end; iter++)
+            {
+                double predicted = 0.0;
+                if(auto groupedProblem = dynamic_cast<ContractionProblemGroupedGemm*>(problem))
+                {
+                    for(auto const& gemm : groupedProblem->gemms)
+                        predicted += iter->second->predictedTime(gemm, *m_hardware);
+                }
+                else if(auto gemmProblem = dynamic_cast<ContractionProblemGemm*>(problem))
+                {
+                    predicted = iter->second->predictedTime(*gemmProblem, *m_hardware);
+                }
+                else
+                {
+                    throw std::runtime_error(
+                        "[PruningSolutionIterator] Failed to cast to any ContractionProblem");
+                }
+                m_candidates.push_back({iter->first, predicted});
+            }
+            std::stable_sort(m_candidates.begin(),
+                             m_candidates.end(),
+                             [](Candidate const& a, Candidate const& b) {
+                                 return a.predicted < b.predicted;
+                             });
+
+            m_position         = 0;
+            m_bestWarmupUs     = std::numeric_limits<double>::infinity();
+            m_bestUsPerPredict = std::numeric_limits<double>::infinity();
+            m_numPredictPruned = 0;
+            m_numWarmupPruned  = 0;
+        }
+
+        void PruningSolutionIterator::postProblem()
+        {
+            if(m_numPredictPruned || m_numWarmupPruned)
+                m_reporter->log(LogLevel::Normal,
+                                concatenate("Pruned ",
+                                            m_numPredictPruned,
+                                            " solutions by predicted time and ",
+                                            m_numWarmupPruned,
+                                            " by warmup time out of ",
+                                            m_candidates.size(),
+                                            "\n"));
+        }
+
+        void PruningSolutionIterator::preSolution(ContractionSolution const& solution)
+        {
+            m_currentSolutionIdx = m_candidates[m_position].index;
+            m_pruneCurrent       = false;
+
+            m_reporter->report(ResultKey::SolutionLibraryIndex, solution.libraryLogicIndex);
+            m_reporter->report(ResultKey::SolutionIndex, m_currentSolutionIdx);
+            m_reporter->report(ResultKey::SolutionProgress,
+                               concatenate(m_position, "/", m_candidates.size()));
+        }
+
+        void PruningSolutionIterator::postSolution()
+        {
+            if(m_pruneCurrent)
+                m_reporter->report(ResultKey::Validation, "PRUNED_BY_WARMUP");
+            m_position++;
+        }
+
+        void PruningSolutionIterator::postWarmup(TimingEvents const& startEvents,
+                                                 TimingEvents const& stopEvents,
+                                                 hipStream_t const&  stream)
+        {
+            if(startEvents->empty() || startEvents->front().empty())
+                return;
+
+            // The fastest warmup, the first may load the code object
+            float warmupMs = std::numeric_limits<float>::max();
+            HIP_CHECK_EXC(hipEventSynchronize(stopEvents->back().back()));
+            for(size_t i = 0; i < startEvents->size(); i++)
+            {
+                float ms = 0.0f;
+                HIP_CHECK_EXC(hipEventElapsedTime(
+                    &ms, startEvents->at(i).front(), stopEvents->at(i).back()));
+                warmupMs = std::min(warmupMs, ms);
+            }
+
+            double warmupUs  = warmupMs * 1000.0;
+            double predicted = m_candidates[m_position].predicted;
+            if(predicted > 0.0)
+                m_bestUsPerPredict = std::min(m_bestUsPerPredict, warmupUs / predicted);
+
+            if(warmupUs > m_bestWarmupUs * (1.0 + m_pruneMargin))
+            {
+                m_pruneCurrent = true;
+                m_numWarmupPruned++;
+            }
+            m_bestWarmupUs = std::min(m_bestWarmupUs, warmupUs);
+        }
+
+        bool PruningSolutionIterator::moreSolutionsInProblem() const
+        {
+            return m_position < m_candidates.size();
+        }
+
+        std::shared_ptr<ContractionSolution> PruningSolutionIterator::getSolution()
+        {
+            m_currentSolutionIdx = m_candidates[m_position].index;
+            return AllSolutionsIterator::getSolution();
+        }
+
+        bool PruningSolutionIterator::runCurrentSolution()
+        {
+            if(!AllSolutionsIterator::runCurrentSolution())
+                return false;
+
+            // Even at the best efficiency seen so far the solution would be too slow
+            double boundUs = m_candidates[m_position].predicted * m_bestUsPerPredict;
+            if(boundUs > m_bestWarmupUs * (1.0 + m_pruneMargin))
+            {
+                m_reporter->report(ResultKey::Validation, "PRUNED_BY_PREDICTION");
+                m_numPredictPruned++;
+                return false;
+            }
+            return true;
+        }
+
         BestSolutionIterator::BestSolutionIterator(
             std::shared_ptr<MasterSolutionLibrary<ContractionProblemGemm>> library,
             std::shared_ptr<Hardware>                                      hardware,
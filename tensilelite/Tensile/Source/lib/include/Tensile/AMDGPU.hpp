@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <initializer_list>
+#include <string>
+
 #include <Tensile/Tensile.hpp>
 
 namespace TensileLite
@@ -190,6 +193,87 @@ namespace TensileLite
             return "";
         }
 
+        /**
+         * Compute partition mode of the device. A partitioned device is exposed as one
+         * logical device per partition, with a share of the XCDs, CUs and L2 caches.
+         * The value is the number of partitions.
+         */
+        enum class ComputePartition : int
+        {
+            SPX = 1,
+            DPX = 2,
+            TPX = 3,
+            QPX = 4,
+            CPX = 8
+        };
+
+        /**
+         * Memory partition mode of the device, the number of NUMA nodes its memory is
+         * split into.
+         */
+        enum class MemoryPartition : int
+        {
+            NPS1 = 1,
+            NPS2 = 2,
+            NPS4 = 4,
+            NPS8 = 8
+        };
+
+        static std::string toString(ComputePartition p)
+        {
+            switch(p)
+            {
+            case ComputePartition::SPX:
+                return "SPX";
+            case ComputePartition::DPX:
+                return "DPX";
+            case ComputePartition::TPX:
+                return "TPX";
+            case ComputePartition::QPX:
+                return "QPX";
+            case ComputePartition::CPX:
+                return "CPX";
+            }
+            return "";
+        }
+
+        static std::string toString(MemoryPartition p)
+        {
+            switch(p)
+            {
+            case MemoryPartition::NPS1:
+                return "NPS1";
+            case MemoryPartition::NPS2:
+                return "NPS2";
+            case MemoryPartition::NPS4:
+                return "NPS4";
+            case MemoryPartition::NPS8:
+                return "NPS8";
+            }
+            return "";
+        }
+
+        // The modes as reported by the driver, such as "CPX" or "NPS4". Unknown names
+        // are the unpartitioned modes.
+        static ComputePartition toComputePartition(std::string const& name)
+        {
+            for(auto p : {ComputePartition::DPX,
+                          ComputePartition::TPX,
+                          ComputePartition::QPX,
+                          ComputePartition::CPX})
+                if(name.find(toString(p)) != std::string::npos)
+                    return p;
+            return ComputePartition::SPX;
+        }
+
+        static MemoryPartition toMemoryPartition(std::string const& name)
+        {
+            for(auto p : {MemoryPartition::NPS2, MemoryPartition::NPS4, MemoryPartition::NPS8})
+                if(name.find(toString(p)) != std::string::npos)
+                    return p;
+            return MemoryPartition::NPS1;
+        }
+
         AMDGPU();
         AMDGPU(Processor p, int computeUnitCount, std::string const& deviceName);
         ~AMDGPU();
@@ -203,8 +287,12 @@ namespace TensileLite
         int         skGridMultiplier = 1;
         int         skFixedGrid      = 0;
         int         skFullTiles      = 1;
+        size_t      l2CacheSize      = 0; // Bytes of L2 shared by the CUs of an XCD, 0 if unknown
         std::string deviceName;
 
+        ComputePartition computePartition = ComputePartition::SPX;
+        MemoryPartition  memoryPartition  = MemoryPartition::NPS1;
+
         virtual bool   runsKernelTargeting(Processor p) const;
         virtual size_t id() const
         {
@@ -255,7 +343,9 @@ namespace TensileLite
 
         bool operator==(AMDGPU const& rhs) const
         {
-            return processor == rhs.processor && computeUnitCount == rhs.computeUnitCount;
+            return processor == rhs.processor && computeUnitCount == rhs.computeUnitCount
+                   && computePartition == rhs.computePartition
+                   && memoryPartition == rhs.memoryPartition;
         }
     };
 
@@ -280,5 +370,7 @@ namespace TensileLite
     }
 
     TENSILE_API std::ostream& operator<<(std::ostream& stream, AMDGPU::Processor p);
+    TENSILE_API std::ostream& operator<<(std::ostream& stream, AMDGPU::ComputePartition p);
+    TENSILE_API std::ostream& operator<<(std::ostream& stream, AMDGPU::MemoryPartition p);
     TENSILE_API std::ostream& operator<<(std::ostream& stream, AMDGPU g);
 } // namespace TensileLite
@@ -108,6 +108,74 @@ namespace TensileLite
                 }
             };
 
+            // Rows of a table tuned for one partition mode. Tables without these predicates
+            // match any mode and rank by the CU count of the partition.
+            struct ComputePartitionEqual : public Predicate_CRTP<ComputePartitionEqual, AMDGPU>
+            {
+                enum
+                {
+                    HasIndex = false,
+                    HasValue = true
+                };
+                AMDGPU::ComputePartition value;
+
+                ComputePartitionEqual() = default;
+                ComputePartitionEqual(AMDGPU::ComputePartition p)
+                    : value(p)
+                {
+                }
+
+                static std::string Type()
+                {
+                    return "ComputePartition";
+                }
+
+                virtual bool operator()(AMDGPU const& gpu) const override
+                {
+                    return gpu.computePartition == value;
+                }
+
+                virtual bool debugEval(AMDGPU const& gpu,
+                                       std::ostream& stream) const override
+                {
+                    return debugEvalCmp(
+                        gpu, stream, "prob", gpu.computePartition, "==", "sol", value);
+                }
+            };
+
+            struct MemoryPartitionEqual : public Predicate_CRTP<MemoryPartitionEqual, AMDGPU>
+            {
+                enum
+                {
+                    HasIndex = false,
+                    HasValue = true
+                };
+                AMDGPU::MemoryPartition value;
+
+                MemoryPartitionEqual() = default;
+                MemoryPartitionEqual(AMDGPU::MemoryPartition p)
+                    : value(p)
+                {
+                }
+
+                static std::string Type()
+                {
+                    return "MemoryPartition";
+                }
+
+                virtual bool operator()(AMDGPU const& gpu) const override
+                {
+                    return gpu.memoryPartition == value;
+                }
+
+                virtual bool debugEval(AMDGPU const& gpu,
+                                       std::ostream& stream) const override
+                {
+                    return debugEvalCmp(
+                        gpu, stream, "prob", gpu.memoryPartition, "==", "sol", value);
+                }
+            };
+
             struct RunsKernelTargeting : public Predicate_CRTP<RunsKernelTargeting, AMDGPU>
             {
                 enum
@@ -66,6 +66,8 @@ namespace TensileLite
         All,
         Hipblaslt_all,
         Exp, // Verification use only.
+        Swiglu, // Gated, act(gate) * up over pairs of rows. Not a kernel activation.
+        Geglu, // Gated, act(gate) * up over pairs of rows. Not a kernel activation.
         Count
     };
 
@@ -26,11 +26,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <Tensile/ContractionProblem.hpp>
+#include <Tensile/SelectionTrace.hpp>
+#include <Tensile/SharedSelectionCache.hpp>
 #include <Tensile/SolutionLibrary.hpp>
 
 #include <Tensile/AMDGPU_Detail.hpp>
@@ -51,6 +61,105 @@ namespace TensileLite
         using type = std::unordered_map<Key, Value>;
     };
 
+    /**
+     * Lookup strategy of a CacheMap, selected with TENSILE_CACHE_MAP_MODE.
+     *
+     * Locked:   every lookup takes a shared lock on the reader/writer mutex.
+     * Snapshot: lookups read an immutable snapshot of the map that is replaced
+     *           RCU-style, and only write to a reader slot owned by the calling
+     *           thread. New entries are collected in a locked pending map and
+     *           published in batches. Replaced snapshots are freed once no reader
+     *           can still see them.
+     */
+    enum class CacheMapMode : int
+    {
+        Locked   = 0,
+        Snapshot = 1
+    };
+
+    /**
+     * Process-wide index of the calling thread, used to pick a private reader slot
+     * in CacheMaps. Indices are recycled when threads exit. Threads beyond
+     * MaxThreads get MaxThreads and fall back to locked lookups and shared counters.
+     */
+    class CacheMapThreadIndex
+    {
+    public:
+        static constexpr size_t MaxThreads = 256;
+
+        static size_t get()
+        {
+            thread_local CacheMapThreadIndex index;
+            return index.m_index;
+        }
+
+    private:
+        CacheMapThreadIndex()
+        {
+            std::lock_guard<std::mutex> lock(mutex());
+            auto&                       free = freeList();
+            if(!free.empty())
+            {
+                m_index = free.back();
+                free.pop_back();
+            }
+            else if(next() < MaxThreads)
+            {
+                m_index = next()++;
+            }
+        }
+
+        ~CacheMapThreadIndex()
+        {
+            if(m_index == MaxThreads)
+                return;
+            std::lock_guard<std::mutex> lock(mutex());
+            freeList().push_back(m_index);
+        }
+
+        static std::mutex& mutex()
+        {
+            static std::mutex m;
+            return m;
+        }
+
+        static std::vector<size_t>& freeList()
+        {
+            static std::vector<size_t> v;
+            return v;
+        }
+
+        static size_t& next()
+        {
+            static size_t n = 0;
+            return n;
+        }
+
+        size_t m_index = MaxThreads;
+    };
+
+    /**
+     * Counters of a CacheMap, see CacheMap::stats().
+     */
+    struct CacheMapStats
+    {
+        uint64_t hits      = 0;
+        uint64_t misses    = 0;
+        uint64_t evictions = 0;
+        uint64_t size      = 0;
+        uint64_t capacity  = 0; //!< 0 is unbounded
+
+        CacheMapStats& operator+=(CacheMapStats const& other)
+        {
+            hits += other.hits;
+            misses += other.misses;
+            evictions += other.evictions;
+            size += other.size;
+            capacity += other.capacity;
+            return *this;
+        }
+    };
+
     /**
      * Thread-safe multi-valued cache.
      *
@@ -61,96 +170,398 @@ namespace TensileLite
      *     CacheMap<int, float, std::string> myCache
      *     myCache.find("foo", 1.4); // great
      *     myCache.find(1.4, "foo"); // error!
+     *
+     * With a non-zero capacity (TENSILE_CACHE_MAP_CAPACITY) the cache holds at most
+     * that many entries and evicts with the CLOCK algorithm: a hit sets the reference
+     * bit of its entry, and add() sweeps the clock hand past referenced entries,
+     * clearing their bits, until it finds one to replace.
      */
     template <typename Value, typename... Keys>
     class CacheMap
     {
-        using Map = typename MultiLevelMap<Value, Keys...>::type;
+        struct Entry
+        {
+            Value  value;
+            size_t clock; // Slot in the clock ring, 0 when unbounded
+        };
+
+        using Map = typename MultiLevelMap<Entry, Keys...>::type;
+
+        // The keys in the order they are passed to find() and add()
+        template <size_t... I>
+        static auto reverseKeys(std::index_sequence<I...>)
+            -> std::tuple<std::tuple_element_t<sizeof...(Keys) - 1 - I, std::tuple<Keys...>>...>;
+        using KeyTuple = decltype(reverseKeys(std::index_sequence_for<Keys...>{}));
+
+        // Pending entries are published once they reach this fraction of the snapshot,
+        // or once they have been hit this many times.
+        static constexpr size_t  PublishMinEntries  = 32;
+        static constexpr size_t  PublishSizeDivisor = 8;
+        static constexpr int64_t PublishAfterHits   = 64;
+
+        // Lookups of both modes are counted in the slot of the calling thread, so that
+        // concurrent lookups never contend on a shared counter
+        struct alignas(64) ReaderSlot
+        {
+            // Epoch the reader entered at, 0 when idle. Snapshot mode only
+            std::atomic<uint64_t> epoch{0};
+            // Only written by the thread owning the slot
+            std::atomic<uint64_t> hits{0};
+            std::atomic<uint64_t> misses{0};
+        };
 
     public:
-        CacheMap(Value const& nullValue)
+        CacheMap(Value const& nullValue,
+                 CacheMapMode mode = static_cast<CacheMapMode>(Debug::Instance().cacheMapMode()),
+                 size_t       capacity = Debug::Instance().cacheMapCapacity())
             : m_nullValue(nullValue)
+            , m_mode(mode)
+            , m_capacity(capacity)
             , m_lookupEfficiency(Debug::Instance().printLookupEfficiency())
-            , m_lookups(0)
-            , m_hits(0)
-
         {
+            m_readers = std::make_unique<ReaderSlot[]>(CacheMapThreadIndex::MaxThreads);
+            if(m_mode == CacheMapMode::Snapshot)
+                m_snapshot.store(new Map());
+
+            if(m_capacity)
+            {
+                m_clockKeys.reserve(m_capacity);
+                m_referenced = std::make_unique<std::atomic<uint8_t>[]>(m_capacity);
+            }
         }
 
         ~CacheMap()
         {
             if(m_lookupEfficiency)
-                std::cout << "CacheMap: " << m_hits << "/" << m_lookups << " cache hits"
-                          << std::endl;
+            {
+                auto s = stats();
+                std::cout << "CacheMap: " << s.hits << "/" << s.hits + s.misses
+                          << " cache hits, " << s.evictions << " evictions" << std::endl;
+            }
+
+            delete m_snapshot.load();
+            for(auto& retired : m_retired)
+                delete retired.second;
         }
 
         template <typename... Ks>
         Value find(Ks const&... keys)
         {
+            size_t index = CacheMapThreadIndex::get();
+            auto   rv    = m_mode == CacheMapMode::Snapshot ? findSnapshot(index, keys...)
+                                                            : findLocked(keys...);
+
+            countLookup(index, rv != m_nullValue);
+
+            return rv;
+        }
+
+        template <typename... Ks>
+        void add(Value const& value, Ks const&... ks)
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+
+            // Another thread may have added the entry since our lookup missed
+            auto* snapshot = m_snapshot.load();
+            if(find_impl(m_map, ks...) || (snapshot && find_impl(*snapshot, ks...)))
+                return;
+
+            size_t clock = 0;
+            if(m_capacity)
+            {
+                if(m_clockKeys.size() < m_capacity)
+                {
+                    clock = m_clockKeys.size();
+                    m_clockKeys.emplace_back(ks...);
+                }
+                else
+                {
+                    clock              = evict();
+                    m_clockKeys[clock] = KeyTuple(ks...);
+                }
+                m_referenced[clock].store(0, std::memory_order_relaxed);
+            }
+
+            add_impl(m_map, Entry{value, clock}, ks...);
+            m_size++;
+            if(m_mode != CacheMapMode::Snapshot)
+                return;
+
+            m_pendingSize++;
+            if(m_pendingSize >= std::max(PublishMinEntries, m_snapshotSize / PublishSizeDivisor))
+                publish();
+        }
+
+        /**
+         * Lookup and eviction counters and the current number of entries. The
+         * counters are read without synchronizing with concurrent lookups.
+         */
+        CacheMapStats stats() const
+        {
+            CacheMapStats rv;
+            rv.hits   = m_hits.load(std::memory_order_relaxed);
+            rv.misses = m_misses.load(std::memory_order_relaxed);
+            for(size_t i = 0; i < CacheMapThreadIndex::MaxThreads; i++)
+            {
+                rv.hits += m_readers[i].hits.load(std::memory_order_relaxed);
+                rv.misses += m_readers[i].misses.load(std::memory_order_relaxed);
+            }
+
             std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+            rv.evictions = m_evictions;
+            rv.size      = m_size;
+            rv.capacity  = m_capacity;
 
-            auto rv = find_impl(m_map, keys...);
+            return rv;
+        }
 
-            if(m_lookupEfficiency)
+    private:
+        template <typename... Ks>
+        Value findLocked(Ks const&... keys)
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+            return touch(find_impl(m_map, keys...));
+        }
+
+        template <typename... Ks>
+        Value findSnapshot(size_t index, Ks const&... keys)
+        {
+            if(index < CacheMapThreadIndex::MaxThreads)
             {
-                m_lookups++;
+                // Announce the epoch before loading the snapshot, see reclaim()
+                auto& reader = m_readers[index].epoch;
+                reader.store(m_epoch.load());
+                auto rv = touch(find_impl(*m_snapshot.load(), keys...));
+                reader.store(0, std::memory_order_release);
+
                 if(rv != m_nullValue)
-                    m_hits++;
+                    return rv;
+            }
+
+            Value rv = m_nullValue;
+            {
+                std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+                if(index >= CacheMapThreadIndex::MaxThreads)
+                    rv = touch(find_impl(*m_snapshot.load(), keys...));
+                if(rv == m_nullValue)
+                    rv = touch(find_impl(m_map, keys...));
+            }
+
+            // Publish early when recently added entries are in use
+            if(rv != m_nullValue && ++m_pendingHits >= PublishAfterHits)
+            {
+                std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+                if(m_pendingSize)
+                    publish();
             }
 
             return rv;
         }
 
-        template <typename... Ks>
-        void add(Value const& value, Ks const&... ks)
+        // Sets the reference bit of a hit. The bit is only written when it is clear,
+        // so repeated hits on a hot entry do not write shared memory.
+        Value touch(Entry const* entry)
         {
-            std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+            if(!entry)
+                return m_nullValue;
+
+            if(m_capacity && !m_referenced[entry->clock].load(std::memory_order_relaxed))
+                m_referenced[entry->clock].store(1, std::memory_order_relaxed);
 
-            add_impl(m_map, value, ks...);
+            return entry->value;
+        }
+
+        // Threads past CacheMapThreadIndex::MaxThreads share the atomic counters
+        void countLookup(size_t index, bool hit)
+        {
+            if(index < CacheMapThreadIndex::MaxThreads)
+            {
+                auto& counter = hit ? m_readers[index].hits : m_readers[index].misses;
+                counter.store(counter.load(std::memory_order_relaxed) + 1,
+                              std::memory_order_relaxed);
+            }
+            else
+            {
+                (hit ? m_hits : m_misses).fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Requires m_mutex to be held exclusively. Removes the entry under the clock
+        // hand, or the first unreferenced one after it, and returns its clock slot.
+        size_t evict()
+        {
+            // Bounded so that concurrent hits cannot keep the hand spinning
+            for(size_t i = 0;
+                i < 2 * m_capacity && m_referenced[m_hand].load(std::memory_order_relaxed);
+                i++)
+            {
+                m_referenced[m_hand].store(0, std::memory_order_relaxed);
+                m_hand = (m_hand + 1) % m_capacity;
+            }
+
+            size_t victim = m_hand;
+            m_hand        = (m_hand + 1) % m_capacity;
+
+            auto const& keys   = m_clockKeys[victim];
+            bool        erased = std::apply(
+                [&](auto const&... ks) { return erase_impl(m_map, ks...); }, keys);
+
+            if(m_mode == CacheMapMode::Snapshot)
+            {
+                // Unpublished entries are only in m_map, the others are dropped from the
+                // next snapshot
+                if(erased)
+                    m_pendingSize--;
+                else
+                    m_evicted.push_back(keys);
+            }
+
+            m_evictions++;
+            m_size--;
+
+            return victim;
+        }
+
+        // Requires m_mutex to be held exclusively. In snapshot mode m_map holds the
+        // entries that are not published yet.
+        void publish()
+        {
+            auto* next = new Map(*m_snapshot.load());
+            for(auto const& keys : m_evicted)
+                std::apply([&](auto const&... ks) { erase_impl(*next, ks...); }, keys);
+            merge_impl(*next, m_map);
+
+            auto*    previous    = m_snapshot.exchange(next);
+            uint64_t retireEpoch = m_epoch.fetch_add(1) + 1;
+            m_retired.emplace_back(retireEpoch, previous);
+
+            m_snapshotSize = m_size;
+            m_pendingSize  = 0;
+            m_pendingHits  = 0;
+            m_map.clear();
+            m_evicted.clear();
+
+            reclaim();
+        }
+
+        // A reader that announced an epoch >= retireEpoch loaded the snapshot after
+        // it was replaced, so a retired snapshot can be freed once every active
+        // reader is at or past its retire epoch.
+        void reclaim()
+        {
+            uint64_t oldestReader = std::numeric_limits<uint64_t>::max();
+            for(size_t i = 0; i < CacheMapThreadIndex::MaxThreads; i++)
+            {
+                uint64_t epoch = m_readers[i].epoch.load();
+                if(epoch != 0)
+                    oldestReader = std::min(oldestReader, epoch);
+            }
+
+            auto it = std::remove_if(m_retired.begin(), m_retired.end(), [&](auto& retired) {
+                if(retired.first > oldestReader)
+                    return false;
+                delete retired.second;
+                return true;
+            });
+            m_retired.erase(it, m_retired.end());
         }
 
-    private:
         template <typename SubMap, typename K>
-        Value find_impl(SubMap const& map, K const& key)
+        Entry const* find_impl(SubMap const& map, K const& key) const
         {
             auto iter = map.find(key);
 
             if(iter == map.end())
-                return m_nullValue;
+                return nullptr;
 
-            return iter->second;
+            return &iter->second;
         }
 
         template <typename SubMap, typename K, typename... Ks>
-        Value find_impl(SubMap const& map, K const& key, Ks const&... ks)
+        Entry const* find_impl(SubMap const& map, K const& key, Ks const&... ks) const
         {
             auto iter = map.find(key);
 
             if(iter == map.end())
-                return m_nullValue;
+                return nullptr;
 
             return find_impl(iter->second, ks...);
         }
 
         template <typename SubMap, typename K>
-        void add_impl(SubMap& map, Value const& value, K const& key)
+        void add_impl(SubMap& map, Entry const& entry, K const& key)
         {
-            map.emplace(key, value);
+            map.emplace(key, entry);
         }
 
         template <typename SubMap, typename K, typename... Ks>
-        void add_impl(SubMap& map, Value const& value, K const& key, Ks const&... ks)
+        void add_impl(SubMap& map, Entry const& entry, K const& key, Ks const&... ks)
         {
-            add_impl(map[key], value, ks...);
+            add_impl(map[key], entry, ks...);
+        }
+
+        template <typename SubMap, typename K>
+        bool erase_impl(SubMap& map, K const& key)
+        {
+            return map.erase(key) != 0;
+        }
+
+        template <typename SubMap, typename K, typename... Ks>
+        bool erase_impl(SubMap& map, K const& key, Ks const&... ks)
+        {
+            auto iter = map.find(key);
+
+            if(iter == map.end())
+                return false;
+
+            bool erased = erase_impl(iter->second, ks...);
+            if(iter->second.empty())
+                map.erase(iter);
+
+            return erased;
         }
 
-        Map                     m_map;
-        std::shared_timed_mutex m_mutex;
-        Value                   m_nullValue;
+        template <typename SubMap>
+        void merge_impl(SubMap& dst, SubMap const& src)
+        {
+            for(auto const& entry : src)
+            {
+                if constexpr(std::is_same<typename SubMap::mapped_type, Entry>::value)
+                    dst.insert_or_assign(entry.first, entry.second);
+                else
+                    merge_impl(dst[entry.first], entry.second);
+            }
+        }
 
-        bool                 m_lookupEfficiency;
-        std::atomic<int64_t> m_lookups;
-        std::atomic<int64_t> m_hits;
+        Map                             m_map;
+        mutable std::shared_timed_mutex m_mutex;
+        Value                           m_nullValue;
+        CacheMapMode                    m_mode;
+        size_t                          m_size = 0;
+
+        std::unique_ptr<ReaderSlot[]> m_readers;
+
+        // Snapshot mode only
+        std::atomic<Map const*>                      m_snapshot{nullptr};
+        std::atomic<uint64_t>                        m_epoch{1};
+        std::vector<std::pair<uint64_t, Map const*>> m_retired;
+        std::vector<KeyTuple>                        m_evicted;
+        size_t                                       m_snapshotSize = 0;
+        size_t                                       m_pendingSize  = 0;
+        std::atomic<int64_t>                         m_pendingHits{0};
+
+        // Bounded capacity only
+        size_t                                  m_capacity;
+        size_t                                  m_hand = 0;
+        std::vector<KeyTuple>                   m_clockKeys;
+        std::unique_ptr<std::atomic<uint8_t>[]> m_referenced;
+        uint64_t                                m_evictions = 0;
+
+        bool                  m_lookupEfficiency;
+        std::atomic<uint64_t> m_hits{0};
+        std::atomic<uint64_t> m_misses{0};
     };
 
     template <typename MyProblem, typename MySolution = typename MyProblem::Solution>
@@ -162,12 +573,15 @@ namespace TensileLite
         using Caches = CacheMap<SolutionVector<MySolution>, AMDGPU, MyProblem>;
         using CachesGroupedGemm
             = CacheMap<SolutionVector<MySolution>, AMDGPU, std::vector<MyProblem>>;
+        using CachesGroupedGemmShape
+            = CacheMap<SolutionVector<MySolution>, AMDGPU, GroupedGemmShapeKey>;
 
         CachingLibrary(std::shared_ptr<Library> subLibrary)
             : m_subLibrary(subLibrary)
             , m_cache(std::make_tuple(nullptr, std::numeric_limits<double>::max()))
             , m_caches(SolutionVector<MySolution>{})
             , m_cachesGroupedGemm(SolutionVector<MySolution>{})
+            , m_cachesGroupedGemmShape(SolutionVector<MySolution>{})
         {
         }
 
@@ -195,9 +609,31 @@ namespace TensileLite
                 if(solution)
                     return solution;
 
+                auto& shared    = SharedSelectionCache::Instance();
+                bool  useShared = m_sharedTag != 0 && shared.enabled();
+                if(useShared)
+                {
+                    auto key   = sharedKey(SharedKind::Best, problem, amdgpu);
+                    int  index = -1;
+                    if(shared.find(key, &index, 1, fitness))
+                        solution = sharedSolution(index, problem, hardware);
+                    if(solution)
+                    {
+                        m_cache.add(std::make_tuple(solution, *fitness), problem, amdgpu);
+                        return solution;
+                    }
+                }
+
                 solution = m_subLibrary->findBestSolution(problem, hardware, fitness);
                 if(solution)
+                {
                     m_cache.add(std::make_tuple(solution, *fitness), problem, amdgpu);
+                    if(useShared)
+                        shared.add(sharedKey(SharedKind::Best, problem, amdgpu),
+                                   &solution->index,
+                                   1,
+                                   *fitness);
+                }
 
                 return solution;
             }
@@ -247,10 +683,41 @@ namespace TensileLite
             return m_subLibrary;
         }
 
+        /**
+         * Enables the SharedSelectionCache for this library. Indices read from it are
+         * resolved through `solutions`, the solution map of the enclosing
+         * MasterSolutionLibrary, before falling back to the sub library. `tag` tells
+         * apart libraries whose indices mean different solutions, 0 disables sharing.
+         */
+        void setSharedSolutions(std::map<int, std::shared_ptr<MySolution>> const* solutions,
+                                std::mutex*                                       guard,
+                                size_t                                            tag)
+        {
+            m_sharedSolutionMap   = solutions;
+            m_sharedSolutionGuard = guard;
+            m_sharedTag           = tag;
+        }
+
+        /**
+         * Combined counters of the single solution, top solutions and grouped gemm caches.
+         */
+        CacheMapStats cacheStats() const
+        {
+            auto rv = m_cache.stats();
+            rv += m_caches.stats();
+            rv += m_cachesGroupedGemm.stats();
+            rv += m_cachesGroupedGemmShape.stats();
+            return rv;
+        }
+
         virtual SolutionVector<MySolution> findTopSolutions(MyProblem const& problem,
                                                             Hardware const&  hardware,
                                                             int numSolutions) const override
         {
+            // A traced selection evaluates the candidates again
+            if(SelectionTrace::active())
+                return m_subLibrary->findTopSolutions(problem, hardware, numSolutions);
+
             try
             {
                 auto const&                amdgpu = dynamic_cast<AMDGPU const&>(hardware);
@@ -260,9 +727,20 @@ namespace TensileLite
                 if(solutions.size() != 0)
                     return solutions;
 
+                auto& shared    = SharedSelectionCache::Instance();
+                bool  useShared = m_sharedTag != 0 && shared.enabled();
+                if(useShared)
+                {
+                    solutions = sharedSolutions(problem, hardware, amdgpu);
+                    if(solutions.size() != 0)
+                    {
+                        m_caches.add(solutions, problem, amdgpu);
+                        return solutions;
+                    }
+                }
+
                 solutions = m_subLibrary->findTopSolutions(problem, hardware, numSolutions);
-                if(solutions.size() != 0)
-                    m_caches.add(solutions, problem, amdgpu);
+                addTopSolutions(solutions, problem, amdgpu, useShared);
 
                 return solutions;
             }
@@ -273,6 +751,52 @@ namespace TensileLite
             return m_subLibrary->findTopSolutions(problem, hardware, numSolutions);
         }
 
+        // The problems that miss the caches are selected by one call of the sub library
+        virtual std::vector<SolutionVector<MySolution>>
+            findTopSolutionsBatch(std::vector<MyProblem const*> const& problems,
+                                  Hardware const&                      hardware,
+                                  int numSolutions) const override
+        {
+            auto amdgpu = dynamic_cast<AMDGPU const*>(&hardware);
+            if(SelectionTrace::active() || amdgpu == nullptr)
+                return m_subLibrary->findTopSolutionsBatch(problems, hardware, numSolutions);
+
+            auto& shared    = SharedSelectionCache::Instance();
+            bool  useShared = m_sharedTag != 0 && shared.enabled();
+
+            std::vector<SolutionVector<MySolution>> rv(problems.size());
+            std::vector<MyProblem const*>           misses;
+            std::vector<size_t>                     missIndices;
+            for(size_t i = 0; i < problems.size(); i++)
+            {
+                rv[i] = m_caches.find(*problems[i], *amdgpu);
+                if(rv[i].size() == 0 && useShared)
+                {
+                    rv[i] = sharedSolutions(*problems[i], hardware, *amdgpu);
+                    if(rv[i].size() != 0)
+                        m_caches.add(rv[i], *problems[i], *amdgpu);
+                }
+
+                if(rv[i].size() == 0)
+                {
+                    misses.push_back(problems[i]);
+                    missIndices.push_back(i);
+                }
+            }
+
+            if(misses.empty())
+                return rv;
+
+            auto found = m_subLibrary->findTopSolutionsBatch(misses, hardware, numSolutions);
+            for(size_t i = 0; i < misses.size(); i++)
+            {
+                addTopSolutions(found[i], *misses[i], *amdgpu, useShared);
+                rv[missIndices[i]] = std::move(found[i]);
+            }
+
+            return rv;
+        }
+
         virtual SolutionVector<MySolution>
             findTopSolutionsGroupedGemm(std::vector<MyProblem> const& problems,
                                         Hardware const&               hardware,
@@ -287,10 +811,30 @@ namespace TensileLite
                 if(solutions.size() != 0)
                     return solutions;
 
+                // Group sizes usually change from call to call, so fall back to the
+                // solutions of a similar shape that still support these problems
+                bool                useShape = Debug::Instance().groupedGemmShapeCache();
+                GroupedGemmShapeKey shape;
+                if(useShape)
+                {
+                    shape = GroupedGemmShapeKey::FromProblems(problems);
+                    for(auto const& solution : m_cachesGroupedGemmShape.find(shape, amdgpu))
+                    {
+                        if(supportsGroupedGemm(*solution, problems, hardware))
+                            solutions.push_back(solution);
+                    }
+                    if(solutions.size() != 0)
+                        return solutions;
+                }
+
                 solutions
                     = m_subLibrary->findTopSolutionsGroupedGemm(problems, hardware, numSolutions);
                 if(solutions.size() != 0)
+                {
                     m_cachesGroupedGemm.add(solutions, problems, amdgpu);
+                    if(useShape)
+                        m_cachesGroupedGemmShape.add(solutions, shape, amdgpu);
+                }
 
                 return solutions;
             }
@@ -302,10 +846,118 @@ namespace TensileLite
         }
 
     private:
-        std::shared_ptr<Library>  m_subLibrary;
-        mutable Cache             m_cache;
-        mutable Caches            m_caches;
-        mutable CachesGroupedGemm m_cachesGroupedGemm;
+        enum class SharedKind : int
+        {
+            Best = 1,
+            Top  = 2
+        };
+
+        SharedSelectionKey
+            sharedKey(SharedKind kind, MyProblem const& problem, AMDGPU const& amdgpu) const
+        {
+            SharedSelectionKey key;
+            key.problem = std::hash<MyProblem>()(problem);
+            key.context = hash_combine(static_cast<int>(kind),
+                                       static_cast<int>(amdgpu.processor),
+                                       amdgpu.computeUnitCount,
+                                       static_cast<int>(amdgpu.computePartition),
+                                       static_cast<int>(amdgpu.memoryPartition),
+                                       m_sharedTag);
+            return key;
+        }
+
+        // A solution selected by another process. The index is only a hint: the entry
+        // may come from a colliding problem hash, so the predicates are checked again.
+        std::shared_ptr<MySolution>
+            sharedSolution(int index, MyProblem const& problem, Hardware const& hardware) const
+        {
+            std::shared_ptr<MySolution> solution;
+            if(m_sharedSolutionMap)
+            {
+                std::lock_guard<std::mutex> guard(*m_sharedSolutionGuard);
+                auto                        iter = m_sharedSolutionMap->find(index);
+                if(iter != m_sharedSolutionMap->end())
+                    solution = iter->second;
+            }
+
+            // Not loaded yet in this process, resolve through the library tree instead
+            if(!solution)
+                solution = m_subLibrary->getSolutionByIndex(problem, hardware, index);
+
+            if(solution && (*solution->hardwarePredicate)(hardware)
+               && (*solution->problemPredicate)(problem))
+                return solution;
+            return nullptr;
+        }
+
+        void addTopSolutions(SolutionVector<MySolution> const& solutions,
+                             MyProblem const&                  problem,
+                             AMDGPU const&                     amdgpu,
+                             bool                              useShared) const
+        {
+            if(solutions.size() == 0)
+                return;
+
+            m_caches.add(solutions, problem, amdgpu);
+            if(useShared)
+            {
+                std::vector<int> indices;
+                for(auto const& solution : solutions)
+                    indices.push_back(solution->index);
+                SharedSelectionCache::Instance().add(
+                    sharedKey(SharedKind::Top, problem, amdgpu), indices.data(), indices.size());
+            }
+        }
+
+        SolutionVector<MySolution> sharedSolutions(MyProblem const& problem,
+                                                   Hardware const&  hardware,
+                                                   AMDGPU const&    amdgpu) const
+        {
+            constexpr size_t maxIndices = SharedSelectionCache::MaxIndices;
+
+            int  indices[maxIndices];
+            auto count = SharedSelectionCache::Instance().find(
+                sharedKey(SharedKind::Top, problem, amdgpu), indices, maxIndices);
+
+            SolutionVector<MySolution> solutions;
+            for(size_t i = 0; i < count; i++)
+            {
+                auto solution = sharedSolution(indices[i], problem, hardware);
+                if(!solution)
+                    return {};
+                solutions.push_back(solution);
+            }
+            return solutions;
+        }
+
+        // Same checks as SingleSolutionLibrary::findBestSolution() for grouped gemm
+        static bool supportsGroupedGemm(MySolution const&             solution,
+                                        std::vector<MyProblem> const& problems,
+                                        Hardware const&               hardware)
+        {
+            if(!(*solution.hardwarePredicate)(hardware))
+                return false;
+
+            size_t ws = solution.requiredWorkspaceSizeGroupedGemm(problems, hardware);
+            for(auto problem : problems)
+            {
+                problem.setWorkspaceSizeGroupedGemm(ws);
+                problem.setGroupedGemmCount(problems.size());
+                if(!(*solution.problemPredicate)(problem))
+                    return false;
+            }
+            return true;
+        }
+
+        std::shared_ptr<Library>       m_subLibrary;
+        mutable Cache                  m_cache;
+        mutable Caches                 m_caches;
+        mutable CachesGroupedGemm      m_cachesGroupedGemm;
+        mutable CachesGroupedGemmShape m_cachesGroupedGemmShape;
+
+        std::map<int, std::shared_ptr<MySolution>> const* m_sharedSolutionMap   = nullptr;
+        std::mutex*                                       m_sharedSolutionGuard = nullptr;
+        size_t                                            m_sharedTag           = 0;
     };
 
 #if 0
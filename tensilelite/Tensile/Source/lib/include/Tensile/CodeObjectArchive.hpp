@@ -0,0 +1,92 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TensileLite
+{
+    /**
+     * Code objects of one architecture packed into a single file with a sorted
+     * name index, written offline by WriteCodeObjectArchive. The archive is
+     * mapped once and every code object is a slice of the mapping, so a
+     * library of hundreds of small code object files costs one open instead
+     * of one per file, which matters on network file systems.
+     *
+     * hip::SolutionAdapter looks for TensileCodeObjects_<arch>.coa in the code
+     * object directory and loads the files it finds in it with
+     * hipModuleLoadData, falling back to the files themselves.
+     */
+    class CodeObjectArchive
+    {
+    public:
+        /**
+         * Maps path, returns nullptr when it is missing or not a valid image.
+         */
+        static std::shared_ptr<CodeObjectArchive> Open(std::string const& path);
+
+        ~CodeObjectArchive();
+
+        CodeObjectArchive(CodeObjectArchive const&)            = delete;
+        CodeObjectArchive& operator=(CodeObjectArchive const&) = delete;
+
+        /**
+         * Returns the image of the code object file called name, without its
+         * directory, and stores its size in bytes. nullptr when not packed.
+         */
+        void const* find(std::string const& name, size_t* bytes = nullptr) const;
+
+        size_t size() const;
+
+    private:
+        friend bool WriteCodeObjectArchive(std::string const&              path,
+                                           std::vector<std::string> const& files);
+
+        struct Header;
+        struct Entry;
+
+        CodeObjectArchive() = default;
+
+        void*         m_data    = nullptr;
+        size_t        m_size    = 0;
+        Header const* m_header  = nullptr;
+        Entry const*  m_entries = nullptr;
+        char const*   m_strings = nullptr;
+    };
+
+    /**
+     * Packs the code object files into the image read by CodeObjectArchive,
+     * each one under its file name. Returns false when a file cannot be read
+     * or path cannot be written.
+     */
+    bool WriteCodeObjectArchive(std::string const& path, std::vector<std::string> const& files);
+} // namespace TensileLite
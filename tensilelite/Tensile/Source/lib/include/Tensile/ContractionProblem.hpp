@@ -108,6 +108,42 @@ namespace TensileLite
             return m_wgmxccg;
         }
 
+        void setStreamK(uint8_t streamK)
+        {
+            m_streamK = streamK;
+        }
+
+        uint8_t streamK() const
+        {
+            return m_streamK;
+        }
+
+        void setSKGridFraction(float skGridFraction)
+        {
+            m_skGridFraction = skGridFraction;
+        }
+
+        float skGridFraction() const
+        {
+            return m_skGridFraction;
+        }
+
+        void setCUBudget(uint32_t cuBudget)
+        {
+            m_cuBudget = cuBudget;
+        }
+
+        uint32_t cuBudget() const
+        {
+            return m_cuBudget;
+        }
+
+        // CUs that persistent and StreamK grids are sized to, out of computeUnitCount
+        size_t budgetedCUs(size_t computeUnitCount) const
+        {
+            return m_cuBudget && m_cuBudget < computeUnitCount ? m_cuBudget : computeUnitCount;
+        }
+
         void setBiasEnum(DataType dataType)
         {
             m_biasType = dataType;
@@ -140,7 +176,9 @@ namespace TensileLite
 
         void resetInternalArgs()
         {
-            m_gsu = 0;
+            m_gsu            = 0;
+            m_streamK        = 0;
+            m_skGridFraction = 0.0f;
         }
 
     private:
@@ -150,6 +188,9 @@ namespace TensileLite
         int16_t        m_wgm            = 0; // default value
         uint16_t       m_wgmxcc         = 0; // default value
         int16_t        m_wgmxccg        = 0; // default value
+        uint8_t        m_streamK        = 0; // default value
+        float          m_skGridFraction = 0.0f; // default value
+        uint32_t       m_cuBudget       = 0; // default value
         DataType       m_biasType       = DataType::None;
         int            m_factorDim      = 0;
         ActivationType m_activationType = ActivationType::None;
@@ -1267,6 +1308,30 @@ namespace TensileLite
         }
     };
 
+    /**
+     * Summary of a grouped gemm used as a solution cache key. It keeps the
+     * problem type exactly and the group sizes only as statistics rounded up
+     * to powers of two, so steps whose group sizes are distributed alike
+     * share an entry.
+     */
+    struct TENSILE_API GroupedGemmShapeKey
+    {
+        size_t typeHash = 0;
+        size_t count    = 0;
+        size_t maxM     = 0;
+        size_t medianM  = 0;
+        // Exact when shared by all groups, the bucketed maximum otherwise
+        size_t n       = 0;
+        size_t k       = 0;
+        size_t batch   = 0;
+        bool   sharedN = false;
+        bool   sharedK = false;
+
+        static GroupedGemmShapeKey FromProblems(std::vector<ContractionProblemGemm> const& problems);
+
+        bool operator==(GroupedGemmShapeKey const& rhs) const;
+    };
+
     struct TENSILE_API ContractionInputs : public ProblemInputs
     {
         ContractionInputs();
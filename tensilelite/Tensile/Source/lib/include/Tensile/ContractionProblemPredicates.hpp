@@ -35,6 +35,7 @@
 #include <Tensile/hip/HipHardware.hpp>
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <limits>
@@ -1524,6 +1525,16 @@ namespace TensileLite
                     return "WorkspaceCheck";
                 }
 
+                /**
+                 * Number of times a solution was rejected because the workspace of the
+                 * problem was too small for it.
+                 */
+                static std::atomic<uint64_t>& Shortfalls()
+                {
+                    static std::atomic<uint64_t> shortfalls{0};
+                    return shortfalls;
+                }
+
                 static size_t
                     reductionSize(ContractionProblemGemm const& problem, int& elemC, int& elemBias)
                 {
@@ -1557,11 +1568,13 @@ namespace TensileLite
                     if(problem.d().totalLogicalElements() * elemC > MAX_GSU_WORKSPACE_SIZE)
                         return 0;
 
-                    if(problem.groupedGemm())
-                        return problem.workspaceSizeGroupedGemm() <= problem.workspaceSize();
-                    else
-                        return problem.d().totalLogicalElements() * elemC + rs
-                               <= problem.workspaceSize();
+                    bool fits = problem.groupedGemm()
+                                    ? problem.workspaceSizeGroupedGemm() <= problem.workspaceSize()
+                                    : problem.d().totalLogicalElements() * elemC + rs
+                                          <= problem.workspaceSize();
+                    if(!fits)
+                        Shortfalls().fetch_add(1, std::memory_order_relaxed);
+                    return fits;
                 }
 
                 virtual bool debugEval(ContractionProblemGemm const& problem,
@@ -2654,6 +2667,18 @@ namespace TensileLite
                                         0);
                 }
             };
+
+            /**
+             * Whether a problem predicate can be shared by MemoRegistry. The AI bounds
+             * print their double value rounded and WorkgroupMappingXCCCheck depends on the
+             * CU count of the device it was loaded on.
+             */
+            inline bool Memoizable(Predicate<ContractionProblemGemm> const& term)
+            {
+                return !dynamic_cast<AIGreaterThanEqual const*>(&term)
+                       && !dynamic_cast<AILessThanEqual const*>(&term)
+                       && !dynamic_cast<WorkgroupMappingXCCCheck const*>(&term);
+            }
         } // namespace Contraction
 
         /**
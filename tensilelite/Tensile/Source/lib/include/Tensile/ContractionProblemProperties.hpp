@@ -220,6 +220,64 @@ namespace TensileLite
         };
     } // namespace Contraction
 
+    namespace ProblemKey
+    {
+        /**
+         * Direct accessors for the sizes that the gemm matching tables are keyed on.
+         */
+        template <>
+        struct PropertyAccess<ContractionProblemGemm, size_t>
+        {
+            enum
+            {
+                FreeSizeAId,
+                FreeSizeBId,
+                BatchSizeId,
+                BoundSizeId
+            };
+
+            static int Id(Property<ContractionProblemGemm> const& property, size_t& index)
+            {
+                if(auto p = dynamic_cast<Contraction::FreeSizeA const*>(&property))
+                {
+                    index = p->index;
+                    return FreeSizeAId;
+                }
+                if(auto p = dynamic_cast<Contraction::FreeSizeB const*>(&property))
+                {
+                    index = p->index;
+                    return FreeSizeBId;
+                }
+                if(auto p = dynamic_cast<Contraction::BatchSize const*>(&property))
+                {
+                    index = p->index;
+                    return BatchSizeId;
+                }
+                if(auto p = dynamic_cast<Contraction::BoundSize const*>(&property))
+                {
+                    index = p->index;
+                    return BoundSizeId;
+                }
+                return -1;
+            }
+
+            static size_t Get(int id, size_t index, ContractionProblemGemm const& problem)
+            {
+                switch(id)
+                {
+                case FreeSizeAId:
+                    return problem.freeSizeA(index);
+                case FreeSizeBId:
+                    return problem.freeSizeB(index);
+                case BatchSizeId:
+                    return problem.batchSize(index);
+                default:
+                    return problem.boundSize(index);
+                }
+            }
+        };
+    } // namespace ProblemKey
+
     /**
  * @}
  */
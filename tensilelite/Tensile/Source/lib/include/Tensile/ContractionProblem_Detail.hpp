@@ -136,6 +136,10 @@ namespace TensileLite
                                         rhs.useScaleAlphaVec(),
                                         lhs.outputAmaxD(),
                                         rhs.outputAmaxD(),
+                                        lhs.sparse(),
+                                        rhs.sparse(),
+                                        lhs.cEqualsD(),
+                                        rhs.cEqualsD(),
                                         lhs.f32XdlMathOp(),
                                         rhs.f32XdlMathOp());
         }
@@ -173,10 +177,29 @@ namespace std
                                          problem.useScaleCD(),
                                          problem.useScaleAlphaVec(),
                                          problem.outputAmaxD(),
+                                         problem.sparse(),
+                                         problem.cEqualsD(),
                                          problem.f32XdlMathOp());
         }
     };
 
+    template <>
+    struct hash<TensileLite::GroupedGemmShapeKey>
+    {
+        inline size_t operator()(TensileLite::GroupedGemmShapeKey const& key) const
+        {
+            return TensileLite::hash_combine(key.typeHash,
+                                             key.count,
+                                             key.maxM,
+                                             key.medianM,
+                                             key.n,
+                                             key.k,
+                                             key.batch,
+                                             key.sharedN,
+                                             key.sharedK);
+        }
+    };
+
     template <>
     struct hash<std::vector<TensileLite::ContractionProblemGemm>>
     {
@@ -210,6 +233,7 @@ namespace std
                                               problem.useScaleCD(),
                                               problem.useScaleAlphaVec(),
                                               problem.outputAmaxD(),
+                                              problem.cEqualsD(),
                                               problem.f32XdlMathOp());
             }
             return hash;
@@ -30,6 +30,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <Tensile/Tensile.hpp>
@@ -105,52 +106,74 @@ namespace TensileLite
         size_t depthUorMT1;
     };
 
+    // Members are grouped by size, so that the solutions of a library pack without padding
     struct SizeMapping
     {
         size_t waveNum;
+        size_t grvwA                    = 1;
+        size_t grvwB                    = 1;
+        size_t gwvwC                    = 1;
+        size_t gwvwD                    = 1;
+        size_t staggerU                 = 0;
+        size_t staggerUMapping          = 0;
+        size_t depthU                   = 0;
+        size_t globalSplitUPGR          = 0;
+        size_t globalSplitU             = 0;
+        size_t staggerStrideShift       = 0;
+        size_t packBatchDims            = 0;
+        size_t workspaceSizePerElemC    = 0;
+        size_t workspaceSizePerElemBias = 0;
+
+        std::string customKernelName;
 
         dim3 workGroupSize;
         dim3 threadTile;
         dim3 macroTile;
 
         std::array<int, 4> matrixInstruction;
-        size_t             grvwA = 1;
-        size_t             grvwB = 1;
-        size_t             gwvwC = 1;
-        size_t             gwvwD = 1;
-
-        size_t staggerU           = 0;
-        size_t staggerUMapping    = 0;
-        size_t depthU             = 0;
-        size_t globalSplitUPGR    = 0;
-        size_t globalSplitU       = 0;
-        size_t staggerStrideShift = 0;
-        int    workGroupMapping   = 0;
-
-        size_t packBatchDims              = 0;
-        int    packSummationDims          = 0;
-        int    magicDivAlg                = 1;
-        int    streamK                    = 0;
-        int    streamKAtomic              = 0;
-        int    persistentKernel           = 0;
-        bool   persistentKernelAlongBatch = false;
-
-        bool sourceKernel = false;
-
-        int    globalAccumulation       = 0;
-        size_t workspaceSizePerElemC    = 0;
-        size_t workspaceSizePerElemBias = 0;
-
-        bool activationFused = true;
 
-        std::string customKernelName;
-
-        int  workGroupMappingXCC                    = 0;
-        int  workGroupMappingXCCGroup               = 0;
+        int workGroupMapping         = 0;
+        int packSummationDims        = 0;
+        int magicDivAlg              = 1;
+        int streamK                  = 0;
+        int streamKAtomic            = 0;
+        int persistentKernel         = 0;
+        int globalAccumulation       = 0;
+        int workGroupMappingXCC      = 0;
+        int workGroupMappingXCCGroup = 0;
+
+        // Temporal hint of the buffer loads of B and stores of D: 0 regular, 1 nontemporal,
+        // 2 high temporal
+        int temporalHintB = 0;
+        int temporalHintD = 0;
+
+        bool persistentKernelAlongBatch             = false;
+        bool sourceKernel                           = false;
+        bool activationFused                        = true;
         bool globalSplitUCoalesced                  = false;
         bool globalSplitUWorkGroupMappingRoundRobin = false;
     };
 
+    /**
+ * Host memory held by loaded solutions, by category. Filled in by
+ * ContractionSolution::addHostMemory for each solution of a library.
+ */
+    struct SolutionHostMemory
+    {
+        size_t solutions     = 0;
+        size_t solutionBytes = 0; // The objects, SizeMapping and ProblemType included
+        size_t nameBytes     = 0; // Heap of the kernel and solution names
+        size_t stringBytes   = 0; // Heap of the other strings that are not interned
+        size_t vectorBytes   = 0; // Heap of the bias white lists and ideals
+        size_t predicates    = 0; // Distinct predicate objects
+        size_t predicateRefs = 0; // Predicate objects reached from the solutions
+
+        // Predicates counted so far
+        std::unordered_set<void const*> seen;
+    };
+
+    std::ostream& operator<<(std::ostream& stream, SolutionHostMemory const& usage);
+
     /**
  * Represents a single kernel or set of kernels that can perform a single
  * tensor contraction.
@@ -274,7 +297,36 @@ namespace TensileLite
         size_t requiredWorkspaceSizeGroupedGemm(std::vector<Problem> const& problems, Hardware const& hardware) const;
         size_t requiredHostSizeGroupedGemmSingle(Problem const& problem, Hardware const& hardware) const;
 
+        /**
+   * Bytes of zero-initialized Synchronizer memory the kernels read through
+   * inputs.Synchronizer, 0 if they don't use it.
+   */
+        size_t requiredSynchronizerSize(Problem const& problem) const;
+
+        static constexpr size_t SynchronizerFlagsPerGemm = 40960;
+        static constexpr size_t SynchronizerMaxGroups    = 16;
+
         size_t getSKGrid(Problem const& problem, Hardware const& hardware, size_t tiles) const;
+
+        /**
+   * Adds the host memory of this solution to usage, predicates shared with
+   * the solutions added before are only counted once.
+   */
+        void addHostMemory(SolutionHostMemory& usage) const;
+
+        /**
+   * Split-k that fills the budgeted CUs of hardware with the tiles of problem within
+   * problem.workspaceSize(), 0 if the solution can't take a custom gsu or
+   * the tiles already fill the device.
+   */
+        uint16_t autoGSU(Problem const& problem, Hardware const& hardware) const;
+
+        /**
+   * Workgroup mapping whose wave of concurrent workgroups reads A and B panels that fit
+   * in the L2 of hardware, 0 if the solution can't take a custom wgm, its own mapping
+   * already fits, or the L2 size is unknown.
+   */
+        int16_t autoWGM(Problem const& problem, Hardware const& hardware) const;
         size_t partialTileSize(size_t skGrid) const;
 
         static float computeGranularity(float x);
@@ -311,6 +363,12 @@ namespace TensileLite
         ProjectedPerformance projectedPerformance(Problem const&  problem,
                                                   Hardware const& hardware) const;
 
+        /**
+   * Relative execution time from a roofline and granularity model. Only
+   * meaningful to compare solutions for the same problem; lower is faster.
+   */
+        double predictedTime(Problem const& problem, Hardware const& hardware) const;
+
         /**
    * Generate a set of kernel calls to solve a particular problem.
    */
@@ -324,6 +382,22 @@ namespace TensileLite
         virtual std::vector<KernelInvocation>
             solve(Problem const& problem, Inputs const& inputs, Hardware const& hardware) const;
 
+        /**
+   * Rewrite the pointers and alpha/beta of kernels previously returned by
+   * solve() for the same problem, instead of generating them again.
+   * The activation arguments must not have changed.
+   * Returns false if the kernels can't be patched and solve() must be called.
+   */
+        bool patchKernelArguments(std::vector<KernelInvocation>& kernels,
+                                  Problem const&                 problem,
+                                  Inputs const&                  inputs) const;
+
+        /**
+   * Throws if the inputs are not valid for the problem (nullptr A/B,
+   * alpha/beta not matching the problem restriction, c != d with CEqualsD).
+   */
+        void checkInputs(Problem const& problem, Inputs const& inputs) const;
+
         virtual std::vector<KernelInvocation> solveGroupedGemm(std::vector<Problem> const& problems,
                                                                GroupedInputs const&        inputs,
                                                                Hardware const&             hardware,
@@ -361,7 +435,8 @@ namespace TensileLite
                                        size_t                      hipHostMemorySize,
                                        hipStream_t                 stream) const;
 
-        virtual void relaseDeviceUserArgs(void* dUA, void* dUAHost);
+        // Releases the buffers of solveTensileGPU(), stream ordered with its upload
+        virtual void relaseDeviceUserArgs(void* dUA, void* dUAHost, hipStream_t stream = 0);
 
         template <bool T_Debug, bool insertKernelArgs, typename KA>
         void singleCallArgs(Problem const&           problem,
@@ -408,6 +483,12 @@ namespace TensileLite
 
         std::string betaOnlyKernelName(Problem const& problem) const;
 
+        /**
+   * Whether solve() launches the beta-only kernel before a split-k kernel that accumulates
+   * into D or the workspace. It is skipped when it would store D = 1 * C over C itself.
+   */
+        bool needsBetaOnlyCall(Problem const& problem, ContractionInputs const& inputs) const;
+
         template <bool T_Debug, typename KA>
         void outputConversionCallArgs(Problem const&           problem,
                                       ContractionInputs const& inputs,
@@ -467,11 +548,14 @@ namespace TensileLite
             bool wgm              = true;
             bool staggerU         = true;
             bool useUniversalArgs = true;
+            // Kernarg dwords the kernel preloads into SGPRs, 0 for none. Such kernels take the
+            // hot arguments first and the debug buffer after the A/B pointers.
+            int kernargPreload = 0;
         };
 
         struct ProblemType
         {
-            std::string           operationIdentifier;
+            InternedString        operationIdentifier;
             bool                  transA                    = false;
             bool                  transB                    = false;
             DataType              aType                     = DataType::Float;
@@ -513,17 +597,18 @@ namespace TensileLite
             double max       = 1000.0;
         };
 
-        int                          index = 0;
-        std::string                  kernelName;
-        std::string                  solutionName;
-        ThreadSafeValue<std::string> codeObjectFilename;
-        bool                         debugKernel   = false;
-        bool                         kernelArgsLog = false;
+        int                             index = 0;
+        std::string                     kernelName;
+        std::string                     solutionName;
+        // Shared by the solutions of a code object
+        ThreadSafeValue<InternedString> codeObjectFilename;
+        bool                            debugKernel   = false;
+        bool                            kernelArgsLog = false;
 
         std::shared_ptr<Predicates::Predicate<Problem>> problemPredicate
-            = std::make_shared<Predicates::True<Problem>>();
+            = Predicates::True<Problem>::Shared();
         std::shared_ptr<Predicates::Predicate<Hardware>> hardwarePredicate
-            = std::make_shared<Predicates::True<Hardware>>();
+            = Predicates::True<Hardware>::Shared();
 
         SizeMapping sizeMapping;
 
@@ -531,8 +616,8 @@ namespace TensileLite
 
         ProblemType problemType;
 
-        // This will be calculated when getSolution is called
-        size_t requiredHostWorkspaceSizePerProblem = static_cast<size_t>(-1);
+        // Set by the first getSolution that returns this solution, it may be shared between threads
+        OnceValue<size_t> requiredHostWorkspaceSizePerProblem;
 
         /// Debugging purposes.  Shouldn't contain any vital information that isn't
         /// somewhere else.
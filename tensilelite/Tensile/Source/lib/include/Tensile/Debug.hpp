@@ -37,6 +37,18 @@
 namespace TensileLite
 {
     /**
+     * False in builds with Tensile_DISABLE_INSTRUMENTATION, in which the markers, the
+     * phase profile and the diagnostic queries of the launch paths compile to nothing.
+     * Launch paths test it before Debug::Instance() so that the singleton is not
+     * touched either.
+     */
+#ifdef Tensile_DISABLE_INSTRUMENTATION
+    constexpr bool DebugInstrumentation = false;
+#else
+    constexpr bool DebugInstrumentation = true;
+#endif
+
+    /**
  * @brief Common place for defining flags which enable debug behaviour.
  */
     class Debug : public LazySingleton<Debug>
@@ -91,6 +103,60 @@ namespace TensileLite
 
         bool gridBasedBatchExp() const;
 
+        // 0: CacheMap lookups take a shared lock, 1: lookups read a published snapshot
+        int cacheMapMode() const;
+
+        // Maximum number of entries of each CacheMap, 0 for unbounded
+        size_t cacheMapCapacity() const;
+
+        // 0: grouped gemm tiles are dispatched in problem order, 1: largest problems first
+        int groupedGemmSchedule() const;
+
+        // Reuse grouped gemm solutions across group sizes with the same GroupedGemmShapeKey
+        bool groupedGemmShapeCache() const;
+
+        // Share identical problem predicate terms between solutions and evaluate them once
+        // per selection call
+        bool predicateMemo() const;
+
+        // Order getAllSolutions results by the analytic time model of ContractionSolution
+        bool analyticRanking() const;
+
+        // Walk the selection levels of a loaded library through FlatSelectionLibrary
+        bool flatSelection() const;
+
+        // Print the host memory of the solutions of each loaded library file by category
+        bool printMemoryReport() const;
+
+        // Name of the POSIX shared memory object that shares solution indices between the
+        // processes of a node, empty to disable
+        std::string sharedCacheName() const;
+
+        // Number of entries of a newly created shared memory solution cache
+        size_t sharedCacheCapacity() const;
+
+        // Threads that load the lazily-loaded libraries of the device architectures in the
+        // background, 0 to load each one on first use
+        size_t lazyPrefetchThreads() const;
+
+        // MiB of code objects loaded on demand that an adapter keeps resident, the least
+        // recently launched are unloaded beyond it, 0 for no limit
+        size_t codeObjectBudget() const;
+
+        // Time the phases between markerStart and markerStop, and the files they load
+        bool phaseProfile() const;
+
+        /**
+         * Prints the time and bytes of the marked phases and files to stderr, at
+         * most once per process. Called at the first matmul, and at exit when
+         * no matmul was run.
+         */
+        __attribute__((always_inline)) inline void printPhaseProfile(const char* when) const
+        {
+            if(DebugInstrumentation && m_phaseProfile)
+                printPhases(when);
+        }
+
         __attribute__((always_inline)) inline void markerStart(const char* name) const
         {
 #ifdef Tensile_ENABLE_MARKER
@@ -99,6 +165,8 @@ namespace TensileLite
                 roctxRangePush(name);
             }
 #endif
+            if(DebugInstrumentation && m_phaseProfile)
+                phaseStart(name, nullptr);
         }
 
         __attribute__((always_inline)) inline void markerStart(const char*        name,
@@ -111,6 +179,8 @@ namespace TensileLite
                 roctxRangePush(s.c_str());
             }
 #endif
+            if(DebugInstrumentation && m_phaseProfile)
+                phaseStart(name, &objPath);
         }
 
         __attribute__((always_inline)) inline void markerStop() const
@@ -121,6 +191,8 @@ namespace TensileLite
                 roctxRangePop();
             }
 #endif
+            if(DebugInstrumentation && m_phaseProfile)
+                phaseStop();
         }
 
     private:
@@ -128,17 +200,34 @@ namespace TensileLite
 
         int         m_value;
         int         m_value2;
-        bool        m_naivePropertySearch = false;
-        bool        m_debugSelection      = false;
-        int         m_experimentSelection = 0;
-        int         m_solution_index      = -1;
-        bool        m_solselTrace         = false;
-        std::string m_metric              = "";
-        int         m_gridbasedTopSols    = 1;
-        bool        m_benchmark           = false;
-        bool        m_gridbasedKdTree     = false;
-        bool        m_gridbasedBatchExp   = false;
-        bool        m_printMarker         = false;
+        bool        m_naivePropertySearch   = false;
+        bool        m_debugSelection        = false;
+        int         m_experimentSelection   = 0;
+        int         m_solution_index        = -1;
+        bool        m_solselTrace           = false;
+        std::string m_metric                = "";
+        int         m_gridbasedTopSols      = 1;
+        bool        m_benchmark             = false;
+        bool        m_gridbasedKdTree       = true;
+        bool        m_gridbasedBatchExp     = false;
+        bool        m_printMarker           = false;
+        int         m_cacheMapMode          = 0;
+        size_t      m_cacheMapCapacity      = 0;
+        int         m_groupedGemmSchedule   = 1;
+        bool        m_groupedGemmShapeCache = false;
+        bool        m_predicateMemo         = true;
+        bool        m_analyticRanking       = true;
+        bool        m_flatSelection         = true;
+        bool        m_printMemoryReport     = false;
+        std::string m_sharedCacheName       = "";
+        size_t      m_sharedCacheCapacity   = 65536;
+        size_t      m_lazyPrefetchThreads   = 0;
+        size_t      m_codeObjectBudget      = 0;
+        bool        m_phaseProfile          = false;
+
+        void phaseStart(const char* name, const std::string* path) const;
+        void phaseStop() const;
+        void printPhases(const char* when) const;
 
         Debug();
     };
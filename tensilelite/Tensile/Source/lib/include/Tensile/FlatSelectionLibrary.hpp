@@ -0,0 +1,475 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <Tensile/Debug.hpp>
+#include <Tensile/ExactLogicLibrary.hpp>
+#include <Tensile/MapLibrary.hpp>
+#include <Tensile/SolutionLibrary.hpp>
+
+namespace TensileLite
+{
+    /**
+ * \ingroup SolutionLibrary
+ *
+ * Flattened form of the selection levels at the top of a library tree. The
+ * HardwareSelectionLibrary, ProblemSelectionLibrary and ProblemMapLibrary
+ * nodes are compiled once, after loading, into contiguous arrays of nodes and
+ * rows that refer to their children by index, and walked without a virtual
+ * call per level. Any other library, such as a ProblemMatchingLibrary or a
+ * PlaceholderLibrary, is a leaf that is called through SolutionLibrary.
+ *
+ * The tree is kept: it owns the predicates, properties and leaves, and it
+ * answers the searches that visit every row as well as the lookups that print
+ * debug output.
+ */
+    template <typename MyProblem, typename MySolution = typename MyProblem::Solution>
+    class FlatSelectionLibrary : public SolutionLibrary<MyProblem, MySolution>
+    {
+    public:
+        using Library = SolutionLibrary<MyProblem, MySolution>;
+
+        FlatSelectionLibrary(std::shared_ptr<Library> tree)
+            : m_tree(tree)
+        {
+            auto const& debug = Debug::Instance();
+            m_debug = debug.printPropertyEvaluation() || debug.printPredicateEvaluation()
+                      || debug.printDeviceSelection();
+            m_root  = compile(tree.get());
+        }
+
+        static std::string Type()
+        {
+            return "FlatSelection";
+        }
+        virtual std::string type() const override
+        {
+            return Type();
+        }
+        virtual std::string description() const override
+        {
+            return concatenate(type(),
+                               " (",
+                               m_nodes.size(),
+                               " nodes, ",
+                               m_rows.size(),
+                               " rows, ",
+                               m_leaves.size(),
+                               " leaves, tree: ",
+                               m_tree->type(),
+                               ")");
+        }
+
+        std::shared_ptr<Library> library() const
+        {
+            return m_tree;
+        }
+
+        virtual std::shared_ptr<MySolution> getSolutionByIndex(MyProblem const& problem,
+                                                               Hardware const&  hardware,
+                                                               const int index) const override
+        {
+            if(m_debug)
+                return m_tree->getSolutionByIndex(problem, hardware, index);
+
+            return solutionByIndex(m_root, problem, hardware, index);
+        }
+
+        virtual std::shared_ptr<MySolution> findBestSolution(MyProblem const& problem,
+                                                             Hardware const&  hardware,
+                                                             double*          fitness
+                                                             = nullptr) const override
+        {
+            if(m_debug)
+                return m_tree->findBestSolution(problem, hardware, fitness);
+
+            return bestSolution(m_root, problem, hardware, fitness);
+        }
+
+        virtual SolutionSet<MySolution>
+            findAllSolutions(MyProblem const&          problem,
+                             Hardware const&           hardware,
+                             SolutionLibrarySearchType searchType
+                             = SolutionLibrarySearchType::DEFAULT) const override
+        {
+            return m_tree->findAllSolutions(problem, hardware, searchType);
+        }
+
+        virtual SolutionSet<MySolution>
+            findAllSolutionsGroupedGemm(std::vector<MyProblem> const& problems,
+                                        Hardware const&               hardware,
+                                        SolutionLibrarySearchType     searchType
+                                        = SolutionLibrarySearchType::DEFAULT) const override
+        {
+            return m_tree->findAllSolutionsGroupedGemm(problems, hardware, searchType);
+        }
+
+        virtual SolutionVector<MySolution> findTopSolutions(MyProblem const& problem,
+                                                            Hardware const&  hardware,
+                                                            int numSolutions) const override
+        {
+            if(m_debug)
+                return m_tree->findTopSolutions(problem, hardware, numSolutions);
+
+            SolutionVector<MySolution> rv;
+            topSolutions(m_root, problem, hardware, numSolutions, rv);
+            return rv;
+        }
+
+        virtual SolutionVector<MySolution>
+            findTopSolutionsGroupedGemm(std::vector<MyProblem> const& problems,
+                                        Hardware const&               hardware,
+                                        int                           numSolutions) const override
+        {
+            return m_tree->findTopSolutionsGroupedGemm(problems, hardware, numSolutions);
+        }
+
+        virtual std::vector<SolutionVector<MySolution>>
+            findTopSolutionsBatch(std::vector<MyProblem const*> const& problems,
+                                  Hardware const&                      hardware,
+                                  int numSolutions) const override
+        {
+            if(m_debug)
+                return m_tree->findTopSolutionsBatch(problems, hardware, numSolutions);
+
+            std::vector<SolutionVector<MySolution>> rv(problems.size());
+            std::vector<uint32_t>                   group(problems.size());
+            for(uint32_t i = 0; i < group.size(); i++)
+                group[i] = i;
+            topSolutionsBatch(m_root, problems, group, hardware, numSolutions, rv);
+            return rv;
+        }
+
+    private:
+        using HardwareLibrary = HardwareSelectionLibrary<MyProblem, MySolution>;
+        using ProblemLibrary  = ProblemSelectionLibrary<MyProblem, MySolution>;
+        using MapLibrary      = ProblemMapLibrary<MyProblem, MySolution>;
+
+        static constexpr uint32_t None = ~uint32_t(0);
+
+        enum class NodeKind : uint8_t
+        {
+            Rows,
+            Map,
+            Leaf
+        };
+
+        struct Node
+        {
+            NodeKind kind;
+            // Rows: first row in m_rows, Map: index in m_maps, Leaf: index in m_leaves
+            uint32_t first;
+            uint32_t count;
+        };
+
+        // Rows of a HardwareSelectionLibrary have a hardware predicate, the others a problem one
+        struct Row
+        {
+            Predicates::Predicate<Hardware> const*  hardware = nullptr;
+            Predicates::Predicate<MyProblem> const* problem  = nullptr;
+            uint32_t                                child    = None;
+            // The solutions found below an EqualityMatching row are tagged Equal
+            bool equality = false;
+        };
+
+        struct MapNode
+        {
+            Property<MyProblem, std::string> const*   property;
+            std::unordered_map<std::string, uint32_t> children;
+        };
+
+        uint32_t addNode(NodeKind kind, size_t first, size_t count)
+        {
+            m_nodes.push_back(
+                Node{kind, static_cast<uint32_t>(first), static_cast<uint32_t>(count)});
+            return m_nodes.size() - 1;
+        }
+
+        // The children come first, so that the rows of each node are contiguous
+        uint32_t compile(Library const* library)
+        {
+            if(auto lib = dynamic_cast<HardwareLibrary const*>(library))
+                return addRows(lib->rows);
+
+            if(auto lib = dynamic_cast<ProblemLibrary const*>(library))
+                return addRows(lib->rows);
+
+            if(auto lib = dynamic_cast<MapLibrary const*>(library))
+            {
+                MapNode map{lib->property.get(), {}};
+                map.children.reserve(lib->map.size());
+                for(auto const& pair : lib->map)
+                    if(pair.second)
+                        map.children.emplace(pair.first, compile(pair.second.get()));
+
+                m_maps.push_back(std::move(map));
+                return addNode(NodeKind::Map, m_maps.size() - 1, 0);
+            }
+
+            m_leaves.push_back(library);
+            return addNode(NodeKind::Leaf, m_leaves.size() - 1, 0);
+        }
+
+        template <typename Rows>
+        uint32_t addRows(Rows const& rows)
+        {
+            std::vector<Row> compiled;
+            compiled.reserve(rows.size());
+            for(auto const& row : rows)
+            {
+                Row rv;
+                setPredicate(rv, row.first);
+                rv.child = compile(row.second.get());
+                compiled.push_back(rv);
+            }
+
+            size_t first = m_rows.size();
+            m_rows.insert(m_rows.end(), compiled.begin(), compiled.end());
+            return addNode(NodeKind::Rows, first, compiled.size());
+        }
+
+        static void setPredicate(Row& row, HardwarePredicate const& predicate)
+        {
+            row.hardware = predicate.value.get();
+        }
+
+        static void setPredicate(Row& row, ProblemPredicate<MyProblem> const& predicate)
+        {
+            row.problem  = predicate.value.get();
+            row.equality = dynamic_cast<Predicates::Contraction::EqualityMatching const*>(
+                               row.problem)
+                           != nullptr;
+        }
+
+        static bool matches(Row const& row, MyProblem const& problem, Hardware const& hardware)
+        {
+            return row.hardware ? (*row.hardware)(hardware) : (*row.problem)(problem);
+        }
+
+        uint32_t mapChild(Node const& node, MyProblem const& problem) const
+        {
+            auto const& map  = m_maps[node.first];
+            auto        iter = map.children.find((*map.property)(problem));
+            return iter == map.children.end() ? None : iter->second;
+        }
+
+        std::shared_ptr<MySolution> bestSolution(uint32_t         index,
+                                                 MyProblem const& problem,
+                                                 Hardware const&  hardware,
+                                                 double*          fitness) const
+        {
+            Node const& node = m_nodes[index];
+            if(node.kind == NodeKind::Leaf)
+                return m_leaves[node.first]->findBestSolution(problem, hardware, fitness);
+
+            if(node.kind == NodeKind::Map)
+            {
+                auto child = mapChild(node, problem);
+                if(child == None)
+                    return nullptr;
+                return bestSolution(child, problem, hardware, fitness);
+            }
+
+            for(uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                Row const& row = m_rows[i];
+                if(!matches(row, problem, hardware))
+                    continue;
+
+                auto rv = bestSolution(row.child, problem, hardware, fitness);
+                if(rv)
+                {
+                    if(row.equality)
+                        rv->tag = MySolution::MatchingTag::Equal;
+                    return rv;
+                }
+            }
+
+            return nullptr;
+        }
+
+        std::shared_ptr<MySolution> solutionByIndex(uint32_t         index,
+                                                    MyProblem const& problem,
+                                                    Hardware const&  hardware,
+                                                    int              solutionIndex) const
+        {
+            Node const& node = m_nodes[index];
+            if(node.kind == NodeKind::Leaf)
+                return m_leaves[node.first]->getSolutionByIndex(problem, hardware, solutionIndex);
+
+            if(node.kind == NodeKind::Map)
+            {
+                auto child = mapChild(node, problem);
+                if(child == None)
+                    return nullptr;
+                return solutionByIndex(child, problem, hardware, solutionIndex);
+            }
+
+            for(uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                Row const& row = m_rows[i];
+                if(!matches(row, problem, hardware))
+                    continue;
+
+                auto rv = solutionByIndex(row.child, problem, hardware, solutionIndex);
+                if(rv)
+                    return rv;
+            }
+
+            return nullptr;
+        }
+
+        // Appends up to numSolutions - rv.size() solutions, the same as ExactLogicLibrary
+        void topSolutions(uint32_t                    index,
+                          MyProblem const&            problem,
+                          Hardware const&             hardware,
+                          int                         numSolutions,
+                          SolutionVector<MySolution>& rv) const
+        {
+            Node const& node = m_nodes[index];
+            if(node.kind == NodeKind::Leaf)
+            {
+                auto solutions = m_leaves[node.first]->findTopSolutions(
+                    problem, hardware, numSolutions - rv.size());
+                rv.insert(std::end(rv), std::begin(solutions), std::end(solutions));
+                return;
+            }
+
+            if(node.kind == NodeKind::Map)
+            {
+                auto child = mapChild(node, problem);
+                if(child != None)
+                    topSolutions(child, problem, hardware, numSolutions, rv);
+                return;
+            }
+
+            for(uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                Row const& row = m_rows[i];
+                if(!matches(row, problem, hardware))
+                    continue;
+
+                size_t found = rv.size();
+                topSolutions(row.child, problem, hardware, numSolutions, rv);
+                if(row.equality)
+                    for(size_t s = found; s < rv.size(); s++)
+                        rv[s]->tag = MySolution::MatchingTag::Equal;
+
+                if(rv.size() == numSolutions)
+                    return;
+            }
+        }
+
+        // topSolutions() of each problems[i] of group into rv[i]. A map node splits the group
+        // by key and a hardware row is evaluated once, so the problems of one type share the
+        // walk down to their leaves.
+        void topSolutionsBatch(uint32_t                                 index,
+                               std::vector<MyProblem const*> const&     problems,
+                               std::vector<uint32_t> const&             group,
+                               Hardware const&                          hardware,
+                               int                                      numSolutions,
+                               std::vector<SolutionVector<MySolution>>& rv) const
+        {
+            Node const& node = m_nodes[index];
+            if(node.kind == NodeKind::Leaf)
+            {
+                for(auto i : group)
+                {
+                    Predicates::MemoScope<MyProblem> memo(*problems[i]);
+
+                    auto solutions = m_leaves[node.first]->findTopSolutions(
+                        *problems[i], hardware, numSolutions - rv[i].size());
+                    rv[i].insert(std::end(rv[i]), std::begin(solutions), std::end(solutions));
+                }
+                return;
+            }
+
+            if(node.kind == NodeKind::Map)
+            {
+                std::map<uint32_t, std::vector<uint32_t>> children;
+                for(auto i : group)
+                {
+                    auto child = mapChild(node, *problems[i]);
+                    if(child != None)
+                        children[child].push_back(i);
+                }
+                for(auto const& child : children)
+                    topSolutionsBatch(child.first, problems, child.second, hardware, numSolutions, rv);
+                return;
+            }
+
+            std::vector<uint32_t> pending = group, matched, found;
+            for(uint32_t r = node.first; r < node.first + node.count && !pending.empty(); r++)
+            {
+                Row const& row = m_rows[r];
+                if(row.hardware)
+                {
+                    if(!(*row.hardware)(hardware))
+                        continue;
+                    matched = pending;
+                }
+                else
+                {
+                    matched.clear();
+                    for(auto i : pending)
+                        if((*row.problem)(*problems[i]))
+                            matched.push_back(i);
+                    if(matched.empty())
+                        continue;
+                }
+
+                found.clear();
+                for(auto i : matched)
+                    found.push_back(rv[i].size());
+                topSolutionsBatch(row.child, problems, matched, hardware, numSolutions, rv);
+                if(row.equality)
+                    for(size_t m = 0; m < matched.size(); m++)
+                        for(size_t s = found[m]; s < rv[matched[m]].size(); s++)
+                            rv[matched[m]][s]->tag = MySolution::MatchingTag::Equal;
+
+                pending.erase(std::remove_if(pending.begin(),
+                                             pending.end(),
+                                             [&](uint32_t i) { return rv[i].size() == numSolutions; }),
+                              pending.end());
+            }
+        }
+
+        std::shared_ptr<Library>    m_tree;
+        std::vector<Node>           m_nodes;
+        std::vector<Row>            m_rows;
+        std::vector<MapNode>        m_maps;
+        std::vector<Library const*> m_leaves;
+        uint32_t                    m_root  = None;
+        bool                        m_debug = false;
+    };
+} // namespace TensileLite
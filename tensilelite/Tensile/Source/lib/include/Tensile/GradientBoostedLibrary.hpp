@@ -0,0 +1,316 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include <Tensile/Debug.hpp>
+#include <Tensile/DecisionTree.hpp>
+#include <Tensile/MLFeatures.hpp>
+#include <Tensile/ProblemKey.hpp>
+#include <Tensile/SolutionLibrary.hpp>
+#include <Tensile/Utils.hpp>
+
+namespace TensileLite
+{
+    /**
+     * \ingroup Tensile
+     * \defgroup GradientBoosting Gradient Boosting
+     *
+     * @brief Gradient boosted regression over a list of Feature values
+     */
+
+    /**
+     * \ingroup GradientBoosting
+     */
+    namespace GradientBoosting
+    {
+        /**
+         * @brief Regression tree of a boosted ensemble
+         *
+         * Uses the nodes of DecisionTree. A negative child index `idx` addresses
+         * the leaf `leaves[-idx - 1]` instead of a node.
+         */
+        struct RegressionTree
+        {
+            std::vector<DecisionTree::Node> tree;
+            std::vector<float>              leaves;
+
+            float predict(std::vector<float> const& key) const
+            {
+                int nodeIdx  = 0;
+                int treeSize = tree.size();
+
+                while(nodeIdx >= 0 && nodeIdx < treeSize)
+                {
+                    auto const& node = tree[nodeIdx];
+                    nodeIdx = key[node.featureIdx] <= node.threshold ? node.nextIdxLTE
+                                                                     : node.nextIdxGT;
+                }
+
+                if(nodeIdx >= 0 || -nodeIdx - 1 >= (int)leaves.size())
+                    throw std::runtime_error("Regression Tree out of bounds error.");
+
+                return leaves[-nodeIdx - 1];
+            }
+
+            bool valid(size_t keySize) const
+            {
+                if(tree.empty())
+                    return leaves.size() == 1;
+
+                for(int nodeIdx = 0; nodeIdx < (int)tree.size(); nodeIdx++)
+                {
+                    auto const& node = tree[nodeIdx];
+                    if(node.featureIdx < 0 || node.featureIdx >= (int)keySize)
+                        return false;
+
+                    for(int nextIdx : {node.nextIdxLTE, node.nextIdxGT})
+                    {
+                        // Children come after their parent, so the tree can't loop
+                        if(nextIdx >= 0 && (nextIdx <= nodeIdx || nextIdx >= (int)tree.size()))
+                            return false;
+                        if(nextIdx < 0 && -nextIdx - 1 >= (int)leaves.size())
+                            return false;
+                    }
+                }
+
+                return true;
+            }
+        };
+
+        /**
+         * @brief Candidate ranked by a boosted ensemble
+         *
+         * `features` holds the values that describe the candidate itself, e.g. its
+         * macro tile, and follows the problem features in the key of the model.
+         */
+        template <typename Value>
+        struct Candidate
+        {
+            std::vector<float> features;
+            Value              value;
+        };
+    } // namespace GradientBoosting
+
+    /**
+     * \ingroup SolutionLibrary
+     *
+     * Predicts the runtime of every candidate with a gradient boosted regression
+     * model and tries the candidates from the fastest prediction on. The problem
+     * features are evaluated once per problem and shared by all candidates, so a
+     * query costs one model evaluation per candidate.
+     */
+    template <typename MyProblem, typename MySolution = typename MyProblem::Solution>
+    struct GradientBoostedLibrary : public SolutionLibrary<MyProblem, MySolution>
+    {
+        using Element          = std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>;
+        using Features         = std::vector<std::shared_ptr<MLFeatures::MLFeature<MyProblem>>>;
+        using Candidate        = GradientBoosting::Candidate<Element>;
+        using MySolutionVector = SolutionVector<MySolution>;
+
+        Features                                      features;
+        float                                         bias = 0.0f;
+        std::vector<GradientBoosting::RegressionTree> trees;
+        std::vector<Candidate>                        candidates;
+
+        static std::string Type()
+        {
+            return "GradientBoosted";
+        }
+        virtual std::string type() const override
+        {
+            return Type();
+        }
+        virtual std::string description() const override
+        {
+            return concatenate(type(),
+                               ": Features: ",
+                               features,
+                               ", ",
+                               trees.size(),
+                               " tree(s), ",
+                               candidates.size(),
+                               " candidate(s)");
+        }
+
+        /**
+         * Returns the indices of the candidates, ordered by predicted runtime.
+         */
+        std::vector<size_t> rankCandidates(MyProblem const& problem) const
+        {
+            bool debug = Debug::Instance().getSolutionSelectionTrace();
+
+            auto key = ProblemKey::keyForProblem<std::vector<float>, MyProblem, float>(problem,
+                                                                                     features);
+            std::vector<float> runtime(candidates.size(), bias);
+            for(size_t i = 0; i < candidates.size(); i++)
+            {
+                key.resize(features.size());
+                key.insert(key.end(),
+                           candidates[i].features.begin(),
+                           candidates[i].features.end());
+                for(auto const& tree : trees)
+                    runtime[i] += tree.predict(key);
+            }
+
+            std::vector<size_t> order(candidates.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return runtime[a] < runtime[b];
+            });
+
+            if(debug)
+            {
+                std::cout << "Predicted runtime by candidate: ";
+                for(auto i : order)
+                    std::cout << i << ": " << runtime[i] << " ";
+                std::cout << std::endl;
+            }
+
+            return order;
+        }
+
+        virtual std::shared_ptr<MySolution> getSolutionByIndex(MyProblem const& problem,
+                                                               Hardware const&  hardware,
+                                                               const int index) const override
+        {
+            for(auto const& candidate : candidates)
+            {
+                auto rv = candidate.value->getSolutionByIndex(problem, hardware, index);
+                if(rv)
+                    return rv;
+            }
+
+            return std::shared_ptr<MySolution>();
+        }
+
+        virtual std::shared_ptr<MySolution> findBestSolution(MyProblem const& problem,
+                                                             Hardware const&  hardware,
+                                                             double*          fitness
+                                                             = nullptr) const override
+        {
+            for(auto i : rankCandidates(problem))
+            {
+                auto rv = candidates[i].value->findBestSolution(problem, hardware);
+                if(rv)
+                    return rv;
+            }
+
+            return std::shared_ptr<MySolution>();
+        }
+
+        virtual std::shared_ptr<MySolution> findBestSolution(std::vector<MyProblem> const& problems,
+                                                             Hardware const&               hardware,
+                                                             double* fitness
+                                                             = nullptr) const override
+        {
+            for(auto i : rankCandidates(problems[0]))
+            {
+                auto rv = candidates[i].value->findBestSolution(problems, hardware);
+                if(rv)
+                    return rv;
+            }
+
+            return std::shared_ptr<MySolution>();
+        }
+
+        virtual SolutionSet<MySolution>
+            findAllSolutions(MyProblem const&          problem,
+                             Hardware const&           hardware,
+                             SolutionLibrarySearchType searchType
+                             = SolutionLibrarySearchType::DEFAULT) const override
+        {
+            SolutionSet<MySolution> rv;
+            for(auto const& candidate : candidates)
+            {
+                auto solutions = candidate.value->findAllSolutions(problem, hardware, searchType);
+                rv.insert(solutions.begin(), solutions.end());
+            }
+
+            return rv;
+        }
+
+        virtual SolutionSet<MySolution>
+            findAllSolutionsGroupedGemm(std::vector<MyProblem> const& problems,
+                                        Hardware const&               hardware,
+                                        SolutionLibrarySearchType     searchType
+                                        = SolutionLibrarySearchType::DEFAULT) const override
+        {
+            SolutionSet<MySolution> rv;
+            for(auto const& candidate : candidates)
+            {
+                auto solutions
+                    = candidate.value->findAllSolutionsGroupedGemm(problems, hardware, searchType);
+                rv.insert(solutions.begin(), solutions.end());
+            }
+
+            return rv;
+        }
+
+        virtual MySolutionVector findTopSolutions(MyProblem const& problem,
+                                                  Hardware const&  hardware,
+                                                  int              numSolutions) const override
+        {
+            MySolutionVector rv;
+            for(auto i : rankCandidates(problem))
+            {
+                if(rv.size() >= numSolutions)
+                    break;
+
+                auto solution = candidates[i].value->findBestSolution(problem, hardware);
+                if(solution && std::find(rv.begin(), rv.end(), solution) == rv.end())
+                    rv.push_back(solution);
+            }
+
+            return rv;
+        }
+
+        virtual MySolutionVector
+            findTopSolutionsGroupedGemm(std::vector<MyProblem> const& problems,
+                                        Hardware const&               hardware,
+                                        int                           numSolutions) const override
+        {
+            MySolutionVector rv;
+            for(auto i : rankCandidates(problems[0]))
+            {
+                if(rv.size() >= numSolutions)
+                    break;
+
+                auto solution = candidates[i].value->findBestSolution(problems, hardware);
+                if(solution && std::find(rv.begin(), rv.end(), solution) == rv.end())
+                    rv.push_back(solution);
+            }
+
+            return rv;
+        }
+    };
+
+} // namespace TensileLite
@@ -259,12 +259,10 @@ namespace TensileLite
 
                     if(useSolution)
                     {
-                        if((*row.second).requiredHostWorkspaceSizePerProblem
-                           == static_cast<size_t>(-1))
-                        {
-                            (*row.second).requiredHostWorkspaceSizePerProblem
-                                = (*row.second).requiredHostSizeGroupedGemmSingle(problems[0],hardware);
-                        }
+                        row.second->requiredHostWorkspaceSizePerProblem.init([&]() {
+                            return row.second->requiredHostSizeGroupedGemmSingle(problems[0],
+                                                                                 hardware);
+                        });
                         rv.insert(row.second);
                     }
                 }
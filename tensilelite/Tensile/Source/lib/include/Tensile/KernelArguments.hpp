@@ -131,6 +131,37 @@ namespace TensileLite
         std::vector<T> m_vec_data;
     };
 
+    /**
+     * Identifies a kernel argument whose value is taken from the ContractionInputs.
+     * Marked arguments can be overwritten in place when a previously generated
+     * KernelInvocation is launched again with new inputs.
+     */
+    enum class KernelArgumentSlot : uint8_t
+    {
+        A,
+        B,
+        C,
+        D,
+        E,
+        BatchA,
+        BatchB,
+        BatchC,
+        BatchD,
+        Bias,
+        BatchBias,
+        ScaleA,
+        ScaleB,
+        ScaleC,
+        ScaleD,
+        ScaleAlphaVec,
+        AmaxD,
+        Metadata,
+        Workspace,
+        Synchronizer,
+        Alpha,
+        Beta
+    };
+
     class TENSILE_API KernelArguments
     {
     public:
@@ -201,6 +232,19 @@ namespace TensileLite
 
         void useExternalPointer(void* pointer, size_t size);
 
+        using SlotRecord = std::pair<KernelArgumentSlot, size_t>;
+
+        //! Records that the next appended argument holds the value of slot.
+        void markSlot(KernelArgumentSlot slot);
+        //! Offsets of all arguments recorded with markSlot(), in append order.
+        std::vector<SlotRecord> const& slots() const;
+
+        //! Overwrites the value of an already appended argument. The logged value
+        //! string, if any, is not updated.
+        template <typename T>
+        void overwrite(size_t offset, T value);
+        void overwrite(size_t offset, ConstantVariant const& value, DataType type);
+
     private:
         enum
         {
@@ -232,6 +276,7 @@ namespace TensileLite
         std::vector<std::string>             m_names;
         std::unordered_map<std::string, Arg> m_argRecords;
         std::unordered_map<std::string, int> m_argNameCounter;
+        std::vector<SlotRecord>              m_slots;
 
         bool m_log;
     };
@@ -283,6 +328,45 @@ namespace TensileLite
         }
     }
 
+    inline void KernelArguments::markSlot(KernelArgumentSlot slot)
+    {
+        m_slots.emplace_back(slot, m_data.size());
+    }
+
+    inline std::vector<KernelArguments::SlotRecord> const& KernelArguments::slots() const
+    {
+        return m_slots;
+    }
+
+    template <typename T>
+    inline void KernelArguments::overwrite(size_t offset, T value)
+    {
+        writeValue(offset, value);
+    }
+
+    inline void KernelArguments::overwrite(size_t                 offset,
+                                           ConstantVariant const& value,
+                                           DataType               type)
+    {
+        switch(type)
+        {
+        case DataType::Float:
+            return writeValue<float>(offset, (*std::get_if<float>(&value)));
+        case DataType::Double:
+            return writeValue<double>(offset, (*std::get_if<double>(&value)));
+        case DataType::Half:
+            return writeValue<Half>(offset, (*std::get_if<Half>(&value)));
+        case DataType::Int32:
+            return writeValue<int32_t>(offset, (*std::get_if<int32_t>(&value)));
+        case DataType::BFloat16:
+            return writeValue<BFloat16>(offset, (*std::get_if<BFloat16>(&value)));
+        case DataType::Int8:
+            return writeValue<int8_t>(offset, (*std::get_if<int8_t>(&value)));
+        default:
+            throw std::runtime_error("Unsupported ConstantVariant overwrite type.");
+        }
+    }
+
     template <typename T>
     inline void KernelArguments::append(std::string const& name, T value)
     {
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Tensile/Singleton.hpp>
+
+namespace TensileLite
+{
+    /**
+     * Small thread pool that loads lazily-loaded child libraries in the background,
+     * enabled with TENSILE_LAZY_PREFETCH_THREADS=<n>. Tasks run in the order they
+     * were queued; a library that is needed before its task runs is loaded by the
+     * caller, and the task then finds it already loaded.
+     */
+    class LibraryPrefetcher : public LazySingleton<LibraryPrefetcher>
+    {
+    public:
+        ~LibraryPrefetcher();
+
+        LibraryPrefetcher(LibraryPrefetcher const&)            = delete;
+        LibraryPrefetcher& operator=(LibraryPrefetcher const&) = delete;
+
+        bool enabled() const
+        {
+            return m_threadCount > 0;
+        }
+
+        /**
+         * Queues task and returns a future that becomes ready once it ran, or
+         * once it was dropped because the pool shut down.
+         */
+        std::future<void> enqueue(std::function<void()> task);
+
+    private:
+        friend LazySingleton<LibraryPrefetcher>;
+
+        LibraryPrefetcher();
+
+        void start();
+
+        void run();
+
+        size_t                                 m_threadCount;
+        std::vector<std::thread>               m_threads;
+        std::deque<std::packaged_task<void()>> m_tasks;
+        std::mutex                             m_mutex;
+        std::condition_variable                m_cv;
+        bool                                   m_stop = false;
+    };
+} // namespace TensileLite
@@ -26,11 +26,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <Tensile/Debug.hpp>
+#include <Tensile/Predicates.hpp>
+#include <Tensile/SolutionIndex.hpp>
 #include <Tensile/SolutionLibrary.hpp>
 #include <Tensile/Tensile.hpp>
 
@@ -43,6 +48,35 @@ namespace TensileLite
     template <typename MySolution>
     using SolutionMap = std::map<int, std::shared_ptr<MySolution>>;
 
+    /**
+ * \ingroup SolutionLibrary
+ *
+ * The solutions of a SolutionMap addressed by their index, null for the
+ * indices without one. Never modified once published, a load that adds
+ * solutions publishes a new table instead.
+ */
+    template <typename MySolution>
+    using SolutionTable = std::vector<std::shared_ptr<MySolution>>;
+
+    /**
+     * Publishes the table of `solutions` to `table`, call with the guard of
+     * `solutions` held. Lookups by index read the table without the guard.
+     */
+    template <typename MySolution>
+    void PublishSolutionTable(SolutionMap<MySolution> const&                  solutions,
+                              std::shared_ptr<const SolutionTable<MySolution>>& table)
+    {
+        auto rv = std::make_shared<SolutionTable<MySolution>>();
+        if(!solutions.empty() && solutions.rbegin()->first >= 0)
+            rv->resize(solutions.rbegin()->first + 1);
+
+        for(auto const& pair : solutions)
+            if(pair.first >= 0)
+                (*rv)[pair.first] = pair.second;
+
+        std::atomic_store(&table, std::shared_ptr<const SolutionTable<MySolution>>(rv));
+    }
+
     template <typename MySolution>
     struct LibraryIOContext
     {
@@ -51,6 +85,12 @@ namespace TensileLite
         // If lazy loading is used, this may be updated in const functions
         SolutionMap<MySolution>* solutions;
         std::mutex*              solutionsGuard;
+        // Republished whenever solutions grows
+        std::shared_ptr<const SolutionTable<MySolution>>* solutionTable = nullptr;
+        // Loaded in the background by LibraryPrefetcher
+        std::vector<LazyLoadingInit> prefetched;
+        // Loaders of the lazily-loaded libraries by file prefix
+        std::map<std::string, std::function<void()>>* placeholders = nullptr;
     };
 
     /**
@@ -88,35 +128,89 @@ namespace TensileLite
         SolutionMap<MySolution>                                 solutions;
         std::string                                             version;
         mutable std::mutex                                      solutionsGuard;
+        // Dense copy of solutions for the lookups by index, see PublishSolutionTable
+        std::shared_ptr<const SolutionTable<MySolution>> solutionTable;
+        // Registered by the placeholders below, keyed by their file prefix
+        std::map<std::string, std::function<void()>> placeholderLoaders;
+        // Optional, lists the lazily-loaded library file of each solution
+        std::shared_ptr<SolutionIndexFile> solutionIndex;
 
         MasterSolutionLibrary() = default;
 
+        ~MasterSolutionLibrary()
+        {
+            // Placeholders below wait for their prefetch, which inserts into solutions
+            library.reset();
+        }
+
+        /**
+         * Returns the solution with this index, loading the lazily-loaded
+         * library file that solutionIndex lists for it when it is not loaded yet.
+         */
+        std::shared_ptr<MySolution> lookupSolution(int index) const
+        {
+            if(auto solution = tableSolution(index))
+                return solution;
+
+            {
+                // Libraries that were not deserialized have no table
+                std::lock_guard<std::mutex> guard(solutionsGuard);
+                auto                        iter = solutions.find(index);
+                if(iter != solutions.end())
+                    return iter->second;
+            }
+
+            if(!solutionIndex)
+                return nullptr;
+
+            auto prefix = solutionIndex->find(index);
+            if(!prefix)
+                return nullptr;
+
+            auto loader = placeholderLoaders.find(prefix);
+            if(loader == placeholderLoaders.end())
+                return nullptr;
+
+            // Takes solutionsGuard itself and publishes the new table
+            loader->second();
+
+            return tableSolution(index);
+        }
+
+        /**
+         * Returns the solution with this index from solutionTable, a single
+         * array access that lazily-loaded libraries do not block.
+         */
+        std::shared_ptr<MySolution> tableSolution(int index) const
+        {
+            auto table = std::atomic_load(&solutionTable);
+            if(!table || index < 0 || static_cast<size_t>(index) >= table->size())
+                return nullptr;
+            return (*table)[index];
+        }
+
         virtual std::shared_ptr<MySolution> getSolutionByIndex(MyProblem const& problem,
                                                                Hardware const&  hardware,
                                                                const int index) const override
         {
-            if(solutions.find(index) == solutions.end())
+            auto solution = lookupSolution(index);
+            if(!solution)
             {
                 return std::shared_ptr<MySolution>();
             }
-            auto solution = solutions.at(index);
-            if(solution->requiredHostWorkspaceSizePerProblem == static_cast<size_t>(-1))
-            {
-                solution->requiredHostWorkspaceSizePerProblem
-                    = solution->requiredHostSizeGroupedGemmSingle(problem,hardware);
-            }
+            solution->requiredHostWorkspaceSizePerProblem.init(
+                [&]() { return solution->requiredHostSizeGroupedGemmSingle(problem, hardware); });
             return solution;
         }
 
         virtual std::shared_ptr<MySolution> getSolutionByIndex(Hardware const&  hardware, const int index) const override
         {
-            if(solutions.find(index) == solutions.end())
+            auto solution = lookupSolution(index);
+            if(!solution)
             {
                 return std::shared_ptr<MySolution>();
             }
-            auto solution = solutions.at(index);
-            if(solution->requiredHostWorkspaceSizePerProblem == static_cast<size_t>(-1))
-            {
+            solution->requiredHostWorkspaceSizePerProblem.init([&]() {
                 auto problem
                     = MyProblem::createDefaultProblem(solution->problemType.transA,
                                                       solution->problemType.transB,
@@ -136,9 +230,8 @@ namespace TensileLite
                                                       solution->problemType.biasSrcWhiteList,
                                                       solution->problemType.groupedGemm,
                                                       std::numeric_limits<size_t>::max());
-                solution->requiredHostWorkspaceSizePerProblem
-                    = solution->requiredHostSizeGroupedGemmSingle(problem,hardware);
-            }
+                return solution->requiredHostSizeGroupedGemmSingle(problem, hardware);
+            });
             return solution;
         }
 
@@ -168,6 +261,8 @@ namespace TensileLite
                                                             Hardware const&  hardware,
                                                             double* fitness = nullptr) const
         {
+            Predicates::MemoScope<MyProblem> memo(problem);
+
             const int                   solution_index = Debug::Instance().getSolutionIndex();
             std::shared_ptr<MySolution> rv;
 
@@ -210,6 +305,7 @@ namespace TensileLite
                              SolutionLibrarySearchType searchType
                              = SolutionLibrarySearchType::DEFAULT) const override
         {
+            Predicates::MemoScope<MyProblem> memo(problem);
             return library->findAllSolutions(problem, hardware, searchType);
         }
 
@@ -226,6 +322,7 @@ namespace TensileLite
                                                             Hardware const&  hardware,
                                                             int numSolutions) const override
         {
+            Predicates::MemoScope<MyProblem> memo(problem);
             return library->findTopSolutions(problem, hardware, numSolutions);
         }
 
@@ -236,6 +333,14 @@ namespace TensileLite
         {
             return library->findTopSolutionsGroupedGemm(problems, hardware, numSolutions);
         }
+
+        virtual std::vector<SolutionVector<MySolution>>
+            findTopSolutionsBatch(std::vector<MyProblem const*> const& problems,
+                                  Hardware const&                      hardware,
+                                  int numSolutions) const override
+        {
+            return library->findTopSolutionsBatch(problems, hardware, numSolutions);
+        }
     };
 
 } // namespace TensileLite
@@ -27,11 +27,14 @@
 #pragma once
 
 #include <Tensile/Debug.hpp>
+#include <Tensile/LibraryPrefetcher.hpp>
 #include <Tensile/MasterSolutionLibrary.hpp>
 #include <Tensile/SolutionLibrary.hpp>
 #include <Tensile/Tensile.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 
 namespace TensileLite
 {
@@ -119,19 +122,52 @@ namespace TensileLite
         return "";
     }
 
+    /**
+     * Number of child libraries loaded on demand so far, by lookups or prefetch tasks.
+     */
+    inline std::atomic<uint64_t>& LazyLibraryLoads()
+    {
+        static std::atomic<uint64_t> loads{0};
+        return loads;
+    }
+
     template <typename MyProblem, typename MySolution = typename MyProblem::Solution>
     struct PlaceholderLibrary : public SolutionLibrary<MyProblem, MySolution>
     {
         mutable std::shared_ptr<SolutionLibrary<MyProblem, MySolution>> library;
         mutable SolutionMap<MySolution>*                                masterSolutions;
         mutable std::mutex*                                             solutionsGuard;
+        mutable std::shared_ptr<const SolutionTable<MySolution>>*       masterTable = nullptr;
         mutable std::mutex                                              lazyLoadingGuard;
-        std::string                                                     filePrefix;
-        std::string                                                     suffix;
-        std::string                                                     libraryDirectory;
+        // Set once library is assigned, lookups read library without the lock after it
+        mutable std::atomic<bool> loaded{false};
+        mutable std::future<void> prefetched;
+        std::string               filePrefix;
+        std::string               suffix;
+        std::string               libraryDirectory;
 
         PlaceholderLibrary() = default;
 
+        ~PlaceholderLibrary()
+        {
+            // A queued prefetch refers to this object
+            if(prefetched.valid())
+                prefetched.wait();
+        }
+
+        /**
+         * Queues the load of this library on LibraryPrefetcher. A lookup that
+         * needs the library before the task ran waits on lazyLoadingGuard, which
+         * only serializes it with the load of this library.
+         */
+        void prefetchPlaceholderLibrary()
+        {
+            prefetched = LibraryPrefetcher::Instance().enqueue([this]() {
+                if(!loaded.load(std::memory_order_acquire))
+                    loadPlaceholderLibrary();
+            });
+        }
+
         bool loadPlaceholderLibrary() const
         {
             std::lock_guard<std::mutex> lock(lazyLoadingGuard);
@@ -142,19 +178,27 @@ namespace TensileLite
                 auto        newLibrary = LoadLibraryFile<MyProblem, MySolution>(path);
                 auto        mLibrary
                     = static_cast<MasterSolutionLibrary<MyProblem, MySolution>*>(newLibrary.get());
-                library = mLibrary->library;
-
-                std::lock_guard<std::mutex> lock(*solutionsGuard);
-                using std::begin;
-                using std::end;
 
-                std::transform(begin(mLibrary->solutions),
-                               end(mLibrary->solutions),
-                               std::inserter(*masterSolutions, end(*masterSolutions)),
-                               [this](auto& i) {
-                                   i.second->codeObjectFilename = getCodeObjectFileName();
-                                   return i;
-                               });
+                {
+                    std::lock_guard<std::mutex> lock(*solutionsGuard);
+                    using std::begin;
+                    using std::end;
+
+                    std::transform(begin(mLibrary->solutions),
+                                   end(mLibrary->solutions),
+                                   std::inserter(*masterSolutions, end(*masterSolutions)),
+                                   [this](auto& i) {
+                                       i.second->codeObjectFilename = getCodeObjectFileName();
+                                       return i;
+                                   });
+                    if(masterTable)
+                        PublishSolutionTable(*masterSolutions, *masterTable);
+                }
+
+                // Published after the solutions so that indices it returns resolve
+                library = mLibrary->library;
+                loaded.store(true, std::memory_order_release);
+                LazyLibraryLoads().fetch_add(1, std::memory_order_relaxed);
 
                 if(Debug::Instance().printCodeObjectInfo())
                     std::cout << "load placeholder library " << path << std::endl
@@ -175,7 +219,7 @@ namespace TensileLite
                                                                Hardware const&  hardware,
                                                                const int index) const override
         {
-            if(!library)
+            if(!loaded.load(std::memory_order_acquire))
                 loadPlaceholderLibrary();
 
             auto solution = library->getSolutionByIndex(problem, hardware, index);
@@ -191,7 +235,7 @@ namespace TensileLite
                                                              double*          fitness
                                                              = nullptr) const override
         {
-            if(!library)
+            if(!loaded.load(std::memory_order_acquire))
                 loadPlaceholderLibrary();
 
             auto solution = library->findBestSolution(problem, hardware, fitness);
@@ -214,7 +258,7 @@ namespace TensileLite
                              SolutionLibrarySearchType searchType
                              = SolutionLibrarySearchType::DEFAULT) const override
         {
-            if(!library)
+            if(!loaded.load(std::memory_order_acquire))
             {
                 loadPlaceholderLibrary();
             }
@@ -235,7 +279,7 @@ namespace TensileLite
                                         SolutionLibrarySearchType     searchType
                                         = SolutionLibrarySearchType::DEFAULT) const override
         {
-            if(!library)
+            if(!loaded.load(std::memory_order_acquire))
             {
                 loadPlaceholderLibrary();
             }
@@ -254,7 +298,7 @@ namespace TensileLite
                                                             Hardware const&  hardware,
                                                             int numSolutions) const override
         {
-            if(!library)
+            if(!loaded.load(std::memory_order_acquire))
             {
                 loadPlaceholderLibrary();
             }
@@ -273,7 +317,7 @@ namespace TensileLite
                                         Hardware const&               hardware,
                                         int                           numSolutions) const override
         {
-            if(!library)
+            if(!loaded.load(std::memory_order_acquire))
             {
                 loadPlaceholderLibrary();
             }
@@ -27,6 +27,10 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -61,6 +65,95 @@ namespace TensileLite
         template <typename Class, typename Object>
         using Predicate_CRTP = Property_CRTP<Class, Object, bool>;
 
+        /**
+ * @brief Outcomes of the shared predicate terms for one object.
+ *
+ * While a MemoScope is open on a thread, And predicates whose terms were
+ * interned by MemoRegistry evaluate each term at most once for the object of
+ * the scope. The object must not change while the scope is open.
+ */
+        template <typename Object>
+        class MemoScope
+        {
+        public:
+            explicit MemoScope(Object const& object)
+                : m_object(&object)
+                , m_outer(current())
+            {
+                State& state = MemoScope::state();
+                if(m_outer && m_outer->m_object == m_object)
+                {
+                    m_epoch = m_outer->m_epoch;
+                }
+                else
+                {
+                    // The epoch is stored in the upper 31 bits of a slot
+                    if(++state.epoch == (1u << 31))
+                    {
+                        std::fill(state.slots.begin(), state.slots.end(), 0);
+                        state.epoch = 1;
+                    }
+                    m_epoch = state.epoch;
+                }
+                current() = this;
+            }
+
+            ~MemoScope()
+            {
+                current() = m_outer;
+            }
+
+            MemoScope(MemoScope const&) = delete;
+            MemoScope& operator=(MemoScope const&) = delete;
+
+            /**
+   * Returns the innermost scope of the thread if it is open for object.
+   */
+            static MemoScope const* find(Object const& object)
+            {
+                MemoScope const* scope = current();
+                return scope && scope->m_object == &object ? scope : nullptr;
+            }
+
+            template <typename Eval>
+            bool evaluate(int id, Eval&& eval) const
+            {
+                std::vector<uint32_t>& slots = state().slots;
+                if(id < slots.size() && (slots[id] >> 1) == m_epoch)
+                    return slots[id] & 1;
+
+                // eval() may open nested scopes, so the slot is looked up again
+                bool rv = eval();
+                if(id >= slots.size())
+                    slots.resize(id + 1, 0);
+                slots[id] = (m_epoch << 1) | uint32_t(rv);
+                return rv;
+            }
+
+        private:
+            struct State
+            {
+                std::vector<uint32_t> slots;
+                uint32_t              epoch = 0;
+            };
+
+            static State& state()
+            {
+                thread_local State s;
+                return s;
+            }
+
+            static MemoScope*& current()
+            {
+                thread_local MemoScope* scope = nullptr;
+                return scope;
+            }
+
+            Object const* m_object;
+            MemoScope*    m_outer;
+            uint32_t      m_epoch = 0;
+        };
+
         /**
  * \ingroup Properties
  * \defgroup Predicates Predicate Classes
@@ -87,6 +180,13 @@ namespace TensileLite
                 return "TruePred";
             }
 
+            // One instance serves all the holders of a TruePred
+            static std::shared_ptr<Predicate<Object>> Shared()
+            {
+                static std::shared_ptr<Predicate<Object>> rv = std::make_shared<True<Object>>();
+                return rv;
+            }
+
             virtual bool operator()(Object const&) const
             {
                 return true;
@@ -140,6 +240,10 @@ namespace TensileLite
             };
             std::vector<std::shared_ptr<Predicate<Object>>> value;
 
+            // Ids of value in MemoRegistry, -1 for terms that are not memoized. Empty if the
+            // predicate was not interned.
+            std::vector<int> memoIds;
+
             And() = default;
             And(std::initializer_list<std::shared_ptr<Predicate<Object>>> init)
                 : value(init)
@@ -157,8 +261,27 @@ namespace TensileLite
 
             virtual bool operator()(Object const& obj) const
             {
+                auto const* scope
+                    = memoIds.size() == value.size() ? MemoScope<Object>::find(obj) : nullptr;
+                if(scope)
+                {
+                    for(size_t i = 0; i < value.size(); i++)
+                    {
+                        auto const& pred = value[i];
+                        bool        rv   = memoIds[i] < 0 ? (*pred)(obj)
+                                                          : scope->evaluate(memoIds[i], [&]() {
+                                                                return (*pred)(obj);
+                                                            });
+                        if(!rv)
+                            return false;
+                    }
+                    return true;
+                }
+
                 return std::all_of(
-                    value.begin(), value.end(), [&obj](std::shared_ptr<Predicate<Object>> pred) {
+                    value.begin(),
+                    value.end(),
+                    [&obj](std::shared_ptr<Predicate<Object>> const& pred) {
                         return (*pred)(obj);
                     });
             }
@@ -206,7 +329,9 @@ namespace TensileLite
             virtual bool operator()(Object const& obj) const
             {
                 return std::any_of(
-                    value.begin(), value.end(), [&obj](std::shared_ptr<Predicate<Object>> pred) {
+                    value.begin(),
+                    value.end(),
+                    [&obj](std::shared_ptr<Predicate<Object>> const& pred) {
                         return (*pred)(obj);
                     });
             }
@@ -323,5 +448,145 @@ namespace TensileLite
         /**
  * @}
  */
+
+        /**
+ * @brief Shares identical terms of And predicates between all interned
+ * predicates and numbers them for MemoScope.
+ *
+ * Terms are identified by their toString(). Terms used by more predicates are
+ * evaluated first: they are memoized, so they are cheap after their first
+ * evaluation, and they tend to be the broad conditions such as types and
+ * transposes that reject most solutions.
+ */
+        template <typename Object>
+        class MemoRegistry
+        {
+        public:
+            // Returns false for leaf predicates whose toString() doesn't identify them
+            using Memoizable = std::function<bool(Predicate<Object> const&)>;
+
+            static MemoRegistry& Instance()
+            {
+                static MemoRegistry registry;
+                return registry;
+            }
+
+            void intern(std::shared_ptr<Predicate<Object>> const& predicate,
+                        Memoizable const&                         memoizable)
+            {
+                auto* conjunction = dynamic_cast<And<Object>*>(predicate.get());
+                if(!conjunction)
+                    return;
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                internAnd(*conjunction, memoizable);
+            }
+
+            /**
+   * Returns the instance of an identical predicate shared earlier, else
+   * interns predicate and keeps it for the predicates shared later. A
+   * predicate that toString() doesn't identify is interned and returned.
+   */
+            std::shared_ptr<Predicate<Object>>
+                share(std::shared_ptr<Predicate<Object>> const& predicate,
+                      Memoizable const&                         memoizable)
+            {
+                if(!exact(*predicate, memoizable))
+                {
+                    intern(predicate, memoizable);
+                    return predicate;
+                }
+
+                // Taken before interning reorders the terms
+                auto key = predicate->toString();
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto                        iter = m_shared.find(key);
+                if(iter != m_shared.end())
+                    return iter->second;
+
+                if(auto* conjunction = dynamic_cast<And<Object>*>(predicate.get()))
+                    internAnd(*conjunction, memoizable);
+                m_shared.emplace(std::move(key), predicate);
+                return predicate;
+            }
+
+            // Number of distinct predicates returned by share
+            size_t shared() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_shared.size();
+            }
+
+        private:
+            struct Term
+            {
+                std::shared_ptr<Predicate<Object>> predicate;
+                int                                id;
+                size_t                             uses;
+            };
+
+            void internAnd(And<Object>& conjunction, Memoizable const& memoizable)
+            {
+                std::vector<std::pair<size_t, size_t>> order; // (uses, position)
+                std::vector<int>                       ids(conjunction.value.size(), -1);
+
+                for(size_t i = 0; i < conjunction.value.size(); i++)
+                {
+                    auto& term = conjunction.value[i];
+                    if(auto* nested = dynamic_cast<And<Object>*>(term.get()))
+                        internAnd(*nested, memoizable);
+
+                    size_t uses = 0;
+                    if(exact(*term, memoizable))
+                    {
+                        auto iter = m_terms.find(term->toString());
+                        if(iter == m_terms.end())
+                            iter = m_terms
+                                       .emplace(term->toString(),
+                                                Term{term, int(m_terms.size()), 0})
+                                       .first;
+                        term = iter->second.predicate;
+                        ids[i] = iter->second.id;
+                        uses   = ++iter->second.uses;
+                    }
+                    order.emplace_back(uses, i);
+                }
+
+                std::stable_sort(order.begin(), order.end(), [](auto const& a, auto const& b) {
+                    return a.first > b.first;
+                });
+
+                std::vector<std::shared_ptr<Predicate<Object>>> value;
+                std::vector<int>                                memoIds;
+                for(auto const& entry : order)
+                {
+                    value.push_back(conjunction.value[entry.second]);
+                    memoIds.push_back(ids[entry.second]);
+                }
+                conjunction.value   = std::move(value);
+                conjunction.memoIds = std::move(memoIds);
+            }
+
+            // The toString() of compound terms includes their subterms
+            static bool exact(Predicate<Object> const& term, Memoizable const& memoizable)
+            {
+                if(auto const* p = dynamic_cast<And<Object> const*>(&term))
+                    return std::all_of(p->value.begin(), p->value.end(), [&](auto const& t) {
+                        return exact(*t, memoizable);
+                    });
+                if(auto const* p = dynamic_cast<Or<Object> const*>(&term))
+                    return std::all_of(p->value.begin(), p->value.end(), [&](auto const& t) {
+                        return exact(*t, memoizable);
+                    });
+                if(auto const* p = dynamic_cast<Not<Object> const*>(&term))
+                    return exact(*p->value, memoizable);
+                return memoizable(term);
+            }
+
+            mutable std::mutex                                         m_mutex;
+            std::map<std::string, Term>                                m_terms;
+            std::map<std::string, std::shared_ptr<Predicate<Object>>> m_shared;
+        };
     } // namespace Predicates
 } // namespace TensileLite
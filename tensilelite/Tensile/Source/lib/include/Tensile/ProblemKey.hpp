@@ -61,6 +61,53 @@ namespace TensileLite
             }
         };
 
+        /**
+         * Maps properties of a problem type to direct accessors, so that keys can be built
+         * without a virtual call per property. Problem types specialize this; Id() returns
+         * a negative id for properties without an accessor.
+         */
+        template <typename Problem, typename Value>
+        struct PropertyAccess
+        {
+            static int Id(Property<Problem, Value> const& property, size_t& index)
+            {
+                return -1;
+            }
+
+            static Value Get(int id, size_t index, Problem const& problem)
+            {
+                return Value();
+            }
+        };
+
+        /**
+         * Accessor ids of the properties of a table, resolved once when the table is
+         * loaded.
+         */
+        template <typename Problem, typename Value = size_t>
+        struct KeyPlan
+        {
+            struct Step
+            {
+                int    id;
+                size_t index;
+            };
+
+            void build(std::vector<std::shared_ptr<Property<Problem, Value>>> const& properties)
+            {
+                steps.clear();
+                steps.reserve(properties.size());
+                for(auto const& property : properties)
+                {
+                    Step step{-1, 0};
+                    step.id = PropertyAccess<Problem, Value>::Id(*property, step.index);
+                    steps.push_back(step);
+                }
+            }
+
+            std::vector<Step> steps;
+        };
+
         template <typename Key, typename Problem, typename Value = size_t>
         Key keyForProblem(Problem const&                                                problem,
                           std::vector<std::shared_ptr<Property<Problem, Value>>> const& properties)
@@ -81,5 +128,40 @@ namespace TensileLite
 
             return myKey;
         }
+
+        /**
+         * As above, evaluating the properties that have an accessor in plan directly. Falls
+         * back to the Property objects if plan was not built for properties.
+         */
+        template <typename Key, typename Problem, typename Value = size_t>
+        Key keyForProblem(Problem const&                                                problem,
+                          std::vector<std::shared_ptr<Property<Problem, Value>>> const& properties,
+                          KeyPlan<Problem, Value> const&                                plan)
+        {
+            if(plan.steps.size() != properties.size())
+                return keyForProblem<Key, Problem, Value>(problem, properties);
+
+            bool debug = Debug::Instance().printPropertyEvaluation();
+
+            Key myKey = ProblemKey::KeyFactory<Key>::MakeKey(properties.size());
+
+            for(int i = 0; i < properties.size(); i++)
+            {
+                auto const& step = plan.steps[i];
+                if(step.id < 0)
+                    myKey[i] = (*properties[i])(problem);
+                else
+                    myKey[i] = PropertyAccess<Problem, Value>::Get(step.id, step.index, problem);
+            }
+
+            if(debug)
+            {
+                std::cout << "Object key: ";
+                streamJoin(std::cout, myKey, ", ");
+                std::cout << std::endl;
+            }
+
+            return myKey;
+        }
     }
 }
@@ -26,10 +26,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <functional>
 #include <iomanip>
+#include <limits>
+#include <map>
+#include <memory>
 #include <queue>
 #include <string>
 #include <tuple>
@@ -39,6 +43,8 @@
 #include <Tensile/Distance.hpp>
 #include <Tensile/ProblemKey.hpp>
 #include <Tensile/Properties.hpp>
+#include <Tensile/SelectionTrace.hpp>
+#include <Tensile/Tensile_fwd.hpp>
 #include <Tensile/Utils.hpp>
 
 namespace TensileLite
@@ -212,9 +218,14 @@ namespace TensileLite
             }
 
             std::vector<SearchResult>
-                query(const PointND<T, N>& pt, std::size_t n, InsertCriteria criteria)
+                query(const PointND<T, N>& pt, std::size_t n, InsertCriteria criteria) const
             {
                 SortedSearchResults res;
+                if(!n)
+                {
+                    return {};
+                }
+
                 queryImpl(pt, root.get(), n, criteria, res);
                 std::vector<SearchResult> ret;
 
@@ -239,7 +250,7 @@ namespace TensileLite
                            Node*                root,
                            std::size_t          n,
                            InsertCriteria       criteria,
-                           SortedSearchResults& result)
+                           SortedSearchResults& result) const
             {
                 if(!root)
                 {
@@ -277,12 +288,13 @@ namespace TensileLite
                                             const PointND<T, N>& pt,
                                             const Node*          hyperplane) const
             {
-                const auto dim = hyperplane->axis;
-                const auto d   = std::abs(pt.coord[dim] - hyperplane->pt.coord[dim]);
+                // Squared in float like distance(), the square overflows int32
+                const auto  dim = hyperplane->axis;
+                const float d   = static_cast<float>(pt.coord[dim] - hyperplane->pt.coord[dim]);
                 return (d * d) < result.top().distance;
             }
 
-            float distance(const PointND<T, N>& p, const PointND<T, N>& q)
+            float distance(const PointND<T, N>& p, const PointND<T, N>& q) const
             {
                 float d{};
                 for(size_t i = 0; i < N; ++i)
@@ -292,7 +304,7 @@ namespace TensileLite
                 return d;
             }
 
-            void popResultUntil(std::size_t n, SortedSearchResults& result)
+            void popResultUntil(std::size_t n, SortedSearchResults& result) const
             {
                 while(result.size() > n)
                 {
@@ -348,8 +360,11 @@ namespace TensileLite
             virtual std::tuple<ReturnValue, double>
                 findBestMatch(Object const& object, Transform transform) const override
             {
-                return findBestKeyMatch(
-                    ProblemKey::keyForProblem<Key, Object>(object, this->properties), transform);
+                auto key
+                    = ProblemKey::keyForProblem<Key, Object>(object, this->properties, keyPlan);
+                if(SelectionTrace::active())
+                    return findBestKeyMatch(key, scoredTransform(key, transform));
+                return findBestKeyMatch(key, transform);
             }
 
             virtual std::vector<ReturnValue>
@@ -359,10 +374,27 @@ namespace TensileLite
                                                           Transform     transform,
                                                           int           numSolutions) const override
             {
-                return findTopKeyMatch(
-                    ProblemKey::keyForProblem<Key, Object>(object, this->properties),
-                    transform,
-                    numSolutions);
+                auto key
+                    = ProblemKey::keyForProblem<Key, Object>(object, this->properties, keyPlan);
+                if(SelectionTrace::active())
+                    return findTopKeyMatch(key, scoredTransform(key, transform), numSolutions);
+                return findTopKeyMatch(key, transform, numSolutions);
+            }
+
+            // Scores the candidates of a traced selection with the distance of the closest
+            // table entry that leads to them
+            Transform scoredTransform(Key const& key, Transform transform) const
+            {
+                return [this, key, transform](Value value) {
+                    double score = std::numeric_limits<double>::max();
+                    for(auto const& entry : table)
+                    {
+                        if(entry.value == value)
+                            score = std::min(score, double(distance(key, entry.key)));
+                    }
+                    SelectionTrace::Score scope(score);
+                    return transform(value);
+                };
             }
 
             virtual ReturnValue findBestEvaluationSolution(Object const&   object,
@@ -447,7 +479,7 @@ namespace TensileLite
             virtual std::vector<Value> matchesInOrder(Object const& object) const override
             {
                 return keyMatchesInOrder(
-                    ProblemKey::keyForProblem<Key, Object>(object, this->properties));
+                    ProblemKey::keyForProblem<Key, Object>(object, this->properties, keyPlan));
             }
 
             std::vector<Value> keyMatchesInOrder(Key const& key) const
@@ -494,12 +526,13 @@ namespace TensileLite
                 return Distance::Type();
             }
 
-            std::vector<Entry> table;
-            Distance           distance;
+            std::vector<Entry>          table;
+            Distance                    distance;
+            ProblemKey::KeyPlan<Object> keyPlan;
 
             ReturnValue nullValue;
 
-            mutable KDTree<int32_t, 2>                                  kdTree;
+            KDTree<int32_t, 2>                                           kdTree;
             std::map<std::tuple<int32_t, int32_t>, std::vector<KBEntry>> kSolutionMap;
         };
 
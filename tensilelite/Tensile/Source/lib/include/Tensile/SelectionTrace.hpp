@@ -0,0 +1,174 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Tensile/Predicates.hpp>
+
+namespace TensileLite
+{
+    /**
+     * A solution that a selection evaluated for a problem.
+     */
+    struct SelectionCandidate
+    {
+        int         solutionIndex = -1;
+        std::string solutionName;
+        bool        accepted = false;
+        /// The innermost hardware or problem predicate that rejected the solution,
+        /// with the values of both sides, empty when the solution was accepted
+        std::string failedPredicate;
+        size_t      requiredWorkspace = 0;
+        size_t      providedWorkspace = 0;
+        /// Distance of the logic table entry to the problem, NaN when the
+        /// solution was not reached through a distance table
+        double score = std::numeric_limits<double>::quiet_NaN();
+    };
+
+    /**
+     * Records every candidate the selections of the constructing thread evaluate
+     * while the trace is alive. The caches of selected solutions are bypassed,
+     * so the selection is repeated in full. Traces do not nest.
+     */
+    class SelectionTrace
+    {
+    public:
+        SelectionTrace()
+        {
+            current() = this;
+        }
+        ~SelectionTrace()
+        {
+            current() = nullptr;
+        }
+
+        SelectionTrace(SelectionTrace const&)            = delete;
+        SelectionTrace& operator=(SelectionTrace const&) = delete;
+
+        /// The trace of the calling thread, nullptr when none is recording
+        static SelectionTrace* active()
+        {
+            return current();
+        }
+
+        std::vector<SelectionCandidate> const& candidates() const
+        {
+            return m_candidates;
+        }
+
+        /**
+         * Scores the candidates evaluated during the lifetime of the scope.
+         */
+        class Score
+        {
+        public:
+            explicit Score(double score)
+                : m_trace(active())
+            {
+                if(m_trace)
+                {
+                    m_previous       = m_trace->m_score;
+                    m_trace->m_score = score;
+                }
+            }
+            ~Score()
+            {
+                if(m_trace)
+                    m_trace->m_score = m_previous;
+            }
+
+            Score(Score const&)            = delete;
+            Score& operator=(Score const&) = delete;
+
+        private:
+            SelectionTrace* m_trace;
+            double          m_previous = std::numeric_limits<double>::quiet_NaN();
+        };
+
+        /**
+         * Evaluates the predicates of solution for problem the way the selection
+         * does and records the outcome.
+         */
+        template <typename Solution, typename Problem, typename Hardware>
+        void evaluate(Solution const& solution, Problem const& problem, Hardware const& hardware)
+        {
+            SelectionCandidate candidate;
+            candidate.solutionIndex     = solution.index;
+            candidate.solutionName      = solution.name();
+            candidate.requiredWorkspace = solution.requiredWorkspaceSize(problem, hardware);
+            candidate.providedWorkspace = problem.workspaceSize();
+            candidate.score             = m_score;
+
+            if(!(*solution.hardwarePredicate)(hardware))
+                candidate.failedPredicate
+                    = "hardware: " + failure(*solution.hardwarePredicate, hardware);
+            else if(!(*solution.problemPredicate)(problem))
+                candidate.failedPredicate
+                    = "problem: " + failure(*solution.problemPredicate, problem);
+            candidate.accepted = candidate.failedPredicate.empty();
+
+            m_candidates.push_back(std::move(candidate));
+        }
+
+    private:
+        static SelectionTrace*& current()
+        {
+            thread_local SelectionTrace* trace = nullptr;
+            return trace;
+        }
+
+        // The innermost term of predicate that is false for object
+        template <typename Object>
+        static std::string failure(Predicates::Predicate<Object> const& predicate,
+                                   Object const&                        object)
+        {
+            if(auto const* all = dynamic_cast<Predicates::And<Object> const*>(&predicate))
+            {
+                for(auto const& term : all->value)
+                {
+                    if(!(*term)(object))
+                        return failure(*term, object);
+                }
+            }
+
+            std::ostringstream stream;
+            predicate.debugEval(object, stream);
+            auto text = stream.str();
+            while(!text.empty() && (text.back() == '\n' || text.back() == ' '))
+                text.pop_back();
+            return text.empty() ? predicate.toString() : text;
+        }
+
+        std::vector<SelectionCandidate> m_candidates;
+        double                          m_score = std::numeric_limits<double>::quiet_NaN();
+    };
+} // namespace TensileLite
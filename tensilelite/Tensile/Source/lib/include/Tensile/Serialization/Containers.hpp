@@ -33,6 +33,7 @@
 #include <Tensile/DecisionTreeLibrary.hpp>
 #include <Tensile/ExactLogicLibrary.hpp>
 #include <Tensile/FreeSizeLibrary.hpp>
+#include <Tensile/GradientBoostedLibrary.hpp>
 #include <Tensile/GranularitySelectionLibrary.hpp>
 #include <Tensile/PropertyMatching.hpp>
 
@@ -220,6 +221,17 @@ namespace TensileLite
         {
         };
 
+        TENSILE_SERIALIZE_VECTOR(false, TensileLite::GradientBoosting::RegressionTree);
+
+        template <typename Value, typename IO>
+        struct SequenceTraits<std::vector<TensileLite::GradientBoosting::Candidate<Value>>, IO>
+            : public DefaultSequenceTraits<
+                  std::vector<TensileLite::GradientBoosting::Candidate<Value>>,
+                  IO,
+                  false>
+        {
+        };
+
         template <typename T, size_t N, typename IO>
         struct SequenceTraits<std::array<T, N>, IO>
         {
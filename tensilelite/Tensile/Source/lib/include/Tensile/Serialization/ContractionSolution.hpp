@@ -28,6 +28,7 @@
 
 #include <functional>
 
+#include <Tensile/ContractionProblemPredicates.hpp>
 #include <Tensile/ContractionSolution.hpp>
 #include <Tensile/Serialization/Base.hpp>
 
@@ -58,6 +59,17 @@ namespace TensileLite
 
                 iot::mapRequired(io, "hardwarePredicate", s.hardwarePredicate);
                 iot::mapRequired(io, "problemPredicate", s.problemPredicate);
+                if(!iot::outputting(io))
+                {
+                    if(dynamic_cast<Predicates::True<Hardware>*>(s.hardwarePredicate.get()))
+                        s.hardwarePredicate = Predicates::True<Hardware>::Shared();
+
+                    // Solutions with identical problem predicates share one instance
+                    if(s.problemPredicate && Debug::Instance().predicateMemo())
+                        s.problemPredicate
+                            = Predicates::MemoRegistry<ContractionSolution::Problem>::Instance()
+                                  .share(s.problemPredicate, Predicates::Contraction::Memoizable);
+                }
 
                 iot::mapRequired(io, "debugKernel", s.debugKernel);
                 iot::mapOptional(io, "libraryLogicIndex", s.libraryLogicIndex);
@@ -111,6 +123,8 @@ namespace TensileLite
                 iot::mapRequired(io, "workspaceSizePerElemBias", s.workspaceSizePerElemBias);
 
                 iot::mapOptional(io, "activationFused", s.activationFused);
+                iot::mapOptional(io, "temporalHintB", s.temporalHintB);
+                iot::mapOptional(io, "temporalHintD", s.temporalHintD);
 
                 iot::mapOptional(io, "CustomKernelName", s.customKernelName);
 
@@ -137,6 +151,7 @@ namespace TensileLite
                 iot::mapRequired(io, "wgm", s.wgm);
                 iot::mapRequired(io, "staggerU", s.staggerU);
                 iot::mapRequired(io, "useUniversalArgs", s.useUniversalArgs);
+                iot::mapOptional(io, "kernargPreload", s.kernargPreload);
             }
 
             const static bool flow = false;
@@ -148,7 +163,11 @@ namespace TensileLite
             using iot = IOTraits<IO>;
             static void mapping(IO& io, ContractionSolution::ProblemType& s)
             {
-                iot::mapRequired(io, "operationIdentifier", s.operationIdentifier);
+                // Interned, the solutions of a problem type share it
+                std::string operationIdentifier = s.operationIdentifier;
+                iot::mapRequired(io, "operationIdentifier", operationIdentifier);
+                if(!iot::outputting(io))
+                    s.operationIdentifier = operationIdentifier;
 
                 iot::mapRequired(io, "transA", s.transA);
                 iot::mapRequired(io, "transB", s.transB);
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <Tensile/GradientBoostedLibrary.hpp>
+
+#include <cstddef>
+
+namespace TensileLite
+{
+    namespace Serialization
+    {
+        template <typename IO>
+        struct MappingTraits<GradientBoosting::RegressionTree, IO>
+        {
+            using Tree = GradientBoosting::RegressionTree;
+            using iot  = IOTraits<IO>;
+
+            static void mapping(IO& io, Tree& tree)
+            {
+                iot::mapRequired(io, "tree", tree.tree);
+                iot::mapRequired(io, "leaves", tree.leaves);
+            }
+
+            const static bool flow = false;
+        };
+
+        template <typename Value, typename IO>
+        struct MappingTraits<GradientBoosting::Candidate<Value>, IO>
+        {
+            using Candidate = GradientBoosting::Candidate<Value>;
+            using iot       = IOTraits<IO>;
+
+            static void mapping(IO& io, Candidate& candidate)
+            {
+                iot::mapRequired(io, "features", candidate.features);
+                iot::mapRequired(io, "value", candidate.value);
+            }
+
+            const static bool flow = false;
+        };
+
+        template <typename MyProblem, typename MySolution, typename IO>
+        struct MappingTraits<GradientBoostedLibrary<MyProblem, MySolution>, IO>
+        {
+            using Library = GradientBoostedLibrary<MyProblem, MySolution>;
+            using iot     = IOTraits<IO>;
+
+            static void mapping(IO& io, Library& lib)
+            {
+                iot::mapRequired(io, "features", lib.features);
+                iot::mapRequired(io, "bias", lib.bias);
+                iot::mapRequired(io, "trees", lib.trees);
+                iot::mapRequired(io, "candidates", lib.candidates);
+
+                if(iot::outputting(io))
+                    return;
+
+                if(lib.candidates.empty())
+                {
+                    iot::setError(io, "GradientBoostedLibrary requires at least one candidate.");
+                    return;
+                }
+
+                // Every candidate extends the problem features to the same key
+                size_t keySize = lib.features.size() + lib.candidates[0].features.size();
+                for(auto const& candidate : lib.candidates)
+                {
+                    if(lib.features.size() + candidate.features.size() != keySize)
+                        iot::setError(io,
+                                      "GradientBoostedLibrary candidate feature count mismatch.");
+                    if(candidate.value == nullptr)
+                        iot::setError(io, "GradientBoostedLibrary candidate without library.");
+                }
+
+                for(size_t i = 0; i < lib.trees.size(); i++)
+                {
+                    if(!lib.trees[i].valid(keySize))
+                        iot::setError(io,
+                                      concatenate("GradientBoostedLibrary invalid tree: ", i));
+                }
+            }
+
+            const static bool flow = false;
+        };
+    } // namespace Serialization
+} // namespace TensileLite
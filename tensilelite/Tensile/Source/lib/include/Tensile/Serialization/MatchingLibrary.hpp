@@ -66,6 +66,7 @@ namespace TensileLite
                         return e1.key < e2.key || (e1.key == e2.key && e1.speed > e2.speed);
                     };
                     std::sort(table.table.begin(), table.table.end(), comp);
+                    table.keyPlan.build(table.properties);
 
                     if constexpr(std::is_same<Distance, Matching::GridBasedDistance<Key>>{})
                     {
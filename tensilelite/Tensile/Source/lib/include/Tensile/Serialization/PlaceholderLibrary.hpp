@@ -57,6 +57,12 @@ namespace TensileLite
                     auto ctx = static_cast<LibraryIOContext<MySolution>*>(iot::getContext(io));
                     lib.masterSolutions = ctx->solutions;
                     lib.solutionsGuard  = ctx->solutionsGuard;
+                    lib.masterTable     = ctx->solutionTable;
+                    if(ctx->placeholders)
+                        (*ctx->placeholders)[lib.filePrefix] = [&lib]() {
+                            if(!lib.loaded.load(std::memory_order_acquire))
+                                lib.loadPlaceholderLibrary();
+                        };
 
                     //Extract directory where TensileLibrary.dat/yaml file is located
                     lib.libraryDirectory = ctx->filename;
@@ -70,19 +76,24 @@ namespace TensileLite
                     size_t periodPos = ctx->filename.rfind('.');
                     lib.suffix       = ctx->filename.substr(periodPos);
 
-                    for(auto condition : ctx->preloaded)
-                    {
-                        std::string pattern = RegexPattern(condition);
+                    auto matches = [&lib](std::vector<LazyLoadingInit> const& conditions) {
+                        for(auto condition : conditions)
+                        {
+                            std::string pattern = RegexPattern(condition);
 #ifdef WIN32
-                        if(PathMatchSpecA(lib.filePrefix.c_str(), pattern.c_str()))
+                            if(PathMatchSpecA(lib.filePrefix.c_str(), pattern.c_str()))
 #else
-                        if(fnmatch(pattern.c_str(), lib.filePrefix.c_str(), 0) == 0)
+                            if(fnmatch(pattern.c_str(), lib.filePrefix.c_str(), 0) == 0)
 #endif
-                        {
-                            lib.loadPlaceholderLibrary();
-                            break;
+                                return true;
                         }
-                    }
+                        return false;
+                    };
+
+                    if(matches(ctx->preloaded))
+                        lib.loadPlaceholderLibrary();
+                    else if(matches(ctx->prefetched))
+                        lib.prefetchPlaceholderLibrary();
                 }
             }
 
@@ -165,6 +165,8 @@ namespace TensileLite
             {
                 SubclassMap rv({Base::template Pair<Predicates::GPU::ProcessorEqual>(),
                                 Base::template Pair<Predicates::GPU::CUCountEqual>(),
+                                Base::template Pair<Predicates::GPU::ComputePartitionEqual>(),
+                                Base::template Pair<Predicates::GPU::MemoryPartitionEqual>(),
                                 Base::template Pair<Predicates::GPU::RunsKernelTargeting>()});
 
                 auto gmap = Generic::GetSubclasses();
@@ -193,6 +195,18 @@ namespace TensileLite
         {
         };
 
+        template <typename IO>
+        struct MappingTraits<Predicates::GPU::ComputePartitionEqual, IO>
+            : public AutoMappingTraits<Predicates::GPU::ComputePartitionEqual, IO>
+        {
+        };
+
+        template <typename IO>
+        struct MappingTraits<Predicates::GPU::MemoryPartitionEqual, IO>
+            : public AutoMappingTraits<Predicates::GPU::MemoryPartitionEqual, IO>
+        {
+        };
+
         template <typename IO>
         struct MappingTraits<Predicates::GPU::RunsKernelTargeting, IO>
             : public AutoMappingTraits<Predicates::GPU::RunsKernelTargeting, IO>
@@ -225,5 +239,34 @@ namespace TensileLite
                 iot::enumCase(io, value, "gfx1201", AMDGPU::Processor::gfx1201);
             }
         };
+
+        template <typename IO>
+        struct EnumTraits<AMDGPU::ComputePartition, IO>
+        {
+            using iot = IOTraits<IO>;
+
+            static void enumeration(IO& io, AMDGPU::ComputePartition& value)
+            {
+                iot::enumCase(io, value, "SPX", AMDGPU::ComputePartition::SPX);
+                iot::enumCase(io, value, "DPX", AMDGPU::ComputePartition::DPX);
+                iot::enumCase(io, value, "TPX", AMDGPU::ComputePartition::TPX);
+                iot::enumCase(io, value, "QPX", AMDGPU::ComputePartition::QPX);
+                iot::enumCase(io, value, "CPX", AMDGPU::ComputePartition::CPX);
+            }
+        };
+
+        template <typename IO>
+        struct EnumTraits<AMDGPU::MemoryPartition, IO>
+        {
+            using iot = IOTraits<IO>;
+
+            static void enumeration(IO& io, AMDGPU::MemoryPartition& value)
+            {
+                iot::enumCase(io, value, "NPS1", AMDGPU::MemoryPartition::NPS1);
+                iot::enumCase(io, value, "NPS2", AMDGPU::MemoryPartition::NPS2);
+                iot::enumCase(io, value, "NPS4", AMDGPU::MemoryPartition::NPS4);
+                iot::enumCase(io, value, "NPS8", AMDGPU::MemoryPartition::NPS8);
+            }
+        };
     } // namespace Serialization
 } // namespace TensileLite
@@ -29,8 +29,10 @@
 #include <Tensile/SolutionLibrary.hpp>
 
 #include <Tensile/CachingLibrary.hpp>
+#include <Tensile/ContractionSolution.hpp>
 #include <Tensile/Debug.hpp>
 #include <Tensile/ExactLogicLibrary.hpp>
+#include <Tensile/FlatSelectionLibrary.hpp>
 #include <Tensile/MapLibrary.hpp>
 #include <Tensile/MasterSolutionLibrary.hpp>
 #include <Tensile/PlaceholderLibrary.hpp>
@@ -41,6 +43,7 @@
 
 #include <Tensile/Serialization/DecisionTreeLibrary.hpp>
 #include <Tensile/Serialization/ExactLogicLibrary.hpp>
+#include <Tensile/Serialization/GradientBoostedLibrary.hpp>
 #include <Tensile/Serialization/GranularitySelectionLibrary.hpp>
 #include <Tensile/Serialization/MapLibrary.hpp>
 #include <Tensile/Serialization/MatchingLibrary.hpp>
@@ -80,7 +83,8 @@ namespace TensileLite
                      Base::template Pair<ProblemMatchingLibrary<MyProblem, MySolution>>(),
                      Base::template Pair<GranularitySelectionLibrary<MyProblem, MySolution>>(),
                      Base::template Pair<PlaceholderLibrary<MyProblem, MySolution>>(),
-                     Base::template Pair<DecisionTreeLibrary<MyProblem, MySolution>>()});
+                     Base::template Pair<DecisionTreeLibrary<MyProblem, MySolution>>(),
+                     Base::template Pair<GradientBoostedLibrary<MyProblem, MySolution>>()});
             }
         };
 
@@ -157,14 +161,21 @@ namespace TensileLite
 
                 if(!iot::outputting(io))
                 {
+                    std::lock_guard<std::mutex> guard(lib.solutionsGuard);
                     for(auto const& s : solutions)
                         lib.solutions[s->index] = s;
+                    PublishSolutionTable(lib.solutions, lib.solutionTable);
 
                     auto ctx = static_cast<LibraryIOContext<MySolution>*>(iot::getContext(io));
                     ctx->solutions      = &lib.solutions;
                     ctx->solutionsGuard = &lib.solutionsGuard;
+                    ctx->solutionTable  = &lib.solutionTable;
+                    ctx->placeholders   = &lib.placeholderLoaders;
                 }
 
+                // Taken before placeholders load or prefetch their solutions
+                size_t sharedTag = hash_combine(lib.version, lib.solutions.size());
+
                 std::shared_ptr<SolutionLibrary<MyProblem, MySolution>> innerLibrary;
 
                 if(iot::outputting(io))
@@ -179,16 +190,41 @@ namespace TensileLite
                     {
                         innerLibrary = lib.library;
                     }
+
+                    auto flat
+                        = std::dynamic_pointer_cast<FlatSelectionLibrary<MyProblem, MySolution>>(
+                            innerLibrary);
+                    if(flat)
+                        innerLibrary = flat->library();
                 }
 
                 iot::mapRequired(io, "library", innerLibrary);
 
                 if(!iot::outputting(io))
                 {
+                    if(innerLibrary && Debug::Instance().flatSelection())
+                        innerLibrary
+                            = std::make_shared<FlatSelectionLibrary<MyProblem, MySolution>>(
+                                innerLibrary);
+
                     auto cache
                         = std::make_shared<CachingLibrary<MyProblem, MySolution>>(innerLibrary);
+                    cache->setSharedSolutions(&lib.solutions, &lib.solutionsGuard, sharedTag);
 
                     lib.library = cache;
+
+                    if(Debug::Instance().printMemoryReport())
+                    {
+                        // Includes the solutions of the placeholders loaded so far
+                        SolutionHostMemory          usage;
+                        std::lock_guard<std::mutex> guard(lib.solutionsGuard);
+                        for(auto const& pair : lib.solutions)
+                            pair.second->addHostMemory(usage);
+
+                        auto ctx = static_cast<LibraryIOContext<MySolution>*>(iot::getContext(io));
+                        std::cout << "Host memory of " << ctx->filename << ":" << std::endl
+                                  << usage;
+                    }
                 }
             }
 
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <Tensile/Singleton.hpp>
+
+namespace TensileLite
+{
+    /**
+     * Key of a SharedSelectionCache entry. `problem` is the hash of the problem,
+     * `context` the hash of what else the selection depends on: the kind of
+     * lookup, the device and the library.
+     */
+    struct SharedSelectionKey
+    {
+        uint64_t problem = 0;
+        uint64_t context = 0;
+    };
+
+    /**
+     * Node-wide cache of selected solution indices in a POSIX shared memory
+     * object, enabled with TENSILE_SHARED_CACHE=<name>. Processes of the same
+     * user that set the same name share the selections of CachingLibrary, so
+     * only the first process that sees a problem pays for the library search.
+     *
+     * The object is a fixed-size open-addressing table. Entries are written once
+     * and never replaced, so readers need no lock: a writer claims a free slot,
+     * fills it and then marks it ready. When the probe sequence of a key is full
+     * the selection is simply not shared. Indices read from the cache are only
+     * hints; callers must check that the solution supports the problem.
+     */
+    class SharedSelectionCache : public LazySingleton<SharedSelectionCache>
+    {
+    public:
+        static constexpr size_t MaxIndices = 8;
+
+        // Slot states
+        static constexpr uint32_t Empty   = 0;
+        static constexpr uint32_t Writing = 1;
+        static constexpr uint32_t Ready   = 2;
+
+        ~SharedSelectionCache();
+
+        SharedSelectionCache(SharedSelectionCache const&)            = delete;
+        SharedSelectionCache& operator=(SharedSelectionCache const&) = delete;
+
+        /**
+         * Whether the shared memory object is mapped.
+         */
+        bool enabled() const
+        {
+            return m_entries != nullptr;
+        }
+
+        /**
+         * Copies up to maxCount indices stored for key to indices. Returns the
+         * number of indices copied, 0 on a miss.
+         */
+        size_t find(SharedSelectionKey const& key,
+                    int*                      indices,
+                    size_t                    maxCount,
+                    double*                   fitness = nullptr) const;
+
+        /**
+         * Stores the first MaxIndices of count indices for key, unless the key is
+         * already present or there is no free slot near its hash.
+         */
+        void add(SharedSelectionKey const& key,
+                 int const*                indices,
+                 size_t                    count,
+                 double                    fitness = 0.0);
+
+        size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+         * Number of entries written by all processes.
+         */
+        size_t size() const;
+
+        /**
+         * Lookups of this process that found their key, and those that did not.
+         */
+        uint64_t hits() const
+        {
+            return m_hits.load(std::memory_order_relaxed);
+        }
+        uint64_t misses() const
+        {
+            return m_misses.load(std::memory_order_relaxed);
+        }
+
+    private:
+        friend LazySingleton<SharedSelectionCache>;
+
+        struct Header;
+        struct Entry;
+
+        SharedSelectionCache();
+
+        bool map(std::string const& name, size_t capacity);
+
+        Header* m_header   = nullptr;
+        Entry*  m_entries  = nullptr;
+        size_t  m_capacity = 0;
+        size_t  m_bytes    = 0;
+
+        mutable std::atomic<uint64_t> m_hits{0};
+        mutable std::atomic<uint64_t> m_misses{0};
+    };
+} // namespace TensileLite
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Tensile/Debug.hpp>
+#include <Tensile/SelectionTrace.hpp>
 
 namespace TensileLite
 {
@@ -102,6 +103,9 @@ namespace TensileLite
                     std::cout << std::endl;
                 }
 
+                if(auto* trace = SelectionTrace::active())
+                    trace->evaluate(*solution, problem, hardware);
+
                 if((*solution->hardwarePredicate)(hardware)
                    && (*solution->problemPredicate)(problem))
                     return solution;
@@ -147,11 +151,9 @@ namespace TensileLite
                         return std::shared_ptr<MySolution>();
                 }
 
-                if(solution->requiredHostWorkspaceSizePerProblem == static_cast<size_t>(-1))
-                {
-                    solution->requiredHostWorkspaceSizePerProblem
-                        = solution->requiredHostSizeGroupedGemmSingle(problems[0],hardware);
-                }
+                solution->requiredHostWorkspaceSizePerProblem.init([&]() {
+                    return solution->requiredHostSizeGroupedGemmSingle(problems[0], hardware);
+                });
 
                 return solution;
             }
@@ -263,11 +265,9 @@ namespace TensileLite
 
             if(useSolution)
             {
-                if(solution->requiredHostWorkspaceSizePerProblem == static_cast<size_t>(-1))
-                {
-                    solution->requiredHostWorkspaceSizePerProblem
-                        = solution->requiredHostSizeGroupedGemmSingle(problems[0],hardware);
-                }
+                solution->requiredHostWorkspaceSizePerProblem.init([&]() {
+                    return solution->requiredHostSizeGroupedGemmSingle(problems[0], hardware);
+                });
                 return SolutionSet<MySolution>({solution});
             }
 
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace TensileLite
+{
+    /**
+     * Flat map from solution index to the lazily-loaded library file that holds
+     * the solution, written offline by WriteSolutionIndex next to a
+     * TensileLibrary_lazy_<arch> file. The image only holds offsets, so it is
+     * used in place after mmap: a lookup is a binary search over the mapped
+     * entries and nothing is constructed per solution.
+     *
+     * With it, MasterSolutionLibrary::getSolutionByIndex loads only the one
+     * file that holds a solution it does not know yet, instead of the callers
+     * preloading every file of the architecture.
+     */
+    class SolutionIndexFile
+    {
+    public:
+        /**
+         * Maps path, returns nullptr when it is missing or not a valid image.
+         */
+        static std::shared_ptr<SolutionIndexFile> Open(std::string const& path);
+
+        ~SolutionIndexFile();
+
+        SolutionIndexFile(SolutionIndexFile const&)            = delete;
+        SolutionIndexFile& operator=(SolutionIndexFile const&) = delete;
+
+        /**
+         * Returns the prefix of the library file holding index, as used by
+         * PlaceholderLibrary::filePrefix, or nullptr when index is not listed.
+         */
+        char const* find(int index) const;
+
+        size_t size() const;
+
+        /**
+         * Largest listed solution index, -1 when the image is empty.
+         */
+        int lastIndex() const;
+
+    private:
+        friend bool WriteSolutionIndex(std::string const&                path,
+                                       std::map<int, std::string> const& files);
+
+        struct Header;
+        struct Entry;
+
+        SolutionIndexFile() = default;
+
+        void*         m_data    = nullptr;
+        size_t        m_size    = 0;
+        Header const* m_header  = nullptr;
+        Entry const*  m_entries = nullptr;
+        char const*   m_strings = nullptr;
+    };
+
+    /**
+     * Writes the image read by SolutionIndexFile for the files of a library,
+     * keyed by solution index. Returns false when path cannot be written.
+     */
+    bool WriteSolutionIndex(std::string const& path, std::map<int, std::string> const& files);
+} // namespace TensileLite
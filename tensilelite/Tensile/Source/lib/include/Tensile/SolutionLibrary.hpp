@@ -31,6 +31,7 @@
 #include <string>
 #include <vector>
 
+#include <Tensile/Predicates.hpp>
 #include <Tensile/Tensile.hpp>
 
 namespace TensileLite
@@ -198,6 +199,28 @@ namespace TensileLite
         {
             return SolutionVector<MySolution>();
         }
+
+        /**
+   * Returns the findTopSolutions() of each of `problems`, in order.
+   *
+   * Libraries that select a child by a property of the problem, or by the
+   * hardware, override this to forward each child all of its problems at once,
+   * so that a node that problems of the same type share is visited once.
+   */
+        virtual std::vector<SolutionVector<MySolution>>
+            findTopSolutionsBatch(std::vector<MyProblem const*> const& problems,
+                                  Hardware const&                      hardware,
+                                  int                                  numSolutions) const
+        {
+            std::vector<SolutionVector<MySolution>> rv;
+            rv.reserve(problems.size());
+            for(auto problem : problems)
+            {
+                Predicates::MemoScope<MyProblem> memo(*problem);
+                rv.push_back(findTopSolutions(*problem, hardware, numSolutions));
+            }
+            return rv;
+        }
     };
 
 } // namespace TensileLite
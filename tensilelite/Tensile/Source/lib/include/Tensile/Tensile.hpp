@@ -193,7 +193,8 @@ namespace TensileLite
     template <typename MyProblem, typename MySolution = typename MyProblem::Solution>
     TENSILE_API std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
                 LoadLibraryFilePreload(std::string const&                  filename,
-                                       const std::vector<LazyLoadingInit>& preload);
+                                       const std::vector<LazyLoadingInit>& preload,
+                                       const std::vector<LazyLoadingInit>& prefetch = {});
 
     template <typename MyProblem, typename MySolution = typename MyProblem::Solution>
     std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
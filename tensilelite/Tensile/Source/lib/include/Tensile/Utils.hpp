@@ -27,11 +27,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -95,6 +97,113 @@ namespace TensileLite
         ~ThreadSafeValue() = default;
     };
 
+    // Value computed by the first thread that calls init, the others wait for it and get the
+    // same value. Copies take the value once it is computed
+    template <typename T>
+    class OnceValue
+    {
+    private:
+        mutable std::mutex m_access;
+        std::atomic<bool>  m_ready{false};
+        T                  m_value{};
+
+    public:
+        OnceValue() {}
+
+        OnceValue(const OnceValue<T>& other)
+        {
+            std::lock_guard<std::mutex> lock(other.m_access);
+            m_value = other.m_value;
+            m_ready.store(other.m_ready.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+        }
+
+        OnceValue<T>& operator=(const OnceValue<T>& other)
+        {
+            if(this != &other)
+            {
+                std::lock_guard<std::mutex> otherLock(other.m_access);
+                std::lock_guard<std::mutex> selfLock(m_access);
+                m_value = other.m_value;
+                m_ready.store(other.m_ready.load(std::memory_order_relaxed),
+                              std::memory_order_release);
+            }
+
+            return *this;
+        }
+
+        template <typename Compute>
+        T init(Compute&& compute)
+        {
+            if(!m_ready.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> lock(m_access);
+                if(!m_ready.load(std::memory_order_relaxed))
+                {
+                    m_value = compute();
+                    m_ready.store(true, std::memory_order_release);
+                }
+            }
+
+            return m_value;
+        }
+
+        bool ready() const
+        {
+            return m_ready.load(std::memory_order_acquire);
+        }
+
+        // T{} until init returned on this thread or on one that synchronized with it
+        T operator*() const
+        {
+            return ready() ? m_value : T{};
+        }
+
+        ~OnceValue() = default;
+    };
+
+    // Immutable string whose equal values share one allocation, for the metadata that many
+    // loaded solutions repeat. The values are kept until the process exits
+    class InternedString
+    {
+    public:
+        InternedString();
+        InternedString(std::string const& value);
+        InternedString(char const* value);
+
+        std::string const& str() const
+        {
+            return *m_value;
+        }
+
+        operator std::string const&() const
+        {
+            return *m_value;
+        }
+
+        bool operator==(InternedString const& other) const
+        {
+            return m_value == other.m_value;
+        }
+
+        bool operator!=(InternedString const& other) const
+        {
+            return m_value != other.m_value;
+        }
+
+        // Number of distinct values and the bytes of their characters
+        static size_t PoolSize();
+        static size_t PoolBytes();
+
+    private:
+        std::string const* m_value;
+    };
+
+    inline std::ostream& operator<<(std::ostream& stream, InternedString const& value)
+    {
+        return stream << value.str();
+    }
+
     /**
  * \ingroup Tensile
  * \addtogroup Utilities
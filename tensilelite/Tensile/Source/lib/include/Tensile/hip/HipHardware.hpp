@@ -45,6 +45,11 @@ namespace TensileLite
             virtual std::string archName() const override;
         };
 
+        // Properties of a device, queried once per process. hipGetDeviceProperties takes
+        // milliseconds, so handles and launch paths share these instead
+        hipDeviceProp_t const& GetDeviceProperties(int deviceId);
+        hipDeviceProp_t const& GetCurrentDeviceProperties();
+
         std::shared_ptr<Hardware> GetCurrentDevice();
         std::shared_ptr<Hardware> GetDevice(int deviceId);
         std::shared_ptr<Hardware> GetDevice(hipDeviceProp_t const& prop);
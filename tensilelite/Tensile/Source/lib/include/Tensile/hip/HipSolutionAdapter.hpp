@@ -31,10 +31,15 @@
 #include <hip/hip_runtime.h>
 #include <unordered_set>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 
 namespace TensileLite
 {
+    class CodeObjectArchive;
+
     namespace hip
     {
         class SolutionAdapter : public TensileLite::SolutionAdapter
@@ -55,6 +60,8 @@ namespace TensileLite
             hipError_t initializeLazyLoading(std::string architecture, std::string codeObjectDir);
 
             hipError_t loadCodeObject(const void* image);
+            // Shares the module of an identical code object that is already loaded
+            hipError_t loadCodeObject(const void* image, size_t bytes);
 
             hipError_t loadCodeObjectBytes(std::vector<uint8_t> const& bytes);
 
@@ -70,6 +77,14 @@ namespace TensileLite
 
             hipError_t launchKernels(std::vector<KernelInvocation> const& kernels);
 
+            /**
+             * Launches kernels on stream without timing events. Kernels that are
+             * already resolved skip the debug, residency and event checks of
+             * launchKernel(), which only the first launch of a kernel goes through.
+             */
+            hipError_t launchKernels(std::vector<KernelInvocation> const& kernels,
+                                     hipStream_t                          stream);
+
             hipError_t launchKernels(std::vector<KernelInvocation> const& kernels,
                                      hipStream_t                          stream,
                                      hipEvent_t                           startEvent,
@@ -81,27 +96,172 @@ namespace TensileLite
                                      std::vector<hipEvent_t> const&       startEvents,
                                      std::vector<hipEvent_t> const&       stopEvents);
 
+            /**
+             * Adds the kernels to graph as one node after the dependencies: a kernel
+             * node for a single kernel, a child graph node of the kernels in order
+             * otherwise. The modules of the kernels are never unloaded afterwards.
+             */
+            hipError_t addGraphNode(std::vector<KernelInvocation> const& kernels,
+                                    hipGraph_t                           graph,
+                                    hipGraphNode_t const*                dependencies,
+                                    size_t                               numDependencies,
+                                    hipGraphNode_t&                      node);
+
+            /**
+             * Sets the arguments of kernels on a node of addGraphNode() in an
+             * instantiated graph. The kernels must be those the node was added with.
+             */
+            hipError_t setGraphNode(std::vector<KernelInvocation> const& kernels,
+                                    hipGraphExec_t                       exec,
+                                    hipGraphNode_t                       node);
+
             bool FindCodeObject(std::string const& codeObjectFile);
 
             hipError_t initKernel(std::string const& name);
 
             hipError_t initKernels(std::vector<std::string> const& kernelNames);
 
+            struct Stats
+            {
+                uint64_t codeObjectsLoaded   = 0;
+                uint64_t codeObjectsUnloaded = 0;
+                uint64_t codeObjectsShared   = 0;
+                uint64_t kernelsResolved     = 0;
+            };
+
+            /**
+             * Code objects loaded and unloaded, and kernels looked up in the loaded
+             * modules, since the adapter was created. A kernel resolved again after its
+             * module was unloaded counts again. Loads that shared the module of an
+             * identical code object, of this adapter or another, count as shared too.
+             */
+            Stats stats() const;
+
         private:
+            /**
+             * A code object file loaded on demand by FindCodeObject while a code
+             * object budget is set. Unlike the other modules these can be
+             * unloaded, their kernels are resolved again on their next launch.
+             */
+            struct ResidentModule
+            {
+                hipModule_t           module;
+                std::string           file;
+                size_t                bytes = 0;
+                std::atomic<uint64_t> lastUse{0};
+                // Launched into a captured graph, which keeps referring to it
+                std::atomic<bool> pinned{false};
+            };
+
             hipError_t getKernel(hipFunction_t& rv, std::string const& name);
 
+            // The launch itself, without events, debug output or residency tracking
+            hipError_t launchResolvedKernel(KernelInvocation const& kernel,
+                                            hipFunction_t           function,
+                                            hipStream_t             stream);
+
+            /**
+             * Launch parameters of a kernel node. The extra launch parameters point
+             * into the struct itself, so it is filled in place and not copied.
+             */
+            struct KernelNodeParams
+            {
+                hipKernelNodeParams params   = {};
+                size_t              argsSize = 0;
+                void*               extra[5] = {};
+            };
+
+            hipError_t kernelNodeParams(KernelInvocation const& kernel, KernelNodeParams& node);
+
+            // Adds the kernels to graph, each one after the previous
+            hipError_t chainKernelNodes(std::vector<KernelInvocation> const& kernels,
+                                        hipGraph_t                           graph);
+
+            hipError_t loadModuleFile(std::string const& path, bool onDemand);
+
+            /**
+             * Unloads the least recently launched resident modules until they fit
+             * in the budget again, keeping at least the most recent one.
+             */
+            void evictColdModules();
+
+            /**
+             * Insert-only open addressing table of resolved kernels. find() is
+             * wait-free and may run concurrently with insert(), insert() must be
+             * serialized by the caller. Replaced bucket arrays are kept alive
+             * until destruction, as readers may still be probing them.
+             */
+            class KernelTable
+            {
+            public:
+                struct Entry
+                {
+                    std::string                name;
+                    size_t                     hash;
+                    std::atomic<hipFunction_t> function{nullptr};
+                    ResidentModule*            module = nullptr;
+                };
+
+                KernelTable();
+
+                Entry const* find(std::string const& name) const;
+                void         insert(std::string const& name,
+                                    hipFunction_t      function,
+                                    ResidentModule*    module = nullptr);
+
+                /**
+                 * Drops the kernels of module, which are skipped by find() from
+                 * then on. Must be serialized with insert().
+                 */
+                void evict(ResidentModule const* module);
+
+            private:
+                struct Buckets
+                {
+                    size_t                                       mask;
+                    std::unique_ptr<std::atomic<Entry const*>[]> slots;
+                };
+
+                void grow(size_t capacity);
+
+                static void place(Buckets const& buckets, Entry const* entry);
+
+                std::atomic<Buckets const*>           m_buckets{nullptr};
+                std::vector<std::unique_ptr<Buckets>> m_allBuckets;
+                std::vector<std::unique_ptr<Entry>>   m_entries;
+                // Slots taken in the current buckets, by live and dropped entries
+                size_t m_occupied = 0;
+                size_t m_live     = 0;
+            };
+
             std::mutex m_access;
 
-            std::vector<hipModule_t>                       m_modules;
-            std::unordered_map<std::string, hipFunction_t> m_kernels;
-            bool                                           m_debug           = false;
-            bool                                           m_debugSkipLaunch = false;
-            std::string                                    m_name            = "HipSolutionAdapter";
-            std::string                                    m_codeObjectDirectory;
+            std::vector<hipModule_t> m_modules;
+            KernelTable              m_kernels;
+            bool                     m_debug           = false;
+            bool                     m_debugSkipLaunch = false;
+            std::string              m_name            = "HipSolutionAdapter";
+            std::string              m_codeObjectDirectory;
 
             std::vector<std::string>        m_loadedModuleNames;
             std::unordered_set<std::string> m_loadedCOFiles;
 
+            // TensileCodeObjects_<arch>.coa of the code object directory, if there is one
+            std::shared_ptr<CodeObjectArchive> m_archive;
+
+            // Code object budget in bytes, 0 when modules are never unloaded
+            size_t                                       m_codeObjectBudget = 0;
+            size_t                                       m_residentBytes    = 0;
+            std::vector<std::unique_ptr<ResidentModule>> m_residentModules;
+            std::atomic<uint64_t>                        m_launchClock{0};
+            std::atomic<bool>                            m_overBudget{false};
+            std::atomic<uint64_t>                        m_codeObjectsLoaded{0};
+            std::atomic<uint64_t>                        m_codeObjectsUnloaded{0};
+            std::atomic<uint64_t>                        m_codeObjectsShared{0};
+            std::atomic<uint64_t>                        m_kernelsResolved{0};
+            // Held shared by launches and exclusively while unloading modules
+            std::shared_mutex m_residency;
+
             friend std::ostream& operator<<(std::ostream& stream, SolutionAdapter const& adapter);
         };
 
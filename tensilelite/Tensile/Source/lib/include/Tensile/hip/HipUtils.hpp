@@ -88,6 +88,23 @@ namespace TensileLite
 {
     namespace hip
     {
+        // Pinned host memory on the NUMA node closest to device. hipHostMalloc takes the
+        // node of the current device, which is the calling thread's and on a multi-socket
+        // host not necessarily the device that reads the memory.
+        inline hipError_t HostMallocNearDevice(void** ptr, size_t bytes, int device)
+        {
+            int current = device;
+            HIP_CHECK_RETURN(hipGetDevice(&current));
+            if(current != device)
+                HIP_CHECK_RETURN(hipSetDevice(device));
+
+            hipError_t err = hipHostMalloc(ptr, bytes, hipHostMallocDefault);
+
+            if(current != device)
+                static_cast<void>(hipSetDevice(current));
+            return err;
+        }
+
         inline void CopyTensorVoid(void*                   dst,
                                    void const*             src,
                                    TensorDescriptor const& desc,
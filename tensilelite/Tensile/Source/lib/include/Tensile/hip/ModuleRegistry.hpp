@@ -0,0 +1,279 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace TensileLite
+{
+    namespace hip
+    {
+        /**
+         * Where the content of a loaded code object can be read again: a file, or
+         * memory that stays valid while owner is held. A code object with neither
+         * can use the module of an identical one, but no other can use its module.
+         */
+        struct CodeObjectSource
+        {
+            std::string                 path;
+            void const*                 image = nullptr;
+            std::shared_ptr<void const> owner;
+        };
+
+        /**
+         * Modules of all adapters of the process, shared between identical code
+         * objects of the same device. The TensileLibrary files of related types
+         * often carry identical code objects, and several adapters may load the
+         * same ones; they share one module, unloaded when its last user releases
+         * it, and the kernels resolved in it.
+         *
+         * Code objects are identical when their bytes are. Only the size is kept
+         * for lookups, so a file is read only when a code object of the same size
+         * is already loaded, and loaded from its path otherwise.
+         *
+         * Loader wraps the runtime and the file system:
+         *   Module, Function, Error and the Error value Success,
+         *   Error device(int&), Error load(Module&, std::string const& path),
+         *   Error loadData(Module&, void const* image), void unload(Module),
+         *   Error getFunction(Function&, Module, std::string const& name),
+         *   size_t fileSize(std::string const& path), 0 when it can't be opened,
+         *   bool readFile(std::string const& path, std::vector<char>& bytes).
+         */
+        template <typename Loader>
+        class ModuleRegistry
+        {
+        public:
+            using Module   = typename Loader::Module;
+            using Function = typename Loader::Function;
+            using Error    = typename Loader::Error;
+
+            explicit ModuleRegistry(Loader loader = Loader())
+                : m_loader(std::move(loader))
+            {
+            }
+
+            Loader& loader()
+            {
+                return m_loader;
+            }
+
+            /**
+             * Loads the file at path, or takes another reference to the module of an
+             * identical code object. bytes is set to the size of the file.
+             */
+            Error acquireFile(Module& module, std::string const& path, size_t& bytes, bool& shared)
+            {
+                shared = false;
+
+                int   device = 0;
+                Error err    = m_loader.device(device);
+                if(err != Loader::Success)
+                    return err;
+
+                bytes = m_loader.fileSize(path);
+
+                CodeObjectSource source;
+                source.path = path;
+
+                std::lock_guard<std::mutex> guard(m_mutex);
+                if(!bytes || m_bySize.count({device, bytes}) == 0)
+                {
+                    err = m_loader.load(module, path);
+                    if(err == Loader::Success)
+                        add(module, device, bytes, std::move(source));
+                    return err;
+                }
+
+                std::vector<char> content;
+                if(m_loader.readFile(path, content))
+                {
+                    bytes = content.size();
+                    if(findShared(module, device, content.data(), bytes))
+                    {
+                        shared = true;
+                        return Loader::Success;
+                    }
+                    err = m_loader.loadData(module, content.data());
+                }
+                else
+                {
+                    err = m_loader.load(module, path);
+                }
+
+                if(err == Loader::Success)
+                    add(module, device, bytes, std::move(source));
+                return err;
+            }
+
+            /**
+             * Loads image, or takes another reference to the module of an identical
+             * code object. Images of unknown size are never shared.
+             */
+            Error acquireImage(Module&          module,
+                               void const*      image,
+                               size_t           bytes,
+                               CodeObjectSource source,
+                               bool&            shared)
+            {
+                shared = false;
+
+                int   device = 0;
+                Error err    = m_loader.device(device);
+                if(err != Loader::Success)
+                    return err;
+
+                std::lock_guard<std::mutex> guard(m_mutex);
+                if(bytes && findShared(module, device, image, bytes))
+                {
+                    shared = true;
+                    return Loader::Success;
+                }
+
+                err = m_loader.loadData(module, image);
+                if(err == Loader::Success)
+                    add(module, device, bytes, std::move(source));
+                return err;
+            }
+
+            void release(Module module)
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                auto                        iter = m_modules.find(module);
+                if(iter != m_modules.end())
+                {
+                    if(--iter->second.users > 0)
+                        return;
+
+                    auto range = m_bySize.equal_range(iter->second.key);
+                    for(auto entry = range.first; entry != range.second; entry++)
+                    {
+                        if(entry->second == module)
+                        {
+                            m_bySize.erase(entry);
+                            break;
+                        }
+                    }
+                    m_modules.erase(iter);
+                }
+                m_loader.unload(module);
+            }
+
+            Error getFunction(Function& function, Module module, std::string const& name)
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                auto                        iter = m_modules.find(module);
+                if(iter != m_modules.end())
+                {
+                    auto found = iter->second.functions.find(name);
+                    if(found != iter->second.functions.end())
+                    {
+                        function = found->second;
+                        return Loader::Success;
+                    }
+                }
+
+                Error err = m_loader.getFunction(function, module, name);
+                if(err == Loader::Success && iter != m_modules.end())
+                    iter->second.functions.emplace(name, function);
+                return err;
+            }
+
+            /// Users of module, 0 when it is not loaded through the registry
+            size_t users(Module module)
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                auto                        iter = m_modules.find(module);
+                return iter == m_modules.end() ? 0 : iter->second.users;
+            }
+
+        private:
+            // Device and size of a code object
+            using Key = std::pair<int, size_t>;
+
+            struct Entry
+            {
+                Key                                       key;
+                CodeObjectSource                          source;
+                size_t                                    users = 0;
+                std::unordered_map<std::string, Function> functions;
+            };
+
+            // Requires m_mutex. Takes a reference to the module of a code object with
+            // the bytes of image.
+            bool findShared(Module& module, int device, void const* image, size_t bytes)
+            {
+                auto range = m_bySize.equal_range({device, bytes});
+                for(auto iter = range.first; iter != range.second; iter++)
+                {
+                    auto& entry = m_modules.at(iter->second);
+                    if(sameContent(entry.source, image, bytes))
+                    {
+                        module = iter->second;
+                        entry.users++;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool sameContent(CodeObjectSource const& source, void const* image, size_t bytes)
+            {
+                if(source.image)
+                    return std::memcmp(source.image, image, bytes) == 0;
+
+                std::vector<char> content;
+                return m_loader.readFile(source.path, content) && content.size() == bytes
+                       && std::memcmp(content.data(), image, bytes) == 0;
+            }
+
+            // Requires m_mutex
+            void add(Module module, int device, size_t bytes, CodeObjectSource source)
+            {
+                auto& entry = m_modules[module];
+                entry.key   = {device, bytes};
+                entry.users = 1;
+                if(bytes && (source.image || !source.path.empty()))
+                {
+                    entry.source = std::move(source);
+                    m_bySize.emplace(entry.key, module);
+                }
+            }
+
+            Loader                            m_loader;
+            std::mutex                        m_mutex;
+            std::multimap<Key, Module>        m_bySize;
+            std::unordered_map<Module, Entry> m_modules;
+        };
+    } // namespace hip
+} // namespace TensileLite
@@ -33,7 +33,8 @@ namespace TensileLite
     template <typename MyProblem, typename MySolution>
     std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
         LLVMLoadLibraryFile(std::string const&                  filename,
-                            const std::vector<LazyLoadingInit>& preloaded = {});
+                            const std::vector<LazyLoadingInit>& preloaded  = {},
+                            const std::vector<LazyLoadingInit>& prefetched = {});
 
     template <typename MyProblem, typename MySolution>
     std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
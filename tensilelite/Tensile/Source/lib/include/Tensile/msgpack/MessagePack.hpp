@@ -241,11 +241,12 @@ namespace TensileLite
                 input(T& obj, Context& ctx)
             {
                 assert(object.type == msgpack::type::object_type::ARRAY);
-                auto result = object.as<std::vector<msgpack::object>>();
+                auto const& array = object.via.array;
 
-                for(size_t i = 0; i < result.size(); i++)
+                // Walk the elements in place rather than copying them into a vector
+                for(size_t i = 0; i < array.size; i++)
                 {
-                    MessagePackInput subRef = createSubRef(result[i]);
+                    MessagePackInput subRef = createSubRef(array.ptr[i]);
                     auto& value = SequenceTraits<T, MessagePackInput>::element(*this, obj, i);
                     subRef.input(value);
 
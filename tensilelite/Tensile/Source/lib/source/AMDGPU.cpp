@@ -71,11 +71,26 @@ namespace TensileLite
         return stream;
     }
 
+    std::ostream& operator<<(std::ostream& stream, AMDGPU::ComputePartition p)
+    {
+        stream << AMDGPU::toString(p);
+        return stream;
+    }
+
+    std::ostream& operator<<(std::ostream& stream, AMDGPU::MemoryPartition p)
+    {
+        stream << AMDGPU::toString(p);
+        return stream;
+    }
+
     TENSILE_API std::string AMDGPU::description() const
     {
         std::ostringstream rv;
 
-        rv << deviceName << "(" << computeUnitCount << "-CU " << processor << ")";
+        rv << deviceName << "(" << computeUnitCount << "-CU " << processor;
+        if(computePartition != ComputePartition::SPX || memoryPartition != MemoryPartition::NPS1)
+            rv << " " << computePartition << "/" << memoryPartition;
+        rv << ")";
 
         return rv.str();
     }
@@ -55,6 +55,10 @@ namespace TensileLite
             return "Dgelu";
         case ActivationType::Silu:
             return "Silu";
+        case ActivationType::Swiglu:
+            return "Swiglu";
+        case ActivationType::Geglu:
+            return "Geglu";
         case ActivationType::All:
             return "All";
         case ActivationType::Hipblaslt_all:
@@ -119,6 +123,14 @@ namespace TensileLite
         {
             t = ActivationType::Silu;
         }
+        else if(strValue == ToString(ActivationType::Swiglu))
+        {
+            t = ActivationType::Swiglu;
+        }
+        else if(strValue == ToString(ActivationType::Geglu))
+        {
+            t = ActivationType::Geglu;
+        }
         else if(strValue == ToString(ActivationType::All))
         {
             t = ActivationType::All;
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <Tensile/CodeObjectArchive.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TensileLite
+{
+    namespace
+    {
+        // "TCOA" and the layout version, bump when Header or Entry change
+        constexpr uint64_t Magic = 0x54434F4100000001ull;
+
+        // Images start on a page boundary of the mapping
+        constexpr uint64_t ImageAlignment = 4096;
+    } // namespace
+
+    // The image is a Header, count Entry sorted by name, stringBytes of
+    // NUL-terminated file names that entries refer to by offset, then the code
+    // objects at the aligned offsets of their entries
+    struct CodeObjectArchive::Header
+    {
+        uint64_t magic;
+        uint32_t count;
+        uint32_t stringBytes;
+    };
+
+    struct CodeObjectArchive::Entry
+    {
+        uint32_t nameOffset;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t bytes;
+    };
+
+    std::shared_ptr<CodeObjectArchive> CodeObjectArchive::Open(std::string const& path)
+    {
+        std::shared_ptr<CodeObjectArchive> rv(new CodeObjectArchive);
+
+#ifndef WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return nullptr;
+
+        struct stat st;
+        if(fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header))
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if(ptr == MAP_FAILED)
+            return nullptr;
+
+        rv->m_data = ptr;
+        rv->m_size = st.st_size;
+#else
+        std::ifstream in(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if(!in.is_open() || static_cast<size_t>(in.tellg()) < sizeof(Header))
+            return nullptr;
+
+        rv->m_size = in.tellg();
+        rv->m_data = new char[rv->m_size];
+        in.seekg(0);
+        if(!in.read(static_cast<char*>(rv->m_data), rv->m_size))
+            return nullptr;
+#endif
+
+        auto   bytes   = static_cast<char const*>(rv->m_data);
+        auto   header  = reinterpret_cast<Header const*>(bytes);
+        size_t strings = sizeof(Header) + header->count * sizeof(Entry);
+        if(header->magic != Magic || strings + header->stringBytes > rv->m_size
+           || (header->stringBytes > 0 && bytes[strings + header->stringBytes - 1] != '\0'))
+            return nullptr;
+
+        auto entries = reinterpret_cast<Entry const*>(header + 1);
+        for(uint32_t i = 0; i < header->count; i++)
+        {
+            if(entries[i].nameOffset >= header->stringBytes || entries[i].offset > rv->m_size
+               || entries[i].bytes > rv->m_size - entries[i].offset)
+                return nullptr;
+        }
+
+        rv->m_header  = header;
+        rv->m_entries = entries;
+        rv->m_strings = bytes + strings;
+        return rv;
+    }
+
+    CodeObjectArchive::~CodeObjectArchive()
+    {
+#ifndef WIN32
+        if(m_data)
+            munmap(m_data, m_size);
+#else
+        delete[] static_cast<char*>(m_data);
+#endif
+    }
+
+    void const* CodeObjectArchive::find(std::string const& name, size_t* bytes) const
+    {
+        auto end  = m_entries + size();
+        auto iter
+            = std::lower_bound(m_entries, end, name, [this](Entry const& e, auto const& value) {
+                  return std::strcmp(m_strings + e.nameOffset, value.c_str()) < 0;
+              });
+
+        if(iter == end || name != m_strings + iter->nameOffset)
+            return nullptr;
+
+        if(bytes)
+            *bytes = iter->bytes;
+        return static_cast<char const*>(m_data) + iter->offset;
+    }
+
+    size_t CodeObjectArchive::size() const
+    {
+        return m_header ? m_header->count : 0;
+    }
+
+    bool WriteCodeObjectArchive(std::string const& path, std::vector<std::string> const& files)
+    {
+        // Sorted by name, which find relies on; a name given twice is packed once
+        std::vector<std::pair<std::string, std::string>> named;
+        for(auto const& file : files)
+        {
+            size_t start = file.rfind('/');
+            start        = (start == std::string::npos) ? 0 : start + 1;
+            named.emplace_back(file.substr(start), file);
+        }
+        std::sort(named.begin(), named.end());
+        named.erase(std::unique(named.begin(),
+                                named.end(),
+                                [](auto const& a, auto const& b) { return a.first == b.first; }),
+                    named.end());
+
+        std::vector<CodeObjectArchive::Entry> entries;
+        std::string                           strings;
+        for(auto const& pair : named)
+        {
+            std::ifstream in(pair.second, std::ios::in | std::ios::binary | std::ios::ate);
+            if(!in.is_open())
+                return false;
+
+            uint64_t bytes = in.tellg();
+            entries.push_back({static_cast<uint32_t>(strings.size()), 0, 0, bytes});
+            strings += pair.first;
+            strings += '\0';
+        }
+
+        uint64_t offset = sizeof(CodeObjectArchive::Header)
+                          + entries.size() * sizeof(CodeObjectArchive::Entry) + strings.size();
+        for(auto& entry : entries)
+        {
+            offset       = (offset + ImageAlignment - 1) / ImageAlignment * ImageAlignment;
+            entry.offset = offset;
+            offset += entry.bytes;
+        }
+
+        CodeObjectArchive::Header header{Magic,
+                                         static_cast<uint32_t>(entries.size()),
+                                         static_cast<uint32_t>(strings.size())};
+
+        std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(reinterpret_cast<char const*>(entries.data()),
+                  entries.size() * sizeof(CodeObjectArchive::Entry));
+        out.write(strings.data(), strings.size());
+
+        // The files are copied one at a time, a library need not fit in memory
+        for(size_t i = 0; i < entries.size() && out; i++)
+        {
+            std::ifstream in(named[i].second, std::ios::in | std::ios::binary);
+            out.seekp(entries[i].offset);
+            if(entries[i].bytes > 0)
+                out << in.rdbuf();
+            if(static_cast<uint64_t>(out.tellp()) != entries[i].offset + entries[i].bytes)
+                return false;
+        }
+
+        // Seeking leaves a trailing empty image past the end of the file
+        out.seekp(0, std::ios::end);
+        if(out && static_cast<uint64_t>(out.tellp()) < offset)
+            out << std::string(offset - out.tellp(), '\0');
+        return static_cast<bool>(out);
+    }
+} // namespace TensileLite
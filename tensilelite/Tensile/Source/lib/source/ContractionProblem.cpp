@@ -30,6 +30,7 @@
 #include <Tensile/ContractionSolution.hpp>
 #include <Tensile/Utils.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <cstddef>
 #include <set>
@@ -730,7 +731,7 @@ namespace TensileLite
         AMDGPU const* pAMDGPU = dynamic_cast<AMDGPU const*>(&hardware);
         assert(pAMDGPU != nullptr && pAMDGPU->computeUnitCount != 0);
 
-        size_t cuCount      = pAMDGPU->computeUnitCount;
+        size_t cuCount      = getParams().budgetedCUs(pAMDGPU->computeUnitCount);
         size_t finalPKValue = sizeMapping.persistentKernel;
         if(finalPKValue == -1)
         {
@@ -1545,4 +1546,91 @@ namespace TensileLite
         , metadata(_metadata)
     {
     }
+
+    namespace
+    {
+        size_t roundUpPow2(size_t value)
+        {
+            size_t rv = 1;
+            while(rv < value)
+                rv <<= 1;
+            return value ? rv : 0;
+        }
+    } // namespace
+
+    GroupedGemmShapeKey
+        GroupedGemmShapeKey::FromProblems(std::vector<ContractionProblemGemm> const& problems)
+    {
+        GroupedGemmShapeKey rv;
+        if(problems.empty())
+            return rv;
+
+        auto const& first = problems[0];
+
+        rv.typeHash = hash_combine(first.operationIdentifier(),
+                                   first.a().dataType(),
+                                   first.b().dataType(),
+                                   first.c().dataType(),
+                                   first.d().dataType(),
+                                   first.computeInputType(),
+                                   first.highPrecisionAccumulate(),
+                                   first.kernelLanguage(),
+                                   first.deterministicMode(),
+                                   first.workspaceSize(),
+                                   first.stridedBatched(),
+                                   first.performanceMetric(),
+                                   first.activationType(),
+                                   first.activationComputeType(),
+                                   first.activationNoGuard(),
+                                   first.useGradient(),
+                                   first.useBias(),
+                                   first.biasSrc(),
+                                   first.useE(),
+                                   first.useScaleAB(),
+                                   first.useScaleCD(),
+                                   first.useScaleAlphaVec(),
+                                   first.outputAmaxD(),
+                                   first.f32XdlMathOp());
+        rv.count    = problems.size();
+
+        std::vector<size_t> m(problems.size(), 1);
+        size_t              n = 0, k = 0;
+        rv.sharedN = rv.sharedK = true;
+        for(size_t idx = 0; idx < problems.size(); idx++)
+        {
+            auto const& problem = problems[idx];
+
+            size_t pn = 1, pk = 1, pb = 1;
+            for(size_t i = 0; i < problem.freeIndicesA().size(); i++)
+                m[idx] *= problem.freeSizeA(i);
+            for(size_t i = 0; i < problem.freeIndicesB().size(); i++)
+                pn *= problem.freeSizeB(i);
+            for(size_t i = 0; i < problem.boundIndices().size(); i++)
+                pk *= problem.boundSize(i);
+            for(size_t i = 0; i < problem.batchIndices().size(); i++)
+                pb *= problem.batchSize(i);
+
+            rv.sharedN = rv.sharedN && (idx == 0 || pn == n);
+            rv.sharedK = rv.sharedK && (idx == 0 || pk == k);
+            n          = std::max(n, pn);
+            k          = std::max(k, pk);
+            rv.batch   = std::max(rv.batch, pb);
+        }
+
+        auto median = m.begin() + m.size() / 2;
+        std::nth_element(m.begin(), median, m.end());
+        rv.medianM = roundUpPow2(*median);
+        rv.maxM    = roundUpPow2(*std::max_element(m.begin(), m.end()));
+        rv.n       = rv.sharedN ? n : roundUpPow2(n);
+        rv.k       = rv.sharedK ? k : roundUpPow2(k);
+        rv.batch   = roundUpPow2(rv.batch);
+        return rv;
+    }
+
+    bool GroupedGemmShapeKey::operator==(GroupedGemmShapeKey const& rhs) const
+    {
+        return typeHash == rhs.typeHash && count == rhs.count && maxM == rhs.maxM
+               && medianM == rhs.medianM && n == rhs.n && k == rhs.k && batch == rhs.batch
+               && sharedN == rhs.sharedN && sharedK == rhs.sharedK;
+    }
 } // namespace TensileLite
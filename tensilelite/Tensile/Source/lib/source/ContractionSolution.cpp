@@ -26,10 +26,12 @@
 
 #include <Tensile/ContractionSolution.hpp>
 
+#include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipUtils.hpp>
 
 #include <Tensile/AMDGPU.hpp>
 #include <Tensile/ContractionProblem.hpp>
+#include <Tensile/MLFeatures.hpp>
 #include <Tensile/Utils.hpp>
 
 #include <random>
@@ -37,6 +39,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 
 #ifdef ENABLE_ROCTX
@@ -382,7 +385,7 @@ namespace TensileLite
             arg.activationType = (uint32_t)problems[i].getParams().activationEnum();
         }
 
-        bool debug = Debug::Instance().printKernelArguments();
+        bool debug = DebugInstrumentation && Debug::Instance().printKernelArguments();
         if(debug)
         {
             std::cout << "Grouped gemm argsPtr kernels: " << std::endl;
@@ -647,7 +650,10 @@ namespace TensileLite
                                              Hardware const*                     hardware,
                                              KA&                                 args) const
     {
-        if(debugKernel)
+        // Kernarg preload kernels read the sizes and the A/B/C/D pointers from SGPRs, so nothing
+        // cold may be placed ahead of them
+        bool preloadLayout = internalArgsSupport.kernargPreload > 0;
+        if(debugKernel && !preloadLayout)
         {
             args.template appendUnbound<unsigned int*>("debugBuffer");
         }
@@ -664,6 +670,12 @@ namespace TensileLite
         uint32_t gsu
             = problem.getParams().gsu() > 0 ? problem.getParams().gsu() : sizeMapping.globalSplitU;
 
+        // Only standalone gemm invocations are patched in place, see patchKernelArguments
+        auto markSlot = [&args](KernelArgumentSlot slot) {
+            if constexpr(insertKernelArgs && std::is_same<KA, KernelArguments>::value)
+                args.markSlot(slot);
+        };
+
         {
             int idx = 0;
             for(auto size : problem.problemSizes())
@@ -681,53 +693,70 @@ namespace TensileLite
            && ((singleWSD || sizeMapping.globalAccumulation == 2)
                || (sizeMapping.globalAccumulation == 3)))
         {
+            markSlot(KernelArgumentSlot::Workspace);
             args.template append<void const*>("ws_d", (uint8_t*)inputs.ws + workspaceOffsetInByte);
             if(sizeMapping.globalAccumulation == 3)
             {
+                markSlot(KernelArgumentSlot::C);
                 args.template append<void const*>("c", inputs.c);
             }
             else
             {
+                markSlot(KernelArgumentSlot::Workspace);
                 args.template append<void const*>("ws_c",
                                                   (uint8_t*)inputs.ws + workspaceOffsetInByte);
             }
         }
         else if(problemType.stridedBatched)
         {
+            markSlot(KernelArgumentSlot::D);
             args.template append<void const*>("d", inputs.d);
+            markSlot(KernelArgumentSlot::C);
             args.template append<void const*>("c", inputs.c);
         }
         else
         {
+            markSlot(KernelArgumentSlot::BatchD);
             args.template append<void const* const*>("batchD", inputs.batchD);
+            markSlot(KernelArgumentSlot::BatchC);
             args.template append<void const* const*>("batchC", inputs.batchC);
         }
 
         if(problemType.stridedBatched)
         {
+            markSlot(KernelArgumentSlot::A);
             args.template append<void const*>("a", inputs.a);
+            markSlot(KernelArgumentSlot::B);
             args.template append<void const*>("b", inputs.b);
         }
         else
         {
+            markSlot(KernelArgumentSlot::BatchA);
             args.template append<void const* const*>("batchA", inputs.batchA);
+            markSlot(KernelArgumentSlot::BatchB);
             args.template append<void const* const*>("batchB", inputs.batchB);
         }
 
+        if(debugKernel && preloadLayout)
+            args.template appendUnbound<unsigned int*>("debugBuffer");
+
         if(problemType.sparse)
+        {
+            markSlot(KernelArgumentSlot::Metadata);
             args.template append<unsigned char const*>("metadata", inputs.metadata);
+        }
 
         if(sizeMapping.streamK > 0 && sizeMapping.streamKAtomic == 0)
         {
             // Assert hardware is not null
             // For now grouped gemm is not supported and passes nullptr
             TENSILE_ASSERT_EXC(hardware != nullptr);
-            size_t cuCount = 0;
-            
-            auto   tiles   = problem.getNumTiles(sizeMapping);
-            size_t skGrid  = getSKGrid(problem, *hardware, tiles);
-            // StreamK workspace + flags
+            // StreamK workspace + flags. The flags live in the caller's persistent Synchronizer,
+            // zeroed once when allocated; each launch resets the flags it used before exiting,
+            // so back to back StreamK launches on a stream need no memset in between.
+            markSlot(KernelArgumentSlot::Workspace);
             args.template append<void const*>("ws", inputs.ws);
+            markSlot(KernelArgumentSlot::Synchronizer);
             args.template append<void*>("Flags", inputs.Synchronizer);
         }
 
@@ -780,15 +809,23 @@ namespace TensileLite
                                                metadata.strides()[i]);
         }
 
+        markSlot(KernelArgumentSlot::Alpha);
         args.append("alpha", inputs.alpha, problem.alphaType());
         if(problem.alphaType() == DataType::Half)
+        {
+            markSlot(KernelArgumentSlot::Alpha);
             args.append("alpha_2", inputs.alpha, problem.alphaType());
+        }
 
         if(problemType.useBeta)
         {
+            markSlot(KernelArgumentSlot::Beta);
             args.append("beta", inputs.beta, problem.betaType());
             if(problem.betaType() == DataType::Half)
+            {
+                markSlot(KernelArgumentSlot::Beta);
                 args.append("beta_2", inputs.beta, problem.betaType());
+            }
         }
 
         if constexpr(insertKernelArgs)
@@ -798,17 +835,22 @@ namespace TensileLite
 
         if(!problemType.useScaleAB.empty()) //kernel input data
         {
+            markSlot(KernelArgumentSlot::ScaleA);
             args.template append<void const*>("scaleA", inputs.scaleA);
+            markSlot(KernelArgumentSlot::ScaleB);
             args.template append<void const*>("scaleB", inputs.scaleB);
         }
         if(problemType.useScaleCD) //kernel input data
         {
+            markSlot(KernelArgumentSlot::ScaleC);
             args.template append<void const*>("scaleC", inputs.scaleC);
+            markSlot(KernelArgumentSlot::ScaleD);
             args.template append<void const*>("scaleD", inputs.scaleD);
         }
 
         if(problemType.useScaleAlphaVec) //kernel input data
         {
+            markSlot(KernelArgumentSlot::ScaleAlphaVec);
             args.template append<void const*>("scaleAlphaVec", inputs.scaleAlphaVec);
         }
 
@@ -820,16 +862,21 @@ namespace TensileLite
             // We save the bias data in ws_d
             if(problemType.useGradient && problem.biasSrc() == ContractionProblemGemm::TENSOR::D
                && inputs.bias != nullptr)
+            {
+                markSlot(KernelArgumentSlot::Workspace);
                 args.template append<void const*>("ws_bias",
                                                   (uint8_t*)inputs.ws + workspaceOffsetInByte);
+            }
             else
             {
                 if(problemType.stridedBatched)
                 {
+                    markSlot(KernelArgumentSlot::Bias);
                     args.template append<void const*>("bias", inputs.bias);
                 }
                 else
                 {
+                    markSlot(KernelArgumentSlot::BatchBias);
                     args.template append<void const* const*>("batchBias", inputs.batchBias);
                 }
             }
@@ -858,6 +905,7 @@ namespace TensileLite
 
         if(problemType.useE)
         {
+            markSlot(KernelArgumentSlot::E);
             args.template append<void*>("e", inputs.e);
             for(size_t i = startStrideCD; i < e.dimensions(); i++)
                 args.template append<uint32_t>(concatenate_if<T_Debug>("strideE", i),
@@ -906,9 +954,12 @@ namespace TensileLite
 
         if(problemType.outputAmaxD)
         {
+            markSlot(KernelArgumentSlot::AmaxD);
             args.template append<const void*>("AddrAmaxOut", inputs.amaxD);
+            markSlot(KernelArgumentSlot::Workspace);
             args.template append<const void*>("AmaxWS",
                                               (uint8_t*)inputs.ws + workspaceOffsetInByte);
+            markSlot(KernelArgumentSlot::Synchronizer);
             args.template append<const void*>("AmaxSync", inputs.Synchronizer);
         }
     }
@@ -1112,7 +1163,7 @@ namespace TensileLite
         {
             AMDGPU const* pAMDGPU = dynamic_cast<AMDGPU const*>(&hardware);
             assert(pAMDGPU != nullptr && pAMDGPU->computeUnitCount != 0);
-            cuCount = pAMDGPU->computeUnitCount;
+            cuCount = problem.getParams().budgetedCUs(pAMDGPU->computeUnitCount);
             if(sizeMapping.streamK != 0)
             {
                 skGrid             = getSKGrid(problem, hardware, tiles);
@@ -1124,9 +1175,6 @@ namespace TensileLite
         }
 
         //short-term workaround
-        int             deviceId;
-        hipDeviceProp_t deviceProperties;
-
         auto removePrefix = [](const std::string& s) {
             size_t pos = s.find("gfx");
             if(pos != std::string::npos)
@@ -1136,9 +1184,8 @@ namespace TensileLite
             return s;
         };
 
-        static_cast<void>(hipGetDevice(&deviceId));
-        static_cast<void>(hipGetDeviceProperties(&deviceProperties, deviceId));
-        auto gpu_arch_no_prefix = removePrefix(deviceProperties.gcnArchName);
+        auto const& deviceProperties   = hip::GetCurrentDeviceProperties();
+        auto        gpu_arch_no_prefix = removePrefix(deviceProperties.gcnArchName);
         if(stoi(gpu_arch_no_prefix) / 100 != 12)
         {
             if(internalArgsSupport.version >= 1)
@@ -1163,7 +1210,9 @@ namespace TensileLite
 
         if(sizeMapping.globalAccumulation == 3)
         {
+            rv.args.markSlot(KernelArgumentSlot::D);
             rv.args.append<void const*>("dstD", inputs.d);
+            rv.args.markSlot(KernelArgumentSlot::Synchronizer);
             rv.args.append<void const*>("Synchronizer", inputs.Synchronizer);
             rv.args.append<uint32_t>("GSUSync", 0);
         }
@@ -1349,7 +1398,7 @@ namespace TensileLite
             problems, rv.workGroupSize, rv.numWorkGroups, rv.numWorkItems, h_args);
 
         uint32_t workspaceOffsetInByte
-            = this->requiredHostWorkspaceSizePerProblem * problems.size();
+            = *this->requiredHostWorkspaceSizePerProblem * problems.size();
         if constexpr(!std::is_same<KA, int>::value)
         {
             for(int idx = 0; idx < problems.size(); idx++)
@@ -1412,7 +1461,7 @@ namespace TensileLite
             rv.args.append<void const*>("Synchronizer", (void*)inputs.grouped[0].Synchronizer);
             rv.args.append<void const*>(
                 "Workspace",
-                (uint8_t*)inputs.ws + this->requiredHostWorkspaceSizePerProblem * problems.size());
+                (uint8_t*)inputs.ws + *this->requiredHostWorkspaceSizePerProblem * problems.size());
             rv.codeObjectFile = codeObjectFilename.load();
         }
 
@@ -1566,6 +1615,28 @@ namespace TensileLite
         return rv;
     }
 
+    bool ContractionSolution::needsBetaOnlyCall(Problem const&           problem,
+                                                ContractionInputs const& inputs) const
+    {
+        auto gsu
+            = problem.getParams().gsu() > 0 ? problem.getParams().gsu() : sizeMapping.globalSplitU;
+        if(gsu <= 1 || sizeMapping.globalAccumulation == 2 || sizeMapping.globalAccumulation == 3)
+            return false;
+
+        // Atomic split-k accumulates onto D as it is. With D already holding C the pre-pass
+        // only matters for the bias and scales that it applies.
+        if(sizeMapping.globalAccumulation != 0 || !CompareValue(inputs.beta, 1.0)
+           || problemType.useBias || !problemType.useScaleAB.empty() || problemType.useScaleCD
+           || problemType.useScaleAlphaVec)
+            return true;
+
+        TensorDescriptor const& c = problem.c();
+        TensorDescriptor const& d = problem.d();
+        bool aliased = problemType.stridedBatched ? inputs.c == inputs.d
+                                                  : inputs.batchC == inputs.batchD;
+        return !aliased || c.dataType() != d.dataType() || c.strides() != d.strides();
+    }
+
     std::string ContractionSolution::betaOnlyKernelName(Problem const& problem) const
     {
         std::string name = concatenate(
@@ -1979,7 +2050,7 @@ namespace TensileLite
         }
 
         uint32_t workspaceOffsetInByte
-            = this->requiredHostWorkspaceSizePerProblem * problems.size();
+            = *this->requiredHostWorkspaceSizePerProblem * problems.size();
         for(int idx = 0; idx < problems.size(); idx++)
         {
             auto problem = problems[idx];
@@ -2467,34 +2538,9 @@ namespace TensileLite
         }
     }
 
-    std::vector<KernelInvocation>
-        ContractionSolution::solve(ContractionSolution::Problem const& problem,
-                                   ContractionSolution::Inputs const&  inputs,
-                                   Hardware const&                     hardware) const
+    void ContractionSolution::checkInputs(ContractionSolution::Problem const& problem,
+                                          ContractionSolution::Inputs const&  inputs) const
     {
-        if(Debug::Instance().printWinningKernelName())
-            std::cout << "Running kernel: " << this->KernelName() << std::endl;
-
-        // retreive alpha/beta type set via setAlpha/BetaType()
-        auto alphaType = problem.alphaType();
-        auto betaType  = problem.betaType();
-
-        // TODO: Some gtests are passing the "problem" without actually defining the
-        // alpha/beta type (alphaType and betaType remain None).
-        // Until we fix those gtests, we need to keep this condition to adjust the missing
-        // alpha/beta data types.
-        if(alphaType == DataType::None)
-        {
-            alphaType
-                = problemType.aType == DataType::BFloat16 ? DataType::Float : problemType.dType;
-        }
-        if(betaType == DataType::None)
-        {
-            betaType = alphaType;
-        }
-
-        bool debug = Debug::Instance().printKernelArguments() || this->kernelArgsLog;
-
         int boundSize = 1;
         for(size_t i = 0; i < problem.boundIndices().size(); i++)
             boundSize *= problem.boundSize(i);
@@ -2538,12 +2584,163 @@ namespace TensileLite
         if(problem.cEqualsD() && inputs.c != inputs.d)
             throw std::runtime_error(
                 "ContractionProblemGemm has cEqualsD set, but pointers for c and d are not equal");
+    }
+
+    bool ContractionSolution::patchKernelArguments(std::vector<KernelInvocation>&      kernels,
+                                                   ContractionSolution::Problem const& problem,
+                                                   ContractionSolution::Inputs const&  inputs) const
+    {
+        // A new seed is drawn on every solve
+        if(problemType.stochasticRounding)
+            return false;
+
+        // Whether the beta-only kernel of split-k is launched depends on the pointers, the
+        // kernels can only be kept when the new inputs need it as much as the old ones did
+        bool hadBetaOnlyCall
+            = !kernels.empty() && kernels.front().kernelName == betaOnlyKernelName(problem);
+        if(hadBetaOnlyCall != needsBetaOnlyCall(problem, inputs))
+            return false;
+
+        // Helper kernels (beta-only, output conversion, reduction...) are not marked
+        for(auto const& kernel : kernels)
+        {
+            if(kernel.args.slots().empty())
+                return false;
+        }
+
+        checkInputs(problem, inputs);
+
+        // Same fallback as solve() for problems that leave the alpha/beta types unset
+        auto alphaType = problem.alphaType();
+        auto betaType  = problem.betaType();
+        if(alphaType == DataType::None)
+        {
+            alphaType
+                = problemType.aType == DataType::BFloat16 ? DataType::Float : problemType.dType;
+        }
+        if(betaType == DataType::None)
+        {
+            betaType = alphaType;
+        }
+
+        for(auto& kernel : kernels)
+        {
+            auto& args = kernel.args;
+            for(auto const& slot : args.slots())
+            {
+                size_t offset = slot.second;
+                switch(slot.first)
+                {
+                case KernelArgumentSlot::A:
+                    args.overwrite<void const*>(offset, inputs.a);
+                    break;
+                case KernelArgumentSlot::B:
+                    args.overwrite<void const*>(offset, inputs.b);
+                    break;
+                case KernelArgumentSlot::C:
+                    args.overwrite<void const*>(offset, inputs.c);
+                    break;
+                case KernelArgumentSlot::D:
+                    args.overwrite<void const*>(offset, inputs.d);
+                    break;
+                case KernelArgumentSlot::E:
+                    args.overwrite<void*>(offset, inputs.e);
+                    break;
+                case KernelArgumentSlot::BatchA:
+                    args.overwrite<void const* const*>(offset, inputs.batchA);
+                    break;
+                case KernelArgumentSlot::BatchB:
+                    args.overwrite<void const* const*>(offset, inputs.batchB);
+                    break;
+                case KernelArgumentSlot::BatchC:
+                    args.overwrite<void const* const*>(offset, inputs.batchC);
+                    break;
+                case KernelArgumentSlot::BatchD:
+                    args.overwrite<void* const*>(offset, inputs.batchD);
+                    break;
+                case KernelArgumentSlot::Bias:
+                    args.overwrite<void const*>(offset, inputs.bias);
+                    break;
+                case KernelArgumentSlot::BatchBias:
+                    args.overwrite<void const* const*>(offset, inputs.batchBias);
+                    break;
+                case KernelArgumentSlot::ScaleA:
+                    args.overwrite<void const*>(offset, inputs.scaleA);
+                    break;
+                case KernelArgumentSlot::ScaleB:
+                    args.overwrite<void const*>(offset, inputs.scaleB);
+                    break;
+                case KernelArgumentSlot::ScaleC:
+                    args.overwrite<void const*>(offset, inputs.scaleC);
+                    break;
+                case KernelArgumentSlot::ScaleD:
+                    args.overwrite<void const*>(offset, inputs.scaleD);
+                    break;
+                case KernelArgumentSlot::ScaleAlphaVec:
+                    args.overwrite<void const*>(offset, inputs.scaleAlphaVec);
+                    break;
+                case KernelArgumentSlot::AmaxD:
+                    args.overwrite<void const*>(offset, inputs.amaxD);
+                    break;
+                case KernelArgumentSlot::Metadata:
+                    args.overwrite<unsigned char const*>(offset, inputs.metadata);
+                    break;
+                case KernelArgumentSlot::Workspace:
+                    // Standalone gemms always start at workspace offset 0
+                    args.overwrite<void const*>(offset, inputs.ws);
+                    break;
+                case KernelArgumentSlot::Synchronizer:
+                    args.overwrite<void*>(offset, inputs.Synchronizer);
+                    break;
+                case KernelArgumentSlot::Alpha:
+                    args.overwrite(offset, inputs.alpha, alphaType);
+                    break;
+                case KernelArgumentSlot::Beta:
+                    args.overwrite(offset, inputs.beta, betaType);
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<KernelInvocation>
+        ContractionSolution::solve(ContractionSolution::Problem const& problem,
+                                   ContractionSolution::Inputs const&  inputs,
+                                   Hardware const&                     hardware) const
+    {
+        if(DebugInstrumentation && Debug::Instance().printWinningKernelName())
+            std::cout << "Running kernel: " << this->KernelName() << std::endl;
+
+        // retreive alpha/beta type set via setAlpha/BetaType()
+        auto alphaType = problem.alphaType();
+        auto betaType  = problem.betaType();
+
+        // TODO: Some gtests are passing the "problem" without actually defining the
+        // alpha/beta type (alphaType and betaType remain None).
+        // Until we fix those gtests, we need to keep this condition to adjust the missing
+        // alpha/beta data types.
+        if(alphaType == DataType::None)
+        {
+            alphaType
+                = problemType.aType == DataType::BFloat16 ? DataType::Float : problemType.dType;
+        }
+        if(betaType == DataType::None)
+        {
+            betaType = alphaType;
+        }
+
+        bool debug = (DebugInstrumentation && Debug::Instance().printKernelArguments())
+                     || this->kernelArgsLog;
+
+        checkInputs(problem, inputs);
 
         std::vector<KernelInvocation> rv;
 
         auto gsu
             = problem.getParams().gsu() > 0 ? problem.getParams().gsu() : sizeMapping.globalSplitU;
-        if(gsu > 1 && sizeMapping.globalAccumulation != 2 && sizeMapping.globalAccumulation != 3)
+        if(needsBetaOnlyCall(problem, inputs))
         {
             if(debug)
                 rv.push_back(generateBetaOnlyCall<true>(problem, inputs));
@@ -2602,7 +2799,7 @@ namespace TensileLite
         size_t                                           hipHostMemorySize,
         hipStream_t                                      stream) const
     {
-        if(Debug::Instance().printWinningKernelName())
+        if(DebugInstrumentation && Debug::Instance().printWinningKernelName())
             std::cout << "Running kernel: " << this->KernelName() << std::endl;
 
         // retreive alpha/beta type set via setAlpha/BetaType()
@@ -2623,7 +2820,8 @@ namespace TensileLite
             betaType = alphaType;
         }
 
-        bool debug = Debug::Instance().printKernelArguments() || this->kernelArgsLog;
+        bool debug = (DebugInstrumentation && Debug::Instance().printKernelArguments())
+                     || this->kernelArgsLog;
 
         // Check for nullptrs if alpha is non-zero.
         for(int idx = 0; idx < problems.size(); idx++)
@@ -2673,6 +2871,40 @@ namespace TensileLite
                     "ContractionProblem has cEqualsD set, but pointers for c and d are not equal");
         }
 
+        // The kernel assigns workgroup ids group by group, in argument order. Putting the
+        // problems with the most work first lets the small ones back-fill the CUs while the
+        // tail of a large group finishes. Each group carries its own pointers, so the order
+        // doesn't change the results.
+        std::vector<Problem> scheduledProblems;
+        GroupedInputs        scheduledInputs;
+        if(Debug::Instance().groupedGemmSchedule() == 1 && problems.size() > 1)
+        {
+            std::vector<size_t> work(problems.size());
+            for(size_t idx = 0; idx < problems.size(); idx++)
+                work[idx] = problems[idx].getNumTiles(sizeMapping)
+                            * problems[idx].getItersPerTile(sizeMapping);
+
+            std::vector<size_t> order(problems.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&work](size_t lhs, size_t rhs) {
+                return work[lhs] > work[rhs];
+            });
+
+            if(!std::is_sorted(order.begin(), order.end()))
+            {
+                scheduledProblems.reserve(problems.size());
+                scheduledInputs.grouped.reserve(problems.size());
+                scheduledInputs.ws = inputs.ws;
+                for(auto idx : order)
+                {
+                    scheduledProblems.push_back(problems[idx]);
+                    scheduledInputs.grouped.push_back(inputs.grouped[idx]);
+                }
+            }
+        }
+        auto const& dispatchProblems = scheduledProblems.empty() ? problems : scheduledProblems;
+        auto const& dispatchInputs = scheduledProblems.empty() ? inputs : scheduledInputs;
+
         std::vector<KernelInvocation> rv;
         auto                          h_args = KernelArguments(debug);
         if(hipHostMemory)
@@ -2693,18 +2925,20 @@ namespace TensileLite
         // }
 
         if(debug)
-            rv.push_back(generateSingleCallGroupedGemm<true>(problems, inputs, hardware, h_args));
+            rv.push_back(generateSingleCallGroupedGemm<true>(
+                dispatchProblems, dispatchInputs, hardware, h_args));
         else
-            rv.push_back(generateSingleCallGroupedGemm<false>(problems, inputs, hardware, h_args));
+            rv.push_back(generateSingleCallGroupedGemm<false>(
+                dispatchProblems, dispatchInputs, hardware, h_args));
 
         if(sizeMapping.globalAccumulation == 2 && gsu > 1)
         {
             if(debug)
-                rv.push_back(
-                    generateOutputConversionCallGroupedGemm<true>(problems, inputs, hardware, h_args));
+                rv.push_back(generateOutputConversionCallGroupedGemm<true>(
+                    dispatchProblems, dispatchInputs, hardware, h_args));
             else
-                rv.push_back(
-                    generateOutputConversionCallGroupedGemm<false>(problems, inputs, hardware, h_args));
+                rv.push_back(generateOutputConversionCallGroupedGemm<false>(
+                    dispatchProblems, dispatchInputs, hardware, h_args));
         }
 
         if(debug)
@@ -2743,7 +2977,8 @@ namespace TensileLite
         }
         std::vector<KernelInvocation> rv;
 
-        bool debug = Debug::Instance().printKernelArguments() || this->kernelArgsLog;
+        bool debug = (DebugInstrumentation && Debug::Instance().printKernelArguments())
+                     || this->kernelArgsLog;
 
         // Here we only update the pointer
         int h_args = 1; // Dummy
@@ -2785,11 +3020,25 @@ namespace TensileLite
                && problems[0].activationComputeType() == DataType::Float))
         {
             auto requiredSize = sizeof(DeviceUserArguments<float>) * problems.size();
-            static_cast<void>(hipHostMalloc(dUAHost, requiredSize, 0));
-            setDeviceUserArgs(problems, inputs, (DeviceUserArguments<float>*)(*dUAHost));
-            static_cast<void>(hipMalloc(dUA, requiredSize));
-            static_cast<void>(hipMemcpy(*dUA, *dUAHost, requiredSize, hipMemcpyHostToDevice));
-            static_cast<void>(hipDeviceSynchronize());
+
+            // Stage in the caller's pinned memory when it fits, dUAHost is only owned
+            // (and later released) when it had to be allocated here
+            void* hostArgs = hipHostMemory;
+            *dUAHost       = nullptr;
+            if(!hostArgs || hipHostMemorySize < requiredSize)
+            {
+                int device = 0;
+                HIP_CHECK_EXC(hipStreamGetDevice(stream, &device));
+                HIP_CHECK_EXC(hip::HostMallocNearDevice(dUAHost, requiredSize, device));
+                hostArgs = *dUAHost;
+            }
+            setDeviceUserArgs(problems, inputs, (DeviceUserArguments<float>*)hostArgs);
+
+            // Stream ordered from the device's default memory pool, nothing here waits
+            // for the device
+            HIP_CHECK_EXC(hipMallocAsync(dUA, requiredSize, stream));
+            HIP_CHECK_EXC(
+                hipMemcpyAsync(*dUA, hostArgs, requiredSize, hipMemcpyHostToDevice, stream));
         }
         else
         {
@@ -2799,10 +3048,16 @@ namespace TensileLite
         return solveGroupedGemmGPU(problems, inputs,hardware, *dUA, inputs.ws, stream);
     }
 
-    void ContractionSolution::relaseDeviceUserArgs(void* dUA, void* dUAHost)
+    void ContractionSolution::relaseDeviceUserArgs(void* dUA, void* dUAHost, hipStream_t stream)
     {
-        static_cast<void>(hipFree(dUA));
-        static_cast<void>(hipFree(dUAHost));
+        if(dUA)
+            static_cast<void>(hipFreeAsync(dUA, stream));
+        if(dUAHost)
+        {
+            // The staging copy may still be queued on the stream
+            static_cast<void>(hipStreamSynchronize(stream));
+            static_cast<void>(hipHostFree(dUAHost));
+        }
     }
 
     ContractionSolution::StaticPerformanceModel
@@ -2890,6 +3145,27 @@ namespace TensileLite
                 }
                 pass = false;
             }
+            // StreamK is compiled into the kernel, so tuning can only pick among StreamK solutions
+            if(gemmProblem->getParams().streamK() != 0
+               && gemmProblem->getParams().streamK() != sizeMapping.streamK)
+            {
+                if(debug)
+                {
+                    stream << "This solution does not use StreamK mode "
+                           << int(gemmProblem->getParams().streamK()) << "." << std::endl;
+                }
+                pass = false;
+            }
+            if(gemmProblem->getParams().skGridFraction() != 0.0f
+               && (sizeMapping.streamK == 0 || gemmProblem->getParams().skGridFraction() < 0.0f))
+            {
+                if(debug)
+                {
+                    stream << "This solution does not support a custom StreamK grid size."
+                           << std::endl;
+                }
+                pass = false;
+            }
         }
         else if(auto groupedProblem = dynamic_cast<ContractionProblemGroupedGemm const*>(&problem))
         {
@@ -3021,15 +3297,35 @@ namespace TensileLite
         return h_args.size();
     }
 
+    size_t ContractionSolution::requiredSynchronizerSize(Problem const& problem) const
+    {
+        bool usesSynchronizer = problemType.outputAmaxD || sizeMapping.globalAccumulation == 3
+                                || (sizeMapping.streamK > 0 && sizeMapping.streamKAtomic == 0);
+        if(!usesSynchronizer)
+            return 0;
+
+        // SynchronizerSizeCheck bounds every gemm to SynchronizerFlagsPerGemm flags and grouped
+        // gemms to SynchronizerMaxGroups gemms.
+        size_t gemms = problemType.groupedGemm ? SynchronizerMaxGroups : 1;
+        return gemms * SynchronizerFlagsPerGemm * sizeof(int);
+    }
+
     size_t ContractionSolution::getSKGrid(Problem const&  problem, Hardware const& hardware, size_t tiles) const
     {
         AMDGPU const* pAMDGPU = dynamic_cast<AMDGPU const*>(&hardware);
 
         assert(pAMDGPU != nullptr && pAMDGPU->computeUnitCount != 0);
-        size_t cuCount = pAMDGPU->computeUnitCount;
+        size_t cuCount = problem.getParams().budgetedCUs(pAMDGPU->computeUnitCount);
+
+        // Grid size requested through the tuning parameters, as a fraction of the CUs in budget.
+        if(problem.getParams().skGridFraction() > 0.0f)
+        {
+            size_t grid = std::lround(problem.getParams().skGridFraction() * cuCount);
+            return std::max<size_t>(grid, 1);
+        }
 
         // User-specified grid size for Stream-K kernel.
-        if(pAMDGPU->skFixedGrid > 0)
+        else if(pAMDGPU->skFixedGrid > 0)
         {
             return pAMDGPU->skFixedGrid;
         }
@@ -3118,6 +3414,79 @@ namespace TensileLite
         }
     }
 
+    uint16_t ContractionSolution::autoGSU(Problem const& problem, Hardware const& hardware) const
+    {
+        if(!internalArgsSupport.gsu || sizeMapping.streamK != 0 || problemType.groupedGemm)
+            return 0;
+
+        AMDGPU const* pAMDGPU = dynamic_cast<AMDGPU const*>(&hardware);
+        if(pAMDGPU == nullptr || pAMDGPU->computeUnitCount == 0)
+            return 0;
+
+        size_t cuCount = problem.getParams().budgetedCUs(pAMDGPU->computeUnitCount);
+        size_t tiles   = problem.getNumTiles(sizeMapping);
+        if(tiles == 0 || tiles >= cuCount)
+            return 0;
+
+        // Every split keeps at least a few iterations of the unrolled loop, and the kernel
+        // argument holds at most 255
+        constexpr size_t minItersPerSplit = 4;
+        size_t           iters            = problem.getItersPerTile(sizeMapping);
+        size_t           gsu              = std::min<size_t>(
+            {CeilDivide(cuCount, tiles), std::max<size_t>(iters / minItersPerSplit, 1), 255});
+
+        // Partials in workspace grow with the split, back off until they fit
+        Problem tuned = problem;
+        for(; gsu > 1; gsu--)
+        {
+            tuned.setParams().setGSU(gsu);
+            if(requiredWorkspaceSize(tuned, hardware) <= problem.workspaceSize())
+                break;
+        }
+        return gsu;
+    }
+
+    int16_t ContractionSolution::autoWGM(Problem const& problem, Hardware const& hardware) const
+    {
+        if(!internalArgsSupport.wgm || sizeMapping.streamK != 0 || problemType.groupedGemm
+           || sizeMapping.workGroupMapping < 0)
+            return 0;
+
+        AMDGPU const* pAMDGPU = dynamic_cast<AMDGPU const*>(&hardware);
+        if(pAMDGPU == nullptr || pAMDGPU->computeUnitCount == 0 || pAMDGPU->l2CacheSize == 0)
+            return 0;
+
+        size_t tiles0 = CeilDivide(problem.freeSizeA(0), sizeMapping.macroTile.x);
+        size_t tiles1 = CeilDivide(problem.freeSizeB(0), sizeMapping.macroTile.y);
+        size_t wave   = problem.getParams().budgetedCUs(pAMDGPU->computeUnitCount);
+        if(tiles0 * tiles1 <= wave)
+            return 0;
+
+        // A group of wgm workgroups spans wgm tiles of dim 1 and the wave walks dim 0 within
+        // it, so a wave reads the K panels of ceil(wave / wgm) tiles of A and wgm tiles of B
+        size_t bytesA    = DataTypeInfo::Get(problem.a().dataType()).elementSize;
+        size_t bytesB    = DataTypeInfo::Get(problem.b().dataType()).elementSize;
+        size_t k         = problem.boundSize(0);
+        auto   footprint = [&](size_t wgm) {
+            size_t wgm1 = std::min(std::max<size_t>(wgm, 1), tiles1);
+            size_t wgm0 = std::min(CeilDivide(wave, wgm1), tiles0);
+            return k * (wgm0 * sizeMapping.macroTile.x * bytesA
+                        + wgm1 * sizeMapping.macroTile.y * bytesB);
+        };
+
+        if(footprint(sizeMapping.workGroupMapping) <= pAMDGPU->l2CacheSize)
+            return 0;
+
+        // The power of two with the smallest footprint, problem params hold at most 255
+        size_t best = 1;
+        for(size_t wgm = 2; wgm <= std::min<size_t>(tiles1, 255); wgm *= 2)
+        {
+            if(footprint(wgm) < footprint(best))
+                best = wgm;
+        }
+        return best == size_t(std::max(sizeMapping.workGroupMapping, 1)) ? 0 : int16_t(best);
+    }
+
     size_t ContractionSolution::partialTileSize(size_t skGrid) const
     {
         size_t size = 0;
@@ -3276,6 +3645,73 @@ namespace TensileLite
         return pp;
     }
 
+    double ContractionSolution::predictedTime(Problem const& problem, Hardware const& hardware) const
+    {
+        AMDGPU const* pAMDGPU = dynamic_cast<AMDGPU const*>(&hardware);
+        if(!pAMDGPU || pAMDGPU->computeUnitCount == 0)
+            return 0.0;
+
+        // Flops per byte above which a CU is compute bound, assuming the A/B streams
+        // mostly hit in L2. Times are expressed in flops of a single CU.
+        constexpr double ridgeFlopsPerByte = 64.0;
+
+        double NumBatches = 1;
+        for(size_t i = 0; i < problem.batchIndices().size(); i++)
+            NumBatches *= problem.batchSize(i);
+
+        double K = 1;
+        for(size_t i = 0; i < problem.boundIndices().size(); i++)
+            K *= problem.boundSize(i);
+
+        double MT0    = sizeMapping.macroTile.x;
+        double MT1    = sizeMapping.macroTile.y;
+        double GSU    = std::max<size_t>(sizeMapping.globalSplitU, 1);
+        double DU     = std::max<size_t>(sizeMapping.depthU, 1);
+        double NumCUs = pAMDGPU->computeUnitCount;
+        double waves  = ceil(static_cast<double>(sizeMapping.workGroupSize.x
+                                                * sizeMapping.workGroupSize.y
+                                                * sizeMapping.workGroupSize.z)
+                            / pAMDGPU->wavefrontSize);
+
+        MLFeatures::WaveGranularityScaleFactors factors;
+        factors.cuFactors.mt0Scale = 1.0 / MT0;
+        factors.cuFactors.mt1Scale = 1.0 / MT1;
+        factors.cuFactors.cuScale  = NumBatches * GSU / NumCUs;
+        factors.waveScale          = waves / pAMDGPU->simdPerCu;
+
+        // Workgroups with fewer waves than a CU has SIMDs share the CU, so tiles retire
+        // in rounds of several workgroups. Stream-K spreads the iterations evenly.
+        double tilesPerCU = MLFeatures::tilesPerCU(problem, factors.cuFactors);
+        double occupancy  = std::min(1.0, static_cast<double>(factors.waveScale));
+        double rounds     = sizeMapping.streamK ? tilesPerCU
+                                            : ceil(tilesPerCU * occupancy) / occupancy;
+
+        auto aInfo = DataTypeInfo::Get(problemType.aType);
+        auto bInfo = DataTypeInfo::Get(problemType.bType);
+        auto dInfo = DataTypeInfo::Get(problemType.dType);
+
+        double partialSize = std::max<size_t>(sizeMapping.workspaceSizePerElemC, dInfo.elementSize);
+        double outputSize  = GSU > 1 ? partialSize : dInfo.elementSize;
+
+        double tileK     = ceil(K / GSU / DU) * DU;
+        double tileFlops = 2.0 * MT0 * MT1 * tileK;
+        double tileBytes = (MT0 * aInfo.elementSize + MT1 * bInfo.elementSize) * tileK;
+        double tileTime  = std::max(tileFlops, tileBytes * ridgeFlopsPerByte)
+                          + MT0 * MT1 * outputSize * ridgeFlopsPerByte;
+
+        double time = rounds * tileTime;
+
+        // Global accumulation reduces the partial tiles in a separate pass over D
+        if(GSU > 1 && sizeMapping.globalAccumulation && sizeMapping.streamK == 0)
+        {
+            double elements = NumBatches * problem.freeSizeA(0) * problem.freeSizeB(0);
+            time += elements * (GSU * partialSize + dInfo.elementSize) * ridgeFlopsPerByte
+                    / NumCUs;
+        }
+
+        return time;
+    }
+
     ContractionSolution::TAMetricProblemScore ContractionSolution::computeProblemScore(
         Hardware const& hardware, double M, double N, double K, double NumBatches) const
     {
@@ -3383,6 +3819,72 @@ namespace TensileLite
         return distance;
     }
 
+    namespace
+    {
+        // Heap bytes of a string, 0 for the short ones stored inline
+        size_t heapBytes(std::string const& value)
+        {
+            return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+        }
+
+        template <typename Object>
+        void addPredicate(Predicates::Predicate<Object> const* predicate,
+                          SolutionHostMemory&                  usage)
+        {
+            if(!predicate)
+                return;
+
+            usage.predicateRefs++;
+            if(!usage.seen.insert(predicate).second)
+                return;
+            usage.predicates++;
+
+            if(auto const* p = dynamic_cast<Predicates::And<Object> const*>(predicate))
+                for(auto const& term : p->value)
+                    addPredicate(term.get(), usage);
+            else if(auto const* p = dynamic_cast<Predicates::Or<Object> const*>(predicate))
+                for(auto const& term : p->value)
+                    addPredicate(term.get(), usage);
+            else if(auto const* p = dynamic_cast<Predicates::Not<Object> const*>(predicate))
+                addPredicate(p->value.get(), usage);
+        }
+    } // namespace
+
+    void ContractionSolution::addHostMemory(SolutionHostMemory& usage) const
+    {
+        usage.solutions++;
+        usage.solutionBytes += sizeof(*this);
+        usage.nameBytes += heapBytes(kernelName) + heapBytes(solutionName);
+        usage.stringBytes
+            += heapBytes(sizeMapping.customKernelName) + heapBytes(problemType.useScaleAB);
+        usage.vectorBytes += problemType.biasSrcWhiteList.capacity() * sizeof(int)
+                             + problemType.biasDataTypeWhiteList.capacity() * sizeof(DataType);
+        // A red-black tree node holds three pointers and the color next to the value
+        usage.vectorBytes
+            += ideals.size() * (4 * sizeof(void*) + sizeof(decltype(ideals)::value_type));
+
+        addPredicate(problemPredicate.get(), usage);
+        addPredicate(hardwarePredicate.get(), usage);
+    }
+
+    std::ostream& operator<<(std::ostream& stream, SolutionHostMemory const& usage)
+    {
+        auto kib = [](size_t bytes) { return (bytes + 1023) / 1024; };
+
+        return stream << "  solutions:        " << usage.solutions << ", "
+                      << kib(usage.solutionBytes) << " KiB (" << sizeof(ContractionSolution)
+                      << " bytes each, SizeMapping " << sizeof(SizeMapping)
+                      << ", ProblemType " << sizeof(ContractionSolution::ProblemType) << ")"
+                      << std::endl
+                      << "  kernel names:     " << kib(usage.nameBytes) << " KiB" << std::endl
+                      << "  other strings:    " << kib(usage.stringBytes) << " KiB" << std::endl
+                      << "  vectors and maps: " << kib(usage.vectorBytes) << " KiB" << std::endl
+                      << "  predicates:       " << usage.predicates << " objects for "
+                      << usage.predicateRefs << " references" << std::endl
+                      << "  interned strings: " << InternedString::PoolSize() << ", "
+                      << kib(InternedString::PoolBytes()) << " KiB, process-wide" << std::endl;
+    }
+
     std::ostream& operator<<(std::ostream&                                      stream,
                              ContractionSolution::StaticPerformanceModel const& spm)
     {
@@ -26,7 +26,15 @@
 
 #include <Tensile/Debug.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
 #include <mutex>
+#include <vector>
 
 #ifndef DEBUG_SM
 #define DEBUG_SM 0
@@ -40,6 +48,83 @@ namespace TensileLite
 {
     std::once_flag debug_init;
 
+    namespace
+    {
+        struct PhaseStats
+        {
+            size_t calls   = 0;
+            double seconds = 0.0;
+            size_t bytes   = 0;
+        };
+
+        struct PhaseFrame
+        {
+            const char*                           name;
+            std::string                           path;
+            size_t                                bytes;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        struct PhaseTable
+        {
+            std::mutex                        mutex;
+            std::map<std::string, PhaseStats> phases;
+            std::map<std::string, PhaseStats> files;
+            std::atomic<bool>                 printed{false};
+        };
+
+        // Never destroyed, phases are still marked while other statics are torn down
+        PhaseTable& phaseTable()
+        {
+            static PhaseTable* table = new PhaseTable;
+            return *table;
+        }
+
+        thread_local std::vector<PhaseFrame> phaseStack;
+
+        // Files listed in the report, the slowest first
+        constexpr size_t MaxPrintedFiles = 20;
+
+        void printPhaseTable(const char* when)
+        {
+            auto& table = phaseTable();
+            if(table.printed.exchange(true))
+                return;
+
+            std::lock_guard<std::mutex> lock(table.mutex);
+
+            auto print = [](std::string const& name, PhaseStats const& stats) {
+                std::cerr << "  " << std::left << std::setw(48) << name << std::right
+                          << std::setw(8) << stats.calls << std::setw(12) << std::fixed
+                          << std::setprecision(3) << stats.seconds * 1e3 << std::setw(12)
+                          << std::setprecision(3) << stats.bytes / double(1 << 20) << std::endl;
+            };
+
+            // Phases include the time of the phases nested in them
+            std::cerr << "Tensile phase profile at " << when << ":" << std::endl;
+            std::cerr << "  " << std::left << std::setw(48) << "phase" << std::right
+                      << std::setw(8) << "calls" << std::setw(12) << "ms" << std::setw(12) << "MiB"
+                      << std::endl;
+            for(auto const& phase : table.phases)
+                print(phase.first, phase.second);
+
+            std::vector<std::pair<std::string, PhaseStats>> files(table.files.begin(),
+                                                                  table.files.end());
+            std::sort(files.begin(), files.end(), [](auto const& a, auto const& b) {
+                return a.second.seconds > b.second.seconds;
+            });
+
+            std::cerr << "  " << std::left << std::setw(48) << "file" << std::right
+                      << std::setw(8) << "calls" << std::setw(12) << "ms" << std::setw(12) << "MiB"
+                      << std::endl;
+            for(size_t i = 0; i < std::min(files.size(), MaxPrintedFiles); i++)
+                print(files[i].first, files[i].second);
+            if(files.size() > MaxPrintedFiles)
+                std::cerr << "  ... " << files.size() - MaxPrintedFiles << " more files"
+                          << std::endl;
+        }
+    } // namespace
+
     bool Debug::printPropertyEvaluation() const
     {
         return m_value & (0x2 | 0x4);
@@ -165,6 +250,115 @@ namespace TensileLite
         return m_gridbasedBatchExp;
     }
 
+    int Debug::cacheMapMode() const
+    {
+        return m_cacheMapMode;
+    }
+
+    size_t Debug::cacheMapCapacity() const
+    {
+        return m_cacheMapCapacity;
+    }
+
+    int Debug::groupedGemmSchedule() const
+    {
+        return m_groupedGemmSchedule;
+    }
+
+    bool Debug::groupedGemmShapeCache() const
+    {
+        return m_groupedGemmShapeCache;
+    }
+
+    bool Debug::predicateMemo() const
+    {
+        return m_predicateMemo;
+    }
+
+    bool Debug::analyticRanking() const
+    {
+        return m_analyticRanking;
+    }
+
+    bool Debug::flatSelection() const
+    {
+        return m_flatSelection;
+    }
+
+    bool Debug::printMemoryReport() const
+    {
+        return m_printMemoryReport;
+    }
+
+    std::string Debug::sharedCacheName() const
+    {
+        return m_sharedCacheName;
+    }
+
+    size_t Debug::sharedCacheCapacity() const
+    {
+        return m_sharedCacheCapacity;
+    }
+
+    size_t Debug::lazyPrefetchThreads() const
+    {
+        return m_lazyPrefetchThreads;
+    }
+
+    size_t Debug::codeObjectBudget() const
+    {
+        return m_codeObjectBudget;
+    }
+
+    bool Debug::phaseProfile() const
+    {
+        return m_phaseProfile;
+    }
+
+    void Debug::phaseStart(const char* name, const std::string* path) const
+    {
+        PhaseFrame frame{name, path ? *path : std::string(), 0, {}};
+        if(path)
+        {
+            auto bytes  = std::ifstream(*path, std::ios::binary | std::ios::ate).tellg();
+            frame.bytes = bytes > 0 ? static_cast<size_t>(bytes) : 0;
+        }
+        frame.start = std::chrono::steady_clock::now();
+        phaseStack.push_back(std::move(frame));
+    }
+
+    void Debug::phaseStop() const
+    {
+        if(phaseStack.empty())
+            return;
+
+        auto   end     = std::chrono::steady_clock::now();
+        auto   frame   = std::move(phaseStack.back());
+        double seconds = std::chrono::duration<double>(end - frame.start).count();
+        phaseStack.pop_back();
+
+        auto&                       table = phaseTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto& phase = table.phases[frame.name];
+        phase.calls++;
+        phase.seconds += seconds;
+        phase.bytes += frame.bytes;
+
+        if(!frame.path.empty())
+        {
+            auto& file = table.files[frame.path];
+            file.calls++;
+            file.seconds += seconds;
+            file.bytes += frame.bytes;
+        }
+    }
+
+    void Debug::printPhases(const char* when) const
+    {
+        printPhaseTable(when);
+    }
+
     Debug::Debug()
         : m_value(DEBUG_SM)
         , m_value2(DEBUG_SM2)
@@ -217,6 +411,62 @@ namespace TensileLite
         if(tensile_gridbased_batch_exp)
             m_gridbasedBatchExp = strtol(tensile_gridbased_batch_exp, nullptr, 0) != 0;
 
+        const char* cache_map_mode = std::getenv("TENSILE_CACHE_MAP_MODE");
+        if(cache_map_mode)
+            m_cacheMapMode = strtol(cache_map_mode, nullptr, 0);
+
+        const char* cache_map_capacity = std::getenv("TENSILE_CACHE_MAP_CAPACITY");
+        if(cache_map_capacity)
+            m_cacheMapCapacity = strtoul(cache_map_capacity, nullptr, 0);
+
+        const char* grouped_gemm_schedule = std::getenv("TENSILE_GROUPED_GEMM_SCHEDULE");
+        if(grouped_gemm_schedule)
+            m_groupedGemmSchedule = strtol(grouped_gemm_schedule, nullptr, 0);
+
+        const char* grouped_gemm_shape_cache = std::getenv("TENSILE_GROUPED_GEMM_SHAPE_CACHE");
+        if(grouped_gemm_shape_cache)
+            m_groupedGemmShapeCache = strtol(grouped_gemm_shape_cache, nullptr, 0) != 0;
+
+        const char* predicate_memo = std::getenv("TENSILE_PREDICATE_MEMO");
+        if(predicate_memo)
+            m_predicateMemo = strtol(predicate_memo, nullptr, 0) != 0;
+
+        const char* analytic_ranking = std::getenv("TENSILE_ANALYTIC_RANKING");
+        if(analytic_ranking)
+            m_analyticRanking = strtol(analytic_ranking, nullptr, 0) != 0;
+
+        const char* flat_selection = std::getenv("TENSILE_FLAT_SELECTION");
+        if(flat_selection)
+            m_flatSelection = strtol(flat_selection, nullptr, 0) != 0;
+
+        const char* memory_report = std::getenv("TENSILE_MEMORY_REPORT");
+        if(memory_report)
+            m_printMemoryReport = strtol(memory_report, nullptr, 0) != 0;
+
+        const char* shared_cache = std::getenv("TENSILE_SHARED_CACHE");
+        if(shared_cache)
+            m_sharedCacheName = shared_cache;
+
+        const char* shared_cache_capacity = std::getenv("TENSILE_SHARED_CACHE_CAPACITY");
+        if(shared_cache_capacity)
+            m_sharedCacheCapacity = strtoul(shared_cache_capacity, nullptr, 0);
+
+        const char* lazy_prefetch_threads = std::getenv("TENSILE_LAZY_PREFETCH_THREADS");
+        if(lazy_prefetch_threads)
+            m_lazyPrefetchThreads = strtoul(lazy_prefetch_threads, nullptr, 0);
+
+        const char* code_object_budget = std::getenv("TENSILE_CODE_OBJECT_BUDGET");
+        if(code_object_budget)
+            m_codeObjectBudget = strtoul(code_object_budget, nullptr, 0);
+
+        const char* phase_profile = std::getenv("TENSILE_PHASE_PROFILE");
+        if(phase_profile && strtol(phase_profile, nullptr, 0) != 0)
+        {
+            m_phaseProfile = true;
+            // Printed by the first matmul unless the process never ran one
+            std::atexit([] { printPhaseTable("exit"); });
+        }
+
         const char* tensile_marker = std::getenv("TENSILE_ENABLE_MARKER");
         if(tensile_marker)
         {
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <Tensile/LibraryPrefetcher.hpp>
+
+#include <Tensile/Debug.hpp>
+
+namespace TensileLite
+{
+    LibraryPrefetcher::LibraryPrefetcher()
+        : m_threadCount(Debug::Instance().lazyPrefetchThreads())
+    {
+    }
+
+    LibraryPrefetcher::~LibraryPrefetcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+            // Tasks that did not start are dropped, their futures report a broken promise
+            m_tasks.clear();
+        }
+        m_cv.notify_all();
+
+        for(auto& thread : m_threads)
+            thread.join();
+    }
+
+    std::future<void> LibraryPrefetcher::enqueue(std::function<void()> task)
+    {
+        std::packaged_task<void()> packaged(std::move(task));
+        auto                       rv = packaged.get_future();
+
+        if(m_threadCount == 0)
+        {
+            packaged();
+            return rv;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Threads are started by the first task so that a process that never
+            // prefetches does not pay for them
+            if(m_threads.empty())
+                start();
+            m_tasks.push_back(std::move(packaged));
+        }
+        m_cv.notify_one();
+
+        return rv;
+    }
+
+    void LibraryPrefetcher::start()
+    {
+        for(size_t i = 0; i < m_threadCount; i++)
+            m_threads.emplace_back(&LibraryPrefetcher::run, this);
+    }
+
+    void LibraryPrefetcher::run()
+    {
+        while(true)
+        {
+            std::packaged_task<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                if(m_stop)
+                    return;
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            // A failed load leaves the library unloaded, the first lookup retries it
+            task();
+        }
+    }
+} // namespace TensileLite
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <Tensile/SharedSelectionCache.hpp>
+
+#include <Tensile/Debug.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace TensileLite
+{
+    namespace
+    {
+        // "TSSC" and the layout version, bump when Header or Entry change
+        constexpr uint64_t Magic = 0x5453534300000001ull;
+
+        // Slots probed per key before giving up
+        constexpr size_t MaxProbes = 16;
+
+        // How long a process that opens an existing object waits for its creator
+        // to size and initialize it
+        constexpr auto InitTimeout = std::chrono::seconds(1);
+
+        uint64_t mix(SharedSelectionKey const& key)
+        {
+            uint64_t x = key.problem ^ (key.context * 0x9e3779b97f4a7c15ull);
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+    } // namespace
+
+    struct SharedSelectionCache::Header
+    {
+        std::atomic<uint64_t> magic; // Stored last by the creator
+        uint64_t              capacity;
+        std::atomic<uint64_t> size;
+        uint64_t              reserved[5];
+    };
+
+    struct SharedSelectionCache::Entry
+    {
+        std::atomic<uint32_t> state;
+        uint32_t              count;
+        uint64_t              problem;
+        uint64_t              context;
+        double                fitness;
+        int32_t               indices[MaxIndices];
+    };
+
+    static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t)
+                      && std::atomic<uint64_t>::is_always_lock_free
+                      && std::atomic<uint32_t>::is_always_lock_free,
+                  "shared memory atomics must be address free");
+
+    SharedSelectionCache::SharedSelectionCache()
+    {
+        auto name = Debug::Instance().sharedCacheName();
+        if(!name.empty() && !map(name, Debug::Instance().sharedCacheCapacity()))
+            std::cerr << "Tensile: cannot map shared selection cache " << name << std::endl;
+    }
+
+    SharedSelectionCache::~SharedSelectionCache()
+    {
+        // The object outlives the process on purpose, remove it from /dev/shm to reset
+        if(m_header)
+            munmap(m_header, m_bytes);
+    }
+
+    bool SharedSelectionCache::map(std::string const& name, size_t capacity)
+    {
+        if(capacity == 0)
+            return false;
+
+        std::string path = name[0] == '/' ? name : "/" + name;
+
+        bool created = true;
+        int  fd      = shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if(fd < 0 && errno == EEXIST)
+        {
+            created = false;
+            fd      = shm_open(path.c_str(), O_RDWR, 0600);
+        }
+        if(fd < 0)
+            return false;
+
+        auto   deadline = std::chrono::steady_clock::now() + InitTimeout;
+        size_t bytes    = sizeof(Header) + capacity * sizeof(Entry);
+        if(created)
+        {
+            // Zero filled, so every entry starts Empty
+            if(ftruncate(fd, bytes) != 0)
+            {
+                close(fd);
+                shm_unlink(path.c_str());
+                return false;
+            }
+        }
+        else
+        {
+            struct stat st;
+            while(fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) < sizeof(Header)
+                  && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            bytes = st.st_size;
+            if(bytes < sizeof(Header))
+            {
+                close(fd);
+                return false;
+            }
+        }
+
+        void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if(ptr == MAP_FAILED)
+            return false;
+
+        auto header = static_cast<Header*>(ptr);
+        if(created)
+        {
+            header->capacity = capacity;
+            header->size.store(0, std::memory_order_relaxed);
+            header->magic.store(Magic, std::memory_order_release);
+        }
+        else
+        {
+            while(header->magic.load(std::memory_order_acquire) != Magic
+                  && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            // Created by an incompatible library, or never initialized
+            if(header->magic.load(std::memory_order_acquire) != Magic
+               || sizeof(Header) + header->capacity * sizeof(Entry) > bytes)
+            {
+                munmap(ptr, bytes);
+                return false;
+            }
+            capacity = header->capacity;
+        }
+
+        m_header   = header;
+        m_entries  = reinterpret_cast<Entry*>(header + 1);
+        m_capacity = capacity;
+        m_bytes    = bytes;
+        return true;
+    }
+
+    size_t SharedSelectionCache::find(SharedSelectionKey const& key,
+                                      int*                      indices,
+                                      size_t                    maxCount,
+                                      double*                   fitness) const
+    {
+        if(!m_entries)
+            return 0;
+
+        size_t slot = mix(key) % m_capacity;
+        for(size_t i = 0; i < std::min(MaxProbes, m_capacity); i++, slot = (slot + 1) % m_capacity)
+        {
+            auto const& entry = m_entries[slot];
+            auto        state = entry.state.load(std::memory_order_acquire);
+            if(state == Empty)
+                break;
+            if(state != Ready || entry.problem != key.problem || entry.context != key.context)
+                continue;
+
+            size_t count = std::min<size_t>(entry.count, maxCount);
+            std::copy(entry.indices, entry.indices + count, indices);
+            if(fitness)
+                *fitness = entry.fitness;
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return count;
+        }
+
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    void SharedSelectionCache::add(SharedSelectionKey const& key,
+                                   int const*                indices,
+                                   size_t                    count,
+                                   double                    fitness)
+    {
+        if(!m_entries || count == 0)
+            return;
+
+        size_t slot = mix(key) % m_capacity;
+        for(size_t i = 0; i < std::min(MaxProbes, m_capacity); i++, slot = (slot + 1) % m_capacity)
+        {
+            auto& entry = m_entries[slot];
+            auto  state = entry.state.load(std::memory_order_acquire);
+            if(state == Empty
+               && entry.state.compare_exchange_strong(state, Writing, std::memory_order_acq_rel))
+            {
+                entry.count   = std::min(count, MaxIndices);
+                entry.problem = key.problem;
+                entry.context = key.context;
+                entry.fitness = fitness;
+                std::copy(indices, indices + entry.count, entry.indices);
+                entry.state.store(Ready, std::memory_order_release);
+
+                m_header->size.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            // Lost the slot to another writer, or it is taken; a concurrent writer of
+            // the same key may leave a duplicate further on, which is harmless
+            if(state == Ready && entry.problem == key.problem && entry.context == key.context)
+                return;
+        }
+    }
+
+    size_t SharedSelectionCache::size() const
+    {
+        return m_header ? m_header->size.load(std::memory_order_relaxed) : 0;
+    }
+} // namespace TensileLite
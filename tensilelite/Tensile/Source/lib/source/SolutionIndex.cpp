@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <Tensile/SolutionIndex.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TensileLite
+{
+    namespace
+    {
+        // "TSXI" and the layout version, bump when Header or Entry change
+        constexpr uint64_t Magic = 0x5453584900000001ull;
+    } // namespace
+
+    // The image is a Header, count Entry sorted by index, then stringBytes of
+    // NUL-terminated file prefixes that entries refer to by offset
+    struct SolutionIndexFile::Header
+    {
+        uint64_t magic;
+        uint32_t count;
+        uint32_t stringBytes;
+    };
+
+    struct SolutionIndexFile::Entry
+    {
+        int32_t  index;
+        uint32_t nameOffset;
+    };
+
+    std::shared_ptr<SolutionIndexFile> SolutionIndexFile::Open(std::string const& path)
+    {
+        std::shared_ptr<SolutionIndexFile> rv(new SolutionIndexFile);
+
+#ifndef WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return nullptr;
+
+        struct stat st;
+        if(fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header))
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if(ptr == MAP_FAILED)
+            return nullptr;
+
+        rv->m_data = ptr;
+        rv->m_size = st.st_size;
+#else
+        std::ifstream in(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if(!in.is_open() || static_cast<size_t>(in.tellg()) < sizeof(Header))
+            return nullptr;
+
+        rv->m_size = in.tellg();
+        rv->m_data = new char[rv->m_size];
+        in.seekg(0);
+        if(!in.read(static_cast<char*>(rv->m_data), rv->m_size))
+            return nullptr;
+#endif
+
+        auto bytes  = static_cast<char const*>(rv->m_data);
+        auto header = reinterpret_cast<Header const*>(bytes);
+        if(header->magic != Magic
+           || sizeof(Header) + header->count * sizeof(Entry) + header->stringBytes > rv->m_size
+           || (header->stringBytes > 0 && bytes[rv->m_size - 1] != '\0'))
+            return nullptr;
+
+        rv->m_header  = header;
+        rv->m_entries = reinterpret_cast<Entry const*>(header + 1);
+        rv->m_strings = reinterpret_cast<char const*>(rv->m_entries + header->count);
+        return rv;
+    }
+
+    SolutionIndexFile::~SolutionIndexFile()
+    {
+#ifndef WIN32
+        if(m_data)
+            munmap(m_data, m_size);
+#else
+        delete[] static_cast<char*>(m_data);
+#endif
+    }
+
+    char const* SolutionIndexFile::find(int index) const
+    {
+        auto end  = m_entries + size();
+        auto iter = std::lower_bound(m_entries, end, index, [](Entry const& e, int value) {
+            return e.index < value;
+        });
+
+        if(iter == end || iter->index != index || iter->nameOffset >= m_header->stringBytes)
+            return nullptr;
+
+        return m_strings + iter->nameOffset;
+    }
+
+    size_t SolutionIndexFile::size() const
+    {
+        return m_header ? m_header->count : 0;
+    }
+
+    int SolutionIndexFile::lastIndex() const
+    {
+        return size() ? m_entries[size() - 1].index : -1;
+    }
+
+    bool WriteSolutionIndex(std::string const& path, std::map<int, std::string> const& files)
+    {
+        std::vector<SolutionIndexFile::Entry> entries;
+        std::string                            strings;
+
+        // Many solutions share a file, store each name once
+        std::unordered_map<std::string, uint32_t> offsets;
+        for(auto const& pair : files)
+        {
+            auto inserted = offsets.emplace(pair.second, strings.size());
+            if(inserted.second)
+            {
+                strings += pair.second;
+                strings += '\0';
+            }
+            // std::map iterates in index order, which Open relies on
+            entries.push_back({pair.first, inserted.first->second});
+        }
+
+        SolutionIndexFile::Header header{Magic,
+                                         static_cast<uint32_t>(entries.size()),
+                                         static_cast<uint32_t>(strings.size())};
+
+        std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(reinterpret_cast<char const*>(entries.data()),
+                  entries.size() * sizeof(SolutionIndexFile::Entry));
+        out.write(strings.data(), strings.size());
+        return static_cast<bool>(out);
+    }
+} // namespace TensileLite
@@ -59,18 +59,19 @@ namespace TensileLite
     template <typename MyProblem, typename MySolution>
     std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
         LoadLibraryFilePreload(std::string const&                  filename,
-                               const std::vector<LazyLoadingInit>& preloaded)
+                               const std::vector<LazyLoadingInit>& preloaded,
+                               const std::vector<LazyLoadingInit>& prefetched)
     {
         std::shared_ptr<SolutionLibrary<MyProblem, MySolution>> rv;
 
 #ifdef TENSILE_MSGPACK
-        rv = MessagePackLoadLibraryFile<MyProblem, MySolution>(filename, preloaded);
+        rv = MessagePackLoadLibraryFile<MyProblem, MySolution>(filename, preloaded, prefetched);
         if(rv)
             return rv;
 #endif
 
 #ifdef TENSILE_YAML
-        rv = LLVMLoadLibraryFile<MyProblem, MySolution>(filename, preloaded);
+        rv = LLVMLoadLibraryFile<MyProblem, MySolution>(filename, preloaded, prefetched);
         if(rv)
             return rv;
 #endif
@@ -106,7 +107,9 @@ namespace TensileLite
 
     template std::shared_ptr<SolutionLibrary<ContractionProblemGemm, ContractionSolution>>
         LoadLibraryFilePreload<ContractionProblemGemm, ContractionSolution>(
-            std::string const& filename, const std::vector<LazyLoadingInit>& preloaded);
+            std::string const&                  filename,
+            const std::vector<LazyLoadingInit>& preloaded,
+            const std::vector<LazyLoadingInit>& prefetched);
 
     template std::shared_ptr<SolutionLibrary<ContractionProblemGemm, ContractionSolution>>
         LoadLibraryData<ContractionProblemGemm, ContractionSolution>(
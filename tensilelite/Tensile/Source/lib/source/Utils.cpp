@@ -26,8 +26,65 @@
 
 #include <Tensile/Utils.hpp>
 
+#include <unordered_set>
+
 namespace TensileLite
 {
+    namespace
+    {
+        struct InternPool
+        {
+            std::mutex                      mutex;
+            std::unordered_set<std::string> values;
+            size_t                          bytes = 0;
+
+            static InternPool& Instance()
+            {
+                // Never destroyed, solutions of static libraries may outlive it otherwise
+                static InternPool* pool = new InternPool;
+                return *pool;
+            }
+
+            std::string const* intern(std::string const& value)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto                        rv = values.insert(value);
+                if(rv.second)
+                    bytes += value.size();
+                return &*rv.first;
+            }
+        };
+    } // namespace
+
+    InternedString::InternedString()
+        : InternedString(std::string())
+    {
+    }
+
+    InternedString::InternedString(std::string const& value)
+        : m_value(InternPool::Instance().intern(value))
+    {
+    }
+
+    InternedString::InternedString(char const* value)
+        : InternedString(std::string(value))
+    {
+    }
+
+    size_t InternedString::PoolSize()
+    {
+        auto&                       pool = InternPool::Instance();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        return pool.values.size();
+    }
+
+    size_t InternedString::PoolBytes()
+    {
+        auto&                       pool = InternPool::Instance();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        return pool.bytes;
+    }
+
     StreamRead::StreamRead(std::string const& value, bool except)
         : m_value(value)
         , m_except(except)
@@ -28,16 +28,47 @@
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipUtils.hpp>
 
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
 namespace TensileLite
 {
     namespace hip
     {
+        namespace
+        {
+            // The partition modes are attributes of the PCI device, which all the logical
+            // devices of a partitioned GPU share. Empty when the driver does not report them.
+            std::string partitionMode(hipDeviceProp_t const& prop, char const* attribute)
+            {
+                std::string mode;
+#ifndef WIN32
+                char path[128];
+                std::snprintf(path,
+                              sizeof(path),
+                              "/sys/bus/pci/devices/%04x:%02x:%02x.0/%s",
+                              prop.pciDomainID,
+                              prop.pciBusID,
+                              prop.pciDeviceID,
+                              attribute);
+                std::ifstream file(path);
+                file >> mode;
+#endif
+                return mode;
+            }
+        } // namespace
+
         HipAMDGPU::HipAMDGPU(hipDeviceProp_t const& prop)
             : AMDGPU(AMDGPU::toProcessor(prop.gcnArchName),
                      prop.multiProcessorCount,
                      std::string(prop.name))
             , properties(prop)
         {
+            computePartition = toComputePartition(partitionMode(prop, "current_compute_partition"));
+            memoryPartition  = toMemoryPartition(partitionMode(prop, "current_memory_partition"));
+            l2CacheSize      = prop.l2CacheSize > 0 ? prop.l2CacheSize : 0;
         }
 
         std::string HipAMDGPU::archName() const
@@ -45,6 +76,34 @@ namespace TensileLite
             return properties.gcnArchName;
         }
 
+        hipDeviceProp_t const& GetDeviceProperties(int deviceId)
+        {
+            struct CachedProperties
+            {
+                std::once_flag  once;
+                hipDeviceProp_t prop;
+            };
+            // Sized once, the entries never move, so the references handed out stay valid
+            static std::vector<CachedProperties> cache = [] {
+                int count = 0;
+                HIP_CHECK_EXC(hipGetDeviceCount(&count));
+                return std::vector<CachedProperties>(count);
+            }();
+
+            auto& entry = cache.at(deviceId);
+            std::call_once(entry.once, [&] {
+                HIP_CHECK_EXC(hipGetDeviceProperties(&entry.prop, deviceId));
+            });
+            return entry.prop;
+        }
+
+        hipDeviceProp_t const& GetCurrentDeviceProperties()
+        {
+            int deviceId = 0;
+            HIP_CHECK_EXC(hipGetDevice(&deviceId));
+            return GetDeviceProperties(deviceId);
+        }
+
         std::shared_ptr<Hardware> GetCurrentDevice()
         {
             int deviceId = 0;
@@ -54,8 +113,7 @@ namespace TensileLite
 
         std::shared_ptr<Hardware> GetDevice(int deviceId)
         {
-            hipDeviceProp_t prop;
-            HIP_CHECK_EXC(hipGetDeviceProperties(&prop, deviceId));
+            hipDeviceProp_t prop = GetDeviceProperties(deviceId);
 #if HIP_VERSION >= 50220730
             int hip_version;
             HIP_CHECK_EXC(hipRuntimeGetVersion(&hip_version));
@@ -27,12 +27,16 @@
 #include <hip/hip_ext.h>
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <fstream>
 
+#include <Tensile/CodeObjectArchive.hpp>
 #include <Tensile/Debug.hpp>
 #include <Tensile/EmbeddedData.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <Tensile/hip/ModuleRegistry.hpp>
 
 //@TODO add alternative for windows
 #ifndef WIN32
@@ -44,14 +48,77 @@ namespace TensileLite
 {
     namespace hip
     {
+        namespace
+        {
+            struct HipModuleLoader
+            {
+                using Module   = hipModule_t;
+                using Function = hipFunction_t;
+                using Error    = hipError_t;
+
+                static constexpr hipError_t Success = hipSuccess;
+
+                hipError_t device(int& id)
+                {
+                    return hipGetDevice(&id);
+                }
+
+                hipError_t load(hipModule_t& module, std::string const& path)
+                {
+                    return hipModuleLoad(&module, path.c_str());
+                }
+
+                hipError_t loadData(hipModule_t& module, void const* image)
+                {
+                    return hipModuleLoadData(&module, image);
+                }
+
+                void unload(hipModule_t module)
+                {
+                    HIP_CHECK_PRINT(hipModuleUnload(module));
+                }
+
+                hipError_t
+                    getFunction(hipFunction_t& function, hipModule_t module, std::string const& name)
+                {
+                    return hipModuleGetFunction(&function, module, name.c_str());
+                }
+
+                size_t fileSize(std::string const& path)
+                {
+                    std::ifstream file(path, std::ios::binary | std::ios::ate);
+                    return file ? static_cast<size_t>(file.tellg()) : 0;
+                }
+
+                bool readFile(std::string const& path, std::vector<char>& bytes)
+                {
+                    std::ifstream file(path, std::ios::binary | std::ios::ate);
+                    if(!file)
+                        return false;
+                    bytes.resize(static_cast<size_t>(file.tellg()));
+                    file.seekg(0);
+                    return bytes.size() && file.read(bytes.data(), bytes.size());
+                }
+            };
+
+            // Never destroyed, adapters with static storage release their modules at exit
+            ModuleRegistry<HipModuleLoader>& moduleRegistry()
+            {
+                static auto* registry = new ModuleRegistry<HipModuleLoader>;
+                return *registry;
+            }
+        } // namespace
+
         SolutionAdapter::SolutionAdapter()
             : m_debug(Debug::Instance().printKernelArguments())
             , m_debugSkipLaunch(Debug::Instance().skipKernelLaunch())
+            , m_codeObjectBudget(Debug::Instance().codeObjectBudget() << 20)
         {
         }
 
         SolutionAdapter::SolutionAdapter(bool debug)
             : m_debug(debug)
+            , m_codeObjectBudget(Debug::Instance().codeObjectBudget() << 20)
         {
             m_debug = debug || Debug::Instance().printKernelArguments();
         }
@@ -59,6 +126,7 @@ namespace TensileLite
         SolutionAdapter::SolutionAdapter(bool debug, std::string const& name)
             : m_debug(debug)
             , m_name(name)
+            , m_codeObjectBudget(Debug::Instance().codeObjectBudget() << 20)
         {
             m_debug = debug || Debug::Instance().printKernelArguments();
         }
@@ -67,7 +135,7 @@ namespace TensileLite
         {
             Debug::Instance().markerStart("UnloadCodeObjectFiles");
             for(auto module : m_modules)
-                HIP_CHECK_PRINT(hipModuleUnload(module));
+                moduleRegistry().release(module);
             Debug::Instance().markerStop();
         }
 
@@ -82,39 +150,147 @@ namespace TensileLite
         }
 
         hipError_t SolutionAdapter::loadCodeObjectFile(std::string const& path)
+        {
+            return loadModuleFile(path, false);
+        }
+
+        hipError_t SolutionAdapter::loadModuleFile(std::string const& path, bool onDemand)
         {
             Debug::Instance().markerStart("loadCodeObjectFile", path);
             hipModule_t module;
 
-            HIP_CHECK_RETURN(hipModuleLoad(&module, path.c_str()));
+            //Isolate filename
+            size_t start = path.rfind('/');
+            start        = (start == std::string::npos) ? 0 : start + 1;
+            std::string name(path.begin() + start, path.end());
+
+            m_access.lock();
+            auto archive = m_archive;
+            m_access.unlock();
+
+            // A packed code object is a slice of the mapped archive
+            size_t      imageBytes = 0;
+            void const* image      = archive ? archive->find(name, &imageBytes) : nullptr;
+            bool        packed     = image != nullptr;
+            bool        shared     = false;
+            hipError_t  err;
+            if(packed)
+                err = moduleRegistry().acquireImage(
+                    module, image, imageBytes, {"", image, archive}, shared);
+            else
+                err = moduleRegistry().acquireFile(module, path, imageBytes, shared);
+            if(err != hipSuccess)
+            {
+                Debug::Instance().markerStop();
+                return err;
+            }
 
             if(m_debug)
-                std::cout << "loaded code object " << path << std::endl;
+                std::cout << (shared ? "shared code object " : "loaded code object ") << path
+                          << (packed ? " from archive" : "") << std::endl;
+
+            std::string file = removeXnack(name);
+
+            std::unique_ptr<ResidentModule> resident;
+            if(onDemand && m_codeObjectBudget)
+            {
+                resident         = std::make_unique<ResidentModule>();
+                resident->module = module;
+                resident->file   = file;
+                // Only the first user of a shared module accounts for its bytes
+                resident->bytes  = shared ? 0 : imageBytes;
+                resident->lastUse.store(m_launchClock.fetch_add(1, std::memory_order_relaxed) + 1,
+                                        std::memory_order_relaxed);
+            }
 
             {
                 std::lock_guard<std::mutex> guard(m_access);
                 m_modules.push_back(module);
+                m_codeObjectsLoaded.fetch_add(1, std::memory_order_relaxed);
+                if(shared)
+                    m_codeObjectsShared.fetch_add(1, std::memory_order_relaxed);
                 m_loadedModuleNames.push_back(concatenate("File ", path));
+                m_loadedCOFiles.insert(file);
 
-                //Isolate filename
-                size_t start = path.rfind('/');
-                start        = (start == std::string::npos) ? 0 : start + 1;
-                m_loadedCOFiles.insert(removeXnack(std::string(path.begin() + start, path.end())));
+                if(resident)
+                {
+                    m_residentBytes += resident->bytes;
+                    m_residentModules.push_back(std::move(resident));
+                    if(m_residentBytes > m_codeObjectBudget)
+                        m_overBudget.store(true, std::memory_order_relaxed);
+                }
             }
             Debug::Instance().markerStop();
             return hipSuccess;
         }
 
+        void SolutionAdapter::evictColdModules()
+        {
+            // Waits for the launches in progress, later ones resolve their kernels again
+            std::unique_lock<std::shared_mutex> residency(m_residency);
+            std::lock_guard<std::mutex>         guard(m_access);
+
+            m_overBudget.store(false, std::memory_order_relaxed);
+            if(m_residentBytes <= m_codeObjectBudget || m_residentModules.size() < 2)
+                return;
+
+            // Kernels enqueued earlier may still run from the modules
+            if(hipDeviceSynchronize() != hipSuccess)
+                return;
+
+            std::sort(m_residentModules.begin(),
+                      m_residentModules.end(),
+                      [](auto const& a, auto const& b) {
+                          return a->lastUse.load(std::memory_order_relaxed)
+                                 < b->lastUse.load(std::memory_order_relaxed);
+                      });
+
+            Debug::Instance().markerStart("UnloadCodeObjectFiles");
+            auto newest = m_residentModules.end() - 1;
+            for(auto iter = m_residentModules.begin();
+                iter != newest && m_residentBytes > m_codeObjectBudget;
+                iter++)
+            {
+                auto& resident = *iter;
+                if(resident->pinned.load(std::memory_order_relaxed))
+                    continue;
+
+                m_kernels.evict(resident.get());
+                m_modules.erase(std::find(m_modules.begin(), m_modules.end(), resident->module));
+                m_loadedCOFiles.erase(resident->file);
+                m_residentBytes -= resident->bytes;
+                moduleRegistry().release(resident->module);
+                m_codeObjectsUnloaded.fetch_add(1, std::memory_order_relaxed);
+
+                if(m_debug)
+                    std::cout << "unloaded code object " << resident->file << std::endl;
+
+                resident.reset();
+            }
+            Debug::Instance().markerStop();
+
+            m_residentModules.erase(
+                std::remove(m_residentModules.begin(), m_residentModules.end(), nullptr),
+                m_residentModules.end());
+        }
+
         hipError_t SolutionAdapter::loadCodeObjectBytes(std::vector<uint8_t> const& bytes)
         {
-            return loadCodeObject(bytes.data());
+            return loadCodeObject(bytes.data(), bytes.size());
         }
 
         hipError_t SolutionAdapter::loadCodeObject(const void* image)
+        {
+            return loadCodeObject(image, 0);
+        }
+
+        hipError_t SolutionAdapter::loadCodeObject(const void* image, size_t bytes)
         {
             hipModule_t module;
+            bool        shared = false;
 
-            HIP_CHECK_RETURN(hipModuleLoadData(&module, image));
+            // The caller's memory may not outlive the module, later loads can't compare with it
+            HIP_CHECK_RETURN(moduleRegistry().acquireImage(module, image, bytes, {}, shared));
 
             if(m_debug)
                 std::cout << "loaded code object data." << std::endl;
@@ -122,6 +298,9 @@ namespace TensileLite
             {
                 std::lock_guard<std::mutex> guard(m_access);
                 m_modules.push_back(module);
+                m_codeObjectsLoaded.fetch_add(1, std::memory_order_relaxed);
+                if(shared)
+                    m_codeObjectsShared.fetch_add(1, std::memory_order_relaxed);
                 m_loadedModuleNames.push_back("Module from bytes");
             }
             return hipSuccess;
@@ -151,17 +330,24 @@ namespace TensileLite
 
             std::vector<hipModule_t> newModules;
             newModules.reserve(embeddedData.size());
+            size_t sharedModules = 0;
 
             for(size_t i = 0; i < embeddedData.size(); i++)
             {
                 hipModule_t nextModule;
+                bool        shared = false;
                 try
                 {
-                    auto error = hipModuleLoadData(&nextModule, embeddedData[i].data());
+                    auto error = moduleRegistry().acquireImage(nextModule,
+                                                               embeddedData[i].data(),
+                                                               embeddedData[i].size(),
+                                                               {"", embeddedData[i].data(), nullptr},
+                                                               shared);
 
                     if(error == hipErrorUnknown || error == hipErrorSharedObjectInitFailed)
                         continue;
                     newModules.push_back(nextModule);
+                    sharedModules += shared;
                     HIP_CHECK_EXC(error);
 
                     if(m_debug)
@@ -176,6 +362,8 @@ namespace TensileLite
             {
                 std::lock_guard<std::mutex> guard(m_access);
                 m_modules.insert(m_modules.end(), newModules.begin(), newModules.end());
+                m_codeObjectsLoaded.fetch_add(newModules.size(), std::memory_order_relaxed);
+                m_codeObjectsShared.fetch_add(sharedModules, std::memory_order_relaxed);
                 m_loadedModuleNames.push_back(
                     concatenate("Embedded code object ", key, " (", newModules.size(), ")"));
             }
@@ -188,19 +376,31 @@ namespace TensileLite
             bool loaded = m_loadedCOFiles.find(removeXnack(codeObjectFile))
                           != m_loadedCOFiles.end();
             std::string codeObjectDir = m_codeObjectDirectory;
+            auto        archive       = m_archive;
             m_access.unlock();
 
             if(!loaded)
             {
                 //Try other xnack versions
-                size_t     loc = codeObjectFile.rfind('.');
-                hipError_t err;
+                size_t                   loc = codeObjectFile.rfind('.');
+                hipError_t               err;
+                std::vector<std::string> names;
 
                 for(auto ver : {"", "-xnack-", "-xnack+"})
                 {
-                    std::string modifiedCOName = codeObjectFile;
-                    modifiedCOName.insert(loc, ver);
-                    err = loadCodeObjectFile(codeObjectDir + modifiedCOName);
+                    names.push_back(codeObjectFile);
+                    names.back().insert(loc, ver);
+                }
+
+                // Packed versions first, they are found without opening files that do not exist
+                if(archive)
+                    std::stable_partition(names.begin(), names.end(), [&](auto const& name) {
+                        return archive->find(name) != nullptr;
+                    });
+
+                for(auto const& modifiedCOName : names)
+                {
+                    err = loadModuleFile(codeObjectDir + modifiedCOName, true);
 
                     if(err == hipSuccess)
                         break;
@@ -231,25 +431,129 @@ namespace TensileLite
             return hipSuccess;
         }
 
+        SolutionAdapter::KernelTable::KernelTable()
+        {
+            grow(256);
+        }
+
+        SolutionAdapter::KernelTable::Entry const*
+            SolutionAdapter::KernelTable::find(std::string const& name) const
+        {
+            size_t         hash    = std::hash<std::string>{}(name);
+            Buckets const* buckets = m_buckets.load(std::memory_order_acquire);
+
+            // The load factor stays below 1/2, so every probe sequence ends in an empty slot.
+            // Dropped entries keep their slot, a reloaded kernel is found further on
+            for(size_t i = hash & buckets->mask;; i = (i + 1) & buckets->mask)
+            {
+                Entry const* entry = buckets->slots[i].load(std::memory_order_acquire);
+                if(!entry)
+                    return nullptr;
+                if(entry->hash == hash && entry->name == name
+                   && entry->function.load(std::memory_order_acquire))
+                    return entry;
+            }
+        }
+
+        void SolutionAdapter::KernelTable::insert(std::string const& name,
+                                                  hipFunction_t      function,
+                                                  ResidentModule*    module)
+        {
+            Buckets const* buckets = m_buckets.load(std::memory_order_relaxed);
+            if(2 * (m_occupied + 1) > buckets->mask + 1)
+            {
+                // Dropped entries are not carried over, so the table only grows with
+                // the live ones
+                size_t capacity = 256;
+                while(capacity < 4 * (m_live + 1))
+                    capacity *= 2;
+                grow(capacity);
+            }
+
+            auto entry    = std::make_unique<Entry>();
+            entry->name   = name;
+            entry->hash   = std::hash<std::string>{}(name);
+            entry->module = module;
+            entry->function.store(function, std::memory_order_relaxed);
+
+            m_entries.push_back(std::move(entry));
+            place(*m_buckets.load(std::memory_order_relaxed), m_entries.back().get());
+            m_occupied++;
+            m_live++;
+        }
+
+        void SolutionAdapter::KernelTable::evict(ResidentModule const* module)
+        {
+            for(auto const& entry : m_entries)
+            {
+                if(entry->module == module && entry->function.load(std::memory_order_relaxed))
+                {
+                    entry->function.store(nullptr, std::memory_order_release);
+                    m_live--;
+                }
+            }
+        }
+
+        void SolutionAdapter::KernelTable::grow(size_t capacity)
+        {
+            auto buckets   = std::make_unique<Buckets>();
+            buckets->mask  = capacity - 1;
+            buckets->slots = std::make_unique<std::atomic<Entry const*>[]>(capacity);
+
+            m_occupied = 0;
+            for(auto const& entry : m_entries)
+            {
+                if(entry->function.load(std::memory_order_relaxed))
+                {
+                    place(*buckets, entry.get());
+                    m_occupied++;
+                }
+            }
+
+            m_buckets.store(buckets.get(), std::memory_order_release);
+            m_allBuckets.push_back(std::move(buckets));
+        }
+
+        void SolutionAdapter::KernelTable::place(Buckets const& buckets, Entry const* entry)
+        {
+            size_t i = entry->hash & buckets.mask;
+            while(buckets.slots[i].load(std::memory_order_relaxed))
+                i = (i + 1) & buckets.mask;
+
+            buckets.slots[i].store(entry, std::memory_order_release);
+        }
+
         hipError_t SolutionAdapter::getKernel(hipFunction_t& rv, std::string const& name)
         {
+            if(auto entry = m_kernels.find(name))
+            {
+                rv = entry->function.load(std::memory_order_relaxed);
+                return hipSuccess;
+            }
+
             std::unique_lock<std::mutex> guard(m_access);
             hipError_t                   err = hipErrorNotFound;
 
-            auto it = m_kernels.find(name);
-            if(it != m_kernels.end())
+            // Another thread may have resolved the kernel while we waited
+            if(auto entry = m_kernels.find(name))
             {
-                rv = it->second;
+                rv = entry->function.load(std::memory_order_relaxed);
                 return hipSuccess;
             }
 
             for(auto module : m_modules)
             {
-                err = hipModuleGetFunction(&rv, module, name.c_str());
+                err = moduleRegistry().getFunction(rv, module, name);
 
                 if(err == hipSuccess)
                 {
-                    m_kernels[name] = rv;
+                    auto resident = std::find_if(
+                        m_residentModules.begin(),
+                        m_residentModules.end(),
+                        [module](auto const& r) { return r->module == module; });
+                    m_kernels.insert(
+                        name, rv, resident != m_residentModules.end() ? resident->get() : nullptr);
+                    m_kernelsResolved.fetch_add(1, std::memory_order_relaxed);
                     return err;
                 }
                 else if(err != hipErrorNotFound)
@@ -275,8 +579,13 @@ namespace TensileLite
 
             std::string helperKernelName = std::string("Kernels.so-000-") + arch;
 
+            auto archive
+                = CodeObjectArchive::Open(codeObjectDir + "TensileCodeObjects_" + arch + ".coa");
+
             m_access.lock();
             m_codeObjectDirectory = codeObjectDir;
+            if(archive)
+                m_archive = archive;
 
             //If required code object file hasn't yet been loaded, load it now
             bool loaded = m_loadedCOFiles.find(removeXnack(helperKernelName) + ".hsaco")
@@ -313,7 +622,24 @@ namespace TensileLite
                                                  hipEvent_t              stopEvent,
                                                  bool                    isKernelLoaded)
         {
-            if(!isKernelLoaded && !kernel.codeObjectFile.empty())
+            if(m_codeObjectBudget && m_overBudget.load(std::memory_order_relaxed))
+                evictColdModules();
+
+            // Modules are only unloaded between launches, any kernel resolved below stays
+            // valid until the launch is enqueued
+            std::shared_lock<std::shared_mutex> residency(m_residency, std::defer_lock);
+            if(m_codeObjectBudget)
+            {
+                residency.lock();
+                isKernelLoaded = false;
+            }
+
+            // A resolved kernel implies its code object is loaded, so the launch does not
+            // have to take m_access
+            auto          entry = m_kernels.find(kernel.kernelName);
+            hipFunction_t function
+                = entry ? entry->function.load(std::memory_order_relaxed) : nullptr;
+            if(!function && !isKernelLoaded && !kernel.codeObjectFile.empty())
             {
                 FindCodeObject(kernel.codeObjectFile);
             }
@@ -335,9 +661,39 @@ namespace TensileLite
                 return hipSuccess;
             }
 
-            hipFunction_t function;
-            HIP_CHECK_RETURN(getKernel(function, kernel.kernelName));
+            if(!function)
+                HIP_CHECK_RETURN(getKernel(function, kernel.kernelName));
+
+            if(m_codeObjectBudget)
+            {
+                if(!entry)
+                    entry = m_kernels.find(kernel.kernelName);
+
+                if(entry && entry->module)
+                {
+                    entry->module->lastUse.store(
+                        m_launchClock.fetch_add(1, std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+
+                    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+                    if(hipStreamIsCapturing(stream, &capture) == hipSuccess
+                       && capture != hipStreamCaptureStatusNone)
+                        entry->module->pinned.store(true, std::memory_order_relaxed);
+                }
+            }
+
+            if(startEvent != nullptr)
+                HIP_CHECK_RETURN(hipEventRecord(startEvent, stream));
+            HIP_CHECK_RETURN(launchResolvedKernel(kernel, function, stream));
+            if(stopEvent != nullptr)
+                HIP_CHECK_RETURN(hipEventRecord(stopEvent, stream));
+            return hipSuccess;
+        }
 
+        hipError_t SolutionAdapter::launchResolvedKernel(KernelInvocation const& kernel,
+                                                         hipFunction_t           function,
+                                                         hipStream_t             stream)
+        {
             void*  kernelArgs = const_cast<void*>(kernel.args.data());
             size_t argsSize   = kernel.args.size();
 
@@ -347,25 +703,20 @@ namespace TensileLite
                                        &argsSize,
                                        HIP_LAUNCH_PARAM_END};
 
-            if(startEvent != nullptr)
-                HIP_CHECK_RETURN(hipEventRecord(startEvent, stream));
-            HIP_CHECK_RETURN(hipExtModuleLaunchKernel(function,
-                                                      kernel.numWorkItems.x,
-                                                      kernel.numWorkItems.y,
-                                                      kernel.numWorkItems.z,
-                                                      kernel.workGroupSize.x,
-                                                      kernel.workGroupSize.y,
-                                                      kernel.workGroupSize.z,
-                                                      kernel.sharedMemBytes, // sharedMem
-                                                      stream, // stream
-                                                      nullptr,
-                                                      (void**)&hipLaunchParams,
-                                                      nullptr, // event
-                                                      nullptr // event
-                                                      ));
-            if(stopEvent != nullptr)
-                HIP_CHECK_RETURN(hipEventRecord(stopEvent, stream));
-            return hipSuccess;
+            return hipExtModuleLaunchKernel(function,
+                                            kernel.numWorkItems.x,
+                                            kernel.numWorkItems.y,
+                                            kernel.numWorkItems.z,
+                                            kernel.workGroupSize.x,
+                                            kernel.workGroupSize.y,
+                                            kernel.workGroupSize.z,
+                                            kernel.sharedMemBytes, // sharedMem
+                                            stream, // stream
+                                            nullptr,
+                                            (void**)&hipLaunchParams,
+                                            nullptr, // event
+                                            nullptr // event
+            );
         }
 
         hipError_t SolutionAdapter::launchKernels(std::vector<KernelInvocation> const& kernels)
@@ -377,6 +728,26 @@ namespace TensileLite
             return hipSuccess;
         }
 
+        hipError_t SolutionAdapter::launchKernels(std::vector<KernelInvocation> const& kernels,
+                                                  hipStream_t                          stream)
+        {
+            // Debug output and the code object budget need the full launch path
+            if(m_debug || m_debugSkipLaunch || m_codeObjectBudget)
+                return launchKernels(kernels, stream, nullptr, nullptr);
+
+            for(auto const& kernel : kernels)
+            {
+                auto          entry = m_kernels.find(kernel.kernelName);
+                hipFunction_t function
+                    = entry ? entry->function.load(std::memory_order_relaxed) : nullptr;
+                if(function)
+                    HIP_CHECK_RETURN(launchResolvedKernel(kernel, function, stream));
+                else
+                    HIP_CHECK_RETURN(launchKernel(kernel, stream, nullptr, nullptr));
+            }
+            return hipSuccess;
+        }
+
         hipError_t SolutionAdapter::launchKernels(std::vector<KernelInvocation> const& kernels,
                                                   hipStream_t                          stream,
                                                   hipEvent_t                           startEvent,
@@ -422,6 +793,118 @@ namespace TensileLite
             return hipSuccess;
         }
 
+        hipError_t SolutionAdapter::kernelNodeParams(KernelInvocation const& kernel,
+                                                     KernelNodeParams&       node)
+        {
+            std::shared_lock<std::shared_mutex> residency(m_residency, std::defer_lock);
+            if(m_codeObjectBudget)
+                residency.lock();
+
+            auto          entry = m_kernels.find(kernel.kernelName);
+            hipFunction_t function
+                = entry ? entry->function.load(std::memory_order_relaxed) : nullptr;
+            if(!function)
+            {
+                if(!kernel.codeObjectFile.empty())
+                    FindCodeObject(kernel.codeObjectFile);
+                HIP_CHECK_RETURN(getKernel(function, kernel.kernelName));
+                entry = m_kernels.find(kernel.kernelName);
+            }
+            // The graph keeps launching the kernel, so its module must stay loaded
+            if(entry && entry->module)
+                entry->module->pinned.store(true, std::memory_order_relaxed);
+
+            node.argsSize = kernel.args.size();
+            node.extra[0] = HIP_LAUNCH_PARAM_BUFFER_POINTER;
+            node.extra[1] = const_cast<void*>(kernel.args.data());
+            node.extra[2] = HIP_LAUNCH_PARAM_BUFFER_SIZE;
+            node.extra[3] = &node.argsSize;
+            node.extra[4] = HIP_LAUNCH_PARAM_END;
+
+            // Kernel nodes take a module function in place of a host function pointer
+            node.params.func           = reinterpret_cast<void*>(function);
+            node.params.gridDim        = kernel.numWorkGroups;
+            node.params.blockDim       = kernel.workGroupSize;
+            node.params.sharedMemBytes = kernel.sharedMemBytes;
+            node.params.kernelParams   = nullptr;
+            node.params.extra          = node.extra;
+            return hipSuccess;
+        }
+
+        hipError_t SolutionAdapter::chainKernelNodes(std::vector<KernelInvocation> const& kernels,
+                                                     hipGraph_t                           graph)
+        {
+            hipGraphNode_t previous = nullptr;
+            for(auto const& kernel : kernels)
+            {
+                KernelNodeParams node;
+                HIP_CHECK_RETURN(kernelNodeParams(kernel, node));
+
+                hipGraphNode_t current = nullptr;
+                HIP_CHECK_RETURN(hipGraphAddKernelNode(&current,
+                                                       graph,
+                                                       previous ? &previous : nullptr,
+                                                       previous ? 1 : 0,
+                                                       &node.params));
+                previous = current;
+            }
+            return hipSuccess;
+        }
+
+        hipError_t SolutionAdapter::addGraphNode(std::vector<KernelInvocation> const& kernels,
+                                                 hipGraph_t                           graph,
+                                                 hipGraphNode_t const*                dependencies,
+                                                 size_t                               numDependencies,
+                                                 hipGraphNode_t&                      node)
+        {
+            if(kernels.size() == 1)
+            {
+                KernelNodeParams params;
+                HIP_CHECK_RETURN(kernelNodeParams(kernels[0], params));
+                return hipGraphAddKernelNode(
+                    &node, graph, dependencies, numDependencies, &params.params);
+            }
+
+            // The child graph is cloned into graph
+            hipGraph_t child = nullptr;
+            HIP_CHECK_RETURN(hipGraphCreate(&child, 0));
+            hipError_t err = chainKernelNodes(kernels, child);
+            if(err == hipSuccess)
+                err = hipGraphAddChildGraphNode(&node, graph, dependencies, numDependencies, child);
+            static_cast<void>(hipGraphDestroy(child));
+            return err;
+        }
+
+        hipError_t SolutionAdapter::setGraphNode(std::vector<KernelInvocation> const& kernels,
+                                                 hipGraphExec_t                       exec,
+                                                 hipGraphNode_t                       node)
+        {
+            if(kernels.size() == 1)
+            {
+                KernelNodeParams params;
+                HIP_CHECK_RETURN(kernelNodeParams(kernels[0], params));
+                return hipGraphExecKernelNodeSetParams(exec, node, &params.params);
+            }
+
+            hipGraph_t child = nullptr;
+            HIP_CHECK_RETURN(hipGraphCreate(&child, 0));
+            hipError_t err = chainKernelNodes(kernels, child);
+            if(err == hipSuccess)
+                err = hipGraphExecChildGraphNodeSetParams(exec, node, child);
+            static_cast<void>(hipGraphDestroy(child));
+            return err;
+        }
+
+        SolutionAdapter::Stats SolutionAdapter::stats() const
+        {
+            Stats rv;
+            rv.codeObjectsLoaded   = m_codeObjectsLoaded.load(std::memory_order_relaxed);
+            rv.codeObjectsUnloaded = m_codeObjectsUnloaded.load(std::memory_order_relaxed);
+            rv.codeObjectsShared   = m_codeObjectsShared.load(std::memory_order_relaxed);
+            rv.kernelsResolved     = m_kernelsResolved.load(std::memory_order_relaxed);
+            return rv;
+        }
+
         std::ostream& operator<<(std::ostream& stream, SolutionAdapter const& adapter)
         {
             stream << "hip::SolutionAdapter";
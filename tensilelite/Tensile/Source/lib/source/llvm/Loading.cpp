@@ -38,7 +38,8 @@ namespace TensileLite
     template <typename MyProblem, typename MySolution>
     std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
         LLVMLoadLibraryFile(std::string const&                  filename,
-                            const std::vector<LazyLoadingInit>& preloaded)
+                            const std::vector<LazyLoadingInit>& preloaded,
+                            const std::vector<LazyLoadingInit>& prefetched)
     {
         std::shared_ptr<MasterSolutionLibrary<MyProblem, MySolution>> rv;
 
@@ -47,6 +48,7 @@ namespace TensileLite
             auto inputFile = llvm::MemoryBuffer::getFileAsStream(filename);
 
             LibraryIOContext<MySolution> context{filename, preloaded, nullptr};
+            context.prefetched = prefetched;
             llvm::yaml::Input            yin((*inputFile)->getMemBufferRef(), &context);
 
             yin >> rv;
@@ -100,7 +102,9 @@ namespace TensileLite
 
     template std::shared_ptr<SolutionLibrary<ContractionProblemGemm, ContractionSolution>>
         LLVMLoadLibraryFile<ContractionProblemGemm, ContractionSolution>(
-            std::string const& filename, const std::vector<LazyLoadingInit>& preloaded);
+            std::string const&                  filename,
+            const std::vector<LazyLoadingInit>& preloaded,
+            const std::vector<LazyLoadingInit>& prefetched);
 
     template std::shared_ptr<SolutionLibrary<ContractionProblemGemm, ContractionSolution>>
         LLVMLoadLibraryData<ContractionProblemGemm, ContractionSolution>(
@@ -30,6 +30,13 @@
 
 #include <fstream>
 
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace TensileLite
 {
     namespace Serialization
@@ -67,47 +74,122 @@ namespace TensileLite
         }
     }
 
+    namespace
+    {
+        /**
+         * Read-only mapping of a whole library file. Objects unpacked from it with
+         * referenceMapped point into the mapping instead of owning copies of their
+         * strings, so it has to outlive them.
+         */
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(std::string const& filename)
+            {
+#ifndef WIN32
+                int fd = open(filename.c_str(), O_RDONLY);
+                if(fd < 0)
+                    return;
+
+                struct stat st;
+                if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+                {
+                    void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if(ptr != MAP_FAILED)
+                    {
+                        madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+                        m_data = static_cast<char const*>(ptr);
+                        m_size = st.st_size;
+                    }
+                }
+                close(fd);
+#endif
+            }
+
+            ~MappedFile()
+            {
+#ifndef WIN32
+                if(m_data)
+                    munmap(const_cast<char*>(m_data), m_size);
+#endif
+            }
+
+            MappedFile(MappedFile const&)            = delete;
+            MappedFile& operator=(MappedFile const&) = delete;
+
+            char const* data() const
+            {
+                return m_data;
+            }
+
+            size_t size() const
+            {
+                return m_size;
+            }
+
+        private:
+            char const* m_data = nullptr;
+            size_t      m_size = 0;
+        };
+
+        bool referenceMapped(msgpack::type::object_type type, std::size_t length, void* userData)
+        {
+            return true;
+        }
+    } // namespace
+
     template <typename MyProblem, typename MySolution>
     std::shared_ptr<SolutionLibrary<MyProblem, MySolution>>
         MessagePackLoadLibraryFile(std::string const&                  filename,
-                                   const std::vector<LazyLoadingInit>& preloaded)
+                                   const std::vector<LazyLoadingInit>& preloaded,
+                                   const std::vector<LazyLoadingInit>& prefetched)
     {
-        // parse file into a msgpack::object_handle
+        // parse file into a msgpack::object_handle, straight from the mapped file when
+        // possible so the file is neither copied into read buffers nor its strings into
+        // the object zone
+        MappedFile             mapped(filename);
         msgpack::object_handle result;
         try
         {
-            std::ifstream in(filename, std::ios::in | std::ios::binary);
-            if(!in.is_open())
+            if(mapped.data())
             {
-                if(Debug::Instance().printDataInit())
-                    std::cout << "Error loading " << filename << " (msgpack):\nFailed to open file"
-                              << std::endl;
-
-                return nullptr;
+                result = msgpack::unpack(mapped.data(), mapped.size(), referenceMapped);
             }
-
-            msgpack::unpacker unp;
-            bool              finished_parsing;
-            constexpr size_t  buffer_size = 1 << 19;
-            do
+            else
             {
-                unp.reserve_buffer(buffer_size);
-                in.read(unp.buffer(), buffer_size);
-                unp.buffer_consumed(in.gcount());
-                finished_parsing = unp.next(result); // may throw msgpack::parse_error
-            } while(!finished_parsing && !in.fail());
-
-            if(!finished_parsing)
-            {
-                if(Debug::Instance().printDataInit())
+                std::ifstream in(filename, std::ios::in | std::ios::binary);
+                if(!in.is_open())
                 {
-                    const char* const error_str
-                        = in.eof() ? "Unexpected end of file" : "Read failure";
-                    std::cout << "Error loading " << filename << " (msgpack):\n"
-                              << error_str << std::endl;
+                    if(Debug::Instance().printDataInit())
+                        std::cout << "Error loading " << filename
+                                  << " (msgpack):\nFailed to open file" << std::endl;
+
+                    return nullptr;
                 }
 
-                return nullptr;
+                msgpack::unpacker unp;
+                bool              finished_parsing;
+                constexpr size_t  buffer_size = 1 << 19;
+                do
+                {
+                    unp.reserve_buffer(buffer_size);
+                    in.read(unp.buffer(), buffer_size);
+                    unp.buffer_consumed(in.gcount());
+                    finished_parsing = unp.next(result); // may throw msgpack::parse_error
+                } while(!finished_parsing && !in.fail());
+
+                if(!finished_parsing)
+                {
+                    if(Debug::Instance().printDataInit())
+                    {
+                        const char* const error_str
+                            = in.eof() ? "Unexpected end of file" : "Read failure";
+                        std::cout << "Error loading " << filename << " (msgpack):\n"
+                                  << error_str << std::endl;
+                    }
+
+                    return nullptr;
+                }
             }
         }
         catch(std::runtime_error const& exc)
@@ -124,6 +206,7 @@ namespace TensileLite
             std::shared_ptr<MasterSolutionLibrary<MyProblem, MySolution>> rv;
 
             LibraryIOContext<MySolution>    context{filename, preloaded, nullptr};
+            context.prefetched = prefetched;
             Serialization::MessagePackInput min(result.get(), &context);
 
             Serialization::PointerMappingTraits<TensileLite::MasterContractionLibrary,
@@ -188,7 +271,9 @@ namespace TensileLite
 
     template std::shared_ptr<SolutionLibrary<ContractionProblemGemm, ContractionSolution>>
         MessagePackLoadLibraryFile<ContractionProblemGemm, ContractionSolution>(
-            std::string const& filename, const std::vector<LazyLoadingInit>& preloaded);
+            std::string const&                  filename,
+            const std::vector<LazyLoadingInit>& preloaded,
+            const std::vector<LazyLoadingInit>& prefetched);
 
     template std::shared_ptr<SolutionLibrary<ContractionProblemGemm, ContractionSolution>>
         MessagePackLoadLibraryData<ContractionProblemGemm, ContractionSolution>(